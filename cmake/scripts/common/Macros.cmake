@@ -117,6 +117,17 @@ function(core_add_test_library name)
   endforeach()
 endfunction()
 
+# Add sources to the list used for the benchmark binary
+# Implicit arguments:
+#   SOURCES the sources of the benchmarks
+#   HEADERS the headers of the benchmarks (only for IDE support)
+function(core_add_bench_sources)
+  foreach(src IN LISTS SOURCES HEADERS)
+    get_filename_component(src_path "${src}" ABSOLUTE)
+    set(bench_sources "${src_path}" ${bench_sources} CACHE STRING "" FORCE)
+  endforeach()
+endfunction()
+
 # Add addon dev kit headers to main application
 # Arguments:
 #   name name of the header part to add
@@ -37,6 +37,10 @@ uniform mat3 m_primMat;
 uniform float m_gammaDstInv;
 uniform float m_gammaSrc;
 uniform float m_alpha;
+#if defined(KODI_TONE_MAPPING_LUT)
+uniform sampler3D m_toneLut;
+uniform float m_toneLutSize;
+#endif
 
 vec2 stretch(vec2 pos)
 {
@@ -122,9 +126,13 @@ vec4 process()
 #endif
 
 #if defined(XBMC_COL_CONVERSION)
+#if defined(KODI_TONE_MAPPING_LUT)
+  rgb.rgb = texture3D(m_toneLut, (clamp(rgb.rgb, 0.0, 1.0) * (m_toneLutSize - 1.0) + 0.5) / m_toneLutSize).rgb;
+#else
   rgb.rgb = pow(max(vec3(0), rgb.rgb), vec3(m_gammaSrc));
   rgb.rgb = max(vec3(0), m_primMat * rgb.rgb);
   rgb.rgb = pow(rgb.rgb, vec3(m_gammaDstInv));
+#endif
 #endif
 
   return rgb;
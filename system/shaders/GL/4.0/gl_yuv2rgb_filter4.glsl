@@ -19,6 +19,10 @@ uniform float m_gammaSrc;
 uniform float m_toneP1;
 uniform float m_luminance;
 uniform vec3 m_coefsDst;
+#if defined(KODI_TONE_MAPPING_LUT)
+uniform sampler3D m_toneLut;
+uniform float m_toneLutSize;
+#endif
 in vec2 m_cordY;
 in vec2 m_cordU;
 in vec2 m_cordV;
@@ -112,6 +116,9 @@ vec4 process()
   rgb.a = m_alpha;
 
 #if defined(XBMC_COL_CONVERSION)
+#if defined(KODI_TONE_MAPPING_LUT)
+  rgb.rgb = texture(m_toneLut, (clamp(rgb.rgb, 0.0, 1.0) * (m_toneLutSize - 1.0) + 0.5) / m_toneLutSize).rgb;
+#else
   rgb.rgb = pow(max(vec3(0), rgb.rgb), vec3(m_gammaSrc));
   rgb.rgb = max(vec3(0), m_primMat * rgb.rgb);
   rgb.rgb = pow(rgb.rgb, vec3(m_gammaDstInv));
@@ -134,6 +141,7 @@ vec4 process()
   rgb.rgb = hable(rgb.rgb * wp) / hable(vec3(wp));
   rgb.rgb = pow(rgb.rgb, vec3(1.0 / 2.2));
 #endif
+#endif
 
 #endif
 
@@ -11,6 +11,7 @@
 #include "ServiceBroker.h"
 #include "TextureDatabase.h"
 #include "addons/AddonDatabase.h"
+#include "dbwrappers/DatabaseConnectionPool.h"
 #include "music/MusicDatabase.h"
 #include "pvr/PVRDatabase.h"
 #include "pvr/epg/EpgDatabase.h"
@@ -33,7 +34,11 @@ CDatabaseManager::CDatabaseManager() :
   UpdateDatabase(db);
 }
 
-CDatabaseManager::~CDatabaseManager() = default;
+CDatabaseManager::~CDatabaseManager()
+{
+  // don't keep server connections open for a profile that is no longer loaded
+  CDatabaseConnectionPool::GetInstance().Clear();
+}
 
 bool CDatabaseManager::Initialize()
 {
@@ -41,6 +46,9 @@ bool CDatabaseManager::Initialize()
 
   m_dbStatus.clear();
 
+  // connection settings may have changed, start from fresh connections
+  CDatabaseConnectionPool::GetInstance().Clear();
+
   CLog::Log(LOGDEBUG, "{}, updating databases...", __FUNCTION__);
 
   const std::shared_ptr<CAdvancedSettings> advancedSettings = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
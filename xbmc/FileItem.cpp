@@ -413,6 +413,8 @@ CFileItem& CFileItem::operator=(const CFileItem& item)
   FreeMemory();
   SetPath(item.m_strPath);
   SetDynPath(item.m_strDynPath);
+  m_classifiedMask = item.m_classifiedMask;
+  m_classifiedValues = item.m_classifiedValues;
   m_bIsParentFolder = item.m_bIsParentFolder;
   m_iDriveType = item.m_iDriveType;
   m_bIsShareOrDrive = item.m_bIsShareOrDrive;
@@ -606,6 +608,7 @@ void CFileItem::Archive(CArchive& ar)
 
     m_urlPath.reset();
     m_urlDynPath.reset();
+    m_classifiedMask = 0;
     SetInvalid();
   }
 }
@@ -958,7 +961,8 @@ bool CFileItem::IsOpticalMediaFile() const
 
 bool CFileItem::IsRAR() const
 {
-  return URIUtils::IsRAR(m_strPath);
+  return GetCachedClassification(CachedClassification::RAR, [](const CFileItem& item)
+                                 { return URIUtils::IsRAR(item.GetPath()); });
 }
 
 bool CFileItem::IsAPK() const
@@ -968,7 +972,8 @@ bool CFileItem::IsAPK() const
 
 bool CFileItem::IsZIP() const
 {
-  return GetURL().IsZIP();
+  return GetCachedClassification(CachedClassification::ZIP, [](const CFileItem& item)
+                                 { return item.GetURL().IsZIP(); });
 }
 
 bool CFileItem::IsCBZ() const
@@ -995,7 +1000,8 @@ bool CFileItem::IsAndroidApp() const
 
 bool CFileItem::IsStack() const
 {
-  return GetDynURL().IsStack();
+  return GetCachedClassification(CachedClassification::STACK, [](const CFileItem& item)
+                                 { return item.GetDynURL().IsStack(); });
 }
 
 bool CFileItem::IsFavourite() const
@@ -1618,6 +1624,7 @@ void CFileItem::SetPath(std::string path)
 {
   m_strPath = std::move(path);
   m_urlPath.reset();
+  m_classifiedMask = 0;
 }
 
 void CFileItem::SetURL(const CURL& url)
@@ -1675,6 +1682,22 @@ void CFileItem::SetDynPath(std::string path)
 {
   m_strDynPath = std::move(path);
   m_urlDynPath.reset();
+  m_classifiedMask = 0;
+}
+
+bool CFileItem::GetCachedClassification(CachedClassification type,
+                                        bool (*classify)(const CFileItem& item)) const
+{
+  const uint16_t bit = 1 << static_cast<unsigned int>(type);
+  if (!(m_classifiedMask & bit))
+  {
+    if (classify(*this))
+      m_classifiedValues |= bit;
+    else
+      m_classifiedValues &= ~bit;
+    m_classifiedMask |= bit;
+  }
+  return m_classifiedValues & bit;
 }
 
 void CFileItem::SetCueDocument(const std::shared_ptr<CCueDocument>& cuePtr)
@@ -1752,12 +1775,13 @@ std::string CFileItem::GetUserMusicThumb(bool alwaysCheckRemote /* = false */, b
   {
     std::vector<CVariant> thumbs = CServiceBroker::GetSettingsComponent()->GetSettings()->GetList(
         CSettings::SETTING_MUSICLIBRARY_MUSICTHUMBS);
+    // collect all candidates first so they can be checked in one go
+    std::vector<std::string> candidates;
     for (const auto& i : thumbs)
     {
       std::string strFileName = i.asString();
       std::string folderThumb(ART::GetFolderThumb(*this, strFileName));
-      if (CFile::Exists(folderThumb))   // folder.jpg
-        return folderThumb;
+      candidates.push_back(folderThumb); // folder.jpg
       size_t period = strFileName.find_last_of('.');
       if (period != std::string::npos)
       {
@@ -1768,24 +1792,27 @@ std::string CFileItem::GetUserMusicThumb(bool alwaysCheckRemote /* = false */, b
         ext = strFileName.substr(period);
         StringUtils::ToUpper(ext);
         StringUtils::Replace(folderThumb1, strFileName, name + ext);
-        if (CFile::Exists(folderThumb1)) // folder.JPG
-          return folderThumb1;
+        candidates.push_back(folderThumb1); // folder.JPG
 
         folderThumb1 = folderThumb;
         std::string firstletter = name.substr(0, 1);
         StringUtils::ToUpper(firstletter);
         name.replace(0, 1, firstletter);
         StringUtils::Replace(folderThumb1, strFileName, name + ext);
-        if (CFile::Exists(folderThumb1)) // Folder.JPG
-          return folderThumb1;
+        candidates.push_back(folderThumb1); // Folder.JPG
 
         folderThumb1 = folderThumb;
         StringUtils::ToLower(ext);
         StringUtils::Replace(folderThumb1, strFileName, name + ext);
-        if (CFile::Exists(folderThumb1)) // Folder.jpg
-          return folderThumb1;
+        candidates.push_back(folderThumb1); // Folder.jpg
       }
     }
+    const std::vector<bool> exists = CFile::ExistsMany(candidates);
+    for (size_t i = 0; i < candidates.size(); ++i)
+    {
+      if (exists[i])
+        return candidates[i];
+    }
   }
   // No thumb found
   return "";
@@ -132,6 +132,30 @@ public:
   const std::string &GetDynPath() const;
   void SetDynPath(std::string path);
 
+  /*!
+   \brief Path classifications cached per item, see GetCachedClassification().
+   */
+  enum class CachedClassification : uint8_t
+  {
+    INTERNET_STREAM = 0,
+    REMOTE,
+    STREAMED_FILESYSTEM,
+    RAR,
+    ZIP,
+    STACK,
+  };
+
+  /*!
+   \brief Get a classification of the item's paths, running the classify function only on first
+   use. The cache is dropped whenever the path or the dynamic path changes, so classify must only
+   depend on those.
+   \param type the classification to look up
+   \param classify function evaluating the classification for the item
+   \return the (cached) result of classify
+   */
+  bool GetCachedClassification(CachedClassification type,
+                               bool (*classify)(const CFileItem& item)) const;
+
   CFileItem& operator=(const CFileItem& item);
   void Archive(CArchive& ar) override;
   void Serialize(CVariant& value) const override;
@@ -560,6 +584,8 @@ private:
   mutable std::optional<CURL> m_urlDynPath;
   std::string m_strPath;            ///< complete path to item
   std::string m_strDynPath;
+  mutable uint16_t m_classifiedMask{0}; ///< classifications evaluated for the current paths
+  mutable uint16_t m_classifiedValues{0};
 
   bool m_bIsShareOrDrive{false}; ///< is this a root share/drive
   /// If \e m_bIsShareOrDrive is \e true, use to get the share type.
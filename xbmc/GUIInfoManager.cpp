@@ -12071,6 +12071,42 @@ void CGUIInfoManager::ResetCache()
   ++m_refreshCounter;
 }
 
+const unsigned int& CGUIInfoManager::GetRefreshCounter(int condition) const
+{
+  condition = std::abs(condition);
+  if (condition >= MULTI_INFO_START && condition <= MULTI_INFO_END)
+    condition = m_multiInfo[ResolveMultiInfo(condition) - MULTI_INFO_START].GetInfo();
+
+  switch (condition)
+  {
+    case SKIN_BOOL:
+    case SKIN_STRING:
+    case SKIN_STRING_IS_EQUAL:
+    case SKIN_INTEGER:
+      return m_skinSettingsRefreshCounter;
+    case SYSTEM_ALWAYS_TRUE:
+    case SYSTEM_ALWAYS_FALSE:
+    case SYSTEM_PLATFORM_LINUX:
+    case SYSTEM_PLATFORM_WINDOWS:
+    case SYSTEM_PLATFORM_UWP:
+    case SYSTEM_PLATFORM_DARWIN:
+    case SYSTEM_PLATFORM_DARWIN_OSX:
+    case SYSTEM_PLATFORM_DARWIN_IOS:
+    case SYSTEM_PLATFORM_DARWIN_TVOS:
+    case SYSTEM_PLATFORM_ANDROID:
+    case SYSTEM_PLATFORM_WEBOS:
+      return CONSTANT_REFRESH_COUNTER;
+    default:
+      return m_refreshCounter;
+  }
+}
+
+void CGUIInfoManager::InvalidateSkinSettings()
+{
+  std::unique_lock lock(m_critInfo);
+  ++m_skinSettingsRefreshCounter;
+}
+
 void CGUIInfoManager::SetCurrentVideoTag(const CVideoInfoTag &tag)
 {
   m_currentFile->SetFromVideoInfoTag(tag);
@@ -98,6 +98,19 @@ public:
   int TranslateString(const std::string &strCondition);
   int TranslateSingleString(const std::string &strCondition, bool &listItemDependent);
 
+  /*! \brief Get the counter whose changes make bools of the given condition dirty
+   Most conditions have to be evaluated again for every frame. The ones which only depend on
+   state that pushes its changes (e.g. skin settings), or that can't change at all, are only
+   evaluated again when needed.
+   \param condition the condition as returned by TranslateSingleString()
+   \return the refresh counter to follow
+   */
+  const unsigned int& GetRefreshCounter(int condition) const;
+
+  /*! \brief Mark the bools which depend on skin settings dirty, called when they change
+   */
+  void InvalidateSkinSettings();
+
   std::string GetLabel(int info, int contextWindow, std::string* fallback = nullptr) const;
   std::string GetImage(int info, int contextWindow, std::string *fallback = nullptr);
   bool GetInt(int& value, int info, int contextWindow, const CGUIListItem* item = nullptr) const;
@@ -225,6 +238,8 @@ private:
 
   INFOBOOLTYPE m_bools{&CGUIInfoManager::InfoBoolComparator};
   unsigned int m_refreshCounter = 0;
+  unsigned int m_skinSettingsRefreshCounter = 1;
+  static constexpr unsigned int CONSTANT_REFRESH_COUNTER = 1;
   std::vector<INFO::CSkinVariableString> m_skinVariableStrings;
 
   CCriticalSection m_critInfo;
@@ -13,7 +13,6 @@
 #include "commons/ilog.h"
 #include "guilib/GUIComponent.h"
 #include "guilib/Texture.h"
-#include "jobs/JobManager.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/TimeUtils.h"
@@ -21,10 +20,21 @@
 #include "windowing/GraphicContext.h"
 #include "windowing/WinSystem.h"
 
+#include <algorithm>
 #include <cassert>
 #include <chrono>
 #include <exception>
+#include <iterator>
 #include <mutex>
+#include <thread>
+
+namespace
+{
+// Textures which could not be uploaded by the loader are uploaded by the render thread when they
+// are first drawn. Limit how much is handed out for that per frame, so a burst of completed
+// fanart doesn't stall a single frame. 8MB is one 1080p RGBA image.
+constexpr size_t MAX_UPLOAD_BYTES_PER_FRAME = 8 * 1024 * 1024;
+} // namespace
 
 CImageLoader::CImageLoader(const std::string& path,
                            unsigned int targetWidth,
@@ -44,6 +54,9 @@ CImageLoader::~CImageLoader() = default;
 
 bool CImageLoader::DoWork()
 {
+  if (ShouldCancel(0, 0))
+    return false;
+
   bool needsChecking = false;
   std::string loadPath;
 
@@ -52,15 +65,30 @@ bool CImageLoader::DoWork()
     return false;
 
   if (m_use_cache)
+  {
     loadPath = CServiceBroker::GetTextureCache()->CheckCachedImage(texturePath, needsChecking);
+    loadPath = CTextureCache::GetTieredPath(loadPath, m_targetWidth, m_targetHeight);
+  }
   else
     loadPath = texturePath;
 
+  // the image may have been scrolled out of view while we looked it up
+  if (ShouldCancel(0, 0))
+    return false;
+
   if (!loadPath.empty())
   {
     // direct route - load the image
     auto start = std::chrono::steady_clock::now();
-    m_texture = CTexture::LoadFromFile(loadPath, m_targetWidth, m_targetHeight, m_aspectRatio);
+    if (m_use_cache)
+    {
+      // the compressed copy skips decoding and takes a fraction of the memory of the cached image
+      const std::string compressedPath = CTextureCache::GetCompressedPath(loadPath);
+      if (!compressedPath.empty())
+        m_texture = CTexture::LoadFromFile(compressedPath);
+    }
+    if (!m_texture)
+      m_texture = CTexture::LoadFromFile(loadPath, m_targetWidth, m_targetHeight, m_aspectRatio);
 
     auto end = std::chrono::steady_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
@@ -83,7 +111,7 @@ bool CImageLoader::DoWork()
     CLog::Log(LOGERROR, "{} - Direct texture file loading failed for {}", __FUNCTION__, loadPath);
   }
 
-  if (!m_use_cache)
+  if (!m_use_cache || ShouldCancel(0, 0))
     return false; // We're done
 
   // not in our texture cache or it failed to load from it, so try and load directly and then cache the result
@@ -159,9 +187,24 @@ void CGUILargeTextureManager::CLargeTexture::SetTexture(std::unique_ptr<CTexture
   }
 }
 
-CGUILargeTextureManager::CGUILargeTextureManager() = default;
+CGUILargeTextureManager::CGUILargeTextureManager()
+  : CJobQueue(true, GetLoaderCount(), CJob::PRIORITY_DEDICATED)
+{
+  CMemoryBudget::Register(this);
+}
 
-CGUILargeTextureManager::~CGUILargeTextureManager() = default;
+CGUILargeTextureManager::~CGUILargeTextureManager()
+{
+  CMemoryBudget::Unregister(this);
+  // no callbacks into a half destroyed object
+  CancelJobs();
+}
+
+unsigned int CGUILargeTextureManager::GetLoaderCount()
+{
+  // decoding is CPU bound, but leave some cores to rendering and playback
+  return std::clamp(std::thread::hardware_concurrency() / 2, 1u, 4u);
+}
 
 void CGUILargeTextureManager::CleanupUnusedImages(bool immediately)
 {
@@ -178,6 +221,46 @@ void CGUILargeTextureManager::CleanupUnusedImages(bool immediately)
   }
 }
 
+size_t CGUILargeTextureManager::GetTextureSize(const CTextureArray& texture)
+{
+  size_t size = 0;
+  for (const auto& frame : texture.m_textures)
+    size += static_cast<size_t>(frame->GetPitch()) * frame->GetRows();
+  return size;
+}
+
+size_t CGUILargeTextureManager::GetCacheSize() const
+{
+  std::unique_lock lock(m_listSection);
+  size_t size = 0;
+  for (const CLargeTexture* image : m_allocated)
+    size += GetTextureSize(image->GetTexture());
+  return size;
+}
+
+size_t CGUILargeTextureManager::ShrinkCache(size_t bytes, MemoryPressure pressure)
+{
+  // images in use are on screen, only the ones kept for reuse can go, those released longest ago
+  // first
+  std::unique_lock lock(m_listSection);
+  std::vector<CLargeTexture*> unused;
+  std::ranges::copy_if(m_allocated, std::back_inserter(unused),
+                       [](const CLargeTexture* image) { return image->IsUnused(); });
+  std::ranges::sort(unused, {}, &CLargeTexture::GetTimeToDelete);
+
+  size_t released = 0;
+  size_t count = 0;
+  for (; count < unused.size() && released < bytes; ++count)
+    released += GetTextureSize(unused[count]->GetTexture());
+  unused.resize(count);
+
+  std::erase_if(m_allocated, [&unused](const CLargeTexture* image)
+                { return std::ranges::find(unused, image) != unused.end(); });
+  for (CLargeTexture* image : unused)
+    image->DeleteIfRequired(true);
+  return released;
+}
+
 // if available, increment reference count, and return the image.
 // else, add to the queue list if appropriate.
 bool CGUILargeTextureManager::GetImage(const std::string& path,
@@ -197,6 +280,8 @@ bool CGUILargeTextureManager::GetImage(const std::string& path,
     {
       if (firstRequest)
         image->AddRef();
+      if (!CanUpload(image->GetTexture()))
+        return true; // not this frame
       texture = image->GetTexture();
       return texture.size() > 0;
     }
@@ -208,6 +293,25 @@ bool CGUILargeTextureManager::GetImage(const std::string& path,
   return true;
 }
 
+bool CGUILargeTextureManager::CanUpload(const CTextureArray& texture)
+{
+  if (!texture.size() || texture.m_textures.front()->IsLoadedToGPU())
+    return true;
+
+  const unsigned int frameTime = CTimeUtils::GetFrameTime();
+  if (frameTime != m_uploadFrameTime)
+  {
+    m_uploadFrameTime = frameTime;
+    m_uploadBytes = 0;
+  }
+  // always allow one texture per frame, however large it is
+  if (m_uploadBytes >= MAX_UPLOAD_BYTES_PER_FRAME)
+    return false;
+
+  m_uploadBytes += GetTextureSize(texture);
+  return true;
+}
+
 void CGUILargeTextureManager::ReleaseImage(const std::string& path,
                                            unsigned int width,
                                            unsigned int height,
@@ -228,14 +332,14 @@ void CGUILargeTextureManager::ReleaseImage(const std::string& path,
   }
   for (queueIterator it = m_queued.begin(); it != m_queued.end(); ++it)
   {
-    unsigned int id = it->first;
+    const CJob* job = it->first;
     CLargeTexture *image = it->second;
     if (image->GetPath() == path && image->GetTargetWidth() == width &&
         image->GetTargetHeight() == height && image->GetAspectRatio() == aspectRatio &&
         image->DecrRef(true))
     {
       // cancel this job
-      CServiceBroker::GetJobManager()->CancelJob(id);
+      CancelJob(job);
       m_queued.erase(it);
       return;
     }
@@ -265,10 +369,10 @@ void CGUILargeTextureManager::QueueImage(const std::string& path,
   }
 
   // queue the item
-  CLargeTexture* image = new CLargeTexture(path, width, height, aspectRatio);
-  unsigned int jobID = CServiceBroker::GetJobManager()->AddJob(
-      new CImageLoader(path, width, height, aspectRatio, useCache), this, CJob::PRIORITY_NORMAL);
-  m_queued.emplace_back(jobID, image);
+  auto* loader = new CImageLoader(path, width, height, aspectRatio, useCache);
+  if (!AddJob(loader))
+    return;
+  m_queued.emplace_back(loader, new CLargeTexture(path, width, height, aspectRatio));
 }
 
 void CGUILargeTextureManager::OnJobComplete(unsigned int jobID, bool success, CJob *job)
@@ -277,7 +381,7 @@ void CGUILargeTextureManager::OnJobComplete(unsigned int jobID, bool success, CJ
   std::unique_lock lock(m_listSection);
   for (queueIterator it = m_queued.begin(); it != m_queued.end(); ++it)
   {
-    if (it->first == jobID)
+    if (it->first == job)
     { // found our job
       CImageLoader *loader = static_cast<CImageLoader*>(job);
       CLargeTexture *image = it->second;
@@ -285,7 +389,10 @@ void CGUILargeTextureManager::OnJobComplete(unsigned int jobID, bool success, CJ
       loader->m_texture = NULL; // we want to keep the texture, and jobs are auto-deleted.
       m_queued.erase(it);
       m_allocated.push_back(image);
-      return;
+      break;
     }
   }
+  lock.unlock();
+
+  CJobQueue::OnJobComplete(jobID, success, job);
 }
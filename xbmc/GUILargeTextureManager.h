@@ -10,9 +10,10 @@
 
 #include "guilib/AspectRatio.h"
 #include "guilib/TextureManager.h"
-#include "jobs/IJobCallback.h"
 #include "jobs/Job.h"
+#include "jobs/JobQueue.h"
 #include "threads/CriticalSection.h"
+#include "utils/MemoryBudget.h"
 
 #include <memory>
 #include <string>
@@ -61,9 +62,16 @@ private:
  Used to load textures for the user interface asynchronously, allowing fluid framerates
  while background loading textures.
 
- \sa IJobCallback, CGUITexture
+ Images are loaded by a queue of their own, so loading doesn't wait for unrelated jobs. The most
+ recently requested images are loaded first, which are the ones just scrolled into view, and
+ images released before they are loaded are dropped from the queue or stop loading early.
+
+ Images no longer in use are kept for a short while in case they are shown again, unless the
+ memory budget asks for them.
+
+ \sa CJobQueue, CGUITexture
  */
-class CGUILargeTextureManager : public IJobCallback
+class CGUILargeTextureManager : public CJobQueue, public IMemoryConsumer
 {
 public:
   CGUILargeTextureManager();
@@ -132,6 +140,11 @@ public:
    */
   void CleanupUnusedImages(bool immediately = false);
 
+  // implementation of IMemoryConsumer
+  const char* GetCacheName() const override { return "large textures"; }
+  size_t GetCacheSize() const override;
+  size_t ShrinkCache(size_t bytes, MemoryPressure pressure) override;
+
 private:
   class CLargeTexture
   {
@@ -147,11 +160,14 @@ private:
     bool DeleteIfRequired(bool deleteImmediately = false);
     void SetTexture(std::unique_ptr<CTexture> texture);
 
+    bool IsUnused() const { return m_refCount == 0; }
     const std::string& GetPath() const { return m_path; }
     const CTextureArray& GetTexture() const { return m_texture; }
     unsigned int GetTargetWidth() const { return m_targetWidth; }
     unsigned int GetTargetHeight() const { return m_targetHeight; }
     CAspectRatio::AspectRatio GetAspectRatio() const { return m_aspectRatio; }
+    //! frame time at which an unused texture may be deleted, later for the ones released last
+    unsigned int GetTimeToDelete() const { return m_timeToDelete; }
 
   private:
     static const unsigned int TIME_TO_DELETE = 2000;
@@ -171,11 +187,22 @@ private:
                   CAspectRatio::AspectRatio aspectRatio,
                   bool useCache = true);
 
-  std::vector< std::pair<unsigned int, CLargeTexture *> > m_queued;
+  static unsigned int GetLoaderCount();
+  static size_t GetTextureSize(const CTextureArray& texture);
+
+  /*!
+   \brief Check whether a loaded texture may be handed out this frame, which is limited for
+   textures still to be uploaded to the GPU by the render thread.
+   */
+  bool CanUpload(const CTextureArray& texture);
+
+  std::vector<std::pair<const CJob*, CLargeTexture*>> m_queued;
   std::vector<CLargeTexture *> m_allocated;
   typedef std::vector<CLargeTexture *>::iterator listIterator;
-  typedef std::vector< std::pair<unsigned int, CLargeTexture *> >::iterator queueIterator;
+  typedef std::vector<std::pair<const CJob*, CLargeTexture*>>::iterator queueIterator;
 
-  CCriticalSection m_listSection;
+  mutable CCriticalSection m_listSection;
+  unsigned int m_uploadFrameTime{0};
+  size_t m_uploadBytes{0};
 };
 
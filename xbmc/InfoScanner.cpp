@@ -9,10 +9,15 @@
 #include "InfoScanner.h"
 
 #include "URL.h"
+#include "filesystem/File.h"
+#include "utils/Digest.h"
 #include "utils/FileUtils.h"
+#include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
+#include <stdint.h>
+
 bool CInfoScanner::HasNoMedia(const std::string& strDirectory)
 {
   std::string noMediaFile = URIUtils::AddFileToFolder(strDirectory, ".nomedia");
@@ -28,3 +33,26 @@ bool CInfoScanner::HasNoMedia(const std::string& strDirectory)
 
   return false;
 }
+
+std::string CInfoScanner::GetFastHash(const std::string& directory,
+                                      const std::vector<std::string>& excludes)
+{
+  KODI::UTILITY::CDigest digest{KODI::UTILITY::CDigest::Type::MD5};
+
+  if (!excludes.empty())
+    digest.Update(StringUtils::Join(excludes, "|"));
+
+  struct __stat64 buffer;
+  if (XFILE::CFile::Stat(directory, &buffer) == 0)
+  {
+    int64_t time = buffer.st_mtime;
+    if (!time)
+      time = buffer.st_ctime;
+    if (time)
+    {
+      digest.Update(&time, sizeof(time));
+      return digest.Finalize();
+    }
+  }
+  return "";
+}
@@ -10,6 +10,7 @@
 
 #include <set>
 #include <string>
+#include <vector>
 
 class CGUIDialogProgressBarHandle;
 
@@ -55,6 +56,19 @@ public:
    */
   static bool HasNoMedia(const std::string& strDirectory);
 
+  /*! \brief Retrieve a "fast" hash of the given directory (if available)
+   Performs a stat() on the directory, and uses modified time to create a "fast"
+   hash of the folder. If no modified time is available, the create time is used,
+   and if neither are available, an empty hash is returned.
+   In case exclude from scan expressions are present, the string array will be appended
+   to the md5 hash to ensure we're doing a re-scan whenever the user modifies those.
+   \param directory folder to hash
+   \param excludes string array of exclude expressions
+   \return the md5 hash of the folder
+   */
+  static std::string GetFastHash(const std::string& directory,
+                                 const std::vector<std::string>& excludes);
+
   //! \brief Set whether or not to show a progress dialog.
   void ShowDialog(bool show) { m_showDialog = show; }
 
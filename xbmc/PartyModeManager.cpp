@@ -26,7 +26,6 @@
 #include "playlists/SmartPlayList.h"
 #include "profiles/ProfileManager.h"
 #include "settings/SettingsComponent.h"
-#include "utils/Random.h"
 #include "utils/StringUtils.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
@@ -45,6 +44,7 @@ CPartyModeManager::CPartyModeManager(void)
   m_bIsVideo = false;
   m_bEnabled = false;
   ClearState();
+  m_random.seed(std::random_device{}());
 }
 
 bool CPartyModeManager::Enable(PartyModeContext context /*= PARTYMODECONTEXT_MUSIC*/, const std::string& strXspPath /*= ""*/)
@@ -167,10 +167,6 @@ bool CPartyModeManager::Enable(PartyModeContext context /*= PARTYMODECONTEXT_MUS
     m_songIDCache.insert(m_songIDCache.end(), songIDs2.begin(), songIDs2.end());
   }
 
-  // Songs and music videos are random from query, but need mixing together when have both
-  if (songcount > 0 && videocount > 0 )
-    KODI::UTILS::RandomShuffle(m_songIDCache.begin(), m_songIDCache.end());
-
   CLog::Log(LOGINFO,"PARTY MODE MANAGER: Matching songs = {0}", m_iMatchingSongs);
   CLog::Log(LOGINFO,"PARTY MODE MANAGER: Party mode enabled!");
 
@@ -305,6 +301,7 @@ bool CPartyModeManager::AddRandomSongs()
   {
     // Limit songs fetched to remainder of songID cache
     iMissingSongs = std::min(iMissingSongs, static_cast<int>(m_songIDCache.size()) - m_iMatchingSongsPicked);
+    PickRandomSongs(iMissingSongs);
 
     // Pick iMissingSongs from remaining songID cache
     std::string sqlWhereMusic = "songview.idSong IN (";
@@ -393,6 +390,19 @@ bool CPartyModeManager::AddRandomSongs()
   return true;
 }
 
+void CPartyModeManager::PickRandomSongs(int count)
+{
+  // Partial Fisher-Yates shuffle: move randomly chosen not yet picked songs (and music videos)
+  // to the front of the unpicked part of the cache, so each refill costs O(count) rather than
+  // having the database sort every matching song up front
+  const int size = static_cast<int>(m_songIDCache.size());
+  for (int i = m_iMatchingSongsPicked; i < m_iMatchingSongsPicked + count && i < size; i++)
+  {
+    std::uniform_int_distribution<int> distribution(i, size - 1);
+    std::swap(m_songIDCache[i], m_songIDCache[distribution(m_random)]);
+  }
+}
+
 void CPartyModeManager::Add(CFileItemPtr &pItem)
 {
   PLAYLIST::CPlayList& playlist = CServiceBroker::GetPlaylistPlayer().GetPlaylist(GetPlaylistId());
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <memory>
+#include <random>
 #include <string>
 #include <utility>
 #include <vector>
@@ -52,6 +53,7 @@ public:
 private:
   void Process();
   bool AddRandomSongs();
+  void PickRandomSongs(int count);
   void Add(CFileItemPtr &pItem);
   bool ReapSongs();
   bool MovePlaying();
@@ -78,6 +80,7 @@ private:
 
   // history
   std::vector<std::pair<int, int>> m_songIDCache;
+  std::mt19937 m_random;
 };
 
 extern CPartyModeManager g_partyModeManager;
@@ -473,3 +473,18 @@ std::shared_ptr<XFILE::CBlurayDiscCache> CServiceBroker::GetBlurayDiscCache()
 {
   return g_serviceBroker.m_blurayDiscCache;
 }
+
+void CServiceBroker::RegisterPlaybackSync(const std::shared_ptr<CPlaybackSync>& playbackSync)
+{
+  g_serviceBroker.m_playbackSync = playbackSync;
+}
+
+void CServiceBroker::UnregisterPlaybackSync()
+{
+  g_serviceBroker.m_playbackSync.reset();
+}
+
+std::shared_ptr<CPlaybackSync> CServiceBroker::GetPlaybackSync()
+{
+  return g_serviceBroker.m_playbackSync;
+}
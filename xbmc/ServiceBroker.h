@@ -126,6 +126,8 @@ namespace XFILE
 class CBlurayDiscCache;
 }
 
+class CPlaybackSync;
+
 class CServiceBroker
 {
 public:
@@ -239,6 +241,10 @@ public:
   static void UnregisterBlurayDiscCache();
   static std::shared_ptr<XFILE::CBlurayDiscCache> GetBlurayDiscCache();
 
+  static void RegisterPlaybackSync(const std::shared_ptr<CPlaybackSync>& playbackSync);
+  static void UnregisterPlaybackSync();
+  static std::shared_ptr<CPlaybackSync> GetPlaybackSync();
+
 private:
   std::shared_ptr<CAppParams> m_appParams;
   std::unique_ptr<CLog> m_logging;
@@ -258,6 +264,7 @@ private:
   std::shared_ptr<CSlideShowDelegator> m_slideshowDelegator;
   std::shared_ptr<CDNSNameCache> m_dnsNameCache;
   std::shared_ptr<XFILE::CBlurayDiscCache> m_blurayDiscCache;
+  std::shared_ptr<CPlaybackSync> m_playbackSync;
 };
 
 XBMC_GLOBAL_REF(CServiceBroker, g_serviceBroker);
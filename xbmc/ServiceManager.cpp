@@ -45,14 +45,92 @@
 #endif
 #include "pictures/SlideShowDelegator.h"
 #include "storage/MediaManager.h"
+#include "threads/IRunnable.h"
+#include "threads/Thread.h"
 #include "utils/FileExtensionProvider.h"
 #include "utils/log.h"
 #include "weather/WeatherManager.h"
 
+#include <chrono>
+#include <functional>
 #include <memory>
 
 using namespace KODI;
 
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+int64_t ElapsedMs(Clock::time_point start, Clock::time_point end)
+{
+  return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+}
+
+// Start of the startup timeline, taken when the first step is timed
+Clock::time_point StartupOrigin()
+{
+  static const Clock::time_point origin = Clock::now();
+  return origin;
+}
+
+/*!
+ * \brief Logs the duration of a startup step and when it finished, relative to
+ * the start of service initialisation, so the log shows a boot timeline
+ */
+class CStartupTimer
+{
+public:
+  explicit CStartupTimer(const char* step) : m_step(step), m_start(Clock::now())
+  {
+    StartupOrigin();
+  }
+
+  ~CStartupTimer()
+  {
+    const Clock::time_point end = Clock::now();
+    CLog::Log(LOGINFO, "CServiceManager: [+{} ms] {} took {} ms", ElapsedMs(StartupOrigin(), end),
+              m_step, ElapsedMs(m_start, end));
+  }
+
+private:
+  const char* const m_step;
+  const Clock::time_point m_start;
+};
+
+/*!
+ * \brief Runs a startup step on a thread of its own
+ *
+ * Only for steps that depend on nothing initialised next to them and that
+ * nothing initialised next to them depends on. The step is waited for when
+ * the task is destroyed at the latest.
+ */
+class CStartupTask : private IRunnable
+{
+public:
+  CStartupTask(const char* step, std::function<void()> func)
+    : m_step(step), m_func(std::move(func)), m_thread(this, step)
+  {
+    m_thread.Create();
+  }
+
+  ~CStartupTask() override { Wait(); }
+
+  void Wait() { m_thread.StopThread(true); }
+
+private:
+  // implementation of IRunnable
+  void Run() override
+  {
+    CStartupTimer timer(m_step);
+    m_func();
+  }
+
+  const char* const m_step;
+  const std::function<void()> m_func;
+  CThread m_thread;
+};
+} // namespace
+
 CServiceManager::CServiceManager() = default;
 
 CServiceManager::~CServiceManager()
@@ -99,6 +177,8 @@ void CServiceManager::DeinitTesting()
 
 bool CServiceManager::InitStageOne()
 {
+  CStartupTimer timer("service stage one");
+
   m_Platform.reset(CPlatform::CreateInstance());
   if (!m_Platform->InitStageOne())
     return false;
@@ -120,6 +200,21 @@ bool CServiceManager::InitStageOne()
 
 bool CServiceManager::InitStageTwo(const std::string& profilesUserDataFolder)
 {
+  CStartupTimer timer("service stage two");
+
+  // The power syscalls may register with the event loop of the thread they are created on, e.g.
+  // the run loop sources of CCocoaPowerSyscall, so they stay on the main thread
+  m_powerManager = std::make_unique<CPowerManager>();
+  {
+    CStartupTimer powerTimer("power management");
+    m_powerManager->Initialize();
+  }
+
+  // Storage management only talks to the platform, bring it up while the add-on based services
+  // are initialised
+  m_mediaManager = std::make_unique<CMediaManager>();
+  CStartupTask storageServices("storage management", [this]() { m_mediaManager->Initialize(); });
+
   // Initialize the addon database (must be before the addon manager is init'd)
   m_databaseManager = std::make_unique<CDatabaseManager>();
 
@@ -127,10 +222,13 @@ bool CServiceManager::InitStageTwo(const std::string& profilesUserDataFolder)
       ADDON::
           CBinaryAddonManager>(); /* Need to constructed before, GetRunningInstance() of binary CAddonDll need to call them */
   m_addonMgr = std::make_unique<ADDON::CAddonMgr>();
-  if (!m_addonMgr->Init())
   {
-    CLog::Log(LOGFATAL, "CServiceManager::{}: Unable to start CAddonMgr", __FUNCTION__);
-    return false;
+    CStartupTimer addonTimer("add-on manager");
+    if (!m_addonMgr->Init())
+    {
+      CLog::Log(LOGFATAL, "CServiceManager::{}: Unable to start CAddonMgr", __FUNCTION__);
+      return false;
+    }
   }
 
   m_repositoryUpdater = std::make_unique<ADDON::CRepositoryUpdater>(*m_addonMgr);
@@ -164,15 +262,8 @@ bool CServiceManager::InitStageTwo(const std::string& profilesUserDataFolder)
 
   m_fileExtensionProvider = std::make_unique<CFileExtensionProvider>(*m_addonMgr);
 
-  m_powerManager = std::make_unique<CPowerManager>();
-  m_powerManager->Initialize();
-  m_powerManager->SetDefaults();
-
   m_weatherManager = std::make_unique<CWeatherManager>(*m_addonMgr);
 
-  m_mediaManager = std::make_unique<CMediaManager>();
-  m_mediaManager->Initialize();
-
 #if !defined(TARGET_WINDOWS) && defined(HAS_OPTICAL_DRIVE)
   m_DetectDVDType = std::make_unique<MEDIA_DETECT::CDetectDVDMedia>();
 #endif
@@ -181,6 +272,9 @@ bool CServiceManager::InitStageTwo(const std::string& profilesUserDataFolder)
   m_WSDiscovery = WSDiscovery::IWSDiscovery::GetInstance();
 #endif
 
+  storageServices.Wait();
+  m_powerManager->SetDefaults();
+
   if (!m_Platform->InitStageTwo())
     return false;
 
@@ -191,6 +285,8 @@ bool CServiceManager::InitStageTwo(const std::string& profilesUserDataFolder)
 // stage 3 is called after successful initialization of WindowManager
 bool CServiceManager::InitStageThree(const std::shared_ptr<CProfileManager>& profileManager)
 {
+  CStartupTimer timer("service stage three");
+
 #if !defined(TARGET_WINDOWS) && defined(HAS_OPTICAL_DRIVE)
   // Start Thread for DVD Mediatype detection
   CLog::Log(LOGINFO, "[Media Detection] starting service for optical media detection");
@@ -198,7 +294,10 @@ bool CServiceManager::InitStageThree(const std::shared_ptr<CProfileManager>& pro
 #endif
 
   // Peripherals depends on strings being loaded before stage 3
-  m_peripherals->Initialise();
+  {
+    CStartupTimer peripheralsTimer("peripherals");
+    m_peripherals->Initialise();
+  }
 
   m_gameServices = std::make_unique<GAME::CGameServices>(
       *m_gameControllerManager, *m_gameRenderManager, *m_peripherals, *profileManager,
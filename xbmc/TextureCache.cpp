@@ -29,8 +29,11 @@
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <exception>
+#include <future>
 #include <mutex>
 #include <optional>
 #include <string.h>
@@ -38,6 +41,14 @@
 using namespace XFILE;
 using namespace std::chrono_literals;
 
+namespace
+{
+// images checked against the libraries at a time when cleaning the whole cache
+constexpr unsigned int CLEAN_BATCH_SIZE = 2000;
+// threads deleting cached files at the same time
+constexpr size_t MAX_DELETE_THREADS = 4;
+} // namespace
+
 CTextureCache::CTextureCache()
   : CJobQueue(false, 1, CJob::PRIORITY_LOW_PAUSABLE), m_cleanTimer{[this]() { CleanTimer(); }}
 {
@@ -215,15 +226,37 @@ void CTextureCache::ClearCachedImage(const std::string& image, bool deleteSource
 {
   //! @todo This can be removed when the texture cache covers everything.
   const std::string url = IMAGE_FILES::ToCacheKey(image);
-  std::string path = deleteSource ? url : "";
   std::string cachedFile;
   if (ClearCachedTexture(url, cachedFile))
-    path = GetCachedPath(cachedFile);
-  if (CFile::Exists(path))
-    CFile::Delete(path);
-  path = URIUtils::ReplaceExtension(path, ".dds");
-  if (CFile::Exists(path))
-    CFile::Delete(path);
+    DeleteUnusedCachedFile(cachedFile);
+  else if (deleteSource)
+    DeleteCachedFiles(url);
+}
+
+void CTextureCache::ClearCachedImages(const std::vector<std::string>& images)
+{
+  std::vector<std::string> cachedFiles;
+  cachedFiles.reserve(images.size());
+  for (const auto& image : images)
+  {
+    std::string cachedFile;
+    if (ClearCachedTexture(IMAGE_FILES::ToCacheKey(image), cachedFile))
+      cachedFiles.emplace_back(std::move(cachedFile));
+  }
+
+  std::atomic<size_t> next{0};
+  const auto deleteFiles = [this, &cachedFiles, &next]()
+  {
+    for (size_t i = next++; i < cachedFiles.size(); i = next++)
+      DeleteUnusedCachedFile(cachedFiles[i]);
+  };
+
+  std::vector<std::future<void>> workers;
+  for (size_t i = 1; i < std::min(MAX_DELETE_THREADS, cachedFiles.size()); ++i)
+    workers.emplace_back(std::async(std::launch::async, deleteFiles));
+  deleteFiles();
+  for (const auto& worker : workers)
+    worker.wait();
 }
 
 bool CTextureCache::ClearCachedImage(int id)
@@ -231,23 +264,72 @@ bool CTextureCache::ClearCachedImage(int id)
   std::string cachedFile;
   if (ClearCachedTexture(id, cachedFile))
   {
-    cachedFile = GetCachedPath(cachedFile);
-    if (CFile::Exists(cachedFile))
-      CFile::Delete(cachedFile);
-    cachedFile = URIUtils::ReplaceExtension(cachedFile, ".dds");
-    if (CFile::Exists(cachedFile))
-      CFile::Delete(cachedFile);
+    DeleteUnusedCachedFile(cachedFile);
     return true;
   }
   return false;
 }
 
+void CTextureCache::DeleteCachedFiles(const std::string& cachedPath)
+{
+  if (cachedPath.empty())
+    return;
+
+  std::vector<std::string> paths{cachedPath};
+  for (const unsigned int tier : TIERS)
+    paths.emplace_back(GetTierPath(cachedPath, tier));
+
+  for (const auto& path : paths)
+  {
+    if (CFile::Exists(path))
+      CFile::Delete(path);
+    const std::string compressedPath = URIUtils::ReplaceExtension(path, ".dds");
+    if (CFile::Exists(compressedPath))
+      CFile::Delete(compressedPath);
+  }
+}
+
+void CTextureCache::DeleteUnusedCachedFile(const std::string& file)
+{
+  if (file.empty())
+    return;
+
+  // the file may have been reused for another image since it was cleared from the database
+  LockCachedFile(file);
+  CTextureDetails details;
+  if (!GetCachedTextureByFile(file, details))
+    DeleteCachedFiles(GetCachedPath(file));
+  UnlockCachedFile(file);
+}
+
+void CTextureCache::LockCachedFile(const std::string& file)
+{
+  std::unique_lock lock(m_lockedFilesSection);
+  m_lockedFilesChanged.wait(lock, [this, &file]() { return !m_lockedFiles.contains(file); });
+  m_lockedFiles.insert(file);
+}
+
+void CTextureCache::UnlockCachedFile(const std::string& file)
+{
+  {
+    std::unique_lock lock(m_lockedFilesSection);
+    m_lockedFiles.erase(file);
+  }
+  m_lockedFilesChanged.notifyAll();
+}
+
 bool CTextureCache::GetCachedTexture(const std::string &url, CTextureDetails &details)
 {
   std::unique_lock lock(m_databaseSection);
   return m_database.GetCachedTexture(url, details);
 }
 
+bool CTextureCache::GetCachedTextureByFile(const std::string& file, CTextureDetails& details)
+{
+  std::unique_lock lock(m_databaseSection);
+  return m_database.GetCachedTextureByFile(file, details);
+}
+
 bool CTextureCache::AddCachedTexture(const std::string &url, const CTextureDetails &details)
 {
   std::unique_lock lock(m_databaseSection);
@@ -300,16 +382,70 @@ std::string CTextureCache::GetCachedPath(const std::string &file)
   return URIUtils::AddFileToFolder(profileManager->GetThumbnailsFolder(), file);
 }
 
+std::string CTextureCache::GetCompressedPath(const std::string& cachedPath)
+{
+  if (!CTextureCacheJob::UseCompressedCache() || !URIUtils::HasExtension(cachedPath, ".jpg"))
+    return {};
+
+  std::string path = URIUtils::ReplaceExtension(cachedPath, ".dds");
+  if (!CFile::Exists(path))
+    return {};
+  return path;
+}
+
+std::string CTextureCache::GetTierPath(const std::string& cachedPath, unsigned int tier)
+{
+  return URIUtils::ReplaceExtension(cachedPath, "") + "-" + std::to_string(tier) +
+         URIUtils::GetExtension(cachedPath);
+}
+
+std::string CTextureCache::GetTieredPath(const std::string& cachedPath,
+                                         unsigned int width,
+                                         unsigned int height)
+{
+  if (width == 0 || height == 0 || !CTextureCacheJob::UseCacheTiers())
+    return cachedPath;
+
+  const std::shared_ptr<CProfileManager> profileManager =
+      CServiceBroker::GetSettingsComponent()->GetProfileManager();
+  if (!URIUtils::PathHasParent(cachedPath, profileManager->GetThumbnailsFolder(), true))
+    return cachedPath;
+
+  for (const unsigned int tier : TIERS)
+  {
+    if (tier < height || tier * 16 / 9 < width)
+      continue;
+
+    // only images which don't fit into the tier have a copy of it
+    std::string path = GetTierPath(cachedPath, tier);
+    if (CFile::Exists(path))
+      return path;
+  }
+  return cachedPath;
+}
+
 void CTextureCache::OnCachingComplete(bool success, CTextureCacheJob *job)
 {
+  std::string oldFile;
   if (success)
   {
     if (job->m_details.hashRevalidated)
       SetCachedTextureValid(job->m_url, job->m_details.updateable);
     else
+    {
+      // a changed image is cached as another file, the old one may not be used anymore
+      CTextureDetails oldDetails;
+      if (GetCachedTexture(job->m_url, oldDetails) && oldDetails.file != job->m_details.file)
+        oldFile = oldDetails.file;
       AddCachedTexture(job->m_url, job->m_details);
+    }
   }
 
+  // unlock before deleting, so no thread holds more than one cached file
+  if (!job->m_lockedFile.empty())
+    UnlockCachedFile(job->m_lockedFile);
+  DeleteUnusedCachedFile(oldFile);
+
   { // remove from our processing list
     std::unique_lock lock(m_processingSection);
     std::set<std::string>::iterator i = m_processinglist.find(job->m_url);
@@ -396,19 +532,21 @@ bool CTextureCache::CleanAllUnusedImagesJob(CGUIDialogProgress* progress)
     return false;
   }
 
+  // Go through the cache a batch at a time, so the image lists and the queries checking them
+  // against the libraries stay small. Images found in use are marked as checked and drop out of
+  // the following batches, unused ones are removed.
   const unsigned int cleanAmount = 1000000;
-  const auto result = cleaner->ScanOldestCache(cleanAmount);
-  if (progress && progress->IsCanceled())
-  {
-    progress->Close();
-    return false;
-  }
-
-  const auto total = result.imagesToClean.size();
+  const unsigned int total = cleaner->CountOldestCache(cleanAmount);
+  const unsigned int maxBatches = total / CLEAN_BATCH_SIZE + 1;
   unsigned int current = 0;
-  for (const auto& image : result.imagesToClean)
+  for (unsigned int batch = 0; batch < maxBatches; ++batch)
   {
-    ClearCachedImage(image);
+    const auto result = cleaner->ScanOldestCache(CLEAN_BATCH_SIZE, cleanAmount);
+    if (result.processedCount == 0)
+      break;
+
+    ClearCachedImages(result.imagesToClean);
+    current += result.processedCount;
     if (progress)
     {
       if (progress->IsCanceled())
@@ -416,13 +554,13 @@ bool CTextureCache::CleanAllUnusedImagesJob(CGUIDialogProgress* progress)
         progress->Close();
         return false;
       }
-      int percentage = static_cast<unsigned long long>(current) * 100 / total;
+      int percentage =
+          static_cast<unsigned long long>(std::min(current, total)) * 100 / std::max(total, 1u);
       if (progress->GetPercentage() != percentage)
       {
         progress->SetPercentage(percentage);
         progress->Progress();
       }
-      current++;
     }
   }
 
@@ -458,10 +596,7 @@ std::chrono::milliseconds CTextureCache::ScanOldestCache()
 
   const unsigned int cleanAmount = 1000;
   const auto result = cleaner->ScanOldestCache(cleanAmount);
-  for (const auto& image : result.imagesToClean)
-  {
-    ClearCachedImage(image);
-  }
+  ClearCachedImages(result.imagesToClean);
 
   // update in the next 6 - 48 hours depending on number of items processed
   const auto minTime = 6;
@@ -13,6 +13,7 @@
 #include "guilib/AspectRatio.h"
 #include "jobs/JobQueue.h"
 #include "powermanagement/PowerState.h"
+#include "threads/Condition.h"
 #include "threads/CriticalSection.h"
 #include "threads/Event.h"
 #include "threads/Timer.h"
@@ -148,6 +149,36 @@ public:
    */
   static std::string GetCachedPath(const std::string &file);
 
+  /*! \brief retrieve the GPU compressed copy of a cached image, if it should be used
+   Opaque images may be stored a second time as DXT1, which is uploaded as is rather than decoded.
+   \param cachedPath full path of the cached image
+   \return full path of the compressed copy, empty if there is none or it isn't enabled
+   \sa CTextureCacheJob::CacheCompressed
+   */
+  static std::string GetCompressedPath(const std::string& cachedPath);
+
+  /*! \brief the heights of the smaller copies of cached images, smallest first
+   Like imageres, each tier is a 16x9 box the copy fits in.
+   */
+  static constexpr unsigned int TIERS[] = {270, 540};
+
+  /*! \brief retrieve the full path of a smaller copy of a cached image
+   \param cachedPath full path of the cached image
+   \param tier the height of the copy, one of TIERS
+   \return full path of the copy, which need not exist
+   */
+  static std::string GetTierPath(const std::string& cachedPath, unsigned int tier);
+
+  /*! \brief retrieve the smallest copy of a cached image which is large enough to be shown at a size
+   \param cachedPath full path of the cached image. Paths outside the cache are returned as is.
+   \param width the width the image is shown at, 0 if unknown
+   \param height the height the image is shown at, 0 if unknown
+   \return full path of the copy, cachedPath if there is no smaller one or tiers aren't enabled
+   */
+  static std::string GetTieredPath(const std::string& cachedPath,
+                                   unsigned int width,
+                                   unsigned int height);
+
   /*! \brief Add this image to the database
    Thread-safe wrapper of CTextureDatabase::AddCachedTexture
    \param image url of the original image
@@ -156,6 +187,28 @@ public:
    */
   bool AddCachedTexture(const std::string &image, const CTextureDetails &details);
 
+  /*! \brief Get a texture cached as the given file
+   Identical images share a cached file, this finds any of them.
+   Thread-safe wrapper of CTextureDatabase::GetCachedTextureByFile
+   \param file the cached file, relative to the cache path
+   \param details [out] texture details from the database
+   \return true if an image is cached as this file, false otherwise.
+   */
+  bool GetCachedTextureByFile(const std::string& file, CTextureDetails& details);
+
+  /*! \brief Wait until no other thread uses a cached file and take it
+   As identical images share a cached file, it must only be written, reused or deleted by one
+   thread at a time.
+   \param file the cached file, relative to the cache path
+   \sa UnlockCachedFile
+   */
+  void LockCachedFile(const std::string& file);
+
+  /*! \brief Release a cached file taken by LockCachedFile
+   \param file the cached file, relative to the cache path
+   */
+  void UnlockCachedFile(const std::string& file);
+
   /*! \brief Export a (possibly) cached image to a file
    \param image url of the original image
    \param destination url of the destination image, excluding extension.
@@ -178,6 +231,22 @@ private:
    */
   bool IsCachedImage(const std::string &image) const;
 
+  /*! \brief Delete a cached image along with its smaller and compressed copies
+   \param cachedPath full path of the cached image
+   */
+  static void DeleteCachedFiles(const std::string& cachedPath);
+
+  /*! \brief Delete a cached file unless another image is cached as it
+   \param file the cached file, relative to the cache path
+   */
+  void DeleteUnusedCachedFile(const std::string& file);
+
+  /*! \brief Clear images from the database and delete their cached files
+   The files are deleted from several threads, as on slow storage that is where the time goes.
+   \param images urls of the original images
+   */
+  void ClearCachedImages(const std::vector<std::string>& images);
+
   /*! \brief retrieve the cached version of the given image (if it exists)
    \param image url of the image
    \param details [out] the details of the texture.
@@ -241,5 +310,8 @@ private:
   CEvent               m_completeEvent; ///< Set whenever a job has finished
   std::vector<CTextureDetails> m_useCounts; ///< Use count tracking
   CCriticalSection             m_useCountSection;
+  std::set<std::string> m_lockedFiles; ///< cached files being written, reused or deleted
+  CCriticalSection m_lockedFilesSection;
+  XbmcThreads::ConditionVariable m_lockedFilesChanged;
 };
 
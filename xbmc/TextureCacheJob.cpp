@@ -16,16 +16,19 @@
 #include "addons/kodi-dev-kit/include/kodi/c-api/addon-instance/audiodecoder.h"
 #include "commons/ilog.h"
 #include "filesystem/File.h"
+#include "guilib/DDSImage.h"
 #include "guilib/Texture.h"
 #include "imagefiles/ImageFileURL.h"
 #include "imagefiles/SpecialImageLoaderFactory.h"
 #include "pictures/Picture.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
+#include "utils/Digest.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 #include <exception>
@@ -33,6 +36,8 @@
 
 #include "PlatformDefs.h"
 
+using KODI::UTILITY::CDigest;
+
 CTextureCacheJob::CTextureCacheJob(const std::string &url, const std::string &oldHash):
   m_url(url),
   m_oldHash(oldHash),
@@ -117,19 +122,41 @@ bool CTextureCacheJob::CacheTexture(std::unique_ptr<CTexture>* out_texture)
   std::unique_ptr<CTexture> texture = LoadImage(imageURL);
   if (texture)
   {
+    // identical images, like the same cover embedded in every track of an album, share a file
+    m_details.file = GetContentFile(*texture);
     if (texture->HasAlpha())
-      m_details.file = m_cachePath + ".png";
+      m_details.file += ".png";
     else
-      m_details.file = m_cachePath + ".jpg";
+      m_details.file += ".jpg";
+
+    CTextureCache& textureCache = *CServiceBroker::GetTextureCache();
+    textureCache.LockCachedFile(m_details.file);
+    m_lockedFile = m_details.file;
+
+    const std::string cachedFile = CTextureCache::GetCachedPath(m_details.file);
+    CTextureDetails existing;
+    if (textureCache.GetCachedTextureByFile(m_details.file, existing) &&
+        XFILE::CFile::Exists(cachedFile))
+    {
+      CLog::Log(LOGDEBUG, "Image '{}' is cached as '{}' already", CURL::GetRedacted(image),
+                m_details.file);
+      m_details.width = existing.width;
+      m_details.height = existing.height;
+      if (out_texture) // caller wants the texture
+        *out_texture = std::move(texture);
+      return true;
+    }
 
     CLog::Log(LOGDEBUG, "{} image '{}' to '{}':", m_oldHash.empty() ? "Caching" : "Recaching",
               CURL::GetRedacted(image), m_details.file);
 
     unsigned int cached_width = 0;
     unsigned int cached_height = 0;
-    if (CPicture::CacheTexture(texture.get(), cached_width, cached_height,
-                               CTextureCache::GetCachedPath(m_details.file)))
+    if (CPicture::CacheTexture(texture.get(), cached_width, cached_height, cachedFile))
     {
+      CacheCompressed(cachedFile, !texture->HasAlpha() && UseCompressedCache());
+      CacheTiers(texture.get(), cachedFile, cached_width, cached_height);
+
       m_details.width = cached_width;
       m_details.height = cached_height;
       if (out_texture) // caller wants the texture
@@ -140,6 +167,86 @@ bool CTextureCacheJob::CacheTexture(std::unique_ptr<CTexture>* out_texture)
   return false;
 }
 
+std::string CTextureCacheJob::GetContentFile(const CTexture& texture)
+{
+  // images are cached as BGRA, the padding of the rows is left out as it isn't initialized
+  const uint32_t header[] = {texture.GetWidth(), texture.GetHeight(),
+                             static_cast<uint32_t>(texture.GetOrientation())};
+  const uint32_t rowSize = std::min(texture.GetPitch(), texture.GetWidth() * 4);
+
+  CDigest digest{CDigest::Type::MD5};
+  digest.Update(header, sizeof(header));
+  const uint8_t* row = texture.GetPixels();
+  for (uint32_t y = 0; row && y < texture.GetHeight(); ++y, row += texture.GetPitch())
+    digest.Update(row, rowSize);
+
+  const std::string hex = digest.Finalize().substr(0, 16);
+  return StringUtils::Format("{}/{}", hex[0], hex);
+}
+
+bool CTextureCacheJob::UseCompressedCache()
+{
+#if defined(HAS_GL)
+  return CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_imageCacheCompressed;
+#else
+  return false;
+#endif
+}
+
+void CTextureCacheJob::CacheCompressed(const std::string& cachedFile, bool compress)
+{
+  const std::string compressedFile = URIUtils::ReplaceExtension(cachedFile, ".dds");
+  if (compress)
+  {
+    // compress what was actually cached, which is scaled and oriented already
+    const std::unique_ptr<CTexture> texture = CTexture::LoadFromFile(cachedFile);
+    if (texture && texture->GetPixels())
+    {
+      CDDSImage image;
+      image.Compress(texture->GetWidth(), texture->GetHeight(), texture->GetPitch(),
+                     texture->GetPixels());
+      if (image.WriteFile(compressedFile))
+        return;
+    }
+    CLog::Log(LOGDEBUG, "{} - unable to compress '{}'", __FUNCTION__, cachedFile);
+  }
+
+  // don't leave a copy of an older version of the image behind
+  if (XFILE::CFile::Exists(compressedFile))
+    XFILE::CFile::Delete(compressedFile);
+}
+
+bool CTextureCacheJob::UseCacheTiers()
+{
+  return CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_imageCacheTiers;
+}
+
+void CTextureCacheJob::CacheTiers(CTexture* texture,
+                                  const std::string& cachedFile,
+                                  unsigned int width,
+                                  unsigned int height)
+{
+  const bool useTiers = UseCacheTiers();
+  const bool compress = !texture->HasAlpha() && UseCompressedCache();
+  for (const unsigned int tier : CTextureCache::TIERS)
+  {
+    const std::string tierFile = CTextureCache::GetTierPath(cachedFile, tier);
+    // scale down from the original rather than from the cached image
+    unsigned int tierWidth = tier * 16 / 9;
+    unsigned int tierHeight = tier;
+    if (useTiers && (width > tierWidth || height > tierHeight) &&
+        CPicture::CacheTexture(texture, tierWidth, tierHeight, tierFile))
+    {
+      CacheCompressed(tierFile, compress);
+      continue;
+    }
+
+    if (XFILE::CFile::Exists(tierFile))
+      XFILE::CFile::Delete(tierFile);
+    CacheCompressed(tierFile, false);
+  }
+}
+
 bool CTextureCacheJob::ResizeTexture(const std::string& url,
                                      unsigned int height,
                                      unsigned int width,
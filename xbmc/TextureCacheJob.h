@@ -70,6 +70,15 @@ public:
    */
   bool CacheTexture(std::unique_ptr<CTexture>* texture = nullptr);
 
+  /*! \brief whether opaque images get a GPU compressed copy in the cache
+   Only enabled where the renderer is known to upload DXT1 textures.
+   */
+  static bool UseCompressedCache();
+
+  /*! \brief whether images are also cached at the smaller sizes of CTextureCache::TIERS
+   */
+  static bool UseCacheTiers();
+
   static bool ResizeTexture(const std::string& url,
                             unsigned int height,
                             unsigned int width,
@@ -80,7 +89,15 @@ public:
   std::string m_url;
   std::string m_oldHash;
   CTextureDetails m_details;
+  std::string m_lockedFile; ///< cached file locked by CacheTexture, unlocked once it is stored
 private:
+  /*! \brief retrieve a cache file (relative to the cache path) named after the content of an image,
+   excluding extension
+   \param texture the image
+   \return a filename which is the same for all copies of the image
+   */
+  static std::string GetContentFile(const CTexture& texture);
+
   /*! \brief retrieve a hash for the given image
    Combines the size, ctime and mtime of the image file into a "unique" hash
    \param url location of the image
@@ -98,6 +115,23 @@ private:
    */
   static std::unique_ptr<CTexture> LoadImage(const IMAGE_FILES::CImageFileURL& imageURL);
 
+  /*! \brief Store a DXT1 copy of a cached image next to it, or remove a stale one.
+   \param cachedFile full path of the cached image
+   \param compress whether to create the copy
+   */
+  static void CacheCompressed(const std::string& cachedFile, bool compress);
+
+  /*! \brief Store smaller copies of an image next to its cached file, or remove stale ones.
+   \param texture the image
+   \param cachedFile full path of the cached image
+   \param width the width of the cached image
+   \param height the height of the cached image
+   */
+  static void CacheTiers(CTexture* texture,
+                         const std::string& cachedFile,
+                         unsigned int width,
+                         unsigned int height);
+
   std::string    m_cachePath;
 };
 
@@ -17,6 +17,8 @@
 #include "utils/Variant.h"
 #include "utils/log.h"
 
+#include <algorithm>
+
 using enum CDatabaseQueryRule::FieldType;
 
 enum TextureField
@@ -137,6 +139,7 @@ void CTextureDatabase::CreateAnalytics()
 {
   CLog::Log(LOGINFO, "{} creating indices", __FUNCTION__);
   m_pDS->exec("CREATE INDEX idxTexture ON texture(url)");
+  m_pDS->exec("CREATE INDEX idxTexture2 ON texture(cachedurl)");
   m_pDS->exec("CREATE INDEX idxSize ON sizes(idtexture, size)");
   m_pDS->exec("CREATE INDEX idxSize2 ON sizes(idtexture, width, height)");
   //! @todo Should the path index be a covering index? (we need only retrieve texture)
@@ -247,6 +250,39 @@ bool CTextureDatabase::GetCachedTexture(const std::string &url, CTextureDetails
   return false;
 }
 
+bool CTextureDatabase::GetCachedTextureByFile(const std::string& file, CTextureDetails& details)
+{
+  try
+  {
+    if (!m_pDB)
+      return false;
+    if (!m_pDS)
+      return false;
+
+    const std::string sql =
+        PrepareSQL("SELECT id, width, height FROM texture "
+                   "JOIN sizes ON (texture.id=sizes.idtexture AND sizes.size=1) "
+                   "WHERE cachedurl='%s' LIMIT 1",
+                   file.c_str());
+    m_pDS->query(sql);
+    if (!m_pDS->eof())
+    {
+      details.id = m_pDS->fv(0).get_asInt();
+      details.file = file;
+      details.width = m_pDS->fv(1).get_asInt();
+      details.height = m_pDS->fv(2).get_asInt();
+      m_pDS->close();
+      return true;
+    }
+    m_pDS->close();
+  }
+  catch (...)
+  {
+    CLog::Log(LOGERROR, "{}, failed on file '{}'", __FUNCTION__, file);
+  }
+  return false;
+}
+
 bool CTextureDatabase::GetTextures(CVariant &items, const Filter &filter)
 {
   try
@@ -295,26 +331,33 @@ bool CTextureDatabase::GetTextures(CVariant &items, const Filter &filter)
   return false;
 }
 
-std::vector<std::string> CTextureDatabase::GetOldestCachedImages(unsigned int maxImages) const
+std::string CTextureDatabase::GetOldestCachedImagesWhere(unsigned int imagesPerRun) const
+{
+  // PVR manages own image cache, so exclude from here:
+  //   `WHERE url NOT LIKE 'image://pvr%%' AND url NOT LIKE 'image://epg%%'`
+  // "re-check" between minimum of 30 days and maximum of total time required to check all
+  //   current images by imagesPerRun 4 times per day, in case of very many images in library.
+  return PrepareSQL(
+      " WHERE url NOT LIKE 'image://pvr%%' AND url NOT LIKE 'image://epg%%' AND lastusetime < "
+      "datetime('now', '-30 days') AND (lastlibrarycheck IS NULL OR lastlibrarycheck < "
+      "datetime('now', '-'||min((select (count(*) / %u / 4) + 1 from texture WHERE url NOT LIKE "
+      "'image://pvr%%' AND url NOT LIKE 'image://epg%%'), max(30, (julianday(lastlibrarycheck) - "
+      "julianday(sizes.lastusetime)) / 2))||' days'))",
+      imagesPerRun);
+}
+
+std::vector<std::string> CTextureDatabase::GetOldestCachedImages(
+    unsigned int maxImages, unsigned int imagesPerRun /* = 0 */) const
 {
   try
   {
     if (!m_pDB || !m_pDS)
       return {};
 
-    // PVR manages own image cache, so exclude from here:
-    //   `WHERE url NOT LIKE 'image://pvr%%' AND url NOT LIKE 'image://epg%%'`
-    // "re-check" between minimum of 30 days and maximum of total time required to check all
-    //   current images by maxImages 4 times per day, in case of very many images in library.
-    std::string sql = PrepareSQL(
-        "SELECT url FROM texture JOIN sizes ON (texture.id=sizes.idtexture AND sizes.size=1) WHERE "
-        "url NOT LIKE 'image://pvr%%' AND url NOT LIKE 'image://epg%%' AND lastusetime < "
-        "datetime('now', '-30 days') AND (lastlibrarycheck IS NULL OR lastlibrarycheck < "
-        "datetime('now', '-'||min((select (count(*) / %u / 4) + 1 from texture WHERE url NOT LIKE "
-        "'image://pvr%%' AND url NOT LIKE 'image://epg%%'), max(30, (julianday(lastlibrarycheck) - "
-        "julianday(sizes.lastusetime)) / 2))||' days')) ORDER BY COALESCE(lastlibrarycheck, "
-        "lastusetime) ASC LIMIT %u",
-        maxImages, maxImages);
+    std::string sql =
+        "SELECT url FROM texture JOIN sizes ON (texture.id=sizes.idtexture AND sizes.size=1)" +
+        GetOldestCachedImagesWhere(imagesPerRun ? imagesPerRun : maxImages) +
+        PrepareSQL(" ORDER BY COALESCE(lastlibrarycheck, lastusetime) ASC LIMIT %u", maxImages);
 
     if (!m_pDS->query(sql))
       return {};
@@ -335,6 +378,25 @@ std::vector<std::string> CTextureDatabase::GetOldestCachedImages(unsigned int ma
   return {};
 }
 
+unsigned int CTextureDatabase::CountOldestCachedImages(unsigned int imagesPerRun) const
+{
+  try
+  {
+    if (!m_pDB || !m_pDS)
+      return 0;
+
+    const int count = GetSingleValueInt(
+        "SELECT COUNT(1) FROM texture JOIN sizes ON (texture.id=sizes.idtexture AND sizes.size=1)" +
+        GetOldestCachedImagesWhere(imagesPerRun));
+    return static_cast<unsigned int>(std::max(count, 0));
+  }
+  catch (...)
+  {
+    CLog::Log(LOGERROR, "{}, failed", __FUNCTION__);
+  }
+  return 0;
+}
+
 bool CTextureDatabase::SetKeepCachedImages(const std::vector<std::string>& imagesToKeep)
 {
   if (imagesToKeep.empty())
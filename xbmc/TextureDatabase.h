@@ -43,6 +43,14 @@ public:
   bool Open() override;
 
   bool GetCachedTexture(const std::string &originalURL, CTextureDetails &details);
+
+  /*! \brief Get a texture cached as the given file
+   Identical images share a cached file, any of them is returned.
+   \param file the cached file, relative to the cache path
+   \param details [out] the id and size of the texture
+   \return true if an image is cached as this file, false otherwise
+   */
+  bool GetCachedTextureByFile(const std::string& file, CTextureDetails& details);
   bool AddCachedTexture(const std::string &originalURL, const CTextureDetails &details);
   bool SetCachedTextureValid(const std::string &originalURL, bool updateable);
   bool ClearCachedTexture(const std::string &originalURL, std::string &cacheFile);
@@ -89,9 +97,18 @@ public:
   /*!
    * @brief Get a list of the oldest cached images eligible for cleaning.
    * @param maxImages the maximum number of images to return
+   * @param imagesPerRun the number of images checked per cleaning run, sets how often images are
+   * re-checked. Defaults to maxImages.
    * @return
    */
-  std::vector<std::string> GetOldestCachedImages(unsigned int maxImages) const;
+  std::vector<std::string> GetOldestCachedImages(unsigned int maxImages,
+                                                 unsigned int imagesPerRun = 0) const;
+
+  /*!
+   * @brief Count the cached images eligible for cleaning.
+   * @param imagesPerRun see GetOldestCachedImages()
+   */
+  unsigned int CountOldestCachedImages(unsigned int imagesPerRun) const;
 
   /*!
    * @brief Set a list of images to be kept. Used to clean the image cache.
@@ -111,9 +128,11 @@ protected:
    */
   unsigned int GetURLHash(const std::string &url) const;
 
+  std::string GetOldestCachedImagesWhere(unsigned int imagesPerRun) const;
+
   void CreateTables() override;
   void CreateAnalytics() override;
   void UpdateTables(int version) override;
-  int GetSchemaVersion() const override { return 14; }
+  int GetSchemaVersion() const override { return 15; }
   const char* GetBaseDBName() const override { return "Textures"; }
 };
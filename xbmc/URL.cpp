@@ -748,14 +748,11 @@ bool CURL::HasExtension(std::string_view extensions) const
   if (pos == std::string::npos || m_strFileName[pos] != '.')
     return false;
 
-  const std::string extensionLower = StringUtils::ToLower(m_strFileName.substr(pos));
+  const std::string_view extension = std::string_view(m_strFileName).substr(pos);
 
-  const std::vector<std::string> extensionsLower =
-      StringUtils::Split(StringUtils::ToLower(extensions), '|');
-
-  for (const auto& ext : extensionsLower)
+  for (std::string_view ext : StringUtils::SplitView(extensions, '|'))
   {
-    if (StringUtils::EndsWith(ext, extensionLower))
+    if (StringUtils::EndsWithNoCase(ext, extension))
       return true;
   }
 
@@ -491,7 +491,6 @@ void CUtil::CleanString(const std::string& strFileName,
   const std::shared_ptr<CAdvancedSettings> advancedSettings = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
   const std::vector<std::string> &regexps = advancedSettings->m_videoCleanStringRegExps;
 
-  CRegExp reTags(true, CRegExp::autoUtf8);
   CRegExp reYear(false, CRegExp::autoUtf8);
 
   if (!reYear.RegComp(advancedSettings->m_videoCleanDateTimeRegExp))
@@ -510,16 +509,19 @@ void CUtil::CleanString(const std::string& strFileName,
 
   URIUtils::RemoveExtension(strTitleAndYear);
 
-  for (const auto &regexp : regexps)
+  // invalid expressions are logged (and skipped) by the list
+  CRegExpList reTags(regexps, true, CRegExp::autoUtf8);
+  if (reTags.MayMatch(strTitleAndYear))
   {
-    if (!reTags.RegComp(regexp.c_str()))
-    { // invalid regexp - complain in logs
-      CLog::Log(LOGERROR, "{}: Invalid string clean RegExp:'{}'", __FUNCTION__, regexp);
-      continue;
+    for (CRegExp& reTag : reTags)
+    {
+      if (!reTag.IsCompiled())
+        continue;
+
+      int j=0;
+      if ((j=reTag.RegFind(strTitleAndYear.c_str())) > 0)
+        strTitleAndYear.resize(j);
     }
-    int j=0;
-    if ((j=reTags.RegFind(strTitleAndYear.c_str())) > 0)
-      strTitleAndYear.resize(j);
   }
 
   // final cleanup - special characters used instead of spaces:
@@ -1914,7 +1916,9 @@ void CUtil::GetItemsToScan(const std::string& videoPath,
                            const std::vector<std::string>& sub_dirs,
                            CFileItemList& items)
 {
-  int flags = DIR_FLAG_NO_FILE_DIRS | DIR_FLAG_NO_FILE_INFO;
+  // reuse the cached listing of the video's folder (usually there from browsing it, or from
+  // the previous item in it) instead of fetching it again for every video
+  int flags = DIR_FLAG_NO_FILE_DIRS | DIR_FLAG_NO_FILE_INFO | DIR_FLAG_READ_CACHE;
 
   if (!videoPath.empty())
     CDirectory::GetDirectory(videoPath, items, item_exts, flags);
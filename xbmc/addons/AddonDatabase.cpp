@@ -16,6 +16,7 @@
 #include "dbwrappers/dataset.h"
 #include "filesystem/SpecialProtocol.h"
 #include "utils/Artwork.h"
+#include "utils/Digest.h"
 #include "utils/JSONVariantParser.h"
 #include "utils/JSONVariantWriter.h"
 #include "utils/StringUtils.h"
@@ -24,9 +25,11 @@
 
 #include <algorithm>
 #include <iterator>
+#include <unordered_map>
 #include <utility>
 
 using namespace ADDON;
+using KODI::UTILITY::CDigest;
 
 std::string CAddonDatabaseSerializer::SerializeMetadata(const CAddonInfo& addon)
 {
@@ -815,6 +818,29 @@ int CAddonDatabase::GetRepositoryId(const std::string& addonId)
   return m_pDS->fv("id").get_asInt();
 }
 
+namespace
+{
+std::string GetAddonRowDigest(const std::string& metadata,
+                              const std::string& addonId,
+                              const std::string& version,
+                              const std::string& name,
+                              const std::string& summary,
+                              const std::string& description,
+                              const std::string& news)
+{
+  CDigest digest{CDigest::Type::SHA256};
+  for (const std::string* column :
+       {&metadata, &addonId, &version, &name, &summary, &description, &news})
+  {
+    // the size keeps adjacent columns from running into each other
+    const uint64_t size = column->size();
+    digest.Update(&size, sizeof(size));
+    digest.Update(*column);
+  }
+  return digest.Finalize();
+}
+} // namespace
+
 bool CAddonDatabase::UpdateRepositoryContent(const std::string& repository,
                                              const CAddonVersion& /*version*/,
                                              const std::string& checksum,
@@ -827,24 +853,72 @@ bool CAddonDatabase::UpdateRepositoryContent(const std::string& repository,
     if (!m_pDS)
       return false;
 
-    DeleteRepositoryContents(repository);
     int idRepo = GetRepositoryId(repository);
     if (idRepo < 0)
       return false;
 
     assert(idRepo > 0);
 
+    // most of a repository stays the same between updates, so only the rows
+    // that actually changed are removed and written again
+    std::unordered_map<std::string, std::vector<int>> existing;
+    m_pDS->query(PrepareSQL("SELECT addons.id, metadata, addons.addonID, version, name, summary, "
+                            "description, news FROM addons JOIN addonlinkrepo ON "
+                            "addonlinkrepo.idAddon=addons.id WHERE addonlinkrepo.idRepo=%i",
+                            idRepo));
+    while (!m_pDS->eof())
+    {
+      existing[GetAddonRowDigest(m_pDS->fv(1).get_asString(), m_pDS->fv(2).get_asString(),
+                                 m_pDS->fv(3).get_asString(), m_pDS->fv(4).get_asString(),
+                                 m_pDS->fv(5).get_asString(), m_pDS->fv(6).get_asString(),
+                                 m_pDS->fv(7).get_asString())]
+          .push_back(m_pDS->fv(0).get_asInt());
+      m_pDS->next();
+    }
+    m_pDS->close();
+
     m_pDB->start_transaction();
     m_pDS->exec(
         PrepareSQL("UPDATE repo SET checksum='%s' WHERE id='%i'", checksum.c_str(), idRepo));
+
+    unsigned int unchanged = 0;
+    std::vector<std::pair<const AddonInfoPtr*, std::string>> added;
     for (const auto& addon : addons)
     {
+      std::string metadata = CAddonDatabaseSerializer::SerializeMetadata(*addon);
+      auto it = existing.find(GetAddonRowDigest(
+          metadata, addon->ID(), addon->Version().asString(), addon->Name(), addon->Summary(),
+          addon->Description(), addon->ChangeLog()));
+      if (it != existing.end() && !it->second.empty())
+      {
+        it->second.pop_back();
+        ++unchanged;
+      }
+      else
+        added.emplace_back(&addon, std::move(metadata));
+    }
+
+    unsigned int removed = 0;
+    for (const auto& [_, ids] : existing)
+    {
+      for (const int idAddon : ids)
+      {
+        m_pDS->exec(PrepareSQL("DELETE FROM addons WHERE id=%i", idAddon));
+        m_pDS->exec(PrepareSQL("DELETE FROM addonlinkrepo WHERE idRepo=%i AND idAddon=%i", idRepo,
+                               idAddon));
+        ++removed;
+      }
+    }
+
+    for (const auto& [addonPtr, metadata] : added)
+    {
+      const AddonInfoPtr& addon = *addonPtr;
       m_pDS->exec(PrepareSQL(
           "INSERT INTO addons (id, metadata, addonID, version, name, summary, description, news) "
           "VALUES (NULL, '%s', '%s', '%s', '%s','%s', '%s','%s')",
-          CAddonDatabaseSerializer::SerializeMetadata(*addon).c_str(), addon->ID().c_str(),
-          addon->Version().asString().c_str(), addon->Name().c_str(), addon->Summary().c_str(),
-          addon->Description().c_str(), addon->ChangeLog().c_str()));
+          metadata.c_str(), addon->ID().c_str(), addon->Version().asString().c_str(),
+          addon->Name().c_str(), addon->Summary().c_str(), addon->Description().c_str(),
+          addon->ChangeLog().c_str()));
 
       const auto idAddon = static_cast<int>(m_pDS->lastinsertid());
       if (idAddon <= 0)
@@ -858,6 +932,8 @@ bool CAddonDatabase::UpdateRepositoryContent(const std::string& repository,
     }
 
     m_pDB->commit_transaction();
+    CLog::LogF(LOGDEBUG, "repo '{}': {} add-ons unchanged, {} added, {} removed", repository,
+               unchanged, added.size(), removed);
     return true;
   }
   catch (...)
@@ -28,10 +28,13 @@
 #include "events/EventLog.h"
 #include "events/NotificationEvent.h"
 #include "filesystem/Directory.h"
+#include "filesystem/File.h"
 #include "filesystem/SpecialProtocol.h"
 #include "jobs/JobManager.h"
+#include "utils/Archive.h"
 #include "utils/FileUtils.h"
 #include "utils/StringUtils.h"
+#include "utils/SystemInfo.h"
 #include "utils/URIUtils.h"
 #include "utils/XBMCTinyXML2.h"
 #include "utils/XMLUtils.h"
@@ -88,6 +91,48 @@ bool LoadManifest(std::set<std::string, std::less<>>& system,
   }
   return true;
 }
+
+constexpr int MANIFEST_CACHE_VERSION = 1;
+constexpr int MANIFEST_CACHE_END = 0x4b4f4449;
+
+std::vector<std::string> GetAddonRoots()
+{
+  std::vector<std::string> roots{"special://xbmcbin/addons"};
+  // Confirm special://xbmcbin/addons and special://xbmc/addons are not the same
+  if (!CSpecialProtocol::ComparePath("special://xbmcbin/addons", "special://xbmc/addons"))
+    roots.emplace_back("special://xbmc/addons");
+  roots.emplace_back("special://home/addons");
+  return roots;
+}
+
+int64_t GetModificationTime(const std::string& path)
+{
+  struct __stat64 st = {};
+  if (CFile::Stat(path, &st) != 0)
+    return -1;
+  return static_cast<int64_t>(st.st_mtime);
+}
+
+// Everything on disk besides the root directory listing that CAddonInfoBuilder::Generate() reads.
+// Add-ons updated in place keep their directory, so the root mtime does not catch these.
+std::string GetManifestFingerprint(const std::string& addonPath)
+{
+  std::string fingerprint;
+  for (const auto& file : {URIUtils::AddFileToFolder(addonPath, "addon.xml"),
+                           URIUtils::AddFileToFolder(addonPath, "changelog.txt"),
+                           URIUtils::AddFileToFolder(addonPath, "resources", "settings.xml"),
+                           URIUtils::AddFileToFolder(addonPath, "resources",
+                                                     "instance-settings.xml")})
+  {
+    struct __stat64 st = {};
+    if (CFile::Stat(file, &st) == 0)
+      fingerprint += StringUtils::Format("{}:{};", static_cast<int64_t>(st.st_mtime),
+                                         static_cast<int64_t>(st.st_size));
+    else
+      fingerprint += "-;";
+  }
+  return fingerprint;
+}
 } // unnamed namespace
 
 CAddonMgr::CAddonMgr()
@@ -138,7 +183,23 @@ bool CAddonMgr::Init()
   if (!m_database->Open())
     CLog::Log(LOGFATAL, "ADDONS: Failed to open database");
 
-  FindAddons();
+  AddonInfoMap cachedAddons;
+  ManifestFingerprints fingerprints;
+  if (LoadManifestCache(cachedAddons, fingerprints))
+  {
+    CLog::Log(LOGDEBUG, "ADDONS: restored {} add-on manifests from cache", cachedAddons.size());
+    SetInstalledAddons(std::move(cachedAddons));
+
+    // add-ons changed in place don't touch the root directories, catch these off the startup path
+    if (const auto jobManager = CServiceBroker::GetJobManager())
+      jobManager->Submit([this, fingerprints = std::move(fingerprints)]()
+                         { ValidateManifestCache(fingerprints); },
+                         CJob::PRIORITY_LOW);
+    else
+      ValidateManifestCache(fingerprints);
+  }
+  else
+    FindAddons();
 
   //Ensure required add-ons are installed and enabled
   for (const auto& id : m_systemAddons)
@@ -658,11 +719,8 @@ bool CAddonMgr::FindAddon(const std::string& addonId,
                           const CAddonVersion& addonVersion)
 {
   AddonInfoMap installedAddons;
-  FindAddons(installedAddons, "special://xbmcbin/addons");
-  // Confirm special://xbmcbin/addons and special://xbmc/addons are not the same
-  if (!CSpecialProtocol::ComparePath("special://xbmcbin/addons", "special://xbmc/addons"))
-    FindAddons(installedAddons, "special://xbmc/addons");
-  FindAddons(installedAddons, "special://home/addons");
+  for (const auto& root : GetAddonRoots())
+    FindAddons(installedAddons, root);
 
   const auto it = installedAddons.find(addonId);
   if (it == installedAddons.cend() || it->second->Version() != addonVersion)
@@ -688,13 +746,18 @@ bool CAddonMgr::FindAddon(const std::string& addonId,
 bool CAddonMgr::FindAddons()
 {
   AddonInfoMap installedAddons;
+  ManifestFingerprints fingerprints;
+  for (const auto& root : GetAddonRoots())
+    FindAddons(installedAddons, root, &fingerprints);
 
-  FindAddons(installedAddons, "special://xbmcbin/addons");
-  // Confirm special://xbmcbin/addons and special://xbmc/addons are not the same
-  if (!CSpecialProtocol::ComparePath("special://xbmcbin/addons", "special://xbmc/addons"))
-    FindAddons(installedAddons, "special://xbmc/addons");
-  FindAddons(installedAddons, "special://home/addons");
+  SaveManifestCache(installedAddons, fingerprints);
+  SetInstalledAddons(std::move(installedAddons));
+
+  return true;
+}
 
+void CAddonMgr::SetInstalledAddons(AddonInfoMap installedAddons)
+{
   std::set<std::string, std::less<>> installed;
   for (const auto& [_, addon] : installedAddons)
     installed.insert(addon->ID());
@@ -718,8 +781,133 @@ bool CAddonMgr::FindAddons()
   m_disabled = std::move(tmpDisabled);
 
   m_updateRules->RefreshRulesMap(*m_database);
+}
 
-  return true;
+bool CAddonMgr::LoadManifestCache(AddonInfoMap& addonmap, ManifestFingerprints& fingerprints) const
+{
+  CFile file;
+  if (!file.Open(m_manifestCachePath))
+    return false;
+
+  try
+  {
+    CArchive ar(&file, CArchive::load);
+
+    int version = 0;
+    std::string kodiVersion;
+    ar >> version;
+    ar >> kodiVersion;
+    if (version != MANIFEST_CACHE_VERSION || kodiVersion != CSysInfo::GetVersion())
+      return false;
+
+    // an add-on installed, removed or replaced by a different version touches its root directory
+    const std::vector<std::string> roots = GetAddonRoots();
+    unsigned int rootCount = 0;
+    ar >> rootCount;
+    if (rootCount != roots.size())
+      return false;
+    for (const auto& root : roots)
+    {
+      std::string path;
+      int64_t mtime = 0;
+      ar >> path;
+      ar >> mtime;
+      if (path != root || mtime != GetModificationTime(root))
+        return false;
+    }
+
+    unsigned int count = 0;
+    ar >> count;
+    fingerprints.resize(count);
+    for (auto& [path, fingerprint] : fingerprints)
+    {
+      ar >> path;
+      ar >> fingerprint;
+    }
+
+    ar >> count;
+    for (unsigned int i = 0; i < count; ++i)
+    {
+      AddonInfoPtr addonInfo = CAddonInfoBuilder::Unarchive(ar);
+      if (!addonInfo)
+        return false;
+      addonmap[addonInfo->ID()] = std::move(addonInfo);
+    }
+
+    int end = 0;
+    ar >> end;
+    ar.Close();
+    return end == MANIFEST_CACHE_END;
+  }
+  catch (const std::out_of_range&)
+  {
+    CLog::Log(LOGERROR, "ADDONS: manifest cache {} is corrupt", m_manifestCachePath);
+  }
+
+  addonmap.clear();
+  fingerprints.clear();
+  return false;
+}
+
+void CAddonMgr::SaveManifestCache(const AddonInfoMap& addonmap,
+                                  const ManifestFingerprints& fingerprints) const
+{
+  CFile file;
+  if (!file.OpenForWrite(m_manifestCachePath, true))
+  {
+    CLog::Log(LOGWARNING, "ADDONS: unable to write manifest cache {}", m_manifestCachePath);
+    return;
+  }
+
+  CArchive ar(&file, CArchive::store);
+  ar << MANIFEST_CACHE_VERSION;
+  ar << CSysInfo::GetVersion();
+
+  const std::vector<std::string> roots = GetAddonRoots();
+  ar << static_cast<unsigned int>(roots.size());
+  for (const auto& root : roots)
+  {
+    ar << root;
+    ar << GetModificationTime(root);
+  }
+
+  ar << static_cast<unsigned int>(fingerprints.size());
+  for (const auto& [path, fingerprint] : fingerprints)
+  {
+    ar << path;
+    ar << fingerprint;
+  }
+
+  ar << static_cast<unsigned int>(addonmap.size());
+  for (const auto& [_, addonInfo] : addonmap)
+    CAddonInfoBuilder::Archive(ar, *addonInfo);
+
+  ar << MANIFEST_CACHE_END;
+  ar.Close();
+}
+
+void CAddonMgr::ValidateManifestCache(const ManifestFingerprints& fingerprints)
+{
+  ManifestFingerprints current;
+  for (const auto& root : GetAddonRoots())
+  {
+    CFileItemList items;
+    if (!CDirectory::GetDirectory(root, items, "", DIR_FLAG_NO_FILE_DIRS))
+      continue;
+
+    for (const auto& item : items)
+    {
+      const std::string& path = item->GetPath();
+      if (CFileUtils::Exists(path + "addon.xml"))
+        current.emplace_back(path, GetManifestFingerprint(path));
+    }
+  }
+
+  if (current != fingerprints)
+  {
+    CLog::Log(LOGINFO, "ADDONS: add-ons changed since the manifest cache was written, rescanning");
+    FindAddons();
+  }
 }
 
 bool CAddonMgr::UnloadAddon(const std::string& addonId)
@@ -1267,7 +1455,9 @@ AddonInfoPtr CAddonMgr::GetAddonInfo(const std::string& id, AddonType type) cons
   return nullptr;
 }
 
-void CAddonMgr::FindAddons(AddonInfoMap& addonmap, const std::string& path) const
+void CAddonMgr::FindAddons(AddonInfoMap& addonmap,
+                           const std::string& path,
+                           ManifestFingerprints* fingerprints /* = nullptr */) const
 {
   CFileItemList items;
   if (XFILE::CDirectory::GetDirectory(path, items, "", XFILE::DIR_FLAG_NO_FILE_DIRS))
@@ -1277,6 +1467,9 @@ void CAddonMgr::FindAddons(AddonInfoMap& addonmap, const std::string& path) cons
       const std::string p{i->GetPath()};
       if (CFileUtils::Exists(p + "addon.xml"))
       {
+        if (fingerprints)
+          fingerprints->emplace_back(p, GetManifestFingerprint(p));
+
         AddonInfoPtr addonInfo = CAddonInfoBuilder::Generate(p);
         if (addonInfo)
         {
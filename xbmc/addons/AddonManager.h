@@ -632,7 +632,31 @@ private:
 
   bool EnableSingle(const std::string& id);
 
-  void FindAddons(AddonInfoMap& addonmap, const std::string& path) const;
+  //! Directories scanned for add-ons, paired with the fingerprint of their manifest files
+  using ManifestFingerprints = std::vector<std::pair<std::string, std::string>>;
+
+  void FindAddons(AddonInfoMap& addonmap,
+                  const std::string& path,
+                  ManifestFingerprints* fingerprints = nullptr) const;
+
+  /*!
+     * \brief Replace the installed add-ons and sync them with the database
+     */
+  void SetInstalledAddons(AddonInfoMap installedAddons);
+
+  /*!
+     * \brief Restore the installed add-ons from the manifest cache written by the last full scan
+     *        without parsing any addon.xml.
+     * \return false if the cache is missing, corrupt or any add-on directory changed since
+     */
+  bool LoadManifestCache(AddonInfoMap& addonmap, ManifestFingerprints& fingerprints) const;
+  void SaveManifestCache(const AddonInfoMap& addonmap,
+                         const ManifestFingerprints& fingerprints) const;
+
+  /*!
+     * \brief Rescan all add-ons if a manifest changed since the cache it was restored from
+     */
+  void ValidateManifestCache(const ManifestFingerprints& fingerprints);
 
   /*!
      * @brief Fills the the provided vector with the list of incompatible
@@ -690,6 +714,9 @@ private:
   // Temporary path given to add-ons, whose content is deleted when Kodi is stopped
   const std::string m_tempAddonBasePath = "special://temp/addons";
 
+  // Parsed addon.xml of all installed add-ons, written after every full scan
+  const std::string m_manifestCachePath = "special://temp/addonmanifests.bin";
+
   /*!
      * latest count of available updates
      */
@@ -30,6 +30,7 @@
 #include "utils/log.h"
 
 #include <algorithm>
+#include <future>
 #include <iterator>
 #include <tuple>
 #include <utility>
@@ -254,22 +255,41 @@ CRepository::FetchStatus CRepository::FetchIfChanged(std::string_view oldChecksu
   std::vector<std::tuple<RepositoryDirInfo const&, std::string>> dirChecksums;
   std::vector<int> recheckAfterTimes;
 
+  // repositories spanning several directories fetch them all at once
+  struct ChecksumRequest
+  {
+    const RepositoryDirInfo& dir;
+    std::string checksum;
+    int recheckAfter = 0;
+    std::future<bool> result;
+  };
+  std::vector<ChecksumRequest> requests;
   for (const auto& dir : m_dirs)
   {
     if (!dir.checksum.empty())
+      requests.push_back({dir});
+  }
+  for (auto& request : requests)
+    request.result = std::async(std::launch::async, FetchChecksum, std::cref(request.dir.checksum),
+                                std::ref(request.checksum), std::ref(request.recheckAfter));
+
+  bool failed = false;
+  for (auto& request : requests)
+  {
+    if (!request.result.get())
     {
-      std::string part;
-      int recheckAfterThisDir;
-      if (!FetchChecksum(dir.checksum, part, recheckAfterThisDir))
-      {
-        recheckAfter = 1 * 60 * 60; // retry after 1 hour
-        CLog::Log(LOGERROR, "CRepository: failed read '{}'", dir.checksum);
-        return FetchStatus::FETCH_ERROR;
-      }
-      dirChecksums.emplace_back(dir, part);
-      recheckAfterTimes.push_back(recheckAfterThisDir);
-      checksum += part;
+      CLog::Log(LOGERROR, "CRepository: failed read '{}'", request.dir.checksum);
+      failed = true;
+      continue;
     }
+    dirChecksums.emplace_back(request.dir, request.checksum);
+    recheckAfterTimes.push_back(request.recheckAfter);
+    checksum += request.checksum;
+  }
+  if (failed)
+  {
+    recheckAfter = 1 * 60 * 60; // retry after 1 hour
+    return FetchStatus::FETCH_ERROR;
   }
 
   // Default interval: 24 h
@@ -284,13 +304,25 @@ CRepository::FetchStatus CRepository::FetchIfChanged(std::string_view oldChecksu
       return FetchStatus::NOT_MODIFIED;
   }
 
-  for (const auto& [repoInfo, digest] : dirChecksums)
+  std::vector<std::vector<AddonInfoPtr>> dirAddons(dirChecksums.size());
+  std::vector<std::future<bool>> indexes;
+  for (size_t i = 0; i < dirChecksums.size(); ++i)
   {
-    std::vector<AddonInfoPtr> tmp;
-    if (!FetchIndex(repoInfo, digest, tmp))
-      return FetchStatus::FETCH_ERROR;
-    addons.insert(addons.end(), tmp.begin(), tmp.end());
+    const auto& [repoInfo, digest] = dirChecksums[i];
+    indexes.emplace_back(std::async(std::launch::async, FetchIndex, std::cref(repoInfo),
+                                    std::cref(digest), std::ref(dirAddons[i])));
   }
+
+  // wait for all of them, the futures must not outlive what they refer to
+  bool complete = true;
+  for (auto& index : indexes)
+    complete = index.get() && complete;
+  if (!complete)
+    return FetchStatus::FETCH_ERROR;
+
+  for (auto& tmp : dirAddons)
+    addons.insert(addons.end(), std::make_move_iterator(tmp.begin()),
+                  std::make_move_iterator(tmp.end()));
   return FetchStatus::OK;
 }
 
@@ -10,6 +10,7 @@
 
 #include "FileItem.h"
 #include "FileItemList.h"
+#include "GUIInfoManager.h"
 #include "ServiceBroker.h"
 #include "Util.h"
 #include "addons/addoninfo/AddonType.h"
@@ -688,7 +689,7 @@ void CSkinInfo::SetString(int setting, std::string_view label)
   if (it != m_strings.end())
   {
     it->second->value = label;
-    m_settingsUpdateHandler->TriggerSave();
+    SettingsChanged();
     return;
   }
 
@@ -732,7 +733,7 @@ void CSkinInfo::SetBool(int setting, bool set)
   if (it != m_bools.end())
   {
     it->second->value = set;
-    m_settingsUpdateHandler->TriggerSave();
+    SettingsChanged();
     return;
   }
 
@@ -776,7 +777,7 @@ void CSkinInfo::Reset(const std::string &setting)
     if (StringUtils::EqualsNoCase(setting, settingstring->name))
     {
       settingstring->value.clear();
-      m_settingsUpdateHandler->TriggerSave();
+      SettingsChanged();
       return;
     }
   }
@@ -787,7 +788,7 @@ void CSkinInfo::Reset(const std::string &setting)
     if (StringUtils::EqualsNoCase(setting, settingbool->name))
     {
       settingbool->value = false;
-      m_settingsUpdateHandler->TriggerSave();
+      SettingsChanged();
       return;
     }
   }
@@ -802,6 +803,15 @@ void CSkinInfo::Reset()
   for (const auto& [_, settingstring] : m_strings)
     settingstring->value.clear();
 
+  SettingsChanged();
+}
+
+void CSkinInfo::SettingsChanged()
+{
+  // conditions on skin settings aren't evaluated again for every frame
+  if (CServiceBroker::GetGUI())
+    CServiceBroker::GetGUI()->GetInfoManager().InvalidateSkinSettings();
+
   m_settingsUpdateHandler->TriggerSave();
 }
 
@@ -886,6 +896,9 @@ bool CSkinInfo::SettingsFromXML(const CXBMCTinyXML& doc,
                 setting->GetType());
   }
 
+  if (CServiceBroker::GetGUI())
+    CServiceBroker::GetGUI()->GetInfoManager().InvalidateSkinSettings();
+
   return true;
 }
 
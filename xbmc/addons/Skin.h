@@ -282,6 +282,10 @@ protected:
   std::unique_ptr<CSkinTimerManager> m_skinTimerManager;
 
 private:
+  /*! \brief Save the skin settings and update the conditions depending on them
+   */
+  void SettingsChanged();
+
   std::map<int, CSkinSettingStringPtr> m_strings;
   std::map<int, CSkinSettingBoolPtr> m_bools;
   std::map<std::string, CSkinSettingPtr, std::less<>> m_settings;
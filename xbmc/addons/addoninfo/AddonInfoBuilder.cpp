@@ -15,6 +15,7 @@
 #include "addons/addoninfo/AddonType.h"
 #include "filesystem/File.h"
 #include "filesystem/SpecialProtocol.h"
+#include "utils/Archive.h"
 #include "utils/JSONVariantParser.h"
 #include "utils/JSONVariantWriter.h"
 #include "utils/StringUtils.h"
@@ -32,6 +33,28 @@ namespace
 {
 // Note that all of these characters are url-safe
 const std::string VALID_ADDON_IDENTIFIER_CHARACTERS = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789.-_@!$";
+
+template<typename Map>
+void ArchiveMap(CArchive& ar, const Map& map)
+{
+  ar << static_cast<uint32_t>(map.size());
+  for (const auto& [key, value] : map)
+    ar << key << value;
+}
+
+template<typename Map>
+void UnarchiveMap(CArchive& ar, Map& map)
+{
+  uint32_t size;
+  ar >> size;
+  for (uint32_t i = 0; i < size; ++i)
+  {
+    std::string key;
+    std::string value;
+    ar >> key >> value;
+    map.insert_or_assign(std::move(key), std::move(value));
+  }
+}
 }
 
 namespace ADDON
@@ -258,6 +281,183 @@ void CAddonInfoBuilder::SetInstallData(const AddonInfoPtr& addon,
   addon->m_origin = origin;
 }
 
+void CAddonInfoBuilder::Archive(CArchive& ar, const CAddonInfo& addon)
+{
+  ar << addon.m_id;
+  ar << static_cast<int>(addon.m_mainType);
+  ar << static_cast<uint32_t>(addon.m_types.size());
+  for (const auto& type : addon.m_types)
+  {
+    ar << static_cast<int>(type.m_type);
+    ar << type.m_path;
+    ar << type.m_libname;
+    std::vector<int> provides;
+    for (const auto& content : type.m_providedSubContent)
+      provides.push_back(static_cast<int>(content));
+    ar << provides;
+    ArchiveExtensions(ar, type);
+  }
+
+  ar << addon.m_version.asString();
+  ar << addon.m_minversion.asString();
+  ar << addon.m_isBinary;
+  ar << addon.m_name;
+  ar << addon.m_license;
+  ArchiveMap(ar, addon.m_summary);
+  ArchiveMap(ar, addon.m_description);
+  ar << addon.m_author;
+  ar << addon.m_source;
+  ar << addon.m_website;
+  ar << addon.m_forum;
+  ar << addon.m_email;
+  ar << addon.m_path;
+  ar << addon.m_profilePath;
+  ArchiveMap(ar, addon.m_changelog);
+  ar << addon.m_icon;
+  ArchiveMap(ar, addon.m_art);
+  ar << addon.m_screenshots;
+  ArchiveMap(ar, addon.m_disclaimer);
+
+  ar << static_cast<uint32_t>(addon.m_dependencies.size());
+  for (const auto& dep : addon.m_dependencies)
+    ar << dep.id << dep.versionMin.asString() << dep.version.asString() << dep.optional;
+
+  ar << static_cast<int>(addon.m_lifecycleState);
+  ArchiveMap(ar, addon.m_lifecycleStateDescription);
+  ar << addon.m_packageSize;
+  ar << addon.m_libname;
+  ArchiveMap(ar, addon.m_extrainfo);
+  ar << addon.m_platforms;
+  ar << static_cast<int>(addon.m_addonInstanceSupportType);
+  ar << addon.m_supportsAddonSettings;
+  ar << addon.m_supportsInstanceSettings;
+}
+
+AddonInfoPtr CAddonInfoBuilder::Unarchive(CArchive& ar)
+{
+  auto addon = std::make_shared<CAddonInfo>();
+  int value;
+  uint32_t count;
+  std::string version;
+
+  ar >> addon->m_id;
+  ar >> value;
+  addon->m_mainType = static_cast<AddonType>(value);
+  ar >> count;
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    ar >> value;
+    CAddonType type(static_cast<AddonType>(value));
+    ar >> type.m_path;
+    ar >> type.m_libname;
+    std::vector<int> provides;
+    ar >> provides;
+    for (const int content : provides)
+      type.m_providedSubContent.insert(static_cast<AddonType>(content));
+    UnarchiveExtensions(ar, type);
+    addon->m_types.emplace_back(std::move(type));
+  }
+
+  ar >> version;
+  addon->m_version = CAddonVersion(version);
+  ar >> version;
+  addon->m_minversion = CAddonVersion(version);
+  ar >> addon->m_isBinary;
+  ar >> addon->m_name;
+  ar >> addon->m_license;
+  UnarchiveMap(ar, addon->m_summary);
+  UnarchiveMap(ar, addon->m_description);
+  ar >> addon->m_author;
+  ar >> addon->m_source;
+  ar >> addon->m_website;
+  ar >> addon->m_forum;
+  ar >> addon->m_email;
+  ar >> addon->m_path;
+  ar >> addon->m_profilePath;
+  UnarchiveMap(ar, addon->m_changelog);
+  ar >> addon->m_icon;
+  UnarchiveMap(ar, addon->m_art);
+  ar >> addon->m_screenshots;
+  UnarchiveMap(ar, addon->m_disclaimer);
+
+  ar >> count;
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    std::string id;
+    std::string versionMin;
+    bool optional;
+    ar >> id >> versionMin >> version >> optional;
+    addon->m_dependencies.emplace_back(std::move(id), CAddonVersion(versionMin),
+                                       CAddonVersion(version), optional);
+  }
+
+  ar >> value;
+  addon->m_lifecycleState = static_cast<AddonLifecycleState>(value);
+  UnarchiveMap(ar, addon->m_lifecycleStateDescription);
+  ar >> addon->m_packageSize;
+  ar >> addon->m_libname;
+  UnarchiveMap(ar, addon->m_extrainfo);
+  ar >> addon->m_platforms;
+  ar >> value;
+  addon->m_addonInstanceSupportType = static_cast<AddonInstanceSupport>(value);
+  ar >> addon->m_supportsAddonSettings;
+  ar >> addon->m_supportsInstanceSettings;
+
+  if (addon->m_id.empty() || addon->m_types.empty())
+    return nullptr;
+  return addon;
+}
+
+void CAddonInfoBuilder::ArchiveExtensions(CArchive& ar, const CAddonExtensions& extensions)
+{
+  ar << extensions.m_point;
+  ar << static_cast<uint32_t>(extensions.m_values.size());
+  for (const auto& [id, values] : extensions.m_values)
+  {
+    ar << id;
+    ar << static_cast<uint32_t>(values.size());
+    for (const auto& [key, value] : values)
+      ar << key << value.str;
+  }
+  ar << static_cast<uint32_t>(extensions.m_children.size());
+  for (const auto& [id, child] : extensions.m_children)
+  {
+    ar << id;
+    ArchiveExtensions(ar, child);
+  }
+}
+
+void CAddonInfoBuilder::UnarchiveExtensions(CArchive& ar, CAddonExtensions& extensions)
+{
+  uint32_t count;
+  ar >> extensions.m_point;
+  ar >> count;
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    std::string id;
+    uint32_t valueCount;
+    ar >> id >> valueCount;
+    EXT_VALUE values;
+    for (uint32_t j = 0; j < valueCount; ++j)
+    {
+      std::string key;
+      std::string value;
+      ar >> key >> value;
+      values.emplace_back(std::move(key), SExtValue(value));
+    }
+    extensions.m_values.emplace_back(std::move(id), CExtValues(values));
+  }
+  ar >> count;
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    std::string id;
+    CAddonExtensions child;
+    ar >> id;
+    UnarchiveExtensions(ar, child);
+    extensions.m_children.emplace_back(std::move(id), std::move(child));
+  }
+}
+
 bool CAddonInfoBuilder::ParseXML(const AddonInfoPtr& addon,
                                  const tinyxml2::XMLElement* element,
                                  const std::string& addonPath)
@@ -17,6 +17,7 @@
 #include <string>
 #include <vector>
 
+class CArchive;
 class CDateTime;
 
 namespace tinyxml2
@@ -58,7 +59,21 @@ public:
                              std::string_view origin);
   //@}
 
+  /*!
+    * @brief Parts used from the installed add-on manifest cache of CAddonMgr
+    *
+    * Stores everything read from an add-on's addon.xml, so it can be restored
+    * without parsing it again. Install data is not part of it.
+    */
+  //@{
+  static void Archive(CArchive& ar, const CAddonInfo& addon);
+  static AddonInfoPtr Unarchive(CArchive& ar);
+  //@}
+
 private:
+  static void ArchiveExtensions(CArchive& ar, const CAddonExtensions& extensions);
+  static void UnarchiveExtensions(CArchive& ar, CAddonExtensions& extensions);
+
   static bool ParseXML(const AddonInfoPtr& addon,
                        const tinyxml2::XMLElement* element,
                        const std::string& addonPath);
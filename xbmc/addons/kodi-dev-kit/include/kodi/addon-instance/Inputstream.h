@@ -1634,6 +1634,31 @@ public:
   virtual DEMUX_PACKET* DemuxRead() { return nullptr; }
   //----------------------------------------------------------------------------
 
+  //============================================================================
+  /// @brief Read the packets currently available from the demultiplexer.
+  ///
+  /// Saves a call across the add-on boundary per packet on high bitrate
+  /// streams. Only packets that are available without waiting should be
+  /// returned, at least one unless an error occurred. The packets are handed
+  /// out in order, as @ref DemuxRead would return them.
+  ///
+  /// @param[out] packets Array to store the packets in
+  /// @param[in] maxPackets Size of the array
+  /// @return The number of packets stored, <b>`0`</b> if an error occurred
+  ///
+  /// @remarks Optional, the default implementation returns the single packet
+  ///          of @ref DemuxRead.
+  ///
+  virtual int DemuxReadMultiple(DEMUX_PACKET** packets, int maxPackets)
+  {
+    if (maxPackets <= 0)
+      return 0;
+
+    packets[0] = DemuxRead();
+    return packets[0] ? 1 : 0;
+  }
+  //----------------------------------------------------------------------------
+
   //============================================================================
   /// @brief Notify the InputStream addon/demuxer that Kodi wishes to seek the stream by time
   ///
@@ -1902,6 +1927,7 @@ private:
     instance->inputstream->toAddon->demux_abort = ADDON_DemuxAbort;
     instance->inputstream->toAddon->demux_flush = ADDON_DemuxFlush;
     instance->inputstream->toAddon->demux_read = ADDON_DemuxRead;
+    instance->inputstream->toAddon->demux_read_multiple = ADDON_DemuxReadMultiple;
     instance->inputstream->toAddon->demux_seek_time = ADDON_DemuxSeekTime;
     instance->inputstream->toAddon->demux_set_speed = ADDON_DemuxSetSpeed;
     instance->inputstream->toAddon->set_video_resolution = ADDON_SetVideoResolution;
@@ -2032,6 +2058,14 @@ private:
     return static_cast<CInstanceInputStream*>(instance->toAddon->addonInstance)->DemuxRead();
   }
 
+  inline static int ADDON_DemuxReadMultiple(const AddonInstance_InputStream* instance,
+                                            DEMUX_PACKET** packets,
+                                            int maxPackets)
+  {
+    return static_cast<CInstanceInputStream*>(instance->toAddon->addonInstance)
+        ->DemuxReadMultiple(packets, maxPackets);
+  }
+
   inline static bool ADDON_DemuxSeekTime(const AddonInstance_InputStream* instance,
                                          double time,
                                          bool backwards,
@@ -579,6 +579,29 @@ public:
     m_instance->toKodi->TransferEpgEntry(m_instance->toKodi->kodiInstance, m_handle, tag);
   }
 
+  /// @brief To add and give several entries at once from addon to Kodi on related call.
+  ///
+  /// Transfers all entries with a single call to Kodi, which is considerably
+  /// cheaper than adding them one by one for large lists.
+  ///
+  /// @param[in] tags The to transferred data.
+  void Add(const std::vector<kodi::addon::PVREPGTag>& tags)
+  {
+    if (!m_instance->toKodi->TransferEpgEntries)
+    {
+      for (const auto& tag : tags)
+        Add(tag);
+      return;
+    }
+
+    std::vector<EPG_TAG> entries;
+    entries.reserve(tags.size());
+    for (const auto& tag : tags)
+      entries.emplace_back(*tag.GetCStructure());
+    m_instance->toKodi->TransferEpgEntries(m_instance->toKodi->kodiInstance, m_handle,
+                                           entries.data(), entries.size());
+  }
+
   ///@}
 
 private:
@@ -729,6 +729,10 @@ extern "C"
     bool(__cdecl* seek_chapter)(const struct AddonInstance_InputStream* instance, int ch);
 
     int(__cdecl* block_size_stream)(const struct AddonInstance_InputStream* instance);
+
+    int(__cdecl* demux_read_multiple)(const struct AddonInstance_InputStream* instance,
+                                      struct DEMUX_PACKET** packets,
+                                      int max_packets);
   } KodiToAddonFuncTable_InputStream;
 
   typedef struct AddonInstance_InputStream /* internal */
@@ -135,6 +135,22 @@ extern "C"
     //--==----==----==----==----==----==----==----==----==----==----==----==----==
     // New functions becomes added below and can be on another API change (where
     // breaks min API version) moved up.
+    void (*TransferChannelEntries)(void* kodiInstance,
+                                   const PVR_HANDLE handle,
+                                   const struct PVR_CHANNEL* chans,
+                                   size_t count);
+    void (*TransferEpgEntries)(void* kodiInstance,
+                               const PVR_HANDLE handle,
+                               const struct EPG_TAG* epgentries,
+                               size_t count);
+    void (*TransferRecordingEntries)(void* kodiInstance,
+                                     const PVR_HANDLE handle,
+                                     const struct PVR_RECORDING* recordings,
+                                     size_t count);
+    void (*TransferTimerEntries)(void* kodiInstance,
+                                 const PVR_HANDLE handle,
+                                 const struct PVR_TIMER* timers,
+                                 size_t count);
   } AddonToKodiFuncTable_PVR;
 
   /*!
@@ -356,6 +372,22 @@ extern "C"
     //--==----==----==----==----==----==----==----==----==----==----==----==----==
     // New functions becomes added below and can be on another API change (where
     // breaks min API version) moved up.
+    void (*TransferChannelEntries)(void* kodiInstance,
+                                   const PVR_HANDLE handle,
+                                   const struct PVR_CHANNEL* chans,
+                                   size_t count);
+    void (*TransferEpgEntries)(void* kodiInstance,
+                               const PVR_HANDLE handle,
+                               const struct EPG_TAG* epgentries,
+                               size_t count);
+    void (*TransferRecordingEntries)(void* kodiInstance,
+                                     const PVR_HANDLE handle,
+                                     const struct PVR_RECORDING* recordings,
+                                     size_t count);
+    void (*TransferTimerEntries)(void* kodiInstance,
+                                 const PVR_HANDLE handle,
+                                 const struct PVR_TIMER* timers,
+                                 size_t count);
   } KodiToAddonFuncTable_PVR;
 
   typedef struct AddonInstance_PVR
@@ -78,3 +78,37 @@ TEST_F(AddonDatabaseTest, TestFindByNonExistingId)
   EXPECT_TRUE(database.FindByAddonId("does.not.exist", addons));
   EXPECT_EQ(0U, addons.size());
 }
+
+TEST_F(AddonDatabaseTest, TestUpdateRepositoryContentKeepsUnchanged)
+{
+  std::vector<AddonInfoPtr> content;
+  CreateAddon(content, "foo.bar", "1.0.0");
+  CreateAddon(content, "foo.qux", "2.0.0");
+  EXPECT_TRUE(
+      database.UpdateRepositoryContent("repository.a", CAddonVersion("1.0.0"), "test2", content));
+
+  VECADDONS addons;
+  EXPECT_TRUE(database.FindByAddonId("foo.bar", addons));
+  EXPECT_EQ(1U, addons.size());
+  addons.clear();
+  EXPECT_TRUE(database.FindByAddonId("foo.qux", addons));
+  EXPECT_EQ(1U, addons.size());
+
+  content.clear();
+  CreateAddon(content, "foo.qux", "2.0.1");
+  EXPECT_TRUE(
+      database.UpdateRepositoryContent("repository.a", CAddonVersion("1.0.0"), "test3", content));
+
+  addons.clear();
+  EXPECT_TRUE(database.FindByAddonId("foo.bar", addons));
+  EXPECT_EQ(0U, addons.size());
+  addons.clear();
+  EXPECT_TRUE(database.FindByAddonId("foo.qux", addons));
+  ASSERT_EQ(1U, addons.size());
+  EXPECT_EQ(addons.at(0)->Version().asString(), "2.0.1");
+
+  // the other repository is left alone
+  addons.clear();
+  EXPECT_TRUE(database.FindByAddonId("foo.baz", addons));
+  EXPECT_EQ(1U, addons.size());
+}
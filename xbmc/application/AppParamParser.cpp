@@ -41,6 +41,8 @@ Arguments:
   --debug               Enable debug logging
   --version             Print version information
   --test                Enable test mode. [FILE] required.
+  --benchmark=<filename> Test mode writing a report of the playback performance to the
+                        specified file. [FILE] required.
   --settings=<filename> Loads specified file after advancedsettings.xml replacing any settings specified
                         specified file must exist in special://xbmc/system/
 )""";
@@ -67,7 +69,10 @@ void CAppParamParser::Parse(const char* const* argv, int nArgs)
   {
     // testmode is only valid if at least one item to play was given
     if (m_params->GetPlaylist().IsEmpty())
+    {
       m_params->SetTestMode(false);
+      m_params->SetBenchmarkReport("");
+    }
   }
 
   // Record raw parameters
@@ -108,6 +113,11 @@ void CAppParamParser::ParseArg(const std::string &arg)
     m_params->SetLogLevel(LOG_LEVEL_DEBUG);
   else if (arg == "--test")
     m_params->SetTestMode(true);
+  else if (arg.substr(0, 12) == "--benchmark=")
+  {
+    m_params->SetTestMode(true);
+    m_params->SetBenchmarkReport(arg.substr(12));
+  }
   else if (arg.substr(0, 11) == "--settings=")
     m_params->SetSettingsFile(arg.substr(11));
   else if (!arg.empty() && arg[0] != '-')
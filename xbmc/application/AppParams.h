@@ -41,6 +41,12 @@ public:
   bool IsTestMode() const { return m_testmode; }
   void SetTestMode(bool testMode) { m_testmode = testMode; }
 
+  const std::string& GetBenchmarkReport() const { return m_benchmarkReport; }
+  void SetBenchmarkReport(const std::string& benchmarkReport)
+  {
+    m_benchmarkReport = benchmarkReport;
+  }
+
   const std::string& GetSettingsFile() const { return m_settingsFile; }
   void SetSettingsFile(const std::string& settingsFile) { m_settingsFile = settingsFile; }
 
@@ -86,6 +92,7 @@ private:
   bool m_testmode{false};
 
   std::string m_settingsFile;
+  std::string m_benchmarkReport;
   std::string m_windowing;
   std::string m_logTarget;
   std::string m_audioBackend;
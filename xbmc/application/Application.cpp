@@ -49,6 +49,7 @@
 #include "application/ApplicationVolumeHandling.h"
 #include "cores/AudioEngine/Engines/ActiveAE/ActiveAE.h"
 #include "cores/FFmpeg.h"
+#include "cores/VideoPlayer/PlaybackBenchmark.h"
 #include "cores/playercorefactory/PlayerCoreFactory.h"
 #include "dialogs/GUIDialogBusy.h"
 #include "dialogs/GUIDialogCache.h"
@@ -66,6 +67,7 @@
 #include "music/MusicFileItemClassify.h"
 #include "network/DNSNameCache.h"
 #include "network/NetworkFileItemClassify.h"
+#include "network/PlaybackSync.h"
 #include "playlists/PlayListFileItemClassify.h"
 #include "video/VideoFileItemClassify.h"
 #ifdef HAS_FILESYSTEM_NFS
@@ -77,6 +79,7 @@
 #include "guilib/GUIComponent.h"
 #include "guilib/GUIControlProfiler.h"
 #include "guilib/GUIFontManager.h"
+#include "guilib/GUIFrameStats.h"
 #include "guilib/GUIWindowManager.h"
 #include "guilib/LocalizeStrings.h"
 #include "guilib/StereoscopicsManager.h"
@@ -130,14 +133,17 @@
 #include "settings/lib/Setting.h"
 #include "speech/ISpeechRecognition.h"
 #include "storage/MediaManager.h"
+#include "threads/ThreadPolicy.h"
 #include "utils/AlarmClock.h"
 #include "utils/CPUInfo.h"
 #include "utils/CharsetConverter.h"
 #include "utils/ContentUtils.h"
 #include "utils/FileExtensionProvider.h"
 #include "utils/LangCodeExpander.h"
+#include "utils/MemoryBudget.h"
 #include "utils/PlayerUtils.h"
 #include "utils/RegExp.h"
+#include "utils/SaveFileStateJob.h"
 #include "utils/Screenshot.h"
 #include "utils/StringUtils.h"
 #include "utils/SystemInfo.h"
@@ -261,6 +267,8 @@ bool CApplication::Create()
   RegisterSettings();
 
   CServiceBroker::RegisterCPUInfo(CCPUInfo::GetCPUInfo());
+  const auto cpuInfo = CServiceBroker::GetCPUInfo();
+  CThreadPolicy::SetTopology(cpuInfo->GetCPUCount(), cpuInfo->GetPerformanceCores());
 
   // Register JobManager service
   CServiceBroker::RegisterJobManager(std::make_shared<CJobManager>());
@@ -323,6 +331,8 @@ bool CApplication::Create()
   if (!settingsComponent->Load())
     return false;
 
+  CThreadPolicy::Log();
+
   // Log Cache GUI settings (replacement of cache in advancedsettings.xml)
   const auto settings = settingsComponent->GetSettings();
   const float readFactor = settings->GetInt(CSettings::SETTING_FILECACHE_READFACTOR) / 100.0f;
@@ -356,6 +366,7 @@ bool CApplication::Create()
 #ifdef HAVE_LIBBLURAY
   CServiceBroker::RegisterBlurayDiscCache(std::make_shared<CBlurayDiscCache>());
 #endif
+  CServiceBroker::RegisterPlaybackSync(std::make_shared<CPlaybackSync>());
 
   if (!m_ServiceManager->InitStageTwo(
           settingsComponent->GetProfileManager()->GetProfileUserDataFolder()))
@@ -888,8 +899,12 @@ void CApplication::Render()
     infoMgr.GetInfoProviders().GetSystemInfoProvider().UpdateFPS();
   }
 
-  CServiceBroker::GetWinSystem()->GetGfxContext().Flip(hasRendered,
-                                                       appPlayer->IsRenderingVideoLayer());
+  {
+    CGUIFrameStatsTimer frameStats(CGUIFrameStats::Phase::PRESENT);
+    CServiceBroker::GetWinSystem()->GetGfxContext().Flip(hasRendered,
+                                                         appPlayer->IsRenderingVideoLayer());
+  }
+  CGUIFrameStats::GetInstance().EndFrame();
 
   CTimeUtils::UpdateFrameTime(hasRendered);
 }
@@ -919,6 +934,12 @@ bool CApplication::OnAction(const CAction &action)
     return true;
   }
 
+  if (action.GetID() == ACTION_TOGGLE_FRAME_STATS)
+  {
+    CGUIFrameStats::GetInstance().Toggle();
+    return true;
+  }
+
   if (action.IsMouse())
     CServiceBroker::GetInputManager().SetMouseActive(true);
 
@@ -1522,6 +1543,9 @@ void CApplication::FrameMove(bool processEvents, bool processGUI)
       m_skipGuiRender = true;
     */
 
+    if (ThrottleIdleRender())
+      m_skipGuiRender = true;
+
     if (CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiSmartRedraw && m_guiRefreshTimer.IsTimePast())
     {
       CServiceBroker::GetGUI()->GetWindowManager().SendMessage(GUI_MSG_REFRESH_TIMER, 0, 0);
@@ -1543,6 +1567,37 @@ void CApplication::FrameMove(bool processEvents, bool processGUI)
 }
 
 
+bool CApplication::ThrottleIdleRender()
+{
+  const auto& advancedSettings = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+  const int fps = advancedSettings->m_guiIdleRenderFps;
+  m_guiRenderThrottled = false;
+  if (fps <= 0)
+    return false;
+
+  // a window or dialog opening by itself (e.g. a notification) gets the full rate for a while too
+  const int window = CServiceBroker::GetGUI()->GetWindowManager().GetActiveWindowOrDialog();
+  if (window != m_lastActiveWindow || !m_guiActivityTimer.IsRunning())
+  {
+    m_lastActiveWindow = window;
+    m_guiActivityTimer.StartZero();
+  }
+
+  const auto appPlayer = GetComponent<CApplicationPlayer>();
+  const auto appPower = GetComponent<CApplicationPowerHandling>();
+  const float idleTime = std::min(static_cast<float>(appPower->GlobalIdleTime()),
+                                  m_guiActivityTimer.GetElapsedSeconds());
+
+  // playback and screensavers are meant to move
+  if (appPlayer->IsPlaying() || appPower->IsInScreenSaver() ||
+      idleTime < advancedSettings->m_guiIdleRenderDelay)
+    return false;
+
+  m_guiRenderThrottled = true;
+  const auto frameTime = std::chrono::milliseconds(1000 / fps);
+  return std::chrono::steady_clock::now() - m_lastRenderTime < frameTime;
+}
+
 void CApplication::ResetCurrentItem()
 {
   m_itemCurrentFile = std::make_unique<CFileItem>();
@@ -1561,6 +1616,9 @@ int CApplication::Run()
   CFileItemList& playlist = CServiceBroker::GetAppParams()->GetPlaylist();
   if (playlist.Size() > 0)
   {
+    if (!CServiceBroker::GetAppParams()->GetBenchmarkReport().empty())
+      CPlaybackBenchmark::SetEnabled(true);
+
     CServiceBroker::GetPlaylistPlayer().Add(PLAYLIST::Id::TYPE_MUSIC, playlist);
     CServiceBroker::GetPlaylistPlayer().SetCurrentPlaylist(PLAYLIST::Id::TYPE_MUSIC);
     CServiceBroker::GetAppMessenger()->PostMsg(TMSG_PLAYLISTPLAYER_PLAY, -1);
@@ -1612,6 +1670,7 @@ bool CApplication::Cleanup()
 #ifdef HAVE_LIBBLURAY
     CServiceBroker::UnregisterBlurayDiscCache();
 #endif
+    CServiceBroker::UnregisterPlaybackSync();
 
     CServiceBroker::UnregisterSpeechRecognition();
 
@@ -1736,6 +1795,9 @@ bool CApplication::Stop(int exitCode)
   const auto appPlayer = GetComponent<CApplicationPlayer>();
   appPlayer->ClosePlayer();
 
+  CLog::Log(LOGINFO, "Storing file states");
+  CSaveFileState::Flush();
+
   {
     // close inbound port
     CServiceBroker::UnregisterAppPort();
@@ -1982,6 +2044,9 @@ bool CApplication::PlayFile(CFileItem item, const std::string& player, bool bRes
   const auto appPlayer{GetComponent<CApplicationPlayer>()};
   const auto stackHelper{GetComponent<CApplicationStackHelper>()};
 
+  // the resume point and play count of the item may still be on their way to the database
+  CSaveFileState::Flush();
+
   if (!bRestart)
   {
     appPlayer->SetPlaySpeed(1);
@@ -2108,7 +2173,12 @@ void CApplication::PlaybackCleanup()
   }
 
   if (CServiceBroker::GetAppParams()->IsTestMode())
+  {
+    const std::string& report = CServiceBroker::GetAppParams()->GetBenchmarkReport();
+    if (!report.empty())
+      CPlaybackBenchmark::WriteReport(report);
     CServiceBroker::GetAppMessenger()->PostMsg(TMSG_QUIT);
+  }
 }
 
 bool CApplication::IsPlayingFullScreenVideo() const
@@ -2383,6 +2453,8 @@ void CApplication::ProcessSlow()
 
   CServiceBroker::GetGUI()->GetTextureManager().FreeUnusedTextures(5000);
 
+  CMemoryBudget::Process();
+
 #ifdef HAS_OPTICAL_DRIVE
   // checks whats in the DVD drive and tries to autostart the content (xbox games, dvd, cdda, avi files...)
   if (!appPlayer->IsPlayingVideo())
@@ -109,6 +109,11 @@ public:
   void DoneInitializing() { m_bInitializing = false; }
   bool IsStopping() const { return m_bStop; }
 
+  /*!
+   \brief Whether the GUI is idle and rendered at the reduced rate of <gui><idlerenderfps>.
+   */
+  bool IsGuiRenderThrottled() const { return m_guiRenderThrottled; }
+
   bool CreateGUI();
   bool InitWindow(RESOLUTION res = RES_INVALID);
 
@@ -223,6 +228,11 @@ protected:
   std::chrono::time_point<std::chrono::steady_clock> m_lastRenderTime;
   bool m_skipGuiRender = false;
 
+  bool ThrottleIdleRender();
+  int m_lastActiveWindow = 0;
+  CStopWatch m_guiActivityTimer;
+  bool m_guiRenderThrottled = false;
+
   std::unique_ptr<MUSIC_INFO::CMusicInfoScanner> m_musicInfoScanner;
 
   bool PlayStack(CFileItem& item, bool bRestart);
@@ -528,6 +528,13 @@ bool CApplicationMessageHandling::OnMessage(const CGUIMessage& message)
 
     case GUI_MSG_QUEUE_NEXT_ITEM:
     {
+      // the next part of a stack follows the current one in any case, let the player preload it
+      const auto stackHelper = m_app.GetComponent<CApplicationStackHelper>();
+      if (stackHelper->IsPlayingRegularStack() && stackHelper->HasNextStackPartFileItem() &&
+          m_app.GetComponent<CApplicationPlayer>()->PreloadNextFile(
+              stackHelper->GetNextStackPartFileItem()))
+        return true;
+
       // Check to see if our playlist player has a new item for us,
       // and if so, we check whether our current player wants the file
       int iNext = CServiceBroker::GetPlaylistPlayer().GetNextItemIdx();
@@ -569,6 +576,10 @@ bool CApplicationMessageHandling::OnMessage(const CGUIMessage& message)
       }
 #endif
 
+      // players that only preload the file get it started as usual once the current one has ended
+      if (appPlayer->PreloadNextFile(file))
+        return true;
+
       // ok - send the file to the player, if it accepts it
       if (appPlayer->QueueNextFile(file))
       {
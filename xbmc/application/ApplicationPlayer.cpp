@@ -570,6 +570,12 @@ bool CApplicationPlayer::QueueNextFile(const CFileItem &file)
   return (player && player->QueueNextFile(file));
 }
 
+bool CApplicationPlayer::PreloadNextFile(const CFileItem& file)
+{
+  std::shared_ptr<IPlayer> player = GetInternal();
+  return (player && player->PreloadNextFile(file));
+}
+
 bool CApplicationPlayer::SetPlayerState(const std::string& state)
 {
   std::shared_ptr<IPlayer> player = GetInternal();
@@ -262,7 +262,7 @@ void CApplicationPlayerCallback::OnPlayerCloseFile(const CFileItem& file,
           ->GetCurrentProfile()
           .canWriteDatabases())
   {
-    CSaveFileState::DoWork(fileItem, bookmark, UpdatePlayCount(fileItem, bookmark));
+    CSaveFileState::Queue(fileItem, bookmark, UpdatePlayCount(fileItem, bookmark));
   }
 }
 
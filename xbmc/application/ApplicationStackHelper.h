@@ -61,6 +61,14 @@ public:
   */
   bool HasNextStackPartFileItem() const;
 
+  /*!
+  \brief returns the next stack part, HasNextStackPartFileItem() must be true
+  */
+  const CFileItem& GetNextStackPartFileItem() const
+  {
+    return GetStackPartFileItem(m_currentStackPosition + 1);
+  }
+
   /*!
   \brief sets the next stack part as the current and returns a reference to it
   */
@@ -31,6 +31,10 @@
 #include "utils/SystemInfo.h"
 #include "utils/log.h"
 
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
 #if defined(TARGET_WINDOWS)
 #include "platform/win32/CharsetConverter.h"
 #endif
@@ -41,6 +45,87 @@ using namespace XFILE;
 using namespace KODI;
 using namespace KODI::CDRIP;
 
+namespace
+{
+constexpr size_t CHUNK_SIZE = 1024;
+
+/*!
+ \brief Memory shared by the jobs for tracks read into memory at full drive speed, so the next job
+ can read while this one encodes. Sized by the audio/ripbuffersize advanced setting, 128MB holds
+ about 12 minutes of CD audio. A track not fitting in what's left is encoded while reading, as
+ before.
+ */
+class CReadBuffer
+{
+public:
+  explicit CReadBuffer(int64_t size)
+  {
+    const auto settings = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+    const int64_t limit = static_cast<int64_t>(settings->m_cddaRipBufferSize) * 1024 * 1024;
+
+    std::unique_lock lock(m_mutex);
+    if (size > 0 && m_used + size <= limit)
+    {
+      m_used += size;
+      m_size = size;
+    }
+  }
+  ~CReadBuffer() { Release(); }
+
+  bool IsReserved() const { return m_size > 0; }
+
+  void Release()
+  {
+    std::unique_lock lock(m_mutex);
+    m_used -= m_size;
+    m_size = 0;
+  }
+
+private:
+  static inline std::mutex m_mutex;
+  static inline int64_t m_used{0};
+
+  int64_t m_size{0};
+};
+
+/*!
+ \brief Gives the drive to one job at a time, in the order the jobs asked for it, so the tracks
+ are still read one after the other while several of them are encoded.
+ */
+class CDriveLock
+{
+public:
+  CDriveLock()
+  {
+    std::unique_lock lock(m_mutex);
+    m_ticket = m_nextTicket++;
+    m_condition.wait(lock, [this] { return m_ticket == m_serving; });
+  }
+  ~CDriveLock() { Release(); }
+
+  void Release()
+  {
+    if (m_released)
+      return;
+    m_released = true;
+    {
+      std::unique_lock lock(m_mutex);
+      m_serving++;
+    }
+    m_condition.notify_all();
+  }
+
+private:
+  static inline std::mutex m_mutex;
+  static inline std::condition_variable m_condition;
+  static inline unsigned int m_nextTicket{0};
+  static inline unsigned int m_serving{0};
+
+  unsigned int m_ticket;
+  bool m_released{false};
+};
+} // namespace
+
 CCDDARipJob::CCDDARipJob(const std::string& input,
                          const std::string& output,
                          const CMusicInfoTag& tag,
@@ -77,6 +162,9 @@ bool CCDDARipJob::DoWork()
     return false;
   }
 
+  // wait for the drive, the jobs before this one may still be reading theirs
+  CDriveLock drive;
+
   // init ripper
   CFile reader;
   std::unique_ptr<CEncoder> encoder{};
@@ -98,24 +186,45 @@ bool CCDDARipJob::DoWork()
   handle->SetText(strLine0);
 
   // start ripping
-  int percent = 0;
-  int oldpercent = 0;
   bool cancelled{false};
   int result{-1};
-  while (!cancelled && (result = RipChunk(reader, encoder, percent)) == 0)
+  CReadBuffer readBuffer(reader.GetLength());
+  if (readBuffer.IsReserved())
   {
-    cancelled = ShouldCancel(percent, 100);
-    if (percent > oldpercent)
+    std::vector<uint8_t> buffer;
+    result = ReadTrack(reader, buffer, *handle, cancelled);
+    reader.Close();
+    if (m_eject && result == 2)
+      Eject();
+    drive.Release();
+
+    if (result == 2)
+      result = EncodeBuffer(buffer, encoder, *handle, cancelled);
+    buffer = {};
+    readBuffer.Release();
+  }
+  else
+  {
+    int percent = 0;
+    int oldpercent = 0;
+    while (!cancelled && (result = RipChunk(reader, encoder, percent)) == 0)
     {
-      oldpercent = percent;
-      handle->SetPercentage(static_cast<float>(percent));
+      cancelled = ShouldCancel(percent, 100);
+      if (percent > oldpercent)
+      {
+        oldpercent = percent;
+        handle->SetPercentage(static_cast<float>(percent));
+      }
     }
+    reader.Close();
+    if (m_eject && !cancelled && result == 2)
+      Eject();
   }
 
   // close encoder ripper
   encoder->EncoderClose();
   encoder.reset();
-  reader.Close();
+  drive.Release();
 
   if (NETWORK::IsRemote(file) && !cancelled && result == 2)
   {
@@ -140,18 +249,72 @@ bool CCDDARipJob::DoWork()
   else if (result < 0)
     CLog::LogF(LOGERROR, "Error encoding {}", m_input);
   else
-  {
     CLog::Log(LOGINFO, "CCDDARipJob: Finished ripping {}", m_input);
-    if (m_eject)
+
+  handle->MarkFinished();
+
+  return !cancelled && result == 2;
+}
+
+int CCDDARipJob::ReadTrack(CFile& reader,
+                           std::vector<uint8_t>& buffer,
+                           CGUIDialogProgressBarHandle& handle,
+                           bool& cancelled)
+{
+  const int64_t length = reader.GetLength();
+  buffer.resize(static_cast<size_t>(length));
+
+  // reading is the first half of the progress, encoding the second
+  int oldpercent = 0;
+  size_t position = 0;
+  while (position < buffer.size())
+  {
+    const ssize_t read =
+        reader.Read(buffer.data() + position, std::min(CHUNK_SIZE, buffer.size() - position));
+    if (read <= 0)
+      return 1;
+    position += static_cast<size_t>(read);
+
+    const int percent = static_cast<int>(position * 50 / buffer.size());
+    if ((cancelled = ShouldCancel(percent, 100)))
+      return 1;
+    if (percent > oldpercent)
     {
-      CLog::Log(LOGINFO, "CCDDARipJob: Ejecting CD");
-      CServiceBroker::GetMediaManager().EjectTray();
+      oldpercent = percent;
+      handle.SetPercentage(static_cast<float>(percent));
     }
   }
+  return 2;
+}
 
-  handle->MarkFinished();
+int CCDDARipJob::EncodeBuffer(std::vector<uint8_t>& buffer,
+                              const std::unique_ptr<CEncoder>& encoder,
+                              CGUIDialogProgressBarHandle& handle,
+                              bool& cancelled)
+{
+  int oldpercent = 50;
+  for (size_t position = 0; position < buffer.size(); position += CHUNK_SIZE)
+  {
+    if (!encoder->EncoderEncode(buffer.data() + position,
+                                std::min(CHUNK_SIZE, buffer.size() - position)))
+      return -1;
 
-  return !cancelled && result == 2;
+    const int percent = 50 + static_cast<int>(position * 50 / buffer.size());
+    if ((cancelled = ShouldCancel(percent, 100)))
+      return 1;
+    if (percent > oldpercent)
+    {
+      oldpercent = percent;
+      handle.SetPercentage(static_cast<float>(percent));
+    }
+  }
+  return 2;
+}
+
+void CCDDARipJob::Eject()
+{
+  CLog::Log(LOGINFO, "CCDDARipJob: Ejecting CD");
+  CServiceBroker::GetMediaManager().EjectTray();
 }
 
 int CCDDARipJob::RipChunk(CFile& reader, const std::unique_ptr<CEncoder>& encoder, int& percent)
@@ -11,6 +11,11 @@
 #include "jobs/Job.h"
 #include "music/tags/MusicInfoTag.h"
 
+#include <stdint.h>
+#include <vector>
+
+class CGUIDialogProgressBarHandle;
+
 namespace XFILE
 {
 class CFile;
@@ -78,6 +83,28 @@ protected:
    */
   int RipChunk(XFILE::CFile& reader, const std::unique_ptr<CEncoder>& encoder, int& percent);
 
+  /*!
+   * \brief Read the whole track into memory, as fast as the drive allows
+   *
+   * \return 2 if the track was read, 1 if reading failed or was cancelled
+   */
+  int ReadTrack(XFILE::CFile& reader,
+                std::vector<uint8_t>& buffer,
+                CGUIDialogProgressBarHandle& handle,
+                bool& cancelled);
+
+  /*!
+   * \brief Encode a track read by ReadTrack()
+   *
+   * \return 2 if the track was encoded, 1 if cancelled, -1 if the encoder failed
+   */
+  int EncodeBuffer(std::vector<uint8_t>& buffer,
+                   const std::unique_ptr<CEncoder>& encoder,
+                   CGUIDialogProgressBarHandle& handle,
+                   bool& cancelled);
+
+  void Eject();
+
   unsigned int m_rate; //< The sample rate of the input file
   unsigned int m_channels; //< The number of channels in input file
   unsigned int m_bps; //< The bits per sample of input
@@ -39,19 +39,30 @@
 #include "utils/Variant.h"
 #include "utils/log.h"
 
+#include <algorithm>
+#include <mutex>
+#include <thread>
+
 using namespace ADDON;
 using namespace XFILE;
 using namespace MUSIC_INFO;
 using namespace KODI::MESSAGING;
 using namespace KODI::CDRIP;
 
+namespace
+{
+constexpr unsigned int MAX_ENCODERS = 4;
+} // namespace
+
 CCDDARipper& CCDDARipper::GetInstance()
 {
   static CCDDARipper sRipper;
   return sRipper;
 }
 
-CCDDARipper::CCDDARipper() : CJobQueue(false, 1) //enforce fifo and non-parallel processing
+// The jobs take turns reading from the drive, see CCDDARipJob, but encode in parallel
+CCDDARipper::CCDDARipper()
+  : CJobQueue(false, std::clamp(std::thread::hardware_concurrency(), 1u, MAX_ENCODERS))
 {
 }
 
@@ -76,9 +87,9 @@ bool CCDDARipper::RipTrack(CFileItem* pItem)
   std::string strFile = URIUtils::AddFileToFolder(
       strDirectory, CUtil::MakeLegalFileName(GetTrackName(pItem), legalType));
 
-  AddJob(new CCDDARipJob(pItem->GetPath(), strFile, *pItem->GetMusicInfoTag(),
-                         CServiceBroker::GetSettingsComponent()->GetSettings()->GetInt(
-                             CSettings::SETTING_AUDIOCDS_ENCODER)));
+  AddRipJob(new CCDDARipJob(pItem->GetPath(), strFile, *pItem->GetMusicInfoTag(),
+                            CServiceBroker::GetSettingsComponent()->GetSettings()->GetInt(
+                                CSettings::SETTING_AUDIOCDS_ENCODER)));
 
   return true;
 }
@@ -134,8 +145,8 @@ bool CCDDARipper::RipCD()
 
     bool eject =
         settings->GetBool(CSettings::SETTING_AUDIOCDS_EJECTONRIP) && i == vecItems.Size() - 1;
-    AddJob(new CCDDARipJob(item->GetPath(), strFile, *item->GetMusicInfoTag(),
-                           settings->GetInt(CSettings::SETTING_AUDIOCDS_ENCODER), eject));
+    AddRipJob(new CCDDARipJob(item->GetPath(), strFile, *item->GetMusicInfoTag(),
+                              settings->GetInt(CSettings::SETTING_AUDIOCDS_ENCODER), eject));
   }
 
   return true;
@@ -298,11 +309,25 @@ std::string CCDDARipper::GetTrackName(CFileItem* item)
   return track;
 }
 
+void CCDDARipper::AddRipJob(CCDDARipJob* job)
+{
+  std::unique_lock lock(m_pendingSection);
+  if (AddJob(job))
+    m_pendingJobs++;
+}
+
 void CCDDARipper::OnJobComplete(unsigned int jobID, bool success, CJob* job)
 {
   if (success)
   {
-    if (CJobQueue::QueueEmpty())
+    bool finished;
+    {
+      std::unique_lock lock(m_pendingSection);
+      finished = --m_pendingJobs == 0;
+    }
+
+    // with tracks encoded in parallel, an empty queue doesn't mean all of them are written yet
+    if (finished)
     {
       std::string dir = URIUtils::GetDirectory(static_cast<CCDDARipJob*>(job)->GetOutput());
       bool unimportant;
@@ -321,5 +346,19 @@ void CCDDARipper::OnJobComplete(unsigned int jobID, bool success, CJob* job)
     return CJobQueue::OnJobComplete(jobID, success, job);
   }
 
+  {
+    std::unique_lock lock(m_pendingSection);
+    m_pendingJobs = 0;
+  }
   CancelJobs();
 }
+
+void CCDDARipper::OnJobAbort(unsigned int jobID, CJob* job)
+{
+  {
+    std::unique_lock lock(m_pendingSection);
+    if (m_pendingJobs > 0)
+      m_pendingJobs--;
+  }
+  CJobQueue::OnJobAbort(jobID, job);
+}
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "jobs/JobQueue.h"
+#include "threads/CriticalSection.h"
 
 #include <string>
 
@@ -25,6 +26,8 @@ namespace KODI
 namespace CDRIP
 {
 
+class CCDDARipJob;
+
 /*!
  * \brief Rip an entire CD or a single track
  *
@@ -62,6 +65,7 @@ public:
   bool RipCD();
 
   void OnJobComplete(unsigned int jobID, bool success, CJob* job) override;
+  void OnJobAbort(unsigned int jobID, CJob* job) override;
 
 private:
   // private construction and no assignments
@@ -97,6 +101,14 @@ private:
    * \return track file name
    */
   std::string GetTrackName(CFileItem* item);
+
+  /*!
+   * \brief Queue a rip job and count it until it completes
+   */
+  void AddRipJob(CCDDARipJob* job);
+
+  CCriticalSection m_pendingSection;
+  unsigned int m_pendingJobs{0}; //!< jobs queued or running, as several of them run at once
 };
 
 } /* namespace CDRIP */
@@ -250,5 +250,17 @@ namespace XbmcCommons
 
   };
 
+  /**
+   * A Buffer over memory owned by the caller which is to be written into,
+   *  like the memory of a bytearray passed in from a script. It is a separate
+   *  type so the language bindings pass such memory through directly rather
+   *  than copying it into a Buffer of its own.
+   */
+  class WritableBuffer : public Buffer
+  {
+  public:
+    using Buffer::Buffer;
+  };
+
 }
 
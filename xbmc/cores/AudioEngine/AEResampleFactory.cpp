@@ -17,4 +17,15 @@ std::unique_ptr<IAEResample> CAEResampleFactory::Create(uint32_t flags /* = 0 */
   return std::make_unique<CActiveAEResampleFFMPEG>();
 }
 
+bool CAEResampleFactory::SupportsQualityLevel(AEQuality level)
+{
+  if (level == AE_QUALITY_LOW || level == AE_QUALITY_MID || level == AE_QUALITY_HIGH)
+    return true;
+
+  if (level == AE_QUALITY_REALLYHIGH)
+    return CActiveAEResampleFFMPEG::SupportsSoxr();
+
+  return false;
+}
+
 }
@@ -28,6 +28,7 @@ class CAEResampleFactory
 {
 public:
   static std::unique_ptr<IAEResample> Create(uint32_t flags = 0U);
+  static bool SupportsQualityLevel(AEQuality level);
 };
 
 }
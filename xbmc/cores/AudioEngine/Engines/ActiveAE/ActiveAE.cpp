@@ -20,6 +20,7 @@
 #include "cores/AudioEngine/Utils/AEUtil.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
+#include "utils/Trace.h"
 #include "utils/log.h"
 #include "windowing/WinSystem.h"
 
@@ -36,6 +37,7 @@ namespace
 constexpr float MAX_CACHE_LEVEL = 0.4f; // total cache time of stream in seconds;
 constexpr float MAX_WATER_LEVEL = 0.2f; // buffered time after stream stages in seconds;
 constexpr double MAX_BUFFER_TIME = 0.1; // max time of a buffer in seconds;
+constexpr size_t MAX_SOUND_VOICES = 16; // gui sounds mixed at the same time
 } // unnamed namespace
 
 void CEngineStats::Reset(unsigned int sampleRate, bool pcm)
@@ -275,6 +277,8 @@ CActiveAE::CActiveAE() :
   m_aeGUISoundForce = false;
   m_stats.Reset(44100, true);
   m_streamIdGen = 0;
+  // the voices are never reallocated, playing a sound doesn't allocate
+  m_sounds_playing.reserve(MAX_SOUND_VOICES);
 
   m_settingsHandler = std::make_unique<CActiveAESettings>(*this);
 }
@@ -387,7 +391,9 @@ void CActiveAE::StateMachine(int signal, Protocol *port, Message *msg)
           if (sound)
           {
             m_sounds.push_back(sound);
-            ResampleSounds();
+            // convert right away, so playing it needs no resampler
+            if (IsGUISoundEnabled())
+              ResampleSound(sound);
           }
           return;
         case CActiveAEDataProtocol::FREESTREAM:
@@ -759,7 +765,15 @@ void CActiveAE::StateMachine(int signal, Protocol *port, Message *msg)
               return;
 
             SoundState st = {sound, 0};
-            m_sounds_playing.push_back(st);
+            if (m_sounds_playing.size() < MAX_SOUND_VOICES)
+              m_sounds_playing.push_back(st);
+            else
+            {
+              // all voices are busy, take the one which played the longest
+              *std::max_element(m_sounds_playing.begin(), m_sounds_playing.end(),
+                                [](const SoundState& a, const SoundState& b)
+                                { return a.samples_played < b.samples_played; }) = st;
+            }
             m_extTimeout = 0ms;
             m_state = AE_TOP_CONFIGURED_PLAY;
           }
@@ -1165,9 +1179,30 @@ AEAudioFormat CActiveAE::GetInputFormat(AEAudioFormat *desiredFmt)
     m_inputFormat = inputFormat;
   }
 
+  inputFormat.m_latencyProfile = GetLatencyProfile();
+
   return inputFormat;
 }
 
+AELatencyProfile CActiveAE::GetLatencyProfile() const
+{
+  // keep the sink as it is while idle, reopening it for nobody would only cause a gap
+  if (m_streams.empty())
+    return m_sinkFormat.m_latencyProfile;
+
+  // a single low latency stream wins, long buffers only if every stream can live with them
+  bool allHigh = true;
+  for (const auto* stream : m_streams)
+  {
+    if (stream->m_latencyProfile == AELatencyProfile::LOW)
+      return AELatencyProfile::LOW;
+    if (stream->m_latencyProfile != AELatencyProfile::HIGH)
+      allHigh = false;
+  }
+
+  return allHigh ? AELatencyProfile::HIGH : AELatencyProfile::NORMAL;
+}
+
 void CActiveAE::Configure(AEAudioFormat *desiredFmt)
 {
   bool initSink = false;
@@ -1188,6 +1223,7 @@ void CActiveAE::Configure(AEAudioFormat *desiredFmt)
 
   if ((!CompareFormat(m_sinkRequestFormat, m_sinkFormat) &&
        !CompareFormat(m_sinkRequestFormat, oldSinkRequestFormat)) ||
+      m_sinkRequestFormat.m_latencyProfile != m_sinkFormat.m_latencyProfile ||
       m_currDevice.compare(dev.name) != 0 || m_settings.driver.compare(dev.driver) != 0)
   {
     FlushEngine();
@@ -1440,10 +1476,11 @@ void CActiveAE::Configure(AEAudioFormat *desiredFmt)
        (m_settings.guisoundmode == AE_SOUND_IDLE && m_streams.empty()) ||
        m_aeGUISoundForce)
     {
-      std::vector<CActiveAESound*>::iterator it;
-      for (it = m_sounds.begin(); it != m_sounds.end(); ++it)
+      // convert all of them for the new format now rather than when they are played
+      for (CActiveAESound* sound : m_sounds)
       {
-        (*it)->SetConverted(false);
+        sound->SetConverted(false);
+        ResampleSound(sound);
       }
     }
     m_sounds_playing.clear();
@@ -1494,6 +1531,11 @@ CActiveAEStream* CActiveAE::CreateStream(MsgStreamNew *streamMsg)
   if (streamMsg->options & AESTREAM_FORCE_RESAMPLE)
     stream->m_forceResampler = true;
 
+  if (streamMsg->options & AESTREAM_LOW_LATENCY)
+    stream->m_latencyProfile = AELatencyProfile::LOW;
+  else if (streamMsg->options & AESTREAM_HIGH_LATENCY)
+    stream->m_latencyProfile = AELatencyProfile::HIGH;
+
   stream->m_pClock = streamMsg->clock;
 
   m_streams.push_back(stream);
@@ -1608,7 +1650,7 @@ void CActiveAE::ClearDiscardedBuffers()
 
 void CActiveAE::SStopSound(CActiveAESound *sound)
 {
-  std::list<SoundState>::iterator it;
+  std::vector<SoundState>::iterator it;
   for (it=m_sounds_playing.begin(); it!=m_sounds_playing.end(); ++it)
   {
     if (it->sound == sound)
@@ -1780,8 +1822,9 @@ bool CActiveAE::NeedReconfigureSink()
 
   const AESinkDevice dev = CAESinkFactory::ParseDevice(device);
 
-  return !CompareFormat(newFormat, m_sinkFormat) || m_currDevice.compare(dev.name) != 0 ||
-         m_settings.driver.compare(dev.driver) != 0;
+  return !CompareFormat(newFormat, m_sinkFormat) ||
+         newFormat.m_latencyProfile != m_sinkFormat.m_latencyProfile ||
+         m_currDevice.compare(dev.name) != 0 || m_settings.driver.compare(dev.driver) != 0;
 }
 
 bool CActiveAE::InitSink()
@@ -1891,6 +1934,7 @@ void CActiveAE::UnconfigureSink()
 
 bool CActiveAE::RunStages()
 {
+  CTraceZone zone("CActiveAE::RunStages");
   bool busy = false;
 
   // serve input streams
@@ -2118,15 +2162,7 @@ bool CActiveAE::RunStages()
 
               for(int j=0; j<out->pkt->planes; j++)
               {
-#if defined(HAVE_SSE) && defined(__SSE__)
-                CAEUtil::SSEMulArray((float*)out->pkt->data[j]+i*nb_floats, volume, nb_floats);
-#else
-                float* fbuffer = (float*) out->pkt->data[j]+i*nb_floats;
-                for (int k = 0; k < nb_floats; ++k)
-                {
-                  fbuffer[k] *= volume;
-                }
-#endif
+                CAEUtil::MulArray((float*)out->pkt->data[j]+i*nb_floats, volume, nb_floats);
               }
             }
           }
@@ -2187,24 +2223,9 @@ bool CActiveAE::RunStages()
               {
                 float *dst = (float*)out->pkt->data[j]+i*nb_floats;
                 float *src = (float*)mix->pkt->data[j]+i*nb_floats;
-#if defined(HAVE_SSE) && defined(__SSE__)
-                CAEUtil::SSEMulAddArray(dst, src, volume, nb_floats);
-                for (int k = 0; k < nb_floats; ++k)
-                {
-                  if (fabs(dst[k]) > 1.0f)
-                  {
-                    needClamp = true;
-                    break;
-                  }
-                }
-#else
-                for (int k = 0; k < nb_floats; ++k)
-                {
-                  dst[k] += src[k] * volume;
-                  if (fabs(dst[k]) > 1.0f)
-                    needClamp = true;
-                }
-#endif
+                CAEUtil::MulAddArray(dst, src, volume, nb_floats);
+                if (!needClamp && CAEUtil::PeakArray(dst, nb_floats) > 1.0f)
+                  needClamp = true;
               }
             }
             mix->Return();
@@ -2575,7 +2596,7 @@ void CActiveAE::MixSounds(CSoundPacket &dstSample)
   float *sample_buffer;
   int max_samples = dstSample.nb_samples;
 
-  std::list<SoundState>::iterator it;
+  std::vector<SoundState>::iterator it;
   for (it = m_sounds_playing.begin(); it != m_sounds_playing.end(); )
   {
     if (!it->sound->IsConverted())
@@ -2593,12 +2614,7 @@ void CActiveAE::MixSounds(CSoundPacket &dstSample)
       out = (float*)dstSample.data[j];
       sample_buffer = (float*)(it->sound->GetSound(false)->data[j]+start);
       int nb_floats = mix_samples * dstSample.config.channels / dstSample.planes;
-#if defined(HAVE_SSE) && defined(__SSE__)
-      CAEUtil::SSEMulAddArray(out, sample_buffer, volume, nb_floats);
-#else
-      for (int k = 0; k < nb_floats; ++k)
-        *out++ += *sample_buffer++ * volume;
-#endif
+      CAEUtil::MulAddArray(out, sample_buffer, volume, nb_floats);
     }
 
     it->samples_played += mix_samples;
@@ -2623,13 +2639,7 @@ void CActiveAE::Deamplify(CSoundPacket &dstSample)
     for(int j=0; j<dstSample.planes; j++)
     {
       float* buffer = reinterpret_cast<float*>(dstSample.data[j]);
-#if defined(HAVE_SSE) && defined(__SSE__)
-      CAEUtil::SSEMulArray(buffer, volume, nb_floats);
-#else
-      float *fbuffer = buffer;
-      for (int i = 0; i < nb_floats; i++)
-        *fbuffer++ *= volume;
-#endif
+      CAEUtil::MulArray(buffer, volume, nb_floats);
     }
   }
 }
@@ -2820,10 +2830,7 @@ bool CActiveAE::HasHDAudioChannelCount()
 
 bool CActiveAE::SupportsQualityLevel(enum AEQuality level)
 {
-  if (level == AE_QUALITY_LOW || level == AE_QUALITY_MID || level == AE_QUALITY_HIGH)
-    return true;
-
-  return false;
+  return CAEResampleFactory::SupportsQualityLevel(level);
 }
 
 bool CActiveAE::IsSettingVisible(const std::string &settingId)
@@ -3256,11 +3263,15 @@ void CActiveAE::StopSound(CActiveAESound *sound)
  * destination format is either format of stream or
  * default sink format when no stream is playing
  */
+bool CActiveAE::IsGUISoundEnabled() const
+{
+  return m_aeGUISoundForce || m_settings.guisoundmode == AE_SOUND_ALWAYS ||
+         (m_settings.guisoundmode == AE_SOUND_IDLE && m_streams.empty());
+}
+
 void CActiveAE::ResampleSounds()
 {
-  if ((m_settings.guisoundmode == AE_SOUND_OFF ||
-      (m_settings.guisoundmode == AE_SOUND_IDLE && !m_streams.empty())) &&
-      !m_aeGUISoundForce)
+  if (!IsGUISoundEnabled())
     return;
 
   std::vector<CActiveAESound*>::iterator it;
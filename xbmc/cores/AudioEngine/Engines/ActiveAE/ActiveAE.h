@@ -317,6 +317,7 @@ protected:
                              int* mode = NULL);
   void Configure(AEAudioFormat *desiredFmt = NULL);
   AEAudioFormat GetInputFormat(AEAudioFormat *desiredFmt = NULL);
+  AELatencyProfile GetLatencyProfile() const;
   CActiveAEStream* CreateStream(MsgStreamNew *streamMsg);
   void DiscardStream(CActiveAEStream *stream);
   void SFlushStream(CActiveAEStream *stream);
@@ -332,6 +333,7 @@ protected:
 
   void ResampleSounds();
   bool ResampleSound(CActiveAESound *sound);
+  bool IsGUISoundEnabled() const;
   void MixSounds(CSoundPacket &dstSample);
   void Deamplify(CSoundPacket &dstSample);
 
@@ -391,7 +393,7 @@ protected:
     CActiveAESound *sound;
     int samples_played;
   };
-  std::list<SoundState> m_sounds_playing;
+  std::vector<SoundState> m_sounds_playing; //!< fixed number of voices, see MAX_SOUND_VOICES
   std::vector<CActiveAESound*> m_sounds;
 
   float m_volume; // volume on a 0..1 scale corresponding to a proportion along the dB scale
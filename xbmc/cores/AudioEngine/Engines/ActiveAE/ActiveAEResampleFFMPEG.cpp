@@ -29,6 +29,28 @@ CActiveAEResampleFFMPEG::~CActiveAEResampleFFMPEG()
   swr_free(&m_pContext);
 }
 
+bool CActiveAEResampleFFMPEG::SupportsSoxr()
+{
+  static const bool supported = []()
+  {
+    AVChannelLayout layout = AV_CHANNEL_LAYOUT_MONO;
+    SwrContext* context = nullptr;
+    if (swr_alloc_set_opts2(&context, &layout, AV_SAMPLE_FMT_FLT, 48000, &layout,
+                            AV_SAMPLE_FMT_FLT, 44100, 0, nullptr) != 0)
+      return false;
+
+    // swr only fails at init time when the engine was not compiled in
+    av_opt_set_int(context, "resampler", SWR_ENGINE_SOXR, 0);
+    const bool ret = swr_init(context) >= 0;
+    swr_free(&context);
+
+    CLog::Log(LOGDEBUG, "CActiveAEResampleFFMPEG::SupportsSoxr - {}", ret ? "yes" : "no");
+    return ret;
+  }();
+
+  return supported;
+}
+
 bool CActiveAEResampleFFMPEG::Init(SampleConfig dstConfig,
                                    SampleConfig srcConfig,
                                    bool upmix,
@@ -153,7 +175,17 @@ bool CActiveAEResampleFFMPEG::Init(SampleConfig dstConfig,
     }
   }
 
-  if (quality == AE_QUALITY_HIGH)
+  if (quality == AE_QUALITY_REALLYHIGH && !SupportsSoxr())
+    quality = AE_QUALITY_HIGH;
+
+  if (quality == AE_QUALITY_REALLYHIGH)
+  {
+    // SoX resampler at its very high quality preset (28 bit precision)
+    av_opt_set_int(m_pContext, "resampler", SWR_ENGINE_SOXR, 0);
+    av_opt_set_double(m_pContext, "precision", 28.0, 0);
+    av_opt_set_int(m_pContext, "cheby", 1, 0);
+  }
+  else if (quality == AE_QUALITY_HIGH)
   {
     av_opt_set_double(m_pContext, "cutoff", 1.0, 0);
     av_opt_set_int(m_pContext, "filter_size", 256, 0);
@@ -44,6 +44,12 @@ public:
   int GetSrcBufferSize(int samples) override;
   int GetDstBufferSize(int samples) override;
 
+  /*!
+   * \brief Whether libswresample was built with the SoX resampler engine, which backs
+   * AE_QUALITY_REALLYHIGH
+   */
+  static bool SupportsSoxr();
+
 protected:
   bool m_loaded;
   bool m_doesResample;
@@ -45,7 +45,7 @@ void CActiveAESink::Start()
   if (!IsRunning())
   {
     Create();
-    SetPriority(ThreadPriority::ABOVE_NORMAL);
+    SetThreadClass(ThreadClass::AUDIO);
   }
 }
 
@@ -1036,12 +1036,15 @@ unsigned int CActiveAESink::OutputSamples(CSampleBuffer* samples)
       if (frames > 0)
       {
         m_packer->Reset();
-        m_packer->Pack(m_sinkFormat.m_streamInfo, buffer[0], frames);
+        // buffers from the pool are owned by us until returned, pack those without a copy
+        if (!samples->pool ||
+            !m_packer->PackInPlace(m_sinkFormat.m_streamInfo, buffer[0], frames))
+          m_packer->Pack(m_sinkFormat.m_streamInfo, buffer[0], frames);
       }
       else if (samples->pkt->pause_burst_ms > 0)
       {
         // construct a pause burst if we have already output valid audio
-        bool burst = m_extStreaming && (m_packer->GetBuffer()[0] != 0);
+        bool burst = m_extStreaming && m_packer->HasBurst();
         if (!m_packer->PackPause(m_sinkFormat.m_streamInfo, samples->pkt->pause_burst_ms, burst))
           skipSwap = true;
       }
@@ -240,6 +240,7 @@ protected:
   enum AVMatrixEncoding m_matrixEncoding;
   enum AVAudioServiceType m_audioServiceType;
   bool m_forceResampler;
+  AELatencyProfile m_latencyProfile = AELatencyProfile::NORMAL;
   IAEClockCallback *m_pClock;
   CSyncError m_syncError;
   double m_lastSyncError;
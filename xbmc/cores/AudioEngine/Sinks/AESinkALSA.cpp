@@ -500,6 +500,7 @@ bool CAESinkALSA::Initialize(AEAudioFormat &format, std::string &device)
   ALSAConfig inconfig, outconfig;
   inconfig.format = format.m_dataFormat;
   inconfig.sampleRate = format.m_sampleRate;
+  inconfig.latencyProfile = format.m_latencyProfile;
 
   /*
    * We can't use the better GetChannelLayout() at this point as the device
@@ -733,11 +734,24 @@ bool CAESinkALSA::InitializeHW(const ALSAConfig &inconfig, ALSAConfig &outconfig
   /*
    We want to make sure, that we have max 200 ms Buffer with
    a periodSize of approx 50 ms. Choosing a higher bufferSize
-   will cause problems with menu sounds. Buffer will be increased
-   after those are fixed.
+   will cause problems with menu sounds, so only go for 400 ms when
+   the streams asked for it. Low latency streams get 40 ms with
+   10 ms periods.
   */
-  periodSize  = std::min(periodSize, (snd_pcm_uframes_t) sampleRate / 20);
-  bufferSize  = std::min(bufferSize, (snd_pcm_uframes_t) sampleRate / 5);
+  snd_pcm_uframes_t periodTarget = sampleRate / 20;
+  snd_pcm_uframes_t bufferTarget = sampleRate / 5;
+  if (inconfig.latencyProfile == AELatencyProfile::LOW)
+  {
+    periodTarget = sampleRate / 100;
+    bufferTarget = sampleRate / 25;
+  }
+  else if (inconfig.latencyProfile == AELatencyProfile::HIGH)
+  {
+    periodTarget = sampleRate / 10;
+    bufferTarget = sampleRate * 2 / 5;
+  }
+  periodSize  = std::min(periodSize, periodTarget);
+  bufferSize  = std::min(bufferSize, bufferTarget);
 
   /*
    According to upstream we should set buffer size first - so make sure it is always at least
@@ -77,6 +77,7 @@ private:
     unsigned int frameSize;
     unsigned int channels;
     AEDataFormat format;
+    AELatencyProfile latencyProfile;
   };
 
   static snd_pcm_format_t AEFormatToALSAFormat(const enum AEDataFormat format);
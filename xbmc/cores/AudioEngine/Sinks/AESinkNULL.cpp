@@ -0,0 +1,129 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "AESinkNULL.h"
+
+#include "cores/AudioEngine/AESinkFactory.h"
+#include "utils/XTimeUtils.h"
+#include "utils/log.h"
+
+#include <algorithm>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+// period and buffer size of the simulated device
+constexpr auto PERIOD = 20ms;
+constexpr unsigned int PERIODS = 8;
+constexpr auto BUFFER = PERIOD * PERIODS;
+
+constexpr AEDataFormat DATA_FORMATS[] = {AE_FMT_FLOAT, AE_FMT_S32NE, AE_FMT_S16NE};
+constexpr unsigned int SAMPLE_RATES[] = {44100, 48000, 88200, 96000, 176400, 192000};
+constexpr AEChannel CHANNELS[] = {AE_CH_FL, AE_CH_FR, AE_CH_FC, AE_CH_LFE,
+                                  AE_CH_BL, AE_CH_BR, AE_CH_SL, AE_CH_SR};
+} // namespace
+
+void CAESinkNULL::Register()
+{
+  AE::AESinkRegEntry entry;
+  entry.sinkName = "NULL";
+  entry.createFunc = CAESinkNULL::Create;
+  entry.enumerateFunc = CAESinkNULL::EnumerateDevicesEx;
+  AE::CAESinkFactory::RegisterSink(entry);
+}
+
+std::unique_ptr<IAESink> CAESinkNULL::Create(std::string& device, AEAudioFormat& desiredFormat)
+{
+  auto sink = std::make_unique<CAESinkNULL>();
+  if (sink->Initialize(desiredFormat, device))
+    return sink;
+
+  return {};
+}
+
+void CAESinkNULL::EnumerateDevicesEx(AEDeviceInfoList& list, bool force)
+{
+  CAEDeviceInfo info;
+  info.m_deviceName = "null";
+  info.m_displayName = "Null output";
+  info.m_deviceType = AE_DEVTYPE_PCM;
+  info.m_wantsIECPassthrough = false;
+  info.m_onlyPCM = true;
+  for (AEChannel channel : CHANNELS)
+    info.m_channels += channel;
+  info.m_sampleRates.assign(std::begin(SAMPLE_RATES), std::end(SAMPLE_RATES));
+  info.m_dataFormats.assign(std::begin(DATA_FORMATS), std::end(DATA_FORMATS));
+  list.push_back(info);
+}
+
+bool CAESinkNULL::Initialize(AEAudioFormat& format, std::string& device)
+{
+  if (format.m_dataFormat == AE_FMT_RAW)
+  {
+    CLog::Log(LOGERROR, "CAESinkNULL::{} - passthrough is not supported", __FUNCTION__);
+    return false;
+  }
+
+  if (std::ranges::find(DATA_FORMATS, format.m_dataFormat) == std::end(DATA_FORMATS))
+    format.m_dataFormat = AE_FMT_FLOAT;
+  if (format.m_sampleRate == 0)
+    format.m_sampleRate = 48000;
+  format.m_frameSize =
+      format.m_channelLayout.Count() * (CAEUtil::DataFormatToBits(format.m_dataFormat) >> 3);
+  format.m_frames = format.m_sampleRate * PERIOD.count() / 1000;
+
+  m_format = format;
+  m_playedUntil = Clock::now();
+  return true;
+}
+
+void CAESinkNULL::Deinitialize()
+{
+}
+
+double CAESinkNULL::GetCacheTotal()
+{
+  return std::chrono::duration<double>(BUFFER).count();
+}
+
+void CAESinkNULL::GetDelay(AEDelayStatus& status)
+{
+  const auto buffered = std::max(m_playedUntil - Clock::now(), Clock::duration::zero());
+  status.SetDelay(std::chrono::duration<double>(buffered).count());
+}
+
+unsigned int CAESinkNULL::AddPackets(uint8_t** data, unsigned int frames, unsigned int offset)
+{
+  Play(std::chrono::duration_cast<Clock::duration>(
+      std::chrono::duration<double>(static_cast<double>(frames) / m_format.m_sampleRate)));
+  return frames;
+}
+
+void CAESinkNULL::AddPause(unsigned int millis)
+{
+  Play(std::chrono::milliseconds(millis));
+}
+
+void CAESinkNULL::Drain()
+{
+  const auto buffered = m_playedUntil - Clock::now();
+  if (buffered > Clock::duration::zero())
+    KODI::TIME::Sleep(std::chrono::duration_cast<std::chrono::milliseconds>(buffered));
+  m_playedUntil = Clock::now();
+}
+
+void CAESinkNULL::Play(Clock::duration duration)
+{
+  // wait until the buffer has room, like a device would
+  const auto overflow = m_playedUntil + duration - Clock::now() - BUFFER;
+  if (overflow > Clock::duration::zero())
+    KODI::TIME::Sleep(std::chrono::duration_cast<std::chrono::milliseconds>(overflow));
+
+  m_playedUntil = std::max(m_playedUntil, Clock::now()) + duration;
+}
@@ -0,0 +1,50 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "cores/AudioEngine/Interfaces/AESink.h"
+#include "cores/AudioEngine/Utils/AEDeviceInfo.h"
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+/*!
+ * \brief Sink without a device, discarding the audio at the rate it would be played.
+ *
+ * Keeps the timing of a real device with a small buffer, so the player syncs to it as usual.
+ * Meant for benchmarking playback on machines without audio output.
+ */
+class CAESinkNULL : public IAESink
+{
+public:
+  const char* GetName() override { return "NULL"; }
+
+  static void Register();
+  static std::unique_ptr<IAESink> Create(std::string& device, AEAudioFormat& desiredFormat);
+  static void EnumerateDevicesEx(AEDeviceInfoList& list, bool force = false);
+
+  bool Initialize(AEAudioFormat& format, std::string& device) override;
+  void Deinitialize() override;
+
+  double GetCacheTotal() override;
+  void GetDelay(AEDelayStatus& status) override;
+  unsigned int AddPackets(uint8_t** data, unsigned int frames, unsigned int offset) override;
+  void AddPause(unsigned int millis) override;
+  void Drain() override;
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  //! add audio of the given duration to the buffer, block while the buffer is full
+  void Play(Clock::duration duration);
+
+  AEAudioFormat m_format;
+  Clock::time_point m_playedUntil; //!< when all audio added so far has been played
+};
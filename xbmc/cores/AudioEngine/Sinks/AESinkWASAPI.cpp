@@ -926,6 +926,14 @@ initialize:
     CLog::LogF(LOGDEBUG, "detected USB device, increasing buffer size");
     audioSinkBufferDurationMsec = (REFERENCE_TIME)1000000;
   }
+  else if (format.m_latencyProfile == AELatencyProfile::LOW)
+  {
+    audioSinkBufferDurationMsec = (REFERENCE_TIME)100000;
+  }
+  else if (format.m_latencyProfile == AELatencyProfile::HIGH)
+  {
+    audioSinkBufferDurationMsec = (REFERENCE_TIME)1000000;
+  }
   audioSinkBufferDurationMsec = (REFERENCE_TIME)((audioSinkBufferDurationMsec / format.m_frameSize) * format.m_frameSize); //even number of frames
 
   if (format.m_dataFormat == AE_FMT_RAW)
@@ -240,8 +240,23 @@ std::chrono::duration<double, std::ratio<1>> PWTimeToAEDelay(const pw_time& time
 }
 
 constexpr std::chrono::duration<double, std::ratio<1>> DEFAULT_BUFFER_DURATION = 0.100s;
+constexpr std::chrono::duration<double, std::ratio<1>> LOW_LATENCY_BUFFER_DURATION = 0.020s;
+constexpr std::chrono::duration<double, std::ratio<1>> HIGH_LATENCY_BUFFER_DURATION = 0.200s;
 constexpr unsigned int DEFAULT_NUM_PERIODS = 2;
 
+std::chrono::duration<double, std::ratio<1>> GetBufferDuration(AELatencyProfile profile)
+{
+  switch (profile)
+  {
+    case AELatencyProfile::LOW:
+      return LOW_LATENCY_BUFFER_DURATION;
+    case AELatencyProfile::HIGH:
+      return HIGH_LATENCY_BUFFER_DURATION;
+    default:
+      return DEFAULT_BUFFER_DURATION;
+  }
+}
+
 } // namespace
 
 using namespace AE::SINK;
@@ -419,8 +434,9 @@ bool CAESinkPipewire::Initialize(AEAudioFormat& format, std::string& device)
 
   m_stream = std::make_unique<PIPEWIRE::CPipewireStream>(core);
 
-  uint32_t frames =
-      std::nearbyint((DEFAULT_BUFFER_DURATION / DEFAULT_NUM_PERIODS).count() * format.m_sampleRate);
+  uint32_t frames = std::nearbyint(
+      (GetBufferDuration(format.m_latencyProfile) / DEFAULT_NUM_PERIODS).count() *
+      format.m_sampleRate);
   std::string fraction = StringUtils::Format("{}/{}", frames, format.m_sampleRate);
 
   m_latency = DEFAULT_NUM_PERIODS * frames * 1.0s / format.m_sampleRate;
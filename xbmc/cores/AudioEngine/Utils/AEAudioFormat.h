@@ -13,6 +13,16 @@
 
 #define AE_IS_PLANAR(x) ((x) >= AE_FMT_U8P && (x) <= AE_FMT_FLOATP)
 
+/**
+ * Latency wanted by the owners of the playing streams, sinks map it to period and buffer sizes
+ */
+enum class AELatencyProfile
+{
+  NORMAL, /* sink defaults */
+  LOW, /* short periods, e.g. games and live streams */
+  HIGH /* long periods and buffers to wake up less often, e.g. movies and music */
+};
+
 /**
  * The audio format structure that fully defines a stream's audio information
  */
@@ -48,6 +58,11 @@ struct AEAudioFormat
    */
   CAEStreamInfo m_streamInfo;
 
+  /**
+   * The latency profile the sink should be configured for
+   */
+  AELatencyProfile m_latencyProfile = AELatencyProfile::NORMAL;
+
   AEAudioFormat()
   {
     m_dataFormat = AE_FMT_INVALID;
@@ -35,6 +35,7 @@ CAEBitstreamPacker::~CAEBitstreamPacker()
 void CAEBitstreamPacker::Pack(CAEStreamInfo &info, uint8_t* data, int size)
 {
   m_pauseDuration = 0;
+  m_output = m_packedBuffer;
   switch (info.m_type)
   {
     case CAEStreamInfo::STREAM_TYPE_TRUEHD:
@@ -71,6 +72,20 @@ void CAEBitstreamPacker::Pack(CAEStreamInfo &info, uint8_t* data, int size)
     default:
       CLog::Log(LOGERROR, "CAEBitstreamPacker::Pack - no pack function");
   }
+
+  m_burst = m_dataSize > 0;
+}
+
+bool CAEBitstreamPacker::PackInPlace(CAEStreamInfo& info, uint8_t* data, int size)
+{
+  if (info.m_type != CAEStreamInfo::STREAM_TYPE_TRUEHD || size != MAX_IEC61937_PACKET)
+    return false;
+
+  m_pauseDuration = 0;
+  m_dataSize = CAEPackIEC61937::PackTrueHD(nullptr, size - IEC61937_DATA_OFFSET, data);
+  m_output = data;
+  m_burst = true;
+  return true;
 }
 
 bool CAEBitstreamPacker::PackPause(CAEStreamInfo &info, unsigned int millis, bool iecBursts)
@@ -79,6 +94,8 @@ bool CAEBitstreamPacker::PackPause(CAEStreamInfo &info, unsigned int millis, boo
   if (m_pauseDuration == millis)
     return false;
 
+  m_output = m_packedBuffer;
+
   switch (info.m_type)
   {
     case CAEStreamInfo::STREAM_TYPE_TRUEHD:
@@ -106,6 +123,7 @@ bool CAEBitstreamPacker::PackPause(CAEStreamInfo &info, unsigned int millis, boo
   {
     memset(m_packedBuffer, 0, m_dataSize);
   }
+  m_burst = iecBursts;
 
   return true;
 }
@@ -117,7 +135,7 @@ unsigned int CAEBitstreamPacker::GetSize() const
 
 uint8_t* CAEBitstreamPacker::GetBuffer()
 {
-  return m_packedBuffer;
+  return m_output;
 }
 
 void CAEBitstreamPacker::Reset()
@@ -125,26 +143,22 @@ void CAEBitstreamPacker::Reset()
   m_dataSize = 0;
   m_pauseDuration = 0;
   m_packedBuffer[0] = 0;
+  m_output = m_packedBuffer;
+  m_burst = false;
 }
 
 void CAEBitstreamPacker::PackDTSHD(CAEStreamInfo &info, uint8_t* data, int size)
 {
   static const uint8_t dtshd_start_code[10] = { 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe };
-  unsigned int dataSize = sizeof(dtshd_start_code) + 2 + size;
-
-  if (dataSize > m_dtsHDSize)
-  {
-    m_dtsHDSize = dataSize;
-    m_dtsHD.resize(dataSize);
-    memcpy(m_dtsHD.data(), dtshd_start_code, sizeof(dtshd_start_code));
-  }
 
-  m_dtsHD[sizeof(dtshd_start_code) + 0] = ((uint16_t)size & 0xFF00) >> 8;
-  m_dtsHD[sizeof(dtshd_start_code) + 1] = ((uint16_t)size & 0x00FF);
-  memcpy(m_dtsHD.data() + sizeof(dtshd_start_code) + 2, data, size);
+  // the header is packed in front of the payload, no need to assemble both in a buffer first
+  uint8_t header[sizeof(dtshd_start_code) + 2];
+  memcpy(header, dtshd_start_code, sizeof(dtshd_start_code));
+  header[sizeof(dtshd_start_code) + 0] = ((uint16_t)size & 0xFF00) >> 8;
+  header[sizeof(dtshd_start_code) + 1] = ((uint16_t)size & 0x00FF);
 
-  m_dataSize =
-      CAEPackIEC61937::PackDTSHD(m_dtsHD.data(), dataSize, m_packedBuffer, info.m_dtsPeriod);
+  m_dataSize = CAEPackIEC61937::PackDTSHD(header, sizeof(header), data, size, m_packedBuffer,
+                                          info.m_dtsPeriod);
 }
 
 void CAEBitstreamPacker::PackEAC3(CAEStreamInfo &info, uint8_t* data, int size)
@@ -24,10 +24,21 @@ public:
   ~CAEBitstreamPacker();
 
   void Pack(CAEStreamInfo &info, uint8_t* data, int size);
+  /*!
+   \brief Pack a burst directly inside the input buffer if the format allows it
+   TrueHD MAT frames already reserve the room for the IEC 61937 burst header, so they can be
+   packed without copying to an internal buffer. GetBuffer() points at data afterwards.
+   \return true if packed in place, false if Pack() needs to be used instead
+   */
+  bool PackInPlace(CAEStreamInfo& info, uint8_t* data, int size);
   bool PackPause(CAEStreamInfo &info, unsigned int millis, bool iecBursts);
   void Reset();
   uint8_t* GetBuffer();
   unsigned int GetSize() const;
+  /*!
+   \brief Whether the last packed output carries IEC 61937 bursts, as opposed to nothing or silence
+   */
+  bool HasBurst() const { return m_burst; }
   static unsigned int GetOutputRate(const CAEStreamInfo& info);
   static CAEChannelInfo GetOutputChannelMap(const CAEStreamInfo& info);
 
@@ -35,9 +46,6 @@ private:
   void PackDTSHD(CAEStreamInfo &info, uint8_t* data, int size);
   void PackEAC3(CAEStreamInfo &info, uint8_t* data, int size);
 
-  std::vector<uint8_t> m_dtsHD;
-  unsigned int m_dtsHDSize = 0;
-
   std::vector<uint8_t> m_eac3;
   unsigned int m_eac3Size = 0;
   unsigned int m_eac3FramesCount = 0;
@@ -45,6 +53,8 @@ private:
 
   unsigned int  m_dataSize = 0;
   uint8_t       m_packedBuffer[MAX_IEC61937_PACKET];
+  uint8_t* m_output = m_packedBuffer;
+  bool m_burst = false;
   unsigned int m_pauseDuration = 0;
 };
 
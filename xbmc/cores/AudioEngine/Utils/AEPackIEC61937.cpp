@@ -14,7 +14,7 @@
 #define IEC61937_PREAMBLE1  0xF872
 #define IEC61937_PREAMBLE2  0x4E1F
 
-inline void SwapEndian(uint16_t *dst, uint16_t *src, unsigned int size)
+inline void SwapEndian(uint16_t *dst, const uint16_t *src, unsigned int size)
 {
   for (unsigned int i = 0; i < size; ++i, ++dst, ++src)
     *dst = ((*src & 0xFF00) >> 8) | ((*src & 0x00FF) << 8);
@@ -113,6 +113,16 @@ int CAEPackIEC61937::PackTrueHD(const uint8_t* data, unsigned int size, uint8_t*
 }
 
 int CAEPackIEC61937::PackDTSHD(uint8_t *data, unsigned int size, uint8_t *dest, unsigned int period)
+{
+  return PackDTSHD(nullptr, 0, data, size, dest, period);
+}
+
+int CAEPackIEC61937::PackDTSHD(const uint8_t* header,
+                               unsigned int headerSize,
+                               const uint8_t* data,
+                               unsigned int size,
+                               uint8_t* dest,
+                               unsigned int period)
 {
   unsigned int subtype;
   switch (period)
@@ -128,6 +138,8 @@ int CAEPackIEC61937::PackDTSHD(uint8_t *data, unsigned int size, uint8_t *dest,
       return 0;
   }
 
+  assert((headerSize & 0x1) == 0);
+
   struct IEC61937Packet *packet = (struct IEC61937Packet*)dest;
   packet->m_preamble1 = IEC61937_PREAMBLE1;
   packet->m_preamble2 = IEC61937_PREAMBLE2;
@@ -135,20 +147,25 @@ int CAEPackIEC61937::PackDTSHD(uint8_t *data, unsigned int size, uint8_t *dest,
 
   /* Align so that (length_code & 0xf) == 0x8. This is reportedly needed
    * with some receivers, but the exact requirement is unconfirmed. */
-  packet->m_length    = ((size + 0x17) &~ 0x0f) - 0x08;
+  packet->m_length    = ((headerSize + size + 0x17) &~ 0x0f) - 0x08;
 
+  uint8_t* payload = packet->m_data + headerSize;
   if (data == NULL)
-    data = packet->m_data;
+    data = payload;
 #ifdef __BIG_ENDIAN__
-  else
-    memcpy(packet->m_data, data, size);
+  if (headerSize > 0)
+    memcpy(packet->m_data, header, headerSize);
+  if (data != payload)
+    memcpy(payload, data, size);
 #else
+  if (headerSize > 0)
+    SwapEndian((uint16_t*)packet->m_data, (const uint16_t*)header, headerSize >> 1);
   size += size & 0x1;
-  SwapEndian((uint16_t*)packet->m_data, (uint16_t*)data, size >> 1);
+  SwapEndian((uint16_t*)payload, (const uint16_t*)data, size >> 1);
 #endif
 
   unsigned int burstsize = period << 2;
-  memset(packet->m_data + size, 0, burstsize - IEC61937_DATA_OFFSET - size);
+  memset(payload + size, 0, burstsize - IEC61937_DATA_OFFSET - headerSize - size);
   return burstsize;
 }
 
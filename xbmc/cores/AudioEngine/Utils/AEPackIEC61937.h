@@ -38,6 +38,15 @@ public:
   static int PackDTS_2048(uint8_t *data, unsigned int size, uint8_t *dest, bool littleEndian);
   static int PackTrueHD(const uint8_t* data, unsigned int size, uint8_t* dest);
   static int PackDTSHD(uint8_t* data, unsigned int size, uint8_t* dest, unsigned int period);
+  /*! \brief pack DTS-HD with a header that is put in front of the payload
+   Saves assembling header and payload in an intermediate buffer, headerSize must be even
+   */
+  static int PackDTSHD(const uint8_t* header,
+                       unsigned int headerSize,
+                       const uint8_t* data,
+                       unsigned int size,
+                       uint8_t* dest,
+                       unsigned int period);
   static int PackPause(uint8_t *dest, unsigned int millis, unsigned int framesize, unsigned int samplerate, unsigned int rep_period, unsigned int encodedRate);
 private:
 
@@ -18,11 +18,16 @@
 #include "utils/log.h"
 #include "utils/MemUtils.h"
 
+#include <algorithm>
+#include <atomic>
 #include <string.h>
 
 /**
  * This buffer can be used by one read and one write thread at any one time
  * without the risk of data corruption.
+ * The read and write counters are atomics published with release semantics once all planes
+ * are copied, so neither side ever blocks on the other. Each counter lives on its own cache
+ * line to keep the producer and the consumer from invalidating each other's cache.
  * If you intend to call the Reset() method, please use Locks.
  * All other operations are thread-safe.
  */
@@ -72,8 +77,8 @@ public:
 #ifdef AE_RING_BUFFER_DEBUG
     CLog::Log(LOGDEBUG, "AERingBuffer::Reset: Buffer reset.");
 #endif
-    m_iWritten = 0;
-    m_iRead = 0;
+    m_iWritten.store(0, std::memory_order_relaxed);
+    m_iRead.store(0, std::memory_order_relaxed);
     m_iReadPos = 0;
     m_iWritePos = 0;
   }
@@ -84,7 +89,7 @@ public:
    *
    * @return AE_RING_BUFFER_OK on success, otherwise an error code
    */
-  int Write(unsigned char *src, unsigned int size, unsigned int plane = 0)
+  int Write(const unsigned char* src, unsigned int size, unsigned int plane = 0)
   {
     unsigned int space = GetWriteSize();
 
@@ -188,6 +193,52 @@ public:
     return AE_RING_BUFFER_OK;
   }
 
+  /**
+   * Writes the same amount of data to every plane and publishes it in one step.
+   * src must hold NumPlanes() pointers.
+   *
+   * @return AE_RING_BUFFER_OK on success, otherwise an error code
+   */
+  int WritePlanes(const unsigned char* const* src, unsigned int size)
+  {
+    if (size > GetWriteSize())
+      return AE_RING_BUFFER_FULL;
+
+    for (unsigned int i = 0; i < m_planes; i++)
+      CopyIn(m_Buffer[i], src[i], size);
+    WriteFinished(size);
+
+    return AE_RING_BUFFER_OK;
+  }
+
+  /**
+   * Reads the same amount of data from every plane and releases the space in one step.
+   * dest must hold NumPlanes() pointers, a nullptr entry skips that plane. Passing nullptr
+   * for dest discards the data.
+   *
+   * @return AE_RING_BUFFER_OK on success, otherwise an error code
+   */
+  int ReadPlanes(unsigned char* const* dest, unsigned int size)
+  {
+    unsigned int space = GetReadSize();
+    if (space == 0)
+      return AE_RING_BUFFER_EMPTY;
+    if (size > space)
+      return AE_RING_BUFFER_NOTAVAILABLE;
+
+    if (dest)
+    {
+      for (unsigned int i = 0; i < m_planes; i++)
+      {
+        if (dest[i])
+          CopyOut(dest[i], m_Buffer[i], size);
+      }
+    }
+    ReadFinished(size);
+
+    return AE_RING_BUFFER_OK;
+  }
+
   /**
    * Dumps the buffer.
    */
@@ -216,7 +267,8 @@ public:
    */
   unsigned int GetWriteSize()
   {
-    return m_iSize - ( m_iWritten - m_iRead );
+    return m_iSize - (m_iWritten.load(std::memory_order_acquire) -
+                      m_iRead.load(std::memory_order_acquire));
   }
 
   /**
@@ -225,7 +277,7 @@ public:
    */
   unsigned int GetReadSize()
   {
-    return m_iWritten - m_iRead;
+    return m_iWritten.load(std::memory_order_acquire) - m_iRead.load(std::memory_order_acquire);
   }
 
   /**
@@ -244,6 +296,28 @@ public:
     return m_planes;
   }
 private:
+  /**
+   * Copies size bytes into plane at the write position, wrapping if needed.
+   */
+  void CopyIn(unsigned char* plane, const unsigned char* src, unsigned int size)
+  {
+    unsigned int first = std::min(size, m_iSize - m_iWritePos);
+    memcpy(plane + m_iWritePos, src, first);
+    if (size > first)
+      memcpy(plane, src + first, size - first);
+  }
+
+  /**
+   * Copies size bytes out of plane at the read position, wrapping if needed.
+   */
+  void CopyOut(unsigned char* dest, const unsigned char* plane, unsigned int size)
+  {
+    unsigned int first = std::min(size, m_iSize - m_iReadPos);
+    memcpy(dest, plane + m_iReadPos, first);
+    if (size > first)
+      memcpy(dest + first, plane, size - first);
+  }
+
   /**
    * Increments the write pointer.
    * Called at the end of writing to all planes.
@@ -255,8 +329,8 @@ private:
     else // wrapping
       m_iWritePos = size - (m_iSize - m_iWritePos);
 
-    //we can increase the write count now
-    m_iWritten+=size;
+    //we can increase the write count now, this publishes the data to the reader
+    m_iWritten.fetch_add(size, std::memory_order_release);
   }
 
   /**
@@ -270,15 +344,20 @@ private:
     else
       m_iReadPos = size - (m_iSize - m_iReadPos);
 
-    //we can increase the read count now
-    m_iRead+=size;
+    //we can increase the read count now, this hands the space back to the writer
+    m_iRead.fetch_add(size, std::memory_order_release);
   }
 
+  static constexpr size_t CACHE_LINE_SIZE = 64;
+
+  // owned by the reader
+  alignas(CACHE_LINE_SIZE) std::atomic<unsigned int> m_iRead{0};
   unsigned int m_iReadPos = 0;
+  // owned by the writer
+  alignas(CACHE_LINE_SIZE) std::atomic<unsigned int> m_iWritten{0};
   unsigned int m_iWritePos = 0;
-  unsigned int m_iRead = 0;
-  unsigned int m_iWritten = 0;
-  unsigned int m_iSize = 0;
+  // shared, immutable after Create()
+  alignas(CACHE_LINE_SIZE) unsigned int m_iSize = 0;
   unsigned int m_planes = 0;
   unsigned char** m_Buffer = nullptr;
 };
@@ -13,10 +13,13 @@
 #include "utils/log.h"
 #include "utils/TimeUtils.h"
 
+#include <algorithm>
 #include <cassert>
 
 #if defined(HAVE_SSE) && defined(__SSE__)
 #include <xmmintrin.h>
+#elif defined(HAS_NEON) && defined(__ARM_NEON)
+#include <arm_neon.h>
 #endif
 
 void AEDelayStatus::SetDelay(double d)
@@ -313,6 +316,78 @@ void CAEUtil::SSEMulAddArray(float *data, float *add, const float mul, uint32_t
 }
 #endif
 
+void CAEUtil::MulArray(float* data, const float mul, uint32_t count)
+{
+#if defined(HAVE_SSE) && defined(__SSE__)
+  SSEMulArray(data, mul, count);
+#elif defined(HAS_NEON) && defined(__ARM_NEON)
+  const float32x4_t m = vdupq_n_f32(mul);
+  uint32_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    vst1q_f32(data + i, vmulq_f32(vld1q_f32(data + i), m));
+    vst1q_f32(data + i + 4, vmulq_f32(vld1q_f32(data + i + 4), m));
+  }
+  for (; i + 4 <= count; i += 4)
+    vst1q_f32(data + i, vmulq_f32(vld1q_f32(data + i), m));
+  for (; i < count; ++i)
+    data[i] *= mul;
+#else
+  for (uint32_t i = 0; i < count; ++i)
+    data[i] *= mul;
+#endif
+}
+
+void CAEUtil::MulAddArray(float* data, const float* add, const float mul, uint32_t count)
+{
+#if defined(HAVE_SSE) && defined(__SSE__)
+  SSEMulAddArray(data, const_cast<float*>(add), mul, count);
+#elif defined(HAS_NEON) && defined(__ARM_NEON)
+  const float32x4_t m = vdupq_n_f32(mul);
+  uint32_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    vst1q_f32(data + i, vmlaq_f32(vld1q_f32(data + i), vld1q_f32(add + i), m));
+    vst1q_f32(data + i + 4, vmlaq_f32(vld1q_f32(data + i + 4), vld1q_f32(add + i + 4), m));
+  }
+  for (; i + 4 <= count; i += 4)
+    vst1q_f32(data + i, vmlaq_f32(vld1q_f32(data + i), vld1q_f32(add + i), m));
+  for (; i < count; ++i)
+    data[i] += add[i] * mul;
+#else
+  for (uint32_t i = 0; i < count; ++i)
+    data[i] += add[i] * mul;
+#endif
+}
+
+float CAEUtil::PeakArray(const float* data, uint32_t count)
+{
+  float peak = 0.0f;
+  uint32_t i = 0;
+#if defined(HAVE_SSE) && defined(__SSE__)
+  const __m128 sign = _mm_set_ps1(-0.0f);
+  __m128 acc = _mm_setzero_ps();
+  for (; i + 4 <= count; i += 4)
+    acc = _mm_max_ps(acc, _mm_andnot_ps(sign, _mm_loadu_ps(data + i)));
+
+  float lanes[4];
+  _mm_storeu_ps(lanes, acc);
+  peak = std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+#elif defined(HAS_NEON) && defined(__ARM_NEON)
+  float32x4_t acc = vdupq_n_f32(0.0f);
+  for (; i + 4 <= count; i += 4)
+    acc = vmaxq_f32(acc, vabsq_f32(vld1q_f32(data + i)));
+
+  float32x2_t lanes = vmax_f32(vget_low_f32(acc), vget_high_f32(acc));
+  lanes = vpmax_f32(lanes, lanes);
+  peak = vget_lane_f32(lanes, 0);
+#endif
+  for (; i < count; ++i)
+    peak = std::max(peak, fabsf(data[i]));
+
+  return peak;
+}
+
 inline float CAEUtil::SoftClamp(const float x)
 {
 #if 1
@@ -170,6 +170,28 @@ public:
   #endif
   static void ClampArray(float *data, uint32_t count);
 
+  /*! \brief multiply every sample by mul, uses SSE or NEON when available
+   \param data the samples to scale in place
+   \param mul the gain factor
+   \param count number of samples
+   */
+  static void MulArray(float* data, const float mul, uint32_t count);
+
+  /*! \brief mix add scaled by mul into data, uses SSE or NEON when available
+   \param data the samples to mix into
+   \param add the samples to mix in
+   \param mul the gain factor applied to add
+   \param count number of samples
+   */
+  static void MulAddArray(float* data, const float* add, const float mul, uint32_t count);
+
+  /*! \brief get the highest absolute sample value, uses SSE or NEON when available
+   \param data the samples to scan
+   \param count number of samples
+   \return the peak, 0.0 for an empty array
+   */
+  static float PeakArray(const float* data, uint32_t count);
+
   static bool S16NeedsByteSwap(AEDataFormat in, AEDataFormat out);
 
   static uint64_t GetAVChannelLayout(const CAEChannelInfo &info);
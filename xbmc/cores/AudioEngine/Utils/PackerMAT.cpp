@@ -178,8 +178,16 @@ std::vector<uint8_t> CPackerMAT::GetOutputFrame()
   return buffer;
 }
 
+void CPackerMAT::RecycleFrame(std::vector<uint8_t>&& frame)
+{
+  if (frame.size() == MAT_BUFFER_SIZE)
+    m_spare = std::move(frame);
+}
+
 void CPackerMAT::WriteHeader()
 {
+  if (m_buffer.empty() && !m_spare.empty())
+    m_buffer = std::move(m_spare);
   m_buffer.resize(MAT_BUFFER_SIZE);
 
   // reserve size for the IEC header and the MAT start code
@@ -218,8 +226,7 @@ void CPackerMAT::WritePadding()
   if (m_state.padding == 0)
     return;
 
-  // for padding not writes any data (nullptr) as buffer is already zeroed
-  // only counts/skip bytes
+  // for padding not writes any data (nullptr), the bytes are zeroed while appending
   const int remaining = FillDataBuffer(nullptr, m_state.padding, Type::PADDING);
 
   // not all padding could be written to the buffer, write it later
@@ -239,9 +246,11 @@ void CPackerMAT::WritePadding()
 
 void CPackerMAT::AppendData(const uint8_t* data, int size, Type type)
 {
-  // for padding not write anything, only skip bytes
+  // buffers may be recycled, so padding needs to be zeroed explicitly
   if (type == Type::DATA)
     memcpy(m_buffer.data() + m_bufferCount, data, size);
+  else
+    memset(m_buffer.data() + m_bufferCount, 0, size);
 
   m_state.matFramesize += size;
   m_bufferCount += size;
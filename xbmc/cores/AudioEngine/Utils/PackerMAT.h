@@ -27,6 +27,12 @@ public:
   bool PackTrueHD(const uint8_t* data, int size);
   std::vector<uint8_t> GetOutputFrame();
 
+  /*!
+   \brief Hand back a frame obtained from GetOutputFrame() once it was consumed.
+   Its storage is reused for one of the next frames instead of allocating a new one.
+   */
+  void RecycleFrame(std::vector<uint8_t>&& frame);
+
 private:
   struct MATState
   {
@@ -62,5 +68,6 @@ private:
 
   uint32_t m_bufferCount{0};
   std::vector<uint8_t> m_buffer;
+  std::vector<uint8_t> m_spare;
   std::deque<std::vector<uint8_t>> m_outputQueue;
 };
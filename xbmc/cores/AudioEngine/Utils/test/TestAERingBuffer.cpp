@@ -0,0 +1,108 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/AudioEngine/Utils/AERingBuffer.h"
+
+#include <stdint.h>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST(TestAERingBuffer, WrapAround)
+{
+  AERingBuffer buffer(16);
+  std::vector<unsigned char> in(12);
+  std::vector<unsigned char> out(12);
+
+  for (unsigned int round = 0; round < 4; round++)
+  {
+    for (size_t i = 0; i < in.size(); i++)
+      in[i] = static_cast<unsigned char>(round * 16 + i);
+
+    ASSERT_EQ(0, buffer.Write(in.data(), 12));
+    EXPECT_EQ(12u, buffer.GetReadSize());
+    EXPECT_EQ(4u, buffer.GetWriteSize());
+    EXPECT_EQ(2, buffer.Write(in.data(), 5));
+
+    ASSERT_EQ(0, buffer.Read(out.data(), 12));
+    EXPECT_EQ(in, out);
+    EXPECT_EQ(1, buffer.Read(out.data(), 1));
+  }
+}
+
+TEST(TestAERingBuffer, Planes)
+{
+  AERingBuffer buffer(10, 2);
+  std::vector<unsigned char> left(7, 1);
+  std::vector<unsigned char> right(7, 2);
+  const unsigned char* src[] = {left.data(), right.data()};
+
+  ASSERT_EQ(0, buffer.WritePlanes(src, 7));
+  EXPECT_EQ(7u, buffer.GetReadSize());
+
+  // per plane writes only publish after the last plane
+  ASSERT_EQ(0, buffer.Write(left.data(), 3, 0));
+  EXPECT_EQ(7u, buffer.GetReadSize());
+  ASSERT_EQ(0, buffer.Write(right.data(), 3, 1));
+  EXPECT_EQ(10u, buffer.GetReadSize());
+
+  ASSERT_EQ(0, buffer.ReadPlanes(nullptr, 5));
+
+  std::vector<unsigned char> outLeft(5);
+  std::vector<unsigned char> outRight(5);
+  unsigned char* dest[] = {outLeft.data(), outRight.data()};
+  ASSERT_EQ(0, buffer.ReadPlanes(dest, 5));
+  EXPECT_EQ(std::vector<unsigned char>(5, 1), outLeft);
+  EXPECT_EQ(std::vector<unsigned char>(5, 2), outRight);
+  EXPECT_EQ(1, buffer.ReadPlanes(dest, 1));
+}
+
+TEST(TestAERingBuffer, ProducerConsumer)
+{
+  constexpr unsigned int CHUNK = 96;
+  constexpr uint32_t TOTAL = 1 << 18;
+  AERingBuffer buffer(4096);
+
+  std::thread producer(
+      [&buffer]
+      {
+        std::vector<uint32_t> chunk(CHUNK / sizeof(uint32_t));
+        uint32_t next = 0;
+        while (next < TOTAL)
+        {
+          if (buffer.GetWriteSize() < CHUNK)
+          {
+            std::this_thread::yield();
+            continue;
+          }
+          for (auto& value : chunk)
+            value = next++;
+          buffer.Write(reinterpret_cast<unsigned char*>(chunk.data()), CHUNK);
+        }
+      });
+
+  std::vector<uint32_t> chunk(CHUNK / sizeof(uint32_t));
+  uint32_t expected = 0;
+  bool ordered = true;
+  while (expected < TOTAL)
+  {
+    if (buffer.GetReadSize() < CHUNK)
+    {
+      std::this_thread::yield();
+      continue;
+    }
+    buffer.Read(reinterpret_cast<unsigned char*>(chunk.data()), CHUNK);
+    for (auto value : chunk)
+      ordered &= value == expected++;
+  }
+  producer.join();
+
+  EXPECT_TRUE(ordered);
+  EXPECT_EQ(0u, buffer.GetReadSize());
+}
@@ -0,0 +1,89 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/AudioEngine/Utils/AEUtil.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+// odd sizes with an unaligned start exercise the head and tail handling of the kernels
+std::vector<float> MakeSamples(size_t count, float scale)
+{
+  std::vector<float> samples(count);
+  for (size_t i = 0; i < count; ++i)
+    samples[i] = scale * (static_cast<float>(i % 17) - 8.0f) / 8.0f;
+  return samples;
+}
+} // namespace
+
+TEST(TestAEUtil, MulArray)
+{
+  auto samples = MakeSamples(1027, 1.0f);
+  const auto expected = samples;
+
+  CAEUtil::MulArray(samples.data() + 1, 0.5f, 1025);
+
+  EXPECT_FLOAT_EQ(expected[0], samples[0]);
+  for (size_t i = 1; i < 1026; ++i)
+    EXPECT_FLOAT_EQ(expected[i] * 0.5f, samples[i]);
+  EXPECT_FLOAT_EQ(expected[1026], samples[1026]);
+}
+
+TEST(TestAEUtil, MulAddArray)
+{
+  auto data = MakeSamples(1027, 0.25f);
+  const auto add = MakeSamples(1027, 1.0f);
+  const auto expected = data;
+
+  CAEUtil::MulAddArray(data.data() + 3, add.data() + 1, 0.75f, 1021);
+
+  for (size_t i = 0; i < 1021; ++i)
+    EXPECT_FLOAT_EQ(expected[i + 3] + add[i + 1] * 0.75f, data[i + 3]);
+  EXPECT_FLOAT_EQ(expected[1024], data[1024]);
+}
+
+TEST(TestAEUtil, PeakArray)
+{
+  auto samples = MakeSamples(1027, 0.5f);
+  EXPECT_FLOAT_EQ(0.5f, CAEUtil::PeakArray(samples.data(), 1027));
+
+  samples[1025] = -1.5f;
+  EXPECT_FLOAT_EQ(1.5f, CAEUtil::PeakArray(samples.data() + 1, 1025));
+  EXPECT_FLOAT_EQ(0.5f, CAEUtil::PeakArray(samples.data() + 1, 1024));
+  EXPECT_FLOAT_EQ(0.0f, CAEUtil::PeakArray(samples.data(), 0));
+}
+
+// run with --gtest_also_run_disabled_tests to get the per period cost on the target box
+TEST(TestAEUtil, DISABLED_BenchmarkMixPeriod)
+{
+  // 7.1 float output, 1024 frames per period
+  constexpr uint32_t count = 1024 * 8;
+  constexpr int periods = 20000;
+  auto out = MakeSamples(count, 0.25f);
+  const auto sound = MakeSamples(count, 0.25f);
+
+  const auto start = std::chrono::steady_clock::now();
+  float peak = 0.0f;
+  for (int i = 0; i < periods; ++i)
+  {
+    CAEUtil::MulAddArray(out.data(), sound.data(), 0.5f, count);
+    CAEUtil::MulArray(out.data(), 0.5f, count);
+    peak = std::max(peak, CAEUtil::PeakArray(out.data(), count));
+  }
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+
+  std::cout << "mix + gain + peak per period: "
+            << std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / periods
+            << " ns (peak " << peak << ")" << std::endl;
+}
@@ -29,11 +29,8 @@ CDataCacheCore& CDataCacheCore::GetInstance()
 
 void CDataCacheCore::Reset()
 {
-  {
-    std::unique_lock lock(m_stateSection);
-    m_stateInfo = {};
-    m_playerStateChanged = false;
-  }
+  m_stateInfo.Store({});
+  m_playerStateChanged = false;
   {
     std::unique_lock lock(m_videoPlayerSection);
     m_playerVideoInfo = {};
@@ -43,15 +40,12 @@ void CDataCacheCore::Reset()
     m_playerAudioInfo = {};
   }
   m_hasAVInfoChanges = false;
-  {
-    std::unique_lock lock(m_renderSection);
-    m_renderInfo = {};
-  }
+  m_renderInfo.Store({});
   {
     std::unique_lock lock(m_contentSection);
     m_contentInfo.Reset();
   }
-  m_timeInfo = {};
+  m_timeInfo.Store({});
 }
 
 bool CDataCacheCore::HasAVInfoChanges()
@@ -310,188 +304,154 @@ const std::vector<std::pair<std::string, int64_t>>& CDataCacheCore::GetChapters(
 
 void CDataCacheCore::SetRenderClockSync(bool enable)
 {
-  std::unique_lock lock(m_renderSection);
-
-  m_renderInfo.m_isClockSync = enable;
+  m_renderInfo.Store({enable});
 }
 
 bool CDataCacheCore::IsRenderClockSync()
 {
-  std::unique_lock lock(m_renderSection);
-
-  return m_renderInfo.m_isClockSync;
+  return m_renderInfo.Load().m_isClockSync;
 }
 
 // player states
 void CDataCacheCore::SeekFinished(int64_t offset)
 {
-  std::unique_lock lock(m_stateSection);
-  m_stateInfo.m_lastSeekTime = std::chrono::system_clock::now();
-  m_stateInfo.m_lastSeekOffset = offset;
+  m_stateInfo.Update(
+      [offset](SStateInfo& state)
+      {
+        state.m_lastSeekTime = std::chrono::system_clock::now();
+        state.m_lastSeekOffset = offset;
+      });
 }
 
 int64_t CDataCacheCore::GetSeekOffSet() const
 {
-  std::unique_lock lock(m_stateSection);
-  return m_stateInfo.m_lastSeekOffset;
+  return m_stateInfo.Load().m_lastSeekOffset;
 }
 
 bool CDataCacheCore::HasPerformedSeek(int64_t lastSecondInterval) const
 {
-  std::unique_lock lock(m_stateSection);
-  if (m_stateInfo.m_lastSeekTime == std::chrono::time_point<std::chrono::system_clock>{})
+  const auto lastSeekTime = m_stateInfo.Load().m_lastSeekTime;
+  if (lastSeekTime == std::chrono::time_point<std::chrono::system_clock>{})
   {
     return false;
   }
-  return (std::chrono::system_clock::now() - m_stateInfo.m_lastSeekTime) <
+  return (std::chrono::system_clock::now() - lastSeekTime) <
          std::chrono::duration_cast<std::chrono::seconds>(
              std::chrono::duration<int64_t>(lastSecondInterval));
 }
 
 void CDataCacheCore::SetStateSeeking(bool active)
 {
-  std::unique_lock lock(m_stateSection);
-
-  m_stateInfo.m_stateSeeking = active;
+  m_stateInfo.Update([active](SStateInfo& state) { state.m_stateSeeking = active; });
   m_playerStateChanged = true;
 }
 
 bool CDataCacheCore::IsSeeking()
 {
-  std::unique_lock lock(m_stateSection);
-
-  return m_stateInfo.m_stateSeeking;
+  return m_stateInfo.Load().m_stateSeeking;
 }
 
 void CDataCacheCore::SetSpeed(float tempo, float speed)
 {
-  std::unique_lock lock(m_stateSection);
-
-  m_stateInfo.m_tempo = tempo;
-  m_stateInfo.m_speed = speed;
+  m_stateInfo.Update(
+      [tempo, speed](SStateInfo& state)
+      {
+        state.m_tempo = tempo;
+        state.m_speed = speed;
+      });
 }
 
 float CDataCacheCore::GetSpeed()
 {
-  std::unique_lock lock(m_stateSection);
-
-  return m_stateInfo.m_speed;
+  return m_stateInfo.Load().m_speed;
 }
 
 float CDataCacheCore::GetTempo()
 {
-  std::unique_lock lock(m_stateSection);
-
-  return m_stateInfo.m_tempo;
+  return m_stateInfo.Load().m_tempo;
 }
 
 void CDataCacheCore::SetFrameAdvance(bool fa)
 {
-  std::unique_lock lock(m_stateSection);
-
-  m_stateInfo.m_frameAdvance = fa;
+  m_stateInfo.Update([fa](SStateInfo& state) { state.m_frameAdvance = fa; });
 }
 
 bool CDataCacheCore::IsFrameAdvance()
 {
-  std::unique_lock lock(m_stateSection);
-
-  return m_stateInfo.m_frameAdvance;
+  return m_stateInfo.Load().m_frameAdvance;
 }
 
 bool CDataCacheCore::IsPlayerStateChanged()
 {
-  std::unique_lock lock(m_stateSection);
-
-  bool ret(m_playerStateChanged);
-  m_playerStateChanged = false;
-
-  return ret;
+  return m_playerStateChanged.exchange(false);
 }
 
 void CDataCacheCore::SetGuiRender(bool gui)
 {
-  std::unique_lock lock(m_stateSection);
-
-  m_stateInfo.m_renderGuiLayer = gui;
+  m_stateInfo.Update([gui](SStateInfo& state) { state.m_renderGuiLayer = gui; });
   m_playerStateChanged = true;
 }
 
 bool CDataCacheCore::GetGuiRender()
 {
-  std::unique_lock lock(m_stateSection);
-
-  return m_stateInfo.m_renderGuiLayer;
+  return m_stateInfo.Load().m_renderGuiLayer;
 }
 
 void CDataCacheCore::SetVideoRender(bool video)
 {
-  std::unique_lock lock(m_stateSection);
-
-  m_stateInfo.m_renderVideoLayer = video;
+  m_stateInfo.Update([video](SStateInfo& state) { state.m_renderVideoLayer = video; });
   m_playerStateChanged = true;
 }
 
 bool CDataCacheCore::GetVideoRender()
 {
-  std::unique_lock lock(m_stateSection);
-
-  return m_stateInfo.m_renderVideoLayer;
+  return m_stateInfo.Load().m_renderVideoLayer;
 }
 
 void CDataCacheCore::SetPlayTimes(time_t start, int64_t current, int64_t min, int64_t max)
 {
-  std::unique_lock lock(m_stateSection);
-  m_timeInfo.m_startTime = start;
-  m_timeInfo.m_time = current;
-  m_timeInfo.m_timeMin = min;
-  m_timeInfo.m_timeMax = max;
+  m_timeInfo.Store({.m_startTime = start, .m_time = current, .m_timeMax = max, .m_timeMin = min});
 }
 
 void CDataCacheCore::GetPlayTimes(time_t &start, int64_t &current, int64_t &min, int64_t &max)
 {
-  std::unique_lock lock(m_stateSection);
-  start = m_timeInfo.m_startTime;
-  current = m_timeInfo.m_time;
-  min = m_timeInfo.m_timeMin;
-  max = m_timeInfo.m_timeMax;
+  const STimeInfo timeInfo = m_timeInfo.Load();
+  start = timeInfo.m_startTime;
+  current = timeInfo.m_time;
+  min = timeInfo.m_timeMin;
+  max = timeInfo.m_timeMax;
 }
 
 time_t CDataCacheCore::GetStartTime()
 {
-  std::unique_lock lock(m_stateSection);
-  return m_timeInfo.m_startTime;
+  return m_timeInfo.Load().m_startTime;
 }
 
 int64_t CDataCacheCore::GetPlayTime()
 {
-  std::unique_lock lock(m_stateSection);
-  return m_timeInfo.m_time;
+  return m_timeInfo.Load().m_time;
 }
 
 int64_t CDataCacheCore::GetMinTime()
 {
-  std::unique_lock lock(m_stateSection);
-  return m_timeInfo.m_timeMin;
+  return m_timeInfo.Load().m_timeMin;
 }
 
 int64_t CDataCacheCore::GetMaxTime()
 {
-  std::unique_lock lock(m_stateSection);
-  return m_timeInfo.m_timeMax;
+  return m_timeInfo.Load().m_timeMax;
 }
 
 float CDataCacheCore::GetPlayPercentage()
 {
-  std::unique_lock lock(m_stateSection);
-
   // Note: To calculate accurate percentage, all time data must be consistent,
   //       which is the case for data cache core. Calculation can not be done
   //       outside of data cache core or a possibility to lock the data cache
   //       core from outside would be needed.
-  int64_t iTotalTime = m_timeInfo.m_timeMax - m_timeInfo.m_timeMin;
+  const STimeInfo timeInfo = m_timeInfo.Load();
+  int64_t iTotalTime = timeInfo.m_timeMax - timeInfo.m_timeMin;
   if (iTotalTime <= 0)
     return 0;
 
-  return m_timeInfo.m_time * 100 / static_cast<float>(iTotalTime);
+  return timeInfo.m_time * 100 / static_cast<float>(iTotalTime);
 }
@@ -9,7 +9,8 @@
 #pragma once
 
 #include "EdlEdit.h"
-#include "threads/CriticalSection.h"
+#include "threads/FastCriticalSection.h"
+#include "threads/SeqLock.h"
 
 #include <atomic>
 #include <chrono>
@@ -198,7 +199,7 @@ public:
 protected:
   std::atomic_bool m_hasAVInfoChanges = false;
 
-  CCriticalSection m_videoPlayerSection;
+  CFastCriticalSection m_videoPlayerSection;
   struct SPlayerVideoInfo
   {
     std::string decoderName;
@@ -213,7 +214,7 @@ protected:
     bool m_isInterlaced;
   } m_playerVideoInfo;
 
-  CCriticalSection m_audioPlayerSection;
+  CFastCriticalSection m_audioPlayerSection;
   struct SPlayerAudioInfo
   {
     std::string decoderName;
@@ -222,7 +223,7 @@ protected:
     int bitsPerSample;
   } m_playerAudioInfo;
 
-  mutable CCriticalSection m_contentSection;
+  mutable CFastCriticalSection m_contentSection;
   struct SContentInfo
   {
   public:
@@ -302,14 +303,15 @@ protected:
     std::vector<std::chrono::milliseconds> m_sceneMarkers;
   } m_contentInfo;
 
-  CCriticalSection m_renderSection;
+  // render, state and time info are polled by the GUI every frame, reading them must never wait
+  // for the player threads updating them
   struct SRenderInfo
   {
     bool m_isClockSync;
-  } m_renderInfo{};
+  };
+  XbmcThreads::CSeqLock<SRenderInfo> m_renderInfo;
 
-  mutable CCriticalSection m_stateSection;
-  bool m_playerStateChanged = false;
+  std::atomic_bool m_playerStateChanged = false;
   struct SStateInfo
   {
     bool m_stateSeeking{false};
@@ -323,7 +325,8 @@ protected:
         std::chrono::time_point<std::chrono::system_clock>{}};
     /*! Last seek offset */
     int64_t m_lastSeekOffset{0};
-  } m_stateInfo;
+  };
+  XbmcThreads::CSeqLock<SStateInfo> m_stateInfo;
 
   struct STimeInfo
   {
@@ -331,5 +334,6 @@ protected:
     int64_t m_time;
     int64_t m_timeMax;
     int64_t m_timeMin;
-  } m_timeInfo = {};
+  };
+  XbmcThreads::CSeqLock<STimeInfo> m_timeInfo;
 };
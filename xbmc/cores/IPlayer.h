@@ -95,6 +95,12 @@ public:
   virtual bool Initialize(TiXmlElement* pConfig) { return true; }
   virtual bool OpenFile(const CFileItem& file, const CPlayerOptions& options){ return false;}
   virtual bool QueueNextFile(const CFileItem &file) { return false; }
+
+  /*!
+   \brief Open the file expected to be played next in the background, to start it faster later
+   \return true if the player preloads the file, it still has to be opened with OpenFile()
+   */
+  virtual bool PreloadNextFile(const CFileItem& file) { return false; }
   virtual void OnNothingToQueueNotify() {}
   virtual bool CloseFile(bool reopen = false) = 0;
   virtual bool IsPlaying() const { return false;}
@@ -45,6 +45,7 @@ public:
   virtual void ReleaseMemory() {}
   virtual uintptr_t GetCurrentFramebuffer() = 0;
   virtual bool UploadTexture() = 0;
+  virtual void SyncUpload() {}
   virtual void BindToUnit(unsigned int unit) {}
   virtual void SetHeader(void* header) {}
 
@@ -9,15 +9,26 @@
 #include "RenderBufferOpenGL.h"
 
 #include "cores/RetroPlayer/rendering/RenderContext.h"
+#include "utils/log.h"
+
+#include <cstring>
 
 using namespace KODI;
 using namespace RETRO;
 
-CRenderBufferOpenGL::CRenderBufferOpenGL(GLuint pixeltype,
+namespace
+{
+// Upper bound for waiting on an upload, a frame has long been presented by then
+constexpr GLuint64 UPLOAD_FENCE_TIMEOUT_NS = 100 * 1000 * 1000;
+} // namespace
+
+CRenderBufferOpenGL::CRenderBufferOpenGL(CRenderContext& context,
+                                         GLuint pixeltype,
                                          GLuint internalformat,
                                          GLuint pixelformat,
                                          GLuint bpp)
-  : m_pixeltype(pixeltype),
+  : m_context(context),
+    m_pixeltype(pixeltype),
     m_internalformat(internalformat),
     m_pixelformat(pixelformat),
     m_bpp(bpp)
@@ -26,9 +37,19 @@ CRenderBufferOpenGL::CRenderBufferOpenGL(GLuint pixeltype,
 
 CRenderBufferOpenGL::~CRenderBufferOpenGL()
 {
+  DeletePixelBuffer();
   DeleteTexture();
 }
 
+uint8_t* CRenderBufferOpenGL::GetMemory()
+{
+  uint8_t* mappedData = m_mappedData;
+  if (mappedData != nullptr)
+    return mappedData;
+
+  return CRenderBufferSysMem::GetMemory();
+}
+
 void CRenderBufferOpenGL::CreateTexture()
 {
   glGenTextures(1, &m_textureId);
@@ -46,11 +67,52 @@ void CRenderBufferOpenGL::CreateTexture()
   glBindTexture(m_textureTarget, 0);
 }
 
+bool CRenderBufferOpenGL::CreatePixelBuffer()
+{
+#if defined(GL_MAP_PERSISTENT_BIT)
+  if (!m_context.IsExtSupported("GL_ARB_buffer_storage"))
+    return false;
+
+  const GLsizeiptr size = static_cast<GLsizeiptr>(m_data.size());
+  // Readable as well, savestates capture their video frame from render buffers
+  const GLbitfield flags =
+      GL_MAP_READ_BIT | GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+  glGenBuffers(1, &m_pixelBuffer);
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_pixelBuffer);
+  glBufferStorage(GL_PIXEL_UNPACK_BUFFER, size, nullptr, flags);
+
+  auto* mappedData =
+      static_cast<uint8_t*>(glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, flags));
+
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+  if (mappedData == nullptr)
+  {
+    CLog::Log(LOGDEBUG, "RetroPlayer[RENDER]: Failed to map pixel buffer, uploading from memory");
+    DeletePixelBuffer();
+    return false;
+  }
+
+  // The buffer holds the frame to upload, from now on the core writes into the
+  // mapped memory directly
+  std::memcpy(mappedData, m_data.data(), m_data.size());
+  m_mappedData = mappedData;
+
+  return true;
+#else
+  return false;
+#endif
+}
+
 bool CRenderBufferOpenGL::UploadTexture()
 {
   if (!glIsTexture(m_textureId))
     CreateTexture();
 
+  if (m_pixelBuffer == 0 && !m_pixelBufferFailed)
+    m_pixelBufferFailed = !CreatePixelBuffer();
+
   glBindTexture(m_textureTarget, m_textureId);
 
   const int stride = GetFrameSize() / m_height;
@@ -59,17 +121,42 @@ bool CRenderBufferOpenGL::UploadTexture()
 
   glPixelStorei(GL_UNPACK_ROW_LENGTH, stride / m_bpp);
 
-  //! @todo This is subject to change:
-  //! We want to use PBO's instead of glTexSubImage2D!
-  //! This code has been borrowed from OpenGL ES in order
-  //! to remove GL dependencies on GLES.
-  glTexSubImage2D(m_textureTarget, 0, 0, 0, m_width, m_height, m_pixelformat, m_pixeltype,
-                  m_data.data());
+  if (m_pixelBuffer != 0)
+  {
+    // Source the upload from the mapped buffer, the GPU copies it on its own time
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_pixelBuffer);
+    glTexSubImage2D(m_textureTarget, 0, 0, 0, m_width, m_height, m_pixelformat, m_pixeltype,
+                    nullptr);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    if (m_uploadFence != nullptr)
+      glDeleteSync(m_uploadFence);
+    m_uploadFence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  }
+  else
+  {
+    glTexSubImage2D(m_textureTarget, 0, 0, 0, m_width, m_height, m_pixelformat, m_pixeltype,
+                    m_data.data());
+  }
+
   glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
 
   return true;
 }
 
+void CRenderBufferOpenGL::SyncUpload()
+{
+  if (m_uploadFence == nullptr)
+    return;
+
+  if (glClientWaitSync(m_uploadFence, GL_SYNC_FLUSH_COMMANDS_BIT, UPLOAD_FENCE_TIMEOUT_NS) ==
+      GL_TIMEOUT_EXPIRED)
+    CLog::Log(LOGDEBUG, "RetroPlayer[RENDER]: Timed out waiting for texture upload");
+
+  glDeleteSync(m_uploadFence);
+  m_uploadFence = nullptr;
+}
+
 void CRenderBufferOpenGL::DeleteTexture()
 {
   if (glIsTexture(m_textureId))
@@ -77,3 +164,24 @@ void CRenderBufferOpenGL::DeleteTexture()
 
   m_textureId = 0;
 }
+
+void CRenderBufferOpenGL::DeletePixelBuffer()
+{
+  if (m_uploadFence != nullptr)
+  {
+    glDeleteSync(m_uploadFence);
+    m_uploadFence = nullptr;
+  }
+
+  if (m_pixelBuffer != 0)
+  {
+    m_mappedData = nullptr;
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_pixelBuffer);
+    glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    glDeleteBuffers(1, &m_pixelBuffer);
+
+    m_pixelBuffer = 0;
+  }
+}
@@ -12,23 +12,45 @@
 
 #include "system_gl.h"
 
+#include <atomic>
+
 namespace KODI
 {
 namespace RETRO
 {
 class CRenderContext;
 
+/*!
+ * \brief Render buffer for the OpenGL renderer
+ *
+ * Frames start out in system memory. If the driver supports persistently
+ * mapped buffers (GL_ARB_buffer_storage), a pixel buffer object is created on
+ * the first upload and from then on handed out by GetMemory(), so cores write
+ * their frames straight into memory the GPU uploads from without a CPU copy.
+ *
+ * A fence is placed after every upload from the pixel buffer, and SyncUpload()
+ * waits for it before the renderer gives the buffer back for writing.
+ */
 class CRenderBufferOpenGL : public CRenderBufferSysMem
 {
 public:
-  CRenderBufferOpenGL(GLuint pixeltype, GLuint internalformat, GLuint pixelformat, GLuint bpp);
+  CRenderBufferOpenGL(CRenderContext& context,
+                      GLuint pixeltype,
+                      GLuint internalformat,
+                      GLuint pixelformat,
+                      GLuint bpp);
   ~CRenderBufferOpenGL() override;
 
+  // implementation of IRenderBuffer via CRenderBufferSysMem
+  uint8_t* GetMemory() override;
   bool UploadTexture() override;
+  void SyncUpload() override;
+
   GLuint TextureID() const { return m_textureId; }
 
 private:
   // Construction parameters
+  CRenderContext& m_context;
   const GLuint m_pixeltype;
   const GLuint m_internalformat;
   const GLuint m_pixelformat;
@@ -37,8 +59,16 @@ private:
   const GLenum m_textureTarget = GL_TEXTURE_2D; //! @todo
   GLuint m_textureId = 0;
 
+  // Persistently mapped pixel buffer
+  GLuint m_pixelBuffer = 0;
+  std::atomic<uint8_t*> m_mappedData{nullptr};
+  GLsync m_uploadFence = nullptr;
+  bool m_pixelBufferFailed = false;
+
   void CreateTexture();
   void DeleteTexture();
+  bool CreatePixelBuffer();
+  void DeletePixelBuffer();
 };
 } // namespace RETRO
 } // namespace KODI
@@ -17,6 +17,10 @@
 using namespace KODI;
 using namespace RETRO;
 
+CRenderBufferPoolOpenGL::CRenderBufferPoolOpenGL(CRenderContext& context) : m_context(context)
+{
+}
+
 bool CRenderBufferPoolOpenGL::IsCompatible(const CRenderVideoSettings& renderSettings) const
 {
   return CRPRendererOpenGL::SupportsScalingMethod(renderSettings.GetScalingMethod());
@@ -24,7 +28,7 @@ bool CRenderBufferPoolOpenGL::IsCompatible(const CRenderVideoSettings& renderSet
 
 IRenderBuffer* CRenderBufferPoolOpenGL::CreateRenderBuffer(void* header /* = nullptr */)
 {
-  return new CRenderBufferOpenGL(m_pixeltype, m_internalformat, m_pixelformat, m_bpp);
+  return new CRenderBufferOpenGL(m_context, m_pixeltype, m_internalformat, m_pixelformat, m_bpp);
 }
 
 bool CRenderBufferPoolOpenGL::ConfigureInternal()
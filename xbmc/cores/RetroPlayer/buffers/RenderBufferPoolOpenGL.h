@@ -23,7 +23,7 @@ class CRenderVideoSettings;
 class CRenderBufferPoolOpenGL : public CBaseRenderBufferPool
 {
 public:
-  CRenderBufferPoolOpenGL() = default;
+  CRenderBufferPoolOpenGL(CRenderContext& context);
   ~CRenderBufferPoolOpenGL() override = default;
 
   // implementation of IRenderBufferPool via CBaseRenderBufferPool
@@ -35,6 +35,9 @@ protected:
   bool ConfigureInternal() override;
 
 private:
+  // Construction parameters
+  CRenderContext& m_context;
+
   // Configuration parameters
   GLuint m_pixeltype = 0;
   GLuint m_internalformat = 0;
@@ -16,13 +16,20 @@
 #include "games/addons/GameClient.h"
 #include "games/addons/cheevos/GameClientCheevos.h"
 #include "games/tags/GameInfoTag.h"
+#include "jobs/Job.h"
+#include "jobs/JobManager.h"
 #include "messaging/ApplicationMessenger.h"
 #include "utils/JSONVariantParser.h"
+#include "utils/JSONVariantWriter.h"
 #include "utils/Map.h"
 #include "utils/URIUtils.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
 
+#include <algorithm>
+#include <atomic>
+#include <ctime>
+#include <mutex>
 #include <string_view>
 #include <vector>
 
@@ -44,6 +51,17 @@ constexpr auto CONSOLE_NAME = "ConsoleName";
 
 constexpr int RESPONSE_SIZE = 64;
 
+// ROM hashes by game path, valid as long as size and modification time of the file match
+constexpr auto HASH_CACHE_FILE = "special://profile/cheevoshashes.json";
+constexpr auto HASH_SIZE = "size";
+constexpr auto HASH_MTIME = "mtime";
+constexpr auto HASH_CONSOLE = "console";
+constexpr auto HASH_VALUE = "hash";
+constexpr auto HASH_STORED = "stored";
+// the least recently stored hashes are dropped beyond this
+constexpr unsigned int MAX_HASH_CACHE_ENTRIES = 500;
+std::mutex hashCacheMutex;
+
 constexpr auto extensionToConsole = make_map<std::string_view, RConsoleID>({
     {".a26", RConsoleID::RC_CONSOLE_ATARI_2600},
     {".a78", RConsoleID::RC_CONSOLE_ATARI_7800},
@@ -84,46 +102,125 @@ constexpr auto extensionToConsole = make_map<std::string_view, RConsoleID>({
     {".voc", RConsoleID::RC_CONSOLE_AMSTRAD_PC},
     {".z64", RConsoleID::RC_CONSOLE_NINTENDO_64},
 });
-} // namespace
 
-CCheevos::CCheevos(GAME::CGameClient* gameClient,
-                   const std::string& userName,
-                   const std::string& loginToken)
-  : m_gameClient(gameClient),
-    m_userName(userName),
-    m_loginToken(loginToken)
+CVariant LoadHashCache()
 {
+  XFILE::CFile file;
+  std::vector<uint8_t> data;
+  CVariant cache(CVariant::VariantTypeObject);
+  if (XFILE::CFile::Exists(HASH_CACHE_FILE) && file.LoadFile(HASH_CACHE_FILE, data) > 0)
+  {
+    if (!CJSONVariantParser::Parse(std::string(data.begin(), data.end()), cache) ||
+        !cache.isObject())
+      cache = CVariant(CVariant::VariantTypeObject);
+  }
+  return cache;
 }
 
-void CCheevos::ResetRuntime()
+std::string GetCachedHash(const std::string& path,
+                          RConsoleID consoleID,
+                          const struct __stat64& stat)
 {
-  m_gameClient->Cheevos().RCResetRuntime();
+  std::unique_lock lock(hashCacheMutex);
+  const CVariant cache = LoadHashCache();
+  if (!cache.isMember(path))
+    return "";
+
+  const CVariant& entry = cache[path];
+  if (entry[HASH_SIZE].asInteger() != static_cast<int64_t>(stat.st_size) ||
+      entry[HASH_MTIME].asInteger() != static_cast<int64_t>(stat.st_mtime) ||
+      entry[HASH_CONSOLE].asInteger() != static_cast<int64_t>(consoleID))
+    return "";
+
+  return entry[HASH_VALUE].asString();
+}
+
+void StoreHash(const std::string& path,
+               RConsoleID consoleID,
+               const struct __stat64& stat,
+               const std::string& hash)
+{
+  std::unique_lock lock(hashCacheMutex);
+  CVariant cache = LoadHashCache();
+
+  CVariant entry(CVariant::VariantTypeObject);
+  entry[HASH_SIZE] = static_cast<int64_t>(stat.st_size);
+  entry[HASH_MTIME] = static_cast<int64_t>(stat.st_mtime);
+  entry[HASH_CONSOLE] = static_cast<int64_t>(consoleID);
+  entry[HASH_VALUE] = hash;
+  entry[HASH_STORED] = static_cast<int64_t>(std::time(nullptr));
+  cache[path] = entry;
+
+  while (cache.size() > MAX_HASH_CACHE_ENTRIES)
+  {
+    const auto oldest = std::ranges::min_element(
+        cache.begin_map(), cache.end_map(), {},
+        [](const auto& cached) { return cached.second[HASH_STORED].asInteger(); });
+    cache.erase(oldest->first);
+  }
+
+  std::string json;
+  XFILE::CFile file;
+  if (!CJSONVariantWriter::Write(cache, json, true) || !file.OpenForWrite(HASH_CACHE_FILE, true) ||
+      file.Write(json.data(), json.size()) != static_cast<ssize_t>(json.size()))
+    CLog::Log(LOGWARNING, "Cheevos: Couldn't write {}", HASH_CACHE_FILE);
 }
+} // namespace
+
+namespace KODI::RETRO
+{
+struct CheevosLoadState
+{
+  std::mutex mutex; //!< held while the game client is used
+  GAME::CGameClient* gameClient; //!< reset when the game ends, the job stops then
+  std::string gamePath;
+  RConsoleID consoleID;
+  std::string userName;
+  std::string loginToken;
+
+  // the results, to be read once finished
+  std::atomic<bool> finished{false};
+  bool loaded{false};
+  uint32_t gameID{};
+  std::string richPresenceScript;
+};
+} // namespace KODI::RETRO
 
-bool CCheevos::LoadData()
+namespace
 {
-  if (m_userName.empty() || m_loginToken.empty())
+// call into the game client, unless the game has ended meanwhile
+template<typename F>
+bool WithGameClient(CheevosLoadState& state, F function)
+{
+  std::unique_lock lock(state.mutex);
+  return state.gameClient && function(state.gameClient->Cheevos());
+}
+
+bool LoadData(CheevosLoadState& state)
+{
+  if (state.userName.empty() || state.loginToken.empty() ||
+      state.consoleID == RConsoleID::RC_INVALID_ID)
     return false;
 
-  if (m_romHash.empty())
+  // hashing reads the whole game, which takes a while for disc images
+  struct __stat64 stat{};
+  const bool hasStat = XFILE::CFile::Stat(state.gamePath, &stat) == 0;
+  std::string hash = hasStat ? GetCachedHash(state.gamePath, state.consoleID, stat) : "";
+  if (hash.empty())
   {
-    m_consoleID = ConsoleID();
-    if (m_consoleID == RConsoleID::RC_INVALID_ID)
+    const auto generateHash = [&state, &hash](GAME::CGameClientCheevos& cheevos)
+    { return cheevos.RCGenerateHashFromFile(hash, state.consoleID, state.gamePath.c_str()); };
+    if (!WithGameClient(state, generateHash))
       return false;
-
-    std::string hash;
-    if (!m_gameClient->Cheevos().RCGenerateHashFromFile(hash, m_consoleID,
-                                                        m_gameClient->GetGamePath().c_str()))
-    {
-      return false;
-    }
-
-    m_romHash = hash;
+    if (hasStat)
+      StoreHash(state.gamePath, state.consoleID, stat, hash);
   }
 
   std::string requestURL;
 
-  if (!m_gameClient->Cheevos().RCGetGameIDUrl(requestURL, m_romHash))
+  const auto getGameIDUrl = [&requestURL, &hash](GAME::CGameClientCheevos& cheevos)
+  { return cheevos.RCGetGameIDUrl(requestURL, hash); };
+  if (!WithGameClient(state, getGameIDUrl))
     return false;
 
   XFILE::CFile response;
@@ -141,13 +238,15 @@ bool CCheevos::LoadData()
   if (!data[SUCCESS].asBoolean())
     return false;
 
-  m_gameID = data[GAME_ID].asUnsignedInteger32();
+  const uint32_t gameID = data[GAME_ID].asUnsignedInteger32();
 
   // For some reason RetroAchievements returns Success = true when the hash isn't found
-  if (m_gameID == 0)
+  if (gameID == 0)
     return false;
 
-  if (!m_gameClient->Cheevos().RCGetPatchFileUrl(requestURL, m_userName, m_loginToken, m_gameID))
+  const auto getPatchFileUrl = [&state, &requestURL, gameID](GAME::CGameClientCheevos& cheevos)
+  { return cheevos.RCGetPatchFileUrl(requestURL, state.userName, state.loginToken, gameID); };
+  if (!WithGameClient(state, getPatchFileUrl))
     return false;
 
   CURL curl(requestURL);
@@ -160,8 +259,14 @@ bool CCheevos::LoadData()
   if (!data[SUCCESS].asBoolean())
     return false;
 
-  m_richPresenceScript = data[PATCH_DATA][RICH_PRESENCE].asString();
-  m_richPresenceLoaded = true;
+  {
+    std::unique_lock lock(state.mutex);
+    if (!state.gameClient)
+      return false;
+  }
+
+  state.gameID = gameID;
+  state.richPresenceScript = data[PATCH_DATA][RICH_PRESENCE].asString();
 
   std::unique_ptr<CFileItem> file{std::make_unique<CFileItem>()};
 
@@ -178,23 +283,93 @@ bool CCheevos::LoadData()
   return true;
 }
 
+class CCheevosLoadJob : public CJob
+{
+public:
+  explicit CCheevosLoadJob(std::shared_ptr<CheevosLoadState> state) : m_state(std::move(state)) {}
+
+  bool DoWork() override
+  {
+    m_state->loaded = LoadData(*m_state);
+    m_state->finished = true;
+    return m_state->loaded;
+  }
+
+  const char* GetType() const override { return "CheevosLoad"; }
+
+private:
+  const std::shared_ptr<CheevosLoadState> m_state;
+};
+} // namespace
+
+CCheevos::CCheevos(GAME::CGameClient* gameClient,
+                   const std::string& userName,
+                   const std::string& loginToken)
+  : m_gameClient(gameClient),
+    m_userName(userName),
+    m_loginToken(loginToken)
+{
+}
+
+void CCheevos::ResetRuntime()
+{
+  m_gameClient->Cheevos().RCResetRuntime();
+}
+
+CCheevos::~CCheevos()
+{
+  if (!m_loading)
+    return;
+
+  CServiceBroker::GetJobManager()->CancelJob(m_loadingJob);
+  // a running job stops at its next call into the game client, one in progress is waited for
+  std::unique_lock lock(m_loading->mutex);
+  m_loading->gameClient = nullptr;
+}
+
 void CCheevos::EnableRichPresence()
 {
-  if (!m_richPresenceLoaded)
+  if (m_loading || m_richPresenceLoaded)
+    return;
+
+  m_consoleID = ConsoleID();
+
+  // hashing the game and the requests to RetroAchievements don't hold up the start of the game,
+  // rich presence is enabled once they are done
+  m_loading = std::make_shared<CheevosLoadState>();
+  m_loading->gameClient = m_gameClient;
+  m_loading->gamePath = m_gameClient->GetGamePath();
+  m_loading->consoleID = m_consoleID;
+  m_loading->userName = m_userName;
+  m_loading->loginToken = m_loginToken;
+  m_loadingJob = CServiceBroker::GetJobManager()->AddJob(new CCheevosLoadJob(m_loading), nullptr);
+}
+
+bool CCheevos::FinishLoading()
+{
+  if (!m_loading)
+    return true;
+  if (!m_loading->finished)
+    return false;
+
+  const std::shared_ptr<CheevosLoadState> loading = std::move(m_loading);
+  if (!loading->loaded)
   {
-    if (!LoadData())
-    {
-      CLog::Log(LOGERROR, "Cheevos: Couldn't load patch file");
-      return;
-    }
+    CLog::Log(LOGERROR, "Cheevos: Couldn't load patch file");
+    return true;
   }
 
-  m_gameClient->Cheevos().RCEnableRichPresence(m_richPresenceScript);
-  m_richPresenceScript.clear();
+  m_gameID = loading->gameID;
+  m_richPresenceLoaded = true;
+  m_gameClient->Cheevos().RCEnableRichPresence(loading->richPresenceScript);
+  return true;
 }
 
 std::string CCheevos::GetRichPresenceEvaluation()
 {
+  if (!FinishLoading())
+    return "";
+
   if (!m_richPresenceLoaded)
   {
     CLog::Log(LOGERROR, "Cheevos: Rich Presence script was not found");
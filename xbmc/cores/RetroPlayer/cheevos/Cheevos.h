@@ -11,6 +11,7 @@
 #include "RConsoleIDs.h"
 
 #include <cstdint>
+#include <memory>
 #include <string>
 
 namespace KODI
@@ -22,28 +23,48 @@ class CGameClient;
 
 namespace RETRO
 {
+struct CheevosLoadState;
+
 class CCheevos
 {
 public:
   CCheevos(GAME::CGameClient* gameClient,
            const std::string& userName,
            const std::string& loginToken);
+  ~CCheevos();
+
   void ResetRuntime();
+
+  /*!
+   * \brief Start loading the game data from RetroAchievements in the background.
+   *
+   * The ROM hash is cached by path, size and modification time, so only the first launch of a
+   * game pays for hashing it. Ending the game cancels the loading, only a call into the game
+   * client still in progress is waited for.
+   */
   void EnableRichPresence();
+
+  /*!
+   * \brief Get the current rich presence, empty while the game data is still loading.
+   */
   std::string GetRichPresenceEvaluation();
 
 private:
-  bool LoadData();
+  /*!
+   * \brief Enable rich presence once the data is loaded.
+   * \return false while loading is still in progress
+   */
+  bool FinishLoading();
   RConsoleID ConsoleID();
 
   GAME::CGameClient* const m_gameClient;
   std::string m_userName;
   std::string m_loginToken;
-  std::string m_romHash;
-  std::string m_richPresenceScript;
   uint32_t m_gameID{};
   RConsoleID m_consoleID = RConsoleID::RC_INVALID_ID;
   bool m_richPresenceLoaded{};
+  std::shared_ptr<CheevosLoadState> m_loading; //!< shared with the job loading the game data
+  unsigned int m_loadingJob{0};
 };
 } // namespace RETRO
 } // namespace KODI
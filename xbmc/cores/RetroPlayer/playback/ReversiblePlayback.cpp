@@ -26,6 +26,7 @@
 #include "utils/log.h"
 
 #include <algorithm>
+#include <chrono>
 #include <memory>
 #include <mutex>
 
@@ -48,6 +49,7 @@ CReversiblePlayback::CReversiblePlayback(GAME::CGameClient* gameClient,
     m_savestateDatabase(new CSavestateDatabase)
 {
   UpdateMemoryStream();
+  UpdateRunAhead();
 
   GAME::CGameSettings& gameSettings = CServiceBroker::GetGameServices().GameSettings();
   gameSettings.RegisterObserver(this);
@@ -257,7 +259,7 @@ void CReversiblePlayback::CommitSavestate(bool autosave,
   if (success)
   {
     std::string thumbnailPath = CSavestateDatabase::MakeThumbnailPath(savePath);
-    m_renderManager.SaveThumbnail(thumbnailPath);
+    m_renderManager.SaveThumbnail(*savestate, thumbnailPath);
   }
 
   // Notify the GUI that the metadata for this savestate should be refreshed
@@ -311,11 +313,65 @@ bool CReversiblePlayback::LoadSavestate(const std::string& savestatePath)
 
 void CReversiblePlayback::FrameEvent()
 {
-  m_gameClient->RunFrame();
+  const unsigned int runAheadFrames = m_runAheadFrames;
+  if (runAheadFrames == 0 || !RunAhead(runAheadFrames))
+    m_gameClient->RunFrame();
 
   AddFrame();
 }
 
+bool CReversiblePlayback::RunAhead(unsigned int frames)
+{
+  const size_t stateSize = m_gameClient->SerializeSize();
+  if (stateSize == 0)
+    return false;
+
+  if (m_runAheadState.size() != stateSize)
+    m_runAheadState.resize(stateSize);
+
+  const auto start = std::chrono::steady_clock::now();
+
+  // Run the real frame. Its audio is played, its video is replaced by the
+  // video of the last frame run ahead.
+  m_gameClient->SetStreamOutput(true, false);
+  m_gameClient->RunFrame();
+
+  if (m_gameClient->Serialize(m_runAheadState.data(), m_runAheadState.size()))
+  {
+    // Run ahead with the same input, only presenting the last frame
+    for (unsigned int frame = 1; frame <= frames; frame++)
+    {
+      m_gameClient->SetStreamOutput(false, frame == frames);
+      m_gameClient->RunFrame();
+    }
+
+    // Roll back to the real frame
+    m_gameClient->Deserialize(m_runAheadState.data(), m_runAheadState.size());
+  }
+  else
+  {
+    CLog::Log(LOGERROR, "RetroPlayer[PLAYBACK]: Failed to serialize state, disabling run-ahead");
+    m_runAheadFrames = 0;
+  }
+
+  m_gameClient->SetStreamOutput(true, true);
+
+  // Run-ahead only lowers latency if all frames fit in the frame time
+  const std::chrono::duration<double, std::milli> elapsed =
+      std::chrono::steady_clock::now() - start;
+  const double frameTimeMs = 1000.0 / m_gameLoop.FPS();
+  if (!m_runAheadTooSlow && elapsed.count() > frameTimeMs)
+  {
+    CLog::Log(LOGWARNING,
+              "RetroPlayer[PLAYBACK]: Running {} frames ahead took {:.2f} ms, more than the "
+              "frame time of {:.2f} ms",
+              frames, elapsed.count(), frameTimeMs);
+    m_runAheadTooSlow = true;
+  }
+
+  return true;
+}
+
 void CReversiblePlayback::RewindEvent()
 {
   RewindFrames(1);
@@ -387,6 +443,7 @@ void CReversiblePlayback::Notify(const Observable& obs, const ObservableMessage
   {
     case ObservableMessageSettingsChanged:
       UpdateMemoryStream();
+      UpdateRunAhead();
       break;
     default:
       break;
@@ -435,3 +492,22 @@ void CReversiblePlayback::UpdateMemoryStream()
     m_cacheTimeMs = 0;
   }
 }
+
+void CReversiblePlayback::UpdateRunAhead()
+{
+  unsigned int runAheadFrames = 0;
+
+  if (m_gameClient->SerializeSize() > 0)
+  {
+    GAME::CGameSettings& gameSettings = CServiceBroker::GetGameServices().GameSettings();
+    runAheadFrames = gameSettings.RunAheadFrames();
+  }
+
+  if (runAheadFrames != m_runAheadFrames)
+  {
+    CLog::Log(LOGDEBUG,
+              "RetroPlayer[PLAYBACK]: Running {} frames ahead, removing {:.1f} ms of input latency",
+              runAheadFrames, 1000.0 * runAheadFrames / m_gameLoop.FPS());
+    m_runAheadFrames = runAheadFrames;
+  }
+}
@@ -13,10 +13,12 @@
 #include "threads/CriticalSection.h"
 #include "utils/Observer.h"
 
+#include <atomic>
 #include <future>
 #include <memory>
 #include <stddef.h>
 #include <stdint.h>
+#include <vector>
 
 class CDateTime;
 
@@ -75,6 +77,8 @@ private:
   void AdvanceFrames(uint64_t frames);
   void UpdatePlaybackStats();
   void UpdateMemoryStream();
+  bool RunAhead(unsigned int frames);
+  void UpdateRunAhead();
   void CommitSavestate(bool autosave,
                        const std::string& savePath,
                        const CDateTime& nowUTC,
@@ -91,6 +95,11 @@ private:
   std::unique_ptr<IMemoryStream> m_memoryStream;
   CCriticalSection m_mutex;
 
+  // Run-ahead functionality
+  std::atomic<unsigned int> m_runAheadFrames{0};
+  std::vector<uint8_t> m_runAheadState; // Only accessed by the game loop
+  bool m_runAheadTooSlow = false;
+
   // Savestate functionality
   std::unique_ptr<CSavestateDatabase> m_savestateDatabase;
   std::string m_autosavePath{};
@@ -796,50 +796,23 @@ CRenderVideoSettings CRPRenderManager::GetEffectiveSettings(
   return effectiveSettings;
 }
 
-void CRPRenderManager::SaveThumbnail(const std::string& thumbnailPath)
+void CRPRenderManager::SaveThumbnail(const ISavestate& savestate, const std::string& thumbnailPath)
 {
-  // Get a suitable render buffer for capturing the video data, or use the
-  // cached frame if a readable buffer can't be found
-  IRenderBuffer* renderBuffer = nullptr;
-  std::vector<uint8_t> cachedFrame;
-
-  GetVideoFrame(renderBuffer, cachedFrame);
-
-  // Video frame properties
-  AVPixelFormat sourceFormat = AV_PIX_FMT_NONE;
-  const uint8_t* sourceData = nullptr;
-  size_t sourceSize = 0;
-  unsigned int width = 0;
-  unsigned int height = 0;
-  unsigned int rotationCCW = 0;
-
-  if (renderBuffer != nullptr)
-  {
-    sourceFormat = renderBuffer->GetFormat();
-    sourceData = renderBuffer->GetMemory();
-    sourceSize = renderBuffer->GetFrameSize();
-    width = renderBuffer->GetWidth();
-    height = renderBuffer->GetHeight();
-    rotationCCW = renderBuffer->GetRotation();
-  }
-  else if (!cachedFrame.empty())
-  {
-    sourceFormat = m_format;
-    sourceData = m_cachedFrame.data();
-    sourceSize = m_cachedFrame.size();
-    width = m_cachedWidth;
-    height = m_cachedHeight;
-    rotationCCW = m_cachedRotationCCW;
-  }
-
-  if (sourceFormat == AV_PIX_FMT_NONE)
+  // The thumbnail is scaled from the frame already captured in the savestate,
+  // so no render buffer has to be acquired or copied again
+  const AVPixelFormat sourceFormat = savestate.GetPixelFormat();
+  const uint8_t* const sourceData = savestate.GetVideoData();
+  const unsigned int width = savestate.GetVideoWidth();
+  const unsigned int height = savestate.GetVideoHeight();
+  const unsigned int rotationCCW = savestate.GetRotationDegCCW();
+
+  if (sourceFormat == AV_PIX_FMT_NONE || sourceData == nullptr || savestate.GetVideoSize() == 0 ||
+      width == 0 || height == 0)
   {
     CLog::Log(LOGERROR, "Failed to get a video frame for savestate thumbnail");
     return;
   }
 
-  std::vector<uint8_t> copiedData(sourceData, sourceData + sourceSize);
-
   const int stride = CRenderTranslator::TranslateWidthToBytes(width, sourceFormat);
 
   unsigned int scaleWidth = 400;
@@ -852,7 +825,8 @@ void CRPRenderManager::SaveThumbnail(const std::string& thumbnailPath)
   const AVPixelFormat outFormat = AV_PIX_FMT_BGR0;
   const int scaleStride = CRenderTranslator::TranslateWidthToBytes(scaleWidth, outFormat);
 
-  if (CPicture::ScaleImage(copiedData.data(), width, height, stride, sourceFormat,
+  // ScaleImage() only reads from the source
+  if (CPicture::ScaleImage(const_cast<uint8_t*>(sourceData), width, height, stride, sourceFormat,
                            scaledImage.data(), scaleWidth, scaleHeight, scaleStride, outFormat))
   {
     //! @todo Rotate image by rotationCCW
@@ -866,8 +840,6 @@ void CRPRenderManager::SaveThumbnail(const std::string& thumbnailPath)
     CLog::Log(LOGERROR, "Failed to scale image from size {}x{} to size {}x{}", width, height,
               scaleWidth, scaleHeight);
   }
-
-  FreeVideoFrame(renderBuffer, std::move(cachedFrame));
 }
 
 void CRPRenderManager::CacheVideoFrame(const std::string& savestatePath)
@@ -896,7 +868,7 @@ void CRPRenderManager::SaveVideoFrame(const std::string& savestatePath, ISavesta
   IRenderBuffer* readableBuffer = nullptr;
   std::vector<uint8_t> cachedFrame;
 
-  GetVideoFrame(readableBuffer, cachedFrame);
+  GetVideoFrame(savestatePath, readableBuffer, cachedFrame);
 
   // Video frame properties
   AVPixelFormat targetFormat = AV_PIX_FMT_NONE;
@@ -924,8 +896,8 @@ void CRPRenderManager::SaveVideoFrame(const std::string& savestatePath, ISavesta
     height = m_cachedHeight;
     displayAspectRatio = m_cachedDisplayAspectRatio;
     rotationCCW = m_cachedRotationCCW;
-    sourceSize = m_cachedFrame.size();
-    sourceData = m_cachedFrame.data();
+    sourceSize = cachedFrame.size();
+    sourceData = cachedFrame.data();
   }
 
   if (targetFormat == AV_PIX_FMT_NONE)
@@ -967,15 +939,32 @@ void CRPRenderManager::ClearVideoFrame(const std::string& savestatePath)
   }
 }
 
-void CRPRenderManager::GetVideoFrame(IRenderBuffer*& readableBuffer,
+void CRPRenderManager::GetVideoFrame(const std::string& savestatePath,
+                                     IRenderBuffer*& readableBuffer,
                                      std::vector<uint8_t>& cachedFrame)
 {
   std::unique_lock lock(m_bufferMutex);
 
+  const auto isReadable = [](const IRenderBuffer* renderBuffer)
+  { return renderBuffer->GetMemoryAccess() != DataAccess::WRITE_ONLY; };
+
+  // Prefer the buffers captured by CacheVideoFrame() so that the frame matches
+  // the moment the savestate was requested, even if the game loop has moved on
+  auto savestateBuffers = m_savestateBuffers.find(savestatePath);
+  if (savestateBuffers != m_savestateBuffers.end())
+  {
+    auto it = std::find_if(savestateBuffers->second.begin(), savestateBuffers->second.end(),
+                           isReadable);
+    if (it != savestateBuffers->second.end())
+    {
+      readableBuffer = *it;
+      readableBuffer->Acquire();
+      return;
+    }
+  }
+
   // Get a readable render buffer
-  auto it = std::find_if(m_renderBuffers.begin(), m_renderBuffers.end(),
-                         [](const IRenderBuffer* renderBuffer)
-                         { return renderBuffer->GetMemoryAccess() != DataAccess::WRITE_ONLY; });
+  auto it = std::find_if(m_renderBuffers.begin(), m_renderBuffers.end(), isReadable);
 
   // Acquire buffer if one was found
   if (it != m_renderBuffers.end())
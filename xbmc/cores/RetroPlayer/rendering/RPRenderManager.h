@@ -129,7 +129,7 @@ public:
   bool SupportsScalingMethod(SCALINGMETHOD method) const override;
 
   // Savestate functions
-  void SaveThumbnail(const std::string& thumbnailPath);
+  void SaveThumbnail(const ISavestate& savestate, const std::string& thumbnailPath);
 
   // Savestate functions
   void CacheVideoFrame(const std::string& savestatePath);
@@ -220,7 +220,9 @@ private:
 
   void CheckFlush();
 
-  void GetVideoFrame(IRenderBuffer*& readableBuffer, std::vector<uint8_t>& cachedFrame);
+  void GetVideoFrame(const std::string& savestatePath,
+                     IRenderBuffer*& readableBuffer,
+                     std::vector<uint8_t>& cachedFrame);
   void FreeVideoFrame(IRenderBuffer* readableBuffer, std::vector<uint8_t> cachedFrame);
   void LoadVideoFrameAsync(const std::string& savestatePath);
   void LoadVideoFrameSync(const std::string& savestatePath);
@@ -102,7 +102,11 @@ void CRPBaseRenderer::SetBuffer(IRenderBuffer* buffer)
   if (m_renderBuffer != buffer)
   {
     if (m_renderBuffer != nullptr)
+    {
+      // The GPU may still be reading the buffer, wait before it can be written again
+      m_renderBuffer->SyncUpload();
       m_renderBuffer->Release();
+    }
 
     m_renderBuffer = buffer;
 
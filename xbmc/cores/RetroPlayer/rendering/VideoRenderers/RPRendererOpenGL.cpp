@@ -40,7 +40,7 @@ CRPBaseRenderer* CRendererFactoryOpenGL::CreateRenderer(
 
 RenderBufferPoolVector CRendererFactoryOpenGL::CreateBufferPools(CRenderContext& context)
 {
-  return {std::make_shared<CRenderBufferPoolOpenGL>()};
+  return {std::make_shared<CRenderBufferPoolOpenGL>(context)};
 }
 
 // --- CRPRendererOpenGL -------------------------------------------------------
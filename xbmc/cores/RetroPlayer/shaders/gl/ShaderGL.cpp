@@ -14,6 +14,7 @@
 #include "cores/RetroPlayer/rendering/RenderContext.h"
 #include "cores/RetroPlayer/shaders/IShaderLut.h"
 #include "cores/RetroPlayer/shaders/ShaderUtils.h"
+#include "rendering/GLProgramCache.h"
 #include "rendering/gl/RenderSystemGL.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
@@ -60,6 +61,54 @@ bool CShaderGL::Create(std::string shaderSource,
   const GLchar* vertexShaderSource = vertexShaderSourceStr.c_str();
   const GLchar* fragmentShaderSource = fragmentShaderSourceStr.c_str();
 
+  // Skip compiling if the driver accepts the program binary from a previous run
+  const std::string cacheKey =
+      CGLProgramCache::MakeKey({vertexShaderSourceStr, fragmentShaderSourceStr});
+
+  if (!CGLProgramCache::LoadProgram(m_shaderProgram, cacheKey))
+  {
+    if (!CompileProgram(vertexShaderSource, fragmentShaderSource))
+      return false;
+
+    CGLProgramCache::SaveProgram(m_shaderProgram, cacheKey);
+  }
+
+  glUseProgram(m_shaderProgram);
+  GLint paramLoc = glGetUniformLocation(m_shaderProgram, "Texture");
+  glUniform1i(paramLoc, 0);
+  glUseProgram(0);
+
+  GetUniformLocs();
+
+  glGenVertexArrays(1, &m_shaderVAO);
+  glBindVertexArray(m_shaderVAO);
+
+  glGenBuffers(3, m_shaderVertexVBO.data());
+
+  glBindBuffer(GL_ARRAY_BUFFER, m_shaderVertexVBO[0]);
+  glEnableVertexAttribArray(0);
+  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), nullptr);
+
+  glBindBuffer(GL_ARRAY_BUFFER, m_shaderVertexVBO[1]);
+  glEnableVertexAttribArray(1);
+  glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), nullptr);
+
+  glBindBuffer(GL_ARRAY_BUFFER, m_shaderVertexVBO[2]);
+  glEnableVertexAttribArray(2);
+  glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), nullptr);
+
+  glGenBuffers(1, &m_shaderIndexVBO);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_shaderIndexVBO);
+
+  glBindVertexArray(0);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+  return true;
+}
+
+bool CShaderGL::CompileProgram(const GLchar* vertexShaderSource,
+                               const GLchar* fragmentShaderSource)
+{
   GLint status;
   GLuint vShader;
   GLuint fShader;
@@ -75,7 +124,7 @@ bool CShaderGL::Create(std::string shaderSource,
     glGetShaderiv(vShader, GL_INFO_LOG_LENGTH, &maxLength);
     std::vector<GLchar> errorLog(maxLength);
     glGetShaderInfoLog(vShader, maxLength, &maxLength, errorLog.data());
-    CLog::Log(LOGERROR, "CShaderGL::Create: Vertex shader compile error:\n{}",
+    CLog::Log(LOGERROR, "CShaderGL::CompileProgram: Vertex shader compile error:\n{}",
               std::string(errorLog.begin(), errorLog.end()));
   }
 
@@ -90,7 +139,7 @@ bool CShaderGL::Create(std::string shaderSource,
     glGetShaderiv(fShader, GL_INFO_LOG_LENGTH, &maxLength);
     std::vector<GLchar> errorLog(maxLength);
     glGetShaderInfoLog(fShader, maxLength, &maxLength, errorLog.data());
-    CLog::Log(LOGERROR, "CShaderGL::Create: Fragment shader compile error:\n{}",
+    CLog::Log(LOGERROR, "CShaderGL::CompileProgram: Fragment shader compile error:\n{}",
               std::string(errorLog.begin(), errorLog.end()));
   }
 
@@ -98,6 +147,8 @@ bool CShaderGL::Create(std::string shaderSource,
   glBindAttribLocation(m_shaderProgram, 1, "COLOR");
   glBindAttribLocation(m_shaderProgram, 2, "TexCoord");
 
+  CGLProgramCache::PrepareProgram(m_shaderProgram);
+
   glAttachShader(m_shaderProgram, vShader);
   glAttachShader(m_shaderProgram, fShader);
   glLinkProgram(m_shaderProgram);
@@ -111,42 +162,13 @@ bool CShaderGL::Create(std::string shaderSource,
     glGetProgramiv(m_shaderProgram, GL_INFO_LOG_LENGTH, &maxLength);
     std::vector<GLchar> errorLog(maxLength);
     glGetProgramInfoLog(m_shaderProgram, maxLength, &maxLength, errorLog.data());
-    CLog::Log(LOGERROR, "CShaderGL::Create: Shader program link error:\n{}",
+    CLog::Log(LOGERROR, "CShaderGL::CompileProgram: Shader program link error:\n{}",
               std::string(errorLog.begin(), errorLog.end()));
-    CLog::Log(LOGERROR, "CShaderGL::Create: Failed to load video shader: {}", m_shaderPath);
+    CLog::Log(LOGERROR, "CShaderGL::CompileProgram: Failed to load video shader: {}",
+              m_shaderPath);
     return false;
   }
 
-  glUseProgram(m_shaderProgram);
-  GLint paramLoc = glGetUniformLocation(m_shaderProgram, "Texture");
-  glUniform1i(paramLoc, 0);
-  glUseProgram(0);
-
-  GetUniformLocs();
-
-  glGenVertexArrays(1, &m_shaderVAO);
-  glBindVertexArray(m_shaderVAO);
-
-  glGenBuffers(3, m_shaderVertexVBO.data());
-
-  glBindBuffer(GL_ARRAY_BUFFER, m_shaderVertexVBO[0]);
-  glEnableVertexAttribArray(0);
-  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), nullptr);
-
-  glBindBuffer(GL_ARRAY_BUFFER, m_shaderVertexVBO[1]);
-  glEnableVertexAttribArray(1);
-  glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), nullptr);
-
-  glBindBuffer(GL_ARRAY_BUFFER, m_shaderVertexVBO[2]);
-  glEnableVertexAttribArray(2);
-  glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), nullptr);
-
-  glGenBuffers(1, &m_shaderIndexVBO);
-  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_shaderIndexVBO);
-
-  glBindVertexArray(0);
-  glBindBuffer(GL_ARRAY_BUFFER, 0);
-
   return true;
 }
 
@@ -67,6 +67,7 @@ private:
   UniformInputs GetInputData(uint64_t frameCount = 0) const;
   UniformFrameInputs GetFrameInputData(GLuint texture) const;
   UniformFrameInputs GetFrameUniformInputs() const { return m_uniformFrameInputs; }
+  bool CompileProgram(const GLchar* vertexShaderSource, const GLchar* fragmentShaderSource);
   void GetUniformLocs();
   void SetShaderParameters(CGLTexture& sourceTexture);
 
@@ -14,6 +14,7 @@
 #include "cores/RetroPlayer/rendering/RenderContext.h"
 #include "cores/RetroPlayer/shaders/IShaderLut.h"
 #include "cores/RetroPlayer/shaders/ShaderUtils.h"
+#include "rendering/GLProgramCache.h"
 #include "rendering/gl/RenderSystemGL.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
@@ -58,6 +59,34 @@ bool CShaderGLES::Create(std::string shaderSource,
   const GLchar* vertexShaderSource = vertexShaderSourceStr.c_str();
   const GLchar* fragmentShaderSource = fragmentShaderSourceStr.c_str();
 
+  // Skip compiling if the driver accepts the program binary from a previous run
+  const std::string cacheKey =
+      CGLProgramCache::MakeKey({vertexShaderSourceStr, fragmentShaderSourceStr});
+
+  if (!CGLProgramCache::LoadProgram(m_shaderProgram, cacheKey))
+  {
+    if (!CompileProgram(vertexShaderSource, fragmentShaderSource))
+      return false;
+
+    CGLProgramCache::SaveProgram(m_shaderProgram, cacheKey);
+  }
+
+  glUseProgram(m_shaderProgram);
+  GLint paramLoc = glGetUniformLocation(m_shaderProgram, "Texture");
+  glUniform1i(paramLoc, 0);
+  glUseProgram(0);
+
+  GetUniformLocs();
+
+  glGenBuffers(3, m_shaderVertexVBO.data());
+  glGenBuffers(1, &m_shaderIndexVBO);
+
+  return true;
+}
+
+bool CShaderGLES::CompileProgram(const GLchar* vertexShaderSource,
+                                 const GLchar* fragmentShaderSource)
+{
   GLint status;
   GLuint vShader;
   GLuint fShader;
@@ -73,7 +102,7 @@ bool CShaderGLES::Create(std::string shaderSource,
     glGetShaderiv(vShader, GL_INFO_LOG_LENGTH, &maxLength);
     std::vector<GLchar> errorLog(maxLength);
     glGetShaderInfoLog(vShader, maxLength, &maxLength, errorLog.data());
-    CLog::Log(LOGERROR, "CShaderGLES::Create: Vertex shader compile error:\n{}",
+    CLog::Log(LOGERROR, "CShaderGLES::CompileProgram: Vertex shader compile error:\n{}",
               std::string(errorLog.begin(), errorLog.end()));
   }
 
@@ -88,7 +117,7 @@ bool CShaderGLES::Create(std::string shaderSource,
     glGetShaderiv(fShader, GL_INFO_LOG_LENGTH, &maxLength);
     std::vector<GLchar> errorLog(maxLength);
     glGetShaderInfoLog(fShader, maxLength, &maxLength, errorLog.data());
-    CLog::Log(LOGERROR, "CShaderGLES::Create: Fragment shader compile error:\n{}",
+    CLog::Log(LOGERROR, "CShaderGLES::CompileProgram: Fragment shader compile error:\n{}",
               std::string(errorLog.begin(), errorLog.end()));
   }
 
@@ -96,6 +125,8 @@ bool CShaderGLES::Create(std::string shaderSource,
   glBindAttribLocation(m_shaderProgram, 1, "COLOR");
   glBindAttribLocation(m_shaderProgram, 2, "TexCoord");
 
+  CGLProgramCache::PrepareProgram(m_shaderProgram);
+
   glAttachShader(m_shaderProgram, vShader);
   glAttachShader(m_shaderProgram, fShader);
   glLinkProgram(m_shaderProgram);
@@ -109,22 +140,13 @@ bool CShaderGLES::Create(std::string shaderSource,
     glGetProgramiv(m_shaderProgram, GL_INFO_LOG_LENGTH, &maxLength);
     std::vector<GLchar> errorLog(maxLength);
     glGetProgramInfoLog(m_shaderProgram, maxLength, &maxLength, errorLog.data());
-    CLog::Log(LOGERROR, "CShaderGLES::Create: Shader program link error:\n{}",
+    CLog::Log(LOGERROR, "CShaderGLES::CompileProgram: Shader program link error:\n{}",
               std::string(errorLog.begin(), errorLog.end()));
-    CLog::Log(LOGERROR, "CShaderGLES::Create: Failed to load video shader: {}", m_shaderPath);
+    CLog::Log(LOGERROR, "CShaderGLES::CompileProgram: Failed to load video shader: {}",
+              m_shaderPath);
     return false;
   }
 
-  glUseProgram(m_shaderProgram);
-  GLint paramLoc = glGetUniformLocation(m_shaderProgram, "Texture");
-  glUniform1i(paramLoc, 0);
-  glUseProgram(0);
-
-  GetUniformLocs();
-
-  glGenBuffers(3, m_shaderVertexVBO.data());
-  glGenBuffers(1, &m_shaderIndexVBO);
-
   return true;
 }
 
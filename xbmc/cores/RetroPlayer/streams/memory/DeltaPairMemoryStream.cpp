@@ -10,14 +10,63 @@
 
 #include "utils/log.h"
 
+#if defined(HAVE_SSE2) && defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(HAS_NEON) && defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
 using namespace KODI;
 using namespace RETRO;
 
+namespace
+{
+/*!
+ * \brief Find the first word in [pos, size) that differs between the frames
+ *
+ * \return The position of the word, or size if the ranges are equal
+ */
+size_t FindChangedWord(const uint32_t* currentFrame,
+                       const uint32_t* nextFrame,
+                       size_t pos,
+                       size_t size)
+{
+  // Skip unchanged blocks four words at a time, the scalar loop below
+  // locates the changed word inside a block
+#if defined(HAVE_SSE2) && defined(__SSE2__)
+  for (; pos + 4 <= size; pos += 4)
+  {
+    const __m128i current = _mm_loadu_si128(reinterpret_cast<const __m128i*>(currentFrame + pos));
+    const __m128i next = _mm_loadu_si128(reinterpret_cast<const __m128i*>(nextFrame + pos));
+    if (_mm_movemask_epi8(_mm_cmpeq_epi32(current, next)) != 0xFFFF)
+      break;
+  }
+#elif defined(HAS_NEON) && defined(__ARM_NEON) && defined(__aarch64__)
+  for (; pos + 4 <= size; pos += 4)
+  {
+    const uint32x4_t equal = vceqq_u32(vld1q_u32(currentFrame + pos), vld1q_u32(nextFrame + pos));
+    if (vminvq_u32(equal) == 0)
+      break;
+  }
+#endif
+
+  for (; pos < size; pos++)
+  {
+    if (currentFrame[pos] != nextFrame[pos])
+      break;
+  }
+
+  return pos;
+}
+} // namespace
+
 void CDeltaPairMemoryStream::Reset()
 {
   CLinearMemoryStream::Reset();
 
   m_rewindBuffer.clear();
+  m_deltaScratch.clear();
+  m_deltaScratch.shrink_to_fit();
 }
 
 void CDeltaPairMemoryStream::SubmitFrameInternal()
@@ -28,19 +77,31 @@ void CDeltaPairMemoryStream::SubmitFrameInternal()
   // Record frame history
   frame.frameHistoryCount = m_currentFrameHistory++;
 
-  uint32_t* currentFrame = m_currentFrame.get();
-  uint32_t* nextFrame = m_nextFrame.get();
+  const uint32_t* currentFrame = m_currentFrame.get();
+  const uint32_t* nextFrame = m_nextFrame.get();
+  const size_t frameSize = m_paddedFrameSize;
 
-  for (size_t i = 0; i < m_paddedFrameSize; i++)
+  m_deltaScratch.clear();
+  size_t pos = FindChangedWord(currentFrame, nextFrame, 0, frameSize);
+  while (pos < frameSize)
   {
-    uint32_t xor_val = currentFrame[i] ^ nextFrame[i];
-    if (xor_val)
-    {
-      DeltaPair pair = {i, xor_val};
-      frame.buffer.push_back(pair);
-    }
+    // Extend the run over single unchanged words, storing a zero word is
+    // cheaper than starting a new run
+    size_t end = pos + 1;
+    while (end < frameSize && (currentFrame[end] != nextFrame[end] ||
+                               (end + 1 < frameSize && currentFrame[end + 1] != nextFrame[end + 1])))
+      end++;
+
+    m_deltaScratch.push_back(static_cast<uint32_t>(pos));
+    m_deltaScratch.push_back(static_cast<uint32_t>(end - pos));
+    for (size_t i = pos; i < end; i++)
+      m_deltaScratch.push_back(currentFrame[i] ^ nextFrame[i]);
+
+    pos = FindChangedWord(currentFrame, nextFrame, end, frameSize);
   }
 
+  frame.buffer.assign(m_deltaScratch.begin(), m_deltaScratch.end());
+
   // Delta is generated, bring the new frame forward (m_nextFrame is now disposable)
   std::swap(m_currentFrame, m_nextFrame);
 
@@ -65,14 +126,21 @@ uint64_t CDeltaPairMemoryStream::RewindFrames(uint64_t frameCount)
       break;
 
     const MemoryFrame& frame = m_rewindBuffer.back();
-    const DeltaPair* buffer = frame.buffer.data();
+    const uint32_t* buffer = frame.buffer.data();
+    const uint32_t* bufferEnd = buffer + frame.buffer.size();
 
-    size_t bufferSize = frame.buffer.size();
+    while (buffer < bufferEnd)
+    {
+      uint32_t* currentFrame = m_currentFrame.get() + buffer[0];
+      const uint32_t runLength = buffer[1];
+      const uint32_t* delta = buffer + 2;
+
+      // contiguous run, vectorized by the compiler
+      for (uint32_t i = 0; i < runLength; i++)
+        currentFrame[i] ^= delta[i];
 
-    // buffer pointer redirection violates data-dependency requirements...
-    // no vectorization for us :(
-    for (size_t i = 0; i < bufferSize; i++)
-      m_currentFrame[buffer[i].pos] ^= buffer[i].delta;
+      buffer = delta + runLength;
+    }
 
     // Restore frame history
     m_currentFrameHistory = frame.frameHistoryCount;
@@ -44,24 +44,26 @@ protected:
    * of original save state size depending on the system. The algorithm runs
    * on 32 bits at a time for speed.
    *
+   * Changed words are stored as runs: a word holding the position of the run,
+   * a word holding its length and the XORed words themselves. Save states
+   * change in clusters, so this needs little more than one word per changed
+   * word and rewinding is a contiguous XOR per run.
+   *
    * Use std::deque here to achieve amortized O(1) on pop/push to front and
    * back.
    */
-  struct DeltaPair
-  {
-    size_t pos;
-    uint32_t delta;
-  };
-
-  using DeltaPairVector = std::vector<DeltaPair>;
+  using DeltaBuffer = std::vector<uint32_t>;
 
   struct MemoryFrame
   {
-    DeltaPairVector buffer;
+    DeltaBuffer buffer;
     uint64_t frameHistoryCount;
   };
 
   std::deque<MemoryFrame> m_rewindBuffer;
+
+  // Reused between frames so each frame's delta is stored at its exact size
+  DeltaBuffer m_deltaScratch;
 };
 } // namespace RETRO
 } // namespace KODI
@@ -43,7 +43,10 @@ CAudioSinkAE::~CAudioSinkAE()
   std::unique_lock lock(m_critSection);
 }
 
-bool CAudioSinkAE::Create(const DVDAudioFrame &audioframe, AVCodecID codec, bool needresampler)
+bool CAudioSinkAE::Create(const DVDAudioFrame& audioframe,
+                          AVCodecID codec,
+                          bool needresampler,
+                          bool realtime)
 {
   CLog::Log(LOGINFO, "Creating audio stream (codec id: {}, channels: {}, sample rate: {}, {})",
             codec, audioframe.format.m_channelLayout.Count(), audioframe.format.m_sampleRate,
@@ -53,6 +56,8 @@ bool CAudioSinkAE::Create(const DVDAudioFrame &audioframe, AVCodecID codec, bool
   std::unique_lock lock(m_critSection);
   unsigned int options = needresampler && !audioframe.passthrough ? AESTREAM_FORCE_RESAMPLE : 0;
   options |= AESTREAM_PAUSED;
+  // live streams want to stay close to the source, files can afford long sink buffers
+  options |= realtime ? AESTREAM_LOW_LATENCY : AESTREAM_HIGH_LATENCY;
 
   AEAudioFormat format = audioframe.format;
   m_pAudioStream = CServiceBroker::GetActiveAE()->MakeStream(
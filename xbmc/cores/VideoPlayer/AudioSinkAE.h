@@ -36,7 +36,10 @@ public:
   void SetDynamicRangeCompression(long drc);
   void Pause();
   void Resume();
-  bool Create(const DVDAudioFrame &audioframe, AVCodecID codec, bool needresampler);
+  bool Create(const DVDAudioFrame& audioframe,
+              AVCodecID codec,
+              bool needresampler,
+              bool realtime = false);
   bool IsValidFormat(const DVDAudioFrame &audioframe);
   void Destroy(bool finish);
   unsigned int AddPackets(const DVDAudioFrame &audioframe);
@@ -10,10 +10,19 @@
 
 #include "utils/log.h"
 
+#include <algorithm>
+#include <limits>
 #include <mutex>
 #include <string.h>
 #include <utility>
 
+namespace
+{
+// pools kept over a change of stream and the free buffers each of them keeps
+constexpr size_t MAX_RETAINED_POOLS = 2;
+constexpr unsigned int MAX_RETAINED_BUFFERS = 4;
+} // namespace
+
 //-----------------------------------------------------------------------------
 // CVideoBuffer
 //-----------------------------------------------------------------------------
@@ -312,10 +321,15 @@ CVideoBuffer* CVideoBufferPoolSysMem::Get()
   }
   else
   {
-    int id = m_all.size();
+    // take the place of a buffer freed by Trim()
+    const auto slot = std::ranges::find(m_all, nullptr);
+    int id = static_cast<int>(slot - m_all.begin());
     buf = new CVideoBufferSysMem(*this, id, m_pixFormat, m_size);
     buf->Alloc();
-    m_all.push_back(buf);
+    if (slot == m_all.end())
+      m_all.push_back(buf);
+    else
+      *slot = buf;
     m_used.push_back(id);
   }
 
@@ -349,7 +363,7 @@ void CVideoBufferPoolSysMem::Return(int id)
 void CVideoBufferPoolSysMem::Configure(AVPixelFormat format, int size)
 {
   m_pixFormat = format;
-  m_size = size;
+  m_size = CVideoBufferManager::GetSizeClass(size);
   m_configured = true;
 }
 
@@ -361,7 +375,7 @@ inline bool CVideoBufferPoolSysMem::IsConfigured()
 bool CVideoBufferPoolSysMem::IsCompatible(AVPixelFormat format, int size)
 {
   if (m_pixFormat == format &&
-      m_size == size)
+      m_size == CVideoBufferManager::GetSizeClass(size))
     return true;
 
   return false;
@@ -377,6 +391,19 @@ void CVideoBufferPoolSysMem::Discard(CVideoBufferManager *bm, ReadyToDispose cb)
     (m_bm->*m_cbDispose)(this);
 }
 
+void CVideoBufferPoolSysMem::Trim(unsigned int keep)
+{
+  std::unique_lock lock(m_critSection);
+
+  while (m_free.size() > keep)
+  {
+    int id = m_free.back();
+    m_free.pop_back();
+    delete m_all[id];
+    m_all[id] = nullptr;
+  }
+}
+
 std::shared_ptr<IVideoBufferPool> CVideoBufferPoolSysMem::CreatePool()
 {
   return std::make_shared<CVideoBufferPoolSysMem>();
@@ -411,14 +438,35 @@ void CVideoBufferManager::ReleasePools()
   std::list<std::shared_ptr<IVideoBufferPool>> pools = m_pools;
   m_pools.clear();
 
-  m_discardedPools = pools;
-
   for (const auto& pool : pools)
   {
+    // the pools created here only depend on format and size, the next stream, e.g. the next
+    // rendition of an adaptive stream, likely needs the same buffers
+    if (std::ranges::find(m_createdPools, pool.get()) != m_createdPools.end())
+    {
+      Retain(pool);
+      continue;
+    }
+    m_discardedPools.push_back(pool);
     pool->Discard(this, &CVideoBufferManager::ReadyForDisposal);
   }
 }
 
+void CVideoBufferManager::Retain(const std::shared_ptr<IVideoBufferPool>& pool)
+{
+  pool->Trim(MAX_RETAINED_BUFFERS);
+  m_retainedPools.push_front(pool);
+
+  if (m_retainedPools.size() > MAX_RETAINED_POOLS)
+  {
+    std::shared_ptr<IVideoBufferPool> oldest = m_retainedPools.back();
+    m_retainedPools.pop_back();
+    std::erase(m_createdPools, oldest.get());
+    m_discardedPools.push_back(oldest);
+    oldest->Discard(this, &CVideoBufferManager::ReadyForDisposal);
+  }
+}
+
 void CVideoBufferManager::ReleasePool(IVideoBufferPool *pool)
 {
   std::unique_lock lock(m_critSection);
@@ -427,6 +475,7 @@ void CVideoBufferManager::ReleasePool(IVideoBufferPool *pool)
   {
     if ((*it).get() == pool)
     {
+      std::erase(m_createdPools, pool);
       m_discardedPools.push_back(*it);
       m_pools.erase(it);
       pool->Discard(this, &CVideoBufferManager::ReadyForDisposal);
@@ -450,7 +499,9 @@ void CVideoBufferManager::ReadyForDisposal(IVideoBufferPool *pool)
   }
 }
 
-CVideoBuffer* CVideoBufferManager::Get(AVPixelFormat format, int size, IVideoBufferPool **pPool)
+CVideoBuffer* CVideoBufferManager::Get(AVPixelFormat format,
+                                       int size,
+                                       std::shared_ptr<IVideoBufferPool>* pPool)
 {
   std::unique_lock lock(m_critSection);
   for (const auto& pool : m_pools)
@@ -461,6 +512,21 @@ CVideoBuffer* CVideoBufferManager::Get(AVPixelFormat format, int size, IVideoBuf
     }
     if (pool->IsCompatible(format, size))
     {
+      if (pPool)
+        *pPool = pool;
+      return pool->Get();
+    }
+  }
+
+  for (auto it = m_retainedPools.begin(); it != m_retainedPools.end(); ++it)
+  {
+    if ((*it)->IsCompatible(format, size))
+    {
+      std::shared_ptr<IVideoBufferPool> pool = *it;
+      m_retainedPools.erase(it);
+      m_pools.push_front(pool);
+      if (pPool)
+        *pPool = pool;
       return pool->Get();
     }
   }
@@ -469,10 +535,22 @@ CVideoBuffer* CVideoBufferManager::Get(AVPixelFormat format, int size, IVideoBuf
   {
     std::shared_ptr<IVideoBufferPool> pool = fact.second();
     m_pools.push_front(pool);
+    m_createdPools.push_back(pool.get());
     pool->Configure(format, size);
     if (pPool)
-      *pPool = pool.get();
+      *pPool = pool;
     return pool->Get();
   }
   return nullptr;
 }
+
+int CVideoBufferManager::GetSizeClass(int size)
+{
+  // the step is at most an eighth of the size. computed wider, the classes of the largest sizes
+  // don't fit an int and are clamped
+  int64_t step = 1;
+  while (step * 16 <= size)
+    step *= 2;
+  const int64_t sizeClass = (size + step - 1) / step * step;
+  return static_cast<int>(std::min<int64_t>(sizeClass, std::numeric_limits<int>::max()));
+}
@@ -78,6 +78,10 @@ public:
   // pool calls back when all buffers are back home
   virtual void Discard(CVideoBufferManager* bm, ReadyToDispose cb) { (bm->*cb)(this); }
 
+  // called by BM when it keeps the pool for later streams
+  // pool frees the buffers it doesn't use beyond keep
+  virtual void Trim(unsigned int keep) {}
+
   // call on Get() before returning buffer to caller
   std::shared_ptr<IVideoBufferPool> GetPtr() { return shared_from_this(); }
 };
@@ -152,6 +156,7 @@ public:
   bool IsConfigured() override;
   bool IsCompatible(AVPixelFormat format, int size) override;
   void Discard(CVideoBufferManager *bm, ReadyToDispose cb) override;
+  void Trim(unsigned int keep) override;
 
   static std::shared_ptr<IVideoBufferPool> CreatePool();
 
@@ -184,13 +189,29 @@ public:
   void RegisterPoolFactory(const std::string& id, CreatePoolFunc createFunc);
   void ReleasePools();
   void ReleasePool(IVideoBufferPool *pool);
-  CVideoBuffer* Get(AVPixelFormat format, int size, IVideoBufferPool **pPool);
+  /*!
+   * \brief Get a buffer from a pool compatible with format and size, creating one if needed
+   * \param pPool if not null, set to the pool the buffer was taken from
+   */
+  CVideoBuffer* Get(AVPixelFormat format, int size, std::shared_ptr<IVideoBufferPool>* pPool);
   void ReadyForDisposal(IVideoBufferPool *pool);
 
+  /*!
+   * \brief Round a buffer size up to its size class. Classes are at most an eighth apart, so
+   * frames of slightly different sizes, e.g. of the renditions of an adaptive stream, share a pool.
+   * Classes beyond the range of int are clamped to its maximum.
+   */
+  static int GetSizeClass(int size);
+
 protected:
+  void Retain(const std::shared_ptr<IVideoBufferPool>& pool);
+
   CCriticalSection m_critSection;
   std::list<std::shared_ptr<IVideoBufferPool>> m_pools;
   std::list<std::shared_ptr<IVideoBufferPool>> m_discardedPools;
+  // pools created by the factories are kept over ReleasePools(), the ones used last first
+  std::list<std::shared_ptr<IVideoBufferPool>> m_retainedPools;
+  std::vector<IVideoBufferPool*> m_createdPools;
   std::map<std::string, CreatePoolFunc> m_poolFactories;
 
 private:
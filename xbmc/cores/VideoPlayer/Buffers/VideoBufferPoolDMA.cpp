@@ -83,7 +83,7 @@ void CVideoBufferPoolDMA::Configure(AVPixelFormat format, int size)
   std::unique_lock lock(m_critSection);
 
   m_fourcc = TranslateFormat(format);
-  m_size = static_cast<uint64_t>(size);
+  m_size = static_cast<uint64_t>(CVideoBufferManager::GetSizeClass(size));
 }
 
 bool CVideoBufferPoolDMA::IsConfigured()
@@ -97,7 +97,8 @@ bool CVideoBufferPoolDMA::IsCompatible(AVPixelFormat format, int size)
 {
   std::unique_lock lock(m_critSection);
 
-  if (m_fourcc != TranslateFormat(format) || m_size != static_cast<uint64_t>(size))
+  if (m_fourcc != TranslateFormat(format) ||
+      m_size != static_cast<uint64_t>(CVideoBufferManager::GetSizeClass(size)))
     return false;
 
   return true;
@@ -129,6 +130,14 @@ uint32_t CVideoBufferPoolDMA::TranslateFormat(AVPixelFormat format)
     case AV_PIX_FMT_YUV444P:
     case AV_PIX_FMT_YUVJ444P:
       return DRM_FORMAT_YUV444;
+#if defined(DRM_FORMAT_S010)
+    case AV_PIX_FMT_YUV420P10:
+      return DRM_FORMAT_S010;
+    case AV_PIX_FMT_YUV422P10:
+      return DRM_FORMAT_S210;
+    case AV_PIX_FMT_YUV444P10:
+      return DRM_FORMAT_S410;
+#endif
     default:
       return 0;
   }
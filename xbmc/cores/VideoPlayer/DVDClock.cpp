@@ -14,11 +14,23 @@
 #include "utils/TimeUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
+#include <cmath>
 #include <inttypes.h>
 #include <math.h>
 #include <memory>
 #include <mutex>
 
+namespace
+{
+// a following clock corrects its error within about this time by adjusting its speed
+constexpr double FOLLOW_CORRECTION_TIME = 2.0 * DVD_TIME_BASE;
+// limit of the speed adjustment, resampling by this little isn't audible
+constexpr double FOLLOW_MAX_SPEED_ADJUST = 0.005;
+// larger errors are corrected by a discontinuity
+constexpr double FOLLOW_MAX_ERROR = DVD_MSEC_TO_TIME(100);
+} // namespace
+
 CDVDClock::CDVDClock()
 {
   std::unique_lock lock(m_systemsection);
@@ -220,6 +232,41 @@ void CDVDClock::Discontinuity(double clock, double absolute)
   m_speedAdjust = 0;
 }
 
+void CDVDClock::SetFollower(bool follower)
+{
+  std::unique_lock lock(m_critSection);
+  if (m_follower && !follower)
+    m_speedAdjust = 0;
+  m_follower = follower;
+}
+
+bool CDVDClock::IsFollower()
+{
+  std::unique_lock lock(m_critSection);
+  return m_follower;
+}
+
+double CDVDClock::FollowReference(double reference)
+{
+  std::unique_lock lock(m_critSection);
+
+  double absolute;
+  const double clock = GetClock(absolute);
+  const double error = clock - reference;
+
+  if (std::abs(error) > FOLLOW_MAX_ERROR)
+  {
+    Discontinuity(reference, absolute);
+    CLog::Log(LOGDEBUG, "CDVDClock::FollowReference - error:{:f}, discontinuity", error);
+    return error;
+  }
+
+  // not through SetSpeedAdjust(), this is called for every iteration of the player
+  m_speedAdjust =
+      std::clamp(-error / FOLLOW_CORRECTION_TIME, -FOLLOW_MAX_SPEED_ADJUST, FOLLOW_MAX_SPEED_ADJUST);
+  return error;
+}
+
 void CDVDClock::SetMaxSpeedAdjust(double speed)
 {
   std::unique_lock lock(m_speedsection);
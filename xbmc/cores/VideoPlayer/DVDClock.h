@@ -55,6 +55,21 @@ public:
   void Pause(bool pause);
   void Advance(double time);
 
+  /*!
+   * \brief Mark the clock as following the clock of another instance, the master of a synchronised
+   * playback group (CPlaybackSync). Audio is resampled to follow the clock then.
+   */
+  void SetFollower(bool follower);
+  bool IsFollower();
+
+  /*!
+   * \brief Steer a following clock towards the playing time of the master. Small errors are
+   * corrected smoothly by adjusting the speed of the clock, larger ones with a discontinuity.
+   * \param reference the time the clock should show now
+   * \return the error of the clock before the correction
+   */
+  double FollowReference(double reference);
+
 protected:
   double SystemToAbsolute(int64_t system);
   int64_t AbsoluteToSystem(double absolute);
@@ -82,4 +97,6 @@ protected:
 
   double m_maxspeedadjust;
   CCriticalSection m_speedsection;
+
+  bool m_follower{false};
 };
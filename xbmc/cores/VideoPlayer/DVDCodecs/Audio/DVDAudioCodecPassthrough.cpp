@@ -14,6 +14,7 @@
 #include "utils/log.h"
 
 #include <algorithm>
+#include <utility>
 
 extern "C"
 {
@@ -195,6 +196,8 @@ bool CDVDAudioCodecPassthrough::AddData(const DemuxPacket &packet)
     {
       if (m_packerMAT->PackTrueHD(m_buffer, m_dataSize))
       {
+        // the previous frame was consumed already, let the packer reuse its storage
+        m_packerMAT->RecycleFrame(std::move(m_trueHDBuffer));
         m_trueHDBuffer = m_packerMAT->GetOutputFrame();
         m_dataSize = TRUEHD_BUF_SIZE;
       }
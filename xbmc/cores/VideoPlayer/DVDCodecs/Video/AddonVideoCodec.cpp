@@ -16,6 +16,8 @@
 #include "cores/VideoPlayer/Interface/TimingConstants.h"
 #include "utils/log.h"
 
+#include <algorithm>
+
 extern "C"
 {
 #include <libavcodec/defs.h>
@@ -114,6 +116,9 @@ CAddonVideoCodec::~CAddonVideoCodec()
 
   DestroyInstance();
 
+  // the manager keeps the pool for the next stream
+  m_frameBufferPool.reset();
+
   // Delete "C" interface structures
   delete m_ifc.videocodec->toAddon;
   delete m_ifc.videocodec->toKodi;
@@ -420,12 +425,29 @@ void CAddonVideoCodec::Reset()
 
 bool CAddonVideoCodec::GetFrameBuffer(VIDEOCODEC_PICTURE &picture)
 {
-  CVideoBuffer *videoBuffer = m_processInfo.GetVideoBufferManager().Get(AV_PIX_FMT_YUV420P, picture.decodedDataSize, nullptr);
+  // all buffers of a pool have the same size. serve smaller frames, e.g. after an adaptive stream
+  // switched down, from the buffers of the largest ones instead of adding a pool per frame size.
+  const int size = std::max(static_cast<int>(picture.decodedDataSize), m_frameBufferSize);
+
+  CVideoBufferManager& bufferManager = m_processInfo.GetVideoBufferManager();
+  std::shared_ptr<IVideoBufferPool> pool;
+  CVideoBuffer* videoBuffer = bufferManager.Get(AV_PIX_FMT_YUV420P, size, &pool);
   if (!videoBuffer)
   {
     CLog::Log(LOGERROR,"CAddonVideoCodec::GetFrameBuffer Failed to allocate buffer");
     return false;
   }
+
+  if (pool != m_frameBufferPool)
+  {
+    // larger frames are served from another pool now, the old one isn't needed anymore and gets
+    // disposed once all of its buffers have been returned
+    if (m_frameBufferPool)
+      bufferManager.ReleasePool(m_frameBufferPool.get());
+    m_frameBufferPool = std::move(pool);
+  }
+  m_frameBufferSize = size;
+
   picture.decodedData = videoBuffer->GetMemPtr();
   picture.videoBufferHandle = videoBuffer;
 
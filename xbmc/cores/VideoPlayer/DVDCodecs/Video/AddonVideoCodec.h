@@ -13,6 +13,8 @@
 #include "addons/binary-addons/AddonInstanceHandler.h"
 #include "addons/kodi-dev-kit/include/kodi/addon-instance/VideoCodec.h"
 
+class IVideoBufferPool;
+
 class BufferPool;
 
 class CAddonVideoCodec
@@ -51,4 +53,11 @@ private:
   VIDEOCODEC_FORMAT m_formats[VIDEOCODEC_FORMAT_MAXFORMATS + 1];
   float m_displayAspect = 0.0f;
   unsigned int m_width, m_height;
+
+  /*!
+   * @brief Size of the frame buffers handed to the add-on, the largest requested so far
+   */
+  int m_frameBufferSize = 0;
+  //! The pool the frame buffers were last taken from
+  std::shared_ptr<IVideoBufferPool> m_frameBufferPool;
 };
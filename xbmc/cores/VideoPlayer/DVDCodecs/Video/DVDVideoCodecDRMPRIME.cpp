@@ -18,8 +18,10 @@
 #include "settings/lib/Setting.h"
 #include "threads/SingleLock.h"
 #include "utils/CPUInfo.h"
+#include "utils/EGLImage.h"
 #include "utils/StringUtils.h"
 #include "utils/log.h"
+#include "windowing/linux/WinSystemEGL.h"
 
 #if defined(HAVE_GBM)
 #include "windowing/gbm/WinSystemGbm.h"
@@ -160,6 +162,41 @@ static bool IsSupportedSwFormat(const enum AVPixelFormat fmt)
          fmt == AV_PIX_FMT_YUVJ422P || fmt == AV_PIX_FMT_YUV444P || fmt == AV_PIX_FMT_YUVJ444P;
 }
 
+static bool IsHighBitDepthSwFormat(const enum AVPixelFormat fmt)
+{
+  return fmt == AV_PIX_FMT_YUV420P10 || fmt == AV_PIX_FMT_YUV422P10 ||
+         fmt == AV_PIX_FMT_YUV444P10;
+}
+
+/*!
+ * \brief Get the 10 bit software formats which can be decoded straight into dma-bufs.
+ *
+ * Unlike the 8 bit formats, which the gles renderer can still upload, there is no fallback
+ * for a 10 bit dma-buf the EGL display can't import, so those are only used when it can.
+ */
+static std::vector<AVPixelFormat> GetHighBitDepthSwFormats()
+{
+  std::vector<AVPixelFormat> formats;
+
+#if defined(DRM_FORMAT_S010) && defined(EGL_EXT_image_dma_buf_import_modifiers)
+  auto winSystemEGL =
+      dynamic_cast<KODI::WINDOWING::LINUX::CWinSystemEGL*>(CServiceBroker::GetWinSystem());
+  if (!winSystemEGL)
+    return formats;
+
+  CEGLImage image{winSystemEGL->GetEGLDisplay()};
+  for (const auto& [format, fourcc] : {std::make_pair(AV_PIX_FMT_YUV420P10, DRM_FORMAT_S010),
+                                       std::make_pair(AV_PIX_FMT_YUV422P10, DRM_FORMAT_S210),
+                                       std::make_pair(AV_PIX_FMT_YUV444P10, DRM_FORMAT_S410)})
+  {
+    if (image.SupportsFormatAndModifier(fourcc, DRM_FORMAT_MOD_LINEAR))
+      formats.emplace_back(format);
+  }
+#endif
+
+  return formats;
+}
+
 static const AVCodecHWConfig* FindHWConfig(const AVCodec* codec)
 {
   if (!CServiceBroker::GetSettingsComponent()->GetSettings()->GetBool(
@@ -208,11 +245,11 @@ static const AVCodec* FindDecoder(CDVDStreamInfo& hints)
 enum AVPixelFormat CDVDVideoCodecDRMPRIME::GetFormat(struct AVCodecContext* avctx,
                                                      const enum AVPixelFormat* fmt)
 {
+  CDVDVideoCodecDRMPRIME* ctx = static_cast<CDVDVideoCodecDRMPRIME*>(avctx->opaque);
   for (int n = 0; fmt[n] != AV_PIX_FMT_NONE; n++)
   {
-    if (IsSupportedHwFormat(fmt[n]) || IsSupportedSwFormat(fmt[n]))
+    if (IsSupportedHwFormat(fmt[n]) || ctx->SupportsSwFormat(fmt[n]))
     {
-      CDVDVideoCodecDRMPRIME* ctx = static_cast<CDVDVideoCodecDRMPRIME*>(avctx->opaque);
       ctx->UpdateProcessInfo(avctx, fmt[n]);
       return fmt[n];
     }
@@ -229,9 +266,19 @@ enum AVPixelFormat CDVDVideoCodecDRMPRIME::GetFormat(struct AVCodecContext* avct
   return AV_PIX_FMT_NONE;
 }
 
+bool CDVDVideoCodecDRMPRIME::SupportsSwFormat(const enum AVPixelFormat fmt) const
+{
+  if (IsHighBitDepthSwFormat(fmt))
+    return std::find(m_highBitDepthFormats.begin(), m_highBitDepthFormats.end(), fmt) !=
+           m_highBitDepthFormats.end();
+
+  return IsSupportedSwFormat(fmt);
+}
+
 int CDVDVideoCodecDRMPRIME::GetBuffer(struct AVCodecContext* avctx, AVFrame* frame, int flags)
 {
-  if (IsSupportedSwFormat(static_cast<AVPixelFormat>(frame->format)))
+  CDVDVideoCodecDRMPRIME* ctx = static_cast<CDVDVideoCodecDRMPRIME*>(avctx->opaque);
+  if (ctx->SupportsSwFormat(static_cast<AVPixelFormat>(frame->format)))
   {
     int width = frame->width;
     int height = frame->height;
@@ -253,11 +300,19 @@ int CDVDVideoCodecDRMPRIME::GetBuffer(struct AVCodecContext* avctx, AVFrame* fra
       case AV_PIX_FMT_YUVJ444P:
         size = width * height * 3;
         break;
+      case AV_PIX_FMT_YUV420P10:
+        size = width * height * 3;
+        break;
+      case AV_PIX_FMT_YUV422P10:
+        size = width * height * 4;
+        break;
+      case AV_PIX_FMT_YUV444P10:
+        size = width * height * 6;
+        break;
       default:
         return -1;
     }
 
-    CDVDVideoCodecDRMPRIME* ctx = static_cast<CDVDVideoCodecDRMPRIME*>(avctx->opaque);
     auto buffer = dynamic_cast<CVideoBufferDMA*>(
         ctx->m_processInfo.GetVideoBufferManager().Get(avctx->pix_fmt, size, nullptr));
     if (!buffer)
@@ -343,6 +398,9 @@ bool CDVDVideoCodecDRMPRIME::Open(CDVDStreamInfo& hints, CDVDCodecOptions& optio
     }
   }
 
+  // decoder threads read these from get_buffer2, so they are fixed before the codec is opened
+  m_highBitDepthFormats = GetHighBitDepthSwFormats();
+
   m_pCodecContext->pix_fmt = AV_PIX_FMT_DRM_PRIME;
   m_pCodecContext->opaque = static_cast<void*>(this);
   m_pCodecContext->get_format = GetFormat;
@@ -550,7 +608,9 @@ void CDVDVideoCodecDRMPRIME::SetPictureParams(VideoPicture* pVideoPicture)
   pVideoPicture->chroma_position = m_pFrame->chroma_location;
 
   pVideoPicture->colorBits = 8;
-  if (m_pCodecContext->codec_id == AV_CODEC_ID_HEVC &&
+  if (IsHighBitDepthSwFormat(static_cast<AVPixelFormat>(m_pFrame->format)))
+    pVideoPicture->colorBits = 10;
+  else if (m_pCodecContext->codec_id == AV_CODEC_ID_HEVC &&
       m_pCodecContext->profile == AV_PROFILE_HEVC_MAIN_10)
     pVideoPicture->colorBits = 10;
   else if (m_pCodecContext->codec_id == AV_CODEC_ID_H264 &&
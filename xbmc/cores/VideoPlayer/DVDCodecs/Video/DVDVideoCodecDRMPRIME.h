@@ -13,6 +13,7 @@
 #include "cores/VideoPlayer/DVDStreamInfo.h"
 
 #include <memory>
+#include <vector>
 
 class CDVDVideoCodecDRMPRIME : public CDVDVideoCodec
 {
@@ -35,6 +36,7 @@ protected:
   void Drain();
   void SetPictureParams(VideoPicture* pVideoPicture);
   void UpdateProcessInfo(struct AVCodecContext* avctx, const enum AVPixelFormat fmt);
+  bool SupportsSwFormat(const enum AVPixelFormat fmt) const;
   static enum AVPixelFormat GetFormat(struct AVCodecContext* avctx, const enum AVPixelFormat* fmt);
   static int GetBuffer(struct AVCodecContext* avctx, AVFrame* frame, int flags);
 
@@ -45,4 +47,5 @@ protected:
   AVCodecContext* m_pCodecContext = nullptr;
   AVFrame* m_pFrame = nullptr;
   std::shared_ptr<IVideoBufferPool> m_videoBufferPool;
+  std::vector<AVPixelFormat> m_highBitDepthFormats;
 };
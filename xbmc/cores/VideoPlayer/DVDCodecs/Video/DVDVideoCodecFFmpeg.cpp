@@ -29,6 +29,11 @@
 
 #include <memory>
 #include <mutex>
+#include <vector>
+
+#if defined(TARGET_LINUX)
+#include <sched.h>
+#endif
 
 extern "C" {
 #include <libavcodec/defs.h>
@@ -57,6 +62,50 @@ enum DecoderState
   STATE_SW_MULTI
 };
 
+namespace
+{
+/*!
+ * \brief Restricts the calling thread to a set of cores for as long as it exists.
+ *
+ * Threads inherit the affinity of the thread creating them, so the decoding threads ffmpeg starts
+ * while opening a codec stay on these cores after the calling thread got its affinity back.
+ */
+class CScopedCoreAffinity
+{
+public:
+  explicit CScopedCoreAffinity(const std::vector<int>& cores)
+  {
+#if defined(TARGET_LINUX)
+    if (cores.empty() || sched_getaffinity(0, sizeof(m_previous), &m_previous) != 0)
+      return;
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int core : cores)
+      CPU_SET(core, &set);
+    m_restore = sched_setaffinity(0, sizeof(set), &set) == 0;
+#endif
+  }
+
+  ~CScopedCoreAffinity()
+  {
+#if defined(TARGET_LINUX)
+    if (m_restore)
+      sched_setaffinity(0, sizeof(m_previous), &m_previous);
+#endif
+  }
+
+  CScopedCoreAffinity(const CScopedCoreAffinity&) = delete;
+  CScopedCoreAffinity& operator=(const CScopedCoreAffinity&) = delete;
+
+private:
+#if defined(TARGET_LINUX)
+  cpu_set_t m_previous;
+  bool m_restore = false;
+#endif
+};
+} // namespace
+
 enum EFilterFlags {
   FILTER_NONE                =  0x0,
   FILTER_DEINTERLACE_BWDIF   =  0x1,  //< use first deinterlace mode
@@ -384,6 +433,8 @@ bool CDVDVideoCodecFFmpeg::Open(CDVDStreamInfo &hints, CDVDCodecOptions &options
 #endif
 
   // setup threading model
+  std::vector<int> decoderCores;
+  m_threadingPolicy.clear();
   if (!(hints.codecOptions & CODEC_FORCE_SOFTWARE))
   {
     if (m_decoderState == STATE_NONE)
@@ -392,12 +443,32 @@ bool CDVDVideoCodecFFmpeg::Open(CDVDStreamInfo &hints, CDVDCodecOptions &options
     }
     else
     {
-      int num_threads = CServiceBroker::GetCPUInfo()->GetCPUCount() * 3 / 2;
-      num_threads = std::max(1, std::min(num_threads, 16));
-      m_pCodecContext->thread_count = num_threads;
+      // decode on the fast cores of a big.LITTLE cpu only, the slowest thread paces them all
+      const auto cpuInfo = CServiceBroker::GetCPUInfo();
+      decoderCores = cpuInfo->GetPerformanceCores();
+      const int cores =
+          decoderCores.empty() ? cpuInfo->GetCPUCount() : static_cast<int>(decoderCores.size());
+
+      if ((hints.codecOptions & CODEC_LOW_LATENCY) &&
+          (pCodec->capabilities & AV_CODEC_CAP_SLICE_THREADS))
+      {
+        // every frame thread delays the output by a frame, slice threads don't
+        const int num_threads = std::max(1, std::min(cores, 16));
+        m_pCodecContext->thread_type = FF_THREAD_SLICE;
+        m_pCodecContext->thread_count = num_threads;
+        m_threadingPolicy = StringUtils::Format("{} slice threads", num_threads);
+      }
+      else
+      {
+        const int num_threads = std::max(1, std::min(cores * 3 / 2, 16));
+        m_pCodecContext->thread_count = num_threads;
+        m_threadingPolicy = StringUtils::Format("{} frame threads", num_threads);
+      }
+      if (!decoderCores.empty())
+        m_threadingPolicy += " on performance cores";
+
       m_decoderState = STATE_SW_MULTI;
-      CLog::Log(LOGDEBUG, "CDVDVideoCodecFFmpeg - open frame threaded with {} threads",
-                num_threads);
+      CLog::Log(LOGDEBUG, "CDVDVideoCodecFFmpeg - open with {}", m_threadingPolicy);
     }
   }
   else
@@ -428,13 +499,22 @@ bool CDVDVideoCodecFFmpeg::Open(CDVDStreamInfo &hints, CDVDCodecOptions &options
     m_pCodecContext->skip_loop_filter = static_cast<AVDiscard>(iSkipLoopFilter);
   }
 
+  // only key frames are wanted (thumbnail extraction), don't decode anything else
+  if (hints.codecOptions & CODEC_KEYFRAMES_ONLY)
+    m_pCodecContext->skip_frame = AVDISCARD_NONKEY;
+
   // set any special options
   for(std::vector<CDVDCodecOption>::iterator it = options.m_keys.begin(); it != options.m_keys.end(); ++it)
   {
     av_opt_set(m_pCodecContext, it->m_name.c_str(), it->m_value.c_str(), 0);
   }
 
-  if (avcodec_open2(m_pCodecContext, pCodec, nullptr) < 0)
+  int ret;
+  {
+    CScopedCoreAffinity affinity(decoderCores);
+    ret = avcodec_open2(m_pCodecContext, pCodec, nullptr);
+  }
+  if (ret < 0)
   {
     CLog::Log(LOGDEBUG,"CDVDVideoCodecFFmpeg::Open() Unable to open codec");
     avcodec_free_context(&m_pCodecContext);
@@ -557,7 +637,10 @@ void CDVDVideoCodecFFmpeg::UpdateName()
   if(m_pHardware)
     m_name += "-" + m_pHardware->Name();
 
-  m_processInfo.SetVideoDecoderName(m_name, m_pHardware ? true : false);
+  if (!m_pHardware && !m_threadingPolicy.empty())
+    m_processInfo.SetVideoDecoderName(m_name + " (" + m_threadingPolicy + ")", false);
+  else
+    m_processInfo.SetVideoDecoderName(m_name, m_pHardware ? true : false);
 
   CLog::Log(LOGDEBUG, "CDVDVideoCodecFFmpeg - Updated codec: {}", m_name);
 }
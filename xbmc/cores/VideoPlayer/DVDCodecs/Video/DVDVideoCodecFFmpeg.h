@@ -84,6 +84,7 @@ protected:
   int m_iOrientation = 0;// orientation of the video in degrees counter clockwise
 
   std::string m_name;
+  std::string m_threadingPolicy;
   int m_decoderState;
   IHardwareDecoder *m_pHardware = nullptr;
   int m_iLastKeyframe = 0;
@@ -11,14 +11,18 @@
 #include "DVDDemuxUtils.h"
 #include "ServiceBroker.h"
 #include "cores/VideoPlayer/DVDCodecs/Overlay/contrib/cc_decoder708.h"
+#include "cores/VideoPlayer/DVDMessage.h"
 #include "cores/VideoPlayer/Interface/TimingConstants.h"
 #include "guilib/LocalizeStrings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/ColorUtils.h"
 #include "utils/StringUtils.h"
+#include "utils/log.h"
 
 #include <algorithm>
+#include <cstring>
+#include <mutex>
 
 namespace COLOR = KODI::UTILS::COLOR;
 
@@ -178,19 +182,48 @@ bool reorder_sort (CCaptionBlock *lhs, CCaptionBlock *rhs)
   return (lhs->m_pts > rhs->m_pts);
 }
 
-CDVDDemuxCC::CDVDDemuxCC(AVCodecID codec) : m_codec(codec)
+namespace
+{
+// video packets waiting to be parsed, the oldest are dropped if parsing falls behind
+constexpr size_t MAX_QUEUED_PACKETS = 32;
+
+// position of the next 00 00 01 start code prefix at or after start, -1 if there is none
+int FindStartCode(const uint8_t* data, int start, int size)
+{
+  int pos = start + 2;
+  while (pos < size)
+  {
+    const auto one = static_cast<const uint8_t*>(memchr(data + pos, 1, size - pos));
+    if (!one)
+      return -1;
+    pos = static_cast<int>(one - data);
+    if (data[pos - 1] == 0 && data[pos - 2] == 0)
+      return pos - 2;
+    // a prefix ending in the next two bytes would need this one to be a zero
+    pos += 3;
+  }
+  return -1;
+}
+} // namespace
+
+CDVDDemuxCC::CDVDDemuxCC(AVCodecID codec) : CThread("DemuxCC"), m_codec(codec)
 {
   m_hasData = false;
   m_curPts = 0.0;
+  Create();
 }
 
 CDVDDemuxCC::~CDVDDemuxCC()
 {
+  m_bStop = true;
+  m_packetEvent.Set();
+  StopThread();
   Dispose();
 }
 
 CDemuxStream* CDVDDemuxCC::GetStream(int iStreamId) const
 {
+  std::unique_lock lock(m_section);
   for (int i=0; i<GetNrOfStreams(); i++)
   {
     if (m_streams[i].uniqueId == iStreamId)
@@ -201,6 +234,7 @@ CDemuxStream* CDVDDemuxCC::GetStream(int iStreamId) const
 
 std::vector<CDemuxStream*> CDVDDemuxCC::GetStreams() const
 {
+  std::unique_lock lock(m_section);
   std::vector<CDemuxStream*> streams;
 
   int num = GetNrOfStreams();
@@ -215,26 +249,102 @@ std::vector<CDemuxStream*> CDVDDemuxCC::GetStreams() const
 
 int CDVDDemuxCC::GetNrOfStreams() const
 {
+  std::unique_lock lock(m_section);
   return m_streams.size();
 }
 
-DemuxPacket* CDVDDemuxCC::Read(DemuxPacket *pSrcPacket)
+void CDVDDemuxCC::AddPacket(std::shared_ptr<CDVDMsgDemuxerPacket> packet, double pts)
 {
-  DemuxPacket *pPacket = NULL;
-  uint32_t startcode = 0xffffffff;
-  int picType = 0;
-  int p = 0;
-  int len;
+  const DemuxPacket* pPacket = packet->GetPacket();
+  if (!pPacket || pts == DVD_NOPTS_VALUE || pPacket->iSize <= 0)
+    return;
 
-  if (!pSrcPacket)
   {
-    pPacket = Decode();
-    return pPacket;
+    std::unique_lock lock(m_section);
+    if (m_packets.size() >= MAX_QUEUED_PACKETS)
+    {
+      CLog::LogF(LOGDEBUG, "caption parsing is behind, dropping a packet");
+      m_packets.pop_front();
+    }
+    m_packets.push_back({std::move(packet), pts});
   }
-  if (pSrcPacket->pts == DVD_NOPTS_VALUE)
+  m_packetEvent.Set();
+}
+
+DemuxPacket* CDVDDemuxCC::Read()
+{
+  std::unique_lock lock(m_section);
+  if (m_captions.empty())
+    return nullptr;
+
+  DemuxPacket* pPacket = m_captions.front();
+  m_captions.pop_front();
+  return pPacket;
+}
+
+void CDVDDemuxCC::Flush()
+{
+  std::unique_lock lock(m_section);
+  m_packets.clear();
+  for (DemuxPacket* pPacket : m_captions)
+    CDVDDemuxUtils::FreeDemuxPacket(pPacket);
+  m_captions.clear();
+  // the parsing thread drops what it holds of the packets before
+  m_generation++;
+}
+
+void CDVDDemuxCC::Process()
+{
+  SetPriority(ThreadPriority::BELOW_NORMAL);
+
+  unsigned int generation = 0;
+  while (!m_bStop)
   {
-    return pPacket;
+    videopacket packet;
+    bool flushed;
+    {
+      std::unique_lock lock(m_section);
+      if (!m_packets.empty())
+      {
+        packet = std::move(m_packets.front());
+        m_packets.pop_front();
+      }
+      flushed = generation != m_generation;
+      generation = m_generation;
+    }
+    if (flushed)
+      DiscardPending();
+
+    if (!packet.packet)
+    {
+      m_packetEvent.Wait();
+      continue;
+    }
+
+    const DemuxPacket* source = packet.packet->GetPacket();
+    DemuxPacket* pPacket = Parse(source->pData, source->iSize, packet.pts);
+    packet.packet.reset();
+    while (pPacket)
+    {
+      {
+        std::unique_lock lock(m_section);
+        if (generation == m_generation)
+        {
+          m_captions.push_back(pPacket);
+          pPacket = nullptr;
+        }
+      }
+      CDVDDemuxUtils::FreeDemuxPacket(pPacket);
+      pPacket = Decode();
+    }
   }
+}
+
+DemuxPacket* CDVDDemuxCC::Parse(uint8_t* data, int size, double pts)
+{
+  DemuxPacket *pPacket = NULL;
+  int picType = 0;
+  int sc = 0;
 
   while (!m_ccTempBuffer.empty())
   {
@@ -242,123 +352,124 @@ DemuxPacket* CDVDDemuxCC::Read(DemuxPacket *pSrcPacket)
     m_ccTempBuffer.pop_back();
   }
 
-  while ((len = pSrcPacket->iSize - p) > 3)
+  // the byte after each start code needs at least 4 more behind it
+  while ((sc = FindStartCode(data, sc, size)) >= 0 && size - sc > 7)
   {
-    if ((startcode & 0xffffff00) == 0x00000100)
+    const int startcode = data[sc + 3];
+    const int p = sc + 4;
+    const int len = size - p;
+    if (m_codec == AV_CODEC_ID_MPEG2VIDEO)
     {
-      if (m_codec == AV_CODEC_ID_MPEG2VIDEO)
+      int scode = startcode;
+      if (scode == 0x00)
       {
-        int scode = startcode & 0xFF;
-        if (scode == 0x00)
+        if (len > 4)
         {
-          if (len > 4)
-          {
-            uint8_t *buf = pSrcPacket->pData + p;
-            picType = (buf[1] & 0x38) >> 3;
-          }
+          uint8_t *buf = data + p;
+          picType = (buf[1] & 0x38) >> 3;
         }
-        else if (scode == 0xb2) // user data
+      }
+      else if (scode == 0xb2) // user data
+      {
+        uint8_t *buf = data + p;
+        if (len >= 6 &&
+          buf[0] == 'G' && buf[1] == 'A' && buf[2] == '9' && buf[3] == '4' &&
+          buf[4] == 3 && (buf[5] & 0x40))
         {
-          uint8_t *buf = pSrcPacket->pData + p;
-          if (len >= 6 &&
-            buf[0] == 'G' && buf[1] == 'A' && buf[2] == '9' && buf[3] == '4' &&
-            buf[4] == 3 && (buf[5] & 0x40))
+          int cc_count = buf[5] & 0x1f;
+          if (cc_count > 0 && len >= 7 + cc_count * 3)
           {
-            int cc_count = buf[5] & 0x1f;
-            if (cc_count > 0 && len >= 7 + cc_count * 3)
-            {
-              CCaptionBlock *cc = new CCaptionBlock(cc_count * 3);
-              memcpy(cc->m_data, buf + 7, cc_count * 3);
-              cc->m_pts = pSrcPacket->pts;
-              if (picType == 1 || picType == 2)
-                m_ccTempBuffer.push_back(cc);
-              else
-                m_ccReorderBuffer.push_back(cc);
-            }
+            CCaptionBlock *cc = new CCaptionBlock(cc_count * 3);
+            memcpy(cc->m_data, buf + 7, cc_count * 3);
+            cc->m_pts = pts;
+            if (picType == 1 || picType == 2)
+              m_ccTempBuffer.push_back(cc);
+            else
+              m_ccReorderBuffer.push_back(cc);
           }
-          else if (len >= 6 &&
-                   buf[0] == 'C' && buf[1] == 'C' && buf[2] == 1)
+        }
+        else if (len >= 6 &&
+                 buf[0] == 'C' && buf[1] == 'C' && buf[2] == 1)
+        {
+          int oddidx = (buf[4] & 0x80) ? 0 : 1;
+          int cc_count = (buf[4] & 0x3e) >> 1;
+          int extrafield = buf[4] & 0x01;
+          if (extrafield)
+            cc_count++;
+
+          if (cc_count > 0 && len >= 5 + cc_count * 3 * 2)
           {
-            int oddidx = (buf[4] & 0x80) ? 0 : 1;
-            int cc_count = (buf[4] & 0x3e) >> 1;
-            int extrafield = buf[4] & 0x01;
-            if (extrafield)
-              cc_count++;
+            CCaptionBlock *cc = new CCaptionBlock(cc_count * 3);
+            uint8_t *src = buf + 5;
+            uint8_t *dst = cc->m_data;
 
-            if (cc_count > 0 && len >= 5 + cc_count * 3 * 2)
+            for (int i = 0; i < cc_count; i++)
             {
-              CCaptionBlock *cc = new CCaptionBlock(cc_count * 3);
-              uint8_t *src = buf + 5;
-              uint8_t *dst = cc->m_data;
-
-              for (int i = 0; i < cc_count; i++)
+              for (int j = 0; j < 2; j++)
               {
-                for (int j = 0; j < 2; j++)
+                if (i == cc_count - 1 && extrafield && j == 1)
+                  break;
+
+                if ((oddidx == j) && (src[0] == 0xFF))
                 {
-                  if (i == cc_count - 1 && extrafield && j == 1)
-                    break;
-
-                  if ((oddidx == j) && (src[0] == 0xFF))
-                  {
-                    dst[0] = 0x04;
-                    dst[1] = src[1];
-                    dst[2] = src[2];
-                    dst += 3;
-                  }
-                  src += 3;
+                  dst[0] = 0x04;
+                  dst[1] = src[1];
+                  dst[2] = src[2];
+                  dst += 3;
                 }
+                src += 3;
               }
-              cc->m_pts = pSrcPacket->pts;
-              m_ccReorderBuffer.push_back(cc);
-              picType = 1;
             }
+            cc->m_pts = pts;
+            m_ccReorderBuffer.push_back(cc);
+            picType = 1;
           }
         }
       }
-      else if (m_codec == AV_CODEC_ID_H264)
+    }
+    else if (m_codec == AV_CODEC_ID_H264)
+    {
+      int scode = startcode & 0x9F;
+      // slice data comes after SEI
+      if (scode >= 1 && scode <= 5)
       {
-        int scode = startcode & 0x9F;
-        // slice data comes after SEI
-        if (scode >= 1 && scode <= 5)
+        uint8_t *buf = data + p;
+        CBitstream bs(buf, len * 8);
+        bs.readGolombUE();
+        int sliceType = bs.readGolombUE();
+        if (sliceType == 2 || sliceType == 7) // I slice
+          picType = 1;
+        else if (sliceType == 0 || sliceType == 5) // P slice
+          picType = 2;
+        if (picType == 0)
         {
-          uint8_t *buf = pSrcPacket->pData + p;
-          CBitstream bs(buf, len * 8);
-          bs.readGolombUE();
-          int sliceType = bs.readGolombUE();
-          if (sliceType == 2 || sliceType == 7) // I slice
-            picType = 1;
-          else if (sliceType == 0 || sliceType == 5) // P slice
-            picType = 2;
-          if (picType == 0)
+          while (!m_ccTempBuffer.empty())
           {
-            while (!m_ccTempBuffer.empty())
-            {
-              m_ccReorderBuffer.push_back(m_ccTempBuffer.back());
-              m_ccTempBuffer.pop_back();
-            }
+            m_ccReorderBuffer.push_back(m_ccTempBuffer.back());
+            m_ccTempBuffer.pop_back();
           }
         }
-        if (scode == 0x06) // SEI
+      }
+      if (scode == 0x06) // SEI
+      {
+        uint8_t *buf = data + p;
+        if (len >= 12 &&
+          buf[3] == 0 && buf[4] == 49 &&
+          buf[5] == 'G' && buf[6] == 'A' && buf[7] == '9' && buf[8] == '4' && buf[9] == 3)
         {
-          uint8_t *buf = pSrcPacket->pData + p;
-          if (len >= 12 &&
-            buf[3] == 0 && buf[4] == 49 &&
-            buf[5] == 'G' && buf[6] == 'A' && buf[7] == '9' && buf[8] == '4' && buf[9] == 3)
+          uint8_t *userdata = buf + 10;
+          int cc_count = userdata[0] & 0x1f;
+          if (len >= cc_count * 3 + 10)
           {
-            uint8_t *userdata = buf + 10;
-            int cc_count = userdata[0] & 0x1f;
-            if (len >= cc_count * 3 + 10)
-            {
-              CCaptionBlock *cc = new CCaptionBlock(cc_count * 3);
-              memcpy(cc->m_data, userdata + 2, cc_count * 3);
-              cc->m_pts = pSrcPacket->pts;
-              m_ccTempBuffer.push_back(cc);
-            }
+            CCaptionBlock *cc = new CCaptionBlock(cc_count * 3);
+            memcpy(cc->m_data, userdata + 2, cc_count * 3);
+            cc->m_pts = pts;
+            m_ccTempBuffer.push_back(cc);
           }
         }
       }
     }
-    startcode = startcode << 8 | pSrcPacket->pData[p++];
+    sc += 3;
   }
 
   if ((picType == 1 || picType == 2) && !m_ccReorderBuffer.empty())
@@ -415,7 +526,10 @@ void CDVDDemuxCC::Handler(int service, void *userdata)
 
     stream.codec = AV_CODEC_ID_TEXT;
     stream.uniqueId = service;
-    ctx->m_streams.push_back(std::move(stream));
+    {
+      std::unique_lock lock(ctx->m_section);
+      ctx->m_streams.push_back(std::move(stream));
+    }
 
     streamdata data;
     data.streamIdx = idx;
@@ -442,9 +556,24 @@ bool CDVDDemuxCC::OpenDecoder()
 
 void CDVDDemuxCC::Dispose()
 {
-  m_streams.clear();
+  {
+    std::unique_lock lock(m_section);
+    m_streams.clear();
+    m_packets.clear();
+    for (DemuxPacket* pPacket : m_captions)
+      CDVDDemuxUtils::FreeDemuxPacket(pPacket);
+    m_captions.clear();
+  }
   m_streamdata.clear();
   m_ccDecoder.reset();
+  DiscardPending();
+}
+
+void CDVDDemuxCC::DiscardPending()
+{
+  m_hasData = false;
+  for (streamdata& data : m_streamdata)
+    data.hasData = false;
 
   while (!m_ccReorderBuffer.empty())
   {
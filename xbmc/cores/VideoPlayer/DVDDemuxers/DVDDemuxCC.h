@@ -9,22 +9,44 @@
 #pragma once
 
 #include "DVDDemux.h"
+#include "threads/CriticalSection.h"
+#include "threads/Event.h"
+#include "threads/Thread.h"
 
+#include <deque>
 #include <memory>
 #include <vector>
 
 class CCaptionBlock;
 class CDecoderCC708;
+class CDVDMsgDemuxerPacket;
 
-class CDVDDemuxCC : public CDVDDemux
+/*!
+ * \brief Extracts CEA-608/708 closed captions from the user data of MPEG-2 and H.264 video.
+ *
+ * Every video packet is scanned for captions, which is done on a thread of its own rather than
+ * on the one of the player demuxing the video: AddPacket() queues a reference to the packet on
+ * its way to the video decoder, Read() hands out the captions parsed so far.
+ */
+class CDVDDemuxCC : public CDVDDemux, private CThread
 {
 public:
   explicit CDVDDemuxCC(AVCodecID codec);
   ~CDVDDemuxCC() override;
 
   bool Reset() override { return true; }
-  void Flush() override {};
-  DemuxPacket* Read() override { return NULL; }
+
+  /*!
+   * \brief Discard the queued packets and the captions not handed out yet, e.g. after a seek.
+   */
+  void Flush() override;
+
+  /*!
+   * \brief Get the next caption packet parsed from the video.
+   * \return a caption packet, nullptr if there is none
+   */
+  DemuxPacket* Read() override;
+
   bool SeekTime(double time, bool backwards = false, double* startpts = NULL) override
   {
     return true;
@@ -33,14 +55,29 @@ public:
   std::vector<CDemuxStream*> GetStreams() const override;
   int GetNrOfStreams() const override;
 
-  DemuxPacket* Read(DemuxPacket *packet);
+  /*!
+   * \brief Queue a video packet for parsing.
+   * \param packet the message carrying the packet to the video decoder, the packet isn't changed
+   * and is kept until it has been parsed
+   * \param pts the presentation time of the packet
+   */
+  void AddPacket(std::shared_ptr<CDVDMsgDemuxerPacket> packet, double pts);
   static void Handler(int service, void *userdata);
 
 protected:
+  void Process() override;
   bool OpenDecoder();
   void Dispose();
+  void DiscardPending();
+  DemuxPacket* Parse(uint8_t* data, int size, double pts);
   DemuxPacket* Decode();
 
+  struct videopacket
+  {
+    std::shared_ptr<CDVDMsgDemuxerPacket> packet;
+    double pts;
+  };
+
   struct streamdata
   {
     int streamIdx;
@@ -49,11 +86,19 @@ protected:
     double pts;
   };
   std::vector<streamdata> m_streamdata;
-  std::vector<CDemuxStreamSubtitle> m_streams;
+  // pointers to the streams are handed out, they must stay valid when streams are added
+  std::deque<CDemuxStreamSubtitle> m_streams;
   bool m_hasData;
   double m_curPts;
   std::vector<CCaptionBlock*> m_ccReorderBuffer;
   std::vector<CCaptionBlock*> m_ccTempBuffer;
   std::unique_ptr<CDecoderCC708> m_ccDecoder;
   AVCodecID m_codec;
+
+  // guards the streams and the queues shared with the player
+  mutable CCriticalSection m_section;
+  CEvent m_packetEvent;
+  std::deque<videopacket> m_packets;
+  std::deque<DemuxPacket*> m_captions;
+  unsigned int m_generation = 0; //!< incremented by Flush()
 };
@@ -36,11 +36,16 @@
 #include "utils/XTimeUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <sstream>
+#include <string_view>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #ifndef __STDC_CONSTANT_MACROS
 #define __STDC_CONSTANT_MACROS
@@ -105,6 +110,241 @@ bool AttachmentIsFont(const AVDictionaryEntry* dict)
   }
   return false;
 }
+
+/*!
+ * \brief Stream parameters found by avformat_find_stream_info() for recently opened files.
+ *
+ * Probing reads and decodes the start of every stream, which takes seconds for files on a network
+ * share. The same file is often opened again shortly after, e.g. for playback right after its
+ * stream details were extracted or when playback is resumed, so the parameters are kept around
+ * and restored instead of probing again as long as the file hasn't changed.
+ *
+ * Only used for formats whose header declares all streams, the cached parameters can't tell
+ * about streams which show up later.
+ */
+class CProbeCache
+{
+public:
+  struct FileKey
+  {
+    std::string path;
+    int64_t size = 0;
+    int64_t mtime = 0;
+
+    bool operator==(const FileKey& rhs) const = default;
+  };
+
+  static CProbeCache& GetInstance()
+  {
+    static CProbeCache cache;
+    return cache;
+  }
+
+  void Store(const FileKey& key, const AVFormatContext* context)
+  {
+    auto result = std::make_shared<Result>();
+    result->key = key;
+    result->format = context->iformat->name;
+    result->startTime = context->start_time;
+    result->duration = context->duration;
+    result->streams.reserve(context->nb_streams);
+    for (unsigned int i = 0; i < context->nb_streams; ++i)
+    {
+      const AVStream* st = context->streams[i];
+      Stream& stream = result->streams.emplace_back();
+      stream.codecpar.reset(avcodec_parameters_alloc());
+      if (!stream.codecpar || avcodec_parameters_copy(stream.codecpar.get(), st->codecpar) < 0)
+        return;
+      stream.avgFrameRate = st->avg_frame_rate;
+      stream.rFrameRate = st->r_frame_rate;
+      stream.startTime = st->start_time;
+      stream.duration = st->duration;
+    }
+
+    std::unique_lock lock(m_section);
+    std::erase_if(m_results, [&key](const auto& cached) { return cached->key.path == key.path; });
+    if (m_results.size() >= MAX_RESULTS)
+      m_results.erase(m_results.begin());
+    m_results.emplace_back(std::move(result));
+  }
+
+  /*!
+   * \brief Restore the parameters of the streams of a file probed before.
+   * \return true if the parameters were restored, false if the file has to be probed
+   */
+  bool Restore(const FileKey& key, AVFormatContext* context) const
+  {
+    std::shared_ptr<const Result> result;
+    {
+      std::unique_lock lock(m_section);
+      const auto it = std::find_if(m_results.begin(), m_results.end(),
+                                   [&key](const auto& cached) { return cached->key == key; });
+      if (it == m_results.end())
+        return false;
+      result = *it;
+    }
+
+    if (result->format != context->iformat->name || result->streams.size() != context->nb_streams)
+      return false;
+
+    for (unsigned int i = 0; i < context->nb_streams; ++i)
+    {
+      const AVCodecParameters* codecpar = result->streams[i].codecpar.get();
+      if (codecpar->codec_type != context->streams[i]->codecpar->codec_type ||
+          codecpar->codec_id != context->streams[i]->codecpar->codec_id)
+        return false;
+    }
+
+    for (unsigned int i = 0; i < context->nb_streams; ++i)
+    {
+      const Stream& stream = result->streams[i];
+      AVStream* st = context->streams[i];
+      if (avcodec_parameters_copy(st->codecpar, stream.codecpar.get()) < 0)
+        return false;
+      st->avg_frame_rate = stream.avgFrameRate;
+      st->r_frame_rate = stream.rFrameRate;
+      st->start_time = stream.startTime;
+      st->duration = stream.duration;
+    }
+    context->start_time = result->startTime;
+    context->duration = result->duration;
+    return true;
+  }
+
+private:
+  struct CodecParametersDeleter
+  {
+    void operator()(AVCodecParameters* codecpar) const { avcodec_parameters_free(&codecpar); }
+  };
+
+  struct Stream
+  {
+    std::unique_ptr<AVCodecParameters, CodecParametersDeleter> codecpar;
+    AVRational avgFrameRate{};
+    AVRational rFrameRate{};
+    int64_t startTime = AV_NOPTS_VALUE;
+    int64_t duration = AV_NOPTS_VALUE;
+  };
+
+  struct Result
+  {
+    FileKey key;
+    std::string format;
+    int64_t startTime = AV_NOPTS_VALUE;
+    int64_t duration = AV_NOPTS_VALUE;
+    std::vector<Stream> streams;
+  };
+
+  static constexpr size_t MAX_RESULTS = 16;
+
+  mutable CCriticalSection m_section;
+  std::vector<std::shared_ptr<const Result>> m_results; // oldest first
+};
+
+/*!
+ * \brief Get the key identifying the current version of a file, if its probe results may be cached.
+ */
+std::optional<CProbeCache::FileKey> GetProbeCacheKey(CDVDInputStream& input,
+                                                     const AVFormatContext* context)
+{
+  if (!input.IsStreamType(DVDSTREAM_TYPE_FILE) || input.IsRealtime() || !context->pb ||
+      !context->pb->seekable || (context->ctx_flags & AVFMTCTX_NOHEADER))
+    return {};
+
+  // formats known to declare all streams with their codecs in the header
+  const std::string_view format = context->iformat->name;
+  if (!format.starts_with("matroska") && !format.starts_with("mov,"))
+    return {};
+
+  CProbeCache::FileKey key;
+  key.path = input.GetFileName();
+  key.size = input.GetLength();
+
+  struct __stat64 buffer{};
+  if (key.size <= 0 || XFILE::CFile::Stat(key.path, &buffer) != 0 || buffer.st_mtime == 0)
+    return {};
+
+  key.mtime = static_cast<int64_t>(buffer.st_mtime);
+  return key;
+}
+
+/*!
+ * \brief Keyframe positions seen while playing recently opened files.
+ *
+ * Formats without a usable index, like transport streams or matroska files lacking cues, are
+ * seeked by bisecting the file on timestamps, which often lands a few keyframes off. The keyframes
+ * read during playback are added to the index of their stream, so seeks within the played part
+ * are exact, and kept here so the next playback of the unchanged file starts with them.
+ */
+class CSeekIndexCache
+{
+public:
+  using Index = std::map<int, std::map<int64_t, int64_t>>; // stream -> dts -> byte position
+
+  static CSeekIndexCache& GetInstance()
+  {
+    static CSeekIndexCache cache;
+    return cache;
+  }
+
+  void Store(const CProbeCache::FileKey& key, Index index)
+  {
+    std::unique_lock lock(m_section);
+    std::erase_if(m_results, [&key](const auto& cached) { return cached.key.path == key.path; });
+    if (m_results.size() >= MAX_RESULTS)
+      m_results.erase(m_results.begin());
+    m_results.push_back({key, std::move(index)});
+  }
+
+  Index Restore(const CProbeCache::FileKey& key) const
+  {
+    std::unique_lock lock(m_section);
+    const auto it = std::find_if(m_results.begin(), m_results.end(),
+                                 [&key](const auto& cached) { return cached.key == key; });
+    if (it == m_results.end())
+      return {};
+    return it->index;
+  }
+
+private:
+  struct Result
+  {
+    CProbeCache::FileKey key;
+    Index index;
+  };
+
+  static constexpr size_t MAX_RESULTS = 16;
+
+  mutable CCriticalSection m_section;
+  std::vector<Result> m_results; // oldest first
+};
+
+/*!
+ * \brief Get the key identifying the current version of a file, if a seek index should be built.
+ */
+std::optional<CProbeCache::FileKey> GetSeekIndexKey(CDVDInputStream& input,
+                                                    const AVFormatContext* context)
+{
+  if (input.IsRealtime() || !context->pb || !context->pb->seekable)
+    return {};
+
+  // formats seeked by bisection or by reading ahead when the file has no index
+  const std::string_view format = context->iformat->name;
+  if (format != "mpegts" && format != "mpeg" && !format.starts_with("matroska"))
+    return {};
+
+  CProbeCache::FileKey key;
+  key.path = input.GetFileName();
+  key.size = input.GetLength();
+  if (key.size <= 0)
+    return {};
+
+  // not every input stream can be stat'ed, the size has to do for those
+  struct __stat64 buffer{};
+  if (XFILE::CFile::Stat(key.path, &buffer) == 0)
+    key.mtime = static_cast<int64_t>(buffer.st_mtime);
+  return key;
+}
 } // namespace
 
 std::string CDemuxStreamAudioFFmpeg::GetStreamName()
@@ -241,6 +481,8 @@ bool CDVDDemuxFFmpeg::Open(const std::shared_ptr<CDVDInputStream>& pInput, bool
   m_streaminfo = !pInput->IsRealtime() && !m_reopen;
   m_reopen = false;
   m_currentPts = DVD_NOPTS_VALUE;
+  m_prefetchChapterStart = 0.0;
+  m_prefetchChapterEnd = 0.0;
   m_speed = DVD_PLAYSPEED_NORMAL;
   m_program = UINT_MAX;
   m_seekToKeyFrame = false;
@@ -489,8 +731,21 @@ bool CDVDDemuxFFmpeg::Open(const std::shared_ptr<CDVDInputStream>& pInput, bool
     if (m_pInput->IsStreamType(DVDSTREAM_TYPE_DVD))
       av_opt_set_int(m_pFormatContext, "analyzeduration", 500000, 0);
 
-    CLog::Log(LOGDEBUG, "{} - avformat_find_stream_info starting", __FUNCTION__);
-    int iErr = avformat_find_stream_info(m_pFormatContext, NULL);
+    const std::optional<CProbeCache::FileKey> probeKey =
+        GetProbeCacheKey(*m_pInput, m_pFormatContext);
+
+    int iErr = 0;
+    if (probeKey && CProbeCache::GetInstance().Restore(*probeKey, m_pFormatContext))
+    {
+      CLog::Log(LOGDEBUG, "{} - restored stream info of unchanged file", __FUNCTION__);
+    }
+    else
+    {
+      CLog::Log(LOGDEBUG, "{} - avformat_find_stream_info starting", __FUNCTION__);
+      iErr = avformat_find_stream_info(m_pFormatContext, NULL);
+      if (iErr >= 0 && probeKey)
+        CProbeCache::GetInstance().Store(*probeKey, m_pFormatContext);
+    }
     if (iErr < 0)
     {
       CLog::Log(LOGWARNING, "could not find codec parameters for {}", CURL::GetRedacted(strFile));
@@ -597,6 +852,27 @@ bool CDVDDemuxFFmpeg::Open(const std::shared_ptr<CDVDInputStream>& pInput, bool
   m_startTime = 0;
   m_seekStream = -1;
 
+  const std::optional<CProbeCache::FileKey> seekIndexKey =
+      GetSeekIndexKey(*m_pInput, m_pFormatContext);
+  m_buildSeekIndex = seekIndexKey.has_value();
+  if (seekIndexKey)
+  {
+    m_seekIndex = CSeekIndexCache::GetInstance().Restore(*seekIndexKey);
+    std::erase_if(m_seekIndex, [this](const auto& keyframes) {
+      return keyframes.first >= static_cast<int>(m_pFormatContext->nb_streams) ||
+             m_pFormatContext->streams[keyframes.first]->codecpar->codec_type !=
+                 AVMEDIA_TYPE_VIDEO;
+    });
+    for (const auto& [streamIdx, keyframes] : m_seekIndex)
+    {
+      for (const auto& [dts, pos] : keyframes)
+        av_add_index_entry(m_pFormatContext->streams[streamIdx], pos, dts, 0, 0,
+                           AVINDEX_KEYFRAME);
+    }
+    if (!m_seekIndex.empty())
+      CLog::Log(LOGDEBUG, "{} - restored seek index of unchanged file", __FUNCTION__);
+  }
+
   if (m_checkTransportStream && m_streaminfo)
   {
     int64_t duration = m_pFormatContext->duration;
@@ -618,6 +894,13 @@ void CDVDDemuxFFmpeg::Dispose()
 
   if (m_pFormatContext)
   {
+    if (m_buildSeekIndex && !m_seekIndex.empty())
+    {
+      const std::optional<CProbeCache::FileKey> key = GetSeekIndexKey(*m_pInput, m_pFormatContext);
+      if (key)
+        CSeekIndexCache::GetInstance().Store(*key, std::move(m_seekIndex));
+    }
+
     if (m_ioContext && m_pFormatContext->pb && m_pFormatContext->pb != m_ioContext)
     {
       CLog::Log(LOGWARNING, "CDVDDemuxFFmpeg::Dispose - demuxer changed our byte context behind our back, possible memleak");
@@ -638,6 +921,9 @@ void CDVDDemuxFFmpeg::Dispose()
 
   DisposeStreams();
 
+  m_buildSeekIndex = false;
+  m_seekIndex.clear();
+
   m_pInput = NULL;
 }
 
@@ -1039,6 +1325,15 @@ DemuxPacket* CDVDDemuxFFmpeg::ReadInternal(bool keep)
 
         AVStream* stream = m_pFormatContext->streams[m_pkt.pkt.stream_index];
 
+        // remember where keyframes are, bisecting on timestamps misses them
+        if (m_buildSeekIndex && (m_pkt.pkt.flags & AV_PKT_FLAG_KEY) && m_pkt.pkt.pos >= 0 &&
+            m_pkt.pkt.dts != AV_NOPTS_VALUE && stream->codecpar->codec_type == AVMEDIA_TYPE_VIDEO)
+        {
+          auto& keyframes = m_seekIndex[m_pkt.pkt.stream_index];
+          if (keyframes.emplace(m_pkt.pkt.dts, m_pkt.pkt.pos).second)
+            av_add_index_entry(stream, m_pkt.pkt.pos, m_pkt.pkt.dts, 0, 0, AVINDEX_KEYFRAME);
+        }
+
         if (IsTransportStreamReady())
         {
           if (m_program != UINT_MAX)
@@ -1116,6 +1411,8 @@ DemuxPacket* CDVDDemuxFFmpeg::ReadInternal(bool keep)
               (pPacket->pts > m_currentPts || m_currentPts == DVD_NOPTS_VALUE))
             m_currentPts = pPacket->pts;
 
+          PrefetchNextChapter();
+
           // store internal id until we know the continuous id presented to player
           // the stream might not have been created yet
           pPacket->iStreamId = m_pkt.pkt.stream_index;
@@ -2094,6 +2391,60 @@ bool CDVDDemuxFFmpeg::SeekChapter(int chapter, double* startpts)
   return SeekTime(DVD_TIME_TO_MSEC(dts), true, startpts);
 }
 
+void CDVDDemuxFFmpeg::PrefetchNextChapter()
+{
+  if (!m_pFormatContext || m_pFormatContext->nb_chapters < 2 || m_currentPts == DVD_NOPTS_VALUE)
+    return;
+
+  // only look again once playback left the chapter the last hint was sent for
+  if (m_currentPts >= m_prefetchChapterStart && m_currentPts < m_prefetchChapterEnd)
+    return;
+
+  if (std::dynamic_pointer_cast<CDVDInputStream::IChapter>(m_pInput))
+    return;
+
+  for (unsigned i = 0; i < m_pFormatContext->nb_chapters; i++)
+  {
+    const AVChapter* chapter = m_pFormatContext->chapters[i];
+    const double start =
+        ConvertTimestamp(chapter->start, chapter->time_base.den, chapter->time_base.num);
+    const double end =
+        ConvertTimestamp(chapter->end, chapter->time_base.den, chapter->time_base.num);
+    if (m_currentPts < start || m_currentPts >= end)
+      continue;
+
+    m_prefetchChapterStart = start;
+    m_prefetchChapterEnd = end;
+
+    if (i + 1 >= m_pFormatContext->nb_chapters)
+      return;
+
+    // find the keyframe a chapter skip would land on, in the stream av_seek_frame defaults to
+    const int streamIdx = av_find_default_stream_index(m_pFormatContext);
+    if (streamIdx < 0)
+      return;
+
+    AVStream* st = m_pFormatContext->streams[streamIdx];
+    const AVChapter* next = m_pFormatContext->chapters[i + 1];
+    const int64_t ts = av_rescale_q(next->start, next->time_base, st->time_base);
+    const int idx = av_index_search_timestamp(st, ts, AVSEEK_FLAG_BACKWARD);
+    const AVIndexEntry* entry = idx >= 0 ? avformat_index_get_entry(st, idx) : nullptr;
+    if (!entry || entry->pos < 0)
+      return;
+
+    // fetch up to the following keyframe, that is what decoding needs to resume
+    constexpr int64_t minSize = 1024 * 1024;
+    constexpr int64_t maxSize = 8 * 1024 * 1024;
+    int64_t size = 2 * 1024 * 1024;
+    const AVIndexEntry* following = avformat_index_get_entry(st, idx + 1);
+    if (following && following->pos > entry->pos)
+      size = std::clamp(following->pos - entry->pos, minSize, maxSize);
+
+    m_pInput->Prefetch(entry->pos, size);
+    return;
+  }
+}
+
 std::string CDVDDemuxFFmpeg::GetStreamCodecName(int iStreamId)
 {
   CDemuxStream* stream = GetStream(iStreamId);
@@ -133,6 +133,7 @@ protected:
   AVDictionary* GetFFMpegOptionsFromInput();
   double ConvertTimestamp(int64_t pts, int den, int num);
   bool IsProgramChange();
+  void PrefetchNextChapter();
   unsigned int HLSSelectProgram();
 
   std::string GetStereoModeFromMetadata(AVDictionary* pMetadata);
@@ -178,5 +179,9 @@ protected:
   double m_dtsAtDisplayTime;
   bool m_seekToKeyFrame = false;
   double m_startTime = 0;
+  double m_prefetchChapterStart = 0.0; // chapter the last prefetch hint was sent for
+  double m_prefetchChapterEnd = 0.0;
+  bool m_buildSeekIndex = false;
+  std::map<int, std::map<int64_t, int64_t>> m_seekIndex; // stream -> dts -> byte position of keyframes
 };
 
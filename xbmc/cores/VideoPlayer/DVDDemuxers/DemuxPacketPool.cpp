@@ -0,0 +1,122 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "DemuxPacketPool.h"
+
+#include "utils/MemUtils.h"
+
+#include <mutex>
+
+namespace
+{
+// keeps the payload aligned, the size class is stored in the first bytes
+constexpr size_t HEADER_SIZE = CDemuxPacketPool::ALIGNMENT;
+
+uint32_t& ClassOf(void* block)
+{
+  return *static_cast<uint32_t*>(block);
+}
+} // namespace
+
+CDemuxPacketPool& CDemuxPacketPool::GetInstance()
+{
+  static CDemuxPacketPool pool;
+  return pool;
+}
+
+CDemuxPacketPool::~CDemuxPacketPool()
+{
+  Trim();
+}
+
+unsigned int CDemuxPacketPool::SizeClass(size_t size)
+{
+  unsigned int shift = MIN_CLASS_SHIFT;
+  while (shift <= MAX_CLASS_SHIFT && (static_cast<size_t>(1) << shift) < size)
+    shift++;
+
+  if (shift > MAX_CLASS_SHIFT)
+    return UNPOOLED;
+  return shift - MIN_CLASS_SHIFT;
+}
+
+uint8_t* CDemuxPacketPool::Allocate(size_t size)
+{
+  m_allocations++;
+
+  const unsigned int sizeClass = SizeClass(size);
+  void* block = nullptr;
+
+  if (sizeClass != UNPOOLED)
+  {
+    std::unique_lock lock(m_lock);
+    auto& freeList = m_freeLists[sizeClass];
+    if (!freeList.empty())
+    {
+      block = freeList.back();
+      freeList.pop_back();
+      m_pooledBytes -= static_cast<size_t>(1) << (sizeClass + MIN_CLASS_SHIFT);
+      m_recycled++;
+    }
+  }
+
+  if (!block)
+  {
+    const size_t capacity =
+        sizeClass != UNPOOLED ? static_cast<size_t>(1) << (sizeClass + MIN_CLASS_SHIFT) : size;
+    block = KODI::MEMORY::AlignedMalloc(capacity + HEADER_SIZE, ALIGNMENT);
+    if (!block)
+      return nullptr;
+    ClassOf(block) = sizeClass;
+  }
+
+  return static_cast<uint8_t*>(block) + HEADER_SIZE;
+}
+
+void CDemuxPacketPool::Free(uint8_t* data)
+{
+  if (!data)
+    return;
+
+  void* block = data - HEADER_SIZE;
+  const uint32_t sizeClass = ClassOf(block);
+
+  if (sizeClass != UNPOOLED)
+  {
+    const size_t capacity = static_cast<size_t>(1) << (sizeClass + MIN_CLASS_SHIFT);
+
+    std::unique_lock lock(m_lock);
+    if (m_pooledBytes + capacity <= MAX_POOLED_BYTES)
+    {
+      m_freeLists[sizeClass].push_back(block);
+      m_pooledBytes += capacity;
+      return;
+    }
+  }
+
+  KODI::MEMORY::AlignedFree(block);
+}
+
+void CDemuxPacketPool::Trim()
+{
+  std::unique_lock lock(m_lock);
+
+  for (auto& freeList : m_freeLists)
+  {
+    for (void* block : freeList)
+      KODI::MEMORY::AlignedFree(block);
+    freeList.clear();
+  }
+  m_pooledBytes = 0;
+}
+
+CDemuxPacketPool::Stats CDemuxPacketPool::GetStats() const
+{
+  std::unique_lock lock(m_lock);
+  return {m_allocations, m_recycled, m_pooledBytes};
+}
@@ -0,0 +1,79 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <array>
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+/*!
+ \brief Recycles demux packet payload buffers.
+
+ Buffers are rounded up to power of two size classes and kept on a per class free list when
+ released, so steady state playback does not hit the allocator for every packet. Each buffer
+ carries a small header in front of the returned pointer recording its class, so the caller
+ does not need to remember the requested size. Buffers larger than the biggest class are
+ allocated and freed directly. Safe to use from several threads.
+ */
+class CDemuxPacketPool
+{
+public:
+  struct Stats
+  {
+    uint64_t allocations; /**< number of buffers handed out */
+    uint64_t recycled; /**< number of those served from a free list */
+    size_t pooledBytes; /**< bytes currently held on the free lists */
+  };
+
+  static CDemuxPacketPool& GetInstance();
+
+  CDemuxPacketPool() = default;
+  ~CDemuxPacketPool();
+  CDemuxPacketPool(const CDemuxPacketPool&) = delete;
+  CDemuxPacketPool& operator=(const CDemuxPacketPool&) = delete;
+
+  /*!
+   \brief Get a buffer of at least size bytes, aligned to ALIGNMENT
+   \return the buffer or nullptr if out of memory
+   */
+  uint8_t* Allocate(size_t size);
+
+  /*!
+   \brief Return a buffer obtained from Allocate(), nullptr is ignored
+   */
+  void Free(uint8_t* data);
+
+  /*!
+   \brief Release all buffers held on the free lists
+   */
+  void Trim();
+
+  Stats GetStats() const;
+
+  static constexpr size_t ALIGNMENT = 64;
+  static constexpr size_t MAX_POOLED_BYTES = 64 * 1024 * 1024;
+
+private:
+  static constexpr unsigned int MIN_CLASS_SHIFT = 10; // 1 KiB
+  static constexpr unsigned int MAX_CLASS_SHIFT = 22; // 4 MiB
+  static constexpr unsigned int CLASS_COUNT = MAX_CLASS_SHIFT - MIN_CLASS_SHIFT + 1;
+  static constexpr uint32_t UNPOOLED = UINT32_MAX;
+
+  static unsigned int SizeClass(size_t size);
+
+  std::array<std::vector<void*>, CLASS_COUNT> m_freeLists;
+  size_t m_pooledBytes = 0;
+  std::atomic<uint64_t> m_allocations{0};
+  std::atomic<uint64_t> m_recycled{0};
+  mutable CCriticalSection m_lock;
+};
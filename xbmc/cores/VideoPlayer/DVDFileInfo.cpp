@@ -44,7 +44,9 @@
 #include "filesystem/File.h"
 #include "utils/LangCodeExpander.h"
 
+#include <algorithm>
 #include <cstdlib>
+#include <cstring>
 #include <memory>
 
 extern "C" {
@@ -93,166 +95,294 @@ int DegreeToOrientation(int degrees)
   }
 }
 
-std::unique_ptr<CTexture> CDVDFileInfo::ExtractThumbToTexture(const CFileItem& fileItem,
-                                                              int chapterNumber)
+namespace
+{
+/*!
+ * \brief The opened video stream of a file, ready to decode frames for thumbnails.
+ */
+struct ThumbSource
+{
+  std::shared_ptr<CDVDInputStream> inputStream;
+  std::unique_ptr<CDVDDemux> demuxer;
+  std::unique_ptr<CProcessInfo> processInfo;
+  std::unique_ptr<CDVDVideoCodec> videoCodec;
+  CDVDStreamInfo hint;
+  int videoStream{-1};
+  int packetsTried{0};
+};
+
+bool OpenThumbSource(const CFileItem& fileItem, ThumbSource& source)
 {
-  if (!CanExtract(fileItem))
-    return {};
-
   const std::string redactPath = CURL::GetRedacted(fileItem.GetPath());
-  auto start = std::chrono::steady_clock::now();
 
   CFileItem item(fileItem);
   item.SetMimeTypeForInternetFile();
-  auto pInputStream = CDVDFactoryInputStream::CreateInputStream(NULL, item);
-  if (!pInputStream)
+  source.inputStream = CDVDFactoryInputStream::CreateInputStream(NULL, item);
+  if (!source.inputStream)
   {
     CLog::Log(LOGERROR, "InputStream: Error creating stream for {}", redactPath);
-    return {};
+    return false;
   }
 
-  if (!pInputStream->Open())
+  if (!source.inputStream->Open())
   {
     CLog::Log(LOGERROR, "InputStream: Error opening, {}", redactPath);
-    return {};
+    return false;
   }
 
-  std::unique_ptr<CDVDDemux> demuxer{CDVDFactoryDemuxer::CreateDemuxer(pInputStream, true)};
-  if (!demuxer)
+  source.demuxer.reset(CDVDFactoryDemuxer::CreateDemuxer(source.inputStream, true));
+  if (!source.demuxer)
   {
     CLog::LogF(LOGERROR, "Error creating demuxer");
-    return {};
+    return false;
   }
 
-  int nVideoStream = -1;
   int64_t demuxerId = -1;
-  for (CDemuxStream* pStream : demuxer->GetStreams())
+  for (CDemuxStream* pStream : source.demuxer->GetStreams())
   {
     if (pStream)
     {
       // ignore if it's a picture attachment (e.g. jpeg artwork)
       if (pStream->type == StreamType::VIDEO && !(pStream->flags & AV_DISPOSITION_ATTACHED_PIC))
       {
-        nVideoStream = pStream->uniqueId;
+        source.videoStream = pStream->uniqueId;
         demuxerId = pStream->demuxerId;
       }
       else
-        demuxer->EnableStream(pStream->demuxerId, pStream->uniqueId, false);
+        source.demuxer->EnableStream(pStream->demuxerId, pStream->uniqueId, false);
     }
   }
 
-  int packetsTried = 0;
+  if (source.videoStream == -1)
+    return false;
+
+  source.processInfo.reset(CProcessInfo::CreateInstance());
+  std::vector<AVPixelFormat> pixFmts;
+  pixFmts.push_back(AV_PIX_FMT_YUV420P);
+  source.processInfo->SetPixFormats(pixFmts);
 
-  std::unique_ptr<CTexture> result{};
-  if (nVideoStream != -1)
+  source.hint = CDVDStreamInfo(*source.demuxer->GetStream(demuxerId, source.videoStream), true);
+  source.hint.codecOptions = CODEC_FORCE_SOFTWARE | CODEC_KEYFRAMES_ONLY;
+
+  source.videoCodec = CDVDFactoryCodec::CreateVideoCodec(source.hint, *source.processInfo);
+  return source.videoCodec != nullptr;
+}
+
+/*!
+ * \brief Seek to the given time and decode the first picture from there.
+ */
+bool DecodePictureAt(ThumbSource& source, int64_t seekTo, VideoPicture& picture)
+{
+  if (!source.demuxer->SeekTime(static_cast<double>(seekTo), true))
+    return false;
+
+  CDVDVideoCodec::VCReturn iDecoderState = CDVDVideoCodec::VC_NONE;
+
+  // num streams * 160 frames, should get a valid frame, if not abort.
+  int abort_index = source.demuxer->GetNrOfStreams() * 160;
+  // the seek lands on a key frame, so only that one needs decoding. Streams that don't
+  // flag their key frames get the rest of the packets decoded normally.
+  const int keyframesOnlyUntil = abort_index / 2;
+  do
   {
-    std::unique_ptr<CProcessInfo> pProcessInfo(CProcessInfo::CreateInstance());
-    std::vector<AVPixelFormat> pixFmts;
-    pixFmts.push_back(AV_PIX_FMT_YUV420P);
-    pProcessInfo->SetPixFormats(pixFmts);
+    DemuxPacket* pPacket = source.demuxer->Read();
+    source.packetsTried++;
+
+    if (!pPacket)
+      break;
 
-    CDVDStreamInfo hint(*demuxer->GetStream(demuxerId, nVideoStream), true);
-    hint.codecOptions = CODEC_FORCE_SOFTWARE;
+    if (pPacket->iStreamId != source.videoStream)
+    {
+      CDVDDemuxUtils::FreeDemuxPacket(pPacket);
+      continue;
+    }
 
-    std::unique_ptr<CDVDVideoCodec> pVideoCodec =
-        CDVDFactoryCodec::CreateVideoCodec(hint, *pProcessInfo);
+    source.videoCodec->AddData(*pPacket);
+    CDVDDemuxUtils::FreeDemuxPacket(pPacket);
 
-    if (pVideoCodec)
+    iDecoderState = CDVDVideoCodec::VC_NONE;
+    while (iDecoderState == CDVDVideoCodec::VC_NONE)
     {
-      int nTotalLen = demuxer->GetStreamLength();
+      iDecoderState = source.videoCodec->GetPicture(&picture);
+    }
 
-      bool seekToChapter = chapterNumber > 0 && demuxer->GetChapterCount() > 0;
-      int64_t nSeekTo =
-          seekToChapter ? demuxer->GetChapterPos(chapterNumber) * 1000 : nTotalLen / 3;
+    if (iDecoderState == CDVDVideoCodec::VC_PICTURE)
+    {
+      if (!(picture.iFlags & DVP_FLAG_DROPPED))
+        break;
+    }
 
-      CLog::LogF(LOGDEBUG, "seeking to pos {}ms (total: {}ms) in {}", nSeekTo, nTotalLen,
-                 redactPath);
+    if (abort_index == keyframesOnlyUntil)
+      source.videoCodec->SetCodecControl(0);
 
-      if (demuxer->SeekTime(static_cast<double>(nSeekTo), true))
-      {
-        CDVDVideoCodec::VCReturn iDecoderState = CDVDVideoCodec::VC_NONE;
-        VideoPicture picture = {};
+  } while (abort_index--);
 
-        // num streams * 160 frames, should get a valid frame, if not abort.
-        int abort_index = demuxer->GetNrOfStreams() * 160;
-        do
-        {
-          DemuxPacket* pPacket = demuxer->Read();
-          packetsTried++;
+  return iDecoderState == CDVDVideoCodec::VC_PICTURE && !(picture.iFlags & DVP_FLAG_DROPPED);
+}
 
-          if (!pPacket)
-            break;
+double GetPictureAspect(const ThumbSource& source, const VideoPicture& picture)
+{
+  if (source.hint.forced_aspect && source.hint.aspect != 0)
+    return source.hint.aspect;
+  return static_cast<double>(picture.iDisplayWidth) / static_cast<double>(picture.iDisplayHeight);
+}
 
-          if (pPacket->iStreamId != nVideoStream)
-          {
-            CDVDDemuxUtils::FreeDemuxPacket(pPacket);
-            continue;
-          }
+/*!
+ * \brief Scale a decoded picture into the given area of a BGRA texture.
+ */
+void ScalePicture(
+    const VideoPicture& picture, CTexture& texture, int x, int y, int width, int height)
+{
+  struct SwsContext* context =
+      sws_getContext(picture.iWidth, picture.iHeight, AV_PIX_FMT_YUV420P, width, height,
+                     AV_PIX_FMT_BGRA, SWS_FAST_BILINEAR, NULL, NULL, NULL);
+  if (!context)
+    return;
+
+  uint8_t* planes[YuvImage::MAX_PLANES];
+  int stride[YuvImage::MAX_PLANES];
+  picture.videoBuffer->GetPlanes(planes);
+  picture.videoBuffer->GetStrides(stride);
+  uint8_t* src[4] = {planes[0], planes[1], planes[2], 0};
+  int srcStride[] = {stride[0], stride[1], stride[2], 0};
+  uint8_t* dst[] = {texture.GetPixels() + y * texture.GetPitch() + x * 4, 0, 0, 0};
+  int dstStride[] = {static_cast<int>(texture.GetPitch()), 0, 0, 0};
+  sws_scale(context, src, srcStride, 0, picture.iHeight, dst, dstStride);
+  sws_freeContext(context);
+}
+} // unnamed namespace
 
-          pVideoCodec->AddData(*pPacket);
-          CDVDDemuxUtils::FreeDemuxPacket(pPacket);
+std::unique_ptr<CTexture> CDVDFileInfo::ExtractThumbToTexture(const CFileItem& fileItem,
+                                                              int chapterNumber)
+{
+  if (!CanExtract(fileItem))
+    return {};
 
-          iDecoderState = CDVDVideoCodec::VC_NONE;
-          while (iDecoderState == CDVDVideoCodec::VC_NONE)
-          {
-            iDecoderState = pVideoCodec->GetPicture(&picture);
-          }
+  const std::string redactPath = CURL::GetRedacted(fileItem.GetPath());
+  auto start = std::chrono::steady_clock::now();
 
-          if (iDecoderState == CDVDVideoCodec::VC_PICTURE)
-          {
-            if (!(picture.iFlags & DVP_FLAG_DROPPED))
-              break;
-          }
+  ThumbSource source;
+  std::unique_ptr<CTexture> result{};
+  if (OpenThumbSource(fileItem, source))
+  {
+    CDVDDemux& demuxer = *source.demuxer;
+    int nTotalLen = demuxer.GetStreamLength();
 
-        } while (abort_index--);
+    bool seekToChapter = chapterNumber > 0 && demuxer.GetChapterCount() > 0;
+    int64_t nSeekTo = seekToChapter ? demuxer.GetChapterPos(chapterNumber) * 1000 : nTotalLen / 3;
 
-        if (iDecoderState == CDVDVideoCodec::VC_PICTURE && !(picture.iFlags & DVP_FLAG_DROPPED))
-        {
-          unsigned int nWidth =
-              std::min(picture.iDisplayWidth,
-                       CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_imageRes);
-          double aspect = (double)picture.iDisplayWidth / (double)picture.iDisplayHeight;
-          if (hint.forced_aspect && hint.aspect != 0)
-            aspect = hint.aspect;
-          unsigned int nHeight = (unsigned int)((double)nWidth / aspect);
-
-          result = CTexture::CreateTexture(nWidth, nHeight);
-          result->SetAlpha(false);
-          struct SwsContext* context =
-              sws_getContext(picture.iWidth, picture.iHeight, AV_PIX_FMT_YUV420P, nWidth, nHeight,
-                             AV_PIX_FMT_BGRA, SWS_FAST_BILINEAR, NULL, NULL, NULL);
-
-          if (context)
-          {
-            uint8_t* planes[YuvImage::MAX_PLANES];
-            int stride[YuvImage::MAX_PLANES];
-            picture.videoBuffer->GetPlanes(planes);
-            picture.videoBuffer->GetStrides(stride);
-            uint8_t* src[4] = {planes[0], planes[1], planes[2], 0};
-            int srcStride[] = {stride[0], stride[1], stride[2], 0};
-            uint8_t* dst[] = {result->GetPixels(), 0, 0, 0};
-            int dstStride[] = {static_cast<int>(result->GetPitch()), 0, 0, 0};
-            result->SetOrientation(DegreeToOrientation(hint.orientation));
-            sws_scale(context, src, srcStride, 0, picture.iHeight, dst, dstStride);
-            sws_freeContext(context);
-          }
-        }
-        else
-        {
-          CLog::LogF(LOGDEBUG, "decode failed in {} after {} packets.", redactPath, packetsTried);
-        }
-      }
+    CLog::LogF(LOGDEBUG, "seeking to pos {}ms (total: {}ms) in {}", nSeekTo, nTotalLen,
+               redactPath);
+
+    VideoPicture picture = {};
+    if (DecodePictureAt(source, nSeekTo, picture))
+    {
+      unsigned int nWidth =
+          std::min(picture.iDisplayWidth,
+                   CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_imageRes);
+      unsigned int nHeight = (unsigned int)((double)nWidth / GetPictureAspect(source, picture));
+
+      result = CTexture::CreateTexture(nWidth, nHeight);
+      result->SetAlpha(false);
+      result->SetOrientation(DegreeToOrientation(source.hint.orientation));
+      ScalePicture(picture, *result, 0, 0, nWidth, nHeight);
+    }
+    else if (source.packetsTried > 0)
+    {
+      CLog::LogF(LOGDEBUG, "decode failed in {} after {} packets.", redactPath,
+                 source.packetsTried);
     }
   }
 
   auto end = std::chrono::steady_clock::now();
   auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
   CLog::LogF(LOGDEBUG, "measured {} ms to extract thumb from file <{}> in {} packets. ",
-             duration.count(), redactPath, packetsTried);
+             duration.count(), redactPath, source.packetsTried);
 
   return result;
 }
 
+void CDVDFileInfo::GetThumbSheetLayout(int count, int& columns, int& rows)
+{
+  columns = 1;
+  while (columns * columns < count)
+    columns++;
+  rows = (count + columns - 1) / columns;
+}
+
+std::unique_ptr<CTexture> CDVDFileInfo::ExtractChapterSheetToTexture(const CFileItem& fileItem,
+                                                                     int chapterCount)
+{
+  if (chapterCount < 2 || chapterCount > MAX_THUMB_SHEET_TILES || !CanExtract(fileItem))
+    return {};
+
+  const std::string redactPath = CURL::GetRedacted(fileItem.GetPath());
+  auto start = std::chrono::steady_clock::now();
+
+  ThumbSource source;
+  if (!OpenThumbSource(fileItem, source))
+    return {};
+
+  // tiles are cut out by position, a rotation applied to the whole sheet would scramble them
+  if (source.demuxer->GetChapterCount() < chapterCount || source.hint.orientation != 0)
+    return {};
+
+  int columns;
+  int rows;
+  GetThumbSheetLayout(chapterCount, columns, rows);
+
+  // size the sheet to what the texture cache keeps, so it isn't scaled down when cached
+  const unsigned int imageRes =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_imageRes;
+  const unsigned int maxWidth = imageRes * 16 / 9;
+
+  std::unique_ptr<CTexture> sheet;
+  int tileWidth = 0;
+  int tileHeight = 0;
+  for (int chapter = 1; chapter <= chapterCount; ++chapter)
+  {
+    if (chapter > 1)
+      source.videoCodec->Reset();
+
+    VideoPicture picture = {};
+    if (!DecodePictureAt(source, source.demuxer->GetChapterPos(chapter) * 1000, picture))
+    {
+      CLog::LogF(LOGDEBUG, "no picture for chapter {} of {}", chapter, redactPath);
+      continue;
+    }
+
+    if (!sheet)
+    {
+      // the first picture decides the aspect ratio of all tiles
+      const double aspect = GetPictureAspect(source, picture);
+      tileWidth = std::min(picture.iDisplayWidth, maxWidth / columns);
+      tileHeight = static_cast<int>(tileWidth / aspect);
+      if (tileHeight * rows > static_cast<int>(imageRes))
+      {
+        tileHeight = imageRes / rows;
+        tileWidth = static_cast<int>(tileHeight * aspect);
+      }
+      if (tileWidth <= 0 || tileHeight <= 0)
+        return {};
+
+      sheet = CTexture::CreateTexture(tileWidth * columns, tileHeight * rows);
+      sheet->SetAlpha(false);
+      std::memset(sheet->GetPixels(), 0, sheet->GetPitch() * sheet->GetRows());
+    }
+
+    const int tile = chapter - 1;
+    ScalePicture(picture, *sheet, (tile % columns) * tileWidth, (tile / columns) * tileHeight,
+                 tileWidth, tileHeight);
+  }
+
+  auto end = std::chrono::steady_clock::now();
+  auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+  CLog::LogF(LOGDEBUG, "measured {} ms to extract {} chapter thumbs from file <{}> in {} packets",
+             duration.count(), chapterCount, redactPath, source.packetsTried);
+
+  return sheet;
+}
+
 bool CDVDFileInfo::CanExtract(const CFileItem& fileItem)
 {
   if (fileItem.IsFolder())
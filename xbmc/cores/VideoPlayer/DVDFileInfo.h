@@ -26,6 +26,26 @@ public:
   static std::unique_ptr<CTexture> ExtractThumbToTexture(const CFileItem& fileItem,
                                                          int chapterNumber = 0);
 
+  static constexpr int MAX_THUMB_SHEET_TILES = 36;
+
+  /*!
+   * @brief Extract the thumbs of the first chapters into one sprite sheet.
+   *
+   * The file is opened once and only the key frame at each chapter start is decoded. Tiles are
+   * laid out row by row as given by GetThumbSheetLayout(), all with the same size. Chapters
+   * without a picture leave their tile black.
+   * @param fileItem the file to extract from
+   * @param chapterCount number of chapters to extract, at most MAX_THUMB_SHEET_TILES
+   * @return the sheet, or nullptr if the file has fewer chapters or nothing could be decoded
+   */
+  static std::unique_ptr<CTexture> ExtractChapterSheetToTexture(const CFileItem& fileItem,
+                                                                int chapterCount);
+
+  /*!
+   * @brief Get the grid used by ExtractChapterSheetToTexture() for the given number of tiles.
+   */
+  static void GetThumbSheetLayout(int count, int& columns, int& rows);
+
   /*!
    * @brief Can a thumbnail image and file stream details be extracted from this file item?
   */
@@ -11,6 +11,7 @@
 #include "FileItem.h"
 #include "URL.h"
 #include "cores/MenuType.h"
+#include "filesystem/FileCacheStats.h"
 #include "filesystem/IFileTypes.h"
 #include "utils/BitstreamStats.h"
 #include "utils/Geometry.h"
@@ -186,11 +187,21 @@ public:
    */
   virtual void SetReadRate(uint32_t rate) {}
 
+  /*! \brief Indicate a byte range that is likely to be read soon,
+   *  e.g. the start of the next chapter. Should be seen as only a hint
+   */
+  virtual void Prefetch(int64_t position, int64_t size) {}
+
   /*! \brief Get the cache status
    \return true when cache status was successfully obtained
    */
   virtual bool GetCacheStatus(XFILE::SCacheStatus *status) { return false; }
 
+  /*! \brief Get the statistics of the cache of the stream
+   \return true if the stream is cached
+   */
+  virtual bool GetCacheStats(XFILE::CFileCacheStats::Stats& stats) { return false; }
+
   bool IsStreamType(DVDStreamType type) const { return m_streamType == type; }
   virtual bool IsEOF() = 0;
   virtual BitstreamStats GetBitstreamStats() const { return m_stats; }
@@ -135,6 +135,11 @@ bool CDVDInputStreamFile::GetCacheStatus(XFILE::SCacheStatus *status)
     return false;
 }
 
+bool CDVDInputStreamFile::GetCacheStats(XFILE::CFileCacheStats::Stats& stats)
+{
+  return m_pFile && m_pFile->IoControl(IOControl::CACHE_STATS, &stats) >= 0;
+}
+
 BitstreamStats CDVDInputStreamFile::GetBitstreamStats() const
 {
   if (!m_pFile)
@@ -167,3 +172,14 @@ void CDVDInputStreamFile::SetReadRate(uint32_t rate)
               "CDVDInputStreamFile::SetReadRate - set cache throttle rate to {} bytes per second",
               maxrate);
 }
+
+void CDVDInputStreamFile::Prefetch(int64_t position, int64_t size)
+{
+  if (!m_pFile)
+    return;
+
+  XFILE::SCachePrefetch hint{position, size};
+  if (m_pFile->IoControl(IOControl::CACHE_PREFETCH, &hint) >= 0)
+    CLog::Log(LOGDEBUG, "CDVDInputStreamFile::Prefetch - requested {} bytes at position {}", size,
+              position);
+}
@@ -24,7 +24,9 @@ public:
   BitstreamStats GetBitstreamStats() const override ;
   int GetBlockSize() override;
   void SetReadRate(uint32_t rate) override;
+  void Prefetch(int64_t position, int64_t size) override;
   bool GetCacheStatus(XFILE::SCacheStatus *status) override;
+  bool GetCacheStats(XFILE::CFileCacheStats::Stats& stats) override;
 
 protected:
   XFILE::CFile* m_pFile = nullptr;
@@ -24,6 +24,8 @@
 #include "utils/log.h"
 #include "windowing/Resolution.h"
 
+#include <algorithm>
+#include <array>
 #include <memory>
 
 extern "C"
@@ -31,6 +33,12 @@ extern "C"
 #include <libavcodec/defs.h>
 }
 
+namespace
+{
+// packets fetched from the add-on per call at most
+constexpr size_t DEMUX_READ_BATCH_SIZE = 32;
+} // namespace
+
 CInputStreamProvider::CInputStreamProvider(const ADDON::AddonInfoPtr& addonInfo,
                                            KODI_HANDLE parentInstance)
   : m_addonInfo(addonInfo), m_parentInstance(parentInstance)
@@ -204,6 +212,8 @@ bool CInputStreamAddon::Open()
 
 void CInputStreamAddon::Close()
 {
+  FreeDemuxPackets();
+
   if (m_ifc.inputstream->toAddon->close)
     m_ifc.inputstream->toAddon->close(m_ifc.inputstream);
   DestroyInstance();
@@ -355,12 +365,40 @@ bool CInputStreamAddon::OpenDemux()
 
 DemuxPacket* CInputStreamAddon::ReadDemux()
 {
+  if (!m_demuxPackets.empty())
+  {
+    DemuxPacket* packet = m_demuxPackets.front();
+    m_demuxPackets.pop_front();
+    return packet;
+  }
+
+  if (m_ifc.inputstream->toAddon->demux_read_multiple)
+  {
+    // fetch what the add-on has ready in one call, instead of crossing over per packet
+    std::array<DEMUX_PACKET*, DEMUX_READ_BATCH_SIZE> packets;
+    const int count = m_ifc.inputstream->toAddon->demux_read_multiple(
+        m_ifc.inputstream, packets.data(), static_cast<int>(packets.size()));
+    if (count <= 0)
+      return nullptr;
+
+    for (int i = 1; i < std::min(count, static_cast<int>(packets.size())); ++i)
+      m_demuxPackets.emplace_back(static_cast<DemuxPacket*>(packets[i]));
+    return static_cast<DemuxPacket*>(packets[0]);
+  }
+
   if (!m_ifc.inputstream->toAddon->demux_read)
     return nullptr;
 
   return reinterpret_cast<DemuxPacket*>(m_ifc.inputstream->toAddon->demux_read(m_ifc.inputstream));
 }
 
+void CInputStreamAddon::FreeDemuxPackets()
+{
+  for (DemuxPacket* packet : m_demuxPackets)
+    CDVDDemuxUtils::FreeDemuxPacket(packet);
+  m_demuxPackets.clear();
+}
+
 std::vector<CDemuxStream*> CInputStreamAddon::GetStreams() const
 {
   std::vector<CDemuxStream*> streams;
@@ -623,6 +661,8 @@ bool CInputStreamAddon::SeekTime(double time, bool backward, double* startpts)
   if (!m_ifc.inputstream->toAddon->demux_seek_time)
     return false;
 
+  FreeDemuxPackets();
+
   if ((m_caps.m_mask & INPUTSTREAM_SUPPORTS_IPOSTIME) != 0)
   {
     if (!PosTime(static_cast<int>(time)))
@@ -646,6 +686,8 @@ void CInputStreamAddon::AbortDemux()
 
 void CInputStreamAddon::FlushDemux()
 {
+  FreeDemuxPackets();
+
   if (m_ifc.inputstream->toAddon->demux_flush)
     m_ifc.inputstream->toAddon->demux_flush(m_ifc.inputstream);
 }
@@ -14,6 +14,7 @@
 #include "addons/binary-addons/AddonInstanceHandler.h"
 #include "addons/kodi-dev-kit/include/kodi/addon-instance/Inputstream.h"
 
+#include <deque>
 #include <memory>
 #include <vector>
 
@@ -111,6 +112,7 @@ protected:
 
 private:
   void DetectScreenResolution();
+  void FreeDemuxPackets();
 
   unsigned int m_currentVideoWidth{0};
   unsigned int m_currentVideoHeight{0};
@@ -128,6 +130,12 @@ private:
    */
   std::vector<std::unique_ptr<CDemuxStream>> m_streams;
 
+  /*!
+   * Packets already read from the add-on in a batch, but not yet handed
+   * to the player
+   */
+  std::deque<DemuxPacket*> m_demuxPackets;
+
   /*!
    * Callbacks from add-on to kodi
    */
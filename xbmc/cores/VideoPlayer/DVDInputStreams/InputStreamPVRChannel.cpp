@@ -8,10 +8,13 @@
 
 #include "InputStreamPVRChannel.h"
 
+#include "PVRTimeshiftBuffer.h"
 #include "ServiceBroker.h"
 #include "pvr/PVRManager.h"
 #include "pvr/addons/PVRClient.h"
 #include "pvr/channels/PVRChannelGroupsContainer.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
 #include "utils/log.h"
 
 using namespace PVR;
@@ -41,6 +44,24 @@ bool CInputStreamPVRChannel::OpenPVRStream()
   if (channel && (GetClient().OpenLiveStream(channel) == PVR_ERROR_NO_ERROR))
   {
     m_bDemuxActive = GetClient().GetClientCapabilities().HandlesDemuxing();
+
+    // timeshift locally if the client can't, the buffer only holds the raw stream
+    const int bufferSize =
+        CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_iPVRTimeshiftBufferSize;
+    bool canPause = false;
+    GetClient().CanPauseStream(canPause);
+    if (bufferSize > 0 && !m_bDemuxActive && !canPause)
+    {
+      m_timeshiftBuffer =
+          std::make_unique<CPVRTimeshiftBuffer>(GetClient(), static_cast<size_t>(bufferSize) << 20);
+      if (!m_timeshiftBuffer->Open())
+      {
+        CLog::LogF(LOGWARNING, "Unable to create timeshift buffer for channel stream {}",
+                   m_item.GetPath());
+        m_timeshiftBuffer.reset();
+      }
+    }
+
     CLog::LogF(LOGDEBUG, "Opened channel stream {}", m_item.GetPath());
     return true;
   }
@@ -49,6 +70,9 @@ bool CInputStreamPVRChannel::OpenPVRStream()
 
 void CInputStreamPVRChannel::ClosePVRStream()
 {
+  // stop reading from the client before closing the stream
+  m_timeshiftBuffer.reset();
+
   if (GetClient().CloseLiveStream() == PVR_ERROR_NO_ERROR)
   {
     m_bDemuxActive = false;
@@ -58,6 +82,9 @@ void CInputStreamPVRChannel::ClosePVRStream()
 
 int CInputStreamPVRChannel::ReadPVRStream(uint8_t* buf, int buf_size)
 {
+  if (m_timeshiftBuffer)
+    return m_timeshiftBuffer->Read(buf, buf_size);
+
   int ret = -1;
   GetClient().ReadLiveStream(buf, buf_size, ret);
   return ret;
@@ -65,6 +92,9 @@ int CInputStreamPVRChannel::ReadPVRStream(uint8_t* buf, int buf_size)
 
 int64_t CInputStreamPVRChannel::SeekPVRStream(int64_t offset, int whence)
 {
+  if (m_timeshiftBuffer)
+    return m_timeshiftBuffer->Seek(offset, whence);
+
   int64_t ret = -1;
   GetClient().SeekLiveStream(offset, whence, ret);
   return ret;
@@ -72,6 +102,9 @@ int64_t CInputStreamPVRChannel::SeekPVRStream(int64_t offset, int whence)
 
 int64_t CInputStreamPVRChannel::GetPVRStreamLength()
 {
+  if (m_timeshiftBuffer)
+    return m_timeshiftBuffer->GetLength();
+
   int64_t ret = -1;
   GetClient().GetLiveStreamLength(ret);
   return ret;
@@ -84,6 +117,9 @@ CDVDInputStream::ENextStream CInputStreamPVRChannel::NextPVRStream()
 
 bool CInputStreamPVRChannel::CanPausePVRStream()
 {
+  if (m_timeshiftBuffer)
+    return true;
+
   bool ret = false;
   GetClient().CanPauseStream(ret);
   return ret;
@@ -91,6 +127,9 @@ bool CInputStreamPVRChannel::CanPausePVRStream()
 
 bool CInputStreamPVRChannel::CanSeekPVRStream()
 {
+  if (m_timeshiftBuffer)
+    return true;
+
   bool ret = false;
   GetClient().CanSeekStream(ret);
   return ret;
@@ -105,6 +144,10 @@ bool CInputStreamPVRChannel::IsRealtimePVRStream()
 
 void CInputStreamPVRChannel::PausePVRStream(bool paused)
 {
+  // the buffer keeps reading from the client while paused
+  if (m_timeshiftBuffer)
+    return;
+
   GetClient().PauseStream(paused);
 }
 
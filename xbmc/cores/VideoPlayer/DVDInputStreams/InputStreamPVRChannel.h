@@ -10,6 +10,10 @@
 
 #include "InputStreamPVRBase.h"
 
+#include <memory>
+
+class CPVRTimeshiftBuffer;
+
 class CInputStreamPVRChannel : public CInputStreamPVRBase
 {
 public:
@@ -33,4 +37,5 @@ protected:
 
 private:
   bool m_bDemuxActive = false;
+  std::unique_ptr<CPVRTimeshiftBuffer> m_timeshiftBuffer;
 };
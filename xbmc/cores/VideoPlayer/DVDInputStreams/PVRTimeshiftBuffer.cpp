@@ -0,0 +1,132 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "PVRTimeshiftBuffer.h"
+
+#include "pvr/addons/PVRClient.h"
+#include "utils/log.h"
+
+#include <chrono>
+#include <stdio.h>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+constexpr int DEFAULT_READ_CHUNK_SIZE = 64 * 1024;
+} // unnamed namespace
+
+CPVRTimeshiftBuffer::CPVRTimeshiftBuffer(PVR::CPVRClient& client, size_t size)
+  : CThread("PVRTimeshiftBuffer"), m_client(client), m_cache(size)
+{
+}
+
+CPVRTimeshiftBuffer::~CPVRTimeshiftBuffer()
+{
+  Close();
+}
+
+bool CPVRTimeshiftBuffer::Open()
+{
+  Close();
+
+  if (m_cache.Open() != CACHE_RC_OK)
+    return false;
+
+  CThread::Create(false);
+  return true;
+}
+
+void CPVRTimeshiftBuffer::Close()
+{
+  StopThread();
+  m_cache.Close();
+}
+
+void CPVRTimeshiftBuffer::Process()
+{
+  int chunkSize = -1;
+  m_client.GetStreamReadChunkSize(chunkSize);
+  if (chunkSize <= 0)
+    chunkSize = DEFAULT_READ_CHUNK_SIZE;
+
+  std::vector<char> buffer(chunkSize);
+  while (!m_bStop)
+  {
+    int read = -1;
+    if (m_client.ReadLiveStream(reinterpret_cast<uint8_t*>(buffer.data()), chunkSize, read) !=
+            PVR_ERROR_NO_ERROR ||
+        read <= 0)
+    {
+      CLog::LogF(LOGDEBUG, "End of live stream");
+      break;
+    }
+
+    for (int written = 0; written < read && !m_bStop;)
+    {
+      const int ret = m_cache.WriteToCache(buffer.data() + written, read - written);
+      if (ret < 0)
+      {
+        CLog::LogF(LOGERROR, "Failed to write to the timeshift buffer");
+        m_bStop = true;
+        break;
+      }
+      written += ret;
+    }
+  }
+
+  m_cache.EndOfInput();
+}
+
+int CPVRTimeshiftBuffer::Read(uint8_t* buf, int buf_size)
+{
+  while (true)
+  {
+    // the live stream can't be held back, so wait for it at least as long as the client would
+    if (m_cache.WaitForData(1, 10s) <= 0)
+    {
+      if (m_cache.IsEndOfInput())
+        return 0;
+
+      CLog::LogF(LOGWARNING, "Timeout waiting for the live stream");
+      return -1;
+    }
+
+    const int ret = m_cache.ReadFromCache(reinterpret_cast<char*>(buf), buf_size);
+    if (ret != CACHE_RC_WOULD_BLOCK)
+      return ret < 0 ? -1 : ret;
+  }
+}
+
+int64_t CPVRTimeshiftBuffer::Seek(int64_t offset, int whence)
+{
+  int64_t pos;
+  switch (whence)
+  {
+    case SEEK_SET:
+      pos = offset;
+      break;
+    case SEEK_CUR:
+      pos = m_cache.GetReadPosition() + offset;
+      break;
+    case SEEK_END:
+      pos = m_cache.CachedDataEndPos() + offset;
+      break;
+    default:
+      return -1;
+  }
+
+  // only the data still held by the ring can be seeked to
+  return m_cache.Seek(pos) < 0 ? -1 : pos;
+}
+
+int64_t CPVRTimeshiftBuffer::GetLength()
+{
+  return m_cache.CachedDataEndPos();
+}
@@ -0,0 +1,55 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "filesystem/CircularFileCache.h"
+#include "threads/Thread.h"
+
+#include <stdint.h>
+
+namespace PVR
+{
+class CPVRClient;
+}
+
+/*!
+ \brief Client-side timeshift for live streams of PVR clients that can't pause them.
+
+ A thread keeps reading the live stream into a ring of bounded size in a local file, independent
+ of playback. Reads are served from the ring, so playback can be paused and seek back within the
+ data still held by it. Once the ring is full, the oldest data gets dropped.
+ */
+class CPVRTimeshiftBuffer : private CThread
+{
+public:
+  /*!
+   \param client the client to read the live stream from, which must already be opened
+   \param size the size of the ring in bytes
+   */
+  CPVRTimeshiftBuffer(PVR::CPVRClient& client, size_t size);
+  ~CPVRTimeshiftBuffer() override;
+
+  bool Open();
+  void Close();
+
+  int Read(uint8_t* buf, int buf_size);
+  int64_t Seek(int64_t offset, int whence);
+
+  /*!
+   \brief Get the position of the end of the data read from the live stream so far.
+   */
+  int64_t GetLength();
+
+protected:
+  void Process() override;
+
+private:
+  PVR::CPVRClient& m_client;
+  XFILE::CCircularFileCache m_cache;
+};
@@ -48,9 +48,8 @@ void CDVDMessageQueue::Flush(CDVDMsg::Message type)
 {
   std::unique_lock lock(m_section);
 
-  m_messages.remove_if([type](const DVDMessageListItem &item){
-    return type == CDVDMsg::NONE || item.message->IsType(type);
-  });
+  std::erase_if(m_messages, [type](const DVDMessageListItem& item)
+                { return type == CDVDMsg::NONE || item.message->IsType(type); });
 
   m_prioMessages.remove_if([type](const DVDMessageListItem &item){
     return type == CDVDMsg::NONE || item.message->IsType(type);
@@ -174,25 +173,31 @@ MsgQueueReturnCode CDVDMessageQueue::Get(std::shared_ptr<CDVDMsg>& pMsg,
 
   while (!m_bAbortRequest)
   {
-    std::list<DVDMessageListItem> &msgs = (priority > 0 || !m_prioMessages.empty()) ? m_prioMessages : m_messages;
-
-    if (!msgs.empty() && (msgs.back().priority >= priority || m_drain))
+    const bool prio = priority > 0 || !m_prioMessages.empty();
+    DVDMessageListItem* item = nullptr;
+    if (prio && !m_prioMessages.empty())
+      item = &m_prioMessages.back();
+    else if (!prio && !m_messages.empty())
+      item = &m_messages.back();
+
+    if (item && (item->priority >= priority || m_drain))
     {
-      DVDMessageListItem& item(msgs.back());
-      priority = item.priority;
+      priority = item->priority;
 
-      if (item.message->IsType(CDVDMsg::DEMUXER_PACKET) && item.priority == 0)
+      if (item->message->IsType(CDVDMsg::DEMUXER_PACKET) && item->priority == 0)
       {
-        DemuxPacket* packet =
-            std::static_pointer_cast<CDVDMsgDemuxerPacket>(item.message)->GetPacket();
+        DemuxPacket* packet = static_cast<CDVDMsgDemuxerPacket*>(item->message.get())->GetPacket();
         if (packet)
         {
           m_iDataSize -= packet->iSize;
         }
       }
 
-      pMsg = std::move(item.message);
-      msgs.pop_back();
+      pMsg = std::move(item->message);
+      if (prio)
+        m_prioMessages.pop_back();
+      else
+        m_messages.pop_back();
       UpdateTimeBack();
       ret = MSGQ_OK;
       break;
@@ -228,8 +233,7 @@ void CDVDMessageQueue::UpdateTimeFront()
     auto &item = m_messages.front();
     if (item.message->IsType(CDVDMsg::DEMUXER_PACKET))
     {
-      DemuxPacket* packet =
-          std::static_pointer_cast<CDVDMsgDemuxerPacket>(item.message)->GetPacket();
+      DemuxPacket* packet = static_cast<CDVDMsgDemuxerPacket*>(item.message.get())->GetPacket();
       if (packet)
       {
         if (packet->dts != DVD_NOPTS_VALUE)
@@ -251,8 +255,7 @@ void CDVDMessageQueue::UpdateTimeBack()
     auto &item = m_messages.back();
     if (item.message->IsType(CDVDMsg::DEMUXER_PACKET))
     {
-      DemuxPacket* packet =
-          std::static_pointer_cast<CDVDMsgDemuxerPacket>(item.message)->GetPacket();
+      DemuxPacket* packet = static_cast<CDVDMsgDemuxerPacket*>(item.message.get())->GetPacket();
       if (packet)
       {
         if (packet->dts != DVD_NOPTS_VALUE)
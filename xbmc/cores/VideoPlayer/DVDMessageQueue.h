@@ -14,6 +14,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <deque>
 #include <list>
 #include <string>
 
@@ -25,9 +26,11 @@ struct DVDMessageListItem
   }
   DVDMessageListItem() { priority = 0; }
   DVDMessageListItem(const DVDMessageListItem&) = delete;
+  DVDMessageListItem(DVDMessageListItem&&) = default;
   ~DVDMessageListItem() = default;
 
   DVDMessageListItem& operator=(const DVDMessageListItem&) = delete;
+  DVDMessageListItem& operator=(DVDMessageListItem&&) = default;
 
   std::shared_ptr<CDVDMsg> message;
   int priority;
@@ -110,7 +113,9 @@ private:
   int m_iMaxDataSize;
   std::string m_owner;
 
-  std::list<DVDMessageListItem> m_messages;
+  // regular messages are only ever added and taken at the ends, a deque recycles its storage
+  // blocks instead of allocating a node for every demux packet
+  std::deque<DVDMessageListItem> m_messages;
   std::list<DVDMessageListItem> m_prioMessages;
 };
 
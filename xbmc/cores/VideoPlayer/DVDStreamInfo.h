@@ -18,6 +18,8 @@ extern "C"
 
 #define CODEC_FORCE_SOFTWARE 0x01
 #define CODEC_ALLOW_FALLBACK 0x02
+#define CODEC_LOW_LATENCY 0x04
+#define CODEC_KEYFRAMES_ONLY 0x08
 
 class CDemuxStream;
 struct DemuxCryptoSession;
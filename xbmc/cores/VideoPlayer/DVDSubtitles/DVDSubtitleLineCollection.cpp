@@ -8,101 +8,67 @@
 
 #include "DVDSubtitleLineCollection.h"
 
-#include <stddef.h>
+#include <algorithm>
+#include <limits>
 #include <utility>
 
-CDVDSubtitleLineCollection::CDVDSubtitleLineCollection()
-{
-  m_pHead = NULL;
-  m_pCurrent = NULL;
-  m_pTail = NULL;
-
-  m_iSize = 0;
-}
-
-CDVDSubtitleLineCollection::~CDVDSubtitleLineCollection()
+void CDVDSubtitleLineCollection::Add(std::shared_ptr<CDVDOverlay> pOverlay)
 {
-  Clear();
+  m_overlays.emplace_back(std::move(pOverlay));
+  m_maxStopTimes.clear();
 }
 
-void CDVDSubtitleLineCollection::Add(std::shared_ptr<CDVDOverlay> pOverlay)
+void CDVDSubtitleLineCollection::Sort()
 {
-  ListElement* pElement = new ListElement;
-  pElement->pOverlay = std::move(pOverlay);
-  pElement->pNext = NULL;
-
-  if (!m_pHead)
-  {
-    m_pHead = m_pTail = pElement;
-    m_pCurrent = m_pHead;
-  }
-  else
-  {
-    m_pTail->pNext = pElement;
-    m_pTail = pElement;
-  }
-
-  m_iSize++;
+  std::stable_sort(m_overlays.begin(), m_overlays.end(),
+                   [](const std::shared_ptr<CDVDOverlay>& a, const std::shared_ptr<CDVDOverlay>& b)
+                   { return a->iPTSStartTime < b->iPTSStartTime; });
+  m_maxStopTimes.clear();
 }
 
-void CDVDSubtitleLineCollection::Sort()
+void CDVDSubtitleLineCollection::UpdateStopTimes()
 {
-  if (!m_pHead || !m_pHead->pNext)
-    return;
+  m_maxStopTimes.resize(m_overlays.size());
 
-  for (ListElement* p1 = m_pHead; p1->pNext != NULL; p1 = p1->pNext)
+  double maxStopTime = std::numeric_limits<double>::lowest();
+  for (size_t i = 0; i < m_overlays.size(); ++i)
   {
-    for (ListElement* p2 = p1->pNext; p2 != NULL; p2 = p2->pNext)
-    {
-      if (p1->pOverlay->iPTSStartTime > p2->pOverlay->iPTSStartTime)
-      {
-        std::swap(p1->pOverlay, p2->pOverlay);
-      }
-    }
+    maxStopTime = std::max(maxStopTime, m_overlays[i]->iPTSStopTime);
+    m_maxStopTimes[i] = maxStopTime;
   }
 }
 
 std::shared_ptr<CDVDOverlay> CDVDSubtitleLineCollection::Get(double iPts)
 {
-  std::shared_ptr<CDVDOverlay> pOverlay;
+  if (m_current >= m_overlays.size())
+    return {};
 
-  if (m_pCurrent)
-  {
-    while (m_pCurrent && m_pCurrent->pOverlay->iPTSStopTime < iPts)
-    {
-      m_pCurrent = m_pCurrent->pNext;
-    }
+  if (m_maxStopTimes.size() != m_overlays.size())
+    UpdateStopTimes();
 
-    if (m_pCurrent)
-    {
-      pOverlay = m_pCurrent->pOverlay;
+  // every overlay before the first one whose running maximum reaches iPts has stopped, and that
+  // maximum is monotonic, so it can be skipped to
+  const auto it = std::lower_bound(m_maxStopTimes.begin() + m_current, m_maxStopTimes.end(), iPts);
+  m_current = std::distance(m_maxStopTimes.begin(), it);
 
-      // advance to the next overlay
-      m_pCurrent = m_pCurrent->pNext;
-    }
-  }
-  return pOverlay;
+  // behind it, overlays nested in a longer one may have stopped as well
+  while (m_current < m_overlays.size() && m_overlays[m_current]->iPTSStopTime < iPts)
+    ++m_current;
+  if (m_current >= m_overlays.size())
+    return {};
+
+  // advance to the next overlay
+  return m_overlays[m_current++];
 }
 
 void CDVDSubtitleLineCollection::Reset()
 {
-  m_pCurrent = m_pHead;
+  m_current = 0;
 }
 
 void CDVDSubtitleLineCollection::Clear()
 {
-  ListElement* pElement = NULL;
-
-  while (m_pHead)
-  {
-    pElement = m_pHead;
-    m_pHead = pElement->pNext;
-
-    delete pElement;
-  }
-
-  m_pTail    = NULL;
-  m_pHead    = NULL;
-  m_pCurrent = NULL;
-  m_iSize    = 0;
+  m_overlays.clear();
+  m_maxStopTimes.clear();
+  m_current = 0;
 }
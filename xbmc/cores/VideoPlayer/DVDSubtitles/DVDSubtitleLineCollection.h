@@ -10,21 +10,20 @@
 
 #include "../DVDCodecs/Overlay/DVDOverlay.h"
 
-typedef struct stListElement
-{
-  std::shared_ptr<CDVDOverlay> pOverlay;
-  struct stListElement* pNext;
-
-} ListElement;
-
+#include <memory>
+#include <vector>
+
+/*!
+ * \brief Overlays of a text subtitle file, ordered by start time once sorted.
+ * Lookups binary search the running maximum of the stop times to skip the overlays that have
+ * stopped before a given pts, instead of walking over the whole file. Only overlays nested in a
+ * longer one are still checked one by one.
+ */
 class CDVDSubtitleLineCollection
 {
 public:
-  CDVDSubtitleLineCollection();
-  virtual ~CDVDSubtitleLineCollection();
-
-  //void Lock()   { EnterCriticalSection(&m_critSection); }
-  //void Unlock() { LeaveCriticalSection(&m_critSection); }
+  CDVDSubtitleLineCollection() = default;
+  virtual ~CDVDSubtitleLineCollection() = default;
 
   void Add(std::shared_ptr<CDVDOverlay> pSubtitle);
   void Sort();
@@ -33,16 +32,13 @@ public:
 
   void Reset();
 
-  void Remove();
   void Clear();
-  int GetSize() { return m_iSize; }
+  int GetSize() { return static_cast<int>(m_overlays.size()); }
 
 private:
-  ListElement* m_pHead;
-  ListElement* m_pCurrent;
-  ListElement* m_pTail;
+  void UpdateStopTimes();
 
-  int m_iSize;
-  //CRITICAL_SECTION m_critSection;
+  std::vector<std::shared_ptr<CDVDOverlay>> m_overlays;
+  std::vector<double> m_maxStopTimes; // running maximum of iPTSStopTime
+  size_t m_current{0};
 };
-
@@ -0,0 +1,259 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "PlaybackBenchmark.h"
+
+#include "filesystem/File.h"
+#include "threads/CriticalSection.h"
+#include "utils/JSONVariantWriter.h"
+#include "utils/Variant.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <mutex>
+#include <optional>
+
+using namespace std::chrono;
+
+namespace
+{
+// reports of earlier playlist items kept, the oldest are dropped beyond this
+constexpr size_t MAX_PREVIOUS_ITEMS = 100;
+
+struct Item
+{
+  std::string file;
+  steady_clock::time_point start = steady_clock::now();
+
+  uint64_t demuxBytes = 0;
+  CPlaybackBenchmark::CHistogram demuxRead;
+  CPlaybackBenchmark::CHistogram decode;
+  CPlaybackBenchmark::CHistogram render;
+  CPlaybackBenchmark::CHistogram renderInterval;
+  std::optional<steady_clock::time_point> lastRender;
+  CPlaybackBenchmark::CHistogram syncError;
+  double syncErrorTotal = 0.0;
+  uint64_t droppedDecoder = 0;
+  uint64_t droppedRenderer = 0;
+};
+
+struct State
+{
+  CCriticalSection section;
+  Item current;
+  std::deque<CVariant> previous;
+};
+
+State& GetState()
+{
+  static State state;
+  return state;
+}
+
+double ToMs(nanoseconds value)
+{
+  return duration_cast<duration<double, std::milli>>(value).count();
+}
+
+void Serialize(const Item& item, CVariant& report)
+{
+  const double seconds = duration<double>(steady_clock::now() - item.start).count();
+  report["file"] = item.file;
+  report["duration"] = seconds;
+
+  CVariant& demux = report["demux"];
+  demux["packets"] = item.demuxRead.GetCount();
+  demux["bytes"] = item.demuxBytes;
+  demux["bitrate"] = seconds > 0 ? item.demuxBytes * 8 / seconds : 0.0;
+  // how fast the demuxer could deliver if it never had to wait for the player
+  const double readSeconds = item.demuxRead.GetMean() * item.demuxRead.GetCount() / 1000;
+  demux["readrate"] = readSeconds > 0 ? item.demuxBytes / readSeconds : 0.0;
+  item.demuxRead.Serialize(demux["read"]);
+
+  // hardware decoders work asynchronously, the time spent in the calls to the decoder is not the
+  // time to decode a frame, so the rate is taken from the frames delivered over the playback
+  CVariant& decode = report["decode"];
+  decode["frames"] = item.decode.GetCount();
+  decode["fps"] = seconds > 0 ? item.decode.GetCount() / seconds : 0.0;
+  item.decode.Serialize(decode["calltime"]);
+
+  CVariant& render = report["render"];
+  render["frames"] = item.render.GetCount();
+  render["fps"] = seconds > 0 ? item.render.GetCount() / seconds : 0.0;
+  item.render.Serialize(render["rendertime"]);
+  item.renderInterval.Serialize(render["interval"]);
+
+  CVariant& sync = report["avsync"];
+  sync["bias"] =
+      item.syncError.GetCount() ? item.syncErrorTotal / item.syncError.GetCount() : 0.0;
+  item.syncError.Serialize(sync["error"]);
+
+  CVariant& dropped = report["dropped"];
+  dropped["decoder"] = item.droppedDecoder;
+  dropped["renderer"] = item.droppedRenderer;
+}
+} // namespace
+
+std::atomic<bool> CPlaybackBenchmark::s_enabled{false};
+
+void CPlaybackBenchmark::CHistogram::Add(double ms)
+{
+  const auto bucket = std::ranges::lower_bound(BUCKET_LIMITS_MS, ms);
+  m_buckets[bucket - BUCKET_LIMITS_MS.begin()]++;
+  m_count++;
+  m_total += ms;
+  m_max = std::max(m_max, ms);
+}
+
+double CPlaybackBenchmark::CHistogram::GetPercentile(double percentile) const
+{
+  const auto rank = static_cast<uint64_t>(std::ceil(m_count * percentile / 100.0));
+  uint64_t count = 0;
+  for (size_t i = 0; i < BUCKET_LIMITS_MS.size(); i++)
+  {
+    count += m_buckets[i];
+    if (count >= rank)
+      return std::min(BUCKET_LIMITS_MS[i], m_max);
+  }
+  return m_max;
+}
+
+void CPlaybackBenchmark::CHistogram::Serialize(CVariant& value) const
+{
+  value["count"] = m_count;
+  value["mean"] = GetMean();
+  value["max"] = m_max;
+  value["p50"] = GetPercentile(50);
+  value["p95"] = GetPercentile(95);
+  value["p99"] = GetPercentile(99);
+
+  // the last bucket has no limit, it holds everything above the last limit
+  value["buckets"] = CVariant(CVariant::VariantTypeArray);
+  for (size_t i = 0; i < m_buckets.size(); i++)
+  {
+    CVariant bucket(CVariant::VariantTypeObject);
+    if (i < BUCKET_LIMITS_MS.size())
+      bucket["limit"] = BUCKET_LIMITS_MS[i];
+    bucket["count"] = m_buckets[i];
+    value["buckets"].push_back(std::move(bucket));
+  }
+}
+
+void CPlaybackBenchmark::SetEnabled(bool enabled)
+{
+  s_enabled = enabled;
+}
+
+void CPlaybackBenchmark::Reset(const std::string& file)
+{
+  State& state = GetState();
+  std::unique_lock lock(state.section);
+  if (!state.current.file.empty())
+  {
+    if (state.previous.size() >= MAX_PREVIOUS_ITEMS)
+      state.previous.pop_front();
+    Serialize(state.current, state.previous.emplace_back(CVariant::VariantTypeObject));
+  }
+
+  state.current = {};
+  state.current.file = file;
+}
+
+void CPlaybackBenchmark::AddDemuxRead(int bytes, nanoseconds duration)
+{
+  if (!IsEnabled())
+    return;
+
+  State& state = GetState();
+  std::unique_lock lock(state.section);
+  state.current.demuxBytes += std::max(bytes, 0);
+  state.current.demuxRead.Add(ToMs(duration));
+}
+
+void CPlaybackBenchmark::AddDecodedFrame(nanoseconds duration)
+{
+  if (!IsEnabled())
+    return;
+
+  State& state = GetState();
+  std::unique_lock lock(state.section);
+  state.current.decode.Add(ToMs(duration));
+}
+
+void CPlaybackBenchmark::AddRenderedFrame(nanoseconds duration)
+{
+  if (!IsEnabled())
+    return;
+
+  const auto now = steady_clock::now();
+
+  State& state = GetState();
+  std::unique_lock lock(state.section);
+  state.current.render.Add(ToMs(duration));
+  if (state.current.lastRender)
+    state.current.renderInterval.Add(ToMs(now - *state.current.lastRender));
+  state.current.lastRender = now;
+}
+
+void CPlaybackBenchmark::AddSyncError(double ms)
+{
+  if (!IsEnabled())
+    return;
+
+  State& state = GetState();
+  std::unique_lock lock(state.section);
+  state.current.syncError.Add(std::abs(ms));
+  state.current.syncErrorTotal += ms;
+}
+
+void CPlaybackBenchmark::AddDroppedFrame(DropSource source)
+{
+  if (!IsEnabled())
+    return;
+
+  State& state = GetState();
+  std::unique_lock lock(state.section);
+  if (source == DropSource::DECODER)
+    state.current.droppedDecoder++;
+  else
+    state.current.droppedRenderer++;
+}
+
+void CPlaybackBenchmark::GetReport(CVariant& report)
+{
+  State& state = GetState();
+  std::unique_lock lock(state.section);
+
+  Serialize(state.current, report);
+  report["previous"] = CVariant(CVariant::VariantTypeArray);
+  for (const CVariant& item : state.previous)
+    report["previous"].push_back(item);
+}
+
+bool CPlaybackBenchmark::WriteReport(const std::string& path)
+{
+  CVariant report;
+  GetReport(report);
+
+  std::string json;
+  if (!CJSONVariantWriter::Write(report, json, false))
+    return false;
+
+  XFILE::CFile file;
+  if (!file.OpenForWrite(path, true) ||
+      file.Write(json.c_str(), json.size()) != static_cast<ssize_t>(json.size()))
+  {
+    CLog::Log(LOGERROR, "CPlaybackBenchmark::{} - failed to write {}", __FUNCTION__, path);
+    return false;
+  }
+
+  CLog::Log(LOGINFO, "CPlaybackBenchmark::{} - report written to {}", __FUNCTION__, path);
+  return true;
+}
@@ -0,0 +1,99 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+class CVariant;
+
+/*!
+ * \brief Throughput and timing of the playback pipeline, for comparing decoders and renderers
+ * across changes and hardware.
+ *
+ * Recording is off unless Kodi is started with --benchmark=<file>, which plays the given file
+ * like --test and writes the report of the playback to <file> when it ends. While recording is
+ * off every instrumentation point costs a single relaxed atomic load.
+ *
+ * The report holds the demuxer read rate, the rate of decoded frames and the time spent in calls
+ * to the video decoder, the time to render a frame and the interval between rendered frames, the
+ * A/V sync error and the frames dropped by the decoder and the renderer. Each playlist item gets
+ * its own report, the ones of the items played before the current one are kept under "previous".
+ */
+class CPlaybackBenchmark
+{
+public:
+  //! Histogram of durations with power of two buckets from 0.25 ms up
+  class CHistogram
+  {
+  public:
+    static constexpr std::array<double, 12> BUCKET_LIMITS_MS = {
+        0.25, 0.5, 1.0, 2.0, 4.0, 8.0, 16.0, 32.0, 64.0, 128.0, 256.0, 512.0};
+
+    void Add(double ms);
+    uint64_t GetCount() const { return m_count; }
+    double GetMean() const { return m_count ? m_total / m_count : 0.0; }
+    double GetMax() const { return m_max; }
+    //! approximate percentile, the upper limit of the bucket it falls in
+    double GetPercentile(double percentile) const;
+    void Serialize(CVariant& value) const;
+
+  private:
+    std::array<uint64_t, BUCKET_LIMITS_MS.size() + 1> m_buckets{};
+    uint64_t m_count = 0;
+    double m_total = 0.0;
+    double m_max = 0.0;
+  };
+
+  //! Measures a duration, without reading the clock while recording is off
+  class CTimer
+  {
+  public:
+    CTimer()
+    {
+      if (IsEnabled())
+        m_start = std::chrono::steady_clock::now();
+    }
+    std::chrono::nanoseconds Elapsed() const
+    {
+      return m_start ? std::chrono::steady_clock::now() - *m_start : std::chrono::nanoseconds{};
+    }
+
+  private:
+    std::optional<std::chrono::steady_clock::time_point> m_start;
+  };
+
+  enum class DropSource
+  {
+    DECODER,
+    RENDERER
+  };
+
+  static void SetEnabled(bool enabled);
+  static bool IsEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+
+  //! Finish the report of the previous item and start a new one for the playback of file
+  static void Reset(const std::string& file);
+
+  static void AddDemuxRead(int bytes, std::chrono::nanoseconds duration);
+  static void AddDecodedFrame(std::chrono::nanoseconds duration);
+  static void AddRenderedFrame(std::chrono::nanoseconds duration);
+  static void AddSyncError(double ms);
+  static void AddDroppedFrame(DropSource source);
+
+  static void GetReport(CVariant& report);
+  static bool WriteReport(const std::string& path);
+
+private:
+  static std::atomic<bool> s_enabled;
+};
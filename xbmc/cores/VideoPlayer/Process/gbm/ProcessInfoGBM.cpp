@@ -10,6 +10,8 @@
 
 #include "cores/VideoPlayer/Buffers/VideoBufferPoolDMA.h"
 
+#include <mutex>
+
 using namespace VIDEOPLAYER;
 
 CProcessInfo* CProcessInfoGBM::Create()
@@ -27,10 +29,33 @@ CProcessInfoGBM::CProcessInfoGBM()
   m_videoBufferManager.RegisterPool(std::make_shared<CVideoBufferPoolDMA>());
 }
 
+void CProcessInfoGBM::SetSwDeinterlacingMethods()
+{
+  // first populate with the defaults from base implementation
+  CProcessInfo::SetSwDeinterlacingMethods();
+
+  std::list<EINTERLACEMETHOD> methods;
+  {
+    // get the current methods
+    std::unique_lock lock(m_videoCodecSection);
+    methods = m_deintMethods;
+  }
+  // add bob and blend deinterlacer
+  methods.push_back(EINTERLACEMETHOD::VS_INTERLACEMETHOD_RENDER_BOB);
+  methods.push_back(EINTERLACEMETHOD::VS_INTERLACEMETHOD_RENDER_BLEND);
+
+  // update with the new methods list
+  UpdateDeinterlacingMethods(methods);
+
+  // the renderer has to pick the same method the decoder falls back to
+  SetDeinterlacingMethodDefault(GetFallbackDeintMethod());
+}
+
 EINTERLACEMETHOD CProcessInfoGBM::GetFallbackDeintMethod()
 {
-#if defined(__arm__)
-  return EINTERLACEMETHOD::VS_INTERLACEMETHOD_DEINTERLACE_HALF;
+#if defined(__arm__) || defined(__aarch64__)
+  // bwdif on the cpu can't keep up with 1080i on most SoCs, the gpu bobs it for free
+  return EINTERLACEMETHOD::VS_INTERLACEMETHOD_RENDER_BOB;
 #else
   return CProcessInfo::GetFallbackDeintMethod();
 #endif
@@ -21,6 +21,7 @@ public:
   static void Register();
 
   CProcessInfoGBM();
+  void SetSwDeinterlacingMethods() override;
   EINTERLACEMETHOD GetFallbackDeintMethod() override;
 };
 
@@ -15,9 +15,11 @@
 #include "DVDDemuxers/DVDDemuxUtils.h"
 #include "DVDDemuxers/DVDDemuxVobsub.h"
 #include "DVDDemuxers/DVDFactoryDemuxer.h"
+#include "DVDDemuxers/DemuxPacketPool.h"
 #include "DVDInputStreams/DVDFactoryInputStream.h"
 #include "DVDInputStreams/DVDInputStream.h"
 #include "network/NetworkFileItemClassify.h"
+#include "network/PlaybackSync.h"
 #if defined(HAVE_LIBBLURAY)
 #include "DVDInputStreams/DVDInputStreamBluray.h"
 #endif
@@ -26,6 +28,7 @@
 #include "DVDMessage.h"
 #include "FileItem.h"
 #include "LangInfo.h"
+#include "PlaybackBenchmark.h"
 #include "ServiceBroker.h"
 #include "URL.h"
 #include "Util.h"
@@ -56,6 +59,7 @@
 #include "utils/StreamDetails.h"
 #include "utils/StreamUtils.h"
 #include "utils/StringUtils.h"
+#include "utils/Trace.h"
 #include "utils/URIUtils.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
@@ -64,7 +68,10 @@
 #include "windowing/GraphicContext.h"
 #include "windowing/WinSystem.h"
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <future>
 #include <iterator>
 #include <limits>
 #include <memory>
@@ -74,6 +81,12 @@
 using namespace KODI;
 using namespace std::chrono_literals;
 
+namespace
+{
+// the next item is asked for when this much time of the current one is left
+constexpr double PRELOAD_LEAD_TIME_MS = 30000.0;
+} // namespace
+
 //------------------------------------------------------------------------------
 // selection streams
 //------------------------------------------------------------------------------
@@ -803,6 +816,9 @@ bool CVideoPlayer::OpenFile(const CFileItem& file, const CPlayerOptions &options
   m_item = file;
   m_playerOptions = options;
 
+  if (CPlaybackBenchmark::IsEnabled())
+    CPlaybackBenchmark::Reset(CURL::GetRedacted(file.GetPath()));
+
   m_processInfo->SetPlayTimes(0,0,0,0);
   m_bAbortRequest = false;
   m_error = false;
@@ -817,6 +833,36 @@ bool CVideoPlayer::OpenFile(const CFileItem& file, const CPlayerOptions &options
   return true;
 }
 
+bool CVideoPlayer::PreloadNextFile(const CFileItem& file)
+{
+  CFileItem item(file);
+  item.SetMimeTypeForInternetFile();
+
+  CLog::Log(LOGINFO, "VideoPlayer::PreloadNextFile: {}", CURL::GetRedacted(item.GetPath()));
+
+  std::unique_lock lock(m_preloadSection);
+  m_preloadPath = item.GetDynPath();
+  m_preload = std::async(std::launch::async,
+                         [this, item]()
+                         {
+                           PreloadedFile preload;
+                           std::shared_ptr<CDVDInputStream> inputStream =
+                               CDVDFactoryInputStream::CreateInputStream(this, item, true);
+
+                           // other streams may depend on the state of the player, so only plain
+                           // files are opened ahead
+                           if (!inputStream || !inputStream->IsStreamType(DVDSTREAM_TYPE_FILE) ||
+                               !inputStream->Open())
+                             return preload;
+
+                           preload.demuxer.reset(CDVDFactoryDemuxer::CreateDemuxer(inputStream));
+                           preload.inputStream = std::move(inputStream);
+                           return preload;
+                         });
+
+  return true;
+}
+
 bool CVideoPlayer::CloseFile(bool reopen)
 {
   CLog::Log(LOGINFO, "CVideoPlayer::CloseFile()");
@@ -847,6 +893,12 @@ bool CVideoPlayer::CloseFile(bool reopen)
     StopThread();
   }
 
+  // drop a preloaded file that didn't get played
+  {
+    std::unique_lock lock(m_preloadSection);
+    m_preload = {};
+  }
+
   m_Edl.Clear();
   CServiceBroker::GetDataCacheCore().Reset();
   m_processInfo->SetDataCache(&CServiceBroker::GetDataCacheCore());
@@ -880,57 +932,57 @@ bool CVideoPlayer::OpenInputStream()
   if (m_pInputStream.use_count() > 1)
     throw std::runtime_error("m_pInputStream reference count is greater than 1");
   m_pInputStream.reset();
+  m_preloadedDemuxer.reset();
 
-  CLog::Log(LOGINFO, "Creating InputStream");
-
-  m_pInputStream = CDVDFactoryInputStream::CreateInputStream(this, m_item, true);
-  if (m_pInputStream == nullptr)
   {
-    CLog::Log(LOGERROR, "CVideoPlayer::OpenInputStream - unable to create input stream for [{}]",
-              CURL::GetRedacted(m_item.GetPath()));
-    return false;
+    std::unique_lock lock(m_preloadSection);
+    if (m_preload.valid())
+    {
+      PreloadedFile preload = m_preload.get();
+      if (m_preloadPath == m_item.GetDynPath() && preload.inputStream)
+      {
+        CLog::Log(LOGINFO, "Using preloaded InputStream");
+        m_pInputStream = std::move(preload.inputStream);
+        m_preloadedDemuxer = std::move(preload.demuxer);
+      }
+    }
   }
+  const bool preloaded = m_pInputStream != nullptr;
 
-  if (!m_pInputStream->Open())
+  if (!preloaded)
   {
-    CLog::Log(LOGERROR, "CVideoPlayer::OpenInputStream - error opening [{}]",
+    CLog::Log(LOGINFO, "Creating InputStream");
+    m_pInputStream = CDVDFactoryInputStream::CreateInputStream(this, m_item, true);
+  }
+  if (m_pInputStream == nullptr)
+  {
+    CLog::Log(LOGERROR, "CVideoPlayer::OpenInputStream - unable to create input stream for [{}]",
               CURL::GetRedacted(m_item.GetPath()));
     return false;
   }
 
-  // find any available external subtitles for non dvd files
+  // find any available external subtitles for non dvd files. Listing the directories of the file
+  // takes a while on network shares, so it runs while the input stream and the demuxer are opened.
   if (!m_pInputStream->IsStreamType(DVDSTREAM_TYPE_DVD) &&
       !m_pInputStream->IsStreamType(DVDSTREAM_TYPE_PVRMANAGER))
   {
-    // find any available external subtitles
-    std::vector<std::string> filenames;
-
-    if (!URIUtils::IsUPnP(m_item.GetPath()) &&
-        !m_item.GetProperty("no-ext-subs-scan").asBoolean(false))
-      CUtil::ScanForExternalSubtitles(m_item.GetDynPath(), filenames);
-
-    // load any subtitles from file item
-    std::string key("subtitle:1");
-    for (unsigned s = 1; m_item.HasProperty(key); key = StringUtils::Format("subtitle:{}", ++s))
-      filenames.push_back(m_item.GetProperty(key).asString());
+    const bool scan = !URIUtils::IsUPnP(m_item.GetPath()) &&
+                      !m_item.GetProperty("no-ext-subs-scan").asBoolean(false);
+    m_externalSubtitles = std::async(scan ? std::launch::async : std::launch::deferred,
+                                     [scan, path = m_item.GetDynPath()]()
+                                     {
+                                       std::vector<std::string> filenames;
+                                       if (scan)
+                                         CUtil::ScanForExternalSubtitles(path, filenames);
+                                       return filenames;
+                                     });
+  }
 
-    for (unsigned int i=0;i<filenames.size();i++)
-    {
-      // if vobsub subtitle:
-      if (URIUtils::HasExtension(filenames[i], ".idx"))
-      {
-        std::string strSubFile;
-        if (CUtil::FindVobSubPair( filenames, filenames[i], strSubFile))
-          AddSubtitleFile(filenames[i], strSubFile);
-      }
-      else
-      {
-        if (!CUtil::IsVobSub(filenames, filenames[i] ))
-        {
-          AddSubtitleFile(filenames[i]);
-        }
-      }
-    } // end loop over all subtitle files
+  if (!preloaded && !m_pInputStream->Open())
+  {
+    CLog::Log(LOGERROR, "CVideoPlayer::OpenInputStream - error opening [{}]",
+              CURL::GetRedacted(m_item.GetPath()));
+    return false;
   }
 
   m_clock.Reset();
@@ -945,8 +997,10 @@ bool CVideoPlayer::OpenDemuxStream()
 
   CLog::Log(LOGINFO, "Creating Demuxer");
 
+  m_pDemuxer = std::move(m_preloadedDemuxer);
+
   int attempts = 10;
-  while (!m_bStop && attempts-- > 0)
+  while (!m_pDemuxer && !m_bStop && attempts-- > 0)
   {
     m_pDemuxer.reset(CDVDFactoryDemuxer::CreateDemuxer(m_pInputStream));
     if(!m_pDemuxer && m_pInputStream->IsStreamType(DVDSTREAM_TYPE_PVRMANAGER))
@@ -967,6 +1021,9 @@ bool CVideoPlayer::OpenDemuxStream()
     return false;
   }
 
+  // external subtitles go first, as they did before the scan ran in the background
+  AddExternalSubtitles();
+
   m_SelectionStreams.Clear(StreamType::NONE, STREAM_SOURCE_DEMUX);
   m_SelectionStreams.Clear(StreamType::NONE, STREAM_SOURCE_NAV);
   m_SelectionStreams.Update(m_pInputStream, m_pDemuxer.get());
@@ -985,6 +1042,37 @@ bool CVideoPlayer::OpenDemuxStream()
   return true;
 }
 
+void CVideoPlayer::AddExternalSubtitles()
+{
+  if (!m_externalSubtitles.valid())
+    return;
+
+  std::vector<std::string> filenames = m_externalSubtitles.get();
+
+  // load any subtitles from file item
+  std::string key("subtitle:1");
+  for (unsigned s = 1; m_item.HasProperty(key); key = StringUtils::Format("subtitle:{}", ++s))
+    filenames.push_back(m_item.GetProperty(key).asString());
+
+  for (unsigned int i=0;i<filenames.size();i++)
+  {
+    // if vobsub subtitle:
+    if (URIUtils::HasExtension(filenames[i], ".idx"))
+    {
+      std::string strSubFile;
+      if (CUtil::FindVobSubPair( filenames, filenames[i], strSubFile))
+        AddSubtitleFile(filenames[i], strSubFile);
+    }
+    else
+    {
+      if (!CUtil::IsVobSub(filenames, filenames[i] ))
+      {
+        AddSubtitleFile(filenames[i]);
+      }
+    }
+  } // end loop over all subtitle files
+}
+
 void CVideoPlayer::CloseDemuxer()
 {
   m_pDemuxer.reset();
@@ -1142,6 +1230,7 @@ void CVideoPlayer::OpenDefaultStreams(bool reset)
 
 bool CVideoPlayer::ReadPacket(DemuxPacket*& packet, CDemuxStream*& stream)
 {
+  CTraceZone zone("CVideoPlayer::ReadPacket");
 
   // check if we should read from subtitle demuxer
   if (m_pSubtitleDemuxer && m_VideoPlayerSubtitle->AcceptsData())
@@ -1173,7 +1262,12 @@ bool CVideoPlayer::ReadPacket(DemuxPacket*& packet, CDemuxStream*& stream)
 
   // read a data frame from stream.
   if (m_pDemuxer)
+  {
+    const CPlaybackBenchmark::CTimer readTimer;
     packet = m_pDemuxer->Read();
+    if (packet && CPlaybackBenchmark::IsEnabled())
+      CPlaybackBenchmark::AddDemuxRead(packet->iSize, readTimer.Elapsed());
+  }
 
   if (packet)
   {
@@ -1348,6 +1442,7 @@ void CVideoPlayer::Prepare()
   m_offset_pts = 0;
   m_CurrentAudio.lastdts = DVD_NOPTS_VALUE;
   m_CurrentVideo.lastdts = DVD_NOPTS_VALUE;
+  m_preloadRequested = false;
 
   IPlayerCallback *cb = &m_callback;
   CFileItem fileItem = m_item;
@@ -1492,6 +1587,10 @@ void CVideoPlayer::Process()
 
   CServiceBroker::GetWinSystem()->RegisterRenderLoop(this);
 
+  const auto playbackSync = CServiceBroker::GetPlaybackSync();
+  m_clock.SetFollower(playbackSync &&
+                      playbackSync->GetRole() == CPlaybackSync::Role::FOLLOWER);
+
   Prepare();
 
   while (!m_bAbortRequest)
@@ -1549,6 +1648,9 @@ void CVideoPlayer::Process()
     // handle eventual seeks due to playspeed
     HandlePlaySpeed();
 
+    // publish or follow the playing time of a synchronised playback group
+    HandlePlaybackSync();
+
     // update player state
     UpdatePlayState(200);
 
@@ -1698,33 +1800,29 @@ void CVideoPlayer::Process()
     CheckBetterStream(m_CurrentRadioRDS, pStream);
     CheckBetterStream(m_CurrentAudioID3, pStream);
 
-    // demux video stream
-    if (CServiceBroker::GetSettingsComponent()->GetSettings()->GetBool(CSettings::SETTING_SUBTITLES_PARSECAPTIONS) && CheckIsCurrent(m_CurrentVideo, pStream, pPacket))
+    // the captions parsed from the video packets so far, they are queued in ProcessVideoData()
+    // and picked up with whichever packet comes next rather than with the next video packet
+    if (m_pCCDemuxer)
     {
-      if (m_pCCDemuxer)
+      while (!m_bAbortRequest)
       {
-        bool first = true;
-        while (!m_bAbortRequest)
-        {
-          DemuxPacket *pkt = m_pCCDemuxer->Read(first ? pPacket : NULL);
-          if (!pkt)
-            break;
+        DemuxPacket* pkt = m_pCCDemuxer->Read();
+        if (!pkt)
+          break;
 
-          first = false;
-          if (m_pCCDemuxer->GetNrOfStreams() !=
-              m_SelectionStreams.CountTypeOfSource(StreamType::SUBTITLE, STREAM_SOURCE_VIDEOMUX))
-          {
-            m_SelectionStreams.Clear(StreamType::SUBTITLE, STREAM_SOURCE_VIDEOMUX);
-            m_SelectionStreams.Update(NULL, m_pCCDemuxer.get(), "");
-            UpdateContent();
-            OpenDefaultStreams(false);
-          }
-          CDemuxStream *pSubStream = m_pCCDemuxer->GetStream(pkt->iStreamId);
-          if (pSubStream && m_CurrentSubtitle.id == pkt->iStreamId && m_CurrentSubtitle.source == STREAM_SOURCE_VIDEOMUX)
-            ProcessSubData(pSubStream, pkt);
-          else
-            CDVDDemuxUtils::FreeDemuxPacket(pkt);
+        if (m_pCCDemuxer->GetNrOfStreams() !=
+            m_SelectionStreams.CountTypeOfSource(StreamType::SUBTITLE, STREAM_SOURCE_VIDEOMUX))
+        {
+          m_SelectionStreams.Clear(StreamType::SUBTITLE, STREAM_SOURCE_VIDEOMUX);
+          m_SelectionStreams.Update(NULL, m_pCCDemuxer.get(), "");
+          UpdateContent();
+          OpenDefaultStreams(false);
         }
+        CDemuxStream *pSubStream = m_pCCDemuxer->GetStream(pkt->iStreamId);
+        if (pSubStream && m_CurrentSubtitle.id == pkt->iStreamId && m_CurrentSubtitle.source == STREAM_SOURCE_VIDEOMUX)
+          ProcessSubData(pSubStream, pkt);
+        else
+          CDVDDemuxUtils::FreeDemuxPacket(pkt);
       }
     }
 
@@ -1862,7 +1960,13 @@ void CVideoPlayer::ProcessVideoData(CDemuxStream* pStream, DemuxPacket* pPacket)
   if (CheckSceneSkip(m_CurrentVideo))
     drop = true;
 
-  m_VideoPlayerVideo->SendMessage(std::make_shared<CDVDMsgDemuxerPacket>(pPacket, drop));
+  const double pts = pPacket->pts;
+  auto msg = std::make_shared<CDVDMsgDemuxerPacket>(pPacket, drop);
+  // the caption parser shares the packet with the decoder instead of copying it
+  if (m_pCCDemuxer && CServiceBroker::GetSettingsComponent()->GetSettings()->GetBool(
+                          CSettings::SETTING_SUBTITLES_PARSECAPTIONS))
+    m_pCCDemuxer->AddPacket(msg, pts);
+  m_VideoPlayerVideo->SendMessage(std::move(msg));
 
   if (!drop)
     m_CurrentVideo.packets++;
@@ -2022,11 +2126,24 @@ void CVideoPlayer::HandlePlaySpeed()
         SetCaching(CACHESTATE_INIT);
     }
 
-    // if audio stream stalled, wait until demux queue filled 10%
-    if (m_pInputStream->IsRealtime() &&
-        (m_CurrentAudio.id < 0 || m_VideoPlayerAudio->GetLevel() > 10))
+    if (m_pInputStream->IsRealtime())
     {
-      SetCaching(CACHESTATE_INIT);
+      const std::shared_ptr<CAdvancedSettings> advancedSettings =
+          CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+      if (advancedSettings->m_videoLiveLowLatency)
+      {
+        // in low latency mode, only buffer up to the target distance to the live edge
+        const double latency = GetLiveLatency();
+        if (m_CurrentAudio.id < 0 ||
+            (latency != DVD_NOPTS_VALUE &&
+             latency >= DVD_MSEC_TO_TIME(advancedSettings->m_videoLiveTargetLatency)))
+          SetCaching(CACHESTATE_INIT);
+      }
+      // if audio stream stalled, wait until demux queue filled 10%
+      else if (m_CurrentAudio.id < 0 || m_VideoPlayerAudio->GetLevel() > 10)
+      {
+        SetCaching(CACHESTATE_INIT);
+      }
     }
   }
 
@@ -2117,6 +2234,33 @@ void CVideoPlayer::HandlePlaySpeed()
           if (m_clock.GetSpeedAdjust() < 0 && m_VideoPlayerAudio->GetLevel() > 10)
             adjust = 0.0;
 
+          const std::shared_ptr<CAdvancedSettings> advancedSettings =
+              CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+          if (adjust == -1.0 && advancedSettings->m_videoLiveLowLatency && !m_clock.IsFollower())
+          {
+            // play faster while too far behind the live edge. The audio engine keeps the pitch
+            // with its tempo filter once the speed differs more than its atempo threshold. A
+            // queue filled to half is the input being behind on purpose, e.g. timeshift.
+            const double latency = GetLiveLatency();
+            const double target = DVD_MSEC_TO_TIME(advancedSettings->m_videoLiveTargetLatency);
+            if (latency != DVD_NOPTS_VALUE)
+            {
+              if (m_clock.GetSpeedAdjust() == 0 && latency > target + DVD_MSEC_TO_TIME(500) &&
+                  m_VideoPlayerAudio->GetLevel() < 50)
+              {
+                CLog::Log(LOGDEBUG,
+                          "CVideoPlayer::HandlePlaySpeed - {:.3f}s behind live, catching up",
+                          latency / DVD_TIME_BASE);
+                adjust = advancedSettings->m_videoLiveCatchUpSpeed - 1.0;
+              }
+              else if (m_clock.GetSpeedAdjust() > 0 &&
+                       (latency <= target || m_VideoPlayerAudio->GetLevel() >= 50))
+              {
+                adjust = 0.0;
+              }
+            }
+          }
+
           if (adjust != -1.0)
           {
             m_clock.SetSpeedAdjust(adjust);
@@ -2177,7 +2321,12 @@ void CVideoPlayer::HandlePlaySpeed()
       else if (m_CurrentAudio.starttime != DVD_NOPTS_VALUE && m_CurrentAudio.packets > 0)
       {
         if (m_pInputStream->IsRealtime())
-          clock = m_CurrentAudio.starttime - m_CurrentAudio.cachetotal - DVD_MSEC_TO_TIME(400);
+        {
+          clock = m_CurrentAudio.starttime - m_CurrentAudio.cachetotal;
+          // headroom against jitter of the source, low latency mode relies on its buffer target
+          if (!CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_videoLiveLowLatency)
+            clock -= DVD_MSEC_TO_TIME(400);
+        }
         else
           clock = m_CurrentAudio.starttime - m_CurrentAudio.cachetime;
 
@@ -2337,6 +2486,71 @@ void CVideoPlayer::HandlePlaySpeed()
   }
 }
 
+void CVideoPlayer::HandlePlaybackSync()
+{
+  const auto playbackSync = CServiceBroker::GetPlaybackSync();
+  if (!playbackSync)
+    return;
+
+  const CPlaybackSync::Role role = playbackSync->GetRole();
+  if (role == CPlaybackSync::Role::NONE)
+    return;
+
+  const std::string item = URIUtils::GetFileName(m_item.GetDynPath());
+  const double time = m_clock.GetClock() + m_State.time_offset;
+  const bool playing = m_caching == CACHESTATE_DONE && !IsInMenuInternal();
+
+  if (role == CPlaybackSync::Role::MASTER)
+  {
+    playbackSync->Publish(item, time, playing ? m_playSpeed : DVD_PLAYSPEED_PAUSE);
+    return;
+  }
+
+  // only playback started after joining the group follows, see Process()
+  if (!m_clock.IsFollower() || !playing || m_playSpeed != DVD_PLAYSPEED_NORMAL ||
+      m_pInputStream->IsRealtime())
+    return;
+
+  if ((m_CurrentAudio.id >= 0 && m_CurrentAudio.syncState != IDVDStreamPlayer::SYNC_INSYNC) ||
+      (m_CurrentVideo.id >= 0 && m_CurrentVideo.syncState != IDVDStreamPlayer::SYNC_INSYNC))
+    return;
+
+  double reference;
+  if (!playbackSync->GetReference(item, reference))
+    return;
+
+  const double error = time - reference;
+  playbackSync->SetError(error);
+
+  // a seek takes a while until playback resumes, so it targets the time the master will have
+  // reached by then, learned from how far behind the previous seek ended up
+  if (m_playbackSyncSeeking)
+  {
+    m_playbackSyncSeekLead =
+        std::clamp(m_playbackSyncSeekLead - error, 0.0, DVD_MSEC_TO_TIME(10000));
+    m_playbackSyncSeeking = false;
+  }
+
+  if (std::abs(error) > DVD_MSEC_TO_TIME(1000))
+  {
+    if (!m_playbackSyncSeekTimer.IsTimePast())
+      return;
+
+    CLog::Log(LOGDEBUG, "CVideoPlayer::HandlePlaybackSync - error:{:f}, seeking", error);
+    CDVDMsgPlayerSeek::CMode mode;
+    mode.time = DVD_TIME_TO_MSEC(reference + m_playbackSyncSeekLead);
+    mode.backward = error > 0;
+    mode.accurate = true;
+    mode.sync = true;
+    m_messenger.Put(std::make_shared<CDVDMsgPlayerSeek>(mode));
+    m_playbackSyncSeekTimer.Set(5000ms);
+    m_playbackSyncSeeking = true;
+    return;
+  }
+
+  m_clock.FollowReference(reference - m_State.time_offset);
+}
+
 bool CVideoPlayer::CheckPlayerInit(CCurrentStream& current)
 {
   if (current.inited)
@@ -3489,6 +3703,21 @@ void CVideoPlayer::GetGeneralInfo(std::string& strGeneralInfo)
                                     m_State.cache_offset * 100.0);
     }
 
+    if (m_State.live_latency != DVD_NOPTS_VALUE)
+      strBuf += StringUtils::Format(", live: {:.3f}s", m_State.live_latency / DVD_TIME_BASE);
+
+    if (m_State.cache_stalls >= 0)
+      strBuf += StringUtils::Format(", stalls: {} / hits: {:.1f}%", m_State.cache_stalls,
+                                    m_State.cache_hit_ratio * 100.0);
+
+    const CDemuxPacketPool::Stats pool = CDemuxPacketPool::GetInstance().GetStats();
+    if (pool.allocations > 0)
+    {
+      strBuf += StringUtils::Format(", pkt pool: {:.1f}% recycled / {}",
+                                    100.0 * pool.recycled / pool.allocations,
+                                    StringUtils::SizeToString(pool.pooledBytes));
+    }
+
     strGeneralInfo = StringUtils::Format("Player: a/v:{: 6.3f}, {}", dDiff, strBuf);
   }
 }
@@ -3868,14 +4097,24 @@ bool CVideoPlayer::OpenStream(CCurrentStream& current, int64_t demuxerId, int iS
   return res;
 }
 
+bool CVideoPlayer::CanKeepCodec(CCurrentStream& current, CDVDStreamInfo& hint) const
+{
+  // Zapping between live tv channels opens a new demuxer, whose streams differ from the previous
+  // ones only by their ids if the channels are broadcast in the same format. Carry on decoding
+  // them with the open codecs, the buffers have been flushed just like on a seek.
+  return m_pInputStream && m_pInputStream->IsStreamType(DVDSTREAM_TYPE_PVRMANAGER) &&
+         m_item.HasPVRChannelInfoTag() && current.hint.demuxerId != hint.demuxerId &&
+         current.hint.Equal(hint, CDVDStreamInfo::COMPARE_EXTRADATA);
+}
+
 bool CVideoPlayer::OpenAudioStream(CDVDStreamInfo& hint, bool reset)
 {
   IDVDStreamPlayer* player = GetStreamPlayer(m_CurrentAudio.player);
   if(player == nullptr)
     return false;
 
-  if(m_CurrentAudio.id < 0 ||
-     m_CurrentAudio.hint != hint)
+  if (m_CurrentAudio.id < 0 ||
+      (m_CurrentAudio.hint != hint && !CanKeepCodec(m_CurrentAudio, hint)))
   {
     if (!player->OpenStream(hint))
       return false;
@@ -3929,6 +4168,10 @@ bool CVideoPlayer::OpenVideoStream(CDVDStreamInfo& hint, bool reset)
     }
   }
 
+  // live streams are watched at the edge, decoding latency delays them even more
+  if (m_pInputStream && m_pInputStream->IsRealtime())
+    hint.codecOptions |= CODEC_LOW_LATENCY;
+
   std::shared_ptr<CDVDInputStream::IMenus> pMenus = std::dynamic_pointer_cast<CDVDInputStream::IMenus>(m_pInputStream);
   if(pMenus && pMenus->IsInMenu())
     hint.stills = true;
@@ -3967,8 +4210,8 @@ bool CVideoPlayer::OpenVideoStream(CDVDStreamInfo& hint, bool reset)
   if(player == nullptr)
     return false;
 
-  if(m_CurrentVideo.id < 0 ||
-     m_CurrentVideo.hint != hint)
+  if (m_CurrentVideo.id < 0 ||
+      (m_CurrentVideo.hint != hint && !CanKeepCodec(m_CurrentVideo, hint)))
   {
     if (hint.codec == AV_CODEC_ID_MPEG2VIDEO || hint.codec == AV_CODEC_ID_H264)
       m_pCCDemuxer.reset();
@@ -4006,6 +4249,11 @@ bool CVideoPlayer::OpenVideoStream(CDVDStreamInfo& hint, bool reset)
     m_pCCDemuxer = std::make_unique<CDVDDemuxCC>(hint.codec);
     m_SelectionStreams.Clear(StreamType::NONE, STREAM_SOURCE_VIDEOMUX);
   }
+  else if (m_pCCDemuxer && reset)
+  {
+    // don't hand out the captions of the previous stream with the new one
+    m_pCCDemuxer->Flush();
+  }
 
   return true;
 }
@@ -4185,6 +4433,8 @@ void CVideoPlayer::FlushBuffers(double pts, bool accurate, bool sync)
 
   m_VideoPlayerAudio->Flush(sync);
   m_VideoPlayerVideo->Flush(sync);
+  if (m_pCCDemuxer)
+    m_pCCDemuxer->Flush();
   m_VideoPlayerSubtitle->Flush();
   m_VideoPlayerTeletext->Flush();
   m_VideoPlayerRadioRDS->Flush();
@@ -4886,6 +5136,17 @@ double CVideoPlayer::GetQueueTime()
   return std::max(a, v) * m_messageQueueTimeSize * 1000.0 / 100.0;
 }
 
+double CVideoPlayer::GetLiveLatency()
+{
+  // realtime inputs are read as data arrives, the last demuxed packet is the live edge
+  CCurrentStream& current = m_CurrentAudio.id >= 0 ? m_CurrentAudio : m_CurrentVideo;
+  const double edge = current.dts_end();
+  if (current.id < 0 || edge == DVD_NOPTS_VALUE)
+    return DVD_NOPTS_VALUE;
+
+  return std::max(0.0, edge - m_clock.GetClock());
+}
+
 int CVideoPlayer::AddSubtitleFile(const std::string& filename, const std::string& subfilename)
 {
   std::string ext = URIUtils::GetExtension(filename);
@@ -5118,6 +5379,7 @@ void CVideoPlayer::UpdatePlayState(double timeout)
     state.canpause = m_pInputStream->CanPause();
 
     bool realtime = m_pInputStream->IsRealtime();
+    state.live_latency = realtime ? GetLiveLatency() : DVD_NOPTS_VALUE;
 
     if (CServiceBroker::GetSettingsComponent()->GetSettings()->GetBool(CSettings::SETTING_VIDEOPLAYER_USEDISPLAYASCLOCK) &&
         !realtime)
@@ -5170,6 +5432,15 @@ void CVideoPlayer::UpdatePlayState(double timeout)
   else
     state.cache_bytes = 0;
 
+  XFILE::CFileCacheStats::Stats stats;
+  if (m_pInputStream && m_pInputStream->GetCacheStats(stats))
+  {
+    state.cache_stalls = static_cast<int64_t>(stats.stalls);
+    state.cache_hit_ratio = stats.GetHitRatio();
+  }
+  else
+    state.cache_stalls = -1;
+
   state.timestamp = m_clock.GetAbsoluteClock();
 
   if (state.timeMax <= 0)
@@ -5190,6 +5461,14 @@ void CVideoPlayer::UpdatePlayState(double timeout)
 
   m_processInfo->SetPlayTimes(state.startTime, state.time, state.timeMin, state.timeMax);
 
+  // ask for the next item early enough to open it in the background before this one ends
+  if (state.canseek && state.timeMax - state.time < PRELOAD_LEAD_TIME_MS &&
+      m_pInputStream && m_pInputStream->IsStreamType(DVDSTREAM_TYPE_FILE) &&
+      !m_preloadRequested.exchange(true))
+  {
+    m_outboundEvents->Submit([this]() { m_callback.OnQueueNextItem(); });
+  }
+
   // Save state of the current stream (for blurays/DVDs)
   CFileItem item;
   UpdateFileItemStreamDetails(item, UpdateStreamDetails::ALWAYS_UPDATE);
@@ -27,7 +27,9 @@
 
 #include <atomic>
 #include <chrono>
+#include <future>
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -56,6 +58,9 @@ struct SPlayerState
     cache_bytes = 0;
     cache_level = 0.0;
     cache_offset = 0.0;
+    live_latency = DVD_NOPTS_VALUE;
+    cache_stalls = -1;
+    cache_hit_ratio = 0.0;
     lastSeek = 0;
     streamsReady = false;
   }
@@ -87,6 +92,9 @@ struct SPlayerState
   double cache_level; // current cache level
   double cache_offset; // percentage of file ahead of current position
   double cache_time; // estimated playback time of current cached bytes
+  double live_latency; // distance to the live edge of realtime streams, DVD_NOPTS_VALUE if unknown
+  int64_t cache_stalls; // reads that waited for the source, -1 if the input isn't cached
+  double cache_hit_ratio; // share of reads and seeks served from the cache
 };
 
 class CDVDInputStream;
@@ -265,6 +273,7 @@ public:
   explicit CVideoPlayer(IPlayerCallback& callback);
   ~CVideoPlayer() override;
   bool OpenFile(const CFileItem& file, const CPlayerOptions &options) override;
+  bool PreloadNextFile(const CFileItem& file) override;
   bool CloseFile(bool reopen = false) override;
   bool IsPlaying() const override;
   void Pause() override;
@@ -402,6 +411,7 @@ protected:
   bool OpenStream(CCurrentStream& current, int64_t demuxerId, int iStream, int source, bool reset = true);
   bool OpenAudioStream(CDVDStreamInfo& hint, bool reset = true);
   bool OpenVideoStream(CDVDStreamInfo& hint, bool reset = true);
+  bool CanKeepCodec(CCurrentStream& current, CDVDStreamInfo& hint) const;
   bool OpenSubtitleStream(const CDVDStreamInfo& hint);
   bool OpenTeletextStream(CDVDStreamInfo& hint);
   bool OpenRadioRDSStream(CDVDStreamInfo& hint);
@@ -450,12 +460,14 @@ protected:
   void SetCaching(ECacheState state);
 
   double GetQueueTime();
+  double GetLiveLatency();
   CacheInfo GetCachingTimes();
 
   void FlushBuffers(double pts, bool accurate, bool sync);
 
   void HandleMessages();
   void HandlePlaySpeed();
+  void HandlePlaybackSync();
   bool IsInMenuInternal() const;
   void SynchronizeDemuxer();
   void CheckAutoSceneSkip();
@@ -475,6 +487,7 @@ protected:
 
   bool OpenInputStream();
   bool OpenDemuxStream();
+  void AddExternalSubtitles();
   void CloseDemuxer();
   void OpenDefaultStreams(bool reset = true);
 
@@ -562,6 +575,21 @@ protected:
   std::unique_ptr<CDVDDemux> m_pDemuxer;
   std::shared_ptr<CDVDDemux> m_pSubtitleDemuxer;
   std::unordered_map<int64_t, std::shared_ptr<CDVDDemux>> m_subtitleDemuxerMap;
+  std::future<std::vector<std::string>> m_externalSubtitles; /**< scan started by OpenInputStream */
+
+  /*!
+   * \brief The input stream and demuxer of the next item, opened near the end of the current one
+   */
+  struct PreloadedFile
+  {
+    std::shared_ptr<CDVDInputStream> inputStream;
+    std::unique_ptr<CDVDDemux> demuxer;
+  };
+  CCriticalSection m_preloadSection;
+  std::string m_preloadPath;
+  std::future<PreloadedFile> m_preload;
+  std::unique_ptr<CDVDDemux> m_preloadedDemuxer; /**< taken over by OpenDemuxStream */
+  std::atomic_bool m_preloadRequested{false};
   std::unique_ptr<CDVDDemuxCC> m_pCCDemuxer;
 
   CRenderManager m_renderManager;
@@ -594,6 +622,11 @@ protected:
   mutable CCriticalSection m_StateSection;
   XbmcThreads::EndTime<> m_syncTimer;
 
+  // following the master of a synchronised playback group
+  XbmcThreads::EndTime<> m_playbackSyncSeekTimer;
+  bool m_playbackSyncSeeking{false};
+  double m_playbackSyncSeekLead{DVD_MSEC_TO_TIME(2000)};
+
   CEdl m_Edl;
   bool m_SkipCommercials;
 
@@ -14,6 +14,7 @@
 #include "cores/AudioEngine/Interfaces/AE.h"
 #include "cores/AudioEngine/Utils/AEUtil.h"
 #include "cores/VideoPlayer/Interface/DemuxPacket.h"
+#include "cores/VideoPlayer/PlaybackBenchmark.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/MathUtils.h"
@@ -140,6 +141,9 @@ void CVideoPlayerAudio::OpenStream(CDVDStreamInfo& hints, std::unique_ptr<CDVDAu
     m_synctype = SYNC_RESAMPLE;
   else if (m_processInfo.IsRealtimeStream())
     m_synctype = SYNC_RESAMPLE;
+  // a follower of a playback group steers its clock, audio has to be resampled to follow it
+  else if (m_pClock->IsFollower())
+    m_synctype = SYNC_RESAMPLE;
 
   if (m_synctype == SYNC_DISCON)
     CLog::LogF(LOGINFO, "Allowing max Out-Of-Sync Value of {} ms", m_disconAdjustTimeMs);
@@ -228,6 +232,7 @@ void CVideoPlayerAudio::UpdatePlayerInfo()
 void CVideoPlayerAudio::Process()
 {
   CLog::Log(LOGINFO, "running thread: CVideoPlayerAudio::Process()");
+  SetThreadClass(ThreadClass::AUDIO);
 
   DVDAudioFrame audioframe;
   audioframe.nb_frames = 0;
@@ -517,7 +522,8 @@ bool CVideoPlayerAudio::ProcessDecoderOutput(DVDAudioFrame &audioframe)
 
       m_audioSink.Destroy(false);
 
-      if (!m_audioSink.Create(audioframe, m_streaminfo.codec, m_synctype == SYNC_RESAMPLE))
+      if (!m_audioSink.Create(audioframe, m_streaminfo.codec, m_synctype == SYNC_RESAMPLE,
+                              m_processInfo.IsRealtimeStream()))
         CLog::Log(LOGERROR, "{} - failed to create audio renderer", __FUNCTION__);
 
       m_prevsynctype = -1;
@@ -553,6 +559,9 @@ bool CVideoPlayerAudio::ProcessDecoderOutput(DVDAudioFrame &audioframe)
     }
   }
 
+  if (CPlaybackBenchmark::IsEnabled() && m_syncState == IDVDStreamPlayer::SYNC_INSYNC)
+    CPlaybackBenchmark::AddSyncError(m_audioSink.GetSyncError() * 1000 / DVD_TIME_BASE);
+
   int framesOutput = m_audioSink.AddPackets(audioframe);
 
   // guess next pts
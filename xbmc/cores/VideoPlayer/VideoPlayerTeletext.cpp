@@ -91,7 +91,6 @@ CDVDTeletextData::CDVDTeletextData(CProcessInfo &processInfo)
   m_messageQueue.SetMaxDataSize(40 * 256 * 1024);
 
   /* Initialize Data structures */
-  memset(&m_TXTCache->astCachetable, 0,    sizeof(m_TXTCache->astCachetable));
   memset(&m_TXTCache->astP29,        0,    sizeof(m_TXTCache->astP29));
   ResetTeletextCache();
 }
@@ -145,33 +144,25 @@ void CDVDTeletextData::ResetTeletextCache()
   std::unique_lock lock(m_TXTCache->m_critSection);
 
   /* Reset Data structures */
-  for (auto& pages : m_TXTCache->astCachetable)
-  {
-    for (TextCachedPage_t*& page : pages)
-    {
-      if (page)
-      {
-        TextPageinfo_t *p = &(page->pageinfo);
-        if (p->p24)
-          free(p->p24);
+  m_TXTCache->astCachetable.ForEach([](TextCachedPage_t* page) {
+    TextPageinfo_t *p = &(page->pageinfo);
+    if (p->p24)
+      free(p->p24);
 
-        if (p->ext)
-        {
-          if (p->ext->p27)
-            free(p->ext->p27);
+    if (p->ext)
+    {
+      if (p->ext->p27)
+        free(p->ext->p27);
 
-          for (unsigned char* const d26 : p->ext->p26)
-          {
-            if (d26)
-              free(d26);
-          }
-          free(p->ext);
-        }
-        delete page;
-        page = 0;
+      for (unsigned char* const d26 : p->ext->p26)
+      {
+        if (d26)
+          free(d26);
       }
+      free(p->ext);
     }
-  }
+    delete page;
+  });
 
   for (int i = 0; i < 9; i++)
   {
@@ -198,7 +189,7 @@ void CDVDTeletextData::ResetTeletextCache()
   memset(&m_TXTCache->ADIPTable,     0,    sizeof(m_TXTCache->ADIPTable));
   memset(&m_TXTCache->FlofPages,     0,    sizeof(m_TXTCache->FlofPages));
   memset(&m_TXTCache->SubtitlePages, 0,    sizeof(m_TXTCache->SubtitlePages));
-  memset(&m_TXTCache->astCachetable, 0,    sizeof(m_TXTCache->astCachetable));
+  m_TXTCache->astCachetable.Clear();
   memset(&m_TXTCache->TimeString,    0x20, 8);
 
   m_TXTCache->NationalSubset           = NAT_DEFAULT;/* default */
@@ -339,7 +330,7 @@ void CDVDTeletextData::Process()
 
               AllocateCache(magazine);
               LoadPage(m_TXTCache->CurrentPage[magazine], m_TXTCache->CurrentSubPage[magazine], pagedata[magazine]);
-              pageinfo_thread = &(m_TXTCache->astCachetable[m_TXTCache->CurrentPage[magazine]][m_TXTCache->CurrentSubPage[magazine]]->pageinfo);
+              pageinfo_thread = &(m_TXTCache->astCachetable.Get(m_TXTCache->CurrentPage[magazine], m_TXTCache->CurrentSubPage[magazine])->pageinfo);
               if (!pageinfo_thread)
                 continue;
 
@@ -349,7 +340,7 @@ void CDVDTeletextData::Process()
               /* check controlbits */
               if (dehamming[vtxt_row[5]] & 8)   /* C4 -> erase page */
               {
-                memset(m_TXTCache->astCachetable[m_TXTCache->CurrentPage[magazine]][m_TXTCache->CurrentSubPage[magazine]]->data, ' ', 23*40);
+                memset(m_TXTCache->astCachetable.Get(m_TXTCache->CurrentPage[magazine], m_TXTCache->CurrentSubPage[magazine])->data, ' ', 23*40);
                 memset(pagedata[magazine],' ', 23*40);
               }
 //              if (dehamming[vtxt_row[9]] & 8)   /* C8 -> update page */
@@ -390,7 +381,7 @@ void CDVDTeletextData::Process()
               }
 
               /* check parity, copy line 0 to cache (start and end 8 bytes are not needed and used otherwise) */
-              unsigned char *p = m_TXTCache->astCachetable[m_TXTCache->CurrentPage[magazine]][m_TXTCache->CurrentSubPage[magazine]]->p0;
+              unsigned char *p = m_TXTCache->astCachetable.Get(m_TXTCache->CurrentPage[magazine], m_TXTCache->CurrentSubPage[magazine])->p0;
               for (int i = 10; i < 42-8; i++)
                 *p++ = deparity[vtxt_row[i]];
 
@@ -409,7 +400,7 @@ void CDVDTeletextData::Process()
             else if (m_TXTCache->CurrentPage[magazine] != -1 && m_TXTCache->CurrentSubPage[magazine] != -1)
               /* packet>0, 0 has been correctly received, buffer allocated */
             {
-              pageinfo_thread = &(m_TXTCache->astCachetable[m_TXTCache->CurrentPage[magazine]][m_TXTCache->CurrentSubPage[magazine]]->pageinfo);
+              pageinfo_thread = &(m_TXTCache->astCachetable.Get(m_TXTCache->CurrentPage[magazine], m_TXTCache->CurrentSubPage[magazine])->pageinfo);
               if (!pageinfo_thread)
                 continue;
 
@@ -549,9 +540,9 @@ void CDVDTeletextData::Process()
                       // sorry.. i dont understand whats going wrong here :)
                       continue;
                     }
-                    else if (m_TXTCache->astCachetable[p->page][0])  /* link valid && linked page cached */
+                    else if (m_TXTCache->astCachetable.Get(p->page, 0))  /* link valid && linked page cached */
                     {
-                      TextPageinfo_t *pageinfo_link = &(m_TXTCache->astCachetable[p->page][0]->pageinfo);
+                      TextPageinfo_t *pageinfo_link = &(m_TXTCache->astCachetable.Get(p->page, 0)->pageinfo);
                       if (p->local)
                         pageinfo_link->function = p->drcs ? FUNC_DRCS : FUNC_POP;
                       else
@@ -717,7 +708,7 @@ void CDVDTeletextData::Decode_p2829(unsigned char *vtxt_row, TextExtData_t **ptE
 void CDVDTeletextData::SavePage(int p, int sp, unsigned char* buffer)
 {
   std::unique_lock lock(m_TXTCache->m_critSection);
-  TextCachedPage_t* pg = m_TXTCache->astCachetable[p][sp];
+  TextCachedPage_t* pg = m_TXTCache->astCachetable.Get(p, sp);
   if (!pg)
   {
     CLog::Log(LOGERROR, "CDVDTeletextData: trying to save a not allocated page!!");
@@ -730,7 +721,7 @@ void CDVDTeletextData::SavePage(int p, int sp, unsigned char* buffer)
 void CDVDTeletextData::LoadPage(int p, int sp, unsigned char* buffer)
 {
   std::unique_lock lock(m_TXTCache->m_critSection);
-  TextCachedPage_t* pg = m_TXTCache->astCachetable[p][sp];
+  TextCachedPage_t* pg = m_TXTCache->astCachetable.Get(p, sp);
   if (!pg)
   {
     CLog::Log(LOGERROR, "CDVDTeletextData: trying to load a not allocated page!!");
@@ -743,7 +734,7 @@ void CDVDTeletextData::LoadPage(int p, int sp, unsigned char* buffer)
 void CDVDTeletextData::ErasePage(int magazine)
 {
   std::unique_lock lock(m_TXTCache->m_critSection);
-  TextCachedPage_t* pg = m_TXTCache->astCachetable[m_TXTCache->CurrentPage[magazine]][m_TXTCache->CurrentSubPage[magazine]];
+  TextCachedPage_t* pg = m_TXTCache->astCachetable.Get(m_TXTCache->CurrentPage[magazine], m_TXTCache->CurrentSubPage[magazine]);
   if (pg)
   {
     memset(&(pg->pageinfo), 0, sizeof(TextPageinfo_t));  /* struct pageinfo */
@@ -755,10 +746,10 @@ void CDVDTeletextData::ErasePage(int magazine)
 void CDVDTeletextData::AllocateCache(int magazine)
 {
   /* check cachetable and allocate memory if needed */
-  if (m_TXTCache->astCachetable[m_TXTCache->CurrentPage[magazine]][m_TXTCache->CurrentSubPage[magazine]] == 0)
+  if (m_TXTCache->astCachetable.Get(m_TXTCache->CurrentPage[magazine], m_TXTCache->CurrentSubPage[magazine]) == 0)
   {
-    m_TXTCache->astCachetable[m_TXTCache->CurrentPage[magazine]][m_TXTCache->CurrentSubPage[magazine]] = new TextCachedPage_t;
-    if (m_TXTCache->astCachetable[m_TXTCache->CurrentPage[magazine]][m_TXTCache->CurrentSubPage[magazine]] )
+    m_TXTCache->astCachetable.Set(m_TXTCache->CurrentPage[magazine], m_TXTCache->CurrentSubPage[magazine], new TextCachedPage_t);
+    if (m_TXTCache->astCachetable.Get(m_TXTCache->CurrentPage[magazine], m_TXTCache->CurrentSubPage[magazine]) )
     {
       ErasePage(magazine);
       m_TXTCache->CachedPages++;
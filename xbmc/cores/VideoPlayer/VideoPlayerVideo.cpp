@@ -12,6 +12,7 @@
 #include "DVDCodecs/DVDFactoryCodec.h"
 #include "DVDCodecs/Overlay/DVDOverlay.h"
 #include "DVDCodecs/Video/DVDVideoCodecFFmpeg.h"
+#include "PlaybackBenchmark.h"
 #include "ServiceBroker.h"
 #include "cores/VideoPlayer/Interface/DemuxPacket.h"
 #include "cores/VideoPlayer/Interface/TimingConstants.h"
@@ -19,6 +20,7 @@
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/MathUtils.h"
+#include "utils/Trace.h"
 #include "utils/log.h"
 #include "windowing/GraphicContext.h"
 #include "windowing/WinSystem.h"
@@ -313,6 +315,7 @@ inline MsgQueueReturnCode CVideoPlayerVideo::GetMessage(std::shared_ptr<CDVDMsg>
 void CVideoPlayerVideo::Process()
 {
   CLog::Log(LOGINFO, "running thread: video_thread");
+  SetThreadClass(ThreadClass::VIDEO);
 
   double pts = 0;
   double frametime = (double)DVD_TIME_BASE / m_fFrameRate;
@@ -324,6 +327,7 @@ void CVideoPlayerVideo::Process()
   m_videoStats.Start();
   m_droppingStats.Reset();
   m_iDroppedFrames = 0;
+  m_decodeTime = {};
   m_rewindStalled = false;
   m_outputSate = OUTPUT_NORMAL;
 
@@ -539,6 +543,7 @@ void CVideoPlayerVideo::Process()
     }
     else if (pMsg->IsType(CDVDMsg::DEMUXER_PACKET))
     {
+      CTraceZone zone("CVideoPlayerVideo::Decode");
       DemuxPacket* pPacket = std::static_pointer_cast<CDVDMsgDemuxerPacket>(pMsg)->GetPacket();
       bool bPacketDrop = std::static_pointer_cast<CDVDMsgDemuxerPacket>(pMsg)->GetPacketDrop();
 
@@ -559,6 +564,7 @@ void CVideoPlayerVideo::Process()
       if (iDropDirective & DROP_DROPPED)
       {
         m_iDroppedFrames++;
+        CPlaybackBenchmark::AddDroppedFrame(CPlaybackBenchmark::DropSource::DECODER);
         m_ptsTracker.Flush();
       }
       if (m_messageQueue.GetDataSize() == 0 ||  m_speed < 0)
@@ -581,7 +587,10 @@ void CVideoPlayerVideo::Process()
         codecControl |= DVD_CODEC_CTRL_ROTATE;
       m_pVideoCodec->SetCodecControl(codecControl);
 
-      if (m_pVideoCodec->AddData(*pPacket))
+      const CPlaybackBenchmark::CTimer decodeTimer;
+      const bool added = m_pVideoCodec->AddData(*pPacket);
+      m_decodeTime += decodeTimer.Elapsed();
+      if (added)
       {
         // buffer packets so we can recover should decoder flush for some reason
         if (m_pVideoCodec->GetConvergeCount() > 0)
@@ -610,7 +619,9 @@ void CVideoPlayerVideo::Process()
 
 bool CVideoPlayerVideo::ProcessDecoderOutput(double &frametime, double &pts)
 {
+  const CPlaybackBenchmark::CTimer decodeTimer;
   CDVDVideoCodec::VCReturn decoderState = m_pVideoCodec->GetPicture(&m_picture);
+  m_decodeTime += decodeTimer.Elapsed();
 
   if (decoderState == CDVDVideoCodec::VC_BUFFER)
   {
@@ -675,6 +686,9 @@ bool CVideoPlayerVideo::ProcessDecoderOutput(double &frametime, double &pts)
   // check for a new picture
   if (decoderState == CDVDVideoCodec::VC_PICTURE)
   {
+    CPlaybackBenchmark::AddDecodedFrame(m_decodeTime);
+    m_decodeTime = {};
+
     bool hasTimestamp = true;
 
     m_picture.iDuration = frametime;
@@ -758,6 +772,7 @@ bool CVideoPlayerVideo::ProcessDecoderOutput(double &frametime, double &pts)
     else if ((m_outputSate == OUTPUT_DROPPED) && !(m_picture.iFlags & DVP_FLAG_DROPPED))
     {
       m_iDroppedFrames++;
+      CPlaybackBenchmark::AddDroppedFrame(CPlaybackBenchmark::DropSource::DECODER);
       m_ptsTracker.Flush();
     }
 
@@ -20,6 +20,7 @@
 #include "utils/BitstreamStats.h"
 
 #include <atomic>
+#include <chrono>
 
 #define DROP_DROPPED 1
 #define DROP_VERYLATE 2
@@ -110,6 +111,7 @@ protected:
   int m_iLateFrames;
   int m_iDroppedFrames;
   int m_iDroppedRequest;
+  std::chrono::nanoseconds m_decodeTime{0}; // time spent in the decoder since the last picture
 
   double m_fFrameRate;       //framerate of the video currently playing
   double m_fStableFrameRate; //place to store calculated framerates
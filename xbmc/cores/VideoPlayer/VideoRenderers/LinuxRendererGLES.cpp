@@ -1309,14 +1309,7 @@ bool CLinuxRendererGLES::RenderCapture(int index, CRenderCapture* capture)
   glReadPixels(0, CServiceBroker::GetWinSystem()->GetGfxContext().GetHeight() - capture->GetHeight(), capture->GetWidth(), capture->GetHeight(),
                GL_RGBA, GL_UNSIGNED_BYTE, capture->GetRenderBuffer());
 
-  // OpenGLES returns in RGBA order but CRenderCapture needs BGRA order
-  // XOR Swap RGBA -> BGRA
-  unsigned char* pixels = static_cast<unsigned char*>(capture->GetRenderBuffer());
-  for (unsigned int i = 0; i < capture->GetWidth() * capture->GetHeight(); i++, pixels += 4)
-  {
-    std::swap(pixels[0], pixels[2]);
-  }
-
+  // the capture converts the pixels to BGRA once they have been read
   capture->EndRender();
 
   // revert model view matrix
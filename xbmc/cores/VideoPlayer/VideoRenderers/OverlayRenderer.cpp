@@ -517,18 +517,21 @@ std::shared_ptr<COverlay> CRenderer::ConvertLibass(
   if (!images)
     return nullptr;
 
+  const COverlay* previous = nullptr;
   if (o.m_textureid)
   {
-    if (changes == 0)
+    std::map<unsigned int, std::shared_ptr<COverlay>>::iterator it =
+        m_textureCache.find(o.m_textureid);
+    if (it != m_textureCache.end())
     {
-      std::map<unsigned int, std::shared_ptr<COverlay>>::iterator it =
-          m_textureCache.find(o.m_textureid);
-      if (it != m_textureCache.end())
+      if (changes == 0)
         return it->second;
+      previous = it->second.get();
     }
   }
 
-  std::shared_ptr<COverlay> overlay = COverlay::Create(images, rOpts.frameWidth, rOpts.frameHeight);
+  std::shared_ptr<COverlay> overlay =
+      COverlay::Create(images, rOpts.frameWidth, rOpts.frameHeight, previous);
 
   m_textureCache[m_textureid] = overlay;
   o.m_textureid = m_textureid;
@@ -45,7 +45,15 @@ namespace OVERLAY {
   public:
     static std::shared_ptr<COverlay> Create(const CDVDOverlayImage& o, CRect& rSource);
     static std::shared_ptr<COverlay> Create(const CDVDOverlaySpu& o);
-    static std::shared_ptr<COverlay> Create(ASS_Image* images, float width, float height);
+    /*!
+     * \brief Create the overlay of a libass frame
+     * \param previous The overlay of the previous frame of the same subtitle, if any,
+     * whose uploaded resources may be reused
+     */
+    static std::shared_ptr<COverlay> Create(ASS_Image* images,
+                                            float width,
+                                            float height,
+                                            const COverlay* previous = nullptr);
 
     COverlay();
     virtual ~COverlay();
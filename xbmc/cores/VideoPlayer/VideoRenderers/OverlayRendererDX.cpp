@@ -61,7 +61,10 @@ static bool LoadTexture(int width, int height, int stride
   return true;
 }
 
-std::shared_ptr<COverlay> COverlay::Create(ASS_Image* images, float width, float height)
+std::shared_ptr<COverlay> COverlay::Create(ASS_Image* images,
+                                           float width,
+                                           float height,
+                                           const COverlay* previous)
 {
   return std::make_shared<COverlayQuadsDX>(images, width, height);
 }
@@ -184,12 +184,23 @@ COverlayTextureGL::COverlayTextureGL(const CDVDOverlaySpu& o)
   m_pma = !!USE_PREMULTIPLIED_ALPHA;
 }
 
-std::shared_ptr<COverlay> COverlay::Create(ASS_Image* images, float width, float height)
+std::shared_ptr<COverlay> COverlay::Create(ASS_Image* images,
+                                           float width,
+                                           float height,
+                                           const COverlay* previous)
 {
-  return std::make_shared<COverlayGlyphGL>(images, width, height);
+  return std::make_shared<COverlayGlyphGL>(images, width, height, previous);
 }
 
-COverlayGlyphGL::COverlayGlyphGL(ASS_Image* images, float width, float height)
+COverlayGlyphGL::SAtlas::~SAtlas()
+{
+  glDeleteTextures(1, &texture);
+}
+
+COverlayGlyphGL::COverlayGlyphGL(ASS_Image* images,
+                                 float width,
+                                 float height,
+                                 const COverlay* previous)
 {
   m_width  = 1.0;
   m_height = 1.0;
@@ -202,15 +213,30 @@ COverlayGlyphGL::COverlayGlyphGL(ASS_Image* images, float width, float height)
   if (!convert_quad(images, quads, static_cast<int>(width)))
     return;
 
-  glGenTextures(1, &m_texture);
-  glBindTexture(GL_TEXTURE_2D, m_texture);
+  // libass reports a change whenever colours or positions move, which happens on every
+  // frame of a karaoke effect although the packed glyph bitmaps stay the same
+  const auto* prev = dynamic_cast<const COverlayGlyphGL*>(previous);
+  if (prev && prev->m_atlas && prev->m_atlas->width == quads.size_x &&
+      prev->m_atlas->height == quads.size_y && prev->m_atlas->pixels == quads.texture)
+  {
+    m_atlas = prev->m_atlas;
+  }
+  else
+  {
+    m_atlas = std::make_shared<SAtlas>();
+    glGenTextures(1, &m_atlas->texture);
+    glBindTexture(GL_TEXTURE_2D, m_atlas->texture);
 
-  LoadTexture(GL_TEXTURE_2D, quads.size_x, quads.size_y, quads.size_x, &m_u, &m_v, true,
-              quads.texture.data());
+    LoadTexture(GL_TEXTURE_2D, quads.size_x, quads.size_y, quads.size_x, &m_atlas->u,
+                &m_atlas->v, true, quads.texture.data());
 
+    m_atlas->width = quads.size_x;
+    m_atlas->height = quads.size_y;
+    m_atlas->pixels = std::move(quads.texture);
+  }
 
-  float scale_u = m_u / quads.size_x;
-  float scale_v = m_v / quads.size_y;
+  float scale_u = m_atlas->u / quads.size_x;
+  float scale_v = m_atlas->v / quads.size_y;
 
   float scale_x = 1.0f / width;
   float scale_y = 1.0f / height;
@@ -263,19 +289,16 @@ COverlayGlyphGL::COverlayGlyphGL(ASS_Image* images, float width, float height)
   glBindTexture(GL_TEXTURE_2D, 0);
 }
 
-COverlayGlyphGL::~COverlayGlyphGL()
-{
-  glDeleteTextures(1, &m_texture);
-}
+COverlayGlyphGL::~COverlayGlyphGL() = default;
 
 void COverlayGlyphGL::Render(SRenderState& state)
 {
-  if ((m_texture == 0) || (m_vertex.empty()))
+  if (!m_atlas || m_vertex.empty())
     return;
 
   glEnable(GL_BLEND);
 
-  glBindTexture(GL_TEXTURE_2D, m_texture);
+  glBindTexture(GL_TEXTURE_2D, m_atlas->texture);
   glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
 
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
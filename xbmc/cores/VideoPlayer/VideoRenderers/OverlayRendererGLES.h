@@ -43,7 +43,7 @@ public:
 class COverlayGlyphGLES : public COverlay
 {
 public:
-  COverlayGlyphGLES(ASS_Image* images, float width, float height);
+  COverlayGlyphGLES(ASS_Image* images, float width, float height, const COverlay* previous);
 
   ~COverlayGlyphGLES() override;
 
@@ -58,9 +58,23 @@ public:
 
   std::vector<VERTEX> m_vertex;
 
-  GLuint m_texture = 0;
-  float m_u;
-  float m_v;
+  /*!
+   * \brief Uploaded glyph atlas. It is shared with the overlay of the next libass frame
+   * when that frame packs to the same pixels, e.g. karaoke colour or position changes.
+   */
+  struct SAtlas
+  {
+    ~SAtlas();
+
+    GLuint texture = 0;
+    float u = 0.0f;
+    float v = 0.0f;
+    int width = 0;
+    int height = 0;
+    std::vector<uint8_t> pixels;
+  };
+
+  std::shared_ptr<SAtlas> m_atlas;
 };
 
 } // namespace OVERLAY
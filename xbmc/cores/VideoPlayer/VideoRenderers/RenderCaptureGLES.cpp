@@ -8,22 +8,143 @@
 
 #include "RenderCaptureGLES.h"
 
+#include "ServiceBroker.h"
+#include "cores/IPlayer.h"
+#include "rendering/RenderSystem.h"
+#include "utils/log.h"
+
+#include <cstring>
+#include <utility>
+
 CRenderCaptureGLES::~CRenderCaptureGLES()
 {
+#if HAS_GLES == 3
+  if (m_fence)
+    glDeleteSync(m_fence);
+
+  if (m_pbo)
+    glDeleteBuffers(1, &m_pbo);
+#endif
+
   delete[] m_pixels;
 }
 
 void CRenderCaptureGLES::BeginRender()
 {
-  if (m_bufferSize != m_width * m_height * 4)
+  if (!m_asyncChecked)
+  {
+#if HAS_GLES == 3
+    unsigned int major, minor;
+    CServiceBroker::GetRenderSystem()->GetRenderVersion(major, minor);
+    m_asyncSupported = major >= 3;
+#endif
+    if (!m_asyncSupported && (m_flags & CAPTUREFLAG_CONTINUOUS))
+      CLog::Log(LOGWARNING, "CRenderCaptureGLES: GLES 3.0 not supported, performance might suffer");
+
+    m_asyncChecked = true;
+  }
+
+  const unsigned int size = m_width * m_height * 4;
+
+#if HAS_GLES == 3
+  if (m_asyncSupported)
+  {
+    if (!m_pbo)
+      glGenBuffers(1, &m_pbo);
+
+    //the pixels are read into the pbo, which is mapped once the gpu is done with it
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, m_pbo);
+    if (m_bufferSize != size)
+      glBufferData(GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ);
+  }
+#endif
+
+  if (m_bufferSize != size)
   {
     delete[] m_pixels;
-    m_bufferSize = m_width * m_height * 4;
+    m_bufferSize = size;
     m_pixels = new uint8_t[m_bufferSize];
   }
 }
 
 void CRenderCaptureGLES::EndRender()
 {
+#if HAS_GLES == 3
+  if (m_asyncSupported)
+  {
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    if (m_fence)
+      glDeleteSync(m_fence);
+    m_fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    if (m_flags & CAPTUREFLAG_IMMEDIATELY)
+      PboToBuffer();
+    else
+      SetState(CAPTURESTATE_NEEDSREADOUT);
+    return;
+  }
+#endif
+
+  ConvertToBGRA();
   SetState(CAPTURESTATE_DONE);
 }
+
+void* CRenderCaptureGLES::GetRenderBuffer()
+{
+  if (m_asyncSupported)
+    return nullptr; //offset into the pbo
+  else
+    return m_pixels;
+}
+
+void CRenderCaptureGLES::ReadOut()
+{
+#if HAS_GLES == 3
+  if (!m_asyncSupported)
+    return;
+
+  //don't wait for the gpu, check again on the next frame if it isn't done yet
+  if (m_fence && glClientWaitSync(m_fence, 0, 0) == GL_TIMEOUT_EXPIRED)
+    return;
+
+  PboToBuffer();
+#endif
+}
+
+#if HAS_GLES == 3
+void CRenderCaptureGLES::PboToBuffer()
+{
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, m_pbo);
+  GLvoid* pboPtr = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, m_bufferSize, GL_MAP_READ_BIT);
+
+  if (pboPtr)
+  {
+    std::memcpy(m_pixels, pboPtr, m_bufferSize);
+    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    ConvertToBGRA();
+    SetState(CAPTURESTATE_DONE);
+  }
+  else
+  {
+    CLog::Log(LOGERROR, "CRenderCaptureGLES::PboToBuffer: glMapBufferRange failed");
+    SetState(CAPTURESTATE_FAILED);
+  }
+
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+  if (m_fence)
+  {
+    glDeleteSync(m_fence);
+    m_fence = nullptr;
+  }
+}
+#endif
+
+void CRenderCaptureGLES::ConvertToBGRA()
+{
+  // OpenGLES returns in RGBA order but CRenderCapture needs BGRA order
+  uint8_t* pixels = m_pixels;
+  for (unsigned int i = 0; i < m_width * m_height; i++, pixels += 4)
+    std::swap(pixels[0], pixels[2]);
+}
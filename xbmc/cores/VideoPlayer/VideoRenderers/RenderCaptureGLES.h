@@ -20,4 +20,16 @@ public:
 
   void BeginRender() override;
   void EndRender() override;
+  void ReadOut() override;
+
+  void* GetRenderBuffer() override;
+
+private:
+  void ConvertToBGRA();
+
+#if HAS_GLES == 3
+  void PboToBuffer();
+  GLuint m_pbo{0};
+  GLsync m_fence{nullptr};
+#endif
 };
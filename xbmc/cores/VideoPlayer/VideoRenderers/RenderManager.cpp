@@ -16,17 +16,21 @@
 #include "ServiceBroker.h"
 #include "application/Application.h"
 #include "cores/VideoPlayer/Interface/TimingConstants.h"
+#include "cores/VideoPlayer/PlaybackBenchmark.h"
 #include "messaging/ApplicationMessenger.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
 #include "threads/SingleLock.h"
 #include "utils/StringUtils.h"
+#include "utils/Trace.h"
 #include "utils/XTimeUtils.h"
 #include "utils/log.h"
 #include "windowing/GraphicContext.h"
 #include "windowing/WinSystem.h"
 
+#include <chrono>
+#include <cmath>
 #include <memory>
 #include <mutex>
 
@@ -40,6 +44,46 @@ void CRenderManager::CClockSync::Reset()
   m_enabled = false;
 }
 
+void CRenderManager::CPacingStats::Reset()
+{
+  m_buckets.fill(0);
+  m_count = 0;
+  m_lastError = DVD_NOPTS_VALUE;
+}
+
+void CRenderManager::CPacingStats::Add(double error, double frametime)
+{
+  const double lastError = m_lastError;
+  m_lastError = error;
+  if (lastError == DVD_NOPTS_VALUE || frametime <= 0)
+    return;
+
+  const double relError = std::abs(error - lastError) / frametime;
+  size_t bucket = 0;
+  while (bucket < BUCKET_LIMITS.size() && relError >= BUCKET_LIMITS[bucket])
+    bucket++;
+
+  m_buckets[bucket]++;
+  m_count++;
+}
+
+std::string CRenderManager::CPacingStats::GetHistogram() const
+{
+  if (!m_count)
+    return {};
+
+  std::string histogram = "pacing:";
+  for (size_t i = 0; i < m_buckets.size(); i++)
+  {
+    const double percent = 100.0 * m_buckets[i] / m_count;
+    if (i < BUCKET_LIMITS.size())
+      histogram += StringUtils::Format(" <{:.0f}%:{:.0f}%", BUCKET_LIMITS[i] * 100, percent);
+    else
+      histogram += StringUtils::Format(" late:{:.0f}%", percent);
+  }
+  return histogram;
+}
+
 unsigned int CRenderManager::m_nextCaptureId = 0;
 
 CRenderManager::CRenderManager(CDVDClock &clock, IRenderMsg *player) :
@@ -137,6 +181,7 @@ bool CRenderManager::Configure(const VideoPicture& picture, float fps, unsigned
     m_renderState = STATE_CONFIGURING;
     m_stateEvent.Reset();
     m_clockSync.Reset();
+    m_pacingStats.Reset();
     m_dvdClock.SetVsyncAdjust(0);
     m_pConfigPicture = std::make_unique<VideoPicture>();
     m_pConfigPicture->CopyRef(picture);
@@ -223,6 +268,7 @@ bool CRenderManager::Configure()
     m_renderedOverlay = false;
     m_renderDebug = false;
     m_clockSync.Reset();
+    m_pacingStats.Reset();
     m_dvdClock.SetVsyncAdjust(0);
     m_overlays.Reset();
     m_overlays.SetStereoMode(m_picture.stereoMode);
@@ -279,6 +325,7 @@ bool CRenderManager::IsPresenting()
 
 void CRenderManager::FrameMove()
 {
+  CTraceZone zone("CRenderManager::FrameMove");
   bool firstFrame = false;
   UpdateResolution();
 
@@ -697,6 +744,7 @@ RESOLUTION CRenderManager::GetResolution()
 
 void CRenderManager::Render(bool clear, DWORD flags, DWORD alpha, bool gui)
 {
+  CTraceZone zone("CRenderManager::Render");
   CSingleExit exitLock(CServiceBroker::GetWinSystem()->GetGfxContext());
 
   {
@@ -708,8 +756,10 @@ void CRenderManager::Render(bool clear, DWORD flags, DWORD alpha, bool gui)
   if (!gui && m_pRenderer->IsGuiLayer())
     return;
 
+  std::chrono::nanoseconds renderTime{0};
   if (!gui || m_pRenderer->IsGuiLayer())
   {
+    const CPlaybackBenchmark::CTimer renderTimer;
     SPresent& m = m_Queue[m_presentsource];
 
     if( m.presentmethod == PRESENT_METHOD_BOB )
@@ -718,6 +768,7 @@ void CRenderManager::Render(bool clear, DWORD flags, DWORD alpha, bool gui)
       PresentBlend(clear, flags, alpha);
     else
       PresentSingle(clear, flags, alpha);
+    renderTime = renderTimer.Elapsed();
   }
 
   if (gui)
@@ -757,6 +808,11 @@ void CRenderManager::Render(bool clear, DWORD flags, DWORD alpha, bool gui)
                                             refreshrate, missedvblanks, clockspeed * 100);
         }
 
+        {
+          std::unique_lock lock(m_presentlock);
+          info.pacing = m_pacingStats.GetHistogram();
+        }
+
         m_debugRenderer.SetInfo(info);
       }
 
@@ -774,6 +830,7 @@ void CRenderManager::Render(bool clear, DWORD flags, DWORD alpha, bool gui)
 
     if (m_presentstep == PRESENT_FRAME)
     {
+      CPlaybackBenchmark::AddRenderedFrame(renderTime);
       if (m.presentmethod == PRESENT_METHOD_BOB)
         m_presentstep = PRESENT_FRAME2;
       else
@@ -1215,6 +1272,7 @@ void CRenderManager::PrepareNextRender()
       {
         m_discard.push_back(m_presentsourcePast);
         m_QueueSkip++;
+        CPlaybackBenchmark::AddDroppedFrame(CPlaybackBenchmark::DropSource::RENDERER);
       }
       m_presentsourcePast = m_queued.front();
       m_queued.pop_front();
@@ -1232,6 +1290,7 @@ void CRenderManager::PrepareNextRender()
     m_presentsource = idx;
     m_queued.pop_front();
     m_presentpts = m_Queue[idx].pts - m_displayLatency;
+    m_pacingStats.Add(renderPts - m_Queue[idx].pts, frametime);
     m_presentevent.notifyAll();
 
     m_playerPort->UpdateRenderBuffers(m_queued.size(), m_discard.size(), m_free.size());
@@ -1244,6 +1303,7 @@ void CRenderManager::PrepareNextRender()
     m_presentsource = m_queued.front();
     m_queued.pop_front();
     m_presentpts = m_Queue[m_presentsource].pts - m_displayLatency - frametime / 2;
+    m_pacingStats.Add(renderPts - m_Queue[m_presentsource].pts, frametime);
     m_presentevent.notifyAll();
   }
 }
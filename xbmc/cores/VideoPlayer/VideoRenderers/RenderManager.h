@@ -11,6 +11,7 @@
 #include "DVDClock.h"
 #include "DebugRenderer.h"
 #include "cores/VideoPlayer/DVDCodecs/Video/DVDVideoCodec.h"
+#include "cores/VideoPlayer/Interface/TimingConstants.h"
 #include "cores/VideoPlayer/VideoRenderers/BaseRenderer.h"
 #include "cores/VideoPlayer/VideoRenderers/OverlayRenderer.h"
 #include "cores/VideoSettings.h"
@@ -20,6 +21,7 @@
 #include "utils/Geometry.h"
 #include "windowing/Resolution.h"
 
+#include <array>
 #include <atomic>
 #include <deque>
 #include <list>
@@ -234,6 +236,25 @@ protected:
   };
   CClockSync m_clockSync;
 
+  /*!
+   * \brief Histogram of the present to vblank error of consecutive frames.
+   *
+   * A constant offset between a frame's pts and the vblank it is shown at is invisible, a
+   * changing one is judder. Each bucket counts how much the offset changed from the previous
+   * frame, in fractions of a display frame so it reads the same for any refresh rate.
+   */
+  struct CPacingStats
+  {
+    void Reset();
+    void Add(double error, double frametime);
+    std::string GetHistogram() const;
+    static constexpr std::array<double, 4> BUCKET_LIMITS = {0.1, 0.25, 0.5, 1.0};
+    std::array<unsigned int, BUCKET_LIMITS.size() + 1> m_buckets{};
+    unsigned int m_count = 0;
+    double m_lastError = DVD_NOPTS_VALUE;
+  };
+  CPacingStats m_pacingStats;
+
   void RenderCapture(CRenderCapture* capture);
   void RemoveCaptures();
   CCriticalSection m_captCritSect;
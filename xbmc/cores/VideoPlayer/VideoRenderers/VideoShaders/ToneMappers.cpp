@@ -8,6 +8,59 @@
 
 #include "ToneMappers.h"
 
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+constexpr float ST2084_m1 = 2610.0f / (4096.0f * 4.0f);
+constexpr float ST2084_m2 = (2523.0f / 4096.0f) * 128.0f;
+constexpr float ST2084_c1 = 3424.0f / 4096.0f;
+constexpr float ST2084_c2 = (2413.0f / 4096.0f) * 32.0f;
+constexpr float ST2084_c3 = (2392.0f / 4096.0f) * 32.0f;
+
+float InversePQ(float x)
+{
+  x = std::pow(std::max(x, 0.0f), 1.0f / ST2084_m2);
+  x = std::max(x - ST2084_c1, 0.0f) / (ST2084_c2 - ST2084_c3 * x);
+  return std::pow(x, 1.0f / ST2084_m1);
+}
+
+float Reinhard(float x, float toneP1)
+{
+  return x * (1.0f + x / (toneP1 * toneP1)) / (1.0f + x);
+}
+
+float Aces(float x)
+{
+  const float A = 2.51f;
+  const float B = 0.03f;
+  const float C = 2.43f;
+  const float D = 0.59f;
+  const float E = 0.14f;
+  return (x * (A * x + B)) / (x * (C * x + D) + E);
+}
+
+float Hable(float x)
+{
+  const float A = 0.15f;
+  const float B = 0.5f;
+  const float C = 0.1f;
+  const float D = 0.2f;
+  const float E = 0.02f;
+  const float F = 0.3f;
+  return ((x * (A * x + C * B) + D * E) / (x * (A * x + B) + D * F)) - E / F;
+}
+} // namespace
+
+bool ToneMappingLutParams::operator==(const ToneMappingLutParams& other) const
+{
+  return method == other.method && colorConversion == other.colorConversion &&
+         primMat == other.primMat && gammaSrc == other.gammaSrc &&
+         gammaDstInv == other.gammaDstInv && coefsDst == other.coefsDst &&
+         toneP1 == other.toneP1 && luminance == other.luminance;
+}
+
 float CToneMappers::GetLuminanceValue(bool hasDisplayMetadata,
                                       const AVMasteringDisplayMetadata& displayMetadata,
                                       bool hasLightMetadata,
@@ -52,3 +105,76 @@ float CToneMappers::GetLuminanceValue(bool hasDisplayMetadata,
 
   return lum1;
 }
+
+void CToneMappers::Map(const ToneMappingLutParams& params, std::array<float, 3>& rgb)
+{
+  if (params.colorConversion)
+  {
+    std::array<float, 3> lin;
+    for (int i = 0; i < 3; ++i)
+      lin[i] = std::pow(std::max(rgb[i], 0.0f), params.gammaSrc);
+
+    // the matrix is uploaded untransposed, so the shader sees it column major
+    for (int i = 0; i < 3; ++i)
+    {
+      const float v = params.primMat[0][i] * lin[0] + params.primMat[1][i] * lin[1] +
+                      params.primMat[2][i] * lin[2];
+      rgb[i] = std::pow(std::max(v, 0.0f), params.gammaDstInv);
+    }
+  }
+
+  switch (params.method)
+  {
+    case VS_TONEMAPMETHOD_REINHARD:
+    {
+      const float luma = params.coefsDst[0] * rgb[0] + params.coefsDst[1] * rgb[1] +
+                         params.coefsDst[2] * rgb[2];
+      if (luma <= 0.0f)
+        break;
+      const float scale = Reinhard(luma, params.toneP1) / luma;
+      for (float& c : rgb)
+        c *= scale;
+      break;
+    }
+    case VS_TONEMAPMETHOD_ACES:
+    {
+      const float scale = (10000.0f / params.luminance) * (2.0f / params.toneP1);
+      for (float& c : rgb)
+        c = std::pow(Aces(InversePQ(c) * scale) * (1.24f / params.toneP1), 0.27f);
+      break;
+    }
+    case VS_TONEMAPMETHOD_HABLE:
+    {
+      const float wp = params.luminance / 100.0f;
+      const float white = Hable(wp);
+      for (float& c : rgb)
+        c = std::pow(std::max(Hable(InversePQ(c) * params.toneP1 * wp) / white, 0.0f),
+                     1.0f / 2.2f);
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+std::vector<float> CToneMappers::BuildLut(const ToneMappingLutParams& params, int size)
+{
+  std::vector<float> lut(static_cast<size_t>(size) * size * size * 3);
+  const float step = 1.0f / static_cast<float>(size - 1);
+
+  auto out = lut.begin();
+  for (int b = 0; b < size; ++b)
+  {
+    for (int g = 0; g < size; ++g)
+    {
+      for (int r = 0; r < size; ++r)
+      {
+        std::array<float, 3> rgb = {r * step, g * step, b * step};
+        Map(params, rgb);
+        out = std::copy(rgb.begin(), rgb.end(), out);
+      }
+    }
+  }
+
+  return lut;
+}
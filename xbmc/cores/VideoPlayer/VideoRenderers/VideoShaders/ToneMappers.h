@@ -8,11 +8,36 @@
 
 #pragma once
 
+#include "ConversionMatrix.h"
+#include "cores/VideoSettings.h"
+
+#include <vector>
+
 extern "C"
 {
 #include <libavutil/mastering_display_metadata.h>
 }
 
+/*!
+ * \brief Inputs of the gamut conversion and tone mapping stage of the yuv2rgb shaders.
+ * Two equal parameter sets produce the same LUT, which is what the renderers use to
+ * decide when a baked LUT is stale.
+ */
+struct ToneMappingLutParams
+{
+  ETONEMAPMETHOD method = VS_TONEMAPMETHOD_OFF;
+  bool colorConversion = false;
+  std::array<std::array<float, 3>, 3> primMat{{}};
+  float gammaSrc = 1.0f;
+  float gammaDstInv = 1.0f;
+  Matrix3x1 coefsDst{};
+  float toneP1 = 1.0f;
+  float luminance = 100.0f;
+
+  bool operator==(const ToneMappingLutParams& other) const;
+  bool operator!=(const ToneMappingLutParams& other) const { return !(*this == other); }
+};
+
 class CToneMappers
 {
 public:
@@ -20,4 +45,19 @@ public:
                                  const AVMasteringDisplayMetadata& displayMetadata,
                                  bool hasLightMetadata,
                                  const AVContentLightMetadata& lightMetadata);
+
+  /*!
+   * \brief Bake gamut conversion and tone mapping into a 3D LUT.
+   * The LUT is indexed by the non-linear rgb coming out of the yuv matrix and follows the
+   * math of gl_tonemap.glsl, so a single texture fetch can replace the per pixel evaluation.
+   * \param params conversion and tone mapping inputs
+   * \param size number of grid points per axis
+   * \return size^3 rgb float triplets, red varying fastest
+   */
+  static std::vector<float> BuildLut(const ToneMappingLutParams& params, int size);
+
+  static constexpr int LUT_SIZE = 64;
+
+private:
+  static void Map(const ToneMappingLutParams& params, std::array<float, 3>& rgb);
 };
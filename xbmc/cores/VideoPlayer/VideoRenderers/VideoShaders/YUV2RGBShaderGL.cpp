@@ -12,7 +12,6 @@
 #include "../RenderFlags.h"
 #include "ConvolutionKernels.h"
 #include "ServiceBroker.h"
-#include "ToneMappers.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/GLUtils.h"
@@ -95,7 +94,12 @@ BaseYUV2RGBGLSLShader::BaseYUV2RGBGLSLShader(bool rect,
     m_toneMapping = true;
     m_toneMappingMethod = toneMapMethod;
     m_defines += "#define XBMC_TONE_MAPPING\n";
-    if (toneMapMethod == VS_TONEMAPMETHOD_REINHARD)
+    // gamut conversion and tone mapping are baked into a 3D LUT, which saves the
+    // pow/matrix/curve math per pixel and makes method or metadata changes a LUT rebuild
+    m_toneMappingLut = m_colorConversion;
+    if (m_toneMappingLut)
+      m_defines += "#define KODI_TONE_MAPPING_LUT\n";
+    else if (toneMapMethod == VS_TONEMAPMETHOD_REINHARD)
       m_defines += "#define KODI_TONE_MAPPING_REINHARD\n";
     else if (toneMapMethod == VS_TONEMAPMETHOD_ACES)
       m_defines += "#define KODI_TONE_MAPPING_ACES\n";
@@ -138,6 +142,8 @@ void BaseYUV2RGBGLSLShader::OnCompiledAndLinked()
   m_hCoefsDst = glGetUniformLocation(ProgramHandle(), "m_coefsDst");
   m_hToneP1 = glGetUniformLocation(ProgramHandle(), "m_toneP1");
   m_hLuminance = glGetUniformLocation(ProgramHandle(), "m_luminance");
+  m_hToneLut = glGetUniformLocation(ProgramHandle(), "m_toneLut");
+  m_hToneLutSize = glGetUniformLocation(ProgramHandle(), "m_toneLutSize");
   VerifyGLState();
 
   if (m_glslOutput)
@@ -163,49 +169,31 @@ bool BaseYUV2RGBGLSLShader::OnEnabled()
   glUniformMatrix4fv(m_hModel, 1, GL_FALSE, m_model);
   glUniform1f(m_hAlpha, m_alpha);
 
-  if (m_colorConversion)
+  if (m_toneMappingLut)
   {
-    Matrix3 primMat = m_convMatrix.GetPrimMat();
-    glUniformMatrix3fv(m_hPrimMat, 1, GL_FALSE, reinterpret_cast<GLfloat*>(primMat.ToRaw()));
-    glUniform1f(m_hGammaSrc, m_convMatrix.GetGammaSrc());
-    glUniform1f(m_hGammaDstInv, 1 / m_convMatrix.GetGammaDst());
-  }
+    UpdateToneMappingLut(GetToneMappingParams());
 
-  if (m_toneMapping)
+    glActiveTexture(GL_TEXTURE6);
+    glBindTexture(GL_TEXTURE_3D, m_toneMappingLutTex);
+    glUniform1i(m_hToneLut, 6);
+    glUniform1f(m_hToneLutSize, CToneMappers::LUT_SIZE);
+    glActiveTexture(GL_TEXTURE0);
+  }
+  else if (m_colorConversion || m_toneMapping)
   {
-    if (m_toneMappingMethod == VS_TONEMAPMETHOD_REINHARD)
-    {
-      float param = 0.7;
-      if (m_hasLightMetadata)
-        param = log10(100) / log10(m_lightMetadata.MaxCLL);
-      else if (m_hasDisplayMetadata && m_displayMetadata.has_luminance)
-        param = log10(100) / log10(m_displayMetadata.max_luminance.num/m_displayMetadata.max_luminance.den);
-
-      // Sanity check
-      if (param < 0.1f || param > 5.0f)
-        param = 0.7f;
-
-      param *= m_toneMappingParam;
-
-      Matrix3x1 coefs = m_convMatrix.GetRGBYuvCoefs(AVColorSpace::AVCOL_SPC_BT709);
-      glUniform3f(m_hCoefsDst, coefs[0], coefs[1], coefs[2]);
-      glUniform1f(m_hToneP1, param);
-    }
-    else if (m_toneMappingMethod == VS_TONEMAPMETHOD_ACES)
+    const ToneMappingLutParams params = GetToneMappingParams();
+    if (m_colorConversion)
     {
-      const float lumin = CToneMappers::GetLuminanceValue(m_hasDisplayMetadata, m_displayMetadata,
-                                                          m_hasLightMetadata, m_lightMetadata);
-      glUniform1f(m_hLuminance, lumin);
-      glUniform1f(m_hToneP1, m_toneMappingParam);
-    }
-    else if (m_toneMappingMethod == VS_TONEMAPMETHOD_HABLE)
-    {
-      const float lumin = CToneMappers::GetLuminanceValue(m_hasDisplayMetadata, m_displayMetadata,
-                                                          m_hasLightMetadata, m_lightMetadata);
-      const float param = (10000.0f / lumin) * (2.0f / m_toneMappingParam);
-      glUniform1f(m_hLuminance, lumin);
-      glUniform1f(m_hToneP1, param);
+      Matrix3 primMat(params.primMat);
+      glUniformMatrix3fv(m_hPrimMat, 1, GL_FALSE, reinterpret_cast<GLfloat*>(primMat.ToRaw()));
+      glUniform1f(m_hGammaSrc, params.gammaSrc);
+      glUniform1f(m_hGammaDstInv, params.gammaDstInv);
     }
+    if (m_toneMappingMethod == VS_TONEMAPMETHOD_REINHARD)
+      glUniform3f(m_hCoefsDst, params.coefsDst[0], params.coefsDst[1], params.coefsDst[2]);
+    else
+      glUniform1f(m_hLuminance, params.luminance);
+    glUniform1f(m_hToneP1, params.toneP1);
   }
 
   VerifyGLState();
@@ -222,10 +210,92 @@ void BaseYUV2RGBGLSLShader::OnDisabled()
 
 void BaseYUV2RGBGLSLShader::Free()
 {
+  if (m_toneMappingLutTex)
+  {
+    glDeleteTextures(1, &m_toneMappingLutTex);
+    m_toneMappingLutTex = 0;
+  }
+
   if (m_glslOutput)
     m_glslOutput->Free();
 }
 
+ToneMappingLutParams BaseYUV2RGBGLSLShader::GetToneMappingParams()
+{
+  ToneMappingLutParams params;
+
+  if (m_colorConversion)
+  {
+    params.colorConversion = true;
+    params.primMat = m_convMatrix.GetPrimMat().Get();
+    params.gammaSrc = m_convMatrix.GetGammaSrc();
+    params.gammaDstInv = 1 / m_convMatrix.GetGammaDst();
+  }
+
+  if (!m_toneMapping)
+    return params;
+
+  params.method = m_toneMappingMethod;
+  if (m_toneMappingMethod == VS_TONEMAPMETHOD_REINHARD)
+  {
+    float param = 0.7;
+    if (m_hasLightMetadata)
+      param = log10(100) / log10(m_lightMetadata.MaxCLL);
+    else if (m_hasDisplayMetadata && m_displayMetadata.has_luminance)
+      param = log10(100) / log10(m_displayMetadata.max_luminance.num/m_displayMetadata.max_luminance.den);
+
+    // Sanity check
+    if (param < 0.1f || param > 5.0f)
+      param = 0.7f;
+
+    params.toneP1 = param * m_toneMappingParam;
+    params.coefsDst = m_convMatrix.GetRGBYuvCoefs(AVColorSpace::AVCOL_SPC_BT709);
+  }
+  else if (m_toneMappingMethod == VS_TONEMAPMETHOD_ACES)
+  {
+    params.luminance = CToneMappers::GetLuminanceValue(m_hasDisplayMetadata, m_displayMetadata,
+                                                       m_hasLightMetadata, m_lightMetadata);
+    params.toneP1 = m_toneMappingParam;
+  }
+  else if (m_toneMappingMethod == VS_TONEMAPMETHOD_HABLE)
+  {
+    params.luminance = CToneMappers::GetLuminanceValue(m_hasDisplayMetadata, m_displayMetadata,
+                                                       m_hasLightMetadata, m_lightMetadata);
+    params.toneP1 = (10000.0f / params.luminance) * (2.0f / m_toneMappingParam);
+  }
+
+  return params;
+}
+
+void BaseYUV2RGBGLSLShader::UpdateToneMappingLut(const ToneMappingLutParams& params)
+{
+  if (m_toneMappingLutTex && params == m_toneMappingLutParams)
+    return;
+
+  const std::vector<float> lut = CToneMappers::BuildLut(params, CToneMappers::LUT_SIZE);
+
+  if (!m_toneMappingLutTex)
+    glGenTextures(1, &m_toneMappingLutTex);
+
+  glActiveTexture(GL_TEXTURE6);
+  glBindTexture(GL_TEXTURE_3D, m_toneMappingLutTex);
+  glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+  glTexImage3D(GL_TEXTURE_3D, 0, GL_RGB16F, CToneMappers::LUT_SIZE, CToneMappers::LUT_SIZE,
+               CToneMappers::LUT_SIZE, 0, GL_RGB, GL_FLOAT, lut.data());
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+  glActiveTexture(GL_TEXTURE0);
+  VerifyGLState();
+
+  m_toneMappingLutParams = params;
+  CLog::Log(LOGDEBUG, "GL: rebuilt tone mapping LUT, method {} peak {:.0f} nits", params.method,
+            params.luminance);
+}
+
 void BaseYUV2RGBGLSLShader::SetColParams(AVColorSpace colSpace, int bits, bool limited,
                                         int textureBits)
 {
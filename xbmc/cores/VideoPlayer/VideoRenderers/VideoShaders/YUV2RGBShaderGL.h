@@ -11,6 +11,7 @@
 #include "ConversionMatrix.h"
 #include "GLSLOutput.h"
 #include "ShaderFormats.h"
+#include "ToneMappers.h"
 #include "cores/VideoSettings.h"
 #include "guilib/Shader.h"
 #include "utils/TransformMatrix.h"
@@ -71,6 +72,8 @@ protected:
   bool OnEnabled() override;
   void OnDisabled() override;
   void Free();
+  ToneMappingLutParams GetToneMappingParams();
+  void UpdateToneMappingLut(const ToneMappingLutParams& params);
 
   bool m_convertFullRange;
   EShaderFormat m_format;
@@ -86,6 +89,9 @@ protected:
   float m_toneMappingParam = 1.0;
 
   bool m_colorConversion{false};
+  bool m_toneMappingLut{false};
+  GLuint m_toneMappingLutTex = 0;
+  ToneMappingLutParams m_toneMappingLutParams;
 
   float m_black;
   float m_contrast;
@@ -113,6 +119,8 @@ protected:
   GLint m_hToneP1 = -1;
   GLint m_hCoefsDst = -1;
   GLint m_hLuminance = -1;
+  GLint m_hToneLut = -1;
+  GLint m_hToneLutSize = -1;
 
   // vertex shader attribute handles
   GLint m_hVertex = -1;
@@ -0,0 +1,43 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/VideoPlayer/Buffers/VideoBuffer.h"
+
+#include <limits>
+
+#include <gtest/gtest.h>
+
+TEST(TestVideoBuffer, SizeClassBoundaries)
+{
+  // small sizes are classes of their own
+  EXPECT_EQ(0, CVideoBufferManager::GetSizeClass(0));
+  EXPECT_EQ(7, CVideoBufferManager::GetSizeClass(7));
+  EXPECT_EQ(15, CVideoBufferManager::GetSizeClass(15));
+  EXPECT_EQ(16, CVideoBufferManager::GetSizeClass(16));
+  EXPECT_EQ(18, CVideoBufferManager::GetSizeClass(17));
+  EXPECT_EQ(1024, CVideoBufferManager::GetSizeClass(1000));
+  EXPECT_EQ(1024, CVideoBufferManager::GetSizeClass(1024));
+  EXPECT_EQ(1152, CVideoBufferManager::GetSizeClass(1025));
+
+  // a size class is never smaller than the size and at most an eighth larger
+  for (int size = 8; size < (1 << 30); size = size * 3 / 2 + 1)
+  {
+    const int sizeClass = CVideoBufferManager::GetSizeClass(size);
+    EXPECT_GE(sizeClass, size);
+    EXPECT_LE(sizeClass - size, size / 8);
+    EXPECT_EQ(sizeClass, CVideoBufferManager::GetSizeClass(sizeClass));
+  }
+}
+
+TEST(TestVideoBuffer, SizeClassHuge)
+{
+  constexpr int max = std::numeric_limits<int>::max();
+  EXPECT_EQ(max, CVideoBufferManager::GetSizeClass(max));
+  EXPECT_EQ(max, CVideoBufferManager::GetSizeClass(max - 1));
+  EXPECT_EQ(1 << 30, CVideoBufferManager::GetSizeClass(1 << 30));
+}
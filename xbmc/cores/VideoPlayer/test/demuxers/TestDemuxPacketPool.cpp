@@ -0,0 +1,48 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/VideoPlayer/DVDDemuxers/DemuxPacketPool.h"
+
+#include <stdint.h>
+
+#include <gtest/gtest.h>
+
+TEST(TestDemuxPacketPool, RecyclesSameSizeClass)
+{
+  CDemuxPacketPool pool;
+
+  uint8_t* first = pool.Allocate(1500);
+  ASSERT_NE(nullptr, first);
+  EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(first) % CDemuxPacketPool::ALIGNMENT);
+  pool.Free(first);
+  EXPECT_EQ(2048u, pool.GetStats().pooledBytes);
+
+  // any size rounding up to the same class gets the buffer back
+  uint8_t* second = pool.Allocate(2000);
+  EXPECT_EQ(first, second);
+  pool.Free(second);
+
+  const CDemuxPacketPool::Stats stats = pool.GetStats();
+  EXPECT_EQ(2u, stats.allocations);
+  EXPECT_EQ(1u, stats.recycled);
+}
+
+TEST(TestDemuxPacketPool, LargeBuffersAreNotPooled)
+{
+  CDemuxPacketPool pool;
+
+  uint8_t* data = pool.Allocate(16 * 1024 * 1024);
+  ASSERT_NE(nullptr, data);
+  data[16 * 1024 * 1024 - 1] = 0;
+  pool.Free(data);
+  EXPECT_EQ(0u, pool.GetStats().pooledBytes);
+
+  pool.Free(pool.Allocate(100));
+  pool.Trim();
+  EXPECT_EQ(0u, pool.GetStats().pooledBytes);
+}
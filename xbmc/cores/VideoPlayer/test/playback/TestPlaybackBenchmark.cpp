@@ -0,0 +1,100 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/VideoPlayer/PlaybackBenchmark.h"
+#include "utils/Variant.h"
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+TEST(TestPlaybackBenchmark, Histogram)
+{
+  CPlaybackBenchmark::CHistogram histogram;
+  for (int i = 0; i < 98; i++)
+    histogram.Add(3.0);
+  histogram.Add(0.1);
+  histogram.Add(1000.0);
+
+  EXPECT_EQ(100u, histogram.GetCount());
+  EXPECT_DOUBLE_EQ((98 * 3.0 + 0.1 + 1000.0) / 100, histogram.GetMean());
+  EXPECT_DOUBLE_EQ(1000.0, histogram.GetMax());
+  // percentiles are the upper limit of the bucket they fall in
+  EXPECT_DOUBLE_EQ(4.0, histogram.GetPercentile(50));
+  EXPECT_DOUBLE_EQ(4.0, histogram.GetPercentile(99));
+  EXPECT_DOUBLE_EQ(1000.0, histogram.GetPercentile(100));
+
+  CVariant value;
+  histogram.Serialize(value);
+  ASSERT_EQ(CPlaybackBenchmark::CHistogram::BUCKET_LIMITS_MS.size() + 1, value["buckets"].size());
+  EXPECT_EQ(1u, value["buckets"][0]["count"].asUnsignedInteger());
+  EXPECT_EQ(98u, value["buckets"][4]["count"].asUnsignedInteger());
+  EXPECT_FALSE(value["buckets"][value["buckets"].size() - 1].isMember("limit"));
+  EXPECT_EQ(1u, value["buckets"][value["buckets"].size() - 1]["count"].asUnsignedInteger());
+}
+
+TEST(TestPlaybackBenchmark, Report)
+{
+  CPlaybackBenchmark::SetEnabled(true);
+  CPlaybackBenchmark::Reset("test://movie.mkv");
+
+  CPlaybackBenchmark::AddDemuxRead(1000, 1ms);
+  CPlaybackBenchmark::AddDemuxRead(3000, 1ms);
+  CPlaybackBenchmark::AddDecodedFrame(10ms);
+  CPlaybackBenchmark::AddDecodedFrame(10ms);
+  CPlaybackBenchmark::AddRenderedFrame(2ms);
+  CPlaybackBenchmark::AddSyncError(-5.0);
+  CPlaybackBenchmark::AddSyncError(3.0);
+  CPlaybackBenchmark::AddDroppedFrame(CPlaybackBenchmark::DropSource::DECODER);
+  CPlaybackBenchmark::AddDroppedFrame(CPlaybackBenchmark::DropSource::RENDERER);
+  CPlaybackBenchmark::AddDroppedFrame(CPlaybackBenchmark::DropSource::RENDERER);
+
+  CPlaybackBenchmark::SetEnabled(false);
+  // not recorded while disabled
+  CPlaybackBenchmark::AddDecodedFrame(10ms);
+
+  CVariant report;
+  CPlaybackBenchmark::GetReport(report);
+  EXPECT_EQ("test://movie.mkv", report["file"].asString());
+  EXPECT_EQ(2u, report["demux"]["packets"].asUnsignedInteger());
+  EXPECT_EQ(4000u, report["demux"]["bytes"].asUnsignedInteger());
+  EXPECT_DOUBLE_EQ(2000000.0, report["demux"]["readrate"].asDouble());
+  EXPECT_EQ(2u, report["decode"]["frames"].asUnsignedInteger());
+  // the rate of delivered frames, not derived from the time spent in the decoder
+  EXPECT_DOUBLE_EQ(2 / report["duration"].asDouble(), report["decode"]["fps"].asDouble());
+  EXPECT_DOUBLE_EQ(10.0, report["decode"]["calltime"]["mean"].asDouble());
+  EXPECT_EQ(1u, report["render"]["frames"].asUnsignedInteger());
+  EXPECT_EQ(0u, report["render"]["interval"]["count"].asUnsignedInteger());
+  EXPECT_DOUBLE_EQ(-1.0, report["avsync"]["bias"].asDouble());
+  EXPECT_DOUBLE_EQ(4.0, report["avsync"]["error"]["mean"].asDouble());
+  EXPECT_EQ(1u, report["dropped"]["decoder"].asUnsignedInteger());
+  EXPECT_EQ(2u, report["dropped"]["renderer"].asUnsignedInteger());
+}
+
+TEST(TestPlaybackBenchmark, PlaylistItems)
+{
+  CPlaybackBenchmark::SetEnabled(true);
+  CPlaybackBenchmark::Reset("test://first.mkv");
+  CPlaybackBenchmark::AddDecodedFrame(10ms);
+  CPlaybackBenchmark::Reset("test://second.mkv");
+  CPlaybackBenchmark::AddDecodedFrame(10ms);
+  CPlaybackBenchmark::AddDecodedFrame(10ms);
+  CPlaybackBenchmark::SetEnabled(false);
+
+  CVariant report;
+  CPlaybackBenchmark::GetReport(report);
+  EXPECT_EQ("test://second.mkv", report["file"].asString());
+  EXPECT_EQ(2u, report["decode"]["frames"].asUnsignedInteger());
+
+  // the earlier items are kept in the order they were played
+  const CVariant& previous = report["previous"];
+  ASSERT_GE(previous.size(), 1u);
+  const CVariant& first = previous[previous.size() - 1];
+  EXPECT_EQ("test://first.mkv", first["file"].asString());
+  EXPECT_EQ(1u, first["decode"]["frames"].asUnsignedInteger());
+}
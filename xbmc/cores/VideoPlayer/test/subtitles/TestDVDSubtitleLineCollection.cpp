@@ -0,0 +1,50 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/VideoPlayer/DVDCodecs/Overlay/DVDOverlay.h"
+#include "cores/VideoPlayer/DVDSubtitles/DVDSubtitleLineCollection.h"
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+std::shared_ptr<CDVDOverlay> CreateOverlay(double start, double stop)
+{
+  auto overlay = std::make_shared<CDVDOverlay>(DVDOVERLAY_TYPE_TEXT);
+  overlay->iPTSStartTime = start;
+  overlay->iPTSStopTime = stop;
+  return overlay;
+}
+} // namespace
+
+TEST(TestDVDSubtitleLineCollection, Get)
+{
+  CDVDSubtitleLineCollection collection;
+  const auto c = CreateOverlay(30, 40);
+  const auto a = CreateOverlay(0, 100);
+  const auto b = CreateOverlay(10, 20);
+  collection.Add(c);
+  collection.Add(a);
+  collection.Add(b);
+  collection.Sort();
+
+  // the overlay nested in A has stopped before 35
+  EXPECT_EQ(a, collection.Get(35));
+  EXPECT_EQ(c, collection.Get(35));
+  EXPECT_EQ(nullptr, collection.Get(35));
+
+  collection.Reset();
+  EXPECT_EQ(a, collection.Get(15));
+  EXPECT_EQ(b, collection.Get(15));
+  EXPECT_EQ(c, collection.Get(15));
+
+  collection.Reset();
+  EXPECT_EQ(nullptr, collection.Get(101));
+}
@@ -30,6 +30,8 @@
 #include "utils/log.h"
 #include "video/Bookmark.h"
 
+#include <algorithm>
+#include <chrono>
 #include <memory>
 #include <mutex>
 
@@ -37,6 +39,7 @@ using namespace KODI;
 using namespace std::chrono_literals;
 
 #define TIME_TO_CACHE_NEXT_FILE 5000 /* 5 seconds before end of song, start caching the next song */
+#define MAX_TIME_TO_CACHE_NEXT_FILE 30000 /* never open the next song more than 30 seconds ahead */
 #define FAST_XFADE_TIME           80 /* 80 milliseconds */
 #define MAX_SKIP_XFADE_TIME     2000 /* max 2 seconds crossfade on track skip */
 
@@ -325,6 +328,8 @@ bool PAPlayer::QueueNextFileEx(const CFileItem &file, bool fadeIn)
     starttime = 0; // No resume point
   }
 
+  const auto openStart = std::chrono::steady_clock::now();
+
   if (!si->m_decoder.Create(file, si->m_startOffset))
   {
     CLog::Log(LOGWARNING, "PAPlayer::QueueNextFileEx - Failed to create the decoder");
@@ -360,6 +365,10 @@ bool PAPlayer::QueueNextFileEx(const CFileItem &file, bool fadeIn)
     CThread::Sleep(1ms);
   }
 
+  m_openTimeMS = static_cast<unsigned int>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                                               std::chrono::steady_clock::now() - openStart)
+                                               .count());
+
   // set m_upcomingCrossfadeMS depending on type of file and user settings
   UpdateCrossfadeTime(*si->m_fileItem);
 
@@ -404,10 +413,7 @@ bool PAPlayer::QueueNextFileEx(const CFileItem &file, bool fadeIn)
   si->m_prepareNextAtFrame = 0;
   // cd drives don't really like it to be crossfaded or prepared
   if (!MUSIC::IsCDDA(file))
-  {
-    if (streamTotalTime >= TIME_TO_CACHE_NEXT_FILE + m_defaultCrossfadeMS)
-      si->m_prepareNextAtFrame = (int)((streamTotalTime - TIME_TO_CACHE_NEXT_FILE - m_defaultCrossfadeMS) * si->m_audioFormat.m_sampleRate / 1000.0f);
-  }
+    si->m_prepareNextAtFrame = GetPrepareNextAtFrame(si, streamTotalTime);
 
   if (m_currentStream && ((m_currentStream->m_audioFormat.m_dataFormat == AE_FMT_RAW) || (si->m_audioFormat.m_dataFormat == AE_FMT_RAW)))
   {
@@ -445,6 +451,21 @@ bool PAPlayer::QueueNextFileEx(const CFileItem &file, bool fadeIn)
   return true;
 }
 
+int PAPlayer::GetPrepareNextAtFrame(const StreamInfo* si, int64_t streamTotalTime) const
+{
+  if (streamTotalTime < TIME_TO_CACHE_NEXT_FILE + m_defaultCrossfadeMS)
+    return 0;
+
+  // slow sources (network shares, spun down disks) need longer than the default lead to
+  // open the next song and fill its decoder, so give them a few times what the last open took
+  int64_t lead = std::max<int64_t>(TIME_TO_CACHE_NEXT_FILE, 3 * static_cast<int64_t>(m_openTimeMS));
+  lead = std::min<int64_t>(lead, MAX_TIME_TO_CACHE_NEXT_FILE);
+  lead = std::min<int64_t>(lead, streamTotalTime - m_defaultCrossfadeMS);
+
+  const int64_t prepareAt = streamTotalTime - lead - m_defaultCrossfadeMS;
+  return std::max(1, static_cast<int>(prepareAt * si->m_audioFormat.m_sampleRate / 1000.0f));
+}
+
 void PAPlayer::UpdateStreamInfoPlayNextAtFrame(StreamInfo *si, unsigned int crossFadingTime)
 {
   // if no crossfading or cue sheet, wait for eof
@@ -470,7 +491,7 @@ inline bool PAPlayer::PrepareStream(StreamInfo *si)
   AEAudioFormat format = si->m_audioFormat;
   si->m_stream = CServiceBroker::GetActiveAE()->MakeStream(
     format,
-    AESTREAM_PAUSED
+    AESTREAM_PAUSED | AESTREAM_HIGH_LATENCY
   );
 
   if (!si->m_stream)
@@ -810,9 +831,7 @@ inline bool PAPlayer::ProcessStream(StreamInfo *si, double &freeBufferTime)
         streamTotalTime = si->m_endOffset - si->m_startOffset;
 
       // calculate time when to prepare next stream
-      si->m_prepareNextAtFrame = 0;
-      if (streamTotalTime >= TIME_TO_CACHE_NEXT_FILE + m_defaultCrossfadeMS)
-        si->m_prepareNextAtFrame = (int)((streamTotalTime - TIME_TO_CACHE_NEXT_FILE - m_defaultCrossfadeMS) * si->m_audioFormat.m_sampleRate / 1000.0f);
+      si->m_prepareNextAtFrame = GetPrepareNextAtFrame(si, streamTotalTime);
 
       si->m_prepareTriggered = false;
       si->m_playNextAtFrame = 0;
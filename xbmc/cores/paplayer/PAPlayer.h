@@ -131,6 +131,7 @@ private:
   CEvent              m_jobEvent;
   int64_t m_newForcedPlayerTime = -1;
   int64_t m_newForcedTotalTime = -1;
+  std::atomic<unsigned int> m_openTimeMS{0}; /* how long opening the last song took */
   std::unique_ptr<CProcessInfo> m_processInfo;
 
   bool QueueNextFileEx(const CFileItem &file, bool fadeIn);
@@ -144,6 +145,7 @@ private:
   int64_t GetTotalTime64();
   void UpdateCrossfadeTime(const CFileItem& file);
   void UpdateStreamInfoPlayNextAtFrame(StreamInfo *si, unsigned int crossFadingTime);
+  int GetPrepareNextAtFrame(const StreamInfo* si, int64_t streamTotalTime) const;
   void UpdateGUIData(StreamInfo *si);
   int64_t GetTimeInternal();
   bool SetTimeInternal(int64_t time);
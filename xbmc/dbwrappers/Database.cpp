@@ -8,6 +8,7 @@
 
 #include "Database.h"
 
+#include "DatabaseConnectionPool.h"
 #include "DatabaseManager.h"
 #include "DbUrl.h"
 #include "ServiceBroker.h"
@@ -434,6 +435,51 @@ bool CDatabase::ResultQuery(const std::string& strQuery) const
   return bReturn;
 }
 
+bool CDatabase::ExecuteQuery(const std::string& strQuery, const dbiplus::BindList& params)
+{
+  try
+  {
+    if (nullptr == m_pDB)
+      return false;
+    if (nullptr == m_pDS)
+      return false;
+
+    if (m_multipleExecute)
+    {
+      m_multipleQueries.push_back(m_pDS->bind_params(strQuery, params));
+      return true;
+    }
+
+    m_pDS->exec(strQuery, params);
+    return true;
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "Failed to execute query '{}'", strQuery);
+  }
+
+  return false;
+}
+
+bool CDatabase::ResultQuery(const std::string& strQuery, const dbiplus::BindList& params) const
+{
+  try
+  {
+    if (nullptr == m_pDB)
+      return false;
+    if (nullptr == m_pDS)
+      return false;
+
+    return m_pDS->query(strQuery, params);
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "Failed to execute query '{}'", strQuery);
+  }
+
+  return false;
+}
+
 bool CDatabase::QueueInsertQuery(const std::string& strQuery)
 {
   if (strQuery.empty())
@@ -455,6 +501,35 @@ bool CDatabase::QueueInsertQuery(const std::string& strQuery)
   return true;
 }
 
+bool CDatabase::QueueInsertQuery(const std::string& strQuery, const dbiplus::BindList& params)
+{
+  if (strQuery.empty())
+    return false;
+
+  try
+  {
+    if (!m_bMultiInsert)
+    {
+      if (nullptr == m_pDB)
+        return false;
+      if (nullptr == m_pDS2)
+        return false;
+
+      m_bMultiInsert = true;
+      m_pDS2->insert();
+    }
+
+    m_pDS2->add_insert_sql(strQuery, params);
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "Failed to queue query '{}'", strQuery);
+    return false;
+  }
+
+  return true;
+}
+
 bool CDatabase::CommitInsertQueries()
 {
   bool bReturn = true;
@@ -600,6 +675,17 @@ CDatabase::ConnectionState CDatabase::Connect(const std::string& dbName,
 #if defined(HAS_MYSQL) || defined(HAS_MARIADB)
   else if (dbSettings.type == "mysql")
   {
+    // reuse an idle connection with the same settings, it is already set up and known to exist
+    const std::string poolKey{CDatabaseConnectionPool::MakeKey(dbName, dbSettings)};
+    m_pDB = CDatabaseConnectionPool::GetInstance().Acquire(poolKey);
+    if (m_pDB)
+    {
+      m_pDS.reset(m_pDB->CreateDataset());
+      m_pDS2.reset(m_pDB->CreateDataset());
+      m_poolKey = poolKey;
+      m_openCount = 1;
+      return ConnectionState::STATE_CONNECTED;
+    }
     m_pDB = std::make_unique<MysqlDatabase>();
   }
 #endif
@@ -677,6 +763,9 @@ CDatabase::ConnectionState CDatabase::Connect(const std::string& dbName,
     return ConnectionState::STATE_ERROR;
   }
 
+  if (dbSettings.type == "mysql")
+    m_poolKey = CDatabaseConnectionPool::MakeKey(dbName, dbSettings);
+
   m_openCount = 1; // our database is open
   return ConnectionState::STATE_CONNECTED;
 }
@@ -712,10 +801,21 @@ void CDatabase::Close()
     return;
   if (nullptr != m_pDS)
     m_pDS->close();
-  m_pDB->disconnect();
-  m_pDB.reset();
+  if (nullptr != m_pDS2)
+    m_pDS2->close();
   m_pDS.reset();
   m_pDS2.reset();
+
+  if (!m_poolKey.empty())
+  {
+    // the pool disconnects it if it can't be reused
+    CDatabaseConnectionPool::GetInstance().Release(m_poolKey, std::move(m_pDB));
+    m_poolKey.clear();
+    return;
+  }
+
+  m_pDB->disconnect();
+  m_pDB.reset();
 }
 
 bool CDatabase::Compress(bool bForce /* =true */)
@@ -850,6 +950,226 @@ bool CDatabase::BuildSQL(std::string_view strQuery, const Filter& filter, std::s
   return true;
 }
 
+void CDatabase::CreateFullTextIndex(const std::string& table,
+                                    const std::string& idColumn,
+                                    const std::vector<std::string>& columns)
+{
+  if (!m_sqlite)
+    return;
+
+  const std::string index = table + "_fts";
+  try
+  {
+    // recreate it in case the columns changed, its triggers are gone already
+    m_pDS->exec(StringUtils::Format("DROP TABLE IF EXISTS {}", index));
+    m_pDS->exec(StringUtils::Format(
+        "CREATE VIRTUAL TABLE {} USING fts5({}, content='{}', content_rowid='{}')", index,
+        StringUtils::Join(columns, ", "), table, idColumn));
+  }
+  catch (...)
+  {
+    CLog::Log(LOGINFO, "{}: full text search on {} is not available", __FUNCTION__, table);
+    return;
+  }
+
+  std::vector<std::string> newValues;
+  std::vector<std::string> oldValues;
+  for (const std::string& column : columns)
+  {
+    newValues.emplace_back("new." + column);
+    oldValues.emplace_back("old." + column);
+  }
+  const std::string insertNew =
+      StringUtils::Format("INSERT INTO {0}(rowid, {1}) VALUES (new.{2}, {3});", index,
+                          StringUtils::Join(columns, ", "), idColumn,
+                          StringUtils::Join(newValues, ", "));
+  const std::string deleteOld =
+      StringUtils::Format("INSERT INTO {0}({0}, rowid, {1}) VALUES ('delete', old.{2}, {3});",
+                          index, StringUtils::Join(columns, ", "), idColumn,
+                          StringUtils::Join(oldValues, ", "));
+
+  m_pDS->exec(StringUtils::Format("CREATE TRIGGER {}_insert AFTER INSERT ON {} BEGIN {} END",
+                                  index, table, insertNew));
+  m_pDS->exec(StringUtils::Format("CREATE TRIGGER {}_delete AFTER DELETE ON {} BEGIN {} END",
+                                  index, table, deleteOld));
+  m_pDS->exec(StringUtils::Format("CREATE TRIGGER {}_update AFTER UPDATE OF {} ON {} BEGIN {} {} END",
+                                  index, StringUtils::Join(columns, ", "), table, deleteOld,
+                                  insertNew));
+  m_pDS->exec(StringUtils::Format("INSERT INTO {0}({0}) VALUES ('rebuild')", index));
+  m_fullTextIndexes[table] = true;
+}
+
+std::string CDatabase::GetFullTextCondition(const std::string& table,
+                                            const std::string& idColumn,
+                                            const std::string& search)
+{
+  if (!m_sqlite)
+    return {};
+
+  const std::string index = table + "_fts";
+  auto it = m_fullTextIndexes.find(table);
+  if (it == m_fullTextIndexes.end())
+  {
+    // the index can't be used if this SQLite lacks FTS5, e.g. when the database was copied over
+    bool available = false;
+    try
+    {
+      std::unique_ptr<dbiplus::Dataset> ds(m_pDB->CreateDataset());
+      if (!GetSingleValue(PrepareSQL("SELECT name FROM sqlite_master WHERE type='table' AND "
+                                     "name='%s'",
+                                     index.c_str()),
+                          *ds)
+               .empty())
+        available = ds->query(StringUtils::Format("SELECT rowid FROM {} LIMIT 0", index));
+    }
+    catch (...)
+    {
+    }
+    it = m_fullTextIndexes.try_emplace(table, available).first;
+  }
+  if (!it->second)
+    return {};
+
+  // every word as a quoted prefix, which also keeps FTS5 operators in the search from applying
+  std::vector<std::string> terms;
+  for (std::string word : StringUtils::Split(search, " "))
+  {
+    StringUtils::Trim(word);
+    if (word.empty())
+      continue;
+    StringUtils::Replace(word, "\"", "\"\"");
+    terms.emplace_back("\"" + word + "\"*");
+  }
+  if (terms.empty())
+    return {};
+
+  return PrepareSQL("%s IN (SELECT rowid FROM %s WHERE %s MATCH '%s')", idColumn.c_str(),
+                    index.c_str(), index.c_str(), StringUtils::Join(terms, " ").c_str());
+}
+
+void CDatabase::CreateChangelogTable()
+{
+  CLog::Log(LOGINFO, "create changelog table");
+  // AUTOINCREMENT, as replacing the entry of an item must never hand out the number of the entry
+  // it replaces again. MySQL adds auto_increment to the primary key, and never reuses numbers.
+  m_pDS->exec(StringUtils::Format("CREATE TABLE changelog (sequence INTEGER PRIMARY KEY{}, "
+                                  "media_type TEXT, media_id INTEGER, action TEXT)",
+                                  m_sqlite ? " AUTOINCREMENT" : ""));
+  // the row locked by the triggers for the rest of the transaction
+  m_pDS->exec("CREATE TABLE changelog_lock (writes INTEGER)");
+  m_pDS->exec("INSERT INTO changelog_lock (writes) VALUES (0)");
+}
+
+void CDatabase::CreateChangelogAnalytics(const std::vector<ChangelogSource>& sources,
+                                         const std::vector<ChangelogLink>& links)
+{
+  // one entry per item, replaced by its next change
+  m_pDS->exec("CREATE UNIQUE INDEX ix_changelog_1 ON changelog (media_type(20), media_id)");
+
+  for (const ChangelogSource& source : sources)
+  {
+    const std::string newId = "new." + source.idColumn;
+    const std::string oldId = "old." + source.idColumn;
+    CreateChangelogTrigger("changelog_insert_" + source.table, "AFTER INSERT ON " + source.table,
+                           GetChangelogStatement(source.mediaType, newId, false));
+    CreateChangelogTrigger("changelog_update_" + source.table, "AFTER UPDATE ON " + source.table,
+                           GetChangelogStatement(source.mediaType, newId, false));
+    CreateChangelogTrigger("changelog_delete_" + source.table, "AFTER DELETE ON " + source.table,
+                           GetChangelogStatement(source.mediaType, oldId, true));
+  }
+
+  // the item is selected from its table, so the links deleted together with an item don't turn
+  // its removal into an update
+  for (const ChangelogLink& link : links)
+  {
+    const auto getStatements = [&sources, &link](const std::string& row)
+    {
+      std::string statements;
+      for (const ChangelogSource& source : sources)
+      {
+        if (!link.mediaType.empty() && link.mediaType != source.mediaType)
+          continue;
+
+        std::string from = StringUtils::Format("FROM {0} WHERE {0}.{1} = {2}.{3}", source.table,
+                                               source.idColumn, row, link.idColumn);
+        if (link.mediaType.empty())
+          from += StringUtils::Format(" AND {}.media_type = '{}'", row, source.mediaType);
+        statements += GetChangelogStatement(source.mediaType, source.idColumn, false, from);
+      }
+      return statements;
+    };
+
+    CreateChangelogTrigger("changelog_insert_" + link.table, "AFTER INSERT ON " + link.table,
+                           getStatements("new"));
+    CreateChangelogTrigger("changelog_update_" + link.table, "AFTER UPDATE ON " + link.table,
+                           getStatements("new"));
+    CreateChangelogTrigger("changelog_delete_" + link.table, "AFTER DELETE ON " + link.table,
+                           getStatements("old"));
+  }
+}
+
+void CDatabase::CreateChangelogTrigger(const std::string& name,
+                                       const std::string& event,
+                                       const std::string& statements)
+{
+  // on a shared MySQL database the row lock is held until the transaction commits, so a
+  // concurrent writer can't record a change with a higher number that is visible first
+  m_pDS->exec(StringUtils::Format("CREATE TRIGGER {} {} FOR EACH ROW BEGIN "
+                                  "UPDATE changelog_lock SET writes = writes + 1; {} END",
+                                  name, event, statements));
+}
+
+std::string CDatabase::GetChangelogStatement(const std::string& mediaType,
+                                             const std::string& id,
+                                             bool removed,
+                                             const std::string& from /* = "" */)
+{
+  return StringUtils::Format("REPLACE INTO changelog (media_type, media_id, action) "
+                             "SELECT '{}', {}, '{}'{};",
+                             mediaType, id, removed ? "remove" : "update",
+                             from.empty() ? "" : " " + from);
+}
+
+bool CDatabase::GetChanges(int64_t since,
+                           unsigned int limit,
+                           std::vector<Change>& changes,
+                           int64_t& latest)
+{
+  changes.clear();
+  latest = since;
+  if (!m_pDB || !m_pDS)
+    return false;
+
+  try
+  {
+    if (!m_pDS->query("SELECT MAX(sequence) FROM changelog"))
+      return false;
+    if (!m_pDS->eof() && !m_pDS->fv(0).get_isNull())
+      latest = m_pDS->fv(0).get_asInt64();
+    m_pDS->close();
+
+    if (!m_pDS->query(StringUtils::Format("SELECT sequence, media_type, media_id, action "
+                                          "FROM changelog WHERE sequence > {} "
+                                          "ORDER BY sequence LIMIT {}",
+                                          since, limit)))
+      return false;
+    while (!m_pDS->eof())
+    {
+      changes.emplace_back(Change{m_pDS->fv(0).get_asInt64(), m_pDS->fv(1).get_asString(),
+                                  m_pDS->fv(2).get_asInt(),
+                                  m_pDS->fv(3).get_asString() == "remove"});
+      m_pDS->next();
+    }
+    m_pDS->close();
+    return true;
+  }
+  catch (...)
+  {
+    CLog::Log(LOGERROR, "{} failed", __FUNCTION__);
+  }
+  return false;
+}
+
 bool CDatabase::BuildSQL(const std::string& strBaseDir,
                          const std::string& strQuery,
                          Filter& filter,
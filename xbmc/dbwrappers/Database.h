@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <map>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -17,6 +19,8 @@ namespace dbiplus
 {
 class Database;
 class Dataset;
+class field_value;
+using BindList = std::vector<field_value>;
 } // namespace dbiplus
 
 class DatabaseSettings;
@@ -183,6 +187,27 @@ public:
    */
   bool ResultQuery(const std::string& strQuery) const;
 
+  /*!
+   * @brief Execute a query with '?' placeholders that does not return any result.
+   *        The compiled statement is cached per connection where the backend supports it,
+   *        so repeated calls with the same query only bind the new values.
+   * @param strQuery The query to execute, not passed through PrepareSQL().
+   * @param params The values for the placeholders, in order.
+   * @return True if the query was executed successfully, false otherwise.
+   * @sa ExecuteQuery
+   */
+  bool ExecuteQuery(const std::string& strQuery, const dbiplus::BindList& params);
+
+  /*!
+   * @brief Execute a query with '?' placeholders that returns a result.
+   * @remarks Call m_pDS->close(); to clean up the dataset when done.
+   * @param strQuery The query to execute, not passed through PrepareSQL().
+   * @param params The values for the placeholders, in order.
+   * @return True if the query was executed successfully, false otherwise.
+   * @sa ResultQuery
+   */
+  bool ResultQuery(const std::string& strQuery, const dbiplus::BindList& params) const;
+
   /*!
    * @brief Start a multiple execution queue. Any ExecuteQuery() function
    *        following this call will be queued rather than executed until
@@ -210,6 +235,16 @@ public:
    */
   bool QueueInsertQuery(const std::string& strQuery);
 
+  /*!
+   * @brief Put an INSERT or REPLACE query with '?' placeholders in the queue.
+   *        Queued copies of the same query share one compiled statement where the backend
+   *        supports it.
+   * @param strQuery The query to queue.
+   * @param params The values for the placeholders, in order.
+   * @return True if the query was added successfully, false otherwise.
+   */
+  bool QueueInsertQuery(const std::string& strQuery, const dbiplus::BindList& params);
+
   /*!
    * @brief Commit all queries in the queue.
    * @return True if all queries were executed successfully, false otherwise.
@@ -241,6 +276,25 @@ public:
    */
   size_t GetDeleteQueriesCount() const;
 
+  //! A change to an item of the library, as recorded in the changelog table
+  struct Change
+  {
+    int64_t sequence;
+    std::string mediaType;
+    int id;
+    bool removed;
+  };
+
+  /*!
+   * @brief Get the changes to the library recorded after a sequence number.
+   * @param since The sequence number of the last change the caller knows about.
+   * @param limit The maximum number of changes to get.
+   * @param changes [out] The changes, in the order they were made.
+   * @param latest [out] The sequence number of the latest change.
+   * @return true on success.
+   */
+  bool GetChanges(int64_t since, unsigned int limit, std::vector<Change>& changes, int64_t& latest);
+
   virtual bool GetFilter(CDbUrl& dbUrl, Filter& filter, SortDescription& sorting) { return true; }
   virtual bool BuildSQL(const std::string& strBaseDir,
                         const std::string& strQuery,
@@ -306,6 +360,83 @@ protected:
 
   bool BuildSQL(std::string_view strQuery, const Filter& filter, std::string& strSQL) const;
 
+  /*! \brief Create a full text index over text columns of a table.
+   The index is a SQLite FTS5 table named <table>_fts, kept up to date by triggers on the table.
+   Nothing is created for MySQL or when SQLite lacks FTS5, searches then fall back to LIKE.
+   Meant to be called from CreateAnalytics(), the index is rebuilt from the table every time.
+   \param table the table to index, its rows have to be identified by an integer primary key
+   \param idColumn the primary key of the table
+   \param columns the columns to index
+   */
+  void CreateFullTextIndex(const std::string& table,
+                           const std::string& idColumn,
+                           const std::vector<std::string>& columns);
+
+  /*! \brief Build a condition for rows of a table with a word starting with each searched word.
+   \param table the table searched
+   \param idColumn the primary key of the table, as it is to be referred to in the query
+   \param search the words searched for
+   \return the condition, empty if the table has no full text index
+   */
+  std::string GetFullTextCondition(const std::string& table,
+                                   const std::string& idColumn,
+                                   const std::string& search);
+
+  /*! \brief Create the changelog table recording the changes to the library.
+   Meant to be called from CreateTables(), and from UpdateTables() for the version adding it.
+   */
+  void CreateChangelogTable();
+
+  //! A table whose changes are recorded in the changelog table
+  struct ChangelogSource
+  {
+    std::string table;
+    std::string idColumn; //!< the primary key of the table
+    std::string mediaType; //!< the media type the rows are recorded as
+  };
+
+  //! A table linking data to the items of ChangelogSource tables, e.g. art or genres
+  struct ChangelogLink
+  {
+    std::string table;
+    std::string idColumn; //!< the column holding the id of the item
+    std::string mediaType; //!< the media type of the items, empty to use the media_type column
+  };
+
+  /*! \brief Create the indices of the changelog table and the triggers recording the changes.
+   Each inserted, updated or removed row of the source tables is recorded with a sequence number
+   higher than any before, only the latest change to an item is kept. Changes to the rows of link
+   tables are recorded as updates of the items they link to, as long as the item exists. Meant to
+   be called from CreateAnalytics().
+   \param sources the tables to record the changes of
+   \param links the tables to record as changes of the source items
+   */
+  void CreateChangelogAnalytics(const std::vector<ChangelogSource>& sources,
+                                const std::vector<ChangelogLink>& links);
+
+  /*! \brief Create a trigger recording changes in the changelog table.
+   The trigger first locks the changelog for the transaction, so concurrent writers to a shared
+   database get their sequence numbers in the order they commit.
+   \param name the name of the trigger
+   \param event when the trigger fires, e.g. "AFTER UPDATE ON files"
+   \param statements the statements recording the changes, see GetChangelogStatement()
+   */
+  void CreateChangelogTrigger(const std::string& name,
+                              const std::string& event,
+                              const std::string& statements);
+
+  /*! \brief Get the statement recording a change in the changelog table, for use in triggers.
+   \param mediaType the media type of the changed item
+   \param id expression of the id of the changed item, e.g. "new.idMovie"
+   \param removed whether the item was removed
+   \param from FROM clause selecting the items if the id refers to another table, records a change
+   for every selected item
+   */
+  static std::string GetChangelogStatement(const std::string& mediaType,
+                                           const std::string& id,
+                                           bool removed,
+                                           const std::string& from = "");
+
   bool m_sqlite{true}; ///< \brief whether we use sqlite (defaults to true)
 
   std::unique_ptr<dbiplus::Database> m_pDB;
@@ -324,7 +455,10 @@ private:
   bool m_bMultiDelete{
       false}; /*!< True if there are any queries in the delete queue, false otherwise */
   unsigned int m_openCount{0};
+  std::string m_poolKey; ///< \brief key of a connection taken from the pool, empty if not pooled
 
   bool m_multipleExecute{false};
   std::vector<std::string> m_multipleQueries;
+
+  std::map<std::string, bool, std::less<>> m_fullTextIndexes; ///< \brief tables known to have one
 };
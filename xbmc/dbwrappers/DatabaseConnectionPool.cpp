@@ -0,0 +1,186 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "DatabaseConnectionPool.h"
+
+#include "dataset.h"
+#include "settings/AdvancedSettings.h"
+#include "utils/StringUtils.h"
+#include "utils/log.h"
+
+#include <mutex>
+#include <vector>
+
+using namespace dbiplus;
+
+namespace
+{
+void Disconnect(std::deque<std::unique_ptr<Database>>& connections)
+{
+  for (auto& db : connections)
+    db->disconnect();
+  connections.clear();
+}
+} // namespace
+
+CDatabaseConnectionPool& CDatabaseConnectionPool::GetInstance()
+{
+  static CDatabaseConnectionPool pool;
+  return pool;
+}
+
+CDatabaseConnectionPool::CDatabaseConnectionPool(std::chrono::milliseconds idleTimeout,
+                                                 size_t maxIdlePerKey)
+  : m_idleTimeout(idleTimeout),
+    m_maxIdlePerKey(maxIdlePerKey)
+{
+}
+
+CDatabaseConnectionPool::~CDatabaseConnectionPool()
+{
+  Clear();
+}
+
+std::string CDatabaseConnectionPool::MakeKey(const std::string& dbName,
+                                             const DatabaseSettings& settings)
+{
+  // fields are separated by a control character that can't appear in any of them
+  return StringUtils::Join(
+      std::vector<std::string>{settings.type, settings.host, settings.port, settings.user,
+                               settings.pass, dbName, settings.key, settings.cert, settings.ca,
+                               settings.capath, settings.ciphers,
+                               std::to_string(settings.connecttimeout),
+                               settings.compression ? "1" : "0"},
+      "\x1f");
+}
+
+std::unique_ptr<Database> CDatabaseConnectionPool::Acquire(const std::string& key)
+{
+  std::deque<std::unique_ptr<Database>> dropped;
+
+  while (true)
+  {
+    std::unique_ptr<Database> db;
+    {
+      std::unique_lock lock(m_section);
+      Expire(Clock::now(), dropped);
+
+      const auto it = m_idle.find(key);
+      if (it == m_idle.end())
+      {
+        m_misses++;
+        break;
+      }
+
+      // most recently used first, it is the least likely to have been closed by the server
+      db = std::move(it->second.back().db);
+      it->second.pop_back();
+      if (it->second.empty())
+        m_idle.erase(it);
+    }
+
+    // the health check involves a round trip to the server, don't hold the lock for it
+    if (db->ping())
+    {
+      {
+        std::unique_lock lock(m_section);
+        m_hits++;
+      }
+      Disconnect(dropped);
+      return db;
+    }
+
+    CLog::Log(LOGDEBUG, "CDatabaseConnectionPool::{} - dropping dead connection to {}",
+              __FUNCTION__, db->getDatabase());
+    {
+      std::unique_lock lock(m_section);
+      m_failedChecks++;
+    }
+    dropped.emplace_back(std::move(db));
+  }
+
+  Disconnect(dropped);
+  return nullptr;
+}
+
+void CDatabaseConnectionPool::Release(const std::string& key, std::unique_ptr<Database> db)
+{
+  if (!db)
+    return;
+
+  std::deque<std::unique_ptr<Database>> dropped;
+
+  if (!db->isActive() || db->in_transaction())
+  {
+    dropped.emplace_back(std::move(db));
+  }
+  else
+  {
+    std::unique_lock lock(m_section);
+    const Clock::time_point now = Clock::now();
+    Expire(now, dropped);
+
+    auto& connections = m_idle[key];
+    if (connections.size() >= m_maxIdlePerKey)
+    {
+      // keep the fresh one, the oldest is the next to time out anyway
+      dropped.emplace_back(std::move(connections.front().db));
+      connections.pop_front();
+    }
+    connections.push_back({std::move(db), now});
+  }
+
+  Disconnect(dropped);
+}
+
+void CDatabaseConnectionPool::Clear()
+{
+  std::deque<std::unique_ptr<Database>> dropped;
+  {
+    std::unique_lock lock(m_section);
+    for (auto& [key, connections] : m_idle)
+    {
+      for (auto& connection : connections)
+        dropped.emplace_back(std::move(connection.db));
+    }
+    m_idle.clear();
+  }
+
+  Disconnect(dropped);
+}
+
+CDatabaseConnectionPool::Stats CDatabaseConnectionPool::GetStats() const
+{
+  std::unique_lock lock(m_section);
+
+  size_t idle = 0;
+  for (const auto& [key, connections] : m_idle)
+    idle += connections.size();
+
+  return {idle, m_hits, m_misses, m_expired, m_failedChecks};
+}
+
+void CDatabaseConnectionPool::Expire(Clock::time_point now,
+                                     std::deque<std::unique_ptr<Database>>& expired)
+{
+  for (auto it = m_idle.begin(); it != m_idle.end();)
+  {
+    auto& connections = it->second;
+    while (!connections.empty() && now - connections.front().since >= m_idleTimeout)
+    {
+      expired.emplace_back(std::move(connections.front().db));
+      connections.pop_front();
+      m_expired++;
+    }
+
+    if (connections.empty())
+      it = m_idle.erase(it);
+    else
+      ++it;
+  }
+}
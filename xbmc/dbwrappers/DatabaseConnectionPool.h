@@ -0,0 +1,117 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <chrono>
+#include <deque>
+#include <map>
+#include <memory>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+namespace dbiplus
+{
+class Database;
+}
+
+class DatabaseSettings;
+
+/*!
+ \ingroup database
+ \brief Keeps idle server database connections around for reuse.
+
+ Opening a connection to a database server costs several round trips (DNS, handshake, charset
+ and session setup), and the library views open and close their database many times per
+ navigation. Instead of disconnecting, CDatabase::Close() hands its connection back here and the
+ next CDatabase::Connect() with identical settings picks it up again.
+
+ Idle connections are checked with Database::ping() before being handed out and are dropped
+ once they have been idle for longer than the idle timeout, so we neither hand out connections
+ the server already closed nor hold on to server slots forever. Expiry is done lazily on
+ Acquire() and Release(), there is no housekeeping thread. Safe to use from several threads.
+ */
+class CDatabaseConnectionPool
+{
+public:
+  struct Stats
+  {
+    size_t idle; /**< connections currently parked in the pool */
+    uint64_t hits; /**< number of Acquire() calls served from the pool */
+    uint64_t misses; /**< number of Acquire() calls that found nothing usable */
+    uint64_t expired; /**< idle connections dropped by the idle timeout */
+    uint64_t failedChecks; /**< idle connections dropped because the health check failed */
+  };
+
+  static CDatabaseConnectionPool& GetInstance();
+
+  explicit CDatabaseConnectionPool(
+      std::chrono::milliseconds idleTimeout = DEFAULT_IDLE_TIMEOUT,
+      size_t maxIdlePerKey = DEFAULT_MAX_IDLE_PER_KEY);
+  ~CDatabaseConnectionPool();
+  CDatabaseConnectionPool(const CDatabaseConnectionPool&) = delete;
+  CDatabaseConnectionPool& operator=(const CDatabaseConnectionPool&) = delete;
+
+  /*!
+   \brief Build the key identifying connections that can be shared.
+   \param dbName the name of the database on the server
+   \param settings the connection settings
+   \return the key, connections are only reused for an identical key
+   */
+  static std::string MakeKey(const std::string& dbName, const DatabaseSettings& settings);
+
+  /*!
+   \brief Take a connected, healthy connection out of the pool.
+   \param key the key returned by MakeKey()
+   \return the connection or nullptr if none is available
+   */
+  std::unique_ptr<dbiplus::Database> Acquire(const std::string& key);
+
+  /*!
+   \brief Hand a connection back to the pool.
+
+   Connections that are inactive, inside a transaction or exceed the per key limit are
+   disconnected instead.
+   \param key the key the connection was created for
+   \param db the connection, the pool takes ownership
+   */
+  void Release(const std::string& key, std::unique_ptr<dbiplus::Database> db);
+
+  /*!
+   \brief Disconnect and drop all idle connections.
+   */
+  void Clear();
+
+  Stats GetStats() const;
+
+  static constexpr std::chrono::milliseconds DEFAULT_IDLE_TIMEOUT{std::chrono::seconds(60)};
+  static constexpr size_t DEFAULT_MAX_IDLE_PER_KEY = 4;
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  struct IdleConnection
+  {
+    std::unique_ptr<dbiplus::Database> db;
+    Clock::time_point since;
+  };
+
+  void Expire(Clock::time_point now, std::deque<std::unique_ptr<dbiplus::Database>>& expired);
+
+  const std::chrono::milliseconds m_idleTimeout;
+  const size_t m_maxIdlePerKey;
+  std::map<std::string, std::deque<IdleConnection>> m_idle; /**< most recently released last */
+  uint64_t m_hits = 0;
+  uint64_t m_misses = 0;
+  uint64_t m_expired = 0;
+  uint64_t m_failedChecks = 0;
+  mutable CCriticalSection m_section;
+};
@@ -85,9 +85,74 @@ Dataset::~Dataset()
 {
   update_sql.clear();
   insert_sql.clear();
+  insert_binds.clear();
   delete_sql.clear();
 }
 
+bool Dataset::query(const std::string& sql, const BindList& params)
+{
+  return query(bind_params(sql, params));
+}
+
+int Dataset::exec(const std::string& sql, const BindList& params)
+{
+  return exec(bind_params(sql, params));
+}
+
+std::string Dataset::bind_params(const std::string& sql, const BindList& params) const
+{
+  if (!db)
+    throw DbErrors("No Database Connection");
+
+  std::string result;
+  result.reserve(sql.size());
+
+  auto param = params.cbegin();
+  char quote = 0;
+  for (const char c : sql)
+  {
+    if (quote)
+    {
+      if (c == quote)
+        quote = 0;
+    }
+    else if (c == '\'' || c == '"')
+      quote = c;
+    else if (c == '?' && param != params.cend())
+    {
+      const field_value& value = *param++;
+      if (value.get_isNull())
+        result += "NULL";
+      else
+      {
+        switch (value.get_fType())
+        {
+          using enum fType;
+          case ft_String:
+          case ft_Char:
+            result += db->prepare("'%s'", value.get_asString().c_str());
+            break;
+          case ft_Float:
+          case ft_Double:
+          case ft_LongDouble:
+            result += StringUtils::Format("{}", value.get_asDouble());
+            break;
+          default:
+            result += std::to_string(value.get_asInt64());
+            break;
+        }
+      }
+      continue;
+    }
+    result += c;
+  }
+
+  if (param != params.cend())
+    throw DbErrors("Too many parameters for statement: %s", sql.c_str());
+
+  return result;
+}
+
 void Dataset::setSqlParams(sqlType t, const char* sqlFrmt, ...)
 {
   va_list ap;
@@ -477,6 +542,19 @@ void Dataset::add_update_sql(const std::string& upd_sql)
 void Dataset::add_insert_sql(const std::string& ins_sql)
 {
   insert_sql.push_back(ins_sql);
+  insert_binds.emplace_back();
+}
+
+void Dataset::add_insert_sql(const std::string& ins_sql, const BindList& params)
+{
+  if (!supports_binding())
+  {
+    add_insert_sql(bind_params(ins_sql, params));
+    return;
+  }
+
+  insert_sql.push_back(ins_sql);
+  insert_binds.push_back(params);
 }
 
 void Dataset::add_delete_sql(const std::string& del_sql)
@@ -492,6 +570,7 @@ void Dataset::clear_update_sql()
 void Dataset::clear_insert_sql()
 {
   insert_sql.clear();
+  insert_binds.clear();
 }
 
 void Dataset::clear_delete_sql()
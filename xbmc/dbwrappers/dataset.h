@@ -14,12 +14,14 @@
 
 #include "qry_dat.h"
 
+#include <functional>
 #include <list>
 #include <map>
 #include <memory>
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
 
 namespace dbiplus
 {
@@ -65,6 +67,7 @@ protected:
   std::string capath;
   std::string ciphers; // SSL - Encryption info
   unsigned int connect_timeout; // seconds
+  std::function<void()> change_callback; // see setChangeCallback()
 
 public:
   /* constructor */
@@ -138,6 +141,15 @@ public:
                           const char* newCiphers = nullptr,
                           bool newCompression = false);
   virtual void disconnect() { active = false; }
+  /* check that the connection is still usable, e.g. before reusing a pooled one */
+  virtual bool ping() { return active; }
+  /* set a function called after every statement or transaction that may have modified data */
+  void setChangeCallback(std::function<void()> callback) { change_callback = std::move(callback); }
+  void notify_change() const
+  {
+    if (change_callback)
+      change_callback();
+  }
   virtual int postconnect() { return DB_COMMAND_OK; }
   virtual int reset() { return DB_COMMAND_OK; }
   virtual int create() { return DB_COMMAND_OK; }
@@ -204,6 +216,7 @@ enum class sqlType
 
 using StringList = std::list<std::string>;
 using ParamList = std::map<std::string, field_value, std::less<>>;
+using BindList = std::vector<field_value>; // values for the '?' placeholders of a statement
 
 class Dataset
 {
@@ -248,6 +261,7 @@ protected:
    insert into wt_story (idobject, body) values (:NEW_idobject, :NEW_body)
    Essentially fields idobject and body must present in the
    result set (select_sql statement) */
+  std::list<BindList> insert_binds; // Parameters of each insert_sql entry, empty when unbound
 
   StringList delete_sql; // May be an array in complex queries
   /* Field values for deleing must has prefix :OLD_ and field name
@@ -312,6 +326,21 @@ public:
   virtual const void* getExecRes() = 0;
   /* as open, but with our query exec Sql */
   virtual bool query(const std::string& sql) = 0;
+
+  /*! \brief Run a query with '?' placeholders, binding params to them in order.
+   Backends supporting it keep the compiled statement around, so running the same sql again
+   with other values skips parsing it.
+   */
+  virtual bool query(const std::string& sql, const BindList& params);
+  /*! \brief Execute a statement with '?' placeholders, binding params to them in order */
+  virtual int exec(const std::string& sql, const BindList& params);
+  /* whether bound statements are passed to the server as such */
+  virtual bool supports_binding() const { return false; }
+  /*! \brief Substitute the '?' placeholders in sql by the escaped params
+   \return the statement ready to be run by query(const std::string&) or exec(const std::string&)
+   */
+  std::string bind_params(const std::string& sql, const BindList& params) const;
+
   /* Close SQL Query*/
   virtual void close();
   /* Refresh dataset (reopen it and set the same cursor position) */
@@ -417,6 +446,8 @@ public:
   void add_update_sql(const std::string& upd_sql);
   /*add a new value to insert_sql*/
   void add_insert_sql(const std::string& ins_sql);
+  /*add a new value with '?' placeholders to insert_sql*/
+  void add_insert_sql(const std::string& ins_sql, const BindList& params);
   /*add a new value to delete_sql*/
   void add_delete_sql(const std::string& del_sql);
 
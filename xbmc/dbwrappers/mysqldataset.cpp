@@ -13,6 +13,7 @@
 #include "network/DNSNameCache.h"
 #include "network/WakeOnAccess.h"
 #include "utils/StringUtils.h"
+#include "utils/Trace.h"
 #include "utils/log.h"
 
 #include <algorithm>
@@ -291,6 +292,21 @@ void MysqlDatabase::disconnect()
   active = false;
 }
 
+bool MysqlDatabase::ping()
+{
+  if (!active || !conn)
+    return false;
+
+  if (mysql_ping(conn) != MYSQL_OK)
+  {
+    CLog::Log(LOGDEBUG, "MYSQL: connection to {} is gone [{}]({})", db, mysql_errno(conn),
+              mysql_error(conn));
+    active = false;
+    return false;
+  }
+  return true;
+}
+
 int MysqlDatabase::create()
 {
   return connect(true);
@@ -599,6 +615,7 @@ void MysqlDatabase::commit_transaction()
     mysql_autocommit(conn, true);
     CLog::LogFC(LOGDEBUG, LOGDATABASE, "Commit transaction");
     _in_transaction = false;
+    notify_change();
   }
 }
 
@@ -611,6 +628,7 @@ void MysqlDatabase::rollback_transaction()
     mysql_autocommit(conn, true);
     CLog::LogFC(LOGDEBUG, LOGDATABASE, "Rollback transaction");
     _in_transaction = false;
+    notify_change();
   }
 }
 
@@ -1701,6 +1719,7 @@ void MysqlDataset::make_query(StringList& _sql)
 
     if (db->in_transaction() && autocommit)
       db->commit_transaction();
+    db->notify_change();
 
     active = true;
     ds_state = dsSelect;
@@ -1796,6 +1815,7 @@ bool MysqlDataset::dropIndex(const char* table, const char* index)
 
 int MysqlDataset::exec(const std::string& sql)
 {
+  CTraceZone zone("MysqlDataset::exec");
   if (!handle())
     throw DbErrors("No Database Connection");
   std::string qry = sql;
@@ -1845,6 +1865,7 @@ int MysqlDataset::exec(const std::string& sql)
   }
   else
   {
+    db->notify_change();
     //! @todo collect results and store in exec_res
     return res;
   }
@@ -1862,6 +1883,7 @@ const void* MysqlDataset::getExecRes()
 
 bool MysqlDataset::query(const std::string& query)
 {
+  CTraceZone zone("MysqlDataset::query");
   if (!handle())
     throw DbErrors("No Database Connection");
 
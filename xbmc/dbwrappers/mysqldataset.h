@@ -53,6 +53,8 @@ public:
   int connect(bool create) override;
   /* func. disconnects from database-server */
   void disconnect() override;
+  /* func. checks that the server connection is still alive */
+  bool ping() override;
   /* func. creates new database */
   int create() override;
   /* func. deletes database */
@@ -132,6 +134,8 @@ or insert() operations default = false) */
   const void* getExecRes() override;
   /* as open, but with our query exec Sql */
   bool query(const std::string& query) override;
+  using Dataset::exec;
+  using Dataset::query;
   /* func. closes a query */
   void close() override;
   /* Cancel changes, made in insert or edit states of dataset */
@@ -14,6 +14,7 @@
 
 #include "utils/Map.h"
 #include "utils/StringUtils.h"
+#include "utils/Trace.h"
 #include "utils/URIUtils.h"
 #include "utils/XTimeUtils.h"
 #include "utils/log.h"
@@ -400,10 +401,46 @@ void SqliteDatabase::disconnect()
 {
   if (!active)
     return;
+  clearStatements();
   sqlite3_close(conn);
   active = false;
 }
 
+sqlite3_stmt* SqliteDatabase::getStatement(const std::string& sql)
+{
+  const auto it = statement_index.find(sql);
+  if (it != statement_index.end())
+  {
+    statements.splice(statements.begin(), statements, it->second);
+    sqlite3_stmt* stmt = it->second->second;
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
+    return stmt;
+  }
+
+  sqlite3_stmt* stmt = nullptr;
+  if (setErr(sqlite3_prepare_v2(conn, sql.c_str(), -1, &stmt, nullptr), sql.c_str()) != SQLITE_OK)
+    throw DbErrors("%s", getErrorMsg());
+
+  if (statements.size() >= MAX_CACHED_STATEMENTS)
+  {
+    statement_index.erase(statements.back().first);
+    sqlite3_finalize(statements.back().second);
+    statements.pop_back();
+  }
+  statements.emplace_front(sql, stmt);
+  statement_index.emplace(sql, statements.begin());
+  return stmt;
+}
+
+void SqliteDatabase::clearStatements()
+{
+  for (const auto& [sql, stmt] : statements)
+    sqlite3_finalize(stmt);
+  statements.clear();
+  statement_index.clear();
+}
+
 int SqliteDatabase::postconnect()
 {
   if (!active)
@@ -606,6 +643,7 @@ void SqliteDatabase::commit_transaction()
     sqlite3_exec(conn, "commit", nullptr, nullptr, nullptr);
     CLog::LogFC(LOGDEBUG, LOGDATABASE, "Sqlite commit transaction");
     _in_transaction = false;
+    notify_change();
   }
 }
 
@@ -617,6 +655,7 @@ void SqliteDatabase::rollback_transaction()
     sqlite3_exec(conn, "rollback", nullptr, nullptr, nullptr);
     CLog::LogFC(LOGDEBUG, LOGDATABASE, "Sqlite rollback transaction");
     _in_transaction = false;
+    notify_change();
   }
 }
 
@@ -726,7 +765,7 @@ sqlite3* SqliteDataset::handle()
     return nullptr;
 }
 
-void SqliteDataset::make_query(StringList& _sql)
+void SqliteDataset::make_query(StringList& _sql, const std::list<BindList>* binds)
 {
   std::string query;
   if (!db)
@@ -738,8 +777,19 @@ void SqliteDataset::make_query(StringList& _sql)
     if (autocommit)
       db->start_transaction();
 
+    auto bind = binds ? binds->cbegin() : std::list<BindList>::const_iterator();
     for (const std::string& i : _sql)
     {
+      if (binds && bind != binds->cend())
+      {
+        const BindList& params = *bind++;
+        if (!params.empty())
+        {
+          step_statement(bind_statement(i, params), i);
+          continue;
+        }
+      }
+
       query = i;
       char* err = nullptr;
       Dataset::parse_sql(query);
@@ -760,6 +810,7 @@ void SqliteDataset::make_query(StringList& _sql)
 
     if (db->in_transaction() && autocommit)
       db->commit_transaction();
+    db->notify_change();
 
     active = true;
     ds_state = dsSelect;
@@ -777,10 +828,108 @@ void SqliteDataset::make_query(StringList& _sql)
 
 void SqliteDataset::make_insert()
 {
-  make_query(insert_sql);
+  make_query(insert_sql, &insert_binds);
   last();
 }
 
+sqlite3_stmt* SqliteDataset::bind_statement(const std::string& sql, const BindList& params)
+{
+  sqlite3_stmt* stmt = static_cast<SqliteDatabase*>(db)->getStatement(sql);
+
+  if (static_cast<size_t>(sqlite3_bind_parameter_count(stmt)) != params.size())
+    throw DbErrors("Wrong number of parameters for statement: %s", sql.c_str());
+
+  int index = 1;
+  for (const field_value& value : params)
+  {
+    int rc;
+    if (value.get_isNull())
+      rc = sqlite3_bind_null(stmt, index);
+    else
+    {
+      switch (value.get_fType())
+      {
+        using enum fType;
+        case ft_String:
+        case ft_Char:
+        {
+          const std::string str = value.get_asString();
+          rc = sqlite3_bind_text(stmt, index, str.c_str(), static_cast<int>(str.size()),
+                                 SQLITE_TRANSIENT);
+          break;
+        }
+        case ft_Float:
+        case ft_Double:
+        case ft_LongDouble:
+          rc = sqlite3_bind_double(stmt, index, value.get_asDouble());
+          break;
+        default:
+          rc = sqlite3_bind_int64(stmt, index, value.get_asInt64());
+          break;
+      }
+    }
+    if (db->setErr(rc, sql.c_str()) != SQLITE_OK)
+      throw DbErrors("%s", db->getErrorMsg());
+    index++;
+  }
+
+  return stmt;
+}
+
+void SqliteDataset::step_statement(sqlite3_stmt* stmt, const std::string& sql)
+{
+  int rc;
+  while ((rc = sqlite3_step(stmt)) == SQLITE_ROW)
+    ;
+  sqlite3_reset(stmt);
+
+  if (db->setErr(rc == SQLITE_DONE ? SQLITE_OK : rc, sql.c_str()) != SQLITE_OK)
+    throw DbErrors("%s", db->getErrorMsg());
+}
+
+void SqliteDataset::fetch_rows(sqlite3_stmt* stmt)
+{
+  // column headers
+  const unsigned int numColumns = sqlite3_column_count(stmt);
+  result.record_header.resize(numColumns);
+  for (unsigned int i = 0; i < numColumns; i++)
+    result.record_header[i].name = sqlite3_column_name(stmt, i);
+
+  // returned rows
+  while (sqlite3_step(stmt) == SQLITE_ROW)
+  { // have a row of data
+    auto* res = new sql_record;
+    res->resize(numColumns);
+    for (unsigned int i = 0; i < numColumns; i++)
+    {
+      field_value& v = res->at(i);
+      switch (sqlite3_column_type(stmt, i))
+      {
+        case SQLITE_INTEGER:
+          v.set_asInt64(sqlite3_column_int64(stmt, i));
+          break;
+        case SQLITE_FLOAT:
+          v.set_asDouble(sqlite3_column_double(stmt, i));
+          break;
+        case SQLITE_TEXT:
+          v.set_asString(reinterpret_cast<const char*>(sqlite3_column_text(stmt, i)),
+                         sqlite3_column_bytes(stmt, i));
+          break;
+        case SQLITE_BLOB:
+          v.set_asString(reinterpret_cast<const char*>(sqlite3_column_text(stmt, i)),
+                         sqlite3_column_bytes(stmt, i));
+          break;
+        case SQLITE_NULL:
+        default:
+          v.set_asString("", 0);
+          v.set_isNull();
+          break;
+      }
+    }
+    result.records.push_back(res);
+  }
+}
+
 void SqliteDataset::make_edit()
 {
   make_query(update_sql);
@@ -842,6 +991,7 @@ bool SqliteDataset::dropIndex(const char* table, const char* index)
 
 int SqliteDataset::exec(const std::string& sql)
 {
+  CTraceZone zone("SqliteDataset::exec");
   if (!handle())
     throw DbErrors("No Database Connection");
   std::string qry = sql;
@@ -899,6 +1049,7 @@ int SqliteDataset::exec(const std::string& sql)
 
   if (res == SQLITE_OK)
   {
+    db->notify_change();
     return res;
   }
   else
@@ -928,6 +1079,7 @@ const void* SqliteDataset::getExecRes()
 
 bool SqliteDataset::query(const std::string& query)
 {
+  CTraceZone zone("SqliteDataset::query");
   if (!handle())
     throw DbErrors("No Database Connection");
 
@@ -941,45 +1093,8 @@ bool SqliteDataset::query(const std::string& query)
       SQLITE_OK)
     throw DbErrors("%s", db->getErrorMsg());
 
-  // column headers
-  const unsigned int numColumns = sqlite3_column_count(stmt);
-  result.record_header.resize(numColumns);
-  for (unsigned int i = 0; i < numColumns; i++)
-    result.record_header[i].name = sqlite3_column_name(stmt, i);
+  fetch_rows(stmt);
 
-  // returned rows
-  while (sqlite3_step(stmt) == SQLITE_ROW)
-  { // have a row of data
-    auto* res = new sql_record;
-    res->resize(numColumns);
-    for (unsigned int i = 0; i < numColumns; i++)
-    {
-      field_value& v = res->at(i);
-      switch (sqlite3_column_type(stmt, i))
-      {
-        case SQLITE_INTEGER:
-          v.set_asInt64(sqlite3_column_int64(stmt, i));
-          break;
-        case SQLITE_FLOAT:
-          v.set_asDouble(sqlite3_column_double(stmt, i));
-          break;
-        case SQLITE_TEXT:
-          v.set_asString(reinterpret_cast<const char*>(sqlite3_column_text(stmt, i)),
-                         sqlite3_column_bytes(stmt, i));
-          break;
-        case SQLITE_BLOB:
-          v.set_asString(reinterpret_cast<const char*>(sqlite3_column_text(stmt, i)),
-                         sqlite3_column_bytes(stmt, i));
-          break;
-        case SQLITE_NULL:
-        default:
-          v.set_asString("", 0);
-          v.set_isNull();
-          break;
-      }
-    }
-    result.records.push_back(res);
-  }
   if (db->setErr(sqlite3_finalize(stmt), query.c_str()) == SQLITE_OK)
   {
     active = true;
@@ -993,6 +1108,53 @@ bool SqliteDataset::query(const std::string& query)
   }
 }
 
+bool SqliteDataset::query(const std::string& sql, const BindList& params)
+{
+  CTraceZone zone("SqliteDataset::query");
+  if (!handle())
+    throw DbErrors("No Database Connection");
+
+  close();
+
+  const auto start = std::chrono::steady_clock::now();
+
+  sqlite3_stmt* stmt = bind_statement(sql, params);
+  fetch_rows(stmt);
+  const int rc = sqlite3_reset(stmt);
+
+  const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - start);
+  CLog::LogFC(LOGDEBUG, LOGDATABASE, "{} ms for bound query: {}", duration.count(), sql);
+
+  if (db->setErr(rc, sql.c_str()) != SQLITE_OK)
+    throw DbErrors("%s", db->getErrorMsg());
+
+  active = true;
+  ds_state = dsSelect;
+  this->first();
+  return true;
+}
+
+int SqliteDataset::exec(const std::string& sql, const BindList& params)
+{
+  CTraceZone zone("SqliteDataset::exec");
+  if (!handle())
+    throw DbErrors("No Database Connection");
+
+  exec_res.clear();
+
+  const auto start = std::chrono::steady_clock::now();
+
+  step_statement(bind_statement(sql, params), sql);
+  db->notify_change();
+
+  const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - start);
+  CLog::LogFC(LOGDEBUG, LOGDATABASE, "{} ms for bound query: {}", duration.count(), sql);
+
+  return SQLITE_OK;
+}
+
 void SqliteDataset::open(const std::string& sql)
 {
   set_select_sql(sql);
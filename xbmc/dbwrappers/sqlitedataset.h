@@ -14,9 +14,13 @@
 
 #include "dataset.h"
 
+#include <list>
 #include <string>
+#include <unordered_map>
+#include <utility>
 
 struct sqlite3;
+struct sqlite3_stmt;
 
 namespace dbiplus
 {
@@ -33,6 +37,12 @@ protected:
   bool _in_transaction{false};
   int last_err;
 
+  /* compiled statements by sql text, most recently used first */
+  using StatementList = std::list<std::pair<std::string, sqlite3_stmt*>>;
+  StatementList statements;
+  std::unordered_map<std::string, StatementList::iterator> statement_index;
+  static constexpr size_t MAX_CACHED_STATEMENTS = 64;
+
 public:
   /* default constructor */
   SqliteDatabase();
@@ -43,6 +53,10 @@ public:
 
   /* func. returns connection handle with SQLite-server */
   sqlite3* getHandle() { return conn; }
+  /* returns a reset compiled statement for sql, kept for reuse until disconnect */
+  sqlite3_stmt* getStatement(const std::string& sql);
+  /* finalizes all kept statements */
+  void clearStatements();
   /* func. returns current status about SQLite-server connection */
   int status() override;
   int setErr(int err_code, const char* qry) override;
@@ -97,8 +111,14 @@ class SqliteDataset : public Dataset
 protected:
   sqlite3* handle();
 
-  /* Makes direct queries to database */
-  virtual void make_query(StringList& _sql);
+  /* Makes direct queries to database, binds holds the parameters of each bound statement */
+  virtual void make_query(StringList& _sql, const std::list<BindList>* binds = nullptr);
+  /* Binds params to the cached statement for sql */
+  sqlite3_stmt* bind_statement(const std::string& sql, const BindList& params);
+  /* Runs a statement returning no rows */
+  void step_statement(sqlite3_stmt* stmt, const std::string& sql);
+  /* Reads all rows of stmt into the result set */
+  void fetch_rows(sqlite3_stmt* stmt);
   /* Makes direct inserts into database */
   void make_insert() override;
   /* Edit SQL */
@@ -134,6 +154,9 @@ or insert() operations default = false) */
   const void* getExecRes() override;
   /* as open, but with our query exec Sql */
   bool query(const std::string& query) override;
+  bool query(const std::string& sql, const BindList& params) override;
+  int exec(const std::string& sql, const BindList& params) override;
+  bool supports_binding() const override { return true; }
   /* func. closes a query */
   void close() override;
   /* Cancel changes, made in insert or edit states of dataset */
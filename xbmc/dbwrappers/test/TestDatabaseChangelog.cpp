@@ -0,0 +1,144 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "dbwrappers/Database.h"
+#include "dbwrappers/sqlitedataset.h"
+
+#include <filesystem>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+class CChangelogDatabase : public CDatabase
+{
+public:
+  explicit CChangelogDatabase(const std::filesystem::path& path)
+  {
+    m_pDB = std::make_unique<dbiplus::SqliteDatabase>();
+    m_pDB->setHostName(path.string().c_str());
+    m_pDB->setDatabase("changelog.db");
+    m_pDB->connect(true);
+    m_pDS.reset(m_pDB->CreateDataset());
+    CreateTables();
+    CreateAnalytics();
+  }
+
+  ~CChangelogDatabase() override
+  {
+    m_pDS.reset();
+    m_pDB->disconnect();
+  }
+
+  void Exec(const std::string& sql) { m_pDS->exec(sql); }
+
+protected:
+  void CreateTables() override
+  {
+    m_pDS->exec("CREATE TABLE movie (idMovie INTEGER PRIMARY KEY, title TEXT)");
+    m_pDS->exec("CREATE TABLE art (art_id INTEGER PRIMARY KEY, media_id INTEGER, "
+                "media_type TEXT, url TEXT)");
+    m_pDS->exec("CREATE TABLE genre_link (genre_id INTEGER, idMovie INTEGER)");
+    CreateChangelogTable();
+  }
+
+  void CreateAnalytics() override
+  {
+    CreateChangelogAnalytics({{"movie", "idMovie", "movie"}},
+                             {{"art", "media_id", ""}, {"genre_link", "idMovie", "movie"}});
+    m_pDS->exec("CREATE TRIGGER delete_movie AFTER DELETE ON movie FOR EACH ROW BEGIN "
+                "DELETE FROM art WHERE media_id=old.idMovie AND media_type='movie'; "
+                "DELETE FROM genre_link WHERE idMovie=old.idMovie; END");
+  }
+
+  int GetSchemaVersion() const override { return 1; }
+  const char* GetBaseDBName() const override { return "changelog"; }
+};
+
+class TestDatabaseChangelog : public testing::Test
+{
+protected:
+  TestDatabaseChangelog()
+  {
+    m_path = std::filesystem::temp_directory_path() / "kodi_test_changelog";
+    std::filesystem::create_directories(m_path);
+    m_db = std::make_unique<CChangelogDatabase>(m_path);
+  }
+
+  ~TestDatabaseChangelog() override
+  {
+    m_db.reset();
+    std::filesystem::remove_all(m_path);
+  }
+
+  std::vector<CDatabase::Change> GetChanges(int64_t since)
+  {
+    std::vector<CDatabase::Change> changes;
+    int64_t latest;
+    EXPECT_TRUE(m_db->GetChanges(since, 100, changes, latest));
+    return changes;
+  }
+
+  std::filesystem::path m_path;
+  std::unique_ptr<CChangelogDatabase> m_db;
+};
+} // namespace
+
+TEST_F(TestDatabaseChangelog, SequenceNotReused)
+{
+  m_db->Exec("INSERT INTO movie (idMovie, title) VALUES (1, 'a')");
+  m_db->Exec("INSERT INTO movie (idMovie, title) VALUES (2, 'b')");
+  // replaces the entry with the highest sequence, its number must not be handed out again
+  m_db->Exec("UPDATE movie SET title = 'c' WHERE idMovie = 2");
+
+  auto changes = GetChanges(2);
+  ASSERT_EQ(1u, changes.size());
+  EXPECT_EQ(2, changes[0].id);
+  EXPECT_GT(changes[0].sequence, 2);
+
+  const int64_t since = changes[0].sequence;
+  m_db->Exec("UPDATE movie SET title = 'd' WHERE idMovie = 2");
+  changes = GetChanges(since);
+  ASSERT_EQ(1u, changes.size());
+  EXPECT_GT(changes[0].sequence, since);
+}
+
+TEST_F(TestDatabaseChangelog, Links)
+{
+  m_db->Exec("INSERT INTO movie (idMovie, title) VALUES (1, 'a')");
+  m_db->Exec("INSERT INTO movie (idMovie, title) VALUES (2, 'b')");
+  int64_t since = GetChanges(0).back().sequence;
+
+  m_db->Exec("INSERT INTO art (media_id, media_type, url) VALUES (1, 'movie', 'poster.jpg')");
+  auto changes = GetChanges(since);
+  ASSERT_EQ(1u, changes.size());
+  EXPECT_EQ("movie", changes[0].mediaType);
+  EXPECT_EQ(1, changes[0].id);
+  EXPECT_FALSE(changes[0].removed);
+  since = changes[0].sequence;
+
+  // art of other media types isn't recorded
+  m_db->Exec("INSERT INTO art (media_id, media_type, url) VALUES (2, 'actor', 'thumb.jpg')");
+  EXPECT_TRUE(GetChanges(since).empty());
+
+  m_db->Exec("INSERT INTO genre_link (genre_id, idMovie) VALUES (1, 2)");
+  changes = GetChanges(since);
+  ASSERT_EQ(1u, changes.size());
+  EXPECT_EQ(2, changes[0].id);
+  EXPECT_FALSE(changes[0].removed);
+  since = changes[0].sequence;
+
+  // the links deleted with the movie don't turn its removal into an update
+  m_db->Exec("INSERT INTO art (media_id, media_type, url) VALUES (2, 'movie', 'fanart.jpg')");
+  m_db->Exec("DELETE FROM movie WHERE idMovie = 2");
+  changes = GetChanges(since);
+  ASSERT_EQ(1u, changes.size());
+  EXPECT_EQ(2, changes[0].id);
+  EXPECT_TRUE(changes[0].removed);
+}
@@ -0,0 +1,141 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "dbwrappers/DatabaseConnectionPool.h"
+#include "dbwrappers/dataset.h"
+#include "settings/AdvancedSettings.h"
+
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace dbiplus;
+using namespace std::chrono_literals;
+
+namespace
+{
+class CFakeDatabase : public Database
+{
+public:
+  explicit CFakeDatabase(int& disconnects) : m_disconnects(disconnects) { active = true; }
+
+  Dataset* CreateDataset() override { return nullptr; }
+  int setErr(int err_code, const char* qry) override { return err_code; }
+  long nextid(const char* seq_name) override { return 0; }
+  std::string vprepare(std::string_view format, va_list args) override { return {}; }
+  void disconnect() override
+  {
+    m_disconnects++;
+    active = false;
+  }
+  bool ping() override { return active && m_alive; }
+  bool in_transaction() override { return m_transaction; }
+
+  bool m_alive{true};
+  bool m_transaction{false};
+
+private:
+  int& m_disconnects;
+};
+} // namespace
+
+TEST(TestDatabaseConnectionPool, Reuse)
+{
+  CDatabaseConnectionPool pool;
+  int disconnects = 0;
+
+  EXPECT_EQ(nullptr, pool.Acquire("a"));
+
+  auto db = std::make_unique<CFakeDatabase>(disconnects);
+  Database* raw = db.get();
+  pool.Release("a", std::move(db));
+
+  EXPECT_EQ(nullptr, pool.Acquire("b"));
+  auto reused = pool.Acquire("a");
+  EXPECT_EQ(raw, reused.get());
+  EXPECT_EQ(nullptr, pool.Acquire("a"));
+  EXPECT_EQ(0, disconnects);
+
+  const auto stats = pool.GetStats();
+  EXPECT_EQ(0u, stats.idle);
+  EXPECT_EQ(1u, stats.hits);
+  EXPECT_EQ(3u, stats.misses);
+}
+
+TEST(TestDatabaseConnectionPool, HealthCheck)
+{
+  CDatabaseConnectionPool pool;
+  int disconnects = 0;
+
+  auto healthy = std::make_unique<CFakeDatabase>(disconnects);
+  Database* raw = healthy.get();
+  auto dead = std::make_unique<CFakeDatabase>(disconnects);
+  dead->m_alive = false;
+
+  pool.Release("a", std::move(healthy));
+  pool.Release("a", std::move(dead));
+
+  // the dead one is the most recently released and gets dropped on the way
+  EXPECT_EQ(raw, pool.Acquire("a").get());
+  EXPECT_EQ(1, disconnects);
+  EXPECT_EQ(1u, pool.GetStats().failedChecks);
+}
+
+TEST(TestDatabaseConnectionPool, IdleTimeout)
+{
+  CDatabaseConnectionPool pool(20ms);
+  int disconnects = 0;
+
+  pool.Release("a", std::make_unique<CFakeDatabase>(disconnects));
+  std::this_thread::sleep_for(40ms);
+
+  EXPECT_EQ(nullptr, pool.Acquire("a"));
+  EXPECT_EQ(1, disconnects);
+  EXPECT_EQ(1u, pool.GetStats().expired);
+}
+
+TEST(TestDatabaseConnectionPool, Limits)
+{
+  CDatabaseConnectionPool pool(CDatabaseConnectionPool::DEFAULT_IDLE_TIMEOUT, 2);
+  int disconnects = 0;
+
+  for (int i = 0; i < 3; ++i)
+    pool.Release("a", std::make_unique<CFakeDatabase>(disconnects));
+  EXPECT_EQ(1, disconnects);
+  EXPECT_EQ(2u, pool.GetStats().idle);
+
+  auto busy = std::make_unique<CFakeDatabase>(disconnects);
+  busy->m_transaction = true;
+  pool.Release("b", std::move(busy));
+  EXPECT_EQ(2, disconnects);
+
+  auto closed = std::make_unique<CFakeDatabase>(disconnects);
+  closed->disconnect();
+  pool.Release("b", std::move(closed));
+  EXPECT_EQ(2u, pool.GetStats().idle);
+
+  pool.Clear();
+  EXPECT_EQ(0u, pool.GetStats().idle);
+  EXPECT_EQ(6, disconnects);
+}
+
+TEST(TestDatabaseConnectionPool, MakeKey)
+{
+  DatabaseSettings settings;
+  settings.type = "mysql";
+  settings.host = "nas";
+
+  const std::string key = CDatabaseConnectionPool::MakeKey("MyVideos131", settings);
+  EXPECT_EQ(key, CDatabaseConnectionPool::MakeKey("MyVideos131", settings));
+  EXPECT_NE(key, CDatabaseConnectionPool::MakeKey("MyMusic83", settings));
+
+  settings.user = "kodi";
+  EXPECT_NE(key, CDatabaseConnectionPool::MakeKey("MyVideos131", settings));
+}
@@ -0,0 +1,103 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "dbwrappers/sqlitedataset.h"
+
+#include <filesystem>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+using namespace dbiplus;
+
+class TestSqliteDataset : public testing::Test
+{
+protected:
+  TestSqliteDataset()
+  {
+    m_path = std::filesystem::temp_directory_path() / "kodi_test_sqlitedataset";
+    std::filesystem::create_directories(m_path);
+    m_db.setHostName(m_path.string().c_str());
+    m_db.setDatabase("test.db");
+    m_db.connect(true);
+    m_ds.reset(m_db.CreateDataset());
+    m_ds->exec("CREATE TABLE path (idPath INTEGER PRIMARY KEY, strPath TEXT, rating REAL)");
+  }
+
+  ~TestSqliteDataset() override
+  {
+    m_ds.reset();
+    m_db.disconnect();
+    std::filesystem::remove_all(m_path);
+  }
+
+  std::filesystem::path m_path;
+  SqliteDatabase m_db;
+  std::unique_ptr<Dataset> m_ds;
+};
+
+TEST_F(TestSqliteDataset, BoundStatements)
+{
+  for (int i = 0; i < 3; i++)
+  {
+    const std::string path = "smb://server/it's " + std::to_string(i) + "/";
+    m_ds->exec("INSERT INTO path (strPath, rating) VALUES (?, ?)",
+               {field_value(path.c_str()), field_value(i * 0.5)});
+  }
+
+  ASSERT_TRUE(m_ds->query("SELECT idPath, rating FROM path WHERE strPath=?",
+                          {field_value("smb://server/it's 2/")}));
+  ASSERT_EQ(1, m_ds->num_rows());
+  EXPECT_EQ(3, m_ds->fv("idPath").get_asInt());
+  EXPECT_DOUBLE_EQ(1.0, m_ds->fv("rating").get_asDouble());
+  m_ds->close();
+
+  // same query again reuses the statement with new values
+  ASSERT_TRUE(m_ds->query("SELECT idPath, rating FROM path WHERE strPath=?",
+                          {field_value("smb://server/it's 0/")}));
+  ASSERT_EQ(1, m_ds->num_rows());
+  EXPECT_EQ(1, m_ds->fv("idPath").get_asInt());
+  m_ds->close();
+
+  field_value null;
+  null.set_isNull();
+  m_ds->exec("UPDATE path SET rating=? WHERE idPath=?", {null, field_value(1)});
+  ASSERT_TRUE(m_ds->query("SELECT rating FROM path WHERE idPath=?", {field_value(1)}));
+  EXPECT_TRUE(m_ds->fv("rating").get_isNull());
+  m_ds->close();
+
+  EXPECT_THROW(m_ds->query("SELECT * FROM path WHERE idPath=?", {}), DbErrors);
+}
+
+TEST_F(TestSqliteDataset, BindParams)
+{
+  field_value null;
+  null.set_isNull();
+  EXPECT_EQ("SELECT '?' FROM path WHERE strPath='it''s' AND idPath=4 AND rating=NULL",
+            m_ds->bind_params("SELECT '?' FROM path WHERE strPath=? AND idPath=? AND rating=?",
+                              {field_value("it's"), field_value(4), null}));
+}
+
+TEST_F(TestSqliteDataset, BoundInsertQueue)
+{
+  m_ds->insert();
+  m_ds->add_insert_sql("INSERT INTO path (strPath) VALUES ('first')");
+  for (int i = 0; i < 10; i++)
+    m_ds->add_insert_sql("INSERT INTO path (strPath) VALUES (?)",
+                         {field_value(std::to_string(i).c_str())});
+  EXPECT_EQ(11u, m_ds->insert_sql_count());
+  m_ds->post();
+  m_ds->clear_insert_sql();
+
+  ASSERT_TRUE(m_ds->query("SELECT strPath FROM path ORDER BY idPath"));
+  ASSERT_EQ(11, m_ds->num_rows());
+  EXPECT_EQ("first", m_ds->fv("strPath").get_asString());
+  m_ds->last();
+  EXPECT_EQ("9", m_ds->fv("strPath").get_asString());
+  m_ds->close();
+}
@@ -603,6 +603,9 @@ void CBlurayDirectory::Dispose()
 {
   if (m_bd)
   {
+    // Store what was parsed, so the disc opens without parsing next time
+    CServiceBroker::GetBlurayDiscCache()->Save(GetCachePath(m_url, m_realPath));
+
     bd_close(m_bd);
     m_bd = nullptr;
   }
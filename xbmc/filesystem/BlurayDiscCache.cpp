@@ -8,12 +8,474 @@
 
 #include "BlurayDiscCache.h"
 
+#include "Directory.h"
+#include "File.h"
+#include "FileItem.h"
+#include "FileItemList.h"
 #include "URL.h"
+#include "XBDateTime.h"
 #include "bluray/PlaylistStructure.h"
+#include "utils/Archive.h"
+#include "utils/Digest.h"
+#include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
 using namespace XFILE;
+using KODI::UTILITY::CDigest;
+
+// Bump when the format of the cache files or the information gathered by the parsers changes
+#define BLURAY_CACHE_VERSION 1
+
+namespace
+{
+constexpr const char* CACHE_PATH = "special://temp/bluraycache/";
+
+// Cache files not written for this long are removed, as are the oldest beyond the limit
+constexpr int MAX_CACHE_AGE_DAYS = 180;
+constexpr int MAX_CACHE_FILES = 200;
+
+std::string GetStoredPath(const std::string& path)
+{
+  // Get rid of any URL options, else the compare may be wrong
+  std::string storedPath{CURL(path).GetWithoutOptions()};
+  URIUtils::RemoveSlashAtEnd(storedPath);
+  return storedPath;
+}
+
+std::string GetCacheFile(const std::string& id)
+{
+  return CACHE_PATH + id + ".cache";
+}
+
+// Serialization of the parser structures
+
+template<typename T>
+  requires std::is_enum_v<T>
+void Write(CArchive& ar, T value)
+{
+  ar << static_cast<unsigned int>(value);
+}
+
+template<typename T>
+  requires std::is_enum_v<T>
+void Read(CArchive& ar, T& value)
+{
+  unsigned int v;
+  ar >> v;
+  value = static_cast<T>(v);
+}
+
+void Write(CArchive& ar, unsigned int value)
+{
+  ar << value;
+}
+
+void Read(CArchive& ar, unsigned int& value)
+{
+  ar >> value;
+}
+
+void Write(CArchive& ar, std::chrono::milliseconds value)
+{
+  ar << static_cast<int64_t>(value.count());
+}
+
+void Read(CArchive& ar, std::chrono::milliseconds& value)
+{
+  int64_t v;
+  ar >> v;
+  value = std::chrono::milliseconds(v);
+}
+
+// Declared ahead for the vector overloads
+void Write(CArchive& ar, const StreamInformation& stream);
+void Read(CArchive& ar, StreamInformation& stream);
+void Write(CArchive& ar, const ProgramInformation& program);
+void Read(CArchive& ar, ProgramInformation& program);
+void Write(CArchive& ar, const ClipInformation& clip);
+void Read(CArchive& ar, ClipInformation& clip);
+void Write(CArchive& ar, const PlaylistMarkInformation& mark);
+void Read(CArchive& ar, PlaylistMarkInformation& mark);
+void Write(CArchive& ar, const ChapterInformation& chapter);
+void Read(CArchive& ar, ChapterInformation& chapter);
+void Write(CArchive& ar, const SubPlayItemInformation& item);
+void Read(CArchive& ar, SubPlayItemInformation& item);
+void Write(CArchive& ar, const PlayItemInformation& item);
+void Read(CArchive& ar, PlayItemInformation& item);
+
+template<typename T>
+void Write(CArchive& ar, const std::vector<T>& values)
+{
+  ar << static_cast<unsigned int>(values.size());
+  for (const auto& value : values)
+    Write(ar, value);
+}
+
+template<typename T>
+void Read(CArchive& ar, std::vector<T>& values)
+{
+  unsigned int size;
+  ar >> size;
+  values.clear();
+  for (unsigned int i = 0; i < size; ++i)
+    Read(ar, values.emplace_back());
+}
+
+void Write(CArchive& ar, const StreamInformation& stream)
+{
+  Write(ar, stream.type);
+  Write(ar, stream.coding);
+  ar << stream.packetIdentifier << stream.subpathId << stream.subclipId << stream.format
+     << stream.rate;
+  Write(ar, stream.aspect);
+  ar << stream.dynamicRangeType << stream.colorSpace << stream.copyRestricted << stream.outOfMux
+     << stream.HDRPlus << stream.characterEncoding << stream.language;
+  Write(ar, stream.secondaryAudio_audioReferences);
+  Write(ar, stream.secondaryVideo_audioReferences);
+  Write(ar, stream.secondaryVideo_presentationGraphicReferences);
+}
+
+void Read(CArchive& ar, StreamInformation& stream)
+{
+  Read(ar, stream.type);
+  Read(ar, stream.coding);
+  ar >> stream.packetIdentifier >> stream.subpathId >> stream.subclipId >> stream.format >>
+      stream.rate;
+  Read(ar, stream.aspect);
+  ar >> stream.dynamicRangeType >> stream.colorSpace >> stream.copyRestricted >>
+      stream.outOfMux >> stream.HDRPlus >> stream.characterEncoding >> stream.language;
+  Read(ar, stream.secondaryAudio_audioReferences);
+  Read(ar, stream.secondaryVideo_audioReferences);
+  Read(ar, stream.secondaryVideo_presentationGraphicReferences);
+}
+
+void Write(CArchive& ar, const ProgramInformation& program)
+{
+  ar << program.spnProgramSequenceStart << program.programId << program.numGroups;
+  Write(ar, program.streams);
+}
+
+void Read(CArchive& ar, ProgramInformation& program)
+{
+  ar >> program.spnProgramSequenceStart >> program.programId >> program.numGroups;
+  Read(ar, program.streams);
+}
+
+void Write(CArchive& ar, const ClipInformation& clip)
+{
+  ar << clip.clip << clip.version << clip.codec;
+  Write(ar, clip.time);
+  Write(ar, clip.duration);
+  Write(ar, clip.programs);
+}
+
+void Read(CArchive& ar, ClipInformation& clip)
+{
+  ar >> clip.clip >> clip.version >> clip.codec;
+  Read(ar, clip.time);
+  Read(ar, clip.duration);
+  Read(ar, clip.programs);
+}
+
+void Write(CArchive& ar, const PlaylistMarkInformation& mark)
+{
+  Write(ar, mark.markType);
+  ar << mark.playItemReference;
+  Write(ar, mark.time);
+  ar << mark.elementaryStreamPacketIdentifier;
+  Write(ar, mark.duration);
+}
+
+void Read(CArchive& ar, PlaylistMarkInformation& mark)
+{
+  Read(ar, mark.markType);
+  ar >> mark.playItemReference;
+  Read(ar, mark.time);
+  ar >> mark.elementaryStreamPacketIdentifier;
+  Read(ar, mark.duration);
+}
+
+void Write(CArchive& ar, const ChapterInformation& chapter)
+{
+  ar << chapter.chapter;
+  Write(ar, chapter.start);
+  Write(ar, chapter.duration);
+}
+
+void Read(CArchive& ar, ChapterInformation& chapter)
+{
+  ar >> chapter.chapter;
+  Read(ar, chapter.start);
+  Read(ar, chapter.duration);
+}
+
+void Write(CArchive& ar, const SubPlayItemInformation& item)
+{
+  Write(ar, item.connectionCondition);
+  ar << item.isMultiClip;
+  Write(ar, item.inTime);
+  Write(ar, item.outTime);
+  ar << item.syncPlayItemId;
+  Write(ar, item.clips);
+}
+
+void Read(CArchive& ar, SubPlayItemInformation& item)
+{
+  Read(ar, item.connectionCondition);
+  ar >> item.isMultiClip;
+  Read(ar, item.inTime);
+  Read(ar, item.outTime);
+  ar >> item.syncPlayItemId;
+  Read(ar, item.clips);
+}
+
+void Write(CArchive& ar, const PlayItemInformation& item)
+{
+  ar << item.isMultiAngle;
+  Write(ar, item.angleClips);
+  Write(ar, item.connectionCondition);
+  Write(ar, item.inTime);
+  Write(ar, item.outTime);
+  ar << item.randomAccessFlag << item.stillMode;
+  Write(ar, item.stillTime);
+  Write(ar, item.videoStreams);
+  Write(ar, item.audioStreams);
+  Write(ar, item.presentationGraphicStreams);
+  Write(ar, item.interactiveGraphicStreams);
+  Write(ar, item.secondaryAudioStreams);
+  Write(ar, item.secondaryVideoStreams);
+  Write(ar, item.dolbyVisionStreams);
+}
+
+void Read(CArchive& ar, PlayItemInformation& item)
+{
+  ar >> item.isMultiAngle;
+  Read(ar, item.angleClips);
+  Read(ar, item.connectionCondition);
+  Read(ar, item.inTime);
+  Read(ar, item.outTime);
+  ar >> item.randomAccessFlag >> item.stillMode;
+  Read(ar, item.stillTime);
+  Read(ar, item.videoStreams);
+  Read(ar, item.audioStreams);
+  Read(ar, item.presentationGraphicStreams);
+  Read(ar, item.interactiveGraphicStreams);
+  Read(ar, item.secondaryAudioStreams);
+  Read(ar, item.secondaryVideoStreams);
+  Read(ar, item.dolbyVisionStreams);
+}
+
+void Write(CArchive& ar, const BlurayPlaylistInformation& info)
+{
+  ar << info.playlist << info.version;
+  Write(ar, info.duration);
+  Write(ar, info.playbackType);
+  ar << info.playbackCount;
+  Write(ar, info.playItems);
+  Write(ar, info.clips);
+  Write(ar, info.subPlayItems);
+  Write(ar, info.extensionSubPlayItems);
+  Write(ar, info.playlistMarks);
+  Write(ar, info.chapters);
+}
+
+void Read(CArchive& ar, BlurayPlaylistInformation& info)
+{
+  ar >> info.playlist >> info.version;
+  Read(ar, info.duration);
+  Read(ar, info.playbackType);
+  ar >> info.playbackCount;
+  Read(ar, info.playItems);
+  Read(ar, info.clips);
+  Read(ar, info.subPlayItems);
+  Read(ar, info.extensionSubPlayItems);
+  Read(ar, info.playlistMarks);
+  Read(ar, info.chapters);
+}
+
+enum class TSStreamKind : unsigned int
+{
+  OTHER,
+  AUDIO,
+  VIDEO
+};
+
+void Write(CArchive& ar, const TSStreamInfo& stream)
+{
+  const auto* audio{dynamic_cast<const TSAudioStreamInfo*>(&stream)};
+  const auto* video{dynamic_cast<const TSVideoStreamInfo*>(&stream)};
+  Write(ar, audio   ? TSStreamKind::AUDIO
+            : video ? TSStreamKind::VIDEO
+                    : TSStreamKind::OTHER);
+
+  ar << stream.pid;
+  Write(ar, stream.streamType);
+  ar << static_cast<unsigned int>(stream.descriptors.size());
+  for (const auto& descriptor : stream.descriptors)
+  {
+    ar << descriptor.tag << descriptor.length;
+    ar << std::string(reinterpret_cast<const char*>(descriptor.data.data()),
+                      descriptor.data.size());
+  }
+  ar << stream.seen << stream.completed;
+
+  if (audio)
+    ar << audio->channels << audio->sampleRate << audio->isXLL << audio->hasSubstream
+       << audio->isXLLX << audio->isXLLXIMAX << audio->hasDependantStream << audio->isAtmos;
+  else if (video)
+    ar << video->height << video->width << video->bitDepth << video->aspectRatio << video->is3d
+       << video->hdr10 << video->hdr10Plus << video->dolbyVision << video->isEnhancementLayer;
+}
+
+std::shared_ptr<TSStreamInfo> ReadStream(CArchive& ar)
+{
+  TSStreamKind kind;
+  Read(ar, kind);
+  std::shared_ptr<TSStreamInfo> stream;
+  auto audio{kind == TSStreamKind::AUDIO ? std::make_shared<TSAudioStreamInfo>() : nullptr};
+  auto video{kind == TSStreamKind::VIDEO ? std::make_shared<TSVideoStreamInfo>() : nullptr};
+  if (audio)
+    stream = audio;
+  else if (video)
+    stream = video;
+  else
+    stream = std::make_shared<TSStreamInfo>();
+
+  ar >> stream->pid;
+  Read(ar, stream->streamType);
+  unsigned int size;
+  ar >> size;
+  for (unsigned int i = 0; i < size; ++i)
+  {
+    Descriptor& descriptor{stream->descriptors.emplace_back()};
+    std::string data;
+    ar >> descriptor.tag >> descriptor.length >> data;
+    descriptor.data.resize(data.size());
+    std::ranges::transform(data, descriptor.data.begin(),
+                           [](char c) { return static_cast<std::byte>(c); });
+  }
+  ar >> stream->seen >> stream->completed;
+
+  if (audio)
+    ar >> audio->channels >> audio->sampleRate >> audio->isXLL >> audio->hasSubstream >>
+        audio->isXLLX >> audio->isXLLXIMAX >> audio->hasDependantStream >> audio->isAtmos;
+  else if (video)
+    ar >> video->height >> video->width >> video->bitDepth >> video->aspectRatio >> video->is3d >>
+        video->hdr10 >> video->hdr10Plus >> video->dolbyVision >> video->isEnhancementLayer;
+
+  return stream;
+}
+
+bool ReadCacheFile(const std::string& id, Disc& disc)
+{
+  const std::string cacheFile{GetCacheFile(id)};
+  CFile file;
+  if (!CFile::Exists(cacheFile) || !file.Open(cacheFile))
+    return false;
+
+  try
+  {
+    CArchive ar(&file, CArchive::load);
+    int version;
+    std::string storedId;
+    ar >> version;
+    if (version != BLURAY_CACHE_VERSION)
+      return false;
+    ar >> storedId;
+    if (storedId != id)
+      return false;
+
+    unsigned int size;
+    ar >> size;
+    for (unsigned int i = 0; i < size; ++i)
+    {
+      unsigned int playlist;
+      ar >> playlist;
+      Read(ar, disc.playlists[playlist]);
+    }
+
+    ar >> size;
+    for (unsigned int i = 0; i < size; ++i)
+    {
+      unsigned int playlist;
+      unsigned int streams;
+      ar >> playlist >> streams;
+      StreamMap& streamMap{disc.streamMap[playlist]};
+      for (unsigned int j = 0; j < streams; ++j)
+      {
+        unsigned int pid;
+        ar >> pid;
+        streamMap[pid] = ReadStream(ar);
+      }
+    }
+  }
+  catch (const std::out_of_range&)
+  {
+    CLog::LogF(LOGERROR, "Corrupt cache file {}", cacheFile);
+    return false;
+  }
+  return true;
+}
+
+void WriteCacheFile(const std::string& id, const Disc& disc)
+{
+  const std::string cacheFile{GetCacheFile(id)};
+  CFile file;
+  if (!file.OpenForWrite(cacheFile, true))
+  {
+    CLog::LogF(LOGWARNING, "Unable to write {}", cacheFile);
+    return;
+  }
+
+  CArchive ar(&file, CArchive::store);
+  ar << BLURAY_CACHE_VERSION;
+  ar << id;
+
+  ar << static_cast<unsigned int>(disc.playlists.size());
+  for (const auto& [playlist, info] : disc.playlists)
+  {
+    ar << playlist;
+    Write(ar, info);
+  }
+
+  ar << static_cast<unsigned int>(disc.streamMap.size());
+  for (const auto& [playlist, streams] : disc.streamMap)
+  {
+    ar << playlist << static_cast<unsigned int>(streams.size());
+    for (const auto& [pid, stream] : streams)
+    {
+      ar << pid;
+      Write(ar, *stream);
+    }
+  }
+  ar.Close();
+}
+
+void PruneCacheFiles()
+{
+  CFileItemList items;
+  if (!CDirectory::GetDirectory(CACHE_PATH, items, ".cache", DIR_FLAG_NO_FILE_DIRS))
+    return;
+
+  const CDateTime oldest{CDateTime::GetCurrentDateTime() -
+                         CDateTimeSpan(MAX_CACHE_AGE_DAYS, 0, 0, 0)};
+  items.Sort(SortByDate, SortOrderDescending);
+  for (int i = 0; i < items.Size(); ++i)
+  {
+    const auto& item{items[i]};
+    if (i >= MAX_CACHE_FILES || item->GetDateTime() < oldest)
+    {
+      CLog::LogF(LOGDEBUG, "Removing {}", item->GetPath());
+      CFile::Delete(item->GetPath());
+    }
+  }
+}
+} // namespace
 
 CacheMap::iterator CBlurayDiscCache::SetDisc(const std::string& path)
 {
@@ -42,6 +504,7 @@ void CBlurayDiscCache::SetPlaylistInfo(const std::string& path,
     i = SetDisc(path);
   auto& [_, disc] = *i;
   disc.playlists[playlist] = playlistInfo;
+  disc.changed = true;
 }
 
 void CBlurayDiscCache::SetMaps(const std::string& path,
@@ -78,12 +541,15 @@ void CBlurayDiscCache::SetPlaylistStreamInfo(const std::string& path,
     i = SetDisc(path);
   auto& [_, disc] = *i;
   disc.streamMap[playlist] = streams;
+  disc.changed = true;
 }
 
 bool CBlurayDiscCache::GetPlaylistInfo(const std::string& path,
                                        unsigned int playlist,
-                                       BlurayPlaylistInformation& playlistInfo) const
+                                       BlurayPlaylistInformation& playlistInfo)
 {
+  Load(path);
+
   std::unique_lock lock(m_cs);
 
   // Get rid of any URL options, else the compare may be wrong
@@ -129,8 +595,10 @@ bool CBlurayDiscCache::GetMaps(const std::string& path,
 
 bool CBlurayDiscCache::GetPlaylistStreamInfo(const std::string& path,
                                              unsigned int playlist,
-                                             StreamMap& streams) const
+                                             StreamMap& streams)
 {
+  Load(path);
+
   std::unique_lock lock(m_cs);
 
   // Get rid of any URL options, else the compare may be wrong
@@ -167,3 +635,84 @@ void CBlurayDiscCache::Clear()
   std::unique_lock lock(m_cs);
   m_cache.clear();
 }
+
+void CBlurayDiscCache::Load(const std::string& path)
+{
+  const std::string storedPath{GetStoredPath(path)};
+  {
+    std::unique_lock lock(m_cs);
+    Disc& disc{m_cache[storedPath]};
+    if (disc.loaded)
+      return;
+    disc.loaded = true;
+  }
+
+  // Read without holding the lock, the disc may be on a slow share
+  const std::string id{GetDiscId(storedPath)};
+  if (id.empty())
+    return;
+  Disc stored;
+  const bool found{ReadCacheFile(id, stored)};
+
+  std::unique_lock lock(m_cs);
+  Disc& disc{m_cache[storedPath]};
+  disc.id = id;
+  if (!found)
+    return;
+
+  // Anything parsed meanwhile is kept
+  disc.playlists.merge(stored.playlists);
+  disc.streamMap.merge(stored.streamMap);
+  CLog::LogF(LOGDEBUG, "Playlist information for {} loaded from {}", storedPath, GetCacheFile(id));
+}
+
+void CBlurayDiscCache::Save(const std::string& path)
+{
+  Disc disc;
+  {
+    std::unique_lock lock(m_cs);
+    const auto i{m_cache.find(GetStoredPath(path))};
+    if (i == m_cache.end() || !i->second.changed || i->second.id.empty())
+      return;
+    i->second.changed = false;
+    disc.id = i->second.id;
+    disc.playlists = i->second.playlists;
+    disc.streamMap = i->second.streamMap;
+  }
+
+  WriteCacheFile(disc.id, disc);
+  PruneCacheFiles();
+}
+
+std::string CBlurayDiscCache::GetDiscId(const std::string& path)
+{
+  CDigest digest{CDigest::Type::SHA256};
+  CFile file;
+  std::vector<uint8_t> buffer;
+  for (const char* name : {"index.bdmv", "MovieObject.bdmv"})
+  {
+    if (file.LoadFile(URIUtils::AddFileToFolder(path, "BDMV", name), buffer) <= 0)
+      return "";
+    digest.Update(buffer.data(), buffer.size());
+  }
+
+  // The disc ID in the certificate tells apart discs sharing the same navigation files, like
+  // editions or regional releases. It's missing on discs without AACS.
+  if (file.LoadFile(URIUtils::AddFileToFolder(path, "CERTIFICATE", "id.bdmv"), buffer) > 0)
+    digest.Update(buffer.data(), buffer.size());
+
+  for (const auto& [folder, extension] : {std::pair{"PLAYLIST", ".mpls"}, {"STREAM", ".m2ts"}})
+  {
+    CFileItemList items;
+    if (!CDirectory::GetDirectory(URIUtils::AddFileToFolder(path, "BDMV", folder, ""), items,
+                                  extension, DIR_FLAG_NO_FILE_DIRS))
+      return "";
+    items.Sort(SortByFile, SortOrderAscending);
+    for (const auto& item : items)
+      digest.Update(StringUtils::Format(
+          "{}:{}\n", StringUtils::ToLower(URIUtils::GetFileName(item->GetPath())),
+          item->GetSize()));
+  }
+
+  return digest.Finalize();
+}
@@ -25,6 +25,11 @@ struct Disc
   XFILE::ClipMap clipMap;
 
   std::map<unsigned int, XFILE::StreamMap, std::less<>> streamMap;
+
+  // Persistence of the playlist and stream information, the maps are derived from them
+  bool loaded{false};
+  bool changed{false};
+  std::string id;
 };
 
 using CacheMapEntry = std::pair<std::string, Disc>;
@@ -32,6 +37,14 @@ using CacheMap = std::map<std::string, Disc, std::less<>>;
 
 namespace XFILE
 {
+/*!
+ * \brief Keeps the playlist and clip analysis of Blu-ray discs.
+ *
+ * The parsed playlists (durations, chapters, clips) and the streams found in the clips are also
+ * stored per disc ID in special://temp/bluraycache, so a disc opened again doesn't need all its
+ * MPLS, CLPI and M2TS files read. The disc ID is a digest of the disc structure, see GetDiscId().
+ * Files of discs not saved for a long time and the oldest beyond a limit are removed on Save().
+ */
 class CBlurayDiscCache
 {
 public:
@@ -53,15 +66,30 @@ public:
 
   bool GetPlaylistInfo(const std::string& path,
                        unsigned int playlist,
-                       BlurayPlaylistInformation& playlistInfo) const;
+                       BlurayPlaylistInformation& playlistInfo);
   bool GetMaps(const std::string& path, PlaylistMap& playlistmap, ClipMap& clipmap) const;
-  bool GetPlaylistStreamInfo(const std::string& path,
-                             unsigned int playlist,
-                             StreamMap& streams) const;
+  bool GetPlaylistStreamInfo(const std::string& path, unsigned int playlist, StreamMap& streams);
 
   void ClearDisc(const std::string& path);
 
+  /*!
+   * \brief Store the playlist and stream information of a disc gathered since it was loaded or
+   * last saved.
+   * \param path path of the disc as passed to the Set functions
+   */
+  void Save(const std::string& path);
+
+  /*!
+   * \brief Get the ID of a disc, a digest of index.bdmv, MovieObject.bdmv, the disc ID of the
+   * certificate if any and the names and sizes of the playlists and streams.
+   * \param path path of the disc, the folder holding BDMV
+   * \return the ID, empty if the disc can't be read
+   */
+  static std::string GetDiscId(const std::string& path);
+
 private:
+  void Load(const std::string& path);
+
   CacheMap m_cache;
 
   mutable CCriticalSection m_cs;
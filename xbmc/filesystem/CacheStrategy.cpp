@@ -48,6 +48,11 @@ void CCacheStrategy::ClearEndOfInput()
   m_bEndOfInput = false;
 }
 
+int CCacheStrategy::WriteToCacheAt(int64_t iFilePosition, const char* pBuffer, size_t iSize)
+{
+  return CACHE_RC_ERROR;
+}
+
 CSimpleFileCache::CSimpleFileCache()
   : m_cacheFileRead(new CacheLocalFile())
   , m_cacheFileWrite(new CacheLocalFile())
@@ -337,6 +342,11 @@ int64_t CDoubleCache::WaitForData(uint32_t iMinAvail, std::chrono::milliseconds
   return m_pCache->WaitForData(iMinAvail, timeout);
 }
 
+int CDoubleCache::WriteToCacheAt(int64_t iFilePosition, const char* pBuffer, size_t iSize)
+{
+  return m_pCache->WriteToCacheAt(iFilePosition, pBuffer, iSize);
+}
+
 int64_t CDoubleCache::Seek(int64_t iFilePosition)
 {
   /* Check whether position is NOT in our current cache but IS in our old cache.
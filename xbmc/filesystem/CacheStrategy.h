@@ -34,6 +34,15 @@ public:
   virtual int ReadFromCache(char *pBuffer, size_t iMaxSize) = 0;
   virtual int64_t WaitForData(uint32_t iMinAvail, std::chrono::milliseconds timeout) = 0;
 
+  /*!
+   \brief Store data for a position outside of the range currently being filled
+   \param iFilePosition position in file of the data
+   \param pBuffer data to store
+   \param iSize size of the data
+   \return number of bytes stored (may be less than iSize), CACHE_RC_ERROR when not supported
+   */
+  virtual int WriteToCacheAt(int64_t iFilePosition, const char* pBuffer, size_t iSize);
+
   virtual int64_t Seek(int64_t iFilePosition) = 0;
 
   /*!
@@ -110,6 +119,7 @@ public:
   int WriteToCache(const char *pBuffer, size_t iSize) override;
   int ReadFromCache(char *pBuffer, size_t iMaxSize) override;
   int64_t WaitForData(uint32_t iMinAvail, std::chrono::milliseconds timeout) override;
+  int WriteToCacheAt(int64_t iFilePosition, const char* pBuffer, size_t iSize) override;
 
   int64_t Seek(int64_t iFilePosition) override;
   bool Reset(int64_t iSourcePosition) override;
@@ -0,0 +1,227 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "CircularFileCache.h"
+
+#include "SpecialProtocol.h"
+#include "URL.h"
+#include "Util.h"
+#include "threads/SystemClock.h"
+#include "utils/log.h"
+#if defined(TARGET_POSIX)
+#include "platform/posix/filesystem/PosixFile.h"
+#define CacheLocalFile CPosixFile
+#elif defined(TARGET_WINDOWS)
+#include "platform/win32/filesystem/Win32File.h"
+#define CacheLocalFile CWin32File
+#endif // TARGET_WINDOWS
+
+#include <algorithm>
+#include <mutex>
+
+using namespace XFILE;
+using namespace std::chrono_literals;
+
+CCircularFileCache::CCircularFileCache(size_t size)
+  : m_size(size),
+    m_cacheFileRead(std::make_unique<CacheLocalFile>()),
+    m_cacheFileWrite(std::make_unique<CacheLocalFile>())
+{
+}
+
+CCircularFileCache::~CCircularFileCache()
+{
+  Close();
+}
+
+int CCircularFileCache::Open()
+{
+  Close();
+
+  m_filename = CSpecialProtocol::TranslatePath(
+      CUtil::GetNextFilename("special://temp/ringcache{:03}.cache", 999));
+  if (m_filename.empty())
+  {
+    CLog::LogF(LOGERROR, "Unable to generate a new filename");
+    return CACHE_RC_ERROR;
+  }
+
+  const CURL fileURL(m_filename);
+  if (!m_cacheFileWrite->OpenForWrite(fileURL, false) || !m_cacheFileRead->Open(fileURL))
+  {
+    CLog::LogF(LOGERROR, "Failed to create cache file \"{}\"", m_filename);
+    Close();
+    return CACHE_RC_ERROR;
+  }
+
+  m_beg = 0;
+  m_end = 0;
+  m_cur = 0;
+  return CACHE_RC_OK;
+}
+
+void CCircularFileCache::Close()
+{
+  m_cacheFileWrite->Close();
+  m_cacheFileRead->Close();
+
+  if (!m_filename.empty() && !m_cacheFileRead->Delete(CURL(m_filename)))
+    CLog::LogF(LOGWARNING, "Failed to delete cache file \"{}\"", m_filename);
+
+  m_filename.clear();
+}
+
+size_t CCircularFileCache::GetMaxWriteSize(const size_t& iRequestSize)
+{
+  // old data gets overwritten, so there's always space
+  return std::min(iRequestSize, m_size);
+}
+
+/**
+ * Writes to the file at m_end % m_size. Writes at most up to the wrap point of the ring, so
+ * multiple calls may be needed to write all data.
+ */
+int CCircularFileCache::WriteToCache(const char* buf, size_t len)
+{
+  std::unique_lock lock(m_sync);
+
+  const size_t pos = m_end % m_size;
+  len = std::min(len, m_size - pos);
+  if (len == 0)
+    return 0;
+
+  if (m_cacheFileWrite->Seek(pos, SEEK_SET) != static_cast<int64_t>(pos) ||
+      m_cacheFileWrite->Write(buf, len) != static_cast<ssize_t>(len))
+  {
+    CLog::LogF(LOGERROR, "Failed to write to cache file \"{}\"", m_filename);
+    return CACHE_RC_ERROR;
+  }
+  m_end += len;
+
+  // drop the data that was overwritten, even if it hasn't been read yet
+  if (m_end - m_beg > static_cast<int64_t>(m_size))
+  {
+    m_beg = m_end - m_size;
+    m_cur = std::max(m_cur, m_beg);
+  }
+
+  m_written.Set();
+  return static_cast<int>(len);
+}
+
+/**
+ * Reads from the file at m_cur % m_size. Reads at most up to the wrap point of the ring, so
+ * multiple calls may be needed to read all data available.
+ */
+int CCircularFileCache::ReadFromCache(char* buf, size_t len)
+{
+  std::unique_lock lock(m_sync);
+
+  const size_t pos = m_cur % m_size;
+  len = std::min({len, m_size - pos, static_cast<size_t>(m_end - m_cur)});
+  if (len == 0)
+    return IsEndOfInput() ? 0 : CACHE_RC_WOULD_BLOCK;
+
+  if (m_cacheFileRead->Seek(pos, SEEK_SET) != static_cast<int64_t>(pos))
+    return CACHE_RC_ERROR;
+
+  const ssize_t read = m_cacheFileRead->Read(buf, len);
+  if (read <= 0)
+  {
+    CLog::LogF(LOGERROR, "Failed to read from cache file \"{}\"", m_filename);
+    return CACHE_RC_ERROR;
+  }
+  m_cur += read;
+
+  m_space.Set();
+  return static_cast<int>(read);
+}
+
+int64_t CCircularFileCache::WaitForData(uint32_t minimum, std::chrono::milliseconds timeout)
+{
+  std::unique_lock lock(m_sync);
+  int64_t avail = m_end - m_cur;
+
+  if (timeout == 0ms || IsEndOfInput())
+    return avail;
+
+  minimum = std::min(minimum, static_cast<uint32_t>(std::min<size_t>(m_size, UINT32_MAX)));
+
+  XbmcThreads::EndTime<> endtime{timeout};
+  while (!IsEndOfInput() && avail < minimum && !endtime.IsTimePast())
+  {
+    lock.unlock();
+    m_written.Wait(50ms); // may miss the deadline. shouldn't be a problem.
+    lock.lock();
+    avail = m_end - m_cur;
+  }
+
+  return avail;
+}
+
+int64_t CCircularFileCache::Seek(int64_t pos)
+{
+  std::unique_lock lock(m_sync);
+  if (!IsCachedPosition(pos))
+    return CACHE_RC_ERROR;
+
+  m_cur = pos;
+  return pos;
+}
+
+bool CCircularFileCache::Reset(int64_t pos)
+{
+  std::unique_lock lock(m_sync);
+  if (IsCachedPosition(pos))
+  {
+    m_cur = pos;
+    return false;
+  }
+  m_end = pos;
+  m_beg = pos;
+  m_cur = pos;
+
+  return true;
+}
+
+int64_t CCircularFileCache::CachedDataEndPosIfSeekTo(int64_t iFilePosition)
+{
+  std::unique_lock lock(m_sync);
+  if (IsCachedPosition(iFilePosition))
+    return m_end;
+  return iFilePosition;
+}
+
+int64_t CCircularFileCache::CachedDataStartPos()
+{
+  std::unique_lock lock(m_sync);
+  return m_beg;
+}
+
+int64_t CCircularFileCache::CachedDataEndPos()
+{
+  std::unique_lock lock(m_sync);
+  return m_end;
+}
+
+bool CCircularFileCache::IsCachedPosition(int64_t iFilePosition)
+{
+  std::unique_lock lock(m_sync);
+  return iFilePosition >= m_beg && iFilePosition <= m_end;
+}
+
+int64_t CCircularFileCache::GetReadPosition()
+{
+  std::unique_lock lock(m_sync);
+  return m_cur;
+}
+
+CCacheStrategy* CCircularFileCache::CreateNew()
+{
+  return new CCircularFileCache(m_size);
+}
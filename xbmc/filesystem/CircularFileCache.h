@@ -0,0 +1,70 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "CacheStrategy.h"
+#include "threads/CriticalSection.h"
+#include "threads/Event.h"
+
+#include <memory>
+#include <string>
+
+namespace XFILE
+{
+
+/*!
+ \brief Cache of bounded size in a local file, used as a ring.
+
+ Unlike CCircularCache, writing never blocks: once the ring is full, the oldest data gets
+ overwritten, even if it hasn't been read yet. A reader that falls that far behind continues with
+ the oldest data still available. This suits live streams, which can't be held back, e.g. for
+ client-side timeshift.
+ */
+class CCircularFileCache : public CCacheStrategy
+{
+public:
+  explicit CCircularFileCache(size_t size);
+  ~CCircularFileCache() override;
+
+  int Open() override;
+  void Close() override;
+
+  size_t GetMaxWriteSize(const size_t& iRequestSize) override;
+  int WriteToCache(const char* buf, size_t len) override;
+  int ReadFromCache(char* buf, size_t len) override;
+  int64_t WaitForData(uint32_t minimum, std::chrono::milliseconds timeout) override;
+
+  int64_t Seek(int64_t pos) override;
+  bool Reset(int64_t pos) override;
+
+  int64_t CachedDataEndPosIfSeekTo(int64_t iFilePosition) override;
+  int64_t CachedDataStartPos() override;
+  int64_t CachedDataEndPos() override;
+  bool IsCachedPosition(int64_t iFilePosition) override;
+
+  CCacheStrategy* CreateNew() override;
+
+  /*!
+   \brief Get the current read position.
+   */
+  int64_t GetReadPosition();
+
+private:
+  int64_t m_beg = 0; /**< index in file (not ring) of beginning of valid data */
+  int64_t m_end = 0; /**< index in file (not ring) of end of valid data */
+  int64_t m_cur = 0; /**< current reading index in file */
+  const size_t m_size; /**< size of the ring */
+  std::string m_filename;
+  std::unique_ptr<IFile> m_cacheFileRead;
+  std::unique_ptr<IFile> m_cacheFileWrite;
+  CCriticalSection m_sync;
+  CEvent m_written;
+};
+
+} // namespace XFILE
@@ -8,7 +8,10 @@
 
 #include "CurlFile.h"
 
+#include "CurlRangeReader.h"
 #include "File.h"
+#include "FileFactory.h"
+#include "HttpCache.h"
 #include "ServiceBroker.h"
 #include "URL.h"
 #include "filesystem/SpecialProtocol.h"
@@ -58,6 +61,12 @@ constexpr auto proxyType2CUrlProxyType{make_map<XFILE::CCurlFile::ProxyType, lon
 
 std::vector<uint8_t> cachedCaCertsBlob; // cached CA certs file
 
+bool IsHttpCacheable(const CURL& url)
+{
+  return (url.IsProtocol("http") || url.IsProtocol("https")) &&
+         !url.HasProtocolOption("postdata") && CHttpCache::IsEnabled();
+}
+
 } // unnamed namespace
 
 #define FILLBUFFER_OK         0
@@ -463,6 +472,7 @@ void CCurlFile::Close()
   if (m_opened && m_forWrite && !m_inError)
       Write(NULL, 0);
 
+  m_rangeReader.reset();
   m_state->Disconnect();
   delete m_oldState;
   m_oldState = NULL;
@@ -697,6 +707,10 @@ void CCurlFile::SetCommonOptions(CReadState* state, bool failOnError /* = true *
     // enable HTTP2 support. default: CURL_HTTP_VERSION_1_1. Curl >= 7.62.0 defaults to CURL_HTTP_VERSION_2TLS
     g_curlInterface.easy_setopt(h, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
 
+  // dns cache and tls sessions are shared by all handles, reset with the options
+  if (CURLSH* share = g_curlInterface.GetShare())
+    g_curlInterface.easy_setopt(h, CURLOPT_SHARE, share);
+
   // set CA bundle file
   std::string caCert = CSpecialProtocol::TranslatePath(
       CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_caTrustFile);
@@ -938,6 +952,10 @@ void CCurlFile::ParseAndCorrectUrl(CURL &url2)
           if (value == "false")
             m_verifyPeer = false;
         }
+        else if (name == "httpcache")
+        {
+          // handled by Open()
+        }
         else
         {
           if (!name.empty() && name[0] == '!')
@@ -987,6 +1005,9 @@ bool CCurlFile::Get(const std::string& strURL, std::string& strHTML)
 bool CCurlFile::Service(const std::string& strURL, std::string& strHTML)
 {
   const CURL pathToUrl(strURL);
+  if (m_useHttpCache && !m_postdataset && IsHttpCacheable(pathToUrl))
+    return ServiceCached(strURL, strHTML);
+
   if (Open(pathToUrl))
   {
     if (ReadData(strHTML))
@@ -999,6 +1020,79 @@ bool CCurlFile::Service(const std::string& strURL, std::string& strHTML)
   return false;
 }
 
+bool CCurlFile::ServiceCached(const std::string& strURL, std::string& strHTML)
+{
+  const CURL pathToUrl(strURL);
+  CHttpCache::Entry entry;
+  std::string body;
+  // an entry without a complete body is fetched again, it can't be revalidated
+  const bool cached = CHttpCache::Lookup(strURL, entry) && CHttpCache::LoadBody(entry, body);
+  if (cached && entry.IsFresh())
+  {
+    strHTML = std::move(body);
+    CLog::LogFC(LOGDEBUG, LOGCURL, "<{}> Using cached response", CURL::GetRedacted(strURL));
+    m_state->m_httpheader.Clear();
+    m_state->m_httpheader.Parse(entry.header);
+    m_httpresponse = 200;
+    return true;
+  }
+
+  const bool revalidate = cached && entry.CanRevalidate();
+  if (revalidate)
+  {
+    if (!entry.etag.empty())
+      SetRequestHeader("If-None-Match", entry.etag);
+    if (!entry.lastModified.empty())
+      SetRequestHeader("If-Modified-Since", entry.lastModified);
+  }
+
+  bool result = Open(pathToUrl) && ReadData(strHTML);
+  if (revalidate)
+  {
+    m_requestheaders.erase("If-None-Match");
+    m_requestheaders.erase("If-Modified-Since");
+  }
+
+  if (result && revalidate && m_httpresponse == 304)
+  {
+    CLog::LogFC(LOGDEBUG, LOGCURL, "<{}> Cached response revalidated", CURL::GetRedacted(strURL));
+    CHttpCache::Revalidated(strURL, entry, m_state->m_httpheader);
+    strHTML = std::move(body);
+    m_state->m_httpheader.Clear();
+    m_state->m_httpheader.Parse(entry.header);
+    m_httpresponse = 200;
+  }
+  else if (result && m_httpresponse == 200)
+    CHttpCache::Store(strURL, m_state->m_httpheader, strHTML);
+
+  Close();
+  return result;
+}
+
+void CCurlFile::OpenCached(const CURL& url)
+{
+  CURL uncached(url);
+  uncached.RemoveProtocolOption("httpcache");
+  const std::string strURL = uncached.Get();
+
+  // fetch the response into the cache unless it's fresh there already, then hand out the cached
+  // body instead. Responses which can't be cached are requested again by a regular open.
+  CHttpCache::Entry entry;
+  if (!CHttpCache::Lookup(strURL, entry) || !entry.IsFresh())
+  {
+    CCurlFile http;
+    http.SetUseHttpCache(true);
+    std::string content;
+    if (!http.Get(strURL, content) || !CHttpCache::Lookup(strURL, entry))
+      return;
+  }
+
+  CURL cachedUrl(entry.bodyFile);
+  IFile* file = CFileFactory::CreateLoader(cachedUrl);
+  if (file)
+    throw new CRedirectException(file, new CURL(cachedUrl));
+}
+
 bool CCurlFile::ReadData(std::string& strHTML)
 {
   int size_read = 0;
@@ -1099,6 +1193,9 @@ bool CCurlFile::Open(const CURL& url)
   m_opened = true;
   m_seekable = true;
 
+  if (url.GetProtocolOption("httpcache") == "true" && IsHttpCacheable(url))
+    OpenCached(url);
+
   CURL url2(url);
   ParseAndCorrectUrl(url2);
 
@@ -1286,6 +1383,25 @@ ssize_t CCurlFile::Write(const void* lpBuf, size_t uiBufSize)
   return m_state->m_filePos;
 }
 
+ssize_t CCurlFile::Read(void* lpBuf, size_t uiBufSize)
+{
+  if (!m_rangeReader)
+    return m_state->Read(lpBuf, uiBufSize);
+
+  const ssize_t read = m_rangeReader->Read(lpBuf, uiBufSize);
+  if (read > 0)
+    m_state->m_filePos += read;
+  return read;
+}
+
+CCurlFile::ReadLineResult CCurlFile::ReadLine(char* buffer, std::size_t bufferSize)
+{
+  if (m_rangeReader)
+    return IFile::ReadLine(buffer, bufferSize);
+
+  return m_state->ReadLine(buffer, bufferSize);
+}
+
 CCurlFile::ReadLineResult CCurlFile::CReadState::ReadLine(char* buffer, std::size_t bufferSize)
 {
   unsigned int want = (unsigned int)bufferSize - 1; // leave one byte for '\0'
@@ -1458,6 +1574,14 @@ int64_t CCurlFile::Seek(int64_t iFilePosition, int iWhence)
   // We can't seek beyond EOF
   if (m_state->m_fileSize && nextPos > m_state->m_fileSize) return -1;
 
+  if (m_rangeReader)
+  {
+    if (!m_rangeReader->Seek(nextPos))
+      return -1;
+    m_state->m_filePos = nextPos;
+    return nextPos;
+  }
+
   if(m_state->Seek(nextPos))
     return nextPos;
 
@@ -2130,9 +2254,52 @@ int CCurlFile::IoControl(IOControl request, void* param)
     return 0;
   }
 
+  if (request == IOControl::SET_CACHE)
+  {
+    // only worth the extra connections when a cache consumes the stream
+    StartRangeReader();
+    return 0;
+  }
+
   return -1;
 }
 
+void CCurlFile::StartRangeReader()
+{
+  const auto advancedSettings = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+  const unsigned int connections = advancedSettings->m_curlParallelConnections;
+  if (connections < 2 || m_rangeReader || !m_opened || m_forWrite || !m_seekable ||
+      !m_multisession)
+    return;
+
+  // the server has to advertise byte ranges explicitly
+  if (!StringUtils::EqualsNoCase(m_state->m_httpheader.GetValue("Accept-Ranges"), "bytes"))
+    return;
+
+  const size_t segmentSize = CCurlRangeReader::DEFAULT_SEGMENT_SIZE;
+  if (m_state->m_fileSize < static_cast<int64_t>(segmentSize * connections))
+    return;
+
+  auto reader = std::make_unique<CCurlRangeReader>(m_state->m_easyHandle, m_url,
+                                                   m_state->m_fileSize, connections, segmentSize,
+                                                   advancedSettings->m_curlretries);
+  if (!reader->Open(m_state->m_filePos))
+  {
+    CLog::Log(LOGDEBUG,
+              "CCurlFile::{} - <{}> parallel range requests failed, using a single connection",
+              __FUNCTION__, CURL::GetRedacted(m_url));
+    return;
+  }
+
+  // the main transfer is no longer needed, only its headers are still used
+  g_curlInterface.multi_remove_handle(m_state->m_multiHandle, m_state->m_easyHandle);
+  m_state->m_buffer.Clear();
+
+  CLog::Log(LOGDEBUG, "CCurlFile::{} - <{}> using {} parallel range requests", __FUNCTION__,
+            CURL::GetRedacted(m_url), connections);
+  m_rangeReader = std::move(reader);
+}
+
 const std::string CCurlFile::GetProperty(XFILE::FileProperty type, const std::string &name) const
 {
   switch (type)
@@ -13,6 +13,7 @@
 #include "utils/RingBuffer.h"
 
 #include <map>
+#include <memory>
 #include <string>
 
 typedef void CURL_HANDLE;
@@ -21,6 +22,8 @@ struct curl_slist;
 
 namespace XFILE
 {
+  class CCurlRangeReader;
+
   class CCurlFile : public IFile
   {
     private:
@@ -46,11 +49,8 @@ namespace XFILE
       int64_t GetLength() override;
       int Stat(const CURL& url, struct __stat64* buffer) override;
       void Close() override;
-      ReadLineResult ReadLine(char* buffer, std::size_t bufferSize) override
-      {
-        return m_state->ReadLine(buffer, bufferSize);
-      }
-      ssize_t Read(void* lpBuf, size_t uiBufSize) override { return m_state->Read(lpBuf, uiBufSize); }
+      ReadLineResult ReadLine(char* buffer, std::size_t bufferSize) override;
+      ssize_t Read(void* lpBuf, size_t uiBufSize) override;
       ssize_t Write(const void* lpBuf, size_t uiBufSize) override;
       const std::string GetProperty(XFILE::FileProperty type, const std::string &name = "") const override;
       const std::vector<std::string> GetPropertyValues(XFILE::FileProperty type, const std::string &name = "") const override;
@@ -78,6 +78,12 @@ namespace XFILE
       void SetMimeType(const std::string& mimetype) { SetRequestHeader("Content-Type", mimetype); }
       void SetRequestHeader(const std::string& header, const std::string& value);
       void SetRequestHeader(const std::string& header, long value);
+      /*!
+       \brief Serve Get() requests from the http response cache while fresh, and revalidate them
+       once stale, see CHttpCache. Files opened with the "httpcache=true" protocol option are read
+       through the cache as well.
+       */
+      void SetUseHttpCache(bool useHttpCache) { m_useHttpCache = useHttpCache; }
 
       void ClearRequestHeaders();
       void SetBufferSize(unsigned int size);
@@ -150,11 +156,15 @@ namespace XFILE
       void SetRequestHeaders(CReadState* state);
       void SetCorrectHeaders(CReadState* state);
       bool Service(const std::string& strURL, std::string& strHTML);
+      bool ServiceCached(const std::string& strURL, std::string& strHTML);
+      void OpenCached(const CURL& url);
       std::string GetInfoString(int infoType);
+      void StartRangeReader();
 
     protected:
       CReadState* m_state;
       CReadState* m_oldState;
+      std::unique_ptr<CCurlRangeReader> m_rangeReader; // parallel range requests, if enabled
       unsigned int m_bufferSize;
       int64_t m_writeOffset = 0;
 
@@ -192,6 +202,7 @@ namespace XFILE
       bool m_allowRetry;
       bool m_verifyPeer = true;
       bool m_failOnError = true;
+      bool m_useHttpCache = false;
       curl_slist* m_dnsCacheList = nullptr;
 
       CRingBuffer m_buffer; // our ringhold buffer
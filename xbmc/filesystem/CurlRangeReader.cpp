@@ -0,0 +1,299 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "CurlRangeReader.h"
+
+#include "DllLibCurl.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <string.h>
+
+using namespace XFILE;
+using namespace XCURL;
+
+using namespace std::chrono_literals;
+
+CCurlRangeReader::CCurlRangeReader(CURL_HANDLE* templateHandle,
+                                   std::string url,
+                                   int64_t fileSize,
+                                   unsigned int connections,
+                                   size_t segmentSize,
+                                   int retries)
+  : m_template(templateHandle),
+    m_url(std::move(url)),
+    m_fileSize(fileSize),
+    m_connections(std::max(connections, 1u)),
+    m_segmentSize(segmentSize),
+    m_retries(retries)
+{
+}
+
+CCurlRangeReader::~CCurlRangeReader()
+{
+  Stop();
+
+  for (CURL_HANDLE* easy : m_idleHandles)
+    g_curlInterface.easy_release(&easy, nullptr);
+  m_idleHandles.clear();
+
+  if (m_multiHandle)
+    g_curlInterface.multi_cleanup(m_multiHandle);
+}
+
+size_t CCurlRangeReader::WriteCallback(char* buffer, size_t size, size_t nitems, void* userp)
+{
+  Segment* segment = static_cast<Segment*>(userp);
+  const size_t amount = size * nitems;
+
+  if (!segment->verified)
+  {
+    // a server ignoring the range answers with the whole file, stop right away in that case
+    long response = 0;
+    g_curlInterface.easy_getinfo(segment->easy, CURLINFO_RESPONSE_CODE, &response);
+    if (response != 206)
+    {
+      CLog::Log(LOGDEBUG, "CCurlRangeReader::{} - ({}) range request answered with code {}",
+                __FUNCTION__, fmt::ptr(segment->reader), response);
+      segment->reader->m_rangeUnsupported = true;
+      return 0;
+    }
+    segment->verified = true;
+  }
+
+  if (segment->data.size() + amount > segment->size)
+  {
+    CLog::Log(LOGERROR, "CCurlRangeReader::{} - ({}) server sent more data than requested",
+              __FUNCTION__, fmt::ptr(segment->reader));
+    segment->reader->m_rangeUnsupported = true;
+    return 0;
+  }
+
+  segment->data.insert(segment->data.end(), buffer, buffer + amount);
+  return amount;
+}
+
+bool CCurlRangeReader::Open(int64_t position)
+{
+  if (!m_multiHandle)
+    m_multiHandle = g_curlInterface.multi_init();
+  if (!m_multiHandle)
+    return false;
+
+  m_position = position;
+  m_nextStart = position;
+  Schedule();
+
+  while (!m_segments.empty() && m_segments.front()->data.empty() && !m_segments.front()->done &&
+         !m_segments.front()->failed && !m_rangeUnsupported)
+  {
+    if (!Perform(200ms))
+      return false;
+  }
+
+  if (m_segments.empty() || m_segments.front()->failed || m_rangeUnsupported)
+  {
+    Stop();
+    return false;
+  }
+
+  CLog::Log(LOGDEBUG, "CCurlRangeReader::{} - ({}) using {} connections of {} bytes", __FUNCTION__,
+            fmt::ptr(this), m_connections, m_segmentSize);
+  return true;
+}
+
+void CCurlRangeReader::Schedule()
+{
+  while (m_segments.size() < m_connections && m_nextStart < m_fileSize)
+  {
+    auto segment = std::make_unique<Segment>();
+    segment->reader = this;
+    segment->start = m_nextStart;
+    segment->size = static_cast<size_t>(
+        std::min(static_cast<int64_t>(m_segmentSize), m_fileSize - m_nextStart));
+    segment->data.reserve(segment->size);
+
+    if (!m_idleHandles.empty())
+    {
+      segment->easy = m_idleHandles.back();
+      m_idleHandles.pop_back();
+    }
+    else
+      g_curlInterface.easy_duplicate(m_template, nullptr, &segment->easy, nullptr);
+
+    if (!segment->easy || !Start(*segment))
+      segment->failed = true;
+
+    m_nextStart += segment->size;
+    m_segments.emplace_back(std::move(segment));
+  }
+}
+
+bool CCurlRangeReader::Start(Segment& segment)
+{
+  const int64_t from = segment.start + segment.data.size();
+  const int64_t to = segment.start + segment.size - 1;
+  const std::string range = std::to_string(from) + "-" + std::to_string(to);
+
+  CURL_HANDLE* h = segment.easy;
+  g_curlInterface.easy_setopt(h, CURLOPT_URL, m_url.c_str());
+  g_curlInterface.easy_setopt(h, CURLOPT_WRITEFUNCTION, WriteCallback);
+  g_curlInterface.easy_setopt(h, CURLOPT_WRITEDATA, &segment);
+  // headers are of no interest, they were already parsed by the main connection
+  g_curlInterface.easy_setopt(h, CURLOPT_HEADERFUNCTION, nullptr);
+  g_curlInterface.easy_setopt(h, CURLOPT_HEADERDATA, nullptr);
+  g_curlInterface.easy_setopt(h, CURLOPT_RESUME_FROM_LARGE, static_cast<curl_off_t>(0));
+  g_curlInterface.easy_setopt(h, CURLOPT_RANGE, range.c_str());
+
+  segment.verified = false;
+  segment.active = g_curlInterface.multi_add_handle(m_multiHandle, h) == CURLM_OK;
+  return segment.active;
+}
+
+void CCurlRangeReader::Release(Segment& segment)
+{
+  if (!segment.easy)
+    return;
+
+  if (segment.active)
+    g_curlInterface.multi_remove_handle(m_multiHandle, segment.easy);
+  segment.active = false;
+
+  m_idleHandles.push_back(segment.easy);
+  segment.easy = nullptr;
+}
+
+bool CCurlRangeReader::Perform(std::chrono::milliseconds timeout)
+{
+  int running = 0;
+  CURLMcode result = g_curlInterface.multi_perform(m_multiHandle, &running);
+  if (result != CURLM_OK && result != CURLM_CALL_MULTI_PERFORM)
+  {
+    CLog::Log(LOGERROR, "CCurlRangeReader::{} - ({}) Multi perform failed with code {}",
+              __FUNCTION__, fmt::ptr(this), result);
+    return false;
+  }
+
+  int msgs;
+  CURLMsg* msg;
+  while ((msg = g_curlInterface.multi_info_read(m_multiHandle, &msgs)))
+  {
+    if (msg->msg != CURLMSG_DONE)
+      continue;
+
+    auto it = std::find_if(m_segments.begin(), m_segments.end(), [msg](const auto& segment)
+                           { return segment->easy == msg->easy_handle; });
+    if (it == m_segments.end())
+      continue;
+
+    Segment& segment = **it;
+    const CURLcode code = msg->data.result;
+    g_curlInterface.multi_remove_handle(m_multiHandle, segment.easy);
+    segment.active = false;
+
+    if (code == CURLE_OK && segment.data.size() == segment.size)
+    {
+      segment.done = true;
+      continue;
+    }
+
+    if (!m_rangeUnsupported && segment.retries < m_retries)
+    {
+      segment.retries++;
+      CLog::Log(LOGWARNING,
+                "CCurlRangeReader::{} - ({}) segment at {} failed: {}({}), resume (re)try {}",
+                __FUNCTION__, fmt::ptr(this), segment.start, g_curlInterface.easy_strerror(code),
+                code, segment.retries);
+      if (Start(segment))
+        continue;
+    }
+
+    CLog::Log(LOGERROR, "CCurlRangeReader::{} - ({}) segment at {} failed: {}({})", __FUNCTION__,
+              fmt::ptr(this), segment.start, g_curlInterface.easy_strerror(code), code);
+    segment.failed = true;
+  }
+
+  if (running > 0 && result != CURLM_CALL_MULTI_PERFORM)
+  {
+    int numfds = 0;
+    g_curlInterface.multi_wait(m_multiHandle, static_cast<int>(timeout.count()), &numfds);
+  }
+
+  return true;
+}
+
+ssize_t CCurlRangeReader::Read(void* buffer, size_t size)
+{
+  while (true)
+  {
+    if (m_segments.empty())
+    {
+      if (m_position >= m_fileSize)
+        return 0;
+      Schedule();
+      if (m_segments.empty())
+        return -1;
+    }
+
+    Segment& head = *m_segments.front();
+    if (head.consumed < head.data.size())
+    {
+      const size_t amount = std::min(size, head.data.size() - head.consumed);
+      memcpy(buffer, head.data.data() + head.consumed, amount);
+      head.consumed += amount;
+      m_position += amount;
+
+      if (head.consumed == head.size)
+      {
+        Release(head);
+        m_segments.pop_front();
+        Schedule();
+      }
+      return amount;
+    }
+
+    if (head.failed)
+      return -1;
+
+    if (!Perform(200ms))
+      return -1;
+  }
+}
+
+bool CCurlRangeReader::Seek(int64_t position)
+{
+  if (position < 0 || position > m_fileSize)
+    return false;
+
+  // keep the segments that are still ahead of the new position
+  while (!m_segments.empty())
+  {
+    Segment& head = *m_segments.front();
+    if (position >= head.start && position < head.start + static_cast<int64_t>(head.size))
+    {
+      head.consumed = static_cast<size_t>(position - head.start);
+      m_position = position;
+      return true;
+    }
+
+    Release(head);
+    m_segments.pop_front();
+  }
+
+  m_position = position;
+  m_nextStart = position;
+  Schedule();
+  return true;
+}
+
+void CCurlRangeReader::Stop()
+{
+  for (auto& segment : m_segments)
+    Release(*segment);
+  m_segments.clear();
+}
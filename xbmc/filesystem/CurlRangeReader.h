@@ -0,0 +1,101 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <stdint.h>
+#include <string>
+#include <sys/types.h>
+#include <vector>
+
+typedef void CURL_HANDLE;
+typedef void CURLM;
+
+namespace XFILE
+{
+
+/*!
+ \brief Reads a file over several concurrent HTTP range requests.
+
+ Adjacent segments of the file are requested over separate easy handles that share one multi
+ handle. Data is handed out strictly in file order, so callers see a regular sequential stream.
+ All transfers are driven from the calling thread in Read().
+ */
+class CCurlRangeReader
+{
+public:
+  /*!
+   \param templateHandle configured easy handle whose options are copied for every connection
+   \param url the (effective) url to request the ranges from
+   \param fileSize total size of the file, must be known
+   \param connections number of concurrent range requests
+   \param segmentSize size of a single range request in bytes
+   \param retries number of times a failed segment is resumed before giving up
+   */
+  CCurlRangeReader(CURL_HANDLE* templateHandle,
+                   std::string url,
+                   int64_t fileSize,
+                   unsigned int connections,
+                   size_t segmentSize,
+                   int retries);
+  ~CCurlRangeReader();
+
+  /*!
+   \brief Start the transfers at the given position and verify the server honours ranges
+   \return true if the first segment was answered with partial content
+   */
+  bool Open(int64_t position);
+  ssize_t Read(void* buffer, size_t size);
+  bool Seek(int64_t position);
+  int64_t GetPosition() const { return m_position; }
+
+  static constexpr size_t DEFAULT_SEGMENT_SIZE = 4 * 1024 * 1024;
+
+private:
+  struct Segment
+  {
+    CCurlRangeReader* reader;
+    CURL_HANDLE* easy = nullptr;
+    int64_t start = 0;
+    size_t size = 0;
+    size_t consumed = 0;
+    std::vector<char> data;
+    int retries = 0;
+    bool active = false;
+    bool verified = false;
+    bool done = false;
+    bool failed = false;
+  };
+
+  static size_t WriteCallback(char* buffer, size_t size, size_t nitems, void* userp);
+
+  void Schedule();
+  bool Start(Segment& segment);
+  void Release(Segment& segment);
+  bool Perform(std::chrono::milliseconds timeout);
+  void Stop();
+
+  CURL_HANDLE* m_template;
+  std::string m_url;
+  int64_t m_fileSize;
+  unsigned int m_connections;
+  size_t m_segmentSize;
+  int m_retries;
+
+  CURLM* m_multiHandle = nullptr;
+  std::deque<std::unique_ptr<Segment>> m_segments; /**< segments in file order */
+  std::vector<CURL_HANDLE*> m_idleHandles;
+  int64_t m_position = 0; /**< position of next byte handed out to the caller */
+  int64_t m_nextStart = 0; /**< start of the next segment to schedule */
+  bool m_rangeUnsupported = false;
+};
+
+} // namespace XFILE
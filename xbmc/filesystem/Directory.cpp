@@ -171,10 +171,15 @@ bool CDirectory::GetDirectory(const CURL& url,
     if (!pDirectory)
       return false;
 
-    // check our cache for this path
+    // check our cache for this path, then the one kept on disk
+    int64_t mtime = -1;
     if (g_directoryCache.GetDirectory(realURL, items,
                                       (hints.flags & DIR_FLAG_READ_CACHE) == DIR_FLAG_READ_CACHE))
       items.SetURL(url);
+    else if (!(hints.flags & DIR_FLAG_BYPASS_CACHE) &&
+             g_directoryCache.GetPersistentDirectory(realURL, items, pDirectory->GetCacheType(url),
+                                                     mtime))
+      items.SetURL(url);
     else
     {
       // need to clear the cache (in case the directory fetch fails)
@@ -251,7 +256,10 @@ bool CDirectory::GetDirectory(const CURL& url,
 
       // cache the directory, if necessary
       if (!(hints.flags & DIR_FLAG_BYPASS_CACHE))
+      {
         g_directoryCache.SetDirectory(realURL, items, pDirectory->GetCacheType(url));
+        g_directoryCache.SetPersistentDirectory(realURL, items, mtime);
+      }
     }
 
     // now filter for allowed files
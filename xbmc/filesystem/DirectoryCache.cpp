@@ -9,9 +9,16 @@
 #include "DirectoryCache.h"
 
 #include "Directory.h"
+#include "File.h"
 #include "FileItem.h"
 #include "FileItemList.h"
+#include "ServiceBroker.h"
 #include "URL.h"
+#include "XBDateTime.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
+#include "utils/Archive.h"
+#include "utils/Crc32.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
@@ -19,10 +26,18 @@
 #include <algorithm>
 #include <climits>
 #include <mutex>
+#include <stdexcept>
+#include <vector>
 
 // Maximum number of directories to keep in our cache
 #define MAX_CACHED_DIRS 50
 
+// Estimated memory held by a cached item, most of it by its info tag
+constexpr size_t ESTIMATED_ITEM_SIZE = 2048;
+
+// Bump when the format of the persistent cache files changes
+#define PERSISTENT_CACHE_VERSION 2
+
 using namespace XFILE;
 
 namespace
@@ -44,6 +59,53 @@ std::string getDirKey(const CURL& url)
   return dirPath;
 }
 
+constexpr const char* PERSISTENT_CACHE_PATH = "special://temp/dircache/";
+
+// Files not written for this long are removed, as are the oldest beyond the limit
+constexpr int MAX_PERSISTENT_AGE_DAYS = 30;
+constexpr int MAX_PERSISTENT_FILES = 500;
+
+// The key of a persistent listing, without any credentials of the url
+std::string getPersistentKey(const CURL& url)
+{
+  return CURL(getKey(url)).GetWithoutUserDetails();
+}
+
+std::string getPersistentFile(const std::string& key)
+{
+  return StringUtils::Format("{}{:08x}.fi", PERSISTENT_CACHE_PATH,
+                             Crc32::ComputeFromLowerCase(key));
+}
+
+bool isPersistentSource(const CURL& url, CacheType cacheType)
+{
+  // Only listings of archives are kept, they don't change as long as the archive doesn't. The
+  // modification time of network directories (smb, nfs) isn't updated for every change of their
+  // entries, which is why those are only cached once in memory.
+  if (cacheType != CacheType::ALWAYS || !url.HasParentInHostname())
+    return false;
+
+  const auto settings = CServiceBroker::GetSettingsComponent();
+  return settings && settings->GetAdvancedSettings()->m_cachePersistentDirectories;
+}
+
+void prunePersistentFiles()
+{
+  CFileItemList items;
+  if (!CDirectory::GetDirectory(PERSISTENT_CACHE_PATH, items, ".fi",
+                                DIR_FLAG_NO_FILE_DIRS | DIR_FLAG_BYPASS_CACHE))
+    return;
+
+  const CDateTime oldest =
+      CDateTime::GetCurrentDateTime() - CDateTimeSpan(MAX_PERSISTENT_AGE_DAYS, 0, 0, 0);
+  items.Sort(SortByDate, SortOrderDescending);
+  for (int i = 0; i < items.Size(); ++i)
+  {
+    if (i >= MAX_PERSISTENT_FILES || items[i]->GetDateTime() < oldest)
+      CFile::Delete(items[i]->GetPath());
+  }
+}
+
 } // Unnamed namespace
 
 CDirectoryCache::CDir::CDir(CacheType cacheType) : m_Items(std::make_unique<CFileItemList>())
@@ -68,9 +130,13 @@ CDirectoryCache::CDirectoryCache(void)
   m_cacheHits = 0;
   m_cacheMisses = 0;
 #endif
+  CMemoryBudget::Register(this);
 }
 
-CDirectoryCache::~CDirectoryCache(void) = default;
+CDirectoryCache::~CDirectoryCache(void)
+{
+  CMemoryBudget::Unregister(this);
+}
 
 bool CDirectoryCache::GetDirectory(const CURL& url, CFileItemList& items, bool retrieveAll)
 {
@@ -124,6 +190,81 @@ void CDirectoryCache::SetDirectory(const CURL& url, const CFileItemList& items,
   m_cache.emplace(storedPath, std::move(dir));
 }
 
+bool CDirectoryCache::GetPersistentDirectory(const CURL& url,
+                                             CFileItemList& items,
+                                             CacheType cacheType,
+                                             int64_t& mtime)
+{
+  mtime = -1;
+  if (!isPersistentSource(url, cacheType))
+    return false;
+
+  // the archive holding the directory
+  struct __stat64 buffer = {};
+  if (CFile::Stat(url.GetHostName(), &buffer) != 0 || buffer.st_mtime <= 0)
+    return false;
+  mtime = buffer.st_mtime;
+
+  const std::string storedPath = getPersistentKey(url);
+  const std::string cacheFile = getPersistentFile(storedPath);
+  CFile file;
+  if (!file.Open(cacheFile))
+    return false;
+
+  try
+  {
+    CArchive ar(&file, CArchive::load);
+    int version;
+    std::string path;
+    int64_t storedTime;
+    ar >> version;
+    if (version != PERSISTENT_CACHE_VERSION)
+      return false;
+    ar >> path;
+    ar >> storedTime;
+    if (path != storedPath || storedTime != mtime)
+      return false;
+
+    ar >> items;
+  }
+  catch (const std::out_of_range&)
+  {
+    CLog::Log(LOGERROR, "CDirectoryCache: corrupt archive {}", cacheFile);
+    items.Clear();
+    return false;
+  }
+
+  CLog::Log(LOGDEBUG, "CDirectoryCache: loaded {} items for {} from disk", items.Size(),
+            url.GetRedacted());
+  SetDirectory(url, items, cacheType);
+  return true;
+}
+
+void CDirectoryCache::SetPersistentDirectory(const CURL& url,
+                                             const CFileItemList& items,
+                                             int64_t mtime)
+{
+  if (mtime < 0)
+    return;
+
+  // once per session is enough to keep the number of files in check
+  if (!m_persistentPruned.exchange(true))
+    prunePersistentFiles();
+
+  const std::string storedPath = getPersistentKey(url);
+  CFile file;
+  if (!file.OpenForWrite(getPersistentFile(storedPath), true))
+    return;
+
+  CArchive ar(&file, CArchive::store);
+  ar << PERSISTENT_CACHE_VERSION;
+  ar << storedPath;
+  ar << mtime;
+  // the archive operators aren't const, but storing doesn't change the items
+  ar << const_cast<CFileItemList&>(items);
+  ar.Close();
+}
+
 void CDirectoryCache::ClearFile(const CURL& url)
 {
   const std::string dirPath = getDirKey(url);
@@ -231,6 +372,40 @@ void CDirectoryCache::CheckIfFull()
     m_cache.erase(lastAccessed);
 }
 
+size_t CDirectoryCache::GetCacheSize() const
+{
+  std::unique_lock lock(m_cs);
+  size_t size = 0;
+  for (const auto& [key, dir] : m_cache)
+    size += dir.m_Items->Size() * ESTIMATED_ITEM_SIZE;
+  return size;
+}
+
+size_t CDirectoryCache::ShrinkCache(size_t bytes, MemoryPressure pressure)
+{
+  std::unique_lock lock(m_cs);
+
+  // least recently accessed first. dirs that are always cached are only dropped under critical
+  // pressure, they are fetched again when next needed.
+  std::vector<DirCache::iterator> dirs;
+  for (auto it = m_cache.begin(); it != m_cache.end(); ++it)
+  {
+    if (it->second.m_cacheType != CacheType::ALWAYS || pressure == MemoryPressure::CRITICAL)
+      dirs.emplace_back(it);
+  }
+  std::ranges::sort(dirs, {}, [](const auto& it) { return it->second.GetLastAccess(); });
+
+  size_t released = 0;
+  for (const auto& it : dirs)
+  {
+    if (released >= bytes)
+      break;
+    released += it->second.m_Items->Size() * ESTIMATED_ITEM_SIZE;
+    m_cache.erase(it);
+  }
+  return released;
+}
+
 #ifdef _DEBUG
 void CDirectoryCache::PrintStats() const
 {
@@ -10,7 +10,9 @@
 
 #include "IDirectory.h"
 #include "threads/CriticalSection.h"
+#include "utils/MemoryBudget.h"
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <set>
@@ -20,7 +22,7 @@ class CURL;
 
 namespace XFILE
 {
-  class CDirectoryCache
+  class CDirectoryCache : public IMemoryConsumer
   {
     class CDir
     {
@@ -43,7 +45,7 @@ namespace XFILE
     };
   public:
     CDirectoryCache(void);
-    virtual ~CDirectoryCache(void);
+    ~CDirectoryCache(void) override;
     bool GetDirectory(const CURL& url, CFileItemList& items, bool retrieveAll = false);
     void SetDirectory(const CURL& url, const CFileItemList& items, CacheType cacheType);
     void ClearDirectory(const CURL& url);
@@ -52,9 +54,37 @@ namespace XFILE
     void Clear();
     void AddFile(const CURL& url);
     bool FileExists(const CURL& url, bool& foundInCache);
+
+    /*!
+     \brief Load a directory listing kept on disk by a previous session.
+
+     Only directories of archives that are always cached (zip, apk, xbt) are kept
+     on disk, and only when enabled in the advanced settings. The listing is used
+     if the archive wasn't modified since it was stored; it is then cached in
+     memory like a fetched listing. Listings are stored without the credentials
+     of their url.
+     \param url the directory.
+     \param items [out] the cached items.
+     \param cacheType the memory cache type of the directory.
+     \param mtime [out] the current modification time of the archive, to be
+     passed to SetPersistentDirectory() after fetching, or -1 if the directory
+     can't be kept on disk.
+     \return true if the items were loaded.
+     */
+    bool GetPersistentDirectory(const CURL& url,
+                                CFileItemList& items,
+                                CacheType cacheType,
+                                int64_t& mtime);
+    void SetPersistentDirectory(const CURL& url, const CFileItemList& items, int64_t mtime);
 #ifdef _DEBUG
     void PrintStats() const;
 #endif
+
+    // implementation of IMemoryConsumer
+    const char* GetCacheName() const override { return "directories"; }
+    size_t GetCacheSize() const override;
+    size_t ShrinkCache(size_t bytes, MemoryPressure pressure) override;
+
   private:
     void InitCache(const std::set<std::string>& dirs);
     void ClearCache(std::set<std::string>& dirs);
@@ -75,6 +105,7 @@ namespace XFILE
     mutable CCriticalSection m_cs;
 
     unsigned int m_accessCounter;
+    std::atomic<bool> m_persistentPruned{false};
 
 #ifdef _DEBUG
     unsigned int m_cacheHits;
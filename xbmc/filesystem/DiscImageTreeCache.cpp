@@ -0,0 +1,113 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "DiscImageTreeCache.h"
+
+#include "filesystem/File.h"
+#include "threads/CriticalSection.h"
+#include "utils/StringUtils.h"
+#include "utils/URIUtils.h"
+
+#include <algorithm>
+#include <mutex>
+
+using namespace XFILE;
+
+namespace
+{
+// images whose directories are kept
+constexpr size_t MAX_CACHED_IMAGES = 8;
+// directories kept per image, the listings of an image are dropped when it has more
+constexpr size_t MAX_CACHED_DIRECTORIES = 1024;
+
+struct CachedImage
+{
+  int64_t size{0};
+  int64_t modified{0};
+  uint64_t lastUse{0};
+  std::map<std::string, std::shared_ptr<const CDiscImageTreeCache::Directory>, std::less<>>
+      directories;
+};
+
+struct Cache
+{
+  CCriticalSection section;
+  std::map<std::string, CachedImage, std::less<>> images;
+  uint64_t uses{0};
+};
+
+Cache& GetCache()
+{
+  static Cache cache;
+  return cache;
+}
+} // namespace
+
+std::shared_ptr<const CDiscImageTreeCache::Directory> CDiscImageTreeCache::Get(
+    const std::string& image,
+    const std::string& directory,
+    const std::function<bool(Directory&)>& read)
+{
+  struct __stat64 buffer = {};
+  if (CFile::Stat(image, &buffer) != 0)
+    return nullptr;
+
+  const std::string key = GetKey(directory);
+  Cache& cache = GetCache();
+  {
+    std::unique_lock lock(cache.section);
+    const auto it = cache.images.find(image);
+    if (it != cache.images.end() && it->second.size == buffer.st_size &&
+        it->second.modified == buffer.st_mtime)
+    {
+      it->second.lastUse = ++cache.uses;
+      const auto cached = it->second.directories.find(key);
+      if (cached != it->second.directories.end())
+        return cached->second;
+    }
+  }
+
+  // read without holding the lock, the image may be on a slow share
+  auto listing = std::make_shared<Directory>();
+  if (!read(*listing))
+    return nullptr;
+
+  std::unique_lock lock(cache.section);
+  auto it = cache.images.find(image);
+  if (it == cache.images.end())
+  {
+    if (cache.images.size() >= MAX_CACHED_IMAGES)
+    {
+      const auto oldest = std::ranges::min_element(cache.images, {},
+                                                   [](const auto& it) { return it.second.lastUse; });
+      cache.images.erase(oldest);
+    }
+    it = cache.images.try_emplace(image).first;
+  }
+
+  CachedImage& cached = it->second;
+  if (cached.size != buffer.st_size || cached.modified != buffer.st_mtime ||
+      cached.directories.size() >= MAX_CACHED_DIRECTORIES)
+  {
+    cached.directories.clear();
+    cached.size = buffer.st_size;
+    cached.modified = buffer.st_mtime;
+  }
+  cached.lastUse = ++cache.uses;
+  cached.directories[key] = listing;
+  return listing;
+}
+
+std::string CDiscImageTreeCache::GetKey(const std::string& directory)
+{
+  std::string key = StringUtils::ToLower(directory);
+  StringUtils::TrimLeft(key, "/");
+  if (!key.empty())
+    URIUtils::AddSlashAtEnd(key);
+  return key;
+}
@@ -0,0 +1,61 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace XFILE
+{
+/*!
+ * \brief Keeps the directory listings of ISO9660 and UDF images, so browsing an image parses each
+ * of its directories once rather than opening and parsing the image for every listing.
+ *
+ * Directories are read when they are first listed, not by walking the whole image, so images
+ * with many directories or with directory entries pointing back at their parents cost no more
+ * than the directories browsed. The listings of an image are kept until its size or modification
+ * time changes. Only the listings of the images used last are kept.
+ */
+class CDiscImageTreeCache
+{
+public:
+  struct Entry
+  {
+    std::string name;
+    bool folder{false};
+    int64_t size{0};
+  };
+
+  using Directory = std::vector<Entry>;
+
+  /*!
+   * \brief Get the listing of a directory in an image, reading it if it isn't cached or the image
+   * has changed.
+   * \param image path of the image file
+   * \param directory path of the directory in the image
+   * \param read reads the directory from the image, returns false if it can't be read
+   * \return the listing, nullptr if it couldn't be read
+   */
+  static std::shared_ptr<const Directory> Get(const std::string& image,
+                                              const std::string& directory,
+                                              const std::function<bool(Directory&)>& read);
+
+  /*!
+   * \brief Get the key of a directory in an image. Disc file systems are looked up case
+   * insensitively, so the key is the path in lower case, without leading slashes and with a
+   * trailing one, the root being "".
+   * \param directory path of the directory in the image
+   */
+  static std::string GetKey(const std::string& directory);
+};
+} // namespace XFILE
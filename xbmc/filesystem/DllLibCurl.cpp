@@ -87,6 +87,11 @@ CURLMcode DllLibCurl::multi_timeout(CURLM* multi_handle, long* timeout)
   return curl_multi_timeout(multi_handle, timeout);
 }
 
+CURLMcode DllLibCurl::multi_wait(CURLM* multi_handle, int timeout_ms, int* numfds)
+{
+  return curl_multi_wait(multi_handle, nullptr, 0, timeout_ms, numfds);
+}
+
 CURLMsg* DllLibCurl::multi_info_read(CURLM* multi_handle, int* msgs_in_queue)
 {
   return curl_multi_info_read(multi_handle, msgs_in_queue);
@@ -119,6 +124,21 @@ DllLibCurlGlobal::DllLibCurlGlobal()
   {
     CLog::Log(LOGERROR, "Error initializing libcurl");
   }
+
+  // share dns lookups and tls sessions between the pooled sessions, so requests to a host already
+  // talked to don't pay for resolving it and a full handshake again. Connections stay with the
+  // multi handle of each session, every session runs its transfers on a thread of its own.
+  m_share = curl_share_init();
+  if (m_share)
+  {
+    curl_share_setopt(m_share, CURLSHOPT_LOCKFUNC, LockShare);
+    curl_share_setopt(m_share, CURLSHOPT_UNLOCKFUNC, UnlockShare);
+    curl_share_setopt(m_share, CURLSHOPT_USERDATA, this);
+    curl_share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+  }
+  else
+    CLog::Log(LOGERROR, "Error creating libcurl share");
 }
 
 DllLibCurlGlobal::~DllLibCurlGlobal()
@@ -132,10 +152,25 @@ DllLibCurlGlobal::~DllLibCurlGlobal()
     if (session.m_multi)
       multi_cleanup(session.m_multi);
   }
+  if (m_share)
+    curl_share_cleanup(m_share);
   // close libcurl
   curl_global_cleanup();
 }
 
+void DllLibCurlGlobal::LockShare(CURL_HANDLE* handle,
+                                 curl_lock_data data,
+                                 curl_lock_access access,
+                                 void* userptr)
+{
+  static_cast<DllLibCurlGlobal*>(userptr)->m_shareSections[data].lock();
+}
+
+void DllLibCurlGlobal::UnlockShare(CURL_HANDLE* handle, curl_lock_data data, void* userptr)
+{
+  static_cast<DllLibCurlGlobal*>(userptr)->m_shareSections[data].unlock();
+}
+
 void DllLibCurlGlobal::CheckIdle()
 {
   std::unique_lock lock(m_critSection);
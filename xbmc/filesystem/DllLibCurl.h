@@ -10,6 +10,7 @@
 
 #include "threads/CriticalSection.h"
 
+#include <array>
 #include <stdio.h>
 #include <string>
 #include <sys/time.h>
@@ -57,6 +58,7 @@ public:
                         fd_set* exc_fd_set,
                         int* max_fd);
   CURLMcode multi_timeout(CURLM* multi_handle, long* timeout);
+  CURLMcode multi_wait(CURLM* multi_handle, int timeout_ms, int* numfds);
   CURLMsg* multi_info_read(CURLM* multi_handle, int* msgs_in_queue);
   CURLMcode multi_cleanup(CURLM* handle);
   curl_slist* slist_append(curl_slist* list, const char* to_append);
@@ -82,6 +84,12 @@ public:
   CURL_HANDLE* easy_duphandle(CURL_HANDLE* easy_handle) override;
   void CheckIdle();
 
+  /*!
+   \brief Get the share holding the dns cache and tls sessions of all handles.
+   Needs to be set again after easy_reset(), may be null if libcurl failed to create it.
+   */
+  CURLSH* GetShare() const { return m_share; }
+
   /* overloaded load and unload with reference counter */
 
   /* structure holding a session info */
@@ -100,6 +108,16 @@ public:
 
   VEC_CURLSESSIONS m_sessions;
   CCriticalSection m_critSection;
+
+private:
+  static void LockShare(CURL_HANDLE* handle,
+                        curl_lock_data data,
+                        curl_lock_access access,
+                        void* userptr);
+  static void UnlockShare(CURL_HANDLE* handle, curl_lock_data data, void* userptr);
+
+  CURLSH* m_share{nullptr};
+  std::array<CCriticalSection, CURL_LOCK_DATA_LAST> m_shareSections;
 };
 } // namespace XCURL
 
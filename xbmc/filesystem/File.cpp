@@ -14,6 +14,7 @@
 #include "DirectoryCache.h"
 #include "FileCache.h"
 #include "FileFactory.h"
+#include "FileItemList.h"
 #include "IFile.h"
 #include "ServiceBroker.h"
 #include "application/ApplicationComponents.h"
@@ -29,8 +30,33 @@
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
+#include <map>
+
 using namespace XFILE;
 
+namespace
+{
+// number of uncached files in one remote directory from which listing the directory once
+// is cheaper than asking the server about each file
+constexpr size_t EXISTS_LISTING_THRESHOLD = 3;
+
+bool CanCheckByListing(const CURL& url)
+{
+  return url.IsProtocol("smb") || url.IsProtocol("nfs") || url.IsProtocol("dav") ||
+         url.IsProtocol("davs");
+}
+
+template<typename Indices>
+std::map<std::string, Indices> GroupByProtocol(const std::vector<CURL>& urls,
+                                               const Indices& indices)
+{
+  std::map<std::string, Indices> groups;
+  for (size_t i : indices)
+    groups[urls[i].GetProtocol()].push_back(i);
+  return groups;
+}
+} // unnamed namespace
+
 //////////////////////////////////////////////////////////////////////
 // Construction/Destruction
 //////////////////////////////////////////////////////////////////////
@@ -508,6 +534,144 @@ bool CFile::Exists(const CURL& file, bool bUseCache /* = true */)
   return false;
 }
 
+std::vector<bool> CFile::ExistsMany(const std::vector<std::string>& files,
+                                    bool bUseCache /* = true */)
+{
+  std::vector<bool> exists(files.size(), false);
+  std::vector<CURL> urls;
+  urls.reserve(files.size());
+  std::vector<size_t> pending;
+  std::map<std::string, std::vector<size_t>> directories;
+
+  for (size_t i = 0; i < files.size(); ++i)
+  {
+    const CURL& url = urls.emplace_back(URIUtils::SubstitutePath(CURL(files[i])));
+    if (bUseCache)
+    {
+      bool bPathInCache;
+      exists[i] = g_directoryCache.FileExists(url, bPathInCache);
+      if (bPathInCache)
+        continue;
+      if (CanCheckByListing(url))
+      {
+        directories[URIUtils::GetDirectory(url.Get())].push_back(i);
+        continue;
+      }
+    }
+    pending.push_back(i);
+  }
+
+  for (const auto& [directory, indices] : directories)
+  {
+    if (indices.size() >= EXISTS_LISTING_THRESHOLD)
+    {
+      // the listing ends up in the directory cache, which then answers for all of them
+      CFileItemList items;
+      CDirectory::GetDirectory(directory, items, "", DIR_FLAG_NO_FILE_DIRS);
+    }
+    for (size_t i : indices)
+    {
+      bool bPathInCache = false;
+      if (indices.size() >= EXISTS_LISTING_THRESHOLD)
+        exists[i] = g_directoryCache.FileExists(urls[i], bPathInCache);
+      if (!bPathInCache)
+        pending.push_back(i);
+    }
+  }
+
+  for (const auto& [protocol, indices] : GroupByProtocol(urls, pending))
+  {
+    try
+    {
+      std::unique_ptr<IFile> pFile(CFileFactory::CreateLoader(urls[indices.front()]));
+      if (!pFile)
+        continue;
+
+      std::vector<CURL> authUrls;
+      authUrls.reserve(indices.size());
+      for (size_t i : indices)
+        authUrls.emplace_back(URIUtils::AddCredentials(urls[i]));
+
+      std::vector<bool> results;
+      pFile->ExistsMany(authUrls, results);
+      for (size_t i = 0; i < indices.size() && i < results.size(); ++i)
+        exists[indices[i]] = results[i];
+    }
+    XBMCCOMMONS_HANDLE_UNCHECKED
+    catch (CRedirectException* pRedirectEx)
+    {
+      // leave redirected implementations to the single file check
+      CLog::Log(LOGDEBUG, "File::ExistsMany - redirecting implementation for {}", protocol);
+      if (pRedirectEx)
+      {
+        delete pRedirectEx->m_pNewFileImp;
+        delete pRedirectEx->m_pNewUrl;
+        delete pRedirectEx;
+      }
+      for (size_t i : indices)
+        exists[i] = Exists(urls[i], false);
+    }
+    catch (...) { CLog::Log(LOGERROR, "{} - Unhandled exception", __FUNCTION__); }
+  }
+
+  return exists;
+}
+
+std::vector<int> CFile::StatMany(const std::vector<std::string>& files,
+                                 std::vector<struct __stat64>& buffers)
+{
+  std::vector<int> results(files.size(), -1);
+  buffers.assign(files.size(), {});
+  std::vector<CURL> urls;
+  urls.reserve(files.size());
+  std::vector<size_t> indices(files.size());
+  for (size_t i = 0; i < files.size(); ++i)
+  {
+    urls.emplace_back(URIUtils::SubstitutePath(CURL(files[i])));
+    indices[i] = i;
+  }
+
+  for (const auto& [protocol, group] : GroupByProtocol(urls, indices))
+  {
+    try
+    {
+      std::unique_ptr<IFile> pFile(CFileFactory::CreateLoader(urls[group.front()]));
+      if (!pFile)
+        continue;
+
+      std::vector<CURL> authUrls;
+      authUrls.reserve(group.size());
+      for (size_t i : group)
+        authUrls.emplace_back(URIUtils::AddCredentials(urls[i]));
+
+      std::vector<struct __stat64> groupBuffers;
+      std::vector<int> groupResults;
+      pFile->StatMany(authUrls, groupBuffers, groupResults);
+      for (size_t i = 0; i < group.size() && i < groupResults.size(); ++i)
+      {
+        results[group[i]] = groupResults[i];
+        buffers[group[i]] = groupBuffers[i];
+      }
+    }
+    XBMCCOMMONS_HANDLE_UNCHECKED
+    catch (CRedirectException* pRedirectEx)
+    {
+      CLog::Log(LOGDEBUG, "File::StatMany - redirecting implementation for {}", protocol);
+      if (pRedirectEx)
+      {
+        delete pRedirectEx->m_pNewFileImp;
+        delete pRedirectEx->m_pNewUrl;
+        delete pRedirectEx;
+      }
+      for (size_t i : group)
+        results[i] = Stat(urls[i], &buffers[i]);
+    }
+    catch (...) { CLog::Log(LOGERROR, "{} - Unhandled exception", __FUNCTION__); }
+  }
+
+  return results;
+}
+
 int CFile::Stat(struct __stat64 *buffer)
 {
   if (!buffer)
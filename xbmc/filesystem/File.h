@@ -168,6 +168,28 @@ public:
    * \return zero for success, -1 otherwise.
    */
   static int  Stat(const std::string& strFileName, struct __stat64* buffer);
+  /*!
+   * \brief Check for the existence of several files at once.
+   *
+   * Answers from the directory cache where possible. Several uncached files in the same
+   * smb, nfs or dav directory are answered by listing that directory once (which also fills
+   * the cache); everything else is handed to the implementation in one batch per protocol.
+   *
+   * \param[in] files files to check
+   * \param[in] bUseCache whether the directory cache may be used
+   * \return one entry per file, in the same order
+   */
+  static std::vector<bool> ExistsMany(const std::vector<std::string>& files,
+                                      bool bUseCache = true);
+  /*!
+   * \brief Stat several files at once, in one batch per protocol.
+   *
+   * \param[in] files files to stat
+   * \param[out] buffers receives one __stat64 per file, in the same order
+   * \return the Stat() return value per file
+   */
+  static std::vector<int> StatMany(const std::vector<std::string>& files,
+                                   std::vector<struct __stat64>& buffers);
   /**
   * Fills struct __stat64 with information about currently open file
   * For st_mode function will set correctly _S_IFDIR (directory) flag and may set
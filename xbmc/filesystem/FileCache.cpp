@@ -10,7 +10,9 @@
 
 #include "CircularCache.h"
 #include "ServiceBroker.h"
+#include "SparseCache.h"
 #include "URL.h"
+#include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
 #include "threads/Thread.h"
@@ -98,6 +100,7 @@ bool CFileCache::Open(const CURL& url)
   std::unique_lock lock(m_sync);
 
   m_sourcePath = url.GetRedacted();
+  m_sourceUrl = url.Get();
 
   CLog::Log(LOGDEBUG, "CFileCache::{} - <{}> opening", __FUNCTION__, m_sourcePath);
 
@@ -135,9 +138,26 @@ bool CFileCache::Open(const CURL& url)
 
   m_fileSize = m_source.GetLength();
 
+  const unsigned int sparseSize =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_cacheSparseSize;
+
   if (!m_pCache)
   {
-    if (cacheMemSize == 0)
+    const bool useSparseCache =
+        sparseSize > 0 && m_seekPossible > 0 && (m_flags & READ_AUDIO_VIDEO);
+    if (useSparseCache)
+    {
+      // Sparse cache keeps already downloaded ranges around on seek, no need for double buffering
+      const size_t cacheSize = static_cast<size_t>(sparseSize) * 1024 * 1024;
+      CLog::Log(LOGDEBUG, "CFileCache::{} - <{}> using sparse disk cache sized {} bytes",
+                __FUNCTION__, m_sourcePath, cacheSize);
+
+      m_pCache = std::make_unique<CSparseCache>(cacheSize);
+      m_forwardCacheSize = cacheSize - cacheSize / 4;
+      m_maxForward = m_forwardCacheSize;
+      m_prefetchSupported = true;
+    }
+    else if (cacheMemSize == 0)
     {
       // Use cache on disk
       m_pCache = std::make_unique<CSimpleFileCache>();
@@ -188,7 +208,7 @@ bool CFileCache::Open(const CURL& url)
       m_maxForward = m_forwardCacheSize;
     }
 
-    if (m_flags & READ_MULTI_STREAM)
+    if ((m_flags & READ_MULTI_STREAM) && !useSparseCache)
     {
       // If READ_MULTI_STREAM flag is set: Double buffering is required
       m_pCache = std::make_unique<CDoubleCache>(m_pCache.release());
@@ -211,6 +231,7 @@ bool CFileCache::Open(const CURL& url)
   m_bFilling = true;
   m_seekEvent.Reset();
   m_seekEnded.Reset();
+  m_stats = CFileCacheStats::Register(m_sourcePath);
 
   CThread::Create(false);
 
@@ -312,6 +333,10 @@ void CFileCache::Process()
       if (limiter.Rate(m_writePos) < m_writeRate * readFactor)
         break;
 
+      // use the idle time of the throttled main connection to fetch hinted ranges
+      if (ProcessPrefetch(buffer.get()))
+        continue;
+
       if (m_seekEvent.Wait(m_processWait))
       {
         if (!m_bStop)
@@ -332,13 +357,19 @@ void CFileCache::Process()
     if (maxWrite < maxSourceRead)
     {
       // Wait until sufficient cache write space is available
-      m_pCache->m_space.Wait(5ms);
+      if (!ProcessPrefetch(buffer.get()))
+        m_pCache->m_space.Wait(5ms);
       continue;
     }
 
     ssize_t iRead = 0;
     if (maxSourceRead > 0)
+    {
+      const auto start = std::chrono::steady_clock::now();
       iRead = m_source.Read(buffer.get(), maxSourceRead);
+      m_stats->AddFetch(iRead, std::chrono::duration_cast<std::chrono::milliseconds>(
+                                   std::chrono::steady_clock::now() - start));
+    }
     if (iRead <= 0)
     {
       // Check for actual EOF and retry as long as we still have data in our cache
@@ -444,6 +475,95 @@ void CFileCache::Process()
   }
 }
 
+bool CFileCache::ProcessPrefetch(char* buffer)
+{
+  int64_t pos;
+  int64_t hintEnd;
+  {
+    std::unique_lock lock(m_prefetchSync);
+    pos = m_prefetchPos;
+    hintEnd = m_prefetchEnd;
+  }
+
+  if (pos >= hintEnd)
+    return false;
+
+  // a pending seek always goes first
+  if (m_seekEvent.Wait(0ms))
+  {
+    if (!m_bStop)
+      m_seekEvent.Set();
+    return false;
+  }
+
+  // skip what is already cached
+  pos = m_pCache->CachedDataEndPosIfSeekTo(pos);
+  const int64_t end = m_fileSize > 0 ? std::min<int64_t>(hintEnd, m_fileSize) : hintEnd;
+  if (pos >= end)
+  {
+    ClearPrefetch();
+    return false;
+  }
+
+  if (!m_prefetchOpen)
+  {
+    if (!m_prefetchSource.Open(m_sourceUrl, READ_NO_CACHE | READ_TRUNCATED | READ_NO_BUFFER))
+    {
+      CLog::Log(LOGDEBUG, "CFileCache::{} - <{}> failed to open prefetch connection",
+                __FUNCTION__, m_sourcePath);
+      std::unique_lock lock(m_prefetchSync);
+      m_prefetchSupported = false;
+      m_prefetchPos = m_prefetchEnd = 0;
+      return false;
+    }
+    m_prefetchOpen = true;
+  }
+
+  ssize_t iRead = -1;
+  const auto start = std::chrono::steady_clock::now();
+  if (m_prefetchSource.Seek(pos, SEEK_SET) == pos)
+    iRead = m_prefetchSource.Read(buffer, static_cast<size_t>(
+                                              std::min<int64_t>(m_chunkSize, end - pos)));
+  m_stats->AddFetch(iRead, std::chrono::duration_cast<std::chrono::milliseconds>(
+                               std::chrono::steady_clock::now() - start));
+  if (iRead <= 0)
+  {
+    CLog::Log(LOGDEBUG, "CFileCache::{} - <{}> prefetch at position {} failed", __FUNCTION__,
+              m_sourcePath, pos);
+    ClearPrefetch();
+    return false;
+  }
+
+  ssize_t iTotalWrite = 0;
+  while (iTotalWrite < iRead)
+  {
+    const int iWrite =
+        m_pCache->WriteToCacheAt(pos + iTotalWrite, buffer + iTotalWrite, iRead - iTotalWrite);
+    if (iWrite <= 0)
+      break;
+    iTotalWrite += iWrite;
+  }
+
+  std::unique_lock lock(m_prefetchSync);
+  // only advance if no new hint arrived meanwhile
+  if (m_prefetchEnd == hintEnd)
+  {
+    if (iTotalWrite < iRead)
+      m_prefetchPos = m_prefetchEnd = 0; // no room left for out of band data
+    else
+      m_prefetchPos = pos + iTotalWrite;
+  }
+
+  return iTotalWrite > 0;
+}
+
+void CFileCache::ClearPrefetch()
+{
+  std::unique_lock lock(m_prefetchSync);
+  m_prefetchPos = 0;
+  m_prefetchEnd = 0;
+}
+
 void CFileCache::OnExit()
 {
   m_bStop = true;
@@ -486,13 +606,19 @@ retry:
   if (iRc > 0)
   {
     m_readPos += iRc;
+    if (m_stats)
+      m_stats->AddRead(iRc);
     return (int)iRc;
   }
 
   if (iRc == CACHE_RC_WOULD_BLOCK)
   {
     // just wait for some data to show up
+    const auto start = std::chrono::steady_clock::now();
     iRc = m_pCache->WaitForData(1, 10s);
+    if (m_stats)
+      m_stats->AddStall(std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::steady_clock::now() - start));
     if (iRc > 0)
       goto retry;
   }
@@ -536,7 +662,11 @@ int64_t CFileCache::Seek(int64_t iFilePosition, int iWhence)
   if (iTarget == m_readPos)
     return m_readPos;
 
-  if ((m_nSeekResult = m_pCache->Seek(iTarget)) != iTarget)
+  const bool cached = (m_nSeekResult = m_pCache->Seek(iTarget)) == iTarget;
+  if (m_stats)
+    m_stats->AddSeek(cached);
+
+  if (!cached)
   {
     if (m_seekPossible == 0)
       return m_nSeekResult;
@@ -584,6 +714,16 @@ void CFileCache::Close()
     m_pCache->Close();
 
   m_source.Close();
+
+  m_prefetchSource.Close();
+  m_prefetchOpen = false;
+  ClearPrefetch();
+
+  if (m_stats)
+  {
+    m_stats->Close();
+    m_stats.reset();
+  }
 }
 
 int64_t CFileCache::GetPosition()
@@ -626,6 +766,14 @@ int CFileCache::IoControl(IOControl request, void* param)
     return 0;
   }
 
+  if (request == IOControl::CACHE_STATS)
+  {
+    if (!m_stats)
+      return -1;
+    *static_cast<CFileCacheStats::Stats*>(param) = m_stats->GetStats();
+    return 0;
+  }
+
   if (request == IOControl::CACHE_SETRATE)
   {
     m_writeRate = *static_cast<uint32_t*>(param);
@@ -644,6 +792,19 @@ int CFileCache::IoControl(IOControl request, void* param)
     return 0;
   }
 
+  if (request == IOControl::CACHE_PREFETCH)
+  {
+    const SCachePrefetch* hint = static_cast<const SCachePrefetch*>(param);
+    if (!m_prefetchSupported || !hint || hint->position < 0 || hint->size <= 0)
+      return -1;
+
+    // keep hints small, they share storage and bandwidth with the regular read ahead
+    std::unique_lock lock(m_prefetchSync);
+    m_prefetchPos = hint->position;
+    m_prefetchEnd = hint->position + std::min(hint->size, m_maxForward / 4);
+    return 0;
+  }
+
   if (request == IOControl::SEEK_POSSIBLE)
     return m_seekPossible;
 
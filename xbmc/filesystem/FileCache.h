@@ -10,6 +10,7 @@
 
 #include "CacheStrategy.h"
 #include "File.h"
+#include "FileCacheStats.h"
 #include "IFile.h"
 #include "threads/CriticalSection.h"
 #include "threads/Thread.h"
@@ -58,10 +59,24 @@ namespace XFILE
     }
 
   private:
+    /*!
+     \brief Read one chunk of the pending prefetch hint into the cache
+     \return true if data was stored, false if there was nothing (left) to do
+     */
+    bool ProcessPrefetch(char* buffer);
+    void ClearPrefetch();
+
     std::unique_ptr<CCacheStrategy> m_pCache;
     int m_seekPossible = 0;
     CFile m_source;
     std::string m_sourcePath;
+    std::string m_sourceUrl;
+    CFile m_prefetchSource; /**< second connection to the source used to fetch prefetch hints */
+    bool m_prefetchOpen = false;
+    bool m_prefetchSupported = false;
+    int64_t m_prefetchPos = 0;
+    int64_t m_prefetchEnd = 0;
+    CCriticalSection m_prefetchSync;
     CEvent m_seekEvent;
     CEvent m_seekEnded;
     int64_t m_nSeekResult = 0;
@@ -79,6 +94,7 @@ namespace XFILE
     unsigned int m_flags;
     CCriticalSection m_sync;
     std::chrono::milliseconds m_processWait{100ms};
+    std::shared_ptr<CFileCacheStats::Record> m_stats;
   };
 
 }
@@ -0,0 +1,197 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileCacheStats.h"
+
+#include "filesystem/File.h"
+
+#include <algorithm>
+#include <mutex>
+
+using namespace XFILE;
+using namespace std::chrono;
+
+namespace
+{
+// read size of the speed test
+constexpr size_t TEST_CHUNK_SIZE = 256 * 1024;
+
+struct Registry
+{
+  CCriticalSection section;
+  std::vector<std::shared_ptr<CFileCacheStats::Record>> records;
+};
+
+Registry& GetRegistry()
+{
+  static Registry registry;
+  return registry;
+}
+
+// forget the oldest closed records, called with the registry locked
+void Trim(Registry& registry)
+{
+  size_t closed = std::ranges::count_if(registry.records,
+                                        [](const auto& record) { return !record->IsOpen(); });
+  for (auto it = registry.records.begin();
+       closed > CFileCacheStats::MAX_CLOSED && it != registry.records.end();)
+  {
+    if (!(*it)->IsOpen())
+    {
+      it = registry.records.erase(it);
+      closed--;
+    }
+    else
+      ++it;
+  }
+}
+} // namespace
+
+double CFileCacheStats::Stats::GetFetchRate() const
+{
+  if (fetchTime.count() <= 0)
+    return 0.0;
+  return static_cast<double>(bytesFetched) * 1000.0 / fetchTime.count();
+}
+
+double CFileCacheStats::Stats::GetHitRatio() const
+{
+  const uint64_t requests = reads + seeks;
+  if (requests == 0)
+    return 1.0;
+  const uint64_t misses = std::min(requests, stalls + (seeks - cachedSeeks));
+  return static_cast<double>(requests - misses) / requests;
+}
+
+double CFileCacheStats::SpeedTest::GetRate() const
+{
+  if (readTime.count() <= 0)
+    return 0.0;
+  return static_cast<double>(bytes) * 1000.0 / readTime.count();
+}
+
+CFileCacheStats::Record::Record(const std::string& source)
+{
+  m_stats.source = source;
+  m_stats.open = true;
+}
+
+void CFileCacheStats::Record::AddFetch(int64_t bytes, milliseconds latency)
+{
+  const auto bucket = std::ranges::find_if(LATENCY_BOUNDS_MS, [latency](unsigned int bound)
+                                           { return latency.count() <= bound; });
+
+  std::unique_lock lock(m_lock);
+  m_stats.bytesFetched += std::max<int64_t>(bytes, 0);
+  m_stats.fetches++;
+  m_stats.fetchTime += latency;
+  m_stats.refillLatency[bucket - LATENCY_BOUNDS_MS.begin()]++;
+}
+
+void CFileCacheStats::Record::AddRead(int64_t bytes)
+{
+  std::unique_lock lock(m_lock);
+  m_stats.bytesRead += bytes;
+  m_stats.reads++;
+}
+
+void CFileCacheStats::Record::AddSeek(bool cached)
+{
+  std::unique_lock lock(m_lock);
+  m_stats.seeks++;
+  if (cached)
+    m_stats.cachedSeeks++;
+}
+
+void CFileCacheStats::Record::AddStall(milliseconds duration)
+{
+  std::unique_lock lock(m_lock);
+  m_stats.stalls++;
+  m_stats.stallTime += duration;
+  m_stats.longestStall = std::max(m_stats.longestStall, duration);
+}
+
+void CFileCacheStats::Record::Close()
+{
+  std::unique_lock lock(m_lock);
+  m_stats.open = false;
+}
+
+bool CFileCacheStats::Record::IsOpen() const
+{
+  std::unique_lock lock(m_lock);
+  return m_stats.open;
+}
+
+CFileCacheStats::Stats CFileCacheStats::Record::GetStats() const
+{
+  std::unique_lock lock(m_lock);
+  return m_stats;
+}
+
+std::shared_ptr<CFileCacheStats::Record> CFileCacheStats::Register(const std::string& source)
+{
+  auto record = std::make_shared<Record>(source);
+
+  Registry& registry = GetRegistry();
+  std::unique_lock lock(registry.section);
+  Trim(registry);
+  registry.records.push_back(record);
+  return record;
+}
+
+std::vector<CFileCacheStats::Stats> CFileCacheStats::GetStats()
+{
+  Registry& registry = GetRegistry();
+  std::unique_lock lock(registry.section);
+  Trim(registry);
+
+  std::vector<Stats> stats;
+  stats.reserve(registry.records.size());
+  for (const auto& record : registry.records)
+    stats.push_back(record->GetStats());
+  return stats;
+}
+
+std::shared_ptr<const CFileCacheStats::Record> CFileCacheStats::GetLastOpen()
+{
+  Registry& registry = GetRegistry();
+  std::unique_lock lock(registry.section);
+  const auto it = std::ranges::find_if(registry.records.rbegin(), registry.records.rend(),
+                                       [](const auto& record) { return record->IsOpen(); });
+  return it != registry.records.rend() ? *it : nullptr;
+}
+
+bool CFileCacheStats::TestSpeed(const std::string& path, int64_t size, SpeedTest& result)
+{
+  result = {};
+
+  CFile file;
+  const auto start = steady_clock::now();
+  // read the source itself, not a cache of it
+  if (!file.Open(path, READ_NO_CACHE | READ_TRUNCATED | READ_NO_BUFFER))
+    return false;
+
+  const auto opened = steady_clock::now();
+  result.openTime = duration_cast<milliseconds>(opened - start);
+
+  std::vector<uint8_t> buffer(TEST_CHUNK_SIZE);
+  while (result.bytes < size)
+  {
+    const ssize_t read = file.Read(
+        buffer.data(), static_cast<size_t>(std::min<int64_t>(buffer.size(), size - result.bytes)));
+    if (read <= 0)
+      break;
+    if (result.bytes == 0)
+      result.firstByteTime = duration_cast<milliseconds>(steady_clock::now() - opened);
+    result.bytes += read;
+  }
+  result.readTime = duration_cast<milliseconds>(steady_clock::now() - opened);
+
+  return result.bytes > 0;
+}
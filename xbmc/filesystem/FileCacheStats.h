@@ -0,0 +1,114 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <array>
+#include <chrono>
+#include <memory>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace XFILE
+{
+/*!
+ \brief Throughput statistics of the sources read through CFileCache.
+
+ Every open of a cached file gets a record, filled by the cache thread fetching from the source
+ and by the reader. The records of open files and of the last closed ones are kept for
+ JSON-RPC (Files.GetCacheStatistics) and the player debug overlay. Safe to use from several
+ threads.
+ */
+class CFileCacheStats
+{
+public:
+  //! upper bounds of the refill latency histogram buckets, a last bucket takes the rest
+  static constexpr std::array<unsigned int, 7> LATENCY_BOUNDS_MS = {5,   20,   50,  100,
+                                                                    250, 1000, 5000};
+
+  struct Stats
+  {
+    std::string source; /**< redacted path of the source */
+    bool open{false};
+    int64_t bytesFetched{0}; /**< bytes read from the source into the cache */
+    int64_t bytesRead{0}; /**< bytes read from the cache */
+    uint64_t fetches{0}; /**< reads from the source */
+    uint64_t reads{0}; /**< reads from the cache */
+    uint64_t seeks{0};
+    uint64_t cachedSeeks{0}; /**< seeks served from the cache without seeking the source */
+    uint64_t stalls{0}; /**< reads that had to wait for the source */
+    std::chrono::milliseconds stallTime{0}; /**< time spent waiting in stalls */
+    std::chrono::milliseconds longestStall{0};
+    std::chrono::milliseconds fetchTime{0}; /**< time spent reading from the source */
+    //! number of source reads per latency bucket, see LATENCY_BOUNDS_MS
+    std::array<uint64_t, LATENCY_BOUNDS_MS.size() + 1> refillLatency{};
+
+    //! bytes per second fetched from the source while reading it
+    double GetFetchRate() const;
+    //! share of the reads and seeks served from the cache without waiting for the source
+    double GetHitRatio() const;
+  };
+
+  //! Statistics of one open, updated by CFileCache
+  class Record
+  {
+  public:
+    explicit Record(const std::string& source);
+
+    void AddFetch(int64_t bytes, std::chrono::milliseconds latency);
+    void AddRead(int64_t bytes);
+    void AddSeek(bool cached);
+    void AddStall(std::chrono::milliseconds duration);
+    void Close();
+
+    bool IsOpen() const;
+    Stats GetStats() const;
+
+  private:
+    mutable CCriticalSection m_lock;
+    Stats m_stats;
+  };
+
+  struct SpeedTest
+  {
+    int64_t bytes{0};
+    std::chrono::milliseconds openTime{0}; /**< time to open the source */
+    std::chrono::milliseconds firstByteTime{0}; /**< time to the first byte after opening */
+    std::chrono::milliseconds readTime{0}; /**< time to read all bytes after opening */
+
+    double GetRate() const;
+  };
+
+  /*!
+   \brief Start a record for a source opened by CFileCache
+   \param source redacted path of the source
+   */
+  static std::shared_ptr<Record> Register(const std::string& source);
+
+  //! Statistics of the open sources and the last closed ones, oldest first
+  static std::vector<Stats> GetStats();
+
+  //! Statistics of the source opened last that is still open, nullptr if there is none
+  static std::shared_ptr<const Record> GetLastOpen();
+
+  /*!
+   \brief Measure the throughput of a source by reading the start of a file without caching
+   \param path the file to read
+   \param size bytes to read at most
+   \param result [out] what was read and how long it took
+   \return false if the file couldn't be opened or read
+   */
+  static bool TestSpeed(const std::string& path, int64_t size, SpeedTest& result);
+
+  //! records of closed files that are kept
+  static constexpr size_t MAX_CLOSED = 16;
+};
+} // namespace XFILE
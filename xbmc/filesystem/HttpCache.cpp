@@ -0,0 +1,308 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "HttpCache.h"
+
+#include "Directory.h"
+#include "File.h"
+#include "FileItem.h"
+#include "FileItemList.h"
+#include "ServiceBroker.h"
+#include "URL.h"
+#include "XBDateTime.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
+#include "threads/CriticalSection.h"
+#include "utils/Archive.h"
+#include "utils/Digest.h"
+#include "utils/HttpHeader.h"
+#include "utils/StringUtils.h"
+#include "utils/URIUtils.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+using namespace XFILE;
+using KODI::UTILITY::CDigest;
+
+// Bump when the format of the entry files changes
+#define HTTP_CACHE_VERSION 2
+
+namespace
+{
+constexpr const char* CACHE_PATH = "special://temp/httpcache/";
+// upper bound for the freshness guessed from Last-Modified
+constexpr time_t MAX_HEURISTIC_AGE = 24 * 60 * 60;
+
+CCriticalSection cacheSection;
+uint64_t cacheSize = 0;
+bool cacheSizeKnown = false;
+
+std::string GetEntryPath(const std::string& url, const char* extension)
+{
+  return CACHE_PATH + CDigest::Calculate(CDigest::Type::SHA256, url) + extension;
+}
+
+time_t GetTime(const std::string& rfc1123)
+{
+  const CDateTime dateTime = CDateTime::FromRFC1123DateTime(rfc1123);
+  if (!dateTime.IsValid())
+    return -1;
+
+  time_t time;
+  dateTime.GetAsTime(time);
+  return time;
+}
+
+uint64_t GetLimit()
+{
+  const auto settings = CServiceBroker::GetSettingsComponent();
+  if (!settings || !settings->GetAdvancedSettings())
+    return 0;
+  return static_cast<uint64_t>(settings->GetAdvancedSettings()->m_cacheHttpSize) * 1024 * 1024;
+}
+} // namespace
+
+bool CHttpCache::IsEnabled()
+{
+  return GetLimit() > 0;
+}
+
+bool CHttpCache::Lookup(const std::string& url, Entry& entry)
+{
+  const std::string metaFile = GetEntryPath(url, ".meta");
+  CFile file;
+  if (!CFile::Exists(metaFile) || !file.Open(metaFile))
+    return false;
+
+  try
+  {
+    CArchive ar(&file, CArchive::load);
+    int version;
+    std::string storedUrl;
+    int64_t expires;
+    uint64_t bodySize;
+    ar >> version;
+    if (version != HTTP_CACHE_VERSION)
+      return false;
+    ar >> storedUrl;
+    if (storedUrl != CURL::GetRedacted(url))
+      return false;
+    ar >> entry.header;
+    ar >> entry.etag;
+    ar >> entry.lastModified;
+    ar >> expires;
+    ar >> bodySize;
+    entry.expires = static_cast<time_t>(expires);
+    entry.bodySize = bodySize;
+  }
+  catch (const std::out_of_range&)
+  {
+    CLog::Log(LOGERROR, "CHttpCache: corrupt entry {}", metaFile);
+    return false;
+  }
+
+  entry.bodyFile = GetEntryPath(url, ".body");
+  return true;
+}
+
+bool CHttpCache::LoadBody(const Entry& entry, std::string& body)
+{
+  CFile file;
+  std::vector<uint8_t> buffer;
+  if (file.LoadFile(entry.bodyFile, buffer) < 0)
+    return false;
+
+  // the entry is written after the body, a body not matching it is incomplete or belongs to a
+  // newer response still being stored
+  if (buffer.size() != entry.bodySize)
+  {
+    CLog::Log(LOGDEBUG, "CHttpCache: size mismatch of {}", entry.bodyFile);
+    return false;
+  }
+
+  body.assign(buffer.begin(), buffer.end());
+  return true;
+}
+
+bool CHttpCache::Store(const std::string& url, const CHttpHeader& header, const std::string& body)
+{
+  const uint64_t limit = GetLimit();
+  if (limit == 0 || body.size() > limit / 4)
+    return false;
+
+  Entry entry;
+  if (!GetExpiry(header, std::time(nullptr), entry.expires))
+    return false;
+
+  entry.header = header.GetHeader();
+  entry.etag = header.GetValue("etag");
+  entry.lastModified = header.GetValue("last-modified");
+  // nothing to gain from a response which is neither fresh nor can be revalidated
+  if (!entry.IsFresh() && !entry.CanRevalidate())
+    return false;
+
+  entry.bodyFile = GetEntryPath(url, ".body");
+  entry.bodySize = body.size();
+  CFile file;
+  if (!file.OpenForWrite(entry.bodyFile, true) ||
+      file.Write(body.data(), body.size()) != static_cast<ssize_t>(body.size()))
+  {
+    CLog::Log(LOGWARNING, "CHttpCache: unable to write {}", entry.bodyFile);
+    return false;
+  }
+  file.Close();
+
+  if (!WriteEntry(url, entry))
+  {
+    CFile::Delete(entry.bodyFile);
+    return false;
+  }
+
+  std::unique_lock lock(cacheSection);
+  cacheSize += body.size() + entry.header.size();
+  if (!cacheSizeKnown || cacheSize > limit)
+    Trim(limit);
+  return true;
+}
+
+void CHttpCache::Revalidated(const std::string& url, Entry& entry, const CHttpHeader& header)
+{
+  // a 304 may carry updated caching headers, the stored ones apply otherwise
+  CHttpHeader merged;
+  merged.Parse(entry.header);
+  for (const char* name : {"cache-control", "expires", "date", "etag", "age"})
+  {
+    const std::string value = header.GetValue(name);
+    if (!value.empty())
+      merged.AddParam(name, value, true);
+  }
+
+  if (!GetExpiry(merged, std::time(nullptr), entry.expires))
+    return;
+
+  entry.header = merged.GetHeader();
+  entry.etag = merged.GetValue("etag");
+  WriteEntry(url, entry);
+}
+
+bool CHttpCache::GetExpiry(const CHttpHeader& header, time_t now, time_t& expires)
+{
+  expires = now;
+
+  bool noCache = false;
+  long maxAge = -1;
+  std::string cacheControl = header.GetValue("cache-control");
+  StringUtils::ToLower(cacheControl);
+  for (std::string& directive : StringUtils::Split(cacheControl, ','))
+  {
+    StringUtils::Trim(directive);
+    if (directive == "no-store")
+      return false;
+    else if (directive == "no-cache")
+      noCache = true;
+    else if (StringUtils::StartsWith(directive, "max-age="))
+      maxAge = strtol(directive.c_str() + 8, nullptr, 10);
+  }
+
+  if (noCache)
+    return true;
+
+  if (maxAge >= 0)
+  {
+    // the response may have been sitting in a shared cache on the way already
+    const long age = std::max(0L, strtol(header.GetValue("age").c_str(), nullptr, 10));
+    expires = now + std::max(0L, maxAge - age);
+    return true;
+  }
+
+  // Expires and Last-Modified are relative to the server clock
+  time_t date = GetTime(header.GetValue("date"));
+  if (date < 0)
+    date = now;
+
+  const std::string expiresValue = header.GetValue("expires");
+  if (!expiresValue.empty())
+  {
+    // invalid dates, like "0", mean already expired
+    const time_t time = GetTime(expiresValue);
+    if (time > date)
+      expires = now + (time - date);
+    return true;
+  }
+
+  const time_t lastModified = GetTime(header.GetValue("last-modified"));
+  if (lastModified >= 0 && lastModified < date)
+    expires = now + std::min((date - lastModified) / 10, MAX_HEURISTIC_AGE);
+  return true;
+}
+
+bool CHttpCache::WriteEntry(const std::string& url, const Entry& entry)
+{
+  const std::string metaFile = GetEntryPath(url, ".meta");
+  CFile file;
+  if (!file.OpenForWrite(metaFile, true))
+  {
+    CLog::Log(LOGWARNING, "CHttpCache: unable to write {}", metaFile);
+    return false;
+  }
+
+  CArchive ar(&file, CArchive::store);
+  ar << HTTP_CACHE_VERSION;
+  ar << CURL::GetRedacted(url);
+  ar << entry.header;
+  ar << entry.etag;
+  ar << entry.lastModified;
+  ar << static_cast<int64_t>(entry.expires);
+  ar << entry.bodySize;
+  ar.Close();
+  return true;
+}
+
+void CHttpCache::Trim(uint64_t limit)
+{
+  CFileItemList items;
+  if (!CDirectory::GetDirectory(CACHE_PATH, items, "", DIR_FLAG_NO_FILE_DIRS))
+    return;
+
+  cacheSize = 0;
+  std::unordered_map<std::string, uint64_t> sizes;
+  for (const auto& item : items)
+  {
+    const uint64_t size = static_cast<uint64_t>(std::max<int64_t>(item->GetSize(), 0));
+    sizes.emplace(item->GetPath(), size);
+    cacheSize += size;
+  }
+  cacheSizeKnown = true;
+  if (cacheSize <= limit)
+    return;
+
+  // drop the oldest entries until there is some room again, so not every store ends up here
+  items.Sort(SortByDate, SortOrderAscending);
+  const uint64_t target = limit - limit / 10;
+  size_t removed = 0;
+  for (const auto& item : items)
+  {
+    if (cacheSize <= target)
+      break;
+    if (!URIUtils::HasExtension(item->GetPath(), ".body"))
+      continue;
+
+    const std::string metaFile = URIUtils::ReplaceExtension(item->GetPath(), ".meta");
+    CFile::Delete(metaFile);
+    CFile::Delete(item->GetPath());
+    cacheSize -= std::min(cacheSize, sizes[metaFile] + sizes[item->GetPath()]);
+    removed++;
+  }
+
+  CLog::Log(LOGDEBUG, "CHttpCache: removed {} responses, {} bytes in use", removed, cacheSize);
+}
@@ -0,0 +1,89 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <ctime>
+#include <stdint.h>
+#include <string>
+
+class CHttpHeader;
+
+namespace XFILE
+{
+
+/*!
+ \brief On disk cache of complete http responses, for scraper and other metadata requests.
+
+ Responses are kept for as long as their Cache-Control max-age or Expires header allows, or a
+ tenth of their age since Last-Modified if neither is given. Stale responses with an ETag or
+ Last-Modified are revalidated with a conditional request instead of being fetched again, see
+ CCurlFile::SetUseHttpCache(). Responses marked no-store are not cached.
+
+ The size of the cache is limited by the cache/httpsize advanced setting, the least recently
+ stored responses are dropped first.
+ */
+class CHttpCache
+{
+public:
+  struct Entry
+  {
+    std::string header; //!< raw response header, as returned by CHttpHeader::GetHeader()
+    std::string etag;
+    std::string lastModified;
+    time_t expires{0}; //!< the response must be revalidated from then on
+    std::string bodyFile; //!< file holding the response body
+    uint64_t bodySize{0}; //!< size of the body when stored
+
+    bool IsFresh() const { return std::time(nullptr) < expires; }
+    bool CanRevalidate() const { return !etag.empty() || !lastModified.empty(); }
+  };
+
+  /*!
+   \brief Check whether caching is enabled in the advanced settings.
+   */
+  static bool IsEnabled();
+
+  /*!
+   \brief Get the cached response to a request, fresh or not.
+   \param url the url of the request, including any protocol options
+   */
+  static bool Lookup(const std::string& url, Entry& entry);
+
+  /*!
+   \brief Load the body of a cached response.
+   \return false if the body is missing or doesn't have the stored size, e.g. because it's
+   being written by another request or its write failed
+   */
+  static bool LoadBody(const Entry& entry, std::string& body);
+
+  /*!
+   \brief Cache a response, unless its header forbids it.
+   \return true if the response was stored
+   */
+  static bool Store(const std::string& url, const CHttpHeader& header, const std::string& body);
+
+  /*!
+   \brief Update the freshness of a cached response after the server confirmed it is still
+   valid, with the header of the 304 Not Modified response.
+   */
+  static void Revalidated(const std::string& url, Entry& entry, const CHttpHeader& header);
+
+  /*!
+   \brief Get when a response expires, based on its header.
+   \param now the time the response was received
+   \return false if the response must not be cached
+   */
+  static bool GetExpiry(const CHttpHeader& header, time_t now, time_t& expires);
+
+private:
+  static bool WriteEntry(const std::string& url, const Entry& entry);
+  static void Trim(uint64_t limit);
+};
+
+} // namespace XFILE
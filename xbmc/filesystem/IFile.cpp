@@ -25,6 +25,24 @@ IFile::IFile() = default;
 
 IFile::~IFile() = default;
 
+void IFile::ExistsMany(const std::vector<CURL>& urls, std::vector<bool>& exists)
+{
+  exists.clear();
+  exists.reserve(urls.size());
+  for (const CURL& url : urls)
+    exists.push_back(Exists(url));
+}
+
+void IFile::StatMany(const std::vector<CURL>& urls,
+                     std::vector<struct __stat64>& buffers,
+                     std::vector<int>& results)
+{
+  buffers.assign(urls.size(), {});
+  results.assign(urls.size(), -1);
+  for (size_t i = 0; i < urls.size(); ++i)
+    results[i] = Stat(urls[i], &buffers[i]);
+}
+
 int IFile::Stat(struct __stat64* buffer)
 {
   if (buffer)
@@ -64,6 +64,28 @@ public:
    * \return zero for success, -1 otherwise.
    */
   virtual int Stat(const CURL& url, struct __stat64* buffer) = 0;
+  /*!
+   * \brief Check for the existence of several files at once.
+   *
+   * The default implementation calls Exists() for each url. Implementations where every
+   * request is a round trip may override it to answer from a listing or to check in parallel.
+   *
+   * \param[in] urls files to check
+   * \param[out] exists receives one entry per url, in the same order
+   */
+  virtual void ExistsMany(const std::vector<CURL>& urls, std::vector<bool>& exists);
+  /*!
+   * \brief Stat several files at once.
+   *
+   * The default implementation calls Stat() for each url, see ExistsMany().
+   *
+   * \param[in] urls files to stat
+   * \param[out] buffers receives one __stat64 per url, in the same order
+   * \param[out] results receives the Stat() return value per url
+   */
+  virtual void StatMany(const std::vector<CURL>& urls,
+                        std::vector<struct __stat64>& buffers,
+                        std::vector<int>& results);
   /**
   * Fills struct __stat64 with information about currently open file
   * For st_mode function will set correctly _S_IFDIR (directory) flag and may set
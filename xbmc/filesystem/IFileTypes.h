@@ -57,6 +57,12 @@ struct SCacheStatus
   uint32_t lowrate; /**< low speed read rate (bytes/second) (if any, else 0) */
 };
 
+struct SCachePrefetch
+{
+  int64_t position; /**< start of the range in bytes that is likely to be read soon */
+  int64_t size; /**< size of the range in bytes */
+};
+
 enum class CacheBufferMode
 {
   INTERNET = 0,
@@ -74,6 +80,8 @@ enum class IOControl
   CACHE_SETRATE = 4, /**< unsigned int with speed limit for caching in bytes per second */
   SET_CACHE = 8, /**< CFileCache */
   SET_RETRY = 16, /**< Enable/disable retry within the protocol handler (if supported) */
+  CACHE_PREFETCH = 32, /**< SCachePrefetch structure, hint for a range that is about to be read */
+  CACHE_STATS = 64, /**< CFileCacheStats::Stats structure, statistics of the open */
 };
 
 enum class CURLOptionType
@@ -11,12 +11,45 @@
 #include "FileItem.h"
 #include "FileItemList.h"
 #include "URL.h"
+#include "filesystem/DiscImageTreeCache.h"
 #include "utils/URIUtils.h"
 
 #include <cdio++/iso9660.hpp>
 
 using namespace XFILE;
 
+namespace
+{
+bool ReadDirectory(const std::string& image,
+                   const std::string& directory,
+                   CDiscImageTreeCache::Directory& entries)
+{
+  ISO9660::IFS iso;
+  std::vector<ISO9660::Stat*> isoFiles;
+
+  if (!iso.open(image.c_str()) || !iso.readdir(directory.c_str(), isoFiles))
+    return false;
+
+  for (const auto file : isoFiles)
+  {
+    std::unique_ptr<ISO9660::Stat> stat(file);
+    std::string filename(stat->p_stat->filename);
+
+    if (stat->p_stat->type == 2)
+    {
+      if (filename != "." && filename != "..")
+        entries.push_back({filename, true, 0});
+    }
+    else
+    {
+      entries.push_back({filename, false, stat->p_stat->size});
+    }
+  }
+
+  return true;
+}
+} // namespace
+
 bool CISO9660Directory::GetDirectory(const CURL& url, CFileItemList& items)
 {
   CURL url2(url);
@@ -33,46 +66,34 @@ bool CISO9660Directory::GetDirectory(const CURL& url, CFileItemList& items)
   URIUtils::AddSlashAtEnd(strRoot);
   URIUtils::AddSlashAtEnd(strSub);
 
-  std::unique_ptr<ISO9660::IFS> iso(new ISO9660::IFS);
-
-  if (!iso->open(url2.GetHostName().c_str()))
+  const std::string image = url2.GetHostName();
+  const auto directory =
+      CDiscImageTreeCache::Get(image, strSub,
+                               [&image, &strSub](CDiscImageTreeCache::Directory& entries)
+                               { return ReadDirectory(image, strSub, entries); });
+  if (!directory)
     return false;
 
-  std::vector<ISO9660::Stat*> isoFiles;
-
-  if (iso->readdir(strSub.c_str(), isoFiles))
+  for (const auto& entry : *directory)
   {
-    for (const auto file : isoFiles)
+    CFileItemPtr pItem(new CFileItem(entry.name));
+    if (entry.folder)
     {
-      std::string filename(file->p_stat->filename);
-
-      if (file->p_stat->type == 2)
-      {
-        if (filename != "." && filename != "..")
-        {
-          CFileItemPtr pItem(new CFileItem(filename));
-          std::string strDir(strRoot + filename);
-          URIUtils::AddSlashAtEnd(strDir);
-          pItem->SetPath(strDir);
-          pItem->SetFolder(true);
-          items.Add(pItem);
-        }
-      }
-      else
-      {
-        CFileItemPtr pItem(new CFileItem(filename));
-        pItem->SetPath(strRoot + filename);
-        pItem->SetFolder(false);
-        pItem->SetSize(file->p_stat->size);
-        items.Add(pItem);
-      }
+      std::string strDir(strRoot + entry.name);
+      URIUtils::AddSlashAtEnd(strDir);
+      pItem->SetPath(strDir);
+      pItem->SetFolder(true);
     }
-
-    isoFiles.clear();
-    return true;
+    else
+    {
+      pItem->SetPath(strRoot + entry.name);
+      pItem->SetFolder(false);
+      pItem->SetSize(entry.size);
+    }
+    items.Add(pItem);
   }
 
-  return false;
+  return true;
 }
 
 bool CISO9660Directory::Exists(const CURL& url)
@@ -10,10 +10,17 @@
 
 #include "URL.h"
 
-#include <cmath>
+#include <algorithm>
+#include <cstring>
 
 using namespace XFILE;
 
+namespace
+{
+// blocks read at once when less is asked for, 512KiB
+constexpr int64_t READ_AHEAD_BLOCKS = 256;
+} // namespace
+
 CISO9660File::CISO9660File() : m_iso(new ISO9660::IFS())
 {
 }
@@ -35,7 +42,8 @@ bool CISO9660File::Open(const CURL& url)
     return false;
 
   m_start = m_stat->p_stat->lsn;
-  m_current = 0;
+  m_position = 0;
+  m_bufferBlocks = 0;
 
   return true;
 }
@@ -73,37 +81,82 @@ int CISO9660File::Stat(const CURL& url, struct __stat64* buffer)
 
 ssize_t CISO9660File::Read(void* buffer, size_t size)
 {
-  const int maxSize = std::min(size, static_cast<size_t>(GetLength()));
-  const int blocks = std::ceil(maxSize / ISO_BLOCKSIZE);
+  const int64_t length = GetLength();
+  if (m_position >= length)
+    return 0;
 
-  if (m_current > std::ceil(GetLength() / ISO_BLOCKSIZE))
-    return -1;
+  size = static_cast<size_t>(std::min(static_cast<int64_t>(size), length - m_position));
 
-  auto read = m_iso->seek_read(buffer, m_start + m_current, blocks);
+  auto out = static_cast<uint8_t*>(buffer);
+  size_t done = 0;
+  while (done < size)
+  {
+    const int64_t block = m_position / ISO_BLOCKSIZE;
+    const int64_t offset = m_position % ISO_BLOCKSIZE;
+    if (block >= m_bufferBlock && block < m_bufferBlock + m_bufferBlocks)
+    {
+      const int64_t start = (block - m_bufferBlock) * ISO_BLOCKSIZE + offset;
+      const size_t count =
+          std::min(size - done, static_cast<size_t>(m_bufferBlocks * ISO_BLOCKSIZE - start));
+      std::memcpy(out + done, m_buffer.data() + start, count);
+      done += count;
+      m_position += count;
+      continue;
+    }
+
+    // large aligned reads go straight to the buffer in one request
+    const int64_t blocks = static_cast<int64_t>((size - done) / ISO_BLOCKSIZE);
+    if (offset == 0 && blocks >= READ_AHEAD_BLOCKS)
+    {
+      const long read = m_iso->seek_read(out + done, m_start + block, blocks);
+      if (read < ISO_BLOCKSIZE)
+        break;
+      const size_t count = static_cast<size_t>(read / ISO_BLOCKSIZE) * ISO_BLOCKSIZE;
+      done += count;
+      m_position += count;
+      continue;
+    }
+
+    const int64_t remaining = (length + ISO_BLOCKSIZE - 1) / ISO_BLOCKSIZE - block;
+    const int64_t count = std::min(READ_AHEAD_BLOCKS, remaining);
+    m_buffer.resize(READ_AHEAD_BLOCKS * ISO_BLOCKSIZE);
+    m_bufferBlocks = 0;
+    const long read = m_iso->seek_read(m_buffer.data(), m_start + block, count);
+    if (read < ISO_BLOCKSIZE)
+      break;
+    m_bufferBlock = block;
+    m_bufferBlocks = read / ISO_BLOCKSIZE;
+  }
 
-  m_current += blocks;
+  if (done == 0 && size > 0)
+    return -1;
 
-  return read;
+  return static_cast<ssize_t>(done);
 }
 
 int64_t CISO9660File::Seek(int64_t filePosition, int whence)
 {
-  int block = std::floor(filePosition / ISO_BLOCKSIZE);
-
+  int64_t position;
   switch (whence)
   {
     case SEEK_SET:
-      m_current = block;
+      position = filePosition;
       break;
     case SEEK_CUR:
-      m_current += block;
+      position = m_position + filePosition;
       break;
     case SEEK_END:
-      m_current = std::ceil(GetLength() / ISO_BLOCKSIZE) + block;
+      position = GetLength() + filePosition;
       break;
+    default:
+      return -1;
   }
 
-  return m_current * ISO_BLOCKSIZE;
+  if (position < 0)
+    return -1;
+
+  m_position = position;
+  return m_position;
 }
 
 int64_t CISO9660File::GetLength()
@@ -113,7 +166,7 @@ int64_t CISO9660File::GetLength()
 
 int64_t CISO9660File::GetPosition()
 {
-  return m_current * ISO_BLOCKSIZE;
+  return m_position;
 }
 
 bool CISO9660File::Exists(const CURL& url)
@@ -11,6 +11,8 @@
 #include "IFile.h"
 
 #include <memory>
+#include <stdint.h>
+#include <vector>
 
 #include <cdio++/iso9660.hpp>
 
@@ -42,8 +44,13 @@ private:
   std::unique_ptr<ISO9660::IFS> m_iso;
   std::unique_ptr<ISO9660::Stat> m_stat;
 
-  int32_t m_start;
-  int32_t m_current;
+  int32_t m_start{0};
+  int64_t m_position{0};
+
+  // blocks read ahead, so small reads don't each go to the image
+  std::vector<uint8_t> m_buffer;
+  int64_t m_bufferBlock{0};
+  int64_t m_bufferBlocks{0};
 };
 
 } // namespace XFILE
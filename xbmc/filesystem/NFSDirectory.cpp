@@ -248,6 +248,7 @@ bool CNFSDirectory::GetDirectory(const CURL& url, CFileItemList &items)
   URIUtils::AddSlashAtEnd(myStrPath);
   URIUtils::AddSlashAtEnd(strDirName);
 
+  const std::string statCacheKey = CNfsConnection::GetStatCacheKey(url) + "/";
   std::string resolvedPath;
   std::vector<std::shared_ptr<CFileItem>> fileItems;
   struct nfsdirent* dirent = nullptr;
@@ -278,6 +279,10 @@ bool CNFSDirectory::GetDirectory(const CURL& url, CFileItemList &items)
 
     if (name[0] == '.')
       item->SetProperty("file:hidden", true);
+
+    // keep the attributes for stats of the entry, unless the server didn't send them
+    if (!isSymLink && dirent->mode != 0)
+      gNfsConnection.CacheStat(statCacheKey + name, *dirent);
   }
   items.AddItems(std::move(fileItems));
 
@@ -323,6 +328,7 @@ bool CNFSDirectory::Remove(const CURL& url2)
   if(!gNfsConnection.Connect(url,folderName))
     return false;
 
+  gNfsConnection.RemoveCachedStat(url);
   ret = nfs_rmdir(gNfsConnection.GetNfsContext(), folderName.c_str());
 
   if (ret != 0 && errno != ENOENT)
@@ -21,6 +21,8 @@
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
+#include <cstring>
 #include <inttypes.h>
 #include <mutex>
 
@@ -57,6 +59,12 @@ constexpr int NFS4ERR_EXPIRED = -11; // client session expired due idle time gre
 
 constexpr auto SETTING_NFS_VERSION = "nfs.version";
 constexpr auto SETTING_NFS_CHUNKSIZE = "nfs.chunksize";
+
+constexpr auto STAT_CACHE_TIMEOUT = 10s; // attributes from a directory listing are used this long
+constexpr size_t STAT_CACHE_MAX_ENTRIES = 20000;
+
+constexpr unsigned int READAHEAD_MIN_READS = 2; // reads without seek before reading ahead
+constexpr unsigned int READAHEAD_MAX_CHUNKS = 8;
 } // unnamed namespace
 
 CNfsConnection::CNfsConnection()
@@ -435,6 +443,65 @@ void CNfsConnection::removeFromKeepAliveList(struct nfsfh  *_pFileHandle)
   m_KeepAliveTimeouts.erase(_pFileHandle);
 }
 
+std::string CNfsConnection::GetStatCacheKey(const CURL& url)
+{
+  std::string key = url.GetHostName() + "/" + url.GetFileName();
+  URIUtils::RemoveSlashAtEnd(key);
+  return key;
+}
+
+void CNfsConnection::CacheStat(const std::string& key, const struct nfsdirent& dirent)
+{
+  std::unique_lock lock(statCacheLock);
+  if (m_statCache.size() >= STAT_CACHE_MAX_ENTRIES)
+    m_statCache.clear();
+
+  m_statCache.insert_or_assign(
+      key, cachedStat{dirent.dev, dirent.inode, dirent.mode, dirent.nlink, dirent.uid, dirent.gid,
+                      dirent.rdev, dirent.size, static_cast<uint64_t>(dirent.atime.tv_sec),
+                      static_cast<uint64_t>(dirent.mtime.tv_sec),
+                      static_cast<uint64_t>(dirent.ctime.tv_sec),
+                      std::chrono::steady_clock::now()});
+}
+
+bool CNfsConnection::GetCachedStat(const CURL& url, struct __stat64* buffer)
+{
+  std::unique_lock lock(statCacheLock);
+  const auto it = m_statCache.find(GetStatCacheKey(url));
+  if (it == m_statCache.end())
+    return false;
+
+  const struct cachedStat& stat = it->second;
+  if (std::chrono::steady_clock::now() - stat.cacheTime > STAT_CACHE_TIMEOUT)
+  {
+    m_statCache.erase(it);
+    return false;
+  }
+
+  if (buffer)
+  {
+    *buffer = {};
+    buffer->st_dev = stat.dev;
+    buffer->st_ino = stat.ino;
+    buffer->st_mode = stat.mode;
+    buffer->st_nlink = stat.nlink;
+    buffer->st_uid = stat.uid;
+    buffer->st_gid = stat.gid;
+    buffer->st_rdev = stat.rdev;
+    buffer->st_size = stat.size;
+    buffer->st_atime = stat.atime;
+    buffer->st_mtime = stat.mtime;
+    buffer->st_ctime = stat.ctime;
+  }
+  return true;
+}
+
+void CNfsConnection::RemoveCachedStat(const CURL& url)
+{
+  std::unique_lock lock(statCacheLock);
+  m_statCache.erase(GetStatCacheKey(url));
+}
+
 //reset timeouts on read
 void CNfsConnection::resetKeepAlive(const std::string& _exportPath, struct nfsfh* _pFileHandle)
 {
@@ -610,8 +677,9 @@ int64_t CNFSFile::GetPosition()
   if (ret < 0)
   {
     CLog::Log(LOGERROR, "NFS: Failed to lseek({})", nfs_get_error(gNfsConnection.GetNfsContext()));
+    return offset;
   }
-  return offset;
+  return offset - GetBuffered();
 }
 
 int64_t CNFSFile::GetLength()
@@ -695,6 +763,9 @@ int CNFSFile::Stat(struct __stat64* buffer)
 
 int CNFSFile::Stat(const CURL& url, struct __stat64* buffer)
 {
+  if (gNfsConnection.GetCachedStat(url, buffer))
+    return 0;
+
   int ret = 0;
   std::unique_lock lock(gNfsConnection);
   std::string filename;
@@ -744,22 +815,71 @@ ssize_t CNFSFile::Read(void *lpBuf, size_t uiBufSize)
 
   if (m_pFileHandle == NULL || m_pNfsContext == NULL )
     return -1;
+
+  uint8_t* buffer = static_cast<uint8_t*>(lpBuf);
+  const size_t copied = std::min(uiBufSize, GetBuffered());
+  if (copied > 0)
+  {
+    std::memcpy(buffer, m_readAhead.data() + m_readAheadPos, copied);
+    m_readAheadPos += copied;
+    if (copied == uiBufSize)
+      return copied;
+  }
+
+  // only read ahead once the file is read sequentially, seeks throw the buffer away
+  size_t readAhead = 0;
+  if (++m_sequentialReads >= READAHEAD_MIN_READS)
+  {
+    m_readAheadChunks = std::min(m_readAheadChunks ? m_readAheadChunks * 2 : 2,
+                                 READAHEAD_MAX_CHUNKS);
+    readAhead = m_readAheadChunks * gNfsConnection.GetMaxReadChunkSize();
+  }
+
+  const bool fill = uiBufSize - copied < readAhead;
+  if (fill)
+  {
+    m_readAhead.resize(readAhead);
+    m_readAheadPos = 0;
+    m_readAheadSize = 0;
+  }
+  void* target = fill ? m_readAhead.data() : buffer + copied;
+  const size_t size = fill ? readAhead : uiBufSize - copied;
+
 #ifdef LIBNFS_API_V2
-  numberOfBytesRead = nfs_read(m_pNfsContext, m_pFileHandle, lpBuf, uiBufSize);
+  numberOfBytesRead = nfs_read(m_pNfsContext, m_pFileHandle, target, size);
 #else
-  numberOfBytesRead = nfs_read(m_pNfsContext, m_pFileHandle, uiBufSize, (char *)lpBuf);
+  numberOfBytesRead = nfs_read(m_pNfsContext, m_pFileHandle, size, (char *)target);
 #endif
 
+  if (fill && numberOfBytesRead > 0)
+  {
+    m_readAheadSize = numberOfBytesRead;
+    numberOfBytesRead = std::min(uiBufSize - copied, GetBuffered());
+    std::memcpy(buffer + copied, m_readAhead.data(), numberOfBytesRead);
+    m_readAheadPos = numberOfBytesRead;
+  }
+
   lock.unlock(); //no need to keep the connection lock after that
 
   gNfsConnection.resetKeepAlive(m_exportPath, m_pFileHandle);//triggers keep alive timer reset for this filehandle
 
   //something went wrong ...
   if (numberOfBytesRead < 0)
+  {
     CLog::Log(LOGERROR, "{} - Error( {}, {} )", __FUNCTION__, (int64_t)numberOfBytesRead,
               nfs_get_error(m_pNfsContext));
+    return copied > 0 ? static_cast<ssize_t>(copied) : numberOfBytesRead;
+  }
 
-  return numberOfBytesRead;
+  return copied + numberOfBytesRead;
+}
+
+void CNFSFile::DropReadAhead()
+{
+  m_readAheadPos = 0;
+  m_readAheadSize = 0;
+  m_readAheadChunks = 0;
+  m_sequentialReads = 0;
 }
 
 int64_t CNFSFile::Seek(int64_t iFilePosition, int iWhence)
@@ -770,6 +890,30 @@ int64_t CNFSFile::Seek(int64_t iFilePosition, int iWhence)
   std::unique_lock lock(gNfsConnection);
   if (m_pFileHandle == NULL || m_pNfsContext == NULL) return -1;
 
+  // the server position is ahead of ours by what is still buffered
+  if (GetBuffered() > 0 && iWhence != SEEK_END)
+  {
+    ret = nfs_lseek(m_pNfsContext, m_pFileHandle, 0, SEEK_CUR, &offset);
+    if (ret < 0)
+    {
+      CLog::Log(LOGERROR, "NFS: Failed to lseek({})", nfs_get_error(m_pNfsContext));
+      return -1;
+    }
+
+    const int64_t serverPos = static_cast<int64_t>(offset);
+    const int64_t bufferStart = serverPos - m_readAheadSize;
+    if (iWhence == SEEK_CUR)
+      iFilePosition += serverPos - GetBuffered();
+    iWhence = SEEK_SET;
+
+    // stay within the buffer if possible
+    if (iFilePosition >= bufferStart && iFilePosition < serverPos)
+    {
+      m_readAheadPos = static_cast<size_t>(iFilePosition - bufferStart);
+      return iFilePosition;
+    }
+  }
+  DropReadAhead();
 
   ret = nfs_lseek(m_pNfsContext, m_pFileHandle, iFilePosition, iWhence, &offset);
   if (ret < 0)
@@ -788,7 +932,7 @@ int CNFSFile::Truncate(int64_t iSize)
   std::unique_lock lock(gNfsConnection);
   if (m_pFileHandle == NULL || m_pNfsContext == NULL) return -1;
 
-
+  gNfsConnection.RemoveCachedStat(m_url);
   ret = nfs_ftruncate(m_pNfsContext, m_pFileHandle, iSize);
   if (ret < 0)
   {
@@ -803,6 +947,10 @@ void CNFSFile::Close()
 {
   std::unique_lock lock(gNfsConnection);
 
+  DropReadAhead();
+  m_readAhead.clear();
+  m_readAhead.shrink_to_fit();
+
   if (m_pFileHandle != NULL && m_pNfsContext != NULL)
   {
     int ret = 0;
@@ -839,6 +987,16 @@ ssize_t CNFSFile::Write(const void* lpBuf, size_t uiBufSize)
 
   if (m_pFileHandle == NULL || m_pNfsContext == NULL) return -1;
 
+  //move the server position back to ours before writing
+  if (GetBuffered() > 0)
+  {
+    uint64_t offset = 0;
+    nfs_lseek(m_pNfsContext, m_pFileHandle, -static_cast<int64_t>(GetBuffered()), SEEK_CUR,
+              &offset);
+  }
+  DropReadAhead();
+  gNfsConnection.RemoveCachedStat(m_url);
+
   //write as long as some bytes are left to be written
   while( leftBytes )
   {
@@ -887,7 +1045,7 @@ bool CNFSFile::Delete(const CURL& url)
   if(!gNfsConnection.Connect(url, filename))
     return false;
 
-
+  gNfsConnection.RemoveCachedStat(url);
   ret = nfs_unlink(gNfsConnection.GetNfsContext(), filename.c_str());
 
   if(ret != 0)
@@ -911,6 +1069,8 @@ bool CNFSFile::Rename(const CURL& url, const CURL& urlnew)
   std::string strDummy;
   gNfsConnection.splitUrlIntoExportAndPath(urlnew, strDummy, strFileNew);
 
+  gNfsConnection.RemoveCachedStat(url);
+  gNfsConnection.RemoveCachedStat(urlnew);
   ret = nfs_rename(gNfsConnection.GetNfsContext() , strFile.c_str(), strFileNew.c_str());
 
   if(ret != 0)
@@ -935,6 +1095,7 @@ bool CNFSFile::OpenForWrite(const CURL& url, bool bOverWrite)
   if(!gNfsConnection.Connect(url,filename))
     return false;
 
+  gNfsConnection.RemoveCachedStat(url);
   m_pNfsContext = gNfsConnection.GetNfsContext();
   m_exportPath = gNfsConnection.GetContextMapId();
 
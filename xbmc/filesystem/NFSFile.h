@@ -17,8 +17,11 @@
 #include <chrono>
 #include <list>
 #include <map>
+#include <unordered_map>
+#include <vector>
 
 struct nfs_stat_64;
+struct nfsdirent;
 
 class CNfsConnection : public CCriticalSection
 {
@@ -64,6 +67,14 @@ public:
   //removes file handle from keep alive list
   void removeFromKeepAliveList(struct nfsfh  *_pFileHandle);
 
+  //the attributes returned by a directory listing are kept for a few seconds,
+  //so stats of the listed files right afterwards (library scans) don't need a
+  //round trip to the server
+  static std::string GetStatCacheKey(const CURL& url);
+  void CacheStat(const std::string& key, const struct nfsdirent& dirent);
+  bool GetCachedStat(const CURL& url, struct __stat64* buffer);
+  void RemoveCachedStat(const CURL& url);
+
   const std::string& GetConnectedIp() const {return m_resolvedHostName;}
   const std::string& GetConnectedExport() const {return m_exportPath;}
   const std::string GetContextMapId() const {return m_hostName + m_exportPath;}
@@ -92,6 +103,24 @@ private:
   CCriticalSection keepAliveLock;
   CCriticalSection openContextLock;
 
+  struct cachedStat
+  {
+    uint64_t dev;
+    uint64_t ino;
+    uint64_t mode;
+    uint64_t nlink;
+    uint64_t uid;
+    uint64_t gid;
+    uint64_t rdev;
+    uint64_t size;
+    uint64_t atime;
+    uint64_t mtime;
+    uint64_t ctime;
+    std::chrono::time_point<std::chrono::steady_clock> cacheTime;
+  };
+  std::unordered_map<std::string, struct cachedStat> m_statCache;
+  CCriticalSection statCacheLock;
+
   void clearMembers();
   struct nfs_context *getContextFromMap(const std::string &exportname, bool forceCacheHit = false);
 
@@ -139,10 +168,21 @@ namespace XFILE
   protected:
     CURL m_url;
     bool IsValidFile(const std::string& strFileName);
+    size_t GetBuffered() const { return m_readAheadSize - m_readAheadPos; }
+    void DropReadAhead();
     int64_t m_fileSize = 0;
     struct nfsfh *m_pFileHandle;
     struct nfs_context *m_pNfsContext;//current nfs context
     std::string m_exportPath;
+
+    //sequential reads are served from a buffer filled with several chunks at a
+    //time, which libnfs requests from the server in parallel. the window grows
+    //each time the buffer was used up without a seek
+    std::vector<uint8_t> m_readAhead;
+    size_t m_readAheadPos = 0;
+    size_t m_readAheadSize = 0;
+    unsigned int m_readAheadChunks = 0;
+    unsigned int m_sequentialReads = 0;
   };
 }
 
@@ -11,13 +11,23 @@
 /*----------------------------------------------------------------------
 |   includes
 +---------------------------------------------------------------------*/
+#include "NptXbmcFile.h"
+
 #include "File.h"
+#include "FileCache.h"
 #include "FileFactory.h"
 #include "PasswordManager.h"
+#include "ServiceBroker.h"
 #include "URL.h"
+#include "threads/CriticalSection.h"
+#include "utils/FileExtensionProvider.h"
 #include "utils/URIUtils.h"
 
+#include <chrono>
 #include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include <Neptune/Source/Core/NptDebug.h>
 #include <Neptune/Source/Core/NptFile.h>
@@ -34,6 +44,133 @@ using namespace XFILE;
 
 typedef NPT_Reference<IFile> NPT_XbmcFileReference;
 
+/*----------------------------------------------------------------------
+|   NPT_XbmcFileCachePool::Lock
++---------------------------------------------------------------------*/
+CCriticalSection&
+NPT_XbmcFileCachePool::Lock()
+{
+    static auto* lock = new CCriticalSection;
+    return *lock;
+}
+
+/*----------------------------------------------------------------------
+|   NPT_XbmcFileCachePool::Idle
++---------------------------------------------------------------------*/
+std::vector<NPT_XbmcFileCachePool::Entry>&
+NPT_XbmcFileCachePool::Idle()
+{
+    static auto* idle = new std::vector<Entry>;
+    return *idle;
+}
+
+/*----------------------------------------------------------------------
+|   NPT_XbmcFileCachePool::RemoveExpired
++---------------------------------------------------------------------*/
+void
+NPT_XbmcFileCachePool::RemoveExpired(std::vector<Entry>& idle, std::vector<Entry>& expired)
+{
+    const auto now = std::chrono::steady_clock::now();
+    for (auto it = idle.begin(); it != idle.end();) {
+        if (now - it->released >= IDLE_TIMEOUT) {
+            expired.push_back(std::move(*it));
+            it = idle.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+/*----------------------------------------------------------------------
+|   NPT_XbmcFileCachePool::Acquire
++---------------------------------------------------------------------*/
+std::unique_ptr<CFileCache>
+NPT_XbmcFileCachePool::Acquire(const std::string& path)
+{
+    std::unique_ptr<CFileCache> cache;
+    // closing a cache waits for its thread, don't do that under the lock
+    std::vector<Entry> expired;
+    {
+        std::unique_lock lock(Lock());
+        std::vector<Entry>& idle = Idle();
+        RemoveExpired(idle, expired);
+        for (auto it = idle.rbegin(); it != idle.rend(); ++it) {
+            if (it->path == path) {
+                cache = std::move(it->cache);
+                idle.erase(std::next(it).base());
+                break;
+            }
+        }
+    }
+
+    if (cache && cache->Seek(0, SEEK_SET) != 0) cache.reset();
+    return cache;
+}
+
+/*----------------------------------------------------------------------
+|   NPT_XbmcFileCachePool::Release
++---------------------------------------------------------------------*/
+void
+NPT_XbmcFileCachePool::Release(const std::string& path, std::unique_ptr<CFileCache> cache)
+{
+    std::vector<Entry> expired;
+    std::unique_lock lock(Lock());
+    std::vector<Entry>& idle = Idle();
+    RemoveExpired(idle, expired);
+    if (idle.size() >= MAX_IDLE) {
+        expired.push_back(std::move(idle.front()));
+        idle.erase(idle.begin());
+    }
+    idle.push_back({path, std::move(cache), std::chrono::steady_clock::now()});
+}
+
+/*----------------------------------------------------------------------
+|   NPT_XbmcFileCachePool::Clear
++---------------------------------------------------------------------*/
+void
+NPT_XbmcFileCachePool::Clear()
+{
+    // closing a cache waits for its thread, don't do that under the lock
+    std::vector<Entry> idle;
+    std::unique_lock lock(Lock());
+    idle.swap(Idle());
+}
+
+/*----------------------------------------------------------------------
+|   NPT_XbmcCachedFile
++---------------------------------------------------------------------*/
+// Read-ahead view of a network file which hands its cache back to the pool
+// once the last stream reading from it is gone
+class NPT_XbmcCachedFile : public IFile
+{
+public:
+    NPT_XbmcCachedFile(const std::string& path, std::unique_ptr<CFileCache> cache) :
+        m_Path(path), m_Cache(std::move(cache)) {}
+    ~NPT_XbmcCachedFile() override {
+        NPT_XbmcFileCachePool::Release(m_Path, std::move(m_Cache));
+    }
+
+    // IFile methods
+    bool Open(const CURL& url) override { return false; }
+    bool Exists(const CURL& url) override { return m_Cache->Exists(url); }
+    int Stat(const CURL& url, struct __stat64* buffer) override {
+        return m_Cache->Stat(url, buffer);
+    }
+    ssize_t Read(void* lpBuf, size_t uiBufSize) override {
+        return m_Cache->Read(lpBuf, uiBufSize);
+    }
+    int64_t Seek(int64_t iFilePosition, int iWhence = SEEK_SET) override {
+        return m_Cache->Seek(iFilePosition, iWhence);
+    }
+    void Close() override {}
+    int64_t GetPosition() override { return m_Cache->GetPosition(); }
+    int64_t GetLength() override { return m_Cache->GetLength(); }
+
+private:
+    std::string                 m_Path;
+    std::unique_ptr<CFileCache> m_Cache;
+};
+
 /*----------------------------------------------------------------------
 |   NPT_XbmcFileStream
 +---------------------------------------------------------------------*/
@@ -290,14 +427,32 @@ NPT_XbmcFile::Open(NPT_File::OpenMode mode)
         return NPT_ERROR_FILE_NOT_WRITABLE;
     } else {
 
+        const CURL url{name};
+        const CURL authUrl{URIUtils::AddCredentials(URIUtils::SubstitutePath(url))};
+
+        // network sources are read through a read-ahead cache, the small
+        // reads of the http server would otherwise each hit the network
+        if (!(mode & NPT_FILE_OPEN_MODE_WRITE) && URIUtils::IsNetworkFilesystem(name)) {
+            std::unique_ptr<CFileCache> cache = NPT_XbmcFileCachePool::Acquire(name);
+            if (!cache) {
+                const std::string media =
+                    CServiceBroker::GetFileExtensionProvider().GetVideoExtensions() + "|" +
+                    CServiceBroker::GetFileExtensionProvider().GetMusicExtensions();
+                cache = std::make_unique<CFileCache>(
+                    URIUtils::HasExtension(url, media) ? READ_AUDIO_VIDEO : 0);
+                if (!cache->Open(authUrl)) return NPT_ERROR_NO_SUCH_FILE;
+            }
+
+            m_FileReference = new NPT_XbmcCachedFile(name, std::move(cache));
+            return NPT_SUCCESS;
+        }
+
         file = CFileFactory::CreateLoader(name);
         if (file.IsNull()) {
             return NPT_ERROR_NO_SUCH_FILE;
         }
 
         bool result;
-        const CURL url{name};
-        const CURL authUrl{URIUtils::AddCredentials(URIUtils::SubstitutePath(url))};
 
         // compute mode
         if (mode & NPT_FILE_OPEN_MODE_WRITE)
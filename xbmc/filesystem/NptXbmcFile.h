@@ -0,0 +1,57 @@
+/*
+ *  Neptune - Files :: XBMC Implementation
+ *
+ *  Copyright (c) 2002-2008, Axiomatic Systems, LLC.
+ *  All rights reserved.
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+class CCriticalSection;
+
+namespace XFILE
+{
+class CFileCache;
+}
+
+/*----------------------------------------------------------------------
+|   NPT_XbmcFileCachePool
++---------------------------------------------------------------------*/
+// Renderers tend to fire a series of range requests at the same file, keep
+// the read-ahead caches of finished responses around for a little while so
+// the next request can pick up what has already been fetched
+class NPT_XbmcFileCachePool
+{
+public:
+    static std::unique_ptr<XFILE::CFileCache> Acquire(const std::string& path);
+    static void Release(const std::string& path, std::unique_ptr<XFILE::CFileCache> cache);
+
+    // close all idle caches, e.g. when the server stops serving files
+    static void Clear();
+
+private:
+    struct Entry
+    {
+        std::string                           path;
+        std::unique_ptr<XFILE::CFileCache>    cache;
+        std::chrono::steady_clock::time_point released;
+    };
+
+    static constexpr size_t MAX_IDLE = 2;
+    static constexpr auto   IDLE_TIMEOUT = std::chrono::seconds(30);
+
+    static void RemoveExpired(std::vector<Entry>& idle, std::vector<Entry>& expired);
+
+    // never destroyed, the caches' threads must not be stopped during static
+    // destruction
+    static CCriticalSection&   Lock();
+    static std::vector<Entry>& Idle();
+};
@@ -32,8 +32,10 @@ namespace XFILE
       if (!pPlayList->Load(url.Get()))
         return false; //hmmm unable to load playlist?
 
-      PLAYLIST::CPlayList playlist = *pPlayList;
-      // convert playlist items to songs
+      // convert playlist items to songs, the playlist is dropped afterwards so there is no need
+      // to copy it first, which is costly for iptv lists with many thousand entries
+      PLAYLIST::CPlayList& playlist = *pPlayList;
+      items.Reserve(items.Size() + playlist.size());
       for (int i = 0; i < playlist.size(); ++i)
       {
         CFileItemPtr item = playlist[i];
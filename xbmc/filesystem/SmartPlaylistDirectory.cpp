@@ -23,9 +23,11 @@
 #include "utils/SortUtils.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
+#include "utils/log.h"
 #include "video/VideoDatabase.h"
 #include "video/VideoDbUrl.h"
 
+#include <chrono>
 #include <memory>
 
 #define PROPERTY_PATH_DB            "path.db"
@@ -48,10 +50,19 @@ namespace XFILE
     PLAYLIST::CSmartPlaylist playlist;
     if (!playlist.Load(url))
       return false;
+
+    // the queries are logged with their timing by the databases, this sums them up per playlist
+    const auto start = std::chrono::steady_clock::now();
     bool result = GetDirectory(playlist, items);
     if (result)
       items.SetProperty("library.smartplaylist", true);
 
+    CLog::LogFC(LOGDEBUG, LOGDATABASE, "took {} ms for {} items of smart playlist {}",
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - start)
+                    .count(),
+                items.Size(), url.GetRedacted());
+
     return result;
   }
 
@@ -0,0 +1,456 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "SparseCache.h"
+
+#include "SpecialProtocol.h"
+#include "Util.h"
+#include "threads/SystemClock.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <mutex>
+#include <string.h>
+
+#if defined(TARGET_POSIX)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+using namespace XFILE;
+using namespace std::chrono_literals;
+
+CSparseCache::CSparseCache(size_t size, size_t blockSize)
+  : CCacheStrategy(),
+    m_blockSize(blockSize),
+    m_slotCount(std::max<size_t>(size / blockSize, 2))
+{
+  m_size = m_slotCount * m_blockSize;
+}
+
+CSparseCache::~CSparseCache()
+{
+  Close();
+}
+
+int CSparseCache::Open()
+{
+  Close();
+
+#ifdef TARGET_WINDOWS
+  const uint64_t size = m_size;
+  m_handle = CreateFileMapping(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE,
+                               static_cast<DWORD>(size >> 32), static_cast<DWORD>(size), NULL);
+  if (m_handle == NULL)
+    return CACHE_RC_ERROR;
+  m_buf = static_cast<uint8_t*>(MapViewOfFile(m_handle, FILE_MAP_ALL_ACCESS, 0, 0, 0));
+#else
+  m_filename = CSpecialProtocol::TranslatePath(
+      CUtil::GetNextFilename("special://temp/filecache{:03}.cache", 999));
+  if (m_filename.empty())
+  {
+    CLog::Log(LOGERROR, "CSparseCache::{} - Unable to generate a new filename", __FUNCTION__);
+    return CACHE_RC_ERROR;
+  }
+
+  m_fd = open(m_filename.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+  if (m_fd < 0 || ftruncate(m_fd, static_cast<off_t>(m_size)) != 0)
+  {
+    CLog::Log(LOGERROR, "CSparseCache::{} - Failed to create cache file \"{}\" of size {}",
+              __FUNCTION__, m_filename, m_size);
+    Close();
+    return CACHE_RC_ERROR;
+  }
+
+  void* buf = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+  if (buf != MAP_FAILED)
+    m_buf = static_cast<uint8_t*>(buf);
+
+  // the mapping keeps the storage alive, no need to leave the file behind on a crash
+  unlink(m_filename.c_str());
+  m_filename.clear();
+#endif
+  if (m_buf == nullptr)
+  {
+    Close();
+    return CACHE_RC_ERROR;
+  }
+
+  m_cur = 0;
+  m_end = 0;
+  m_ranges.clear();
+  m_blocks.clear();
+  m_lru.clear();
+  m_freeSlots.clear();
+  for (size_t slot = m_slotCount; slot > 0; --slot)
+    m_freeSlots.push_back(slot - 1);
+
+  CLog::Log(LOGDEBUG, "CSparseCache::{} - ({}) using {} blocks of {} bytes", __FUNCTION__,
+            fmt::ptr(this), m_slotCount, m_blockSize);
+  return CACHE_RC_OK;
+}
+
+void CSparseCache::Close()
+{
+#ifdef TARGET_WINDOWS
+  if (m_buf != nullptr)
+    UnmapViewOfFile(m_buf);
+  if (m_handle != NULL)
+    CloseHandle(m_handle);
+  m_handle = NULL;
+#else
+  if (m_buf != nullptr)
+    munmap(m_buf, m_size);
+  if (m_fd >= 0)
+    close(m_fd);
+  m_fd = -1;
+  if (!m_filename.empty())
+    unlink(m_filename.c_str());
+  m_filename.clear();
+#endif
+  m_buf = nullptr;
+  m_ranges.clear();
+  m_blocks.clear();
+  m_lru.clear();
+  m_freeSlots.clear();
+}
+
+int64_t CSparseCache::ContiguousEnd(int64_t pos) const
+{
+  auto it = m_ranges.upper_bound(pos);
+  if (it == m_ranges.begin())
+    return pos;
+  --it;
+  return it->second >= pos ? it->second : pos;
+}
+
+void CSparseCache::AddRange(int64_t start, int64_t end)
+{
+  auto it = m_ranges.upper_bound(start);
+  if (it != m_ranges.begin())
+  {
+    auto prev = std::prev(it);
+    if (prev->second >= start)
+    {
+      start = prev->first;
+      end = std::max(end, prev->second);
+      it = m_ranges.erase(prev);
+    }
+  }
+
+  while (it != m_ranges.end() && it->first <= end)
+  {
+    end = std::max(end, it->second);
+    it = m_ranges.erase(it);
+  }
+
+  m_ranges.emplace(start, end);
+}
+
+void CSparseCache::RemoveRange(int64_t start, int64_t end)
+{
+  auto it = m_ranges.upper_bound(start);
+  if (it != m_ranges.begin())
+    --it;
+
+  while (it != m_ranges.end() && it->first < end)
+  {
+    const int64_t rangeStart = it->first;
+    const int64_t rangeEnd = it->second;
+    if (rangeEnd <= start)
+    {
+      ++it;
+      continue;
+    }
+
+    it = m_ranges.erase(it);
+    if (rangeStart < start)
+      m_ranges.emplace(rangeStart, start);
+    if (rangeEnd > end)
+      it = m_ranges.emplace(end, rangeEnd).first;
+  }
+}
+
+void CSparseCache::Touch(Block& block, int64_t index)
+{
+  m_lru.erase(block.lru);
+  m_lru.push_front(index);
+  block.lru = m_lru.begin();
+}
+
+uint8_t* CSparseCache::GetBlock(int64_t index, bool create)
+{
+  auto it = m_blocks.find(index);
+  if (it != m_blocks.end())
+    return m_buf + it->second.slot * m_blockSize;
+
+  if (!create)
+    return nullptr;
+
+  size_t slot;
+  if (!m_freeSlots.empty())
+  {
+    slot = m_freeSlots.back();
+    m_freeSlots.pop_back();
+  }
+  else
+  {
+    // evict the least recently used block that is not part of the read/write window
+    const int64_t first = m_cur / m_blockSize;
+    const int64_t last = m_end / m_blockSize;
+    auto victim = std::find_if(m_lru.rbegin(), m_lru.rend(), [first, last](int64_t block)
+                               { return block < first || block > last; });
+    if (victim == m_lru.rend())
+      return nullptr;
+
+    const int64_t evicted = *victim;
+    auto evictedBlock = m_blocks.find(evicted);
+    slot = evictedBlock->second.slot;
+    m_lru.erase(evictedBlock->second.lru);
+    m_blocks.erase(evictedBlock);
+    RemoveRange(evicted * m_blockSize, (evicted + 1) * m_blockSize);
+  }
+
+  m_lru.push_front(index);
+  m_blocks.emplace(index, Block{slot, m_lru.begin()});
+  return m_buf + slot * m_blockSize;
+}
+
+size_t CSparseCache::GetMaxWriteSize(const size_t& iRequestSize)
+{
+  std::unique_lock lock(m_sync);
+
+  const size_t window = static_cast<size_t>(m_end / m_blockSize - m_cur / m_blockSize) + 1;
+  if (window > m_slotCount)
+    return 0;
+
+  const size_t limit =
+      (m_slotCount - window) * m_blockSize + (m_blockSize - m_end % m_blockSize);
+
+  // Never return more than limit and size requested by caller
+  return std::min(iRequestSize, limit);
+}
+
+/**
+ * Writes at the current write position, it will only write up to the
+ * next block boundary so multiple calls may be needed to write the
+ * whole buffer. Returns 0 if all blocks are part of the forward window.
+ */
+int CSparseCache::WriteToCache(const char* buf, size_t len)
+{
+  std::unique_lock lock(m_sync);
+
+  if (m_buf == nullptr)
+    return 0;
+
+  const size_t offset = static_cast<size_t>(m_end % m_blockSize);
+  len = std::min(len, m_blockSize - offset);
+  if (len == 0)
+    return 0;
+
+  uint8_t* block = GetBlock(m_end / m_blockSize, true);
+  if (block == nullptr)
+    return 0;
+
+  memcpy(block + offset, buf, len);
+  AddRange(m_end, m_end + len);
+  m_end += len;
+
+  m_written.Set();
+
+  return static_cast<int>(len);
+}
+
+/**
+ * Stores data outside of the range being filled, e.g. a prefetched seek
+ * target. Like WriteToCache it only writes up to the next block boundary.
+ */
+int CSparseCache::WriteToCacheAt(int64_t iFilePosition, const char* buf, size_t len)
+{
+  std::unique_lock lock(m_sync);
+
+  if (m_buf == nullptr)
+    return CACHE_RC_ERROR;
+
+  const size_t offset = static_cast<size_t>(iFilePosition % m_blockSize);
+  len = std::min(len, m_blockSize - offset);
+  if (len == 0)
+    return 0;
+
+  uint8_t* block = GetBlock(iFilePosition / m_blockSize, true);
+  if (block == nullptr)
+    return 0;
+
+  memcpy(block + offset, buf, len);
+  AddRange(iFilePosition, iFilePosition + len);
+
+  return static_cast<int>(len);
+}
+
+/**
+ * Reads data from cache. Will only read up till the next
+ * block boundary, so multiple calls may be needed.
+ */
+int CSparseCache::ReadFromCache(char* buf, size_t len)
+{
+  std::unique_lock lock(m_sync);
+
+  const size_t offset = static_cast<size_t>(m_cur % m_blockSize);
+  const size_t avail = std::min(static_cast<size_t>(m_end - m_cur), m_blockSize - offset);
+
+  if (avail == 0)
+  {
+    if (IsEndOfInput())
+      return 0;
+    else
+      return CACHE_RC_WOULD_BLOCK;
+  }
+
+  if (len > avail)
+    len = avail;
+
+  if (len == 0)
+    return 0;
+
+  const int64_t index = m_cur / m_blockSize;
+  auto it = m_blocks.find(index);
+  if (it == m_blocks.end())
+  {
+    CLog::Log(LOGERROR, "CSparseCache::{} - ({}) missing block for position {}", __FUNCTION__,
+              fmt::ptr(this), m_cur);
+    return CACHE_RC_ERROR;
+  }
+
+  memcpy(buf, m_buf + it->second.slot * m_blockSize + offset, len);
+  Touch(it->second, index);
+  m_cur += len;
+
+  m_space.Set();
+
+  return static_cast<int>(len);
+}
+
+int64_t CSparseCache::WaitForData(uint32_t minimum, std::chrono::milliseconds timeout)
+{
+  std::unique_lock lock(m_sync);
+  int64_t avail = m_end - m_cur;
+
+  if (timeout == 0ms || IsEndOfInput())
+    return avail;
+
+  if (minimum > m_size - m_blockSize)
+    minimum = m_size - m_blockSize;
+
+  XbmcThreads::EndTime<> endtime{timeout};
+  while (!IsEndOfInput() && avail < minimum && !endtime.IsTimePast())
+  {
+    lock.unlock();
+    m_written.Wait(50ms); // may miss the deadline. shouldn't be a problem.
+    lock.lock();
+    avail = m_end - m_cur;
+  }
+
+  return avail;
+}
+
+int64_t CSparseCache::Seek(int64_t pos)
+{
+  std::unique_lock lock(m_sync);
+
+  // if seek is a bit over what we have, try to wait a few seconds for the data to be available.
+  // we try to avoid a (heavy) seek on the source
+  if (pos >= m_end && pos < m_end + 100000)
+  {
+    m_cur = m_end;
+
+    lock.unlock();
+    WaitForData(static_cast<uint32_t>(pos - m_cur), 5s);
+    lock.lock();
+
+    if (pos > m_end)
+      CLog::Log(LOGDEBUG, "CSparseCache::{} - ({}) Wait for data failed for pos {}, ended up at {}",
+                __FUNCTION__, fmt::ptr(this), pos, m_end);
+  }
+
+  // Only positions in the range currently being filled can be served directly. Other cached
+  // ranges need a Reset() so the source continues behind the end of that range.
+  auto it = m_ranges.upper_bound(m_end);
+  if (it != m_ranges.begin())
+  {
+    --it;
+    if (pos >= it->first && pos <= m_end && it->second >= m_end)
+    {
+      m_cur = pos;
+      return pos;
+    }
+  }
+
+  return CACHE_RC_ERROR;
+}
+
+bool CSparseCache::Reset(int64_t pos)
+{
+  std::unique_lock lock(m_sync);
+  if (IsCachedPosition(pos))
+  {
+    m_cur = pos;
+    m_end = ContiguousEnd(pos);
+    return false;
+  }
+
+  m_cur = pos;
+  m_end = pos;
+
+  return true;
+}
+
+void CSparseCache::EndOfInput()
+{
+  CCacheStrategy::EndOfInput();
+  m_written.Set();
+}
+
+int64_t CSparseCache::CachedDataEndPosIfSeekTo(int64_t iFilePosition)
+{
+  std::unique_lock lock(m_sync);
+  return ContiguousEnd(iFilePosition);
+}
+
+int64_t CSparseCache::CachedDataStartPos()
+{
+  std::unique_lock lock(m_sync);
+  auto it = m_ranges.upper_bound(m_cur);
+  if (it != m_ranges.begin() && std::prev(it)->second >= m_cur)
+    return std::prev(it)->first;
+  return m_cur;
+}
+
+int64_t CSparseCache::CachedDataEndPos()
+{
+  std::unique_lock lock(m_sync);
+  return m_end;
+}
+
+bool CSparseCache::IsCachedPosition(int64_t iFilePosition)
+{
+  std::unique_lock lock(m_sync);
+  auto it = m_ranges.upper_bound(iFilePosition);
+  return it != m_ranges.begin() && std::prev(it)->second >= iFilePosition;
+}
+
+size_t CSparseCache::GetRangeCount()
+{
+  std::unique_lock lock(m_sync);
+  return m_ranges.size();
+}
+
+CCacheStrategy* CSparseCache::CreateNew()
+{
+  return new CSparseCache(m_size, m_blockSize);
+}
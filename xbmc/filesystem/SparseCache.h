@@ -0,0 +1,97 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "CacheStrategy.h"
+#include "threads/CriticalSection.h"
+#include "threads/Event.h"
+
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace XFILE
+{
+
+/*!
+ \brief Cache strategy keeping a sparse set of downloaded ranges.
+
+ Data is stored in fixed size blocks inside a memory mapped file of bounded size. Unlike
+ CCircularCache, ranges that were downloaded before a seek are kept, so seeking back or jumping
+ between chapters can be served from local storage. When the store is full, the least recently
+ used block outside of the current read/write window is evicted.
+ */
+class CSparseCache : public CCacheStrategy
+{
+public:
+  CSparseCache(size_t size, size_t blockSize = DEFAULT_BLOCK_SIZE);
+  ~CSparseCache() override;
+
+  int Open() override;
+  void Close() override;
+
+  size_t GetMaxWriteSize(const size_t& iRequestSize) override;
+  int WriteToCache(const char* buf, size_t len) override;
+  int ReadFromCache(char* buf, size_t len) override;
+  int64_t WaitForData(uint32_t minimum, std::chrono::milliseconds timeout) override;
+  int WriteToCacheAt(int64_t iFilePosition, const char* buf, size_t len) override;
+
+  int64_t Seek(int64_t pos) override;
+  bool Reset(int64_t pos) override;
+  void EndOfInput() override;
+
+  int64_t CachedDataEndPosIfSeekTo(int64_t iFilePosition) override;
+  int64_t CachedDataStartPos() override;
+  int64_t CachedDataEndPos() override;
+  bool IsCachedPosition(int64_t iFilePosition) override;
+
+  CCacheStrategy* CreateNew() override;
+
+  /*!
+   \brief Get the number of distinct cached ranges, mainly for diagnostics
+   */
+  size_t GetRangeCount();
+
+  static constexpr size_t DEFAULT_BLOCK_SIZE = 1024 * 1024;
+
+protected:
+  struct Block
+  {
+    size_t slot;
+    std::list<int64_t>::iterator lru;
+  };
+
+  int64_t ContiguousEnd(int64_t pos) const;
+  void AddRange(int64_t start, int64_t end);
+  void RemoveRange(int64_t start, int64_t end);
+  uint8_t* GetBlock(int64_t block, bool create);
+  void Touch(Block& block, int64_t index);
+
+  int64_t m_cur = 0; /**< current reading index in file */
+  int64_t m_end = 0; /**< index in file of the current write position */
+  std::map<int64_t, int64_t> m_ranges; /**< cached byte ranges in file, start -> end */
+  std::map<int64_t, Block> m_blocks; /**< file block index -> storage slot */
+  std::list<int64_t> m_lru; /**< file block indexes, most recently used first */
+  std::vector<size_t> m_freeSlots;
+  uint8_t* m_buf = nullptr; /**< mapped storage */
+  size_t m_size; /**< size of mapped storage */
+  size_t m_blockSize;
+  size_t m_slotCount;
+  std::string m_filename;
+  CCriticalSection m_sync;
+  CEvent m_written;
+#ifdef TARGET_WINDOWS
+  HANDLE m_handle = nullptr;
+#else
+  int m_fd = -1;
+#endif
+};
+
+} // namespace XFILE
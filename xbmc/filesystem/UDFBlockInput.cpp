@@ -10,10 +10,18 @@
 
 #include "filesystem/File.h"
 
+#include <algorithm>
+#include <cstring>
 #include <mutex>
 
 #include <udfread/udfread.h>
 
+namespace
+{
+// blocks read at once when udfread asks for fewer, 512KiB
+constexpr uint32_t READ_AHEAD_BLOCKS = 256;
+} // namespace
+
 int CUDFBlockInput::Close(udfread_block_input* bi)
 {
   auto m_bi = reinterpret_cast<UDF_BI*>(bi);
@@ -36,17 +44,60 @@ int CUDFBlockInput::Read(
   auto m_bi = reinterpret_cast<UDF_BI*>(bi);
   std::unique_lock lock(m_bi->lock);
 
-  int64_t pos = static_cast<int64_t>(lba) * UDF_BLOCK_SIZE;
+  auto out = static_cast<uint8_t*>(buf);
+  uint32_t done = 0;
+  while (done < blocks)
+  {
+    const uint32_t block = lba + done;
+    if (block >= m_bi->cacheLba && block < m_bi->cacheLba + m_bi->cacheBlocks)
+    {
+      const uint32_t count = std::min(blocks - done, m_bi->cacheLba + m_bi->cacheBlocks - block);
+      std::memcpy(out + static_cast<size_t>(done) * UDF_BLOCK_SIZE,
+                  m_bi->cache.data() + static_cast<size_t>(block - m_bi->cacheLba) * UDF_BLOCK_SIZE,
+                  static_cast<size_t>(count) * UDF_BLOCK_SIZE);
+      done += count;
+      continue;
+    }
+
+    // large reads of file data go straight to the buffer in one request
+    if (blocks - done >= READ_AHEAD_BLOCKS)
+    {
+      const int64_t pos = static_cast<int64_t>(block) * UDF_BLOCK_SIZE;
+      if (m_bi->fp->Seek(pos, SEEK_SET) != pos)
+        break;
+
+      const ssize_t size = static_cast<ssize_t>(blocks - done) * UDF_BLOCK_SIZE;
+      const ssize_t read = m_bi->fp->Read(out + static_cast<size_t>(done) * UDF_BLOCK_SIZE, size);
+      if (read > 0)
+        done += static_cast<uint32_t>(read / UDF_BLOCK_SIZE);
+      break;
+    }
+
+    if (!ReadAhead(m_bi, block))
+      break;
+  }
 
-  if (m_bi->fp->Seek(pos, SEEK_SET) != pos)
+  if (done == 0 && blocks > 0)
     return -1;
 
-  ssize_t size = blocks * UDF_BLOCK_SIZE;
-  ssize_t read = m_bi->fp->Read(buf, size);
-  if (read > 0)
-    return static_cast<int>(read / UDF_BLOCK_SIZE);
+  return static_cast<int>(done);
+}
 
-  return static_cast<int>(read);
+bool CUDFBlockInput::ReadAhead(UDF_BI* bi, uint32_t lba)
+{
+  const int64_t pos = static_cast<int64_t>(lba) * UDF_BLOCK_SIZE;
+  if (bi->fp->Seek(pos, SEEK_SET) != pos)
+    return false;
+
+  bi->cache.resize(static_cast<size_t>(READ_AHEAD_BLOCKS) * UDF_BLOCK_SIZE);
+  bi->cacheBlocks = 0;
+  const ssize_t read = bi->fp->Read(bi->cache.data(), bi->cache.size());
+  if (read < UDF_BLOCK_SIZE)
+    return false;
+
+  bi->cacheLba = lba;
+  bi->cacheBlocks = static_cast<uint32_t>(read / UDF_BLOCK_SIZE);
+  return true;
 }
 
 udfread_block_input* CUDFBlockInput::GetBlockInput(const std::string& file)
@@ -11,6 +11,8 @@
 #include "threads/CriticalSection.h"
 
 #include <memory>
+#include <stdint.h>
+#include <vector>
 
 #include <udfread/blockinput.h>
 
@@ -37,7 +39,13 @@ private:
     struct udfread_block_input bi;
     std::shared_ptr<XFILE::CFile> fp{nullptr};
     CCriticalSection lock;
+    // blocks read ahead, udfread reads metadata and partial blocks one block at a time
+    std::vector<uint8_t> cache;
+    uint32_t cacheLba{0};
+    uint32_t cacheBlocks{0};
   };
 
+  static bool ReadAhead(UDF_BI* bi, uint32_t lba);
+
   std::unique_ptr<UDF_BI> m_bi{nullptr};
 };
@@ -15,6 +15,7 @@
 #include "FileItemList.h"
 #include "URL.h"
 #include "Util.h"
+#include "filesystem/DiscImageTreeCache.h"
 #include "filesystem/UDFBlockInput.h"
 #include "utils/URIUtils.h"
 
@@ -22,22 +23,46 @@
 
 using namespace XFILE;
 
-bool CUDFDirectory::GetDirectory(const CURL& url, CFileItemList& items)
+namespace
 {
-  CURL url2(url);
-  if (!url2.IsProtocol("udf"))
+bool ReadDirectory(udfread* udf,
+                   const std::string& directory,
+                   CDiscImageTreeCache::Directory& entries)
+{
+  auto path = udfread_opendir(udf, directory.c_str());
+  if (!path)
+    return false;
+
+  struct udfread_dirent dirent;
+
+  while (udfread_readdir(path, &dirent))
   {
-    url2.Reset();
-    url2.SetProtocol("udf");
-    url2.SetHostName(url.Get());
-  }
+    std::string filename = dirent.d_name;
+    if (dirent.d_type == UDF_DT_DIR)
+    {
+      if (filename != "." && filename != "..")
+        entries.push_back({filename, true, 0});
+    }
+    else
+    {
+      std::string filenameWithPath{directory + filename};
+      auto file = udfread_file_open(udf, filenameWithPath.c_str());
+      if (!file)
+        continue;
 
-  std::string strRoot(url2.Get());
-  std::string strSub(url2.GetFileName());
+      entries.push_back({filename, false, udfread_file_size(file)});
+      udfread_file_close(file);
+    }
+  }
 
-  URIUtils::AddSlashAtEnd(strRoot);
-  URIUtils::AddSlashAtEnd(strSub);
+  udfread_closedir(path);
+  return true;
+}
 
+bool ReadDirectory(const std::string& image,
+                   const std::string& directory,
+                   CDiscImageTreeCache::Directory& entries)
+{
   auto udf = udfread_init();
 
   if (!udf)
@@ -45,60 +70,64 @@ bool CUDFDirectory::GetDirectory(const CURL& url, CFileItemList& items)
 
   CUDFBlockInput udfbi;
 
-  auto bi = udfbi.GetBlockInput(url2.GetHostName());
+  auto bi = udfbi.GetBlockInput(image);
 
-  if (udfread_open_input(udf, bi) < 0)
+  if (!bi || udfread_open_input(udf, bi) < 0)
   {
     udfread_close(udf);
     return false;
   }
 
-  auto path = udfread_opendir(udf, strSub.c_str());
-  if (!path)
+  const bool result = ReadDirectory(udf, directory, entries);
+  udfread_close(udf);
+
+  return result;
+}
+} // namespace
+
+bool CUDFDirectory::GetDirectory(const CURL& url, CFileItemList& items)
+{
+  CURL url2(url);
+  if (!url2.IsProtocol("udf"))
   {
-    udfread_close(udf);
-    return false;
+    url2.Reset();
+    url2.SetProtocol("udf");
+    url2.SetHostName(url.Get());
   }
 
-  struct udfread_dirent dirent;
+  std::string strRoot(url2.Get());
+  std::string strSub(url2.GetFileName());
 
-  while (udfread_readdir(path, &dirent))
+  URIUtils::AddSlashAtEnd(strRoot);
+  URIUtils::AddSlashAtEnd(strSub);
+
+  const std::string image = url2.GetHostName();
+  const auto directory =
+      CDiscImageTreeCache::Get(image, strSub,
+                               [&image, &strSub](CDiscImageTreeCache::Directory& entries)
+                               { return ReadDirectory(image, strSub, entries); });
+  if (!directory)
+    return false;
+
+  for (const auto& entry : *directory)
   {
-    if (dirent.d_type == UDF_DT_DIR)
+    CFileItemPtr pItem(new CFileItem(entry.name));
+    if (entry.folder)
     {
-      std::string filename = dirent.d_name;
-      if (filename != "." && filename != "..")
-      {
-        CFileItemPtr pItem(new CFileItem(filename));
-        std::string strDir(strRoot + filename);
-        URIUtils::AddSlashAtEnd(strDir);
-        pItem->SetPath(strDir);
-        pItem->SetFolder(true);
-
-        items.Add(pItem);
-      }
+      std::string strDir(strRoot + entry.name);
+      URIUtils::AddSlashAtEnd(strDir);
+      pItem->SetPath(strDir);
+      pItem->SetFolder(true);
     }
     else
     {
-      std::string filename = dirent.d_name;
-      std::string filenameWithPath{strSub + filename};
-      auto file = udfread_file_open(udf, filenameWithPath.c_str());
-      if (!file)
-        continue;
-
-      CFileItemPtr pItem(new CFileItem(filename));
-      pItem->SetPath(strRoot + filename);
+      pItem->SetPath(strRoot + entry.name);
       pItem->SetFolder(false);
-      pItem->SetSize(udfread_file_size(file));
-      items.Add(pItem);
-
-      udfread_file_close(file);
+      pItem->SetSize(entry.size);
     }
+    items.Add(pItem);
   }
 
-  udfread_closedir(path);
-  udfread_close(udf);
-
   return true;
 }
 
@@ -12,9 +12,13 @@
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
+
 #include <sys/stat.h>
 
 #define ZIP_CACHE_LIMIT 4*1024*1024
+#define ZIP_CHECKPOINT_SPACING 1024*1024
+#define ZIP_MAX_CHECKPOINTS 16
 
 using namespace XFILE;
 
@@ -72,7 +76,12 @@ bool CZipFile::Open(const CURL&url)
     return false;
   }
   mFile.Seek(mZipItem.offset,SEEK_SET);
-  return InitDecompress();
+  if (!InitDecompress())
+    return false;
+
+  if (mZipItem.method == 8 && mZipItem.usize > ZIP_CHECKPOINT_SPACING)
+    m_iNextCheckpoint = ZIP_CHECKPOINT_SPACING;
+  return true;
 }
 
 bool CZipFile::InitDecompress()
@@ -170,14 +179,8 @@ int64_t CZipFile::Seek(int64_t iFilePosition, int iWhence)
       // we are in uncompressed data..
       if (iFilePosition < m_iFilePos)
       {
-        m_iFilePos = 0;
-        m_iZipFilePos = 0;
-        inflateEnd(&m_ZStream);
-        inflateInit2(&m_ZStream,-MAX_WBITS); // simply restart zlib
-        mFile.Seek(mZipItem.offset,SEEK_SET);
-        m_ZStream.next_in = (Bytef*)m_szBuffer;
-        m_ZStream.avail_in = 0;
-        m_ZStream.total_out = 0;
+        if (!Rewind(iFilePosition))
+          return -1;
         while (m_iFilePos < iFilePosition)
         {
           ssize_t iToRead = (iFilePosition - m_iFilePos) > blockSize ? blockSize : iFilePosition - m_iFilePos;
@@ -295,6 +298,9 @@ ssize_t CZipFile::Read(void* lpBuf, size_t uiBufSize)
   }
   if (mZipItem.method == 8) // deflated
   {
+    if (m_iNextCheckpoint >= 0 && m_iFilePos >= m_iNextCheckpoint)
+      AddCheckpoint();
+
     uLong iDecompressed = 0;
     uLong prevOut = m_ZStream.total_out;
     while ((iDecompressed < uiBufSize) && ((m_iZipFilePos < mZipItem.csize) || (m_bFlush)))
@@ -356,6 +362,7 @@ ssize_t CZipFile::Read(void* lpBuf, size_t uiBufSize)
 
 void CZipFile::Close()
 {
+  ClearCheckpoints();
   if (mZipItem.method == 8 && !m_bCached && m_iRead != -1)
     inflateEnd(&m_ZStream);
 
@@ -379,6 +386,65 @@ bool CZipFile::FillBuffer()
   return true;
 }
 
+void CZipFile::AddCheckpoint()
+{
+  if (m_checkpoints.size() >= ZIP_MAX_CHECKPOINTS)
+  {
+    m_iNextCheckpoint = -1;
+    return;
+  }
+
+  auto checkpoint = std::make_unique<SInflateCheckpoint>();
+  if (inflateCopy(&checkpoint->stream, &m_ZStream) != Z_OK)
+  {
+    m_iNextCheckpoint = -1;
+    return;
+  }
+  checkpoint->filePos = m_iFilePos;
+  // the part of the buffer that hasn't been consumed yet is read again on restore
+  checkpoint->zipFilePos = m_iZipFilePos - m_ZStream.avail_in;
+  checkpoint->flush = m_bFlush;
+  m_checkpoints.emplace_back(std::move(checkpoint));
+
+  m_iNextCheckpoint = m_iFilePos + ZIP_CHECKPOINT_SPACING;
+}
+
+bool CZipFile::Rewind(int64_t iFilePosition)
+{
+  // resume from the closest checkpoint before the position, if there is one
+  const auto it = std::find_if(m_checkpoints.rbegin(), m_checkpoints.rend(),
+                               [iFilePosition](const auto& checkpoint)
+                               { return checkpoint->filePos <= iFilePosition; });
+
+  inflateEnd(&m_ZStream);
+  if (it != m_checkpoints.rend() && inflateCopy(&m_ZStream, &(*it)->stream) == Z_OK)
+  {
+    m_iFilePos = (*it)->filePos;
+    m_iZipFilePos = (*it)->zipFilePos;
+    m_bFlush = (*it)->flush;
+  }
+  else
+  {
+    m_iFilePos = 0;
+    m_iZipFilePos = 0;
+    m_bFlush = false;
+    inflateInit2(&m_ZStream,-MAX_WBITS); // simply restart zlib
+    m_ZStream.total_out = 0;
+  }
+
+  m_ZStream.next_in = (Bytef*)m_szBuffer;
+  m_ZStream.avail_in = 0;
+  return mFile.Seek(mZipItem.offset + m_iZipFilePos, SEEK_SET) >= 0;
+}
+
+void CZipFile::ClearCheckpoints()
+{
+  for (auto& checkpoint : m_checkpoints)
+    inflateEnd(&checkpoint->stream);
+  m_checkpoints.clear();
+  m_iNextCheckpoint = -1;
+}
+
 void CZipFile::DestroyBuffer(void* lpBuffer, int iBufSize)
 {
   if (!m_bFlush)
@@ -12,6 +12,9 @@
 #include "IFile.h"
 #include "ZipManager.h"
 
+#include <memory>
+#include <vector>
+
 #include <zlib.h>
 
 namespace XFILE
@@ -40,9 +43,22 @@ namespace XFILE
     static bool DecompressGzip(const std::string& in, std::string& out);
 
   private:
+    /*! Snapshot of the inflate state at some point of a deflated entry, so a
+        backward seek can resume from there instead of from the start */
+    struct SInflateCheckpoint
+    {
+      z_stream stream;
+      int64_t filePos; // position in uncompressed data
+      int64_t zipFilePos; // position in compressed data
+      bool flush;
+    };
+
     bool InitDecompress();
     bool FillBuffer();
     void DestroyBuffer(void* lpBuffer, int iBufSize);
+    void AddCheckpoint();
+    bool Rewind(int64_t iFilePosition);
+    void ClearCheckpoints();
     CFile mFile;
     SZipEntry mZipItem;
     int64_t m_iFilePos = 0; // position in _uncompressed_ data read
@@ -56,6 +72,8 @@ namespace XFILE
     int m_iRead;
     bool m_bFlush = false;
     bool m_bCached;
+    std::vector<std::unique_ptr<SInflateCheckpoint>> m_checkpoints;
+    int64_t m_iNextCheckpoint = -1; // -1 if no checkpoints are taken
   };
 }
 
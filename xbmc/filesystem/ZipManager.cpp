@@ -22,6 +22,8 @@
 #include "utils/RegExp.h"
 #include "utils/URIUtils.h"
 
+#include <mutex>
+
 using namespace XFILE;
 
 static const size_t ZC_FLAG_EFS = 1 << 11; // general purpose bit 11 - zip holds utf-8 filenames
@@ -42,20 +44,40 @@ bool CZipManager::GetZipList(const CURL& url, std::vector<SZipEntry>& items)
     return false;
   }
 
-  std::map<std::string, std::vector<SZipEntry> >::iterator it = mZipMap.find(strFile);
-  if (it != mZipMap.end()) // already listed, just return it if not changed, else release and reread
   {
-    std::map<std::string,int64_t>::iterator it2=mZipDate.find(strFile);
-
-    if (m_StatData.st_mtime == it2->second)
+    std::unique_lock<CCriticalSection> lock(m_critSection);
+    auto it = mZipMap.find(strFile);
+    if (it != mZipMap.end()) // already listed, just return it if not changed, else release and reread
     {
-      items = it->second;
-      return true;
+      if (m_StatData.st_mtime == it->second.date)
+      {
+        items = it->second.entries;
+        return true;
+      }
+      mZipMap.erase(it);
     }
-    mZipMap.erase(it);
-    mZipDate.erase(it2);
   }
 
+  std::vector<SZipEntry> entries;
+  if (!ReadZipList(strFile, entries))
+    return false;
+
+  SZipArchive archive;
+  archive.date = m_StatData.st_mtime;
+  archive.index.reserve(entries.size());
+  for (size_t i = 0; i < entries.size(); ++i)
+    archive.index.emplace(entries[i].name, i);
+  archive.entries = std::move(entries);
+
+  items.insert(items.end(), archive.entries.begin(), archive.entries.end());
+
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  mZipMap.insert_or_assign(strFile, std::move(archive));
+  return true;
+}
+
+bool CZipManager::ReadZipList(const std::string& strFile, std::vector<SZipEntry>& items)
+{
   CFile mFile;
   if (!mFile.Open(strFile))
   {
@@ -76,10 +98,6 @@ bool CZipManager::GetZipList(const CURL& url, std::vector<SZipEntry>& items)
   if (Endian_SwapLE32(hdr) == ZIP_SPLIT_ARCHIVE_HEADER)
     CLog::LogF(LOGWARNING, "ZIP split archive header found. Trying to process as a single archive..");
 
-  // push date for update detection
-  mZipDate.insert(make_pair(strFile,m_StatData.st_mtime));
-
-
   // Look for end of central directory record
   // Zipfile comment may be up to 65535 bytes
   // End of central directory record is 22 bytes (ECDREC_SIZE)
@@ -156,32 +174,40 @@ bool CZipManager::GetZipList(const CURL& url, std::vector<SZipEntry>& items)
     return false;
   cdirOffset = Endian_SwapLE32(cdirOffset);
 
-  // Go to the start of central directory
+  if (static_cast<int64_t>(cdirOffset) + cdirSize > fileSize)
+  {
+    CLog::Log(LOGDEBUG, "ZipManager: broken file {}!", strFile);
+    return false;
+  }
+
+  // Read the whole central directory at once and parse it from memory
+  std::vector<char> cdir(cdirSize);
   mFile.Seek(cdirOffset,SEEK_SET);
+  if (mFile.Read(cdir.data(), cdirSize) != static_cast<ssize_t>(cdirSize))
+    return false;
 
   CRegExp pathTraversal;
   pathTraversal.RegComp(PATH_TRAVERSAL);
 
-  char temp[CHDR_SIZE];
-  while (mFile.GetPosition() < cdirOffset + cdirSize)
+  size_t pos = 0;
+  while (pos < cdir.size())
   {
     SZipEntry ze;
-    if (mFile.Read(temp, CHDR_SIZE) != CHDR_SIZE)
+    if (pos + CHDR_SIZE > cdir.size())
       return false;
-    readCHeader(temp, ze);
+    readCHeader(cdir.data() + pos, ze);
     if (ze.header != ZIP_CENTRAL_HEADER)
     {
       CLog::Log(LOGDEBUG, "ZipManager: broken file {}!", strFile);
       mFile.Close();
       return false;
     }
+    pos += CHDR_SIZE;
 
     // Get the filename just after the central file header
-    std::vector<char> bufName(ze.flength);
-    if (mFile.Read(bufName.data(), ze.flength) != ze.flength)
+    if (pos + ze.flength > cdir.size())
       return false;
-    std::string strName(bufName.data(), bufName.size());
-    bufName.clear();
+    std::string strName(cdir.data() + pos, ze.flength);
     if ((ze.flags & ZC_FLAG_EFS) == 0)
     {
       std::string tmp(strName);
@@ -191,7 +217,7 @@ bool CZipManager::GetZipList(const CURL& url, std::vector<SZipEntry>& items)
     strncpy(ze.name, strName.c_str(), strName.size() > 254 ? 254 : strName.size());
 
     // Jump after central file header extra field and file comment
-    mFile.Seek(ze.eclength + ze.clength,SEEK_CUR);
+    pos += ze.flength + ze.eclength + ze.clength;
 
     if (pathTraversal.RegFind(strName) < 0)
       items.push_back(ze);
@@ -212,7 +238,6 @@ bool CZipManager::GetZipList(const CURL& url, std::vector<SZipEntry>& items)
 
   }
 
-  mZipMap.insert(make_pair(strFile,items));
   mFile.Close();
   return true;
 }
@@ -221,27 +246,28 @@ bool CZipManager::GetZipEntry(const CURL& url, SZipEntry& item)
 {
   const std::string& strFile = url.GetHostName();
 
-  std::map<std::string, std::vector<SZipEntry> >::iterator it = mZipMap.find(strFile);
-  std::vector<SZipEntry> items;
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  auto it = mZipMap.find(strFile);
   if (it == mZipMap.end()) // we need to list the zip
   {
-    GetZipList(url,items);
-  }
-  else
-  {
-    items = it->second;
-  }
+    lock.unlock();
+    std::vector<SZipEntry> items;
+    if (!GetZipList(url, items))
+      return false;
 
-  const std::string& strFileName = url.GetFileName();
-  for (const auto& it2 : items)
-  {
-    if (std::string(it2.name) == strFileName)
-    {
-      item = it2;
-      return true;
-    }
+    lock.lock();
+    it = mZipMap.find(strFile);
+    if (it == mZipMap.end())
+      return false;
   }
-  return false;
+
+  const SZipArchive& archive = it->second;
+  const auto entry = archive.index.find(url.GetFileName());
+  if (entry == archive.index.end())
+    return false;
+
+  item = archive.entries[entry->second];
+  return true;
 }
 
 bool CZipManager::ExtractArchive(const std::string& strArchive, const std::string& strPath)
@@ -308,13 +334,6 @@ void CZipManager::readCHeader(const char* buffer, SZipEntry& info)
 void CZipManager::release(const std::string& strPath)
 {
   CURL url(strPath);
-  std::map<std::string, std::vector<SZipEntry> >::iterator it= mZipMap.find(url.GetHostName());
-  if (it != mZipMap.end())
-  {
-    std::map<std::string,int64_t>::iterator it2=mZipDate.find(url.GetHostName());
-    mZipMap.erase(it);
-    mZipDate.erase(it2);
-  }
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  mZipMap.erase(url.GetHostName());
 }
-
-
@@ -19,10 +19,13 @@
 #define CHDR_SIZE 46
 #define ECDREC_SIZE 22
 
+#include "threads/CriticalSection.h"
+
 #include <cstdint>
 #include <cstring>
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 class CURL;
@@ -67,8 +70,17 @@ public:
   static void readHeader(const char* buffer, SZipEntry& info);
   static void readCHeader(const char* buffer, SZipEntry& info);
 private:
-  std::map<std::string,std::vector<SZipEntry> > mZipMap;
-  std::map<std::string,int64_t> mZipDate;
+  struct SZipArchive
+  {
+    int64_t date = 0; // modification time, for update detection
+    std::vector<SZipEntry> entries;
+    std::unordered_map<std::string, size_t> index; // entry name -> position in entries
+  };
+
+  bool ReadZipList(const std::string& strFile, std::vector<SZipEntry>& items);
+
+  std::map<std::string, SZipArchive> mZipMap;
+  CCriticalSection m_critSection;
 
   template<typename T>
   static T ReadUnaligned(const void* mem)
@@ -0,0 +1,75 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "filesystem/FileCacheStats.h"
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+using namespace XFILE;
+using namespace std::chrono_literals;
+
+TEST(TestFileCacheStats, Record)
+{
+  CFileCacheStats::Record record("smb://server/share/movie.mkv");
+
+  record.AddFetch(1000, 3ms);
+  record.AddFetch(3000, 150ms);
+  record.AddFetch(0, 10000ms);
+  record.AddRead(500);
+  record.AddRead(500);
+  record.AddRead(500);
+  record.AddSeek(true);
+  record.AddSeek(false);
+  record.AddStall(20ms);
+  record.AddStall(80ms);
+
+  const CFileCacheStats::Stats stats = record.GetStats();
+  EXPECT_EQ("smb://server/share/movie.mkv", stats.source);
+  EXPECT_TRUE(stats.open);
+  EXPECT_EQ(4000, stats.bytesFetched);
+  EXPECT_EQ(3u, stats.fetches);
+  EXPECT_EQ(1500, stats.bytesRead);
+  EXPECT_EQ(2u, stats.seeks);
+  EXPECT_EQ(1u, stats.cachedSeeks);
+  EXPECT_EQ(2u, stats.stalls);
+  EXPECT_EQ(100ms, stats.stallTime);
+  EXPECT_EQ(80ms, stats.longestStall);
+
+  // <= 5ms, <= 250ms and the unbounded last bucket
+  EXPECT_EQ(1u, stats.refillLatency[0]);
+  EXPECT_EQ(1u, stats.refillLatency[4]);
+  EXPECT_EQ(1u, stats.refillLatency.back());
+
+  // 2 stalls and 1 seek on the source out of 5 reads and seeks
+  EXPECT_DOUBLE_EQ(0.4, stats.GetHitRatio());
+  EXPECT_DOUBLE_EQ(4000.0 * 1000.0 / 10153.0, stats.GetFetchRate());
+
+  record.Close();
+  EXPECT_FALSE(record.IsOpen());
+}
+
+TEST(TestFileCacheStats, Register)
+{
+  const auto open = CFileCacheStats::Register("test://open");
+  for (size_t i = 0; i < CFileCacheStats::MAX_CLOSED + 4; i++)
+    CFileCacheStats::Register("test://closed")->Close();
+
+  EXPECT_EQ(open, CFileCacheStats::GetLastOpen());
+
+  const std::vector<CFileCacheStats::Stats> stats = CFileCacheStats::GetStats();
+  EXPECT_EQ(CFileCacheStats::MAX_CLOSED,
+            static_cast<size_t>(std::ranges::count_if(
+                stats, [](const CFileCacheStats::Stats& stats) { return !stats.open; })));
+  EXPECT_TRUE(std::ranges::any_of(stats, [](const CFileCacheStats::Stats& stats)
+                                  { return stats.source == "test://open"; }));
+
+  open->Close();
+  EXPECT_NE(open, CFileCacheStats::GetLastOpen());
+}
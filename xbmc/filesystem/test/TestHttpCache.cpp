@@ -0,0 +1,105 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "filesystem/File.h"
+#include "filesystem/HttpCache.h"
+#include "test/TestUtils.h"
+#include "utils/HttpHeader.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace XFILE;
+
+namespace
+{
+// Sun, 01 Jun 2025 12:00:00 GMT
+constexpr time_t NOW = 1748779200;
+
+CHttpHeader MakeHeader(const std::string& lines)
+{
+  CHttpHeader header;
+  header.Parse("HTTP/1.1 200 OK\r\n" + lines + "\r\n");
+  return header;
+}
+} // namespace
+
+TEST(TestHttpCache, MaxAge)
+{
+  time_t expires;
+  ASSERT_TRUE(CHttpCache::GetExpiry(MakeHeader("Cache-Control: public, max-age=3600\r\n"), NOW,
+                                    expires));
+  EXPECT_EQ(NOW + 3600, expires);
+
+  ASSERT_TRUE(CHttpCache::GetExpiry(
+      MakeHeader("Cache-Control: max-age=3600\r\nAge: 600\r\n"
+                 "Expires: Sun, 01 Jun 2025 20:00:00 GMT\r\n"),
+      NOW, expires));
+  EXPECT_EQ(NOW + 3000, expires);
+}
+
+TEST(TestHttpCache, Expires)
+{
+  time_t expires;
+  ASSERT_TRUE(CHttpCache::GetExpiry(MakeHeader("Date: Sun, 01 Jun 2025 10:00:00 GMT\r\n"
+                                               "Expires: Sun, 01 Jun 2025 11:00:00 GMT\r\n"),
+                                    NOW, expires));
+  // relative to the server clock, which is two hours behind
+  EXPECT_EQ(NOW + 3600, expires);
+
+  ASSERT_TRUE(CHttpCache::GetExpiry(MakeHeader("Expires: 0\r\n"), NOW, expires));
+  EXPECT_EQ(NOW, expires);
+}
+
+TEST(TestHttpCache, LastModified)
+{
+  time_t expires;
+  ASSERT_TRUE(CHttpCache::GetExpiry(MakeHeader("Date: Sun, 01 Jun 2025 12:00:00 GMT\r\n"
+                                               "Last-Modified: Sun, 01 Jun 2025 02:00:00 GMT\r\n"),
+                                    NOW, expires));
+  EXPECT_EQ(NOW + 3600, expires);
+
+  ASSERT_TRUE(CHttpCache::GetExpiry(MakeHeader("Date: Sun, 01 Jun 2025 12:00:00 GMT\r\n"
+                                               "Last-Modified: Sun, 01 Jun 2014 12:00:00 GMT\r\n"),
+                                    NOW, expires));
+  EXPECT_EQ(NOW + 24 * 60 * 60, expires);
+}
+
+TEST(TestHttpCache, NoCache)
+{
+  time_t expires;
+  ASSERT_TRUE(CHttpCache::GetExpiry(MakeHeader("Cache-Control: no-cache, max-age=3600\r\n"), NOW,
+                                    expires));
+  EXPECT_EQ(NOW, expires);
+
+  EXPECT_FALSE(CHttpCache::GetExpiry(MakeHeader("Cache-Control: max-age=3600, No-Store\r\n"), NOW,
+                                     expires));
+}
+
+TEST(TestHttpCache, LoadBodySize)
+{
+  CFile* file;
+  ASSERT_NE(nullptr, file = XBMC_CREATETEMPFILE(""));
+  const std::string stored = "<xml/>";
+  EXPECT_EQ(static_cast<ssize_t>(stored.size()), file->Write(stored.data(), stored.size()));
+  file->Close();
+
+  CHttpCache::Entry entry;
+  entry.bodyFile = XBMC_TEMPFILEPATH(file);
+  entry.bodySize = stored.size();
+  std::string body;
+  EXPECT_TRUE(CHttpCache::LoadBody(entry, body));
+  EXPECT_EQ(stored, body);
+
+  // a body cut short, or one of a response being stored meanwhile, isn't used
+  entry.bodySize = stored.size() + 1;
+  EXPECT_FALSE(CHttpCache::LoadBody(entry, body));
+
+  EXPECT_TRUE(XBMC_DELETETEMPFILE(file));
+}
@@ -0,0 +1,140 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "filesystem/SparseCache.h"
+
+#include <numeric>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace XFILE;
+using namespace std::chrono_literals;
+
+namespace
+{
+constexpr size_t BLOCK_SIZE = 16;
+
+std::vector<char> MakeData(size_t size, char first)
+{
+  std::vector<char> data(size);
+  std::iota(data.begin(), data.end(), first);
+  return data;
+}
+
+void Fill(CSparseCache& cache, const std::vector<char>& data)
+{
+  size_t written = 0;
+  while (written < data.size())
+  {
+    const int ret = cache.WriteToCache(data.data() + written, data.size() - written);
+    ASSERT_GT(ret, 0);
+    written += ret;
+  }
+}
+
+std::vector<char> Drain(CSparseCache& cache, size_t size)
+{
+  std::vector<char> data(size);
+  size_t read = 0;
+  while (read < size)
+  {
+    const int ret = cache.ReadFromCache(data.data() + read, size - read);
+    if (ret <= 0)
+      break;
+    read += ret;
+  }
+  data.resize(read);
+  return data;
+}
+} // namespace
+
+TEST(TestSparseCache, WriteAndRead)
+{
+  CSparseCache cache(BLOCK_SIZE * 8, BLOCK_SIZE);
+  ASSERT_EQ(CACHE_RC_OK, cache.Open());
+
+  const auto data = MakeData(BLOCK_SIZE * 3 + 5, 'a');
+  Fill(cache, data);
+  EXPECT_EQ(static_cast<int64_t>(data.size()), cache.WaitForData(0, 0ms));
+  EXPECT_EQ(data, Drain(cache, data.size()));
+  EXPECT_EQ(CACHE_RC_WOULD_BLOCK, cache.ReadFromCache(nullptr, 1));
+}
+
+TEST(TestSparseCache, KeepsRangesOnReset)
+{
+  CSparseCache cache(BLOCK_SIZE * 8, BLOCK_SIZE);
+  ASSERT_EQ(CACHE_RC_OK, cache.Open());
+
+  const auto head = MakeData(BLOCK_SIZE * 2, 'a');
+  Fill(cache, head);
+
+  // jump well past the cached range, nothing is available there yet
+  const int64_t farPos = BLOCK_SIZE * 10000;
+  EXPECT_FALSE(cache.IsCachedPosition(farPos));
+  EXPECT_EQ(CACHE_RC_ERROR, cache.Seek(farPos));
+  EXPECT_TRUE(cache.Reset(farPos));
+  Fill(cache, MakeData(BLOCK_SIZE, 'A'));
+  EXPECT_EQ(2u, cache.GetRangeCount());
+
+  // going back resumes at the end of the first range without a full reset
+  EXPECT_EQ(CACHE_RC_ERROR, cache.Seek(4));
+  EXPECT_EQ(static_cast<int64_t>(head.size()), cache.CachedDataEndPosIfSeekTo(4));
+  EXPECT_FALSE(cache.Reset(4));
+  EXPECT_EQ(static_cast<int64_t>(head.size()), cache.CachedDataEndPos());
+  EXPECT_EQ(std::vector<char>(head.begin() + 4, head.end()), Drain(cache, head.size()));
+
+  // seeking inside the range being filled succeeds directly
+  EXPECT_EQ(1, cache.Seek(1));
+}
+
+TEST(TestSparseCache, EvictsLeastRecentlyUsed)
+{
+  CSparseCache cache(BLOCK_SIZE * 4, BLOCK_SIZE);
+  ASSERT_EQ(CACHE_RC_OK, cache.Open());
+
+  const auto first = MakeData(BLOCK_SIZE * 2, 'a');
+  Fill(cache, first);
+  Drain(cache, first.size());
+
+  EXPECT_TRUE(cache.Reset(BLOCK_SIZE * 10));
+  const auto second = MakeData(BLOCK_SIZE * 2, 'A');
+  Fill(cache, second);
+  Drain(cache, second.size());
+
+  // the store is full, the next block replaces the oldest one
+  EXPECT_TRUE(cache.Reset(BLOCK_SIZE * 20));
+  Fill(cache, MakeData(BLOCK_SIZE, '0'));
+  EXPECT_FALSE(cache.IsCachedPosition(0));
+  EXPECT_TRUE(cache.IsCachedPosition(BLOCK_SIZE));
+  EXPECT_TRUE(cache.IsCachedPosition(BLOCK_SIZE * 10));
+
+  // the forward window is never evicted
+  EXPECT_EQ(BLOCK_SIZE * 3, cache.GetMaxWriteSize(BLOCK_SIZE * 8));
+}
+
+TEST(TestSparseCache, WriteAtPosition)
+{
+  CSparseCache cache(BLOCK_SIZE * 8, BLOCK_SIZE);
+  ASSERT_EQ(CACHE_RC_OK, cache.Open());
+
+  Fill(cache, MakeData(BLOCK_SIZE, 'a'));
+
+  // out of band data ends at the block boundary and becomes a separate range
+  const auto ahead = MakeData(BLOCK_SIZE, 'A');
+  EXPECT_EQ(static_cast<int>(BLOCK_SIZE - 4),
+            cache.WriteToCacheAt(BLOCK_SIZE * 5 + 4, ahead.data(), ahead.size()));
+  EXPECT_EQ(2u, cache.GetRangeCount());
+  EXPECT_TRUE(cache.IsCachedPosition(BLOCK_SIZE * 5 + 4));
+  EXPECT_EQ(static_cast<int64_t>(BLOCK_SIZE * 6),
+            cache.CachedDataEndPosIfSeekTo(BLOCK_SIZE * 5 + 4));
+
+  // seeking there needs no refill
+  EXPECT_FALSE(cache.Reset(BLOCK_SIZE * 5 + 4));
+  EXPECT_EQ(std::vector<char>(ahead.begin(), ahead.end() - 4), Drain(cache, BLOCK_SIZE));
+}
@@ -530,6 +530,12 @@ void CGameClient::RunFrame()
   }
 }
 
+void CGameClient::SetStreamOutput(bool audio, bool video)
+{
+  m_audioOutput = audio;
+  m_videoOutput = video;
+}
+
 bool CGameClient::Serialize(uint8_t* data, size_t size)
 {
   if (data == nullptr || size == 0)
@@ -678,6 +684,11 @@ void CGameClient::cb_add_stream_data(KODI_HANDLE kodiInstance,
   if (gameClientStream == nullptr)
     return;
 
+  CGameClient* gameClient = static_cast<CGameClient*>(kodiInstance);
+  if (gameClient != nullptr &&
+      !(packet->type == GAME_STREAM_AUDIO ? gameClient->m_audioOutput : gameClient->m_videoOutput))
+    return;
+
   gameClientStream->AddData(*packet);
 }
 
@@ -169,6 +169,14 @@ public:
   double GetSampleRate() const { return m_samplerate; }
   void RunFrame();
 
+  /*!
+   * \brief Select which stream data produced by the following frames is passed
+   * on for playback
+   *
+   * Used to run frames that are not presented, e.g. for run-ahead.
+   */
+  void SetStreamOutput(bool audio, bool video);
+
   // Access memory
   size_t SerializeSize() const { return m_serializeSize; }
   bool Serialize(uint8_t* data, size_t size);
@@ -263,6 +271,8 @@ private:
   double m_framerate = 0.0; // Video frame rate (fps)
   double m_samplerate = 0.0; // Audio sample rate (Hz)
   GAME_REGION m_region = GAME_REGION_UNKNOWN; // Region of the loaded game
+  std::atomic_bool m_audioOutput{true};
+  std::atomic_bool m_videoOutput{true};
 
   // In-game saves
   std::unique_ptr<CGameClientInGameSaves> m_inGameSaves;
@@ -13,9 +13,31 @@
 #include "utils/log.h"
 
 #include <algorithm>
+#include <cmath>
 #include <string.h>
 using namespace XFILE;
 
+namespace
+{
+uint16_t ToRGB565(const float (&color)[3])
+{
+  const auto quantize = [](float value, int max)
+  { return std::clamp(static_cast<int>(value * max / 255.0f + 0.5f), 0, max); };
+  return static_cast<uint16_t>(quantize(color[0], 31) << 11 | quantize(color[1], 63) << 5 |
+                               quantize(color[2], 31));
+}
+
+void FromRGB565(uint16_t value, float (&color)[3])
+{
+  const int r = (value >> 11) & 0x1f;
+  const int g = (value >> 5) & 0x3f;
+  const int b = value & 0x1f;
+  color[0] = static_cast<float>(r << 3 | r >> 2);
+  color[1] = static_cast<float>(g << 2 | g >> 4);
+  color[2] = static_cast<float>(b << 3 | b >> 2);
+}
+} // namespace
+
 CDDSImage::CDDSImage()
 {
   m_data = NULL;
@@ -86,8 +108,11 @@ bool CDDSImage::ReadFile(const std::string &inputFile)
     return false;
   if (!GetFormat())
     return false;  // not supported
+  if (m_desc.linearSize < GetStorageRequirements(m_desc.width, m_desc.height, GetFormat()))
+    return false; // truncated
 
   // allocate our data
+  delete[] m_data;
   m_data = new unsigned char[m_desc.linearSize];
   if (!m_data)
     return false;
@@ -100,6 +125,211 @@ bool CDDSImage::ReadFile(const std::string &inputFile)
   return true;
 }
 
+bool CDDSImage::WriteFile(const std::string& outputFile) const
+{
+  if (!m_data)
+    return false;
+
+  CFile file;
+  if (!file.OpenForWrite(outputFile, true))
+    return false;
+
+  if (file.Write("DDS ", 4) != 4 ||
+      file.Write(&m_desc, sizeof(m_desc)) != static_cast<ssize_t>(sizeof(m_desc)) ||
+      file.Write(m_data, m_desc.linearSize) != static_cast<ssize_t>(m_desc.linearSize))
+  {
+    file.Close();
+    CFile::Delete(outputFile);
+    return false;
+  }
+
+  file.Close();
+  return true;
+}
+
+void CDDSImage::Compress(unsigned int width,
+                         unsigned int height,
+                         unsigned int pitch,
+                         const unsigned char* pixels)
+{
+  Allocate(width, height, XB_FMT_DXT1);
+
+  unsigned char* out = m_data;
+  for (unsigned int by = 0; by < height; by += 4)
+  {
+    for (unsigned int bx = 0; bx < width; bx += 4)
+    {
+      // blocks sticking out of the image repeat its last row and column
+      unsigned char block[16][3];
+      for (unsigned int i = 0; i < 16; i++)
+      {
+        const unsigned int x = std::min(bx + i % 4, width - 1);
+        const unsigned int y = std::min(by + i / 4, height - 1);
+        const unsigned char* bgra = pixels + y * pitch + x * 4;
+        block[i][0] = bgra[2];
+        block[i][1] = bgra[1];
+        block[i][2] = bgra[0];
+      }
+      CompressBlockDXT1(block, out);
+      out += 8;
+    }
+  }
+}
+
+void CDDSImage::CompressBlockDXT1(const unsigned char (&block)[16][3], unsigned char* out)
+{
+  // fit a line through the colours of the block and use its ends as the endpoints
+  float mean[3] = {};
+  for (const auto& pixel : block)
+    for (int c = 0; c < 3; c++)
+      mean[c] += pixel[c] / 16.0f;
+
+  float cov[3][3] = {};
+  for (const auto& pixel : block)
+  {
+    for (int i = 0; i < 3; i++)
+      for (int j = 0; j < 3; j++)
+        cov[i][j] += (pixel[i] - mean[i]) * (pixel[j] - mean[j]);
+  }
+
+  float axis[3] = {1.0f, 1.0f, 1.0f};
+  for (int iteration = 0; iteration < 8; iteration++)
+  {
+    float next[3];
+    for (int i = 0; i < 3; i++)
+      next[i] = cov[i][0] * axis[0] + cov[i][1] * axis[1] + cov[i][2] * axis[2];
+    const float length = std::sqrt(next[0] * next[0] + next[1] * next[1] + next[2] * next[2]);
+    if (length < 1e-6f)
+      break; // all colours are the same
+    for (int i = 0; i < 3; i++)
+      axis[i] = next[i] / length;
+  }
+
+  float minT = 0.0f;
+  float maxT = 0.0f;
+  for (const auto& pixel : block)
+  {
+    const float t = (pixel[0] - mean[0]) * axis[0] + (pixel[1] - mean[1]) * axis[1] +
+                    (pixel[2] - mean[2]) * axis[2];
+    minT = std::min(minT, t);
+    maxT = std::max(maxT, t);
+  }
+
+  float end0[3];
+  float end1[3];
+  for (int c = 0; c < 3; c++)
+  {
+    end0[c] = mean[c] + axis[c] * maxT;
+    end1[c] = mean[c] + axis[c] * minT;
+  }
+
+  uint16_t color0;
+  uint16_t color1;
+  uint32_t indices;
+  float error = EncodeBlockDXT1(block, end0, end1, color0, color1, indices);
+
+  // refine the endpoints with a least squares fit to the chosen indices
+  if (indices != 0)
+  {
+    static constexpr float weights[4] = {1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f};
+    float aa = 0.0f;
+    float ab = 0.0f;
+    float bb = 0.0f;
+    float ax[3] = {};
+    float bx[3] = {};
+    for (int i = 0; i < 16; i++)
+    {
+      const float a = weights[(indices >> (2 * i)) & 3];
+      const float b = 1.0f - a;
+      aa += a * a;
+      ab += a * b;
+      bb += b * b;
+      for (int c = 0; c < 3; c++)
+      {
+        ax[c] += a * block[i][c];
+        bx[c] += b * block[i][c];
+      }
+    }
+
+    const float det = aa * bb - ab * ab;
+    if (std::abs(det) > 1e-6f)
+    {
+      for (int c = 0; c < 3; c++)
+      {
+        end0[c] = (ax[c] * bb - bx[c] * ab) / det;
+        end1[c] = (bx[c] * aa - ax[c] * ab) / det;
+      }
+
+      uint16_t refined0;
+      uint16_t refined1;
+      uint32_t refinedIndices;
+      if (EncodeBlockDXT1(block, end0, end1, refined0, refined1, refinedIndices) < error)
+      {
+        color0 = refined0;
+        color1 = refined1;
+        indices = refinedIndices;
+      }
+    }
+  }
+
+  out[0] = color0 & 0xff;
+  out[1] = color0 >> 8;
+  out[2] = color1 & 0xff;
+  out[3] = color1 >> 8;
+  out[4] = indices & 0xff;
+  out[5] = (indices >> 8) & 0xff;
+  out[6] = (indices >> 16) & 0xff;
+  out[7] = indices >> 24;
+}
+
+float CDDSImage::EncodeBlockDXT1(const unsigned char (&block)[16][3],
+                                 const float (&end0)[3],
+                                 const float (&end1)[3],
+                                 uint16_t& color0,
+                                 uint16_t& color1,
+                                 uint32_t& indices)
+{
+  color0 = ToRGB565(end0);
+  color1 = ToRGB565(end1);
+  // color0 > color1 selects the four colour mode without transparency
+  if (color0 < color1)
+    std::swap(color0, color1);
+
+  float palette[4][3];
+  FromRGB565(color0, palette[0]);
+  FromRGB565(color1, palette[1]);
+  for (int c = 0; c < 3; c++)
+  {
+    palette[2][c] = (2.0f * palette[0][c] + palette[1][c]) / 3.0f;
+    palette[3][c] = (palette[0][c] + 2.0f * palette[1][c]) / 3.0f;
+  }
+
+  // with equal endpoints every pixel gets color0
+  const uint32_t colors = color0 != color1 ? 4 : 1;
+
+  indices = 0;
+  float total = 0.0f;
+  for (int i = 0; i < 16; i++)
+  {
+    uint32_t best = 0;
+    float bestError = 0.0f;
+    for (uint32_t p = 0; p < colors; p++)
+    {
+      float error = 0.0f;
+      for (int c = 0; c < 3; c++)
+        error += (block[i][c] - palette[p][c]) * (block[i][c] - palette[p][c]);
+      if (p == 0 || error < bestError)
+      {
+        best = p;
+        bestError = error;
+      }
+    }
+    indices |= best << (2 * i);
+    total += bestError;
+  }
+  return total;
+}
+
 unsigned int CDDSImage::GetStorageRequirements(unsigned int width,
                                                unsigned int height,
                                                XB_FMT format)
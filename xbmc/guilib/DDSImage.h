@@ -27,9 +27,29 @@ public:
   unsigned char *GetData() const;
 
   bool ReadFile(const std::string &file);
+  bool WriteFile(const std::string& file) const;
+
+  /*!
+   \brief Compress an image to DXT1, dropping its alpha channel.
+   \param width the width of the image
+   \param height the height of the image
+   \param pitch the number of bytes per row of pixels
+   \param pixels the image data in XB_FMT_A8R8G8B8
+   */
+  void Compress(unsigned int width,
+                unsigned int height,
+                unsigned int pitch,
+                const unsigned char* pixels);
 
 private:
   void Allocate(unsigned int width, unsigned int height, XB_FMT format);
+  static void CompressBlockDXT1(const unsigned char (&block)[16][3], unsigned char* out);
+  static float EncodeBlockDXT1(const unsigned char (&block)[16][3],
+                               const float (&end0)[3],
+                               const float (&end1)[3],
+                               uint16_t& color0,
+                               uint16_t& color1,
+                               uint32_t& indices);
   static const char* GetFourCC(XB_FMT format);
 
   static unsigned int GetStorageRequirements(unsigned int width,
@@ -10,6 +10,7 @@
 
 #include "utils/Geometry.h"
 
+#include <memory_resource>
 #include <vector>
 
 class CDirtyRegion : public CRect
@@ -24,4 +25,5 @@ private:
   int m_age;
 };
 
-typedef std::vector<CDirtyRegion> CDirtyRegionList;
+// lists of a frame are allocated from CGUIFrameArena, copies of them use the heap
+using CDirtyRegionList = std::pmr::vector<CDirtyRegion>;
@@ -14,6 +14,7 @@
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/log.h"
+#include "windowing/WinSystem.h"
 
 #include <algorithm>
 #include <stdio.h>
@@ -32,7 +33,19 @@ void CDirtyRegionTracker::SelectAlgorithm()
 {
   delete m_solver;
 
-  switch (CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiAlgorithmDirtyRegions)
+  m_algorithm =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiAlgorithmDirtyRegions;
+  if (m_algorithm == DIRTYREGION_SOLVER_AUTO)
+  {
+    // without the buffer age the previous contents of the back buffer are unknown, in which
+    // case any change has to redraw everything
+    const auto winSystem = CServiceBroker::GetWinSystem();
+    m_algorithm = winSystem && winSystem->IsBufferAgeSupported()
+                      ? DIRTYREGION_SOLVER_COST_REDUCTION
+                      : DIRTYREGION_SOLVER_FILL_VIEWPORT_ON_CHANGE;
+  }
+
+  switch (m_algorithm)
   {
     case DIRTYREGION_SOLVER_FILL_VIEWPORT_ON_CHANGE:
       CLog::Log(LOGDEBUG, "guilib: Fill viewport on change for solving rendering passes");
@@ -65,14 +78,10 @@ const CDirtyRegionList &CDirtyRegionTracker::GetMarkedRegions() const
   return m_markedRegions;
 }
 
-CDirtyRegionList CDirtyRegionTracker::GetDirtyRegions()
+void CDirtyRegionTracker::GetDirtyRegions(CDirtyRegionList& output)
 {
-  CDirtyRegionList output;
-
   if (m_solver)
     m_solver->Solve(m_markedRegions, output);
-
-  return output;
 }
 
 void CDirtyRegionTracker::CleanMarkedRegions(int bufferAge)
@@ -16,13 +16,15 @@ public:
   CDirtyRegionTracker();
   ~CDirtyRegionTracker();
   void SelectAlgorithm();
+  int GetAlgorithm() const { return m_algorithm; }
   void MarkDirtyRegion(const CDirtyRegion &region);
 
   const CDirtyRegionList &GetMarkedRegions() const;
-  CDirtyRegionList GetDirtyRegions();
+  void GetDirtyRegions(CDirtyRegionList& output);
   void CleanMarkedRegions(int bufferAge);
 
 private:
   CDirtyRegionList m_markedRegions;
   IDirtyRegionSolver *m_solver;
+  int m_algorithm = DIRTYREGION_SOLVER_FILL_VIEWPORT_ALWAYS;
 };
@@ -76,6 +76,45 @@ static inline size_t Clamp(int64_t newPosition, size_t bufferSize)
   return std::min(std::max((int64_t) 0, newPosition), (int64_t) (bufferSize -1));
 }
 
+namespace
+{
+// Read the size from the start of frame segment of a JPEG without decoding it
+bool GetJpegSize(const unsigned char* buffer,
+                 size_t bufSize,
+                 unsigned int& width,
+                 unsigned int& height)
+{
+  size_t pos = 2; // skip SOI
+  while (pos + 4 <= bufSize)
+  {
+    if (buffer[pos] != 0xFF)
+      return false;
+
+    const uint8_t marker = buffer[pos + 1];
+    if (marker == 0xFF) // fill byte
+    {
+      pos++;
+      continue;
+    }
+    if (marker == 0xD9 || marker == 0xDA) // end of image or start of scan before any frame
+      return false;
+
+    // SOF0 - SOF15, except DHT, JPG and DAC which share the range
+    if (marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC)
+    {
+      if (pos + 9 > bufSize)
+        return false;
+      height = (buffer[pos + 5] << 8) | buffer[pos + 6];
+      width = (buffer[pos + 7] << 8) | buffer[pos + 8];
+      return width > 0 && height > 0;
+    }
+
+    pos += 2 + ((buffer[pos + 2] << 8) | buffer[pos + 3]);
+  }
+  return false;
+}
+} // unnamed namespace
+
 static int mem_file_read(void *h, uint8_t* buf, int size)
 {
   if (size < 0)
@@ -144,7 +183,7 @@ bool CFFmpegImage::LoadImageFromMemory(unsigned char* buffer, unsigned int bufSi
                                       unsigned int width, unsigned int height)
 {
 
-  if (!Initialize(buffer, bufSize))
+  if (!Initialize(buffer, bufSize, width, height))
   {
     //log
     return false;
@@ -156,7 +195,10 @@ bool CFFmpegImage::LoadImageFromMemory(unsigned char* buffer, unsigned int bufSi
   return !(m_pFrame == nullptr);
 }
 
-bool CFFmpegImage::Initialize(unsigned char* buffer, size_t bufSize)
+bool CFFmpegImage::Initialize(unsigned char* buffer,
+                              size_t bufSize,
+                              unsigned int idealWidth /* = 0 */,
+                              unsigned int idealHeight /* = 0 */)
 {
   int bufferSize = 4096;
   uint8_t* fbuffer = (uint8_t*)av_malloc(bufferSize + AV_INPUT_BUFFER_PADDING_SIZE);
@@ -278,6 +320,29 @@ bool CFFmpegImage::Initialize(unsigned char* buffer, size_t bufSize)
     return false;
   }
 
+  // Let the decoder skip most of the work for JPEGs much bigger than wanted (e.g. photos shown
+  // on screen) by decoding them at 1/2, 1/4 or 1/8 of their size, as long as that still
+  // covers the ideal size.
+  m_fullWidth = 0;
+  m_fullHeight = 0;
+  unsigned int jpegWidth;
+  unsigned int jpegHeight;
+  if (is_jpeg && codec->id == AV_CODEC_ID_MJPEG && idealWidth && idealHeight &&
+      GetJpegSize(buffer, bufSize, jpegWidth, jpegHeight))
+  {
+    int lowres = 0;
+    while (lowres < codec->max_lowres && (jpegWidth >> (lowres + 1)) >= idealWidth &&
+           (jpegHeight >> (lowres + 1)) >= idealHeight)
+      lowres++;
+
+    if (lowres > 0)
+    {
+      m_codec_ctx->lowres = lowres;
+      m_fullWidth = jpegWidth;
+      m_fullHeight = jpegHeight;
+    }
+  }
+
   if (avcodec_open2(m_codec_ctx, codec, NULL) < 0)
   {
     avformat_close_input(&m_fctx);
@@ -336,8 +401,8 @@ AVFrame* CFFmpegImage::ExtractFrame()
 
   m_height = frame->height;
   m_width = frame->width;
-  m_originalWidth = m_width;
-  m_originalHeight = m_height;
+  m_originalWidth = m_fullWidth ? m_fullWidth : m_width;
+  m_originalHeight = m_fullHeight ? m_fullHeight : m_height;
 
   const AVPixFmtDescriptor* pixDescriptor = av_pix_fmt_desc_get(static_cast<AVPixelFormat>(frame->format));
   if (pixDescriptor && ((pixDescriptor->flags & (AV_PIX_FMT_FLAG_ALPHA | AV_PIX_FMT_FLAG_PAL)) != 0))
@@ -509,7 +574,7 @@ bool CFFmpegImage::DecodeFrame(AVFrame* frame, unsigned int width, unsigned int
   AVColorRange range = frame->color_range;
   AVPixelFormat pixFormat = ConvertFormats(frame);
 
-  SwsContext* context = sws_getContext(m_originalWidth, m_originalHeight, pixFormat, width, height,
+  SwsContext* context = sws_getContext(frame->width, frame->height, pixFormat, width, height,
                                        AV_PIX_FMT_RGB32, SWS_BICUBIC, NULL, NULL, NULL);
 
   if (range == AVCOL_RANGE_JPEG)
@@ -522,7 +587,7 @@ bool CFFmpegImage::DecodeFrame(AVFrame* frame, unsigned int width, unsigned int
     sws_setColorspaceDetails(context, inv_table, srcRange, table, dstRange, brightness, contrast, saturation);
   }
 
-  sws_scale(context, frame->data, frame->linesize, 0, m_originalHeight,
+  sws_scale(context, frame->data, frame->linesize, 0, frame->height,
     pictureRGB->data, pictureRGB->linesize);
   sws_freeContext(context);
 
@@ -71,7 +71,15 @@ public:
                                   unsigned int &bufferoutSize) override;
   void ReleaseThumbnailBuffer() override;
 
-  bool Initialize(unsigned char* buffer, size_t bufSize);
+  /*!
+   \brief Open the image in the buffer for decoding.
+   \param idealWidth, idealHeight the size the image is wanted at, big JPEGs are decoded at a
+   reduced size that is still at least this big
+   */
+  bool Initialize(unsigned char* buffer,
+                  size_t bufSize,
+                  unsigned int idealWidth = 0,
+                  unsigned int idealHeight = 0);
 
   std::shared_ptr<Frame> ReadFrame();
 
@@ -94,4 +102,8 @@ private:
 
   AVFrame* m_pFrame;
   uint8_t* m_outputBuffer;
+
+  // size of a JPEG decoded at reduced size, 0 if decoded at full size
+  unsigned int m_fullWidth = 0;
+  unsigned int m_fullHeight = 0;
 };
@@ -11,6 +11,7 @@
 #include "FileItem.h"
 #include "FileItemList.h"
 #include "GUIInfoManager.h"
+#include "GUIFrameStats.h"
 #include "GUIListItemLayout.h"
 #include "GUIMessage.h"
 #include "ServiceBroker.h"
@@ -135,6 +136,8 @@ void CGUIBaseContainer::DoProcess(unsigned int currentTime, CDirtyRegionList &di
 
 void CGUIBaseContainer::Process(unsigned int currentTime, CDirtyRegionList &dirtyregions)
 {
+  CGUIFrameStatsTimer frameStats(CGUIFrameStats::Phase::PROCESS, GetParentID(), GetID());
+
   // update our auto-scrolling as necessary
   UpdateAutoScrolling(currentTime);
 
@@ -264,6 +267,8 @@ void CGUIBaseContainer::Render()
 {
   if (!m_layout || !m_focusedLayout) return;
 
+  CGUIFrameStatsTimer frameStats(CGUIFrameStats::Phase::RENDER, GetParentID(), GetID());
+
   int offset = (int)floorf(m_scroller.GetValue() / m_layout->Size(m_orientation));
 
   int cacheBefore, cacheAfter;
@@ -1310,6 +1315,7 @@ void CGUIBaseContainer::Reset()
 {
   m_wasReset = true;
   m_items.clear();
+  m_keptValid = false;
   m_lastItem.reset();
   ResetAutoScrolling();
 }
@@ -1354,18 +1360,42 @@ void CGUIBaseContainer::SetRenderOffset(const CPoint &offset)
 
 void CGUIBaseContainer::FreeMemory(int keepStart, int keepEnd)
 {
-  if (keepStart < keepEnd)
-  { // remove before keepStart and after keepEnd
-    for (int i = 0; i < keepStart && i < (int)m_items.size(); ++i)
-      m_items[i]->FreeMemory();
-    for (int i = std::max(keepEnd + 1, 0); i < (int)m_items.size(); ++i)
-      m_items[i]->FreeMemory();
+  // keep from keepStart to keepEnd, if keepStart is past keepEnd the range wraps around
+  const auto isKept = [keepStart, keepEnd](int i)
+  {
+    if (keepStart < keepEnd)
+      return i >= keepStart && i <= keepEnd;
+    return i <= keepEnd || i >= keepStart;
+  };
+
+  const int size = static_cast<int>(m_items.size());
+  const auto freeRange = [&](int start, int end)
+  {
+    for (int i = std::max(start, 0); i < std::min(end, size); ++i)
+    {
+      if (!isKept(i))
+        m_items[i]->FreeMemory();
+    }
+  };
+
+  if (!m_keptValid || m_keptItems != m_items.size())
+    freeRange(0, size);
+  else if (m_keptStart < m_keptEnd)
+  {
+    // only the items kept last time can have layouts, which saves walking all items of a long
+    // list every frame
+    freeRange(m_keptStart, m_keptEnd + 1);
   }
   else
-  { // wrapping
-    for (int i = std::max(keepEnd + 1, 0); i < keepStart && i < (int)m_items.size(); ++i)
-      m_items[i]->FreeMemory();
+  {
+    freeRange(0, m_keptEnd + 1);
+    freeRange(m_keptStart, size);
   }
+
+  m_keptValid = true;
+  m_keptStart = keepStart;
+  m_keptEnd = keepEnd;
+  m_keptItems = m_items.size();
 }
 
 bool CGUIBaseContainer::InsideLayout(const CGUIListItemLayout *layout, const CPoint &point) const
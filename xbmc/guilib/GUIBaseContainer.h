@@ -229,6 +229,12 @@ private:
   int m_cursor;
   int m_offset;
   int m_cacheItems;
+
+  // the items kept by the last FreeMemory(), no other item can have a layout
+  bool m_keptValid{false};
+  int m_keptStart{0};
+  int m_keptEnd{0};
+  size_t m_keptItems{0};
   CStopWatch m_scrollTimer;
   CStopWatch m_lastScrollStartTimer;
   CStopWatch m_pageChangeTimer;
@@ -23,6 +23,8 @@
 #include "input/mouse/MouseStat.h"
 #include "utils/log.h"
 
+#include <algorithm>
+
 using namespace KODI;
 using namespace GUILIB;
 
@@ -89,6 +91,7 @@ void CGUIControl::AllocResources()
   m_hasProcessed = false;
   m_bInvalidated = true;
   m_bAllocated=true;
+  m_hiddenIdle = false;
 }
 
 void CGUIControl::FreeResources(bool immediately)
@@ -104,6 +107,7 @@ void CGUIControl::FreeResources(bool immediately)
       if (anim.GetType() != ANIM_TYPE_CONDITIONAL)
         anim.ResetAnimation();
     }
+    m_animationsIdle = false;
     m_bAllocated=false;
   }
   m_hasProcessed = false;
@@ -121,6 +125,7 @@ void CGUIControl::DynamicResourceAlloc(bool bOnOff)
 void CGUIControl::DoProcess(unsigned int currentTime, CDirtyRegionList &dirtyregions)
 {
   CRect dirtyRegion = m_renderRegion;
+  const bool wasHidden = !CGUIControl::IsVisible();
 
   bool changed = (m_controlDirtyState & DIRTY_STATE_CONTROL) != 0 || (m_bInvalidated && IsVisible());
   m_controlDirtyState = 0;
@@ -159,6 +164,13 @@ void CGUIControl::DoProcess(unsigned int currentTime, CDirtyRegionList &dirtyreg
 
   UpdateControlStats();
 
+  // UpdateVisibility() ran while we were hidden too, so only a change of visibility, focus or
+  // animations needs another update
+  m_hiddenIdle = wasHidden && !CGUIControl::IsVisible() && m_animationsIdle &&
+                 m_allowHiddenFocus.IsConstant() && !m_allowHiddenFocus &&
+                 std::ranges::none_of(m_animations, [](const CAnimation& anim)
+                                      { return anim.GetType() == ANIM_TYPE_CONDITIONAL; });
+
   changed |= (m_controlDirtyState & DIRTY_STATE_CONTROL) != 0;
 
   if (changed)
@@ -416,6 +428,17 @@ bool CGUIControl::CanFocus() const
   return true;
 }
 
+bool CGUIControl::CanSkipProcess() const
+{
+  if (!m_hiddenIdle || CGUIControl::IsVisible() || !m_animationsIdle || m_controlDirtyState ||
+      m_bHasFocus)
+    return false;
+
+  // the condition is cached by the info manager, only a change of its value needs an update
+  return !m_visibleCondition ||
+         m_visibleCondition->Get(INFO::DEFAULT_CONTEXT) == m_visibleFromSkinCondition;
+}
+
 bool CGUIControl::IsVisible() const
 {
   if (m_forceHidden)
@@ -456,6 +479,8 @@ void CGUIControl::SetPosition(float posX, float posY)
     m_hitRect += CPoint(posX - m_posX, posY - m_posY);
     m_posX = posX;
     m_posY = posY;
+    // animations centered on the control need their transform for the new center
+    m_animationsIdle = false;
 
     SetInvalid();
   }
@@ -531,6 +556,7 @@ void CGUIControl::SetWidth(float width)
     MarkDirtyRegion();
     m_width = width;
     m_hitRect.x2 = m_hitRect.x1 + width;
+    m_animationsIdle = false;
     SetInvalid();
   }
 }
@@ -542,6 +568,7 @@ void CGUIControl::SetHeight(float height)
     MarkDirtyRegion();
     m_height = height;
     m_hitRect.y2 = m_hitRect.y1 + height;
+    m_animationsIdle = false;
     SetInvalid();
   }
 }
@@ -634,8 +661,8 @@ void CGUIControl::UpdateVisibility(const CGUIListItem *item)
   for (unsigned int i = 0; i < m_animations.size(); i++)
   {
     CAnimation &anim = m_animations[i];
-    if (anim.GetType() == ANIM_TYPE_CONDITIONAL)
-      anim.UpdateCondition(item);
+    if (anim.GetType() == ANIM_TYPE_CONDITIONAL && anim.UpdateCondition(item))
+      m_animationsIdle = false;
   }
   // and check for conditional enabling - note this overrides SetEnabled() from the code currently
   // this may need to be reviewed at a later date
@@ -676,6 +703,7 @@ void CGUIControl::SetInitialVisibility()
     if (anim.GetType() == ANIM_TYPE_CONDITIONAL)
       anim.SetInitialCondition();
   }
+  m_animationsIdle = false;
   // and check for conditional enabling - note this overrides SetEnabled() from the code currently
   // this may need to be reviewed at a later date
   if (m_enableCondition)
@@ -700,6 +728,7 @@ void CGUIControl::SetVisibleCondition(const std::string &expression, const std::
 void CGUIControl::SetAnimations(const std::vector<CAnimation> &animations)
 {
   m_animations = animations;
+  m_animationsIdle = false;
   MarkDirtyRegion();
 }
 
@@ -712,6 +741,7 @@ void CGUIControl::ResetAnimation(ANIMATION_TYPE type)
     if (m_animations[i].GetType() == type)
       m_animations[i].ResetAnimation();
   }
+  m_animationsIdle = false;
 }
 
 void CGUIControl::ResetAnimations()
@@ -720,6 +750,7 @@ void CGUIControl::ResetAnimations()
 
   for (unsigned int i = 0; i < m_animations.size(); i++)
     m_animations[i].ResetAnimation();
+  m_animationsIdle = false;
 
   MarkDirtyRegion();
 }
@@ -780,6 +811,8 @@ void CGUIControl::QueueAnimation(ANIMATION_TYPE animType)
 
 CAnimation *CGUIControl::GetAnimation(ANIMATION_TYPE type, bool checkConditions /* = true */)
 {
+  // the caller may change the animation
+  m_animationsIdle = false;
   for (unsigned int i = 0; i < m_animations.size(); i++)
   {
     CAnimation &anim = m_animations[i];
@@ -859,13 +892,19 @@ void CGUIControl::UpdateStates(ANIMATION_TYPE type, ANIMATION_PROCESS currentPro
 
 bool CGUIControl::Animate(unsigned int currentTime)
 {
+  // nothing queued or in process and the center didn't move, e.g. with the text of an auto width
+  // label, the transform is still the one of the last frame
+  const CPoint center(GetXPosition() + GetWidth() * 0.5f, GetYPosition() + GetHeight() * 0.5f);
+  if (m_animationsIdle && center == m_animationCenter)
+    return false;
+  m_animationCenter = center;
+
   // check visible state outside the loop, as it could change
   GUIVISIBLE visible = m_visible;
 
   m_transform.Reset();
   bool changed = false;
 
-  CPoint center(GetXPosition() + GetWidth() * 0.5f, GetYPosition() + GetHeight() * 0.5f);
   for (unsigned int i = 0; i < m_animations.size(); i++)
   {
     CAnimation &anim = m_animations[i];
@@ -883,6 +922,13 @@ bool CGUIControl::Animate(unsigned int currentTime)
     //}
   }
 
+  m_animationsIdle = std::ranges::all_of(m_animations,
+                                         [](const CAnimation& anim)
+                                         {
+                                           return anim.GetProcess() == ANIM_PROCESS_NONE &&
+                                                  anim.GetQueuedProcess() == ANIM_PROCESS_NONE;
+                                         });
+
   return changed;
 }
 
@@ -100,6 +100,13 @@ public:
   /*! \brief Returns whether or not we have processed */
   bool HasProcessed() const { return m_hasProcessed; }
 
+  /*! \brief Check whether updating and processing the control can be skipped this frame
+   Hidden controls that were processed while hidden and have no animation, focus or dirty state
+   pending only need their visibility condition checked until it changes.
+   \return true if UpdateVisibility() and DoProcess() would have no effect
+   */
+  bool CanSkipProcess() const;
+
   // OnAction() is called by our window when we are the focused control.
   // We should process any control-specific actions in the derived classes,
   // and return true if we have taken care of the action.  Returning false
@@ -388,6 +395,9 @@ protected:
   TransformMatrix m_transform;
   TransformMatrix m_cachedTransform; // Contains the absolute transform the control
   bool m_isCulled{true};
+  bool m_animationsIdle{false}; // m_transform holds the end state of the animations
+  CPoint m_animationCenter; // the center m_transform was computed for
+  bool m_hiddenIdle{false}; // processed while hidden, nothing left to update until shown
 
   static const unsigned int DIRTY_STATE_CONTROL = 1; //This control is dirty
   static const unsigned int DIRTY_STATE_CHILD = 2; //One / more children are dirty
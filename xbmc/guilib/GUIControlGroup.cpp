@@ -91,6 +91,10 @@ void CGUIControlGroup::Process(unsigned int currentTime, CDirtyRegionList &dirty
   CRect rect;
   for (auto *control : m_children)
   {
+    // hidden branches that have settled cost a cached condition check only
+    if (control->CanSkipProcess())
+      continue;
+
     control->UpdateVisibility(nullptr);
     unsigned int oldDirty = dirtyregions.size();
     control->DoProcess(currentTime, dirtyregions);
@@ -8,6 +8,8 @@
 
 #include "GUIControlLookup.h"
 
+#include <algorithm>
+
 CGUIControlLookup::CGUIControlLookup(const CGUIControlLookup& from) : CGUIControl(from)
 {
 }
@@ -41,11 +43,9 @@ bool CGUIControlLookup::IsValidControl(const CGUIControl *control) const
 {
   if (control->GetID())
   {
-    for (const auto &i : m_lookup)
-    {
-      if (control == i.second)
-        return true;
-    }
+    const auto range = m_lookup.equal_range(control->GetID());
+    return std::any_of(range.first, range.second,
+                       [control](const auto& i) { return i.second == control; });
   }
   return false;
 }
@@ -74,29 +74,11 @@ void CGUIControlLookup::RemoveLookup(CGUIControl *control)
   { // remove the group's lookup
     const LookupMap &map(lookupControl->GetLookup());
     for (const auto &i : map)
-    { // remove this control
-      for (LookupMap::iterator it = m_lookup.begin(); it != m_lookup.end(); ++it)
-      {
-        if (i.second == it->second)
-        {
-          m_lookup.erase(it);
-          break;
-        }
-      }
-    }
+      EraseLookup(i.first, i.second); // remove this control
   }
   // remove the actual control
   if (control->GetID())
-  {
-    for (LookupMap::iterator it = m_lookup.begin(); it != m_lookup.end(); ++it)
-    {
-      if (control == it->second)
-      {
-        m_lookup.erase(it);
-        break;
-      }
-    }
-  }
+    EraseLookup(control->GetID(), control);
   if (m_parentControl && (lookupControl = dynamic_cast<CGUIControlLookup*>(m_parentControl)))
     lookupControl->RemoveLookup(control);
 }
@@ -111,3 +93,13 @@ void CGUIControlLookup::RemoveLookup()
       lookupControl->RemoveLookup(i.second);
   }
 }
+
+void CGUIControlLookup::EraseLookup(int id, const CGUIControl* control)
+{
+  // only the controls with the same id need to be searched
+  const auto range = m_lookup.equal_range(id);
+  const auto it = std::find_if(range.first, range.second,
+                               [control](const auto& i) { return i.second == control; });
+  if (it != range.second)
+    m_lookup.erase(it);
+}
@@ -43,5 +43,7 @@ protected:
   const LookupMap &GetLookup() const { return m_lookup; }
   void ClearLookup() { m_lookup.clear(); }
 private:
+  void EraseLookup(int id, const CGUIControl* control);
+
   LookupMap m_lookup;
 };
@@ -9,7 +9,10 @@
 #include "GUIFontTTF.h"
 #include "windowing/GraphicContext.h"
 
+#include <iterator>
+#include <list>
 #include <stdint.h>
+#include <unordered_map>
 #include <vector>
 
 using namespace std::chrono_literals;
@@ -24,57 +27,67 @@ class CGUIFontCacheImpl
 {
   struct EntryList
   {
-    using HashMap = std::multimap<size_t, std::unique_ptr<CGUIFontCacheEntry<Position, Value>>>;
-    using HashIter = typename HashMap::iterator;
-    using AgeMap = std::multimap<std::chrono::steady_clock::time_point, HashIter>;
+    struct Node
+    {
+      size_t hash;
+      std::unique_ptr<CGUIFontCacheEntry<Position, Value>> entry;
+    };
+    // the entries, least recently used first. Moving an entry to the back when it is used keeps
+    // the order without a search, which used to go through all entries used in the same frame.
+    using AgeList = std::list<Node>;
+    using NodeIter = typename AgeList::iterator;
+    using HashMap = std::unordered_multimap<size_t, NodeIter>;
 
     ~EntryList() { Flush(); }
 
-    HashIter Insert(size_t hash, std::unique_ptr<CGUIFontCacheEntry<Position, Value>> v)
+    NodeIter Insert(size_t hash, std::unique_ptr<CGUIFontCacheEntry<Position, Value>> v)
     {
-      auto r(hashMap.insert(typename HashMap::value_type(hash, std::move(v))));
-      if (r->second)
-        ageMap.insert(typename AgeMap::value_type(r->second->m_lastUsed, r));
-
-      return r;
+      ageList.push_back({hash, std::move(v)});
+      const auto it = std::prev(ageList.end());
+      hashMap.emplace(hash, it);
+      return it;
+    }
+    std::unique_ptr<CGUIFontCacheEntry<Position, Value>> RemoveOldest()
+    {
+      const auto oldest = ageList.begin();
+      const auto range = hashMap.equal_range(oldest->hash);
+      for (auto it = range.first; it != range.second; ++it)
+      {
+        if (it->second == oldest)
+        {
+          hashMap.erase(it);
+          break;
+        }
+      }
+      auto entry = std::move(oldest->entry);
+      ageList.erase(oldest);
+      return entry;
     }
     void Flush()
     {
-      ageMap.clear();
       hashMap.clear();
+      ageList.clear();
     }
-    typename HashMap::iterator FindKey(CGUIFontCacheKey<Position> key)
+    NodeIter FindKey(const CGUIFontCacheKey<Position>& key, size_t hash)
     {
-      CGUIFontCacheHash<Position> hashGen;
       CGUIFontCacheKeysMatch<Position> keyMatch;
-      auto range = hashMap.equal_range(hashGen(key));
-      for (auto ret = range.first; ret != range.second; ++ret)
+      const auto range = hashMap.equal_range(hash);
+      for (auto it = range.first; it != range.second; ++it)
       {
-        if (keyMatch(ret->second->m_key, key))
-        {
-          return ret;
-        }
+        if (keyMatch(it->second->entry->m_key, key))
+          return it->second;
       }
 
-      return hashMap.end();
+      return ageList.end();
     }
-    void UpdateAge(HashIter it, std::chrono::steady_clock::time_point now)
+    void UpdateAge(NodeIter it, std::chrono::steady_clock::time_point now)
     {
-      auto range = ageMap.equal_range(it->second->m_lastUsed);
-      for (auto ageit = range.first; ageit != range.second; ++ageit)
-      {
-        if (ageit->second == it)
-        {
-          ageMap.erase(ageit);
-          ageMap.insert(typename AgeMap::value_type(now, it));
-          it->second->m_lastUsed = now;
-          return;
-        }
-      }
+      it->entry->m_lastUsed = now;
+      ageList.splice(ageList.end(), ageList, it);
     }
 
+    AgeList ageList;
     HashMap hashMap;
-    AgeMap ageMap;
   };
 
   EntryList m_list;
@@ -163,46 +176,42 @@ Value& CGUIFontCacheImpl<Position, Value>::Lookup(
       alignment, maxPixelWidth, scrolling, context.GetGUIMatrix(), context.GetGUIScaleX(),
       context.GetGUIScaleY());
 
-  auto i = m_list.FindKey(key);
-  if (i == m_list.hashMap.end())
+  const size_t hash = CGUIFontCacheHash<Position>()(key);
+  auto i = m_list.FindKey(key, hash);
+  if (i == m_list.ageList.end())
   {
     // Cache miss
     dirtyCache = true;
     std::unique_ptr<CGUIFontCacheEntry<Position, Value>> entry;
 
-    if (!m_list.ageMap.empty())
+    if (!m_list.ageList.empty())
     {
-      const auto duration =
-          std::chrono::duration_cast<std::chrono::milliseconds>(now - m_list.ageMap.begin()->first);
-      if (duration > FONT_CACHE_TIME_LIMIT)
-      {
-        entry = std::move(m_list.ageMap.begin()->second->second);
-        m_list.hashMap.erase(m_list.ageMap.begin()->second);
-        m_list.ageMap.erase(m_list.ageMap.begin());
-      }
+      const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+          now - m_list.ageList.front().entry->m_lastUsed);
+      if (duration > FONT_CACHE_TIME_LIMIT || m_list.ageList.size() >= FONT_CACHE_MAX_ENTRIES)
+        entry = m_list.RemoveOldest();
     }
 
     // add new entry
-    CGUIFontCacheHash<Position> hashgen;
     if (!entry)
       entry = std::make_unique<CGUIFontCacheEntry<Position, Value>>(*m_parent, key, now);
     else
       entry->Assign(key, now);
-    return m_list.Insert(hashgen(key), std::move(entry))->second->m_value;
+    return m_list.Insert(hash, std::move(entry))->entry->m_value;
   }
   else
   {
     // Cache hit
     // Update the translation arguments so that they hold the offset to apply
     // to the cached values (but only in the dynamic case)
-    pos.UpdateWithOffsets(i->second->m_key.m_pos, scrolling);
+    pos.UpdateWithOffsets(i->entry->m_key.m_pos, scrolling);
 
     // Update time in entry and move to the back of the list
     m_list.UpdateAge(i, now);
 
     dirtyCache = false;
 
-    return i->second->m_value;
+    return i->entry->m_value;
   }
 }
 
@@ -21,11 +21,15 @@
 #include <chrono>
 #include <cstddef>
 #include <cstring>
+#include <functional>
 #include <memory>
 #include <stdint.h>
 #include <vector>
 
 constexpr float FONT_CACHE_DIST_LIMIT = 0.01f;
+// the number of entries after which the least recently used one is replaced, even if it's still
+// in use, to bound the memory of fonts used for large amounts of text
+constexpr size_t FONT_CACHE_MAX_ENTRIES = 4096;
 
 class CGraphicContext;
 
@@ -110,15 +114,33 @@ struct CGUIFontCacheHash
 {
   size_t operator()(const CGUIFontCacheKey<Position>& key) const
   {
-    /* Not much effort has gone into choosing this hash function */
-    size_t hash = 0, i;
-    for (i = 0; i < 3 && i < key.m_text.size(); ++i)
-      hash += key.m_text[i];
-    if (key.m_colors.size())
-      hash += key.m_colors[0];
-    hash += static_cast<size_t>(MatrixHashContribution(key)); // horrible
+    // everything CGUIFontCacheKeysMatch compares exactly goes in, so lists of labels sharing a
+    // prefix don't end up in the same bucket
+    size_t hash = key.m_text.size();
+    for (const character_t ch : key.m_text)
+      Combine(hash, ch);
+    for (const KODI::UTILS::COLOR::Color color : key.m_colors)
+      Combine(hash, color);
+    Combine(hash, key.m_alignment);
+    Combine(hash, key.m_scrolling);
+    Combine(hash, HashFloat(key.m_maxPixelWidth));
+    Combine(hash, HashFloat(key.m_scaleX));
+    Combine(hash, HashFloat(key.m_scaleY));
+    Combine(hash, HashFloat(MatrixHashContribution(key)));
     return hash;
   }
+
+private:
+  static void Combine(size_t& hash, size_t value)
+  {
+    hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  }
+
+  static size_t HashFloat(float value)
+  {
+    // -0.0f and 0.0f compare equal, so they have to hash the same
+    return std::hash<float>{}(value == 0.0f ? 0.0f : value);
+  }
 };
 
 template<class Position>
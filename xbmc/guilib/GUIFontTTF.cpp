@@ -21,6 +21,7 @@
 #include "windowing/GraphicContext.h"
 #include "windowing/WinSystem.h"
 
+#include <map>
 #include <math.h>
 #include <memory>
 #include <queue>
@@ -104,7 +105,7 @@ public:
   FT_Face GetFont(const std::string& filename,
                   float size,
                   float aspect,
-                  std::vector<uint8_t>& memoryBuf)
+                  std::shared_ptr<const std::vector<uint8_t>>& memoryBuf)
   {
     // don't have it yet - create it
     if (!m_library)
@@ -122,7 +123,7 @@ public:
     if (realFile.GetFileName().empty())
       return nullptr;
 
-    memoryBuf.clear();
+    memoryBuf.reset();
 #ifndef TARGET_WINDOWS
     if (!realFile.GetProtocol().empty())
 #endif // ! TARGET_WINDOWS
@@ -130,13 +131,16 @@ public:
       // load file into memory if it is not on local drive
       // in case of win32: always load file into memory as filename is in UTF-8,
       //                   but freetype expect filename in ANSI encoding
-      XFILE::CFile f;
-      if (f.LoadFile(realFile, memoryBuf) <= 0)
+      memoryBuf = LoadFontFile(realFile);
+      if (!memoryBuf)
         return nullptr;
 
-      if (FT_New_Memory_Face(m_library, reinterpret_cast<const FT_Byte*>(memoryBuf.data()),
-                             memoryBuf.size(), 0, &face) != 0)
+      if (FT_New_Memory_Face(m_library, reinterpret_cast<const FT_Byte*>(memoryBuf->data()),
+                             memoryBuf->size(), 0, &face) != 0)
+      {
+        memoryBuf.reset();
         return nullptr;
+      }
     }
 #ifndef TARGET_WINDOWS
     else if (FT_New_Face(m_library, realFile.GetFileName().c_str(), 0, &face))
@@ -185,7 +189,34 @@ public:
   }
 
 private:
+  /*!
+   \brief Load a font file into memory, shared by all the faces loaded from it.
+
+   Skins use the same font file in many sizes, each of which gets a face of its own. The faces
+   only read from the file data, so a single copy of it serves all of them.
+   */
+  std::shared_ptr<const std::vector<uint8_t>> LoadFontFile(const CURL& file)
+  {
+    const std::string key = file.Get();
+    std::shared_ptr<const std::vector<uint8_t>> data = m_fontFiles[key].lock();
+    if (data)
+      return data;
+
+    std::vector<uint8_t> buffer;
+    XFILE::CFile f;
+    if (f.LoadFile(file, buffer) <= 0)
+      return nullptr;
+
+    data = std::make_shared<const std::vector<uint8_t>>(std::move(buffer));
+    m_fontFiles[key] = data;
+
+    // forget the files which are no longer used by any face
+    std::erase_if(m_fontFiles, [](const auto& entry) { return entry.second.expired(); });
+    return data;
+  }
+
   FT_Library m_library{nullptr};
+  std::map<std::string, std::weak_ptr<const std::vector<uint8_t>>> m_fontFiles;
 };
 
 XBMC_GLOBAL_REF(CFreeTypeLibrary, g_freeTypeLibrary); // our freetype library
@@ -256,7 +287,8 @@ void CGUIFontTTF::Clear()
   m_vertexTrans.clear();
   m_vertex.clear();
 
-  m_fontFileInMemory.clear();
+  // only after the face which uses it is gone
+  m_fontFileInMemory.reset();
 }
 
 bool CGUIFontTTF::Load(
@@ -268,7 +268,7 @@ protected:
   float m_textureScaleY{0.0f};
 
   const std::string m_fontIdent;
-  std::vector<uint8_t>
+  std::shared_ptr<const std::vector<uint8_t>>
       m_fontFileInMemory; // used only in some cases, see CFreeTypeLibrary::GetFont()
 
   CGUIFontCache<CGUIFontCacheStaticPosition, CGUIFontCacheStaticValue> m_staticCache;
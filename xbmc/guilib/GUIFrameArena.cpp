@@ -0,0 +1,66 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUIFrameArena.h"
+
+#include <algorithm>
+#include <bit>
+
+CGUIFrameArena::CScope::CScope(CGUIFrameArena& arena) : m_arena(arena)
+{
+  m_arena.m_depth++;
+}
+
+CGUIFrameArena::CScope::~CScope()
+{
+  if (--m_arena.m_depth == 0)
+    m_arena.Release();
+}
+
+CGUIFrameArena::CGUIFrameArena()
+  : m_capacity(INITIAL_SIZE), m_buffer(std::make_unique<std::byte[]>(INITIAL_SIZE))
+{
+  m_resource.emplace(m_buffer.get(), m_capacity, &m_upstream);
+}
+
+void CGUIFrameArena::Release()
+{
+  if (m_upstream.m_allocated == 0)
+  {
+    // everything fit, rewind to the start of the buffer
+    m_resource->release();
+    return;
+  }
+
+  // grow the buffer to what the frame needed
+  const size_t needed = m_capacity + m_upstream.m_allocated;
+  m_resource.reset();
+  m_upstream.m_allocated = 0;
+  if (m_capacity < MAX_SIZE)
+  {
+    m_capacity = std::min(std::bit_ceil(needed), MAX_SIZE);
+    m_buffer = std::make_unique<std::byte[]>(m_capacity);
+  }
+  m_resource.emplace(m_buffer.get(), m_capacity, &m_upstream);
+}
+
+void* CGUIFrameArena::CUpstream::do_allocate(size_t bytes, size_t alignment)
+{
+  m_allocated += bytes;
+  return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+}
+
+void CGUIFrameArena::CUpstream::do_deallocate(void* p, size_t bytes, size_t alignment)
+{
+  std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+}
+
+bool CGUIFrameArena::CUpstream::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+  return this == &other;
+}
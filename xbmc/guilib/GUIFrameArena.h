@@ -0,0 +1,77 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+
+/*!
+ \brief Bump allocator for the transient containers of a GUI frame.
+
+ Containers that only live during Process() or Render() of the window manager, like the sorted
+ dialog lists and the dirty regions to render, allocate from the arena through
+ std::pmr::polymorphic_allocator instead of the heap. Nothing is freed individually, everything
+ is released at once when the outermost CScope ends. The arena starts with a buffer of
+ INITIAL_SIZE bytes; if a frame needs more, the extra comes from the heap and the buffer grows
+ to fit it for the next frames, up to MAX_SIZE.
+
+ Only to be used by the thread rendering the GUI. Containers allocated from the arena must not
+ outlive the scope they were created in.
+ */
+class CGUIFrameArena
+{
+public:
+  //! Keeps the arena in use, the outermost scope releases its memory when it ends
+  class CScope
+  {
+  public:
+    explicit CScope(CGUIFrameArena& arena);
+    ~CScope();
+    CScope(const CScope&) = delete;
+    CScope& operator=(const CScope&) = delete;
+
+  private:
+    CGUIFrameArena& m_arena;
+  };
+
+  CGUIFrameArena();
+  CGUIFrameArena(const CGUIFrameArena&) = delete;
+  CGUIFrameArena& operator=(const CGUIFrameArena&) = delete;
+
+  std::pmr::memory_resource* GetResource() { return &*m_resource; }
+
+  //! size of the buffer the frames allocate from
+  size_t GetCapacity() const { return m_capacity; }
+
+  static constexpr size_t INITIAL_SIZE = 16 * 1024;
+  static constexpr size_t MAX_SIZE = 1024 * 1024;
+
+private:
+  //! heap memory taken by frames that didn't fit the buffer
+  class CUpstream : public std::pmr::memory_resource
+  {
+  public:
+    size_t m_allocated = 0;
+
+  private:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+  };
+
+  void Release();
+
+  size_t m_capacity = 0;
+  unsigned int m_depth = 0;
+  std::unique_ptr<std::byte[]> m_buffer;
+  CUpstream m_upstream;
+  std::optional<std::pmr::monotonic_buffer_resource> m_resource;
+};
@@ -0,0 +1,263 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUIFrameStats.h"
+
+#include "ServiceBroker.h"
+#include "input/WindowTranslator.h"
+#include "rendering/RenderSystem.h"
+#include "utils/StringUtils.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+namespace
+{
+// upper bounds (in ms) of the histogram buckets, the last bucket catches everything above
+constexpr std::array<float, 9> BUCKET_LIMITS = {4.0f,  8.0f,  12.0f, 16.0f, 20.0f,
+                                                25.0f, 33.0f, 50.0f, 100.0f};
+constexpr std::array<const char*, 4> PHASE_NAMES = {"Process", "Render", "Present", "GPU"};
+constexpr float SMOOTHING = 0.05f;
+constexpr size_t MAX_ITEMS_SHOWN = 5;
+constexpr float MIN_ITEM_TIME = 0.001f;
+
+float Smooth(float average, float current)
+{
+  return average + (current - average) * SMOOTHING;
+}
+
+std::string GetWindowName(int windowId)
+{
+  std::string name = CWindowTranslator::TranslateWindow(windowId);
+  if (name.empty())
+    name = std::to_string(windowId);
+  return name;
+}
+} // namespace
+
+CGUIFrameStats& CGUIFrameStats::GetInstance()
+{
+  static CGUIFrameStats instance;
+  return instance;
+}
+
+void CGUIFrameStats::Toggle()
+{
+  const bool enable = !m_enabled;
+  Reset();
+  m_enabled = enable;
+
+  CRenderSystemBase* renderSystem = CServiceBroker::GetRenderSystem();
+  if (renderSystem)
+    renderSystem->SetGPUFrameTiming(enable);
+
+  CLog::Log(LOGINFO, "CGUIFrameStats: frame statistics {}", enable ? "enabled" : "disabled");
+}
+
+void CGUIFrameStats::Reset()
+{
+  m_phases = {};
+  m_windows.clear();
+  m_containers.clear();
+  m_frames = 0;
+}
+
+void CGUIFrameStats::AddPhaseTime(Phase phase, float ms)
+{
+  if (!m_enabled || phase == Phase::COUNT)
+    return;
+
+  PhaseStats& stats = m_phases[static_cast<size_t>(phase)];
+  stats.current += ms;
+  stats.sampled = true;
+}
+
+void CGUIFrameStats::AddWindowTime(int windowId, Phase phase, float ms)
+{
+  if (!m_enabled)
+    return;
+
+  ItemStats& stats = m_windows[windowId];
+  if (phase == Phase::PROCESS)
+    stats.process += ms;
+  else if (phase == Phase::RENDER)
+    stats.render += ms;
+}
+
+void CGUIFrameStats::AddContainerTime(int windowId, int controlId, Phase phase, float ms)
+{
+  if (!m_enabled)
+    return;
+
+  ItemStats& stats = m_containers[{windowId, controlId}];
+  if (phase == Phase::PROCESS)
+    stats.process += ms;
+  else if (phase == Phase::RENDER)
+    stats.render += ms;
+}
+
+void CGUIFrameStats::EndFrame()
+{
+  if (!m_enabled)
+    return;
+
+  CRenderSystemBase* renderSystem = CServiceBroker::GetRenderSystem();
+  float gpuTime;
+  if (renderSystem && renderSystem->GetGPUFrameTime(gpuTime))
+    AddPhaseTime(Phase::GPU, gpuTime);
+
+  for (PhaseStats& stats : m_phases)
+  {
+    if (!stats.sampled)
+      continue;
+
+    stats.average = stats.samples ? Smooth(stats.average, stats.current) : stats.current;
+    stats.max = std::max(stats.max, stats.current);
+
+    const auto bucket =
+        std::ranges::find_if(BUCKET_LIMITS, [&stats](float limit) { return stats.current < limit; });
+    stats.histogram[std::distance(BUCKET_LIMITS.begin(), bucket)]++;
+    stats.samples++;
+
+    stats.current = 0.0f;
+    stats.sampled = false;
+  }
+
+  // windows and containers that weren't touched this frame decay towards zero and
+  // are dropped once they no longer matter
+  const auto foldItems = [](auto& items)
+  {
+    for (auto it = items.begin(); it != items.end();)
+    {
+      ItemStats& stats = it->second;
+      stats.averageProcess = Smooth(stats.averageProcess, stats.process);
+      stats.averageRender = Smooth(stats.averageRender, stats.render);
+      stats.process = 0.0f;
+      stats.render = 0.0f;
+      if (stats.averageProcess + stats.averageRender < MIN_ITEM_TIME)
+        it = items.erase(it);
+      else
+        ++it;
+    }
+  };
+  foldItems(m_windows);
+  foldItems(m_containers);
+
+  m_frames++;
+}
+
+std::string CGUIFrameStats::GetText() const
+{
+  if (!m_enabled)
+    return "";
+
+  std::string text = StringUtils::Format("FRAME STATS: {} frames", m_frames);
+  for (size_t i = 0; i < PHASES; ++i)
+  {
+    const PhaseStats& stats = m_phases[i];
+    if (!stats.samples)
+      continue;
+
+    text += StringUtils::Format("\n{}: avg {:.2f} max {:.2f} ms |", PHASE_NAMES[i], stats.average,
+                                stats.max);
+    for (size_t bucket = 0; bucket < BUCKETS; ++bucket)
+    {
+      if (!stats.histogram[bucket])
+        continue;
+      if (bucket < BUCKET_LIMITS.size())
+        text += StringUtils::Format(" <{:g}:{}", BUCKET_LIMITS[bucket], stats.histogram[bucket]);
+      else
+        text += StringUtils::Format(" >={:g}:{}", BUCKET_LIMITS.back(), stats.histogram[bucket]);
+    }
+  }
+
+  const auto topItems = [](const auto& items)
+  {
+    using Entry = typename std::decay_t<decltype(items)>::const_pointer;
+    std::vector<Entry> sorted;
+    sorted.reserve(items.size());
+    for (const auto& item : items)
+      sorted.emplace_back(&item);
+
+    const size_t count = std::min(sorted.size(), MAX_ITEMS_SHOWN);
+    std::partial_sort(sorted.begin(), sorted.begin() + count, sorted.end(),
+                      [](Entry a, Entry b)
+                      {
+                        return a->second.averageProcess + a->second.averageRender >
+                               b->second.averageProcess + b->second.averageRender;
+                      });
+    sorted.resize(count);
+    return sorted;
+  };
+
+  for (const auto* window : topItems(m_windows))
+    text += StringUtils::Format("\nWindow {}: process {:.2f} render {:.2f} ms",
+                                GetWindowName(window->first), window->second.averageProcess,
+                                window->second.averageRender);
+
+  for (const auto* container : topItems(m_containers))
+    text += StringUtils::Format("\nContainer {} ({}): process {:.2f} render {:.2f} ms",
+                                container->first.second, GetWindowName(container->first.first),
+                                container->second.averageProcess, container->second.averageRender);
+
+  return text;
+}
+
+CGUIFrameStatsTimer::CGUIFrameStatsTimer(CGUIFrameStats::Phase phase)
+  : CGUIFrameStatsTimer(Scope::FRAME, phase, 0, 0)
+{
+}
+
+CGUIFrameStatsTimer::CGUIFrameStatsTimer(CGUIFrameStats::Phase phase, int windowId)
+  : CGUIFrameStatsTimer(Scope::WINDOW, phase, windowId, 0)
+{
+}
+
+CGUIFrameStatsTimer::CGUIFrameStatsTimer(CGUIFrameStats::Phase phase, int windowId, int controlId)
+  : CGUIFrameStatsTimer(Scope::CONTAINER, phase, windowId, controlId)
+{
+}
+
+CGUIFrameStatsTimer::CGUIFrameStatsTimer(Scope scope,
+                                         CGUIFrameStats::Phase phase,
+                                         int windowId,
+                                         int controlId)
+  : m_enabled(CGUIFrameStats::GetInstance().IsEnabled()),
+    m_scope(scope),
+    m_phase(phase),
+    m_windowId(windowId),
+    m_controlId(controlId)
+{
+  if (m_enabled)
+    m_start = std::chrono::steady_clock::now();
+}
+
+CGUIFrameStatsTimer::~CGUIFrameStatsTimer()
+{
+  if (!m_enabled)
+    return;
+
+  const float ms =
+      std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - m_start).count();
+
+  CGUIFrameStats& stats = CGUIFrameStats::GetInstance();
+  switch (m_scope)
+  {
+    case Scope::FRAME:
+      stats.AddPhaseTime(m_phase, ms);
+      break;
+    case Scope::WINDOW:
+      stats.AddWindowTime(m_windowId, m_phase, ms);
+      break;
+    case Scope::CONTAINER:
+      stats.AddContainerTime(m_windowId, m_controlId, m_phase, ms);
+      break;
+  }
+}
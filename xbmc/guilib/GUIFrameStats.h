@@ -0,0 +1,127 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <string>
+#include <utility>
+
+/*!
+ \ingroup guilib
+ \brief Collects per-frame GUI timings for the frame stats overlay.
+
+ Times are recorded for the process, render and present phases of every frame
+ (and the GPU time when the render system supports timer queries), broken down
+ per window and per container. Collection only happens while the overlay is
+ enabled, so the cost when it is off is a single flag check per call site.
+
+ All methods are expected to be called from the application (render) thread.
+ */
+class CGUIFrameStats
+{
+public:
+  enum class Phase
+  {
+    PROCESS = 0,
+    RENDER,
+    PRESENT,
+    GPU,
+    COUNT
+  };
+
+  static CGUIFrameStats& GetInstance();
+
+  void Toggle();
+  bool IsEnabled() const { return m_enabled; }
+
+  void AddPhaseTime(Phase phase, float ms);
+  void AddWindowTime(int windowId, Phase phase, float ms);
+  void AddContainerTime(int windowId, int controlId, Phase phase, float ms);
+
+  /*!
+   \brief Fold the times collected for the current frame into the statistics.
+   */
+  void EndFrame();
+
+  /*!
+   \brief Format the statistics as multi-line text for the debug overlay.
+   */
+  std::string GetText() const;
+
+private:
+  CGUIFrameStats() = default;
+
+  void Reset();
+
+  static constexpr size_t BUCKETS = 10;
+  static constexpr size_t PHASES = static_cast<size_t>(Phase::COUNT);
+
+  struct PhaseStats
+  {
+    float current{0.0f};
+    bool sampled{false};
+    unsigned int samples{0};
+    float average{0.0f};
+    float max{0.0f};
+    std::array<unsigned int, BUCKETS> histogram{};
+  };
+
+  struct ItemStats
+  {
+    float process{0.0f};
+    float render{0.0f};
+    float averageProcess{0.0f};
+    float averageRender{0.0f};
+  };
+
+  std::atomic<bool> m_enabled{false};
+  std::array<PhaseStats, PHASES> m_phases;
+  std::map<int, ItemStats> m_windows;
+  std::map<std::pair<int, int>, ItemStats> m_containers;
+  unsigned int m_frames{0};
+};
+
+/*!
+ \ingroup guilib
+ \brief Scoped timer adding the elapsed time to CGUIFrameStats on destruction.
+
+ Depending on the constructor used the time is recorded for the whole frame,
+ for a window or for a container of a window.
+ */
+class CGUIFrameStatsTimer
+{
+public:
+  explicit CGUIFrameStatsTimer(CGUIFrameStats::Phase phase);
+  CGUIFrameStatsTimer(CGUIFrameStats::Phase phase, int windowId);
+  CGUIFrameStatsTimer(CGUIFrameStats::Phase phase, int windowId, int controlId);
+  ~CGUIFrameStatsTimer();
+
+  CGUIFrameStatsTimer(const CGUIFrameStatsTimer&) = delete;
+  CGUIFrameStatsTimer& operator=(const CGUIFrameStatsTimer&) = delete;
+
+private:
+  enum class Scope
+  {
+    FRAME,
+    WINDOW,
+    CONTAINER
+  };
+
+  CGUIFrameStatsTimer(Scope scope, CGUIFrameStats::Phase phase, int windowId, int controlId);
+
+  bool m_enabled;
+  Scope m_scope;
+  CGUIFrameStats::Phase m_phase;
+  int m_windowId;
+  int m_controlId;
+  std::chrono::steady_clock::time_point m_start;
+};
@@ -12,7 +12,13 @@
 #include "addons/Skin.h"
 #include "guilib/GUIComponent.h"
 #include "guilib/guiinfo/GUIInfoLabel.h"
+#include "filesystem/Directory.h"
+#include "filesystem/File.h"
 #include "interfaces/info/SkinVariable.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
+#include "utils/Archive.h"
+#include "utils/Crc32.h"
 #include "utils/Set.h"
 #include "utils/StringUtils.h"
 #include "utils/XBMCTinyXML.h"
@@ -20,6 +26,7 @@
 #include "utils/log.h"
 
 #include <algorithm>
+#include <stdexcept>
 
 namespace
 {
@@ -55,6 +62,11 @@ constexpr auto CONSTANT_NODES = make_set<std::string_view>({
 
 static constexpr std::string_view EXPRESSION_ATTRIBUTE = "condition";
 
+// bump whenever the layout of the include cache changes
+constexpr unsigned int CACHE_VERSION = 1;
+constexpr unsigned int CACHE_END_MARKER = 0x4b494e43;
+constexpr const char* CACHE_FOLDER = "special://temp/skincache/";
+
 constexpr auto EXPRESSION_NODES = make_set<std::string_view>({
     "enable",
     "selected",
@@ -62,6 +74,110 @@ constexpr auto EXPRESSION_NODES = make_set<std::string_view>({
     "visible",
 });
 
+void WriteElement(CArchive& ar, const TiXmlElement& element)
+{
+  ar << element.ValueStr();
+
+  unsigned int count = 0;
+  for (const TiXmlAttribute* attribute = element.FirstAttribute(); attribute;
+       attribute = attribute->Next())
+    count++;
+  ar << count;
+  for (const TiXmlAttribute* attribute = element.FirstAttribute(); attribute;
+       attribute = attribute->Next())
+  {
+    ar << std::string(attribute->Name());
+    ar << std::string(attribute->Value());
+  }
+
+  // comments and the like are of no use once loaded
+  count = 0;
+  for (const TiXmlNode* child = element.FirstChild(); child; child = child->NextSibling())
+  {
+    if (child->ToElement() || child->ToText())
+      count++;
+  }
+  ar << count;
+  for (const TiXmlNode* child = element.FirstChild(); child; child = child->NextSibling())
+  {
+    if (const TiXmlElement* childElement = child->ToElement())
+    {
+      ar << 'e';
+      WriteElement(ar, *childElement);
+    }
+    else if (const TiXmlText* text = child->ToText())
+    {
+      ar << (text->CDATA() ? 'c' : 't');
+      ar << text->ValueStr();
+    }
+  }
+}
+
+void ReadElement(CArchive& ar, TiXmlElement& element)
+{
+  std::string value;
+  ar >> value;
+  element.SetValue(value);
+
+  unsigned int count;
+  ar >> count;
+  for (unsigned int i = 0; i < count; i++)
+  {
+    std::string name;
+    ar >> name;
+    ar >> value;
+    element.SetAttribute(name, value);
+  }
+
+  ar >> count;
+  for (unsigned int i = 0; i < count; i++)
+  {
+    char type;
+    ar >> type;
+    if (type == 'e')
+    {
+      auto child = new TiXmlElement("");
+      element.LinkEndChild(child);
+      ReadElement(ar, *child);
+    }
+    else if (type == 'c' || type == 't')
+    {
+      ar >> value;
+      auto text = new TiXmlText(value);
+      text->SetCDATA(type == 'c');
+      element.LinkEndChild(text);
+    }
+    else
+      throw std::out_of_range("Unknown node type");
+  }
+}
+
+template<typename Map>
+void WriteStrings(CArchive& ar, const Map& strings)
+{
+  ar << static_cast<unsigned int>(strings.size());
+  for (const auto& [key, value] : strings)
+  {
+    ar << key;
+    ar << value;
+  }
+}
+
+template<typename Map>
+void ReadStrings(CArchive& ar, Map& strings)
+{
+  unsigned int count;
+  ar >> count;
+  for (unsigned int i = 0; i < count; i++)
+  {
+    std::string key;
+    std::string value;
+    ar >> key;
+    ar >> value;
+    strings.try_emplace(std::move(key), std::move(value));
+  }
+}
+
 } // namespace
 
 using namespace KODI::GUILIB;
@@ -77,15 +193,22 @@ void CGUIIncludes::Clear()
   m_constants.clear();
   m_skinvariables.clear();
   m_files.clear();
+  m_dependencies.clear();
+  m_fileConditions.clear();
   m_expressions.clear();
 }
 
 void CGUIIncludes::Load(const std::string &file)
 {
+  if (LoadCache(file))
+    return;
+
   if (!Load_Internal(file))
     return;
   FlattenExpressions();
   FlattenSkinVariableConditions();
+
+  SaveCache(file);
 }
 
 bool CGUIIncludes::Load_Internal(const std::string &file)
@@ -94,6 +217,9 @@ bool CGUIIncludes::Load_Internal(const std::string &file)
   if (HasLoaded(file))
     return true;
 
+  if (std::find(m_dependencies.begin(), m_dependencies.end(), file) == m_dependencies.end())
+    m_dependencies.push_back(file);
+
   CXBMCTinyXML doc;
   if (!doc.LoadFile(file))
   {
@@ -217,8 +343,11 @@ void CGUIIncludes::LoadIncludes(const TiXmlElement *node)
 
       if (condition)
       { // load include file if condition evals to true
-        if (CServiceBroker::GetGUI()->GetInfoManager().Register(condition)->Get(
-                INFO::DEFAULT_CONTEXT))
+        const bool load =
+            CServiceBroker::GetGUI()->GetInfoManager().Register(condition)->Get(
+                INFO::DEFAULT_CONTEXT);
+        m_fileConditions.emplace_back(condition, load);
+        if (load)
           Load_Internal(file);
       }
       else
@@ -285,6 +414,180 @@ bool CGUIIncludes::HasLoaded(const std::string &file) const
   return false;
 }
 
+bool CGUIIncludes::LoadCache(const std::string& file)
+{
+  if (!CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiSkinCache)
+    return false;
+
+  const std::string cachePath = GetCachePath(file);
+  XFILE::CFile cacheFile;
+  if (!cacheFile.Open(cachePath))
+    return false;
+
+  bool loaded = false;
+  try
+  {
+    CArchive ar(&cacheFile, CArchive::load);
+    loaded = ReadCache(ar, file);
+  }
+  catch (const std::out_of_range&)
+  {
+    CLog::Log(LOGERROR, "Corrupt skin include cache: {}", cachePath);
+  }
+
+  if (!loaded)
+  {
+    Clear();
+    return false;
+  }
+
+  CLog::Log(LOGDEBUG, "Loaded skin includes of {} from cache", file);
+  return true;
+}
+
+bool CGUIIncludes::ReadCache(CArchive& ar, const std::string& file)
+{
+  unsigned int version;
+  std::string cachedFile;
+  ar >> version;
+  ar >> cachedFile;
+  if (version != CACHE_VERSION || cachedFile != file)
+    return false;
+
+  // any change to one of the files or to the conditions of the included ones invalidates it
+  unsigned int count;
+  ar >> count;
+  for (unsigned int i = 0; i < count; i++)
+  {
+    std::string dependency;
+    std::string hash;
+    ar >> dependency;
+    ar >> hash;
+    if (hash != GetFileHash(dependency))
+      return false;
+    m_dependencies.emplace_back(std::move(dependency));
+  }
+  ar >> count;
+  for (unsigned int i = 0; i < count; i++)
+  {
+    std::string condition;
+    bool result;
+    ar >> condition;
+    ar >> result;
+    if (CServiceBroker::GetGUI()->GetInfoManager().Register(condition)->Get(
+            INFO::DEFAULT_CONTEXT) != result)
+      return false;
+    m_fileConditions.emplace_back(std::move(condition), result);
+  }
+
+  ar >> m_files;
+  ar >> count;
+  for (unsigned int i = 0; i < count; i++)
+  {
+    std::string key;
+    ar >> key;
+    ReadElement(ar, m_defaults.try_emplace(key, "default").first->second);
+  }
+  ReadStrings(ar, m_constants);
+  ReadStrings(ar, m_expressions);
+  ar >> count;
+  for (unsigned int i = 0; i < count; i++)
+  {
+    std::string key;
+    ar >> key;
+    ReadElement(ar, m_skinvariables.try_emplace(key, "variable").first->second);
+  }
+  ar >> count;
+  for (unsigned int i = 0; i < count; i++)
+  {
+    std::string key;
+    ar >> key;
+    auto& [element, params] =
+        m_includes.try_emplace(key, TiXmlElement("include"), Params()).first->second;
+    ReadElement(ar, element);
+    ReadStrings(ar, params);
+  }
+
+  // a truncated file reads as zeros
+  ar >> count;
+  return count == CACHE_END_MARKER;
+}
+
+void CGUIIncludes::SaveCache(const std::string& file) const
+{
+  if (!CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiSkinCache)
+    return;
+
+  const std::string cachePath = GetCachePath(file);
+  XFILE::CFile cacheFile;
+  XFILE::CDirectory::Create(CACHE_FOLDER);
+  if (!cacheFile.OpenForWrite(cachePath, true))
+  {
+    CLog::Log(LOGDEBUG, "Unable to write skin include cache {}", cachePath);
+    return;
+  }
+
+  CArchive ar(&cacheFile, CArchive::store);
+  ar << CACHE_VERSION;
+  ar << file;
+
+  ar << static_cast<unsigned int>(m_dependencies.size());
+  for (const auto& dependency : m_dependencies)
+  {
+    ar << dependency;
+    ar << GetFileHash(dependency);
+  }
+  ar << static_cast<unsigned int>(m_fileConditions.size());
+  for (const auto& [condition, result] : m_fileConditions)
+  {
+    ar << condition;
+    ar << result;
+  }
+
+  ar << m_files;
+  ar << static_cast<unsigned int>(m_defaults.size());
+  for (const auto& [key, element] : m_defaults)
+  {
+    ar << key;
+    WriteElement(ar, element);
+  }
+  WriteStrings(ar, m_constants);
+  WriteStrings(ar, m_expressions);
+  ar << static_cast<unsigned int>(m_skinvariables.size());
+  for (const auto& [key, element] : m_skinvariables)
+  {
+    ar << key;
+    WriteElement(ar, element);
+  }
+  ar << static_cast<unsigned int>(m_includes.size());
+  for (const auto& [key, include] : m_includes)
+  {
+    ar << key;
+    WriteElement(ar, include.first);
+    WriteStrings(ar, include.second);
+  }
+
+  ar << CACHE_END_MARKER;
+  ar.Close();
+  cacheFile.Close();
+}
+
+std::string CGUIIncludes::GetCachePath(const std::string& file)
+{
+  // not in the archive cache, which is emptied on every start
+  return StringUtils::Format("{}includes-{:08x}.bin", CACHE_FOLDER,
+                             Crc32::ComputeFromLowerCase(file));
+}
+
+std::string CGUIIncludes::GetFileHash(const std::string& file)
+{
+  struct __stat64 st;
+  if (XFILE::CFile::Stat(file, &st) != 0)
+    return "missing";
+
+  return StringUtils::Format("d{}s{}", static_cast<int64_t>(st.st_mtime), st.st_size);
+}
+
 void CGUIIncludes::Resolve(TiXmlElement *node, std::map<INFO::InfoPtr, bool>* xmlIncludeConditions /* = NULL */)
 {
   if (!node)
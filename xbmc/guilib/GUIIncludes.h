@@ -21,6 +21,8 @@
 #include <tinyxml.h>
 
 // forward definitions
+class CArchive;
+
 namespace INFO
 {
   class CSkinVariableString;
@@ -42,6 +44,10 @@ public:
    from the main entrypoint \code{file}. Flattens nested expressions and expressions in variable
    conditions after loading all other included files.
 
+   The result is kept in a binary cache, which is used instead of parsing the files again for as
+   long as none of them changed and the conditions of conditionally included files still evaluate
+   the same.
+
    \param file the file to load
   */
   void Load(const std::string &file);
@@ -83,6 +89,18 @@ private:
 
   bool HasLoaded(const std::string &file) const;
 
+  /*!
+   \brief Load the include components from the cache of the given main file.
+
+   \param file the main include file
+   \return true if the cache is valid and was loaded, false if the files have to be parsed
+  */
+  bool LoadCache(const std::string& file);
+  bool ReadCache(CArchive& ar, const std::string& file);
+  void SaveCache(const std::string& file) const;
+  static std::string GetCachePath(const std::string& file);
+  static std::string GetFileHash(const std::string& file);
+
   void LoadDefaults(const TiXmlElement *node);
   void LoadIncludes(const TiXmlElement *node);
   void LoadVariables(const TiXmlElement *node);
@@ -122,6 +140,8 @@ private:
   std::string ResolveExpressions(const std::string &expression) const;
 
   std::vector<std::string> m_files;
+  std::vector<std::string> m_dependencies; // every file tried to load, including missing ones
+  std::vector<std::pair<std::string, bool>> m_fileConditions; // conditions of included files
 
   struct StringHash
   {
@@ -253,6 +253,8 @@ void CGUIListItem::Archive(CArchive &ar)
 
     int mapSize;
     ar >> mapSize;
+    if (mapSize > 0)
+      m_mapProperties.reserve(m_mapProperties.size() + mapSize);
     for (int i = 0; i < mapSize; i++)
     {
       std::string key;
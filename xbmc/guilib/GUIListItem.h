@@ -14,6 +14,7 @@
 */
 
 #include "utils/Artwork.h"
+#include "utils/SortedNodeMap.h"
 
 #include <cstdint>
 #include <map>
@@ -169,7 +170,8 @@ public:
     bool operator()(const std::string_view& s1, const std::string_view& s2) const;
   };
 
-  using PropertyMap = std::map<std::string, CVariant, CaseInsensitiveCompare>;
+  // items carry a handful of properties each, but there can be tens of thousands of items
+  using PropertyMap = CSortedNodeMap<CVariant, CaseInsensitiveCompare>;
   const PropertyMap& GetProperties() const { return m_mapProperties; }
 
   void SetProperties(const PropertyMap& props);
@@ -8,6 +8,7 @@
 
 #include "GUIMessage.h"
 
+#include "GUIUserMessages.h"
 #include "LocalizeStrings.h"
 
 std::string CGUIMessage::empty_string;
@@ -159,3 +160,25 @@ void CGUIMessage::SetItem(std::shared_ptr<CGUIListItem> item)
 {
   m_item = std::move(item);
 }
+
+bool CGUIMessage::IsRepeatOf(const CGUIMessage& pending) const
+{
+  const int message = m_message == GUI_MSG_NOTIFY_ALL ? GetParam1() : m_message;
+  switch (message)
+  {
+    case GUI_MSG_REFRESH_LIST:
+    case GUI_MSG_REFRESH_THUMBS:
+    case GUI_MSG_REFRESH_TIMER:
+    case GUI_MSG_UPDATE:
+    case GUI_MSG_UPDATE_ITEM:
+      break;
+    default:
+      return false;
+  }
+
+  return m_message == pending.m_message && m_senderID == pending.m_senderID &&
+         m_controlID == pending.m_controlID && m_param1 == pending.m_param1 &&
+         m_param2 == pending.m_param2 && m_item == pending.m_item && !m_pointer &&
+         !pending.m_pointer && m_params.empty() && pending.m_params.empty() &&
+         m_strLabel == pending.m_strLabel;
+}
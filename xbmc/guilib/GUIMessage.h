@@ -405,6 +405,15 @@ public:
   size_t GetNumStringParams() const;
   void SetItem(std::shared_ptr<CGUIListItem> item);
 
+  /*!
+   \brief Check whether this message only repeats a still pending one.
+
+   True for refresh and update messages (sent directly or via GUI_MSG_NOTIFY_ALL) that are equal to
+   the pending message. Receivers read the current state when handling them, so the pending one can
+   be replaced by this one and both are handled once.
+   */
+  bool IsRepeatOf(const CGUIMessage& pending) const;
+
 private:
   std::string m_strLabel;
   std::vector<std::string> m_params;
@@ -190,6 +190,10 @@ void CGUITexture::Render(int32_t depthOffset, int32_t overrideDepth)
 
   color = CServiceBroker::GetWinSystem()->GetGfxContext().MergeColor(color);
 
+  // fully transparent, e.g. while fading in or out
+  if ((color >> 24) == 0)
+    return;
+
   if (overrideDepth >= 0)
   {
     m_depth = CServiceBroker::GetWinSystem()->GetGfxContext().GetNormalizedDepth(overrideDepth +
@@ -220,8 +224,10 @@ void CGUITexture::Render(int32_t depthOffset, int32_t overrideDepth)
       return;
   }
 
-  // setup our renderer
-  Begin(color);
+  // the renderer is set up once the first segment turns out to be visible, so textures which are
+  // clipped away entirely don't cost any state changes or draw calls
+  m_renderColor = color;
+  m_begun = false;
 
   // compute the texture coordinates
   float u1, u2, u3, v1, v2, v3;
@@ -274,7 +280,11 @@ void CGUITexture::Render(int32_t depthOffset, int32_t overrideDepth)
   }
 
   // close off our renderer
-  End();
+  if (m_begun)
+  {
+    End();
+    m_begun = false;
+  }
 
   if (m_vertex.Width() > m_width || m_vertex.Height() > m_height)
     CServiceBroker::GetWinSystem()->GetGfxContext().RestoreClipRegion();
@@ -334,6 +344,11 @@ void CGUITexture::Render(float left,
   if (y[3] == y[1]) y[3] += 1.0f;
   if (x[3] == x[1]) x[3] += 1.0f;
 
+  if (!m_begun)
+  {
+    Begin(m_renderColor);
+    m_begun = true;
+  }
   Draw(x, y, z, texture, diffuse, orientation);
 }
 
@@ -205,6 +205,9 @@ protected:
   CTextureArray m_texture;
 
 private:
+  KODI::UTILS::COLOR::Color m_renderColor{0}; // color to render with, passed to Begin()
+  bool m_begun{false}; // whether Begin() was called for the current Render()
+
   static CreateGUITextureFunc m_createGUITextureFunc;
   static DrawQuadFunc m_drawQuadFunc;
 };
@@ -20,6 +20,7 @@
 #include "application/ApplicationComponents.h"
 #include "application/ApplicationPlayer.h"
 #include "cores/AudioEngine/Interfaces/AE.h"
+#include "cores/AudioEngine/Utils/AERingBuffer.h"
 #include "filesystem/SpecialProtocol.h"
 #include "guilib/guiinfo/GUIInfoLabels.h"
 #include "input/actions/Action.h"
@@ -31,11 +32,14 @@
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
+#include <cstring>
 #include <memory>
 
 namespace
 {
 constexpr unsigned int MAX_AUDIO_BUFFERS = 16;
+// a few hundred milliseconds of audio, more than enough between two frames of the gui
+constexpr unsigned int AUDIO_QUEUE_SIZE = 256 * 1024;
 } // namespace
 
 CAudioBuffer::CAudioBuffer(int iSize)
@@ -71,17 +75,21 @@ void CAudioBuffer::Set(const float* psBuffer, int iSize)
 
 CGUIVisualisationControl::CGUIVisualisationControl(
     int parentID, int controlID, float posX, float posY, float width, float height)
-  : CGUIControl(parentID, controlID, posX, posY, width, height)
+  : CGUIControl(parentID, controlID, posX, posY, width, height),
+    m_audioQueue(std::make_unique<AERingBuffer>(AUDIO_QUEUE_SIZE))
 {
   ControlType = GUICONTROL_VISUALISATION;
 }
 
 CGUIVisualisationControl::CGUIVisualisationControl(const CGUIVisualisationControl& from)
-  : CGUIControl(from)
+  : CGUIControl(from),
+    m_audioQueue(std::make_unique<AERingBuffer>(AUDIO_QUEUE_SIZE))
 {
   ControlType = GUICONTROL_VISUALISATION;
 }
 
+CGUIVisualisationControl::~CGUIVisualisationControl() = default;
+
 std::string CGUIVisualisationControl::Name() const
 {
   if (m_instance == nullptr)
@@ -187,6 +195,8 @@ void CGUIVisualisationControl::Process(unsigned int currentTime, CDirtyRegionLis
       m_updateTrack = false;
     }
 
+    ProcessAudio(m_instance && m_alreadyStarted);
+
     if (m_instance && m_instance->IsDirty())
       MarkDirtyRegion();
   }
@@ -248,22 +258,49 @@ void CGUIVisualisationControl::OnInitialize(int channels, int samplesPerSec, int
 
 void CGUIVisualisationControl::OnAudioData(const float* audioData, unsigned int audioDataLength)
 {
-  if (!m_instance || !m_alreadyStarted || !audioData || audioDataLength == 0)
+  // This runs on the audio thread, which must never wait for the add-on. The data is only queued
+  // here and handed to the add-on from Process().
+  if (!audioData || audioDataLength == 0)
     return;
 
-  // Save our audio data in the buffers
-  std::unique_ptr<CAudioBuffer> pBuffer(new CAudioBuffer(audioDataLength));
-  pBuffer->Set(audioData, audioDataLength);
-  m_vecBuffers.emplace_back(std::move(pBuffer));
+  const uint32_t length = audioDataLength;
+  const size_t size = sizeof(length) + length * sizeof(float);
+  if (m_audioQueue->GetWriteSize() < size)
+    return; // the gui isn't keeping up, drop the data
 
-  if (m_vecBuffers.size() < m_numBuffers)
-    return;
+  m_packet.resize(size);
+  std::memcpy(m_packet.data(), &length, sizeof(length));
+  std::memcpy(m_packet.data() + sizeof(length), audioData, length * sizeof(float));
+  m_audioQueue->Write(m_packet.data(), static_cast<unsigned int>(size));
+}
 
-  std::unique_ptr<CAudioBuffer> ptrAudioBuffer = std::move(m_vecBuffers.front());
-  m_vecBuffers.pop_front();
+void CGUIVisualisationControl::ProcessAudio(bool deliver)
+{
+  uint32_t length;
+  while (m_audioQueue->GetReadSize() >= sizeof(length))
+  {
+    m_audioQueue->Read(reinterpret_cast<unsigned char*>(&length), sizeof(length));
+    m_audioData.resize(length);
+    m_audioQueue->Read(reinterpret_cast<unsigned char*>(m_audioData.data()),
+                       length * sizeof(float));
 
-  // Transfer data to our visualisation
-  m_instance->AudioData(ptrAudioBuffer->Get(), ptrAudioBuffer->Size());
+    if (!deliver)
+      continue;
+
+    // Save our audio data in the buffers
+    std::unique_ptr<CAudioBuffer> pBuffer(new CAudioBuffer(length));
+    pBuffer->Set(m_audioData.data(), length);
+    m_vecBuffers.emplace_back(std::move(pBuffer));
+
+    if (m_vecBuffers.size() < m_numBuffers)
+      continue;
+
+    std::unique_ptr<CAudioBuffer> ptrAudioBuffer = std::move(m_vecBuffers.front());
+    m_vecBuffers.pop_front();
+
+    // Transfer data to our visualisation
+    m_instance->AudioData(ptrAudioBuffer->Get(), ptrAudioBuffer->Size());
+  }
 }
 
 void CGUIVisualisationControl::UpdateTrack()
@@ -451,4 +488,5 @@ void CGUIVisualisationControl::ClearBuffers()
 {
   m_numBuffers = 0;
   m_vecBuffers.clear();
+  ProcessAudio(false);
 }
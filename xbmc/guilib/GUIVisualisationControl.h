@@ -12,9 +12,13 @@
 #include "cores/AudioEngine/Interfaces/IAudioCallback.h"
 
 #include <list>
+#include <memory>
+#include <stdint.h>
 #include <string>
 #include <vector>
 
+class AERingBuffer;
+
 namespace KODI
 {
 namespace ADDONS
@@ -46,6 +50,7 @@ public:
   CGUIVisualisationControl(
       int parentID, int controlID, float posX, float posY, float width, float height);
   CGUIVisualisationControl(const CGUIVisualisationControl& from);
+  ~CGUIVisualisationControl() override;
   CGUIVisualisationControl* Clone() const override
   {
     return new CGUIVisualisationControl(*this);
@@ -79,6 +84,7 @@ private:
   void DeInitVisualization();
   inline void CreateBuffers();
   inline void ClearBuffers();
+  void ProcessAudio(bool deliver);
 
   bool m_callStart{false};
   bool m_alreadyStarted{false};
@@ -86,11 +92,15 @@ private:
   bool m_updateTrack{false};
 
   std::list<std::unique_ptr<CAudioBuffer>> m_vecBuffers;
+  // audio data from the audio thread, every packet is its length followed by the samples
+  std::unique_ptr<AERingBuffer> m_audioQueue;
+  std::vector<uint8_t> m_packet; /*!< used by the audio thread only */
+  std::vector<float> m_audioData;
   unsigned int m_numBuffers; /*!< Number of Audio buffers */
   std::vector<std::string> m_presets; /*!< cached preset list */
 
   /* values set from "OnInitialize" IAudioCallback  */
-  int m_channels;
+  int m_channels{0};
   int m_samplesPerSec;
   int m_bitsPerSample;
 
@@ -10,6 +10,7 @@
 
 #include "GUIAudioManager.h"
 #include "GUIDialog.h"
+#include "GUIFrameStats.h"
 #include "GUIInfoManager.h"
 #include "GUIPassword.h"
 #include "GUITexture.h"
@@ -44,6 +45,7 @@
 #include "settings/windows/GUIWindowSettingsScreenCalibration.h"
 #include "threads/SingleLock.h"
 #include "utils/StringUtils.h"
+#include "utils/Trace.h"
 #include "utils/URIUtils.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
@@ -66,6 +68,7 @@
 #include "windows/GUIWindowStartup.h"
 #include "windows/GUIWindowSystemInfo.h"
 
+#include <algorithm>
 #include <mutex>
 
 // Dialog includes
@@ -1213,8 +1216,11 @@ bool RenderOrderSortFunction(CGUIWindow *first, CGUIWindow *second)
 
 void CGUIWindowManager::Process(unsigned int currentTime)
 {
+  CTraceZone zone("CGUIWindowManager::Process");
+  CGUIFrameStatsTimer frameStats(CGUIFrameStats::Phase::PROCESS);
   assert(CServiceBroker::GetAppMessenger()->IsProcessThread());
   std::unique_lock lock(CServiceBroker::GetWinSystem()->GetGfxContext());
+  CGUIFrameArena::CScope frame(m_frameArena);
 
   m_dirtyregions.clear();
 
@@ -1234,7 +1240,8 @@ void CGUIWindowManager::Process(unsigned int currentTime)
   if (pWindow)
     pWindow->AssignDepth();
 
-  std::vector<CGUIWindow*> activeDialogs = m_activeDialogs;
+  std::pmr::vector<CGUIWindow*> activeDialogs(m_activeDialogs.begin(), m_activeDialogs.end(),
+                                               m_frameArena.GetResource());
   stable_sort(activeDialogs.begin(), activeDialogs.end(), RenderOrderSortFunction);
 
   for (const auto& window : activeDialogs)
@@ -1277,6 +1284,7 @@ void CGUIWindowManager::RenderPass() const
 
 void CGUIWindowManager::RenderPassSingle() const
 {
+  CGUIFrameArena::CScope frame(m_frameArena);
   CGUIWindow* pWindow = GetWindow(GetActiveWindow());
   if (pWindow)
   {
@@ -1285,7 +1293,8 @@ void CGUIWindowManager::RenderPassSingle() const
   }
 
   // we render the dialogs based on their render order.
-  auto renderList = m_activeDialogs;
+  std::pmr::vector<CGUIWindow*> renderList(m_activeDialogs.begin(), m_activeDialogs.end(),
+                                           m_frameArena.GetResource());
   stable_sort(renderList.begin(), renderList.end(), RenderOrderSortFunction);
 
   for (const auto& window : renderList)
@@ -1297,11 +1306,13 @@ void CGUIWindowManager::RenderPassSingle() const
 
 void CGUIWindowManager::RenderPassDual() const
 {
+  CGUIFrameArena::CScope frame(m_frameArena);
   CGUIWindow* pWindow = GetWindow(GetActiveWindow());
   if (pWindow)
     pWindow->ClearBackground();
 
-  std::vector<CGUIWindow*> renderList = m_activeDialogs;
+  std::pmr::vector<CGUIWindow*> renderList(m_activeDialogs.begin(), m_activeDialogs.end(),
+                                           m_frameArena.GetResource());
   stable_sort(renderList.begin(), renderList.end(), RenderOrderSortFunction);
 
   // first the opaque pass, rendering from front to back
@@ -1349,8 +1360,11 @@ void CGUIWindowManager::RenderEx() const
 
 bool CGUIWindowManager::Render()
 {
+  CTraceZone zone("CGUIWindowManager::Render");
+  CGUIFrameStatsTimer frameStats(CGUIFrameStats::Phase::RENDER);
   assert(CServiceBroker::GetAppMessenger()->IsProcessThread());
   CSingleExit lock(CServiceBroker::GetWinSystem()->GetGfxContext());
+  CGUIFrameArena::CScope frame(m_frameArena);
 
   int bufferAge = CServiceBroker::GetWinSystem()->GetBufferAge();
   bool visualizeDirtyRegions =
@@ -1362,19 +1376,20 @@ bool CGUIWindowManager::Render()
   else
     m_tracker.CleanMarkedRegions(10);
 
-  CDirtyRegionList dirtyRegions = m_tracker.GetDirtyRegions();
+  CDirtyRegionList dirtyRegions(m_frameArena.GetResource());
+  m_tracker.GetDirtyRegions(dirtyRegions);
 
   bool hasRendered = false;
+  const int algorithm = m_tracker.GetAlgorithm();
   // If we visualize the regions we will always render the entire viewport
   // If the buffer age is zero, the current content is undefined and has to be rendered
   if (visualizeDirtyRegions || bufferAge == 0 ||
-      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiAlgorithmDirtyRegions ==
-          DIRTYREGION_SOLVER_FILL_VIEWPORT_ALWAYS)
+      algorithm == DIRTYREGION_SOLVER_FILL_VIEWPORT_ALWAYS)
   {
     RenderPass();
     hasRendered = true;
   }
-  else if (CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiAlgorithmDirtyRegions == DIRTYREGION_SOLVER_FILL_VIEWPORT_ON_CHANGE)
+  else if (algorithm == DIRTYREGION_SOLVER_FILL_VIEWPORT_ON_CHANGE)
   {
     if (!dirtyRegions.empty())
     {
@@ -1414,13 +1429,15 @@ bool CGUIWindowManager::Render()
 
 void CGUIWindowManager::AfterRender()
 {
+  CGUIFrameArena::CScope frame(m_frameArena);
   CServiceBroker::GetWinSystem()->GetGfxContext().ResetDepth();
   CGUIWindow* pWindow = GetWindow(GetActiveWindow());
   if (pWindow)
     pWindow->AfterRender();
 
   // make copy of vector as we may remove items from it as we go
-  auto activeDialogs = m_activeDialogs;
+  std::pmr::vector<CGUIWindow*> activeDialogs(m_activeDialogs.begin(), m_activeDialogs.end(),
+                                               m_frameArena.GetResource());
   for (const auto& window : activeDialogs)
   {
     if (window->IsDialogRunning())
@@ -1607,6 +1624,17 @@ void CGUIWindowManager::SendThreadMessage(const CGUIMessage& message, int window
 {
   std::unique_lock lock(m_critSection);
 
+  // a refresh that's still pending is replaced, so it's handled once and after the messages
+  // queued since
+  const auto isRepeat = [&message, window](const auto& pending)
+  { return pending.second == window && message.IsRepeatOf(*pending.first); };
+  const auto pending = std::ranges::find_if(m_vecThreadMessages, isRepeat);
+  if (pending != m_vecThreadMessages.end())
+  {
+    delete pending->first;
+    m_vecThreadMessages.erase(pending);
+  }
+
   CGUIMessage* msg = new CGUIMessage(message);
   m_vecThreadMessages.emplace_back(msg, window);
 }
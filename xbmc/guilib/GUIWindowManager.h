@@ -9,6 +9,7 @@
 #pragma once
 
 #include "DirtyRegionTracker.h"
+#include "GUIFrameArena.h"
 #include "GUIWindow.h"
 #include "IMsgTargetCallback.h"
 #include "IWindowManagerCallback.h"
@@ -289,4 +290,5 @@ private:
 
   CDirtyRegionList m_dirtyregions;
   CDirtyRegionTracker m_tracker;
+  mutable CGUIFrameArena m_frameArena;
 };
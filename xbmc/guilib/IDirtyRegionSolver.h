@@ -10,6 +10,8 @@
 
 #include "DirtyRegion.h"
 
+// only redraw the dirty regions if the window system knows the age of the back buffer
+#define DIRTYREGION_SOLVER_AUTO -1
 #define DIRTYREGION_SOLVER_FILL_VIEWPORT_ALWAYS 0
 #define DIRTYREGION_SOLVER_UNION 1
 #define DIRTYREGION_SOLVER_COST_REDUCTION 2
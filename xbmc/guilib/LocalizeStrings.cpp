@@ -8,19 +8,178 @@
 
 #include "LocalizeStrings.h"
 
+#include "FileItem.h"
+#include "FileItemList.h"
+#include "XBDateTime.h"
 #include "addons/LanguageResource.h"
 #include "filesystem/Directory.h"
+#include "filesystem/File.h"
 #include "filesystem/SpecialProtocol.h"
 #include "threads/SharedSection.h"
+#include "utils/Archive.h"
 #include "utils/CharsetConverter.h"
+#include "utils/Digest.h"
 #include "utils/POUtils.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <mutex>
 #include <shared_mutex>
 
+using KODI::UTILITY::CDigest;
+using StringTable = CLocalizeStrings::StringTable;
+
+// Bump when the format of the cache files changes
+#define STRINGS_CACHE_VERSION 1
+
+namespace
+{
+// parsed strings.po files, so they don't have to be parsed again on every start
+constexpr const char* CACHE_PATH = "special://temp/strings/";
+// every language, skin and add-on has its own file, the ones not written for long are removed
+constexpr int MAX_CACHE_FILES = 1000;
+constexpr int MAX_CACHE_AGE_DAYS = 90;
+
+std::atomic<bool> s_cachePruned{false};
+
+bool CompareId(const std::pair<uint32_t, std::string>& entry, uint32_t id)
+{
+  return entry.first < id;
+}
+
+bool CompareEntries(const std::pair<uint32_t, std::string>& a,
+                    const std::pair<uint32_t, std::string>& b)
+{
+  return a.first < b.first;
+}
+
+void SetString(StringTable& strings, uint32_t id, std::string str)
+{
+  auto it = std::lower_bound(strings.begin(), strings.end(), id, CompareId);
+  if (it != strings.end() && it->first == id)
+    it->second = std::move(str);
+  else
+    strings.emplace(it, id, std::move(str));
+}
+
+std::string GetCacheFile(const std::vector<std::string>& files)
+{
+  return CACHE_PATH +
+         CDigest::Calculate(CDigest::Type::MD5, StringUtils::Join(files, "|")) + ".strings";
+}
+
+/*! \brief Load the strings parsed from the given strings.po files from the cache, as long as none
+ of them changed since.
+ */
+bool LoadCache(const std::vector<std::string>& files, StringTable& strings)
+{
+  const std::string cacheFile = GetCacheFile(files);
+  XFILE::CFile file;
+  if (!XFILE::CFile::Exists(cacheFile) || !file.Open(cacheFile))
+    return false;
+
+  try
+  {
+    CArchive ar(&file, CArchive::load);
+    int version;
+    size_t count;
+    ar >> version;
+    if (version != STRINGS_CACHE_VERSION)
+      return false;
+
+    ar >> count;
+    if (count != files.size())
+      return false;
+    for (const std::string& source : files)
+    {
+      std::string path;
+      int64_t size;
+      int64_t time;
+      ar >> path >> size >> time;
+
+      struct __stat64 stat = {};
+      if (path != source || XFILE::CFile::Stat(source, &stat) != 0 || stat.st_size != size ||
+          stat.st_mtime != time)
+        return false;
+    }
+
+    ar >> count;
+    strings.clear();
+    // every entry takes more than a byte, don't trust a corrupt count
+    strings.reserve(std::min(count, static_cast<size_t>(file.GetLength())));
+    for (size_t i = 0; i < count; ++i)
+    {
+      uint32_t id;
+      std::string str;
+      ar >> id >> str;
+      strings.emplace_back(id, std::move(str));
+    }
+  }
+  catch (const std::exception&)
+  {
+    CLog::Log(LOGERROR, "LocalizeStrings: corrupt cache file {}", cacheFile);
+    strings.clear();
+    return false;
+  }
+
+  CLog::Log(LOGDEBUG, "LocalizeStrings: loaded {} strings of {} from cache", strings.size(),
+            files.front());
+  return true;
+}
+
+void PruneCache()
+{
+  CFileItemList items;
+  if (!XFILE::CDirectory::GetDirectory(CACHE_PATH, items, ".strings",
+                                       XFILE::DIR_FLAG_NO_FILE_DIRS | XFILE::DIR_FLAG_BYPASS_CACHE))
+    return;
+
+  const CDateTime oldest =
+      CDateTime::GetCurrentDateTime() - CDateTimeSpan(MAX_CACHE_AGE_DAYS, 0, 0, 0);
+  items.Sort(SortByDate, SortOrderDescending);
+  for (int i = 0; i < items.Size(); ++i)
+  {
+    if (i >= MAX_CACHE_FILES || items[i]->GetDateTime() < oldest)
+      XFILE::CFile::Delete(items[i]->GetPath());
+  }
+}
+
+void SaveCache(const std::vector<std::string>& files, const StringTable& strings)
+{
+  if (!XFILE::CDirectory::Exists(CACHE_PATH) && !XFILE::CDirectory::Create(CACHE_PATH))
+    return;
+
+  if (!s_cachePruned.exchange(true))
+    PruneCache();
+
+  const std::string cacheFile = GetCacheFile(files);
+  XFILE::CFile file;
+  if (!file.OpenForWrite(cacheFile, true))
+  {
+    CLog::Log(LOGWARNING, "LocalizeStrings: unable to write {}", cacheFile);
+    return;
+  }
+
+  CArchive ar(&file, CArchive::store);
+  ar << STRINGS_CACHE_VERSION;
+  ar << files.size();
+  for (const std::string& source : files)
+  {
+    struct __stat64 stat = {};
+    XFILE::CFile::Stat(source, &stat);
+    ar << source << static_cast<int64_t>(stat.st_size) << static_cast<int64_t>(stat.st_mtime);
+  }
+  ar << strings.size();
+  for (const auto& [id, str] : strings)
+    ar << id << str;
+  ar.Close();
+}
+} // namespace
+
 /*! \brief Tries to load ids and strings from a strings.po file to the `strings` map.
  * It should only be called from the LoadStr2Mem function to have a fallback.
  \param pathname The directory name, where we look for the strings file.
@@ -87,16 +246,12 @@ static bool LoadPO(const std::string &filename, std::map<uint32_t, LocStr>& stri
   return true;
 }
 
-/*! \brief Loads language ids and strings to memory map `strings`.
- \param pathname The directory name, where we look for the strings file.
- \param language We load the strings for this language. Fallback language is always English.
- \param strings [out] The resulting strings map.
- \param encoding Encoding of the strings. For PO files we only use utf-8.
- \param offset An offset value to place strings from the id value.
- \return false if no strings.po file was loaded.
+/*! \brief Gets the strings file of a language.
+ \param pathname The directory name, where we look for the language folder.
+ \param language The language to get the strings file of.
+ \return the path of the strings.po file, empty if there's no folder for the language.
  */
-static bool LoadStr2Mem(const std::string &pathname_in, const std::string &language,
-    std::map<uint32_t, LocStr>& strings,  std::string &encoding, uint32_t offset = 0 )
+static std::string GetStringsFile(const std::string& pathname_in, const std::string& language)
 {
   std::string pathname = CSpecialProtocol::TranslatePathConvertCase(pathname_in + language);
   if (!XFILE::CDirectory::Exists(pathname))
@@ -111,27 +266,64 @@ static bool LoadStr2Mem(const std::string &pathname_in, const std::string &langu
     }
 
     if (!exists)
-      return false;
+      return "";
   }
 
-  bool useSourceLang = StringUtils::EqualsNoCase(language, LANGUAGE_DEFAULT) || StringUtils::EqualsNoCase(language, LANGUAGE_OLD_DEFAULT);
+  return URIUtils::AddFileToFolder(pathname, "strings.po");
+}
 
-  return LoadPO(URIUtils::AddFileToFolder(pathname, "strings.po"), strings, encoding, offset, useSourceLang);
+static bool IsSourceLanguage(const std::string& language)
+{
+  return StringUtils::EqualsNoCase(language, LANGUAGE_DEFAULT) ||
+         StringUtils::EqualsNoCase(language, LANGUAGE_OLD_DEFAULT);
 }
 
-static bool LoadWithFallback(const std::string& path, const std::string& language, std::map<uint32_t, LocStr>& strings)
+/*! \brief Loads the strings of a language, with English as fallback for missing strings.
+ \param path The directory name, where we look for the language folders.
+ \param language We load the strings for this language.
+ \param strings [out] The resulting strings, sorted by id.
+ \return false if the English strings were requested and couldn't be loaded.
+ */
+static bool LoadWithFallback(const std::string& path,
+                             const std::string& language,
+                             StringTable& strings)
 {
-  std::string encoding;
-  if (!LoadStr2Mem(path, language, strings, encoding))
+  const bool isDefault = StringUtils::EqualsNoCase(language, LANGUAGE_DEFAULT);
+  const std::string file = GetStringsFile(path, language);
+  if (file.empty() && isDefault) // no fallback, nothing to do
+    return false;
+
+  std::vector<std::string> files;
+  if (!file.empty())
+    files.emplace_back(file);
+  if (!isDefault)
   {
-    if (StringUtils::EqualsNoCase(language, LANGUAGE_DEFAULT)) // no fallback, nothing to do
-      return false;
+    const std::string fallback = GetStringsFile(path, LANGUAGE_DEFAULT);
+    if (!fallback.empty())
+      files.emplace_back(fallback);
   }
+  if (files.empty())
+    return true;
+
+  if (LoadCache(files, strings))
+    return true;
+
+  std::map<uint32_t, LocStr> parsed;
+  std::string encoding;
+  if (!file.empty() && !LoadPO(file, parsed, encoding, 0, IsSourceLanguage(language)) && isDefault)
+    return false;
 
   // load the fallback
-  if (!StringUtils::EqualsNoCase(language, LANGUAGE_DEFAULT))
-    LoadStr2Mem(path, LANGUAGE_DEFAULT, strings, encoding);
+  if (!isDefault && files.back() != file)
+    LoadPO(files.back(), parsed, encoding, 0, true);
 
+  // the original strings are only needed while merging in the fallback
+  strings.clear();
+  strings.reserve(parsed.size());
+  for (auto& [id, str] : parsed)
+    strings.emplace_back(id, std::move(str.strTranslated));
+
+  SaveCache(files, strings);
   return true;
 }
 
@@ -148,42 +340,52 @@ void CLocalizeStrings::ClearSkinStrings()
 
 bool CLocalizeStrings::LoadSkinStrings(const std::string& path, const std::string& language)
 {
-  //! @todo shouldn't hold lock while loading file
+  StringTable strings;
+  const bool loaded = LoadWithFallback(path, language, strings);
+
   std::unique_lock<CSharedSection> lock(m_stringsMutex);
   ClearSkinStrings();
-  // load the skin strings in.
-  return LoadWithFallback(path, language, m_strings);
+  // load the skin strings in, they don't replace any of ours
+  const size_t count = m_strings.size();
+  for (auto& entry : strings)
+  {
+    if (!std::binary_search(m_strings.begin(), m_strings.begin() + count, entry, CompareEntries))
+      m_strings.emplace_back(std::move(entry));
+  }
+  std::inplace_merge(m_strings.begin(), m_strings.begin() + count, m_strings.end(),
+                     CompareEntries);
+  return loaded;
 }
 
 bool CLocalizeStrings::Load(const std::string& strPathName, const std::string& strLanguage)
 {
-  std::map<uint32_t, LocStr> strings;
+  StringTable strings;
   if (!LoadWithFallback(strPathName, strLanguage, strings))
     return false;
 
   // fill in the constant strings
-  strings[20022].strTranslated = "";
-  strings[20027].strTranslated = "°F";
-  strings[20028].strTranslated = "K";
-  strings[20029].strTranslated = "°C";
-  strings[20030].strTranslated = "°Ré";
-  strings[20031].strTranslated = "°Ra";
-  strings[20032].strTranslated = "°Rø";
-  strings[20033].strTranslated = "°De";
-  strings[20034].strTranslated = "°N";
-
-  strings[20200].strTranslated = "km/h";
-  strings[20201].strTranslated = "m/min";
-  strings[20202].strTranslated = "m/s";
-  strings[20203].strTranslated = "ft/h";
-  strings[20204].strTranslated = "ft/min";
-  strings[20205].strTranslated = "ft/s";
-  strings[20206].strTranslated = "mph";
-  strings[20207].strTranslated = "kts";
-  strings[20208].strTranslated = "Beaufort";
-  strings[20209].strTranslated = "inch/s";
-  strings[20210].strTranslated = "yard/s";
-  strings[20211].strTranslated = "Furlong/Fortnight";
+  SetString(strings, 20022, "");
+  SetString(strings, 20027, "°F");
+  SetString(strings, 20028, "K");
+  SetString(strings, 20029, "°C");
+  SetString(strings, 20030, "°Ré");
+  SetString(strings, 20031, "°Ra");
+  SetString(strings, 20032, "°Rø");
+  SetString(strings, 20033, "°De");
+  SetString(strings, 20034, "°N");
+
+  SetString(strings, 20200, "km/h");
+  SetString(strings, 20201, "m/min");
+  SetString(strings, 20202, "m/s");
+  SetString(strings, 20203, "ft/h");
+  SetString(strings, 20204, "ft/min");
+  SetString(strings, 20205, "ft/s");
+  SetString(strings, 20206, "mph");
+  SetString(strings, 20207, "kts");
+  SetString(strings, 20208, "Beaufort");
+  SetString(strings, 20209, "inch/s");
+  SetString(strings, 20210, "yard/s");
+  SetString(strings, 20211, "Furlong/Fortnight");
 
   std::unique_lock<CSharedSection> lock(m_stringsMutex);
   Clear();
@@ -194,12 +396,12 @@ bool CLocalizeStrings::Load(const std::string& strPathName, const std::string& s
 const std::string& CLocalizeStrings::Get(uint32_t dwCode) const
 {
   std::shared_lock<CSharedSection> lock(m_stringsMutex);
-  ciStrings i = m_strings.find(dwCode);
-  if (i == m_strings.end())
+  auto i = std::lower_bound(m_strings.begin(), m_strings.end(), dwCode, CompareId);
+  if (i == m_strings.end() || i->first != dwCode)
   {
     return StringUtils::Empty;
   }
-  return i->second.strTranslated;
+  return i->second;
 }
 
 void CLocalizeStrings::Clear()
@@ -211,19 +413,14 @@ void CLocalizeStrings::Clear()
 void CLocalizeStrings::Clear(uint32_t start, uint32_t end)
 {
   std::unique_lock<CSharedSection> lock(m_stringsMutex);
-  iStrings it = m_strings.begin();
-  while (it != m_strings.end())
-  {
-    if (it->first >= start && it->first <= end)
-      m_strings.erase(it++);
-    else
-      ++it;
-  }
+  std::erase_if(m_strings,
+                [start, end](const auto& entry)
+                { return entry.first >= start && entry.first <= end; });
 }
 
 bool CLocalizeStrings::LoadAddonStrings(const std::string& path, const std::string& language, const std::string& addonId)
 {
-  std::map<uint32_t, LocStr> strings;
+  StringTable strings;
   if (!LoadWithFallback(path, language, strings))
     return false;
 
@@ -242,9 +439,9 @@ std::string CLocalizeStrings::GetAddonString(const std::string& addonId, uint32_
   if (i == m_addonStrings.end())
     return StringUtils::Empty;
 
-  auto j = i->second.find(code);
-  if (j == i->second.end())
+  auto j = std::lower_bound(i->second.begin(), i->second.end(), code, CompareId);
+  if (j == i->second.end() || j->first != code)
     return StringUtils::Empty;
 
-  return j->second.strTranslated;
+  return j->second;
 }
@@ -19,6 +19,8 @@
 #include <map>
 #include <stdint.h>
 #include <string>
+#include <utility>
+#include <vector>
 
 /*!
  \ingroup strings
@@ -51,13 +53,17 @@ public:
   // implementation of ILocalizer
   std::string Localize(std::uint32_t code) const override { return Get(code); }
 
+  /*!
+   \brief The translated strings sorted by id, looked up by binary search. A flat table takes a
+   fraction of the memory of a map, which adds up with the strings of all add-ons.
+   */
+  using StringTable = std::vector<std::pair<uint32_t, std::string>>;
+
 protected:
   void Clear(uint32_t start, uint32_t end);
 
-  std::map<uint32_t, LocStr> m_strings;
-  std::map<std::string, std::map<uint32_t, LocStr>> m_addonStrings;
-  typedef std::map<uint32_t, LocStr>::const_iterator ciStrings;
-  typedef std::map<uint32_t, LocStr>::iterator       iStrings;
+  StringTable m_strings;
+  std::map<std::string, StringTable> m_addonStrings;
 
   mutable CSharedSection m_stringsMutex;
   CSharedSection m_addonStringsMutex;
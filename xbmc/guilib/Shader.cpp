@@ -10,6 +10,7 @@
 
 #include "ServiceBroker.h"
 #include "filesystem/File.h"
+#include "rendering/GLProgramCache.h"
 #include "rendering/RenderSystem.h"
 #include "utils/GLUtils.h"
 #include "utils/StringUtils.h"
@@ -287,27 +288,33 @@ bool CGLSLShaderProgram::CompileAndLink()
   // free resources
   Free();
 
+  const std::string cacheKey =
+      CGLProgramCache::MakeKey({m_pVP->GetSource(), m_pFP->GetSource()});
+
+  // create program object
+  if (!(m_shaderProgram = glCreateProgram()))
+  {
+    CLog::Log(LOGERROR, "GL: Error creating shader program handle");
+    goto error;
+  }
+
+  // a program binary from a previous run saves compiling the shaders
+  if (CGLProgramCache::LoadProgram(m_shaderProgram, cacheKey))
+    goto linked;
+
   // compiled vertex shader
   if (!m_pVP->Compile())
   {
     CLog::Log(LOGERROR, "GL: Error compiling vertex shader: {}", m_pVP->GetName());
     CLog::Log(LOGDEBUG, "GL: vertex shader source:\n{}", m_pVP->GetSourceWithLineNumbers());
-    return false;
+    goto error;
   }
 
   // compile pixel shader
   if (!m_pFP->Compile())
   {
-    m_pVP->Free();
     CLog::Log(LOGERROR, "GL: Error compiling fragment shader: {}", m_pFP->GetName());
     CLog::Log(LOGDEBUG, "GL: fragment shader source:\n{}", m_pFP->GetSourceWithLineNumbers());
-    return false;
-  }
-
-  // create program object
-  if (!(m_shaderProgram = glCreateProgram()))
-  {
-    CLog::Log(LOGERROR, "GL: Error creating shader program handle");
     goto error;
   }
 
@@ -324,6 +331,7 @@ bool CGLSLShaderProgram::CompileAndLink()
   }
 
   // link the program
+  CGLProgramCache::PrepareProgram(m_shaderProgram);
   glLinkProgram(m_shaderProgram);
   glGetProgramiv(m_shaderProgram, GL_LINK_STATUS, params);
   if (params[0]!=GL_TRUE)
@@ -336,6 +344,9 @@ bool CGLSLShaderProgram::CompileAndLink()
   }
   VerifyGLState();
 
+  CGLProgramCache::SaveProgram(m_shaderProgram, cacheKey);
+
+ linked:
   m_validated = false;
   m_ok = true;
   OnCompiledAndLinked();
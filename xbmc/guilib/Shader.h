@@ -27,6 +27,7 @@ namespace Shaders {
     virtual void Free() = 0;
     virtual GLuint Handle() = 0;
     virtual void SetSource(const std::string& src) { m_source = src; }
+    const std::string& GetSource() const { return m_source; }
     virtual bool LoadSource(const std::string& filename, const std::string& prefix = "");
     virtual bool AppendSource(const std::string& filename);
     virtual bool InsertSource(const std::string& filename, const std::string& loc);
@@ -153,12 +153,25 @@ bool CTexture::LoadFromFileInternal(const std::string& texturePath,
   if (URIUtils::HasExtension(texturePath, ".dds"))
   { // special case for DDS images
     CDDSImage image;
-    if (image.ReadFile(texturePath))
+    if (!image.ReadFile(texturePath))
+      return false;
+
+    // compressed data is handed to the GPU as is, see CTextureCacheJob::CacheCompressed()
+    switch (image.GetFormat())
     {
-      Update(image.GetWidth(), image.GetHeight(), 0, image.GetFormat(), image.GetData(), false);
-      return true;
+      case XB_FMT_DXT1:
+        return UploadFromMemory(image.GetWidth(), image.GetHeight(), 0, image.GetData(),
+                                KD_TEX_FMT_S3TC_RGB8, KD_TEX_ALPHA_OPAQUE, KD_TEX_SWIZ_RGBA);
+      case XB_FMT_DXT3:
+        return UploadFromMemory(image.GetWidth(), image.GetHeight(), 0, image.GetData(),
+                                KD_TEX_FMT_S3TC_RGB8_A4, KD_TEX_ALPHA_STRAIGHT, KD_TEX_SWIZ_RGBA);
+      case XB_FMT_DXT5:
+        return UploadFromMemory(image.GetWidth(), image.GetHeight(), 0, image.GetData(),
+                                KD_TEX_FMT_S3TC_RGBA8, KD_TEX_ALPHA_STRAIGHT, KD_TEX_SWIZ_RGBA);
+      default:
+        Update(image.GetWidth(), image.GetHeight(), 0, image.GetFormat(), image.GetData(), false);
+        return true;
     }
-    return false;
   }
 
   // Read image into memory to use our vfs
@@ -249,7 +262,17 @@ bool CTexture::LoadIImage(IImage* pImage,
     return false;
 
   unsigned int maxTextureSize = CServiceBroker::GetRenderSystem()->GetMaxTextureSize();
-  if (!pImage->LoadImageFromMemory(buffer, bufSize, maxTextureSize, maxTextureSize))
+
+  // let the loader know how big the texture is going to be so it can skip decoding detail that
+  // would be scaled away anyway; centered images are shown at their own size
+  unsigned int loadWidth = maxTextureSize;
+  unsigned int loadHeight = maxTextureSize;
+  if (idealWidth && idealHeight && aspectRatio != CAspectRatio::CENTER)
+  {
+    loadWidth = std::min(idealWidth, maxTextureSize);
+    loadHeight = std::min(idealHeight, maxTextureSize);
+  }
+  if (!pImage->LoadImageFromMemory(buffer, bufSize, loadWidth, loadHeight))
     return false;
 
   if (pImage->Width() == 0 || pImage->Height() == 0)
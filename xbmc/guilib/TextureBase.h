@@ -50,6 +50,9 @@ public:
   /*! \brief returns true if a shadow copy is kept on the CPU side. */
   bool GetCacheMemory() const { return m_bCacheMemory; }
 
+  /*! \brief returns true once the texture is on the GPU, or failed to get there. */
+  bool IsLoadedToGPU() const { return m_loadedToGPU; }
+
   /*! \brief returns a pointer to the staging texture. */
   uint8_t* GetPixels() const { return m_pixels; }
 
@@ -211,14 +211,18 @@ std::optional<CTextureBundleXBT::Animation> CTextureBundleXBT::LoadAnim(const st
 std::unique_ptr<CTexture> CTextureBundleXBT::ConvertFrameToTexture(const std::string& name,
                                                                    const CXBTFFrame& frame)
 {
-  // found texture - allocate the necessary buffers
-  std::vector<unsigned char> buffer(static_cast<size_t>(frame.GetPackedSize()));
-
-  // load the compressed texture
-  if (!m_XBTFReader->Load(frame, buffer.data()))
+  // use the frame straight from the mapped bundle if possible, otherwise read it
+  std::vector<unsigned char> buffer;
+  const unsigned char* packed = m_XBTFReader->GetFrameData(frame);
+  if (packed == nullptr)
   {
-    CLog::Log(LOGERROR, "Error loading texture: {}", name);
-    return {};
+    buffer.resize(static_cast<size_t>(frame.GetPackedSize()));
+    if (!m_XBTFReader->Load(frame, buffer.data()))
+    {
+      CLog::Log(LOGERROR, "Error loading texture: {}", name);
+      return {};
+    }
+    packed = buffer.data();
   }
 
   // check if it's packed with lzo
@@ -226,8 +230,8 @@ std::unique_ptr<CTexture> CTextureBundleXBT::ConvertFrameToTexture(const std::st
   { // unpack
     std::vector<unsigned char> unpacked(static_cast<size_t>(frame.GetUnpackedSize()));
     lzo_uint s = (lzo_uint)frame.GetUnpackedSize();
-    if (lzo1x_decompress_safe(buffer.data(), static_cast<lzo_uint>(buffer.size()), unpacked.data(),
-                              &s, NULL) != LZO_E_OK ||
+    if (lzo1x_decompress_safe(packed, static_cast<lzo_uint>(frame.GetPackedSize()),
+                              unpacked.data(), &s, NULL) != LZO_E_OK ||
         s != frame.GetUnpackedSize())
     {
       CLog::Log(LOGERROR, "Error loading texture: {}: Decompression error", name);
@@ -235,19 +239,26 @@ std::unique_ptr<CTexture> CTextureBundleXBT::ConvertFrameToTexture(const std::st
     }
     buffer = std::move(unpacked);
   }
+  else if (buffer.empty())
+  {
+    // the upload may convert the pixels in place, e.g. swap blue and red on GLES, and the
+    // mapping is read only and shared by all textures of the bundle
+    buffer.assign(packed, packed + frame.GetPackedSize());
+  }
+  unsigned char* pixels = buffer.data();
 
   // create an xbmc texture
   std::unique_ptr<CTexture> texture = CTexture::CreateTexture();
 
   if (frame.GetKDFormatType())
   {
-    texture->UploadFromMemory(frame.GetWidth(), frame.GetHeight(), 0, buffer.data(),
+    texture->UploadFromMemory(frame.GetWidth(), frame.GetHeight(), 0, pixels,
                               frame.GetKDFormat(), frame.GetKDAlpha(), frame.GetKDSwizzle());
   }
   else if (frame.GetFormat() == XB_FMT_A8R8G8B8)
   {
     KD_TEX_ALPHA alpha = frame.HasAlpha() ? KD_TEX_ALPHA_STRAIGHT : KD_TEX_ALPHA_OPAQUE;
-    texture->UploadFromMemory(frame.GetWidth(), frame.GetHeight(), 0, buffer.data(),
+    texture->UploadFromMemory(frame.GetWidth(), frame.GetHeight(), 0, pixels,
                               KD_TEX_FMT_SDR_BGRA8, alpha, KD_TEX_SWIZ_RGBA);
   }
   return texture;
@@ -272,17 +283,28 @@ std::string CTextureBundleXBT::Normalize(std::string name)
 std::optional<std::vector<uint8_t>> CTextureBundleXBT::UnpackFrame(const CXBTFReader& reader,
                                                                    const CXBTFFrame& frame)
 {
-  // load the compressed texture
-  std::vector<uint8_t> packedBuffer(static_cast<size_t>(frame.GetPackedSize()));
-  if (!reader.Load(frame, packedBuffer.data()))
+  // load the compressed texture, unless it can be taken from the mapped bundle
+  const size_t packedSize = static_cast<size_t>(frame.GetPackedSize());
+  std::vector<uint8_t> packedBuffer;
+  const uint8_t* packed = reader.GetFrameData(frame);
+  if (packed == nullptr)
   {
-    CLog::Log(LOGERROR, "CTextureBundleXBT: error loading frame");
-    return std::nullopt;
+    packedBuffer.resize(packedSize);
+    if (!reader.Load(frame, packedBuffer.data()))
+    {
+      CLog::Log(LOGERROR, "CTextureBundleXBT: error loading frame");
+      return std::nullopt;
+    }
+    packed = packedBuffer.data();
   }
 
   // if the frame isn't packed there's nothing else to be done
   if (!frame.IsPacked())
+  {
+    if (packedBuffer.empty())
+      packedBuffer.assign(packed, packed + packedSize);
     return packedBuffer;
+  }
 
   // make sure lzo is initialized
   if (lzo_init() != LZO_E_OK)
@@ -293,8 +315,8 @@ std::optional<std::vector<uint8_t>> CTextureBundleXBT::UnpackFrame(const CXBTFRe
 
   lzo_uint size = static_cast<lzo_uint>(frame.GetUnpackedSize());
   std::vector<uint8_t> unpackedBuffer(static_cast<size_t>(frame.GetUnpackedSize()));
-  if (lzo1x_decompress_safe(packedBuffer.data(), static_cast<lzo_uint>(packedBuffer.size()),
-                            unpackedBuffer.data(), &size, nullptr) != LZO_E_OK ||
+  if (lzo1x_decompress_safe(packed, static_cast<lzo_uint>(packedSize), unpackedBuffer.data(), &size,
+                            nullptr) != LZO_E_OK ||
       size != frame.GetUnpackedSize())
   {
     CLog::Log(LOGERROR,
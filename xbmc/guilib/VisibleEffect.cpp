@@ -622,21 +622,21 @@ bool CAnimation::CheckCondition()
   return !m_condition || m_condition->Get(INFO::DEFAULT_CONTEXT);
 }
 
-void CAnimation::UpdateCondition(const CGUIListItem *item)
+bool CAnimation::UpdateCondition(const CGUIListItem *item)
 {
   if (!m_condition)
-    return;
+    return false;
   bool condition = m_condition->Get(INFO::DEFAULT_CONTEXT, item);
-  if (condition && !m_lastCondition)
+  if (condition == m_lastCondition)
+    return false;
+  if (condition)
     QueueAnimation(ANIM_PROCESS_NORMAL);
-  else if (!condition && m_lastCondition)
-  {
-    if (m_reversible)
-      QueueAnimation(ANIM_PROCESS_REVERSE);
-    else
-      ResetAnimation();
-  }
+  else if (m_reversible)
+    QueueAnimation(ANIM_PROCESS_REVERSE);
+  else
+    ResetAnimation();
   m_lastCondition = condition;
+  return true;
 }
 
 void CAnimation::SetInitialCondition()
@@ -179,7 +179,8 @@ public:
   inline ANIMATION_PROCESS GetQueuedProcess() const { return m_queuedProcess; }
 
   bool CheckCondition();
-  void UpdateCondition(const CGUIListItem *item = NULL);
+  // returns true if the condition changed and the animation was queued or reset
+  bool UpdateCondition(const CGUIListItem *item = NULL);
   void SetInitialCondition();
 
 private:
@@ -14,6 +14,13 @@
 #include "XBTFReader.h"
 #include "guilib/XBTF.h"
 #include "utils/EndianSwap.h"
+#include "utils/log.h"
+
+#include <system_error>
+
+#if defined(TARGET_POSIX)
+#include "platform/posix/utils/Mmap.h"
+#endif
 
 #ifdef TARGET_WINDOWS
 #include "filesystem/SpecialProtocol.h"
@@ -174,6 +181,26 @@ bool CXBTFReader::Open(const std::string& path)
   if (pos != GetHeaderSize())
     return false;
 
+#if defined(TARGET_POSIX)
+  // map the whole bundle so frames are paged in on demand instead of being read
+  // through the (shared) file position
+  struct stat fileStat;
+  if (fstat(fileno(m_file), &fileStat) == 0 && fileStat.st_size > 0)
+  {
+    try
+    {
+      m_map = std::make_unique<KODI::UTILS::POSIX::CMmap>(
+          nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE,
+          fileno(m_file), 0);
+    }
+    catch (const std::system_error& e)
+    {
+      CLog::Log(LOGDEBUG, "CXBTFReader: unable to map {}, falling back to reads: {}", m_path,
+                e.what());
+    }
+  }
+#endif
+
   return true;
 }
 
@@ -184,6 +211,10 @@ bool CXBTFReader::IsOpen() const
 
 void CXBTFReader::Close()
 {
+#if defined(TARGET_POSIX)
+  m_map.reset();
+#endif
+
   if (m_file != nullptr)
   {
     fclose(m_file);
@@ -206,11 +237,30 @@ time_t CXBTFReader::GetLastModificationTimestamp() const
   return fileStat.st_mtime;
 }
 
+const uint8_t* CXBTFReader::GetFrameData(const CXBTFFrame& frame) const
+{
+#if defined(TARGET_POSIX)
+  if (m_map == nullptr || frame.GetOffset() > m_map->Size() ||
+      frame.GetPackedSize() > m_map->Size() - frame.GetOffset())
+    return nullptr;
+
+  return static_cast<const uint8_t*>(m_map->Data()) + frame.GetOffset();
+#else
+  return nullptr;
+#endif
+}
+
 bool CXBTFReader::Load(const CXBTFFrame& frame, unsigned char* buffer) const
 {
   if (m_file == nullptr)
     return false;
 
+  if (const uint8_t* data = GetFrameData(frame))
+  {
+    memcpy(buffer, data, static_cast<size_t>(frame.GetPackedSize()));
+    return true;
+  }
+
 #if defined(TARGET_DARWIN) || defined(TARGET_FREEBSD)
   if (fseeko(m_file, static_cast<off_t>(frame.GetOffset()), SEEK_SET) == -1)
 #elif defined(TARGET_ANDROID)
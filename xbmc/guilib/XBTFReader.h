@@ -15,6 +15,13 @@
 #include <string>
 #include <vector>
 
+#if defined(TARGET_POSIX)
+namespace KODI::UTILS::POSIX
+{
+class CMmap;
+}
+#endif
+
 class CXBTFReader : public CXBTFBase
 {
 public:
@@ -29,9 +36,20 @@ public:
 
   bool Load(const CXBTFFrame& frame, unsigned char* buffer) const;
 
+  /*!
+   \brief Get the packed data of a frame straight from the mapped bundle.
+   \return pointer to GetPackedSize() bytes, valid until the reader is closed, or nullptr
+   if the bundle couldn't be mapped (use Load() then). The mapping is read only, copy the
+   data to modify it.
+   */
+  const uint8_t* GetFrameData(const CXBTFFrame& frame) const;
+
 private:
   std::string m_path;
   FILE* m_file = nullptr;
+#if defined(TARGET_POSIX)
+  std::unique_ptr<KODI::UTILS::POSIX::CMmap> m_map;
+#endif
 };
 
 typedef std::shared_ptr<CXBTFReader> CXBTFReaderPtr;
@@ -29,6 +29,7 @@ public:
   ~CGUIInfoBool();
 
   operator bool() const { return m_value; }
+  bool IsConstant() const { return !m_info; }
 
   void Update(int contextWindow, const CGUIListItem* item = nullptr);
   void Parse(const std::string& expression, int context);
@@ -0,0 +1,154 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "guilib/DDSImage.h"
+
+#include <cmath>
+#include <stdint.h>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+void DecodeColor(uint16_t value, int (&color)[3])
+{
+  color[0] = ((value >> 11) & 0x1f) * 255 / 31;
+  color[1] = ((value >> 5) & 0x3f) * 255 / 63;
+  color[2] = (value & 0x1f) * 255 / 31;
+}
+
+// decode a DXT1 image back to RGB
+std::vector<int> Decode(const CDDSImage& image)
+{
+  const unsigned int width = image.GetWidth();
+  const unsigned int height = image.GetHeight();
+  std::vector<int> rgb(width * height * 3);
+
+  const unsigned char* block = image.GetData();
+  for (unsigned int by = 0; by < height; by += 4)
+  {
+    for (unsigned int bx = 0; bx < width; bx += 4, block += 8)
+    {
+      const uint16_t color0 = block[0] | block[1] << 8;
+      const uint16_t color1 = block[2] | block[3] << 8;
+      const uint32_t indices = block[4] | block[5] << 8 | block[6] << 16 | block[7] << 24;
+      EXPECT_TRUE(color0 > color1 || indices == 0);
+
+      int palette[4][3];
+      DecodeColor(color0, palette[0]);
+      DecodeColor(color1, palette[1]);
+      for (int c = 0; c < 3; c++)
+      {
+        palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+        palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+      }
+
+      for (unsigned int i = 0; i < 16; i++)
+      {
+        const unsigned int x = bx + i % 4;
+        const unsigned int y = by + i / 4;
+        if (x >= width || y >= height)
+          continue;
+        for (int c = 0; c < 3; c++)
+          rgb[(y * width + x) * 3 + c] = palette[(indices >> (2 * i)) & 3][c];
+      }
+    }
+  }
+  return rgb;
+}
+
+// an image in XB_FMT_A8R8G8B8 with some padding at the end of each row
+struct Image
+{
+  Image(unsigned int width, unsigned int height)
+    : width(width), height(height), pitch(width * 4 + 8), pixels(pitch * height)
+  {
+  }
+
+  void Set(unsigned int x, unsigned int y, int r, int g, int b)
+  {
+    unsigned char* bgra = &pixels[y * pitch + x * 4];
+    bgra[0] = static_cast<unsigned char>(b);
+    bgra[1] = static_cast<unsigned char>(g);
+    bgra[2] = static_cast<unsigned char>(r);
+    bgra[3] = 0xff;
+  }
+
+  int Get(unsigned int x, unsigned int y, int c) const { return pixels[y * pitch + x * 4 + 2 - c]; }
+
+  unsigned int width;
+  unsigned int height;
+  unsigned int pitch;
+  std::vector<unsigned char> pixels;
+};
+
+double PSNR(const Image& original, const CDDSImage& compressed)
+{
+  const std::vector<int> decoded = Decode(compressed);
+  double error = 0.0;
+  for (unsigned int y = 0; y < original.height; y++)
+  {
+    for (unsigned int x = 0; x < original.width; x++)
+    {
+      for (int c = 0; c < 3; c++)
+      {
+        const int diff = decoded[(y * original.width + x) * 3 + c] - original.Get(x, y, c);
+        error += diff * diff;
+      }
+    }
+  }
+  error /= original.width * original.height * 3;
+  return error == 0.0 ? 100.0 : 10.0 * std::log10(255.0 * 255.0 / error);
+}
+} // namespace
+
+TEST(TestDDSImage, CompressSolid)
+{
+  Image image(8, 4);
+  for (unsigned int y = 0; y < image.height; y++)
+    for (unsigned int x = 0; x < image.width; x++)
+      image.Set(x, y, 255, 0, 0);
+
+  CDDSImage dds;
+  dds.Compress(image.width, image.height, image.pitch, image.pixels.data());
+  EXPECT_EQ(XB_FMT_DXT1, dds.GetFormat());
+  EXPECT_EQ(8u, dds.GetWidth());
+  EXPECT_EQ(4u, dds.GetHeight());
+  EXPECT_EQ(16u, dds.GetSize());
+  // pure red is exact in RGB565
+  EXPECT_EQ(100.0, PSNR(image, dds));
+}
+
+TEST(TestDDSImage, CompressGradient)
+{
+  // sizes which aren't a multiple of the block size
+  Image image(37, 22);
+  for (unsigned int y = 0; y < image.height; y++)
+    for (unsigned int x = 0; x < image.width; x++)
+      image.Set(x, y, x * 255 / image.width, y * 255 / image.height, 128);
+
+  CDDSImage dds;
+  dds.Compress(image.width, image.height, image.pitch, image.pixels.data());
+  EXPECT_EQ(10u * 6u * 8u, dds.GetSize());
+  // colours changing in two directions within a block don't lie on a line, what DXT1 needs
+  EXPECT_GT(PSNR(image, dds), 32.0);
+}
+
+TEST(TestDDSImage, CompressTwoColors)
+{
+  // blocks of two colours at most are reproduced up to the RGB565 precision
+  Image image(16, 16);
+  for (unsigned int y = 0; y < image.height; y++)
+    for (unsigned int x = 0; x < image.width; x++)
+      image.Set(x, y, (x + y) % 2 ? 240 : 16, (x + y) % 2 ? 200 : 64, (x + y) % 2 ? 8 : 248);
+
+  CDDSImage dds;
+  dds.Compress(image.width, image.height, image.pitch, image.pixels.data());
+  EXPECT_GT(PSNR(image, dds), 40.0);
+}
@@ -0,0 +1,65 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "guilib/GUIFrameArena.h"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST(TestGUIFrameArena, ReusesBuffer)
+{
+  CGUIFrameArena arena;
+
+  void* first;
+  {
+    CGUIFrameArena::CScope frame(arena);
+    std::pmr::vector<int> values(100, 0, arena.GetResource());
+    first = values.data();
+  }
+  {
+    CGUIFrameArena::CScope frame(arena);
+    std::pmr::vector<int> values(100, 0, arena.GetResource());
+    // the second frame starts again at the beginning of the buffer
+    EXPECT_EQ(first, values.data());
+  }
+  EXPECT_EQ(CGUIFrameArena::INITIAL_SIZE, arena.GetCapacity());
+}
+
+TEST(TestGUIFrameArena, NestedScopes)
+{
+  CGUIFrameArena arena;
+
+  CGUIFrameArena::CScope outer(arena);
+  std::pmr::vector<int> outerValues(100, 1, arena.GetResource());
+  {
+    CGUIFrameArena::CScope inner(arena);
+    std::pmr::vector<int> innerValues(100, 2, arena.GetResource());
+  }
+  // the inner scope doesn't release what the outer one still uses
+  std::pmr::vector<int> values(100, 3, arena.GetResource());
+  EXPECT_EQ(std::vector<int>(100, 1), std::vector<int>(outerValues.begin(), outerValues.end()));
+}
+
+TEST(TestGUIFrameArena, Grows)
+{
+  CGUIFrameArena arena;
+  {
+    CGUIFrameArena::CScope frame(arena);
+    std::pmr::vector<char> values(CGUIFrameArena::INITIAL_SIZE * 3, 0, arena.GetResource());
+  }
+  EXPECT_GT(arena.GetCapacity(), CGUIFrameArena::INITIAL_SIZE * 3);
+  EXPECT_LE(arena.GetCapacity(), CGUIFrameArena::MAX_SIZE);
+
+  const size_t capacity = arena.GetCapacity();
+  {
+    CGUIFrameArena::CScope frame(arena);
+    std::pmr::vector<char> values(CGUIFrameArena::INITIAL_SIZE * 3, 0, arena.GetResource());
+  }
+  EXPECT_EQ(capacity, arena.GetCapacity());
+}
@@ -16,6 +16,8 @@
 #include "utils/log.h"
 #include "video/VideoDatabase.h"
 
+#include <unordered_set>
+
 namespace IMAGE_FILES
 {
 std::optional<IMAGE_FILES::CImageCacheCleaner> CImageCacheCleaner::Create()
@@ -70,11 +72,12 @@ CImageCacheCleaner::~CImageCacheCleaner()
     m_textureDB->Close();
 }
 
-CleanerResult CImageCacheCleaner::ScanOldestCache(unsigned int imageLimit)
+CleanerResult CImageCacheCleaner::ScanOldestCache(unsigned int imageLimit,
+                                                  unsigned int imagesPerRun /* = 0 */)
 {
   CLog::LogF(LOGDEBUG, "begin process to clean image cache");
 
-  auto images = m_textureDB->GetOldestCachedImages(imageLimit);
+  auto images = m_textureDB->GetOldestCachedImages(imageLimit, imagesPerRun);
   if (images.empty())
   {
     CLog::LogF(LOGDEBUG, "found no old cached images to process");
@@ -93,12 +96,8 @@ CleanerResult CImageCacheCleaner::ScanOldestCache(unsigned int imageLimit)
   usedImages.insert(usedImages.end(), std::make_move_iterator(nextUsedImages.begin()),
                     std::make_move_iterator(nextUsedImages.end()));
 
-  images.erase(std::remove_if(images.begin(), images.end(),
-                              [&usedImages](const std::string& image) {
-                                return std::find(usedImages.cbegin(), usedImages.cend(), image) !=
-                                       usedImages.cend();
-                              }),
-               images.end());
+  const std::unordered_set<std::string> used(usedImages.begin(), usedImages.end());
+  std::erase_if(images, [&used](const std::string& image) { return used.contains(image); });
 
   m_textureDB->SetKeepCachedImages(usedImages);
 
@@ -108,4 +107,9 @@ CleanerResult CImageCacheCleaner::ScanOldestCache(unsigned int imageLimit)
 
   return CleanerResult{processedCount, keptCount, std::move(images)};
 }
+
+unsigned int CImageCacheCleaner::CountOldestCache(unsigned int imagesPerRun)
+{
+  return m_textureDB->CountOldestCachedImages(imagesPerRun);
+}
 } // namespace IMAGE_FILES
@@ -44,7 +44,19 @@ public:
   CImageCacheCleaner(CImageCacheCleaner&&) = default;
   CImageCacheCleaner& operator=(CImageCacheCleaner&&) = default;
 
-  CleanerResult ScanOldestCache(unsigned int imageLimit);
+  /*!
+   * @brief Check a batch of the oldest cached images against the libraries.
+   * @param imageLimit the number of images to check
+   * @param imagesPerRun the number of images checked per cleaning run, sets how often images are
+   * re-checked, defaults to imageLimit. Images found in use are marked as checked, so a following
+   * call continues with the next batch.
+   */
+  CleanerResult ScanOldestCache(unsigned int imageLimit, unsigned int imagesPerRun = 0);
+
+  /*!
+   * @brief Count the cached images ScanOldestCache() would go through.
+   */
+  unsigned int CountOldestCache(unsigned int imagesPerRun);
 
 private:
   CImageCacheCleaner();
@@ -469,6 +469,9 @@ constexpr const int ACTION_DIALOG_SELECT_AUDIO = 271;
 //! Open the dialog window to select a subtitle stream
 constexpr const int ACTION_DIALOG_SELECT_SUBTITLE = 272;
 
+//! Toggle the frame time statistics overlay
+constexpr const int ACTION_TOGGLE_FRAME_STATS = 273;
+
 // Voice actions
 constexpr const int ACTION_VOICE_RECOGNIZE = 300;
 
@@ -203,6 +203,7 @@ constexpr auto ActionMappings = make_map<ActionName, ActionID>({
     {"settingsreset", ACTION_SETTINGS_RESET},
     {"settingslevelchange", ACTION_SETTINGS_LEVEL_CHANGE},
     {"togglefont", ACTION_TOGGLE_FONT},
+    {"toggleframestats", ACTION_TOGGLE_FRAME_STATS},
     {"videonextstream", ACTION_VIDEO_NEXT_STREAM},
 
     // 3D movie playback/GUI
@@ -20,13 +20,18 @@
 #include "video/VideoDatabase.h"
 #include "video/VideoFileItemClassify.h"
 
+#include <algorithm>
+#include <chrono>
+#include <deque>
 #include <memory>
 #include <mutex>
+#include <typeinfo>
 
 #define LOOKUP_PROPERTY "database-lookup"
 
 using namespace ANNOUNCEMENT;
 using namespace KODI;
+using namespace std::chrono_literals;
 
 const std::string CAnnouncementManager::ANNOUNCEMENT_SENDER = "xbmc";
 
@@ -217,8 +222,148 @@ CVariant CreateDataObjectFromItem(CFileItem& item, const CVariant& data)
   return object;
 }
 
+// announcements queued for an announcer running behind
+constexpr size_t MAX_QUEUED_ANNOUNCEMENTS = 256;
+// announcers taking longer than this to handle an announcement are considered slow
+constexpr auto SLOW_ANNOUNCER_DURATION = 100ms;
+// how often a slow announcer is reported at most
+constexpr auto SLOW_ANNOUNCER_REPORT_INTERVAL = 10s;
+
+std::chrono::milliseconds CallAnnouncer(IAnnouncer* announcer,
+                                        AnnouncementFlag flag,
+                                        const std::string& sender,
+                                        const std::string& message,
+                                        const CVariant& data)
+{
+  const auto start = std::chrono::steady_clock::now();
+  announcer->Announce(flag, sender, message, data);
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() -
+                                                               start);
+}
+
 } // unnamed namespace
 
+class CAnnouncementManager::CAnnouncerQueue : public CThread
+{
+public:
+  CAnnouncerQueue(IAnnouncer* announcer, AnnouncerQueue queue)
+    : CThread("AnnounceQueue"), m_announcer(announcer), m_queue(queue)
+  {
+  }
+
+  void Push(AnnouncementFlag flag,
+            const std::string& sender,
+            const std::string& message,
+            const CVariant& data)
+  {
+    {
+      std::unique_lock lock(m_critSection);
+      if (m_queue == AnnouncerQueue::COALESCE)
+      {
+        auto it = std::find_if(m_announcements.begin(), m_announcements.end(),
+                               [&](const CQueuedAnnouncement& announcement) {
+                                 return announcement.flag == flag &&
+                                        announcement.message == message &&
+                                        announcement.sender == sender && announcement.data == data;
+                               });
+        if (it != m_announcements.end())
+        {
+          m_announcements.erase(it);
+          m_coalesced++;
+        }
+      }
+
+      if (m_announcements.size() >= MAX_QUEUED_ANNOUNCEMENTS)
+      {
+        m_announcements.pop_front();
+        m_dropped++;
+      }
+
+      m_announcements.push_back({flag, sender, message, data});
+    }
+    m_queueEvent.Set();
+  }
+
+  void Stop(bool wait)
+  {
+    m_bStop = true;
+    m_queueEvent.Set();
+    StopThread(wait);
+  }
+
+protected:
+  void Process() override
+  {
+    SetPriority(ThreadPriority::LOWEST);
+
+    while (!m_bStop)
+    {
+      std::unique_lock lock(m_critSection);
+      if (m_announcements.empty())
+      {
+        CSingleExit ex(m_critSection);
+        m_queueEvent.Wait();
+        continue;
+      }
+
+      const CQueuedAnnouncement announcement = std::move(m_announcements.front());
+      m_announcements.pop_front();
+
+      std::chrono::milliseconds duration;
+      {
+        CSingleExit ex(m_critSection);
+        duration = CallAnnouncer(m_announcer, announcement.flag, announcement.sender,
+                                 announcement.message, announcement.data);
+      }
+
+      m_longest = std::max(m_longest, duration);
+      ReportSlowAnnouncer();
+    }
+  }
+
+private:
+  void ReportSlowAnnouncer()
+  {
+    const auto now = std::chrono::steady_clock::now();
+    if (now - m_lastReport < SLOW_ANNOUNCER_REPORT_INTERVAL)
+      return;
+
+    if (m_dropped > 0 || m_longest >= SLOW_ANNOUNCER_DURATION)
+    {
+      CLog::Log(LOGWARNING,
+                "CAnnouncementManager: announcer {} is slow, {} announcements dropped, {} "
+                "coalesced, {} pending, longest call {} ms",
+                typeid(*m_announcer).name(), m_dropped, m_coalesced, m_announcements.size(),
+                m_longest.count());
+    }
+
+    m_lastReport = now;
+    m_dropped = 0;
+    m_coalesced = 0;
+    m_longest = 0ms;
+  }
+
+  struct CQueuedAnnouncement
+  {
+    AnnouncementFlag flag;
+    std::string sender;
+    std::string message;
+    CVariant data;
+  };
+
+  IAnnouncer* const m_announcer;
+  const AnnouncerQueue m_queue;
+  CCriticalSection m_critSection;
+  std::deque<CQueuedAnnouncement> m_announcements;
+  CEvent m_queueEvent;
+
+  // slow consumer statistics since the last report
+  std::chrono::steady_clock::time_point m_lastReport{std::chrono::steady_clock::now()};
+  size_t m_dropped{0};
+  size_t m_coalesced{0};
+  std::chrono::milliseconds m_longest{0};
+};
+
 CAnnouncementManager::CAnnouncementManager() : CThread("Announce")
 {
 }
@@ -238,8 +383,20 @@ void CAnnouncementManager::Deinitialize()
   m_bStop = true;
   m_queueEvent.Set();
   StopThread();
-  std::unique_lock lock(m_announcersCritSection);
-  m_announcers.clear();
+
+  std::unordered_map<IAnnouncer*, CAnnouncer> announcers;
+  {
+    std::unique_lock lock(m_announcersCritSection);
+    announcers.swap(m_announcers);
+  }
+
+  for (const auto& [announcer, details] : announcers)
+  {
+    if (details.queue)
+      details.queue->Stop(true);
+  }
+
+  RemoveFinishedQueues();
 }
 
 void CAnnouncementManager::AddAnnouncer(IAnnouncer *listener)
@@ -248,12 +405,34 @@ void CAnnouncementManager::AddAnnouncer(IAnnouncer *listener)
 }
 
 void CAnnouncementManager::AddAnnouncer(IAnnouncer* listener, int flagMask)
+{
+  AddAnnouncer(listener, flagMask, AnnouncerQueue::NONE);
+}
+
+void CAnnouncementManager::AddAnnouncer(IAnnouncer* listener,
+                                        int flagMask,
+                                        AnnouncerQueue queue)
 {
   if (!listener)
     return;
 
   std::unique_lock lock(m_announcersCritSection);
-  m_announcers.emplace(listener, flagMask);
+  auto it = m_announcers.find(listener);
+  if (it != m_announcers.end())
+  {
+    // keep the queue of an announcer which only changes the announcements it wants
+    it->second.flagMask = flagMask;
+    return;
+  }
+
+  std::shared_ptr<CAnnouncerQueue> announcerQueue;
+  if (queue != AnnouncerQueue::NONE)
+  {
+    announcerQueue = std::make_shared<CAnnouncerQueue>(listener, queue);
+    announcerQueue->Create();
+  }
+
+  m_announcers.emplace(listener, CAnnouncer{flagMask, std::move(announcerQueue)});
 }
 
 void CAnnouncementManager::RemoveAnnouncer(IAnnouncer *listener)
@@ -261,8 +440,44 @@ void CAnnouncementManager::RemoveAnnouncer(IAnnouncer *listener)
   if (!listener)
     return;
 
-  std::unique_lock lock(m_announcersCritSection);
-  m_announcers.erase(listener);
+  std::shared_ptr<CAnnouncerQueue> queue;
+  {
+    std::unique_lock lock(m_announcersCritSection);
+    auto it = m_announcers.find(listener);
+    if (it == m_announcers.end())
+      return;
+
+    queue = std::move(it->second.queue);
+    m_announcers.erase(it);
+
+    // an announcer removing itself while being called can't wait for itself
+    if (queue && queue->IsCurrentThread())
+    {
+      queue->Stop(false);
+      m_finishedQueues.emplace_back(std::move(queue));
+      return;
+    }
+  }
+
+  // make sure the announcer isn't called anymore once this returns
+  if (queue)
+    queue->Stop(true);
+}
+
+void CAnnouncementManager::RemoveFinishedQueues()
+{
+  std::vector<std::shared_ptr<CAnnouncerQueue>> finishedQueues;
+  {
+    std::unique_lock lock(m_announcersCritSection);
+    auto it = std::stable_partition(m_finishedQueues.begin(), m_finishedQueues.end(),
+                                    [](const auto& queue) { return queue->IsRunning(); });
+    finishedQueues.assign(std::make_move_iterator(it),
+                          std::make_move_iterator(m_finishedQueues.end()));
+    m_finishedQueues.erase(it, m_finishedQueues.end());
+  }
+
+  for (const auto& queue : finishedQueues)
+    queue->Stop(true);
 }
 
 void CAnnouncementManager::Announce(AnnouncementFlag flag, const std::string& message)
@@ -344,13 +559,22 @@ void CAnnouncementManager::DoAnnounce(AnnouncementFlag flag,
   std::unique_lock lock(m_announcersCritSection);
 
   // Make a copy of announcers. They may be removed or even remove themselves during execution of IAnnouncer::Announce()!
-  std::unordered_map<IAnnouncer*, int> announcers{m_announcers};
-  for (const auto& [announcer, flagMask] : announcers)
+  std::unordered_map<IAnnouncer*, CAnnouncer> announcers{m_announcers};
+  for (const auto& [announcer, details] : announcers)
   {
-    if (flag & flagMask)
+    if ((flag & details.flagMask) == 0)
+      continue;
+
+    if (details.queue)
     {
-      announcer->Announce(flag, sender, message, data);
+      details.queue->Push(flag, sender, message, data);
+      continue;
     }
+
+    const std::chrono::milliseconds duration = CallAnnouncer(announcer, flag, sender, message, data);
+    if (duration >= SLOW_ANNOUNCER_DURATION)
+      CLog::LogFC(LOGDEBUG, LOGANNOUNCE, "CAnnouncementManager - announcer {} took {} ms for {}",
+                  typeid(*announcer).name(), duration.count(), message);
   }
 }
 
@@ -372,6 +596,8 @@ void CAnnouncementManager::Process()
 
   while (!m_bStop)
   {
+    RemoveFinishedQueues();
+
     std::unique_lock lock(m_queueCritSection);
     if (!m_announcementQueue.empty())
     {
@@ -17,12 +17,23 @@
 #include <list>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 class CFileItem;
 class CVariant;
 
 namespace ANNOUNCEMENT
 {
+  /*!
+   * \brief How announcements are delivered to an announcer.
+   */
+  enum class AnnouncerQueue
+  {
+    NONE, ///< called from the announcement thread, in line with all other such announcers
+    DROP_OLDEST, ///< called from a thread of its own, the oldest announcement is dropped when it falls behind
+    COALESCE, ///< like DROP_OLDEST but an identical announcement still in the queue is replaced
+  };
+
   class CAnnouncementManager : public CThread
   {
   public:
@@ -34,6 +45,14 @@ namespace ANNOUNCEMENT
 
     void AddAnnouncer(IAnnouncer *listener);
     void AddAnnouncer(IAnnouncer* listener, int flagMask);
+    /*!
+     * \brief Add an announcer which may take its time handling announcements without holding up
+     * any other announcer.
+     * \param listener the announcer
+     * \param flagMask the announcement flags the announcer is interested in
+     * \param queue how pending announcements are queued for the announcer
+     */
+    void AddAnnouncer(IAnnouncer* listener, int flagMask, AnnouncerQueue queue);
     void RemoveAnnouncer(IAnnouncer *listener);
 
     void Announce(AnnouncementFlag flag, const std::string& message);
@@ -89,8 +108,20 @@ namespace ANNOUNCEMENT
     CAnnouncementManager(const CAnnouncementManager&) = delete;
     CAnnouncementManager const& operator=(CAnnouncementManager const&) = delete;
 
+    class CAnnouncerQueue;
+
+    struct CAnnouncer
+    {
+      int flagMask;
+      std::shared_ptr<CAnnouncerQueue> queue;
+    };
+
+    void RemoveFinishedQueues();
+
     CCriticalSection m_announcersCritSection;
     CCriticalSection m_queueCritSection;
-    std::unordered_map<IAnnouncer*, int> m_announcers;
+    std::unordered_map<IAnnouncer*, CAnnouncer> m_announcers;
+    // queues of announcers which removed themselves while being called, to be cleaned up
+    std::vector<std::shared_ptr<CAnnouncerQueue>> m_finishedQueues;
   };
 }
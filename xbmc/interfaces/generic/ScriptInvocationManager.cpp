@@ -73,8 +73,8 @@ void CScriptInvocationManager::Uninitialize()
   // execute Process() once more to handle the remaining scripts
   Process();
 
-  // it is safe to release early, thread must be in m_scripts too
-  m_lastInvokerThread = nullptr;
+  // it is safe to release early, threads must be in m_scripts too
+  m_reusableInvokers.clear();
 
   // make sure all scripts are done
   std::vector<LanguageInvokerThread> tempList;
@@ -180,13 +180,10 @@ int CScriptInvocationManager::GetReusablePluginHandle(const std::string& script)
 {
   std::unique_lock lock(m_critSection);
 
-  if (m_lastInvokerThread)
-  {
-    if (m_lastInvokerThread->Reuseable(script))
-      return m_lastPluginHandle;
-    m_lastInvokerThread->Release();
-    m_lastInvokerThread = nullptr;
-  }
+  const auto reusable = getReusableInvoker(script);
+  if (reusable != m_reusableInvokers.end())
+    return reusable->pluginHandle;
+
   return -1;
 }
 
@@ -195,17 +192,13 @@ std::shared_ptr<ILanguageInvoker> CScriptInvocationManager::GetLanguageInvoker(
 {
   std::unique_lock lock(m_critSection);
 
-  if (m_lastInvokerThread)
+  const auto reusable = getReusableInvoker(script);
+  if (reusable != m_reusableInvokers.end())
   {
-    if (m_lastInvokerThread->Reuseable(script))
-    {
-      CLog::Log(LOGDEBUG, "{} - Reusing LanguageInvokerThread {} for script {}", __FUNCTION__,
-                m_lastInvokerThread->GetId(), script);
-      m_lastInvokerThread->GetInvoker()->Reset();
-      return m_lastInvokerThread->GetInvoker();
-    }
-    m_lastInvokerThread->Release();
-    m_lastInvokerThread = nullptr;
+    CLog::Log(LOGDEBUG, "{} - Reusing LanguageInvokerThread {} for script {}", __FUNCTION__,
+              reusable->thread->GetId(), script);
+    reusable->thread->GetInvoker()->Reset();
+    return reusable->thread->GetInvoker();
   }
 
   std::string extension = URIUtils::GetExtension(script);
@@ -257,34 +250,47 @@ int CScriptInvocationManager::ExecuteAsync(
 
   std::unique_lock lock(m_critSection);
 
-  if (m_lastInvokerThread && m_lastInvokerThread->GetInvoker() == languageInvoker)
+  for (const auto& reusable : m_reusableInvokers)
   {
+    if (reusable.thread->GetInvoker() != languageInvoker)
+      continue;
+
     if (addon != NULL)
-      m_lastInvokerThread->SetAddon(addon);
+      reusable.thread->SetAddon(addon);
 
-    // After we leave the lock, m_lastInvokerThread can be released -> copy!
-    CLanguageInvokerThreadPtr invokerThread = m_lastInvokerThread;
+    // After we leave the lock, the pool entry can be released -> copy!
+    CLanguageInvokerThreadPtr invokerThread = reusable.thread;
     lock.unlock();
     invokerThread->Execute(script, arguments);
 
     return invokerThread->GetId();
   }
 
-  m_lastInvokerThread = std::make_shared<CLanguageInvokerThread>(languageInvoker, this, reuseable);
-  if (m_lastInvokerThread == NULL)
+  CLanguageInvokerThreadPtr invokerThread =
+      std::make_shared<CLanguageInvokerThread>(languageInvoker, this, reuseable);
+  if (invokerThread == NULL)
     return -1;
 
   if (addon != NULL)
-    m_lastInvokerThread->SetAddon(addon);
+    invokerThread->SetAddon(addon);
+
+  invokerThread->SetId(m_nextId++);
+
+  LanguageInvokerThread thread = {invokerThread, script, false};
+  m_scripts.insert(std::make_pair(invokerThread->GetId(), thread));
+  m_scriptPaths.insert(std::make_pair(script, invokerThread->GetId()));
 
-  m_lastInvokerThread->SetId(m_nextId++);
-  m_lastPluginHandle = pluginHandle;
+  if (reuseable)
+  {
+    m_reusableInvokers.push_front({invokerThread, pluginHandle});
+    // let the least recently used interpreters go, they end once their script is done
+    while (m_reusableInvokers.size() > MAX_REUSABLE_INVOKERS)
+    {
+      m_reusableInvokers.back().thread->Release();
+      m_reusableInvokers.pop_back();
+    }
+  }
 
-  LanguageInvokerThread thread = {m_lastInvokerThread, script, false};
-  m_scripts.insert(std::make_pair(m_lastInvokerThread->GetId(), thread));
-  m_scriptPaths.insert(std::make_pair(script, m_lastInvokerThread->GetId()));
-  // After we leave the lock, m_lastInvokerThread can be released -> copy!
-  CLanguageInvokerThreadPtr invokerThread = m_lastInvokerThread;
   lock.unlock();
   invokerThread->Execute(script, arguments);
 
@@ -411,6 +417,27 @@ void CScriptInvocationManager::OnExecutionDone(int scriptId)
     script->second.done = true;
 }
 
+CScriptInvocationManager::ReusableInvokerList::iterator CScriptInvocationManager::
+    getReusableInvoker(const std::string& script)
+{
+  for (auto it = m_reusableInvokers.begin(); it != m_reusableInvokers.end();)
+  {
+    if (it->thread->Reuseable(script))
+    {
+      m_reusableInvokers.splice(m_reusableInvokers.begin(), m_reusableInvokers, it);
+      return m_reusableInvokers.begin();
+    }
+
+    // the thread ends after a failed or stopped run, its interpreter is gone
+    if (it->thread->GetState() >= InvokerStateExecutionDone)
+      it = m_reusableInvokers.erase(it);
+    else
+      ++it;
+  }
+
+  return m_reusableInvokers.end();
+}
+
 CScriptInvocationManager::LanguageInvokerThread CScriptInvocationManager::getInvokerThread(int scriptId) const
 {
   if (scriptId < 0)
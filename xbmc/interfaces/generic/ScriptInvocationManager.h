@@ -12,6 +12,7 @@
 #include "interfaces/generic/ILanguageInvoker.h"
 #include "threads/CriticalSection.h"
 
+#include <list>
 #include <map>
 #include <memory>
 #include <set>
@@ -35,7 +36,7 @@ public:
   std::shared_ptr<ILanguageInvoker> GetLanguageInvoker(const std::string& script);
 
   /*!
-  * \brief Returns addon_handle if last reusable invoker is ready to use.
+  * \brief Returns addon_handle if a pooled reusable invoker of the script is ready to use.
   */
   int GetReusablePluginHandle(const std::string& script);
 
@@ -145,10 +146,24 @@ private:
 
   LanguageInvokerThread getInvokerThread(int scriptId) const;
 
+  struct ReusableInvoker
+  {
+    CLanguageInvokerThreadPtr thread;
+    int pluginHandle;
+  };
+  typedef std::list<ReusableInvoker> ReusableInvokerList;
+
+  /*!
+  * \brief Returns the pooled invoker whose interpreter is idle and was last used for the given
+  * script and moves it to the front of the pool. Drops pooled invokers that have terminated.
+  */
+  ReusableInvokerList::iterator getReusableInvoker(const std::string& script);
+
   LanguageInvocationHandlerMap m_invocationHandlers;
   LanguageInvokerThreadMap m_scripts;
-  CLanguageInvokerThreadPtr m_lastInvokerThread;
-  int m_lastPluginHandle = -1;
+  // warm interpreters of add-ons with <reuselanguageinvoker>, most recently used first
+  ReusableInvokerList m_reusableInvokers;
+  static constexpr size_t MAX_REUSABLE_INVOKERS = 4;
 
   std::map<std::string, int> m_scriptPaths;
   int m_nextId = 0;
@@ -13,7 +13,7 @@
 namespace INFO
 {
 InfoBool::InfoBool(const std::string& expression, int context, unsigned int& refreshCounter)
-  : m_context(context), m_expression(expression), m_parentRefreshCounter(refreshCounter)
+  : m_context(context), m_expression(expression), m_parentRefreshCounter(&refreshCounter)
 {
   StringUtils::ToLower(m_expression);
 }
@@ -37,10 +37,10 @@ public:
   {
     if (item && m_listItemDependent)
       Update(contextWindow, item);
-    else if (m_refreshCounter != m_parentRefreshCounter || m_refreshCounter == 0)
+    else if (m_refreshCounter != *m_parentRefreshCounter || m_refreshCounter == 0)
     {
       Update(contextWindow, nullptr);
-      m_refreshCounter = m_parentRefreshCounter;
+      m_refreshCounter = *m_parentRefreshCounter;
     }
     return m_value;
   }
@@ -68,7 +68,22 @@ public:
 
   const std::string &GetExpression() const { return m_expression; }
   bool ListItemDependent() const { return m_listItemDependent; }
+
+  /*! \brief Get the counter whose changes make this info bool dirty
+   */
+  const unsigned int& GetRefreshCounter() const { return *m_parentRefreshCounter; }
+
 protected:
+  /*! \brief Only update the value when the given counter changes
+   Used for info bools which depend on state that is known to change less often than the
+   counter passed to the constructor, which is increased for every frame.
+   */
+  void SetRefreshCounter(const unsigned int& refreshCounter)
+  {
+    m_parentRefreshCounter = &refreshCounter;
+    m_refreshCounter = 0;
+  }
+
   bool m_value = false; ///< current value
   int m_context;               ///< contextual information to go with the condition
   bool m_listItemDependent = false; ///< do not cache if a listitem pointer is given
@@ -77,7 +92,7 @@ protected:
 
 private:
   unsigned int m_refreshCounter = 0;
-  unsigned int &m_parentRefreshCounter;
+  const unsigned int* m_parentRefreshCounter;
 };
 
 typedef std::shared_ptr<InfoBool> InfoPtr;
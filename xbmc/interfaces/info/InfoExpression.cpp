@@ -21,6 +21,7 @@ void InfoSingle::Initialize(CGUIInfoManager* infoMgr)
 {
   InfoBool::Initialize(infoMgr);
   m_condition = m_infoMgr->TranslateSingleString(m_expression, m_listItemDependent);
+  SetRefreshCounter(m_infoMgr->GetRefreshCounter(m_condition));
 }
 
 void InfoSingle::Update(int contextWindow, const CGUIListItem* item)
@@ -39,6 +40,11 @@ void InfoExpression::Initialize(CGUIInfoManager* infoMgr)
     CLog::Log(LOGERROR, "Error parsing boolean expression {}", m_expression);
     m_expression_tree = std::make_shared<InfoLeaf>(m_infoMgr->Register("false", 0), false);
   }
+  else if (m_leafRefreshCounter && !m_mixedRefreshCounters)
+  {
+    // all operands change at the same time, so the expression only has to follow them
+    SetRefreshCounter(*m_leafRefreshCounter);
+  }
 }
 
 void InfoExpression::Update(int contextWindow, const CGUIListItem* item)
@@ -67,6 +73,14 @@ void InfoExpression::Update(int contextWindow, const CGUIListItem* item)
  *    operations. So [A|B]|[C|D+[[E|F]|G] becomes A|B|C|[D+[E|F|G]].
  */
 
+void InfoExpression::AddRefreshCounter(const unsigned int& refreshCounter)
+{
+  if (!m_leafRefreshCounter)
+    m_leafRefreshCounter = &refreshCounter;
+  else if (m_leafRefreshCounter != &refreshCounter)
+    m_mixedRefreshCounters = true;
+}
+
 bool InfoExpression::InfoLeaf::Evaluate(int contextWindow, const CGUIListItem* item)
 {
   return m_invert ^ m_info->Get(contextWindow, item);
@@ -247,6 +261,7 @@ bool InfoExpression::Parse(const std::string &expression)
         }
         /* Propagate any listItem dependency from the operand to the expression */
         m_listItemDependent |= info->ListItemDependent();
+        AddRefreshCounter(info->GetRefreshCounter());
         nodes.push(std::make_shared<InfoLeaf>(info, invert));
         /* Reuse operand string for next operand */
         operand.clear();
@@ -298,6 +313,7 @@ bool InfoExpression::Parse(const std::string &expression)
     }
     /* Propagate any listItem dependency from the operand to the expression */
     m_listItemDependent |= info->ListItemDependent();
+    AddRefreshCounter(info->GetRefreshCounter());
     nodes.push(std::make_shared<InfoLeaf>(info, invert));
   }
   while (!operator_stack.empty())
@@ -111,7 +111,10 @@ private:
   static operator_t GetOperator(char ch);
   static void OperatorPop(std::stack<operator_t> &operator_stack, bool &invert, std::stack<InfoSubexpressionPtr> &nodes);
   bool Parse(const std::string &expression);
+  void AddRefreshCounter(const unsigned int& refreshCounter);
   InfoSubexpressionPtr m_expression_tree;
+  const unsigned int* m_leafRefreshCounter = nullptr; ///< the refresh counter of the operands
+  bool m_mixedRefreshCounters = false; ///< whether the operands use different refresh counters
 };
 
 };
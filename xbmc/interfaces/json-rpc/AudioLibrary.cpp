@@ -32,6 +32,7 @@
 #include "utils/Variant.h"
 
 #include <memory>
+#include <utility>
 
 using namespace MUSIC_INFO;
 using namespace JSONRPC;
@@ -279,23 +280,25 @@ JSONRPC_STATUS CAudioLibrary::GetAlbums(const std::string &method, ITransportLay
       if (bFetchFanart)
         artfields.insert("fanart");
 
-      for (unsigned int index = 0; index < result["albums"].size(); index++)
+      CVariant& albums = result["albums"];
+      for (CVariant::iterator_array album = albums.begin_array(); album != albums.end_array();
+           ++album)
       {
         CFileItem item;
-        item.GetMusicInfoTag()->SetDatabaseId(result["albums"][index]["albumid"].asInteger32(), MediaTypeAlbum);
+        item.GetMusicInfoTag()->SetDatabaseId((*album)["albumid"].asInteger32(), MediaTypeAlbum);
 
         // Could use FillDetails, but it does unnecessary serialization of empty MusiInfoTag
         // CFileItemPtr itemptr(new CFileItem(item));
-        // FillDetails(item.GetMusicInfoTag(), itemptr, artfields, result["albums"][index], thumbLoader);
+        // FillDetails(item.GetMusicInfoTag(), itemptr, artfields, *album, thumbLoader);
 
         thumbLoader->FillLibraryArt(item);
 
         if (bFetchFanart)
         {
           if (item.HasArt("fanart"))
-            result["albums"][index]["fanart"] = IMAGE_FILES::URLFromFile(item.GetArt("fanart"));
+            (*album)["fanart"] = IMAGE_FILES::URLFromFile(item.GetArt("fanart"));
           else
-            result["albums"][index]["fanart"] = "";
+            (*album)["fanart"] = "";
         }
         if (bFetchArt)
         {
@@ -306,7 +309,7 @@ JSONRPC_STATUS CAudioLibrary::GetAlbums(const std::string &method, ITransportLay
             if (!artIt.second.empty())
               artObj[artIt.first] = IMAGE_FILES::URLFromFile(artIt.second);
           }
-          result["albums"][index]["art"] = artObj;
+          (*album)["art"] = std::move(artObj);
         }
       }
 
@@ -432,36 +435,37 @@ JSONRPC_STATUS CAudioLibrary::GetSongs(const std::string &method, ITransportLaye
       if (bFetchThumb)
         artfields.insert("thumbnail");
 
-      for (unsigned int index = 0; index < result["songs"].size(); index++)
+      CVariant& songs = result["songs"];
+      for (CVariant::iterator_array song = songs.begin_array(); song != songs.end_array(); ++song)
       {
         CFileItem item;
         // Only needs song and album id (if we have it) set to get art
         // Getting art is quicker if "albumid" has been fetched
-        item.GetMusicInfoTag()->SetDatabaseId(result["songs"][index]["songid"].asInteger32(), MediaTypeSong);
-        if (result["songs"][index].isMember("albumid"))
-          item.GetMusicInfoTag()->SetAlbumId(result["songs"][index]["albumid"].asInteger32());
+        item.GetMusicInfoTag()->SetDatabaseId((*song)["songid"].asInteger32(), MediaTypeSong);
+        if (song->isMember("albumid"))
+          item.GetMusicInfoTag()->SetAlbumId((*song)["albumid"].asInteger32());
         else
           item.GetMusicInfoTag()->SetAlbumId(-1);
 
         // Could use FillDetails, but it does unnecessary serialization of empty MusiInfoTag
         // CFileItemPtr itemptr(new CFileItem(item));
-        // FillDetails(item.GetMusicInfoTag(), itemptr, artfields, result["songs"][index], thumbLoader);
+        // FillDetails(item.GetMusicInfoTag(), itemptr, artfields, *song, thumbLoader);
 
         thumbLoader->FillLibraryArt(item);
 
         if (bFetchThumb)
         {
           if (item.HasArt("thumb"))
-            result["songs"][index]["thumbnail"] = IMAGE_FILES::URLFromFile(item.GetArt("thumb"));
+            (*song)["thumbnail"] = IMAGE_FILES::URLFromFile(item.GetArt("thumb"));
           else
-            result["songs"][index]["thumbnail"] = "";
+            (*song)["thumbnail"] = "";
         }
         if (bFetchFanart)
         {
           if (item.HasArt("fanart"))
-            result["songs"][index]["fanart"] = IMAGE_FILES::URLFromFile(item.GetArt("fanart"));
+            (*song)["fanart"] = IMAGE_FILES::URLFromFile(item.GetArt("fanart"));
           else
-            result["songs"][index]["fanart"] = "";
+            (*song)["fanart"] = "";
         }
         if (bFetchArt)
         {
@@ -472,7 +476,7 @@ JSONRPC_STATUS CAudioLibrary::GetSongs(const std::string &method, ITransportLaye
             if (!artIt.second.empty())
               artObj[artIt.first] = IMAGE_FILES::URLFromFile(artIt.second);
           }
-          result["songs"][index]["art"] = artObj;
+          (*song)["art"] = std::move(artObj);
         }
       }
 
@@ -1065,6 +1069,19 @@ JSONRPC_STATUS CAudioLibrary::Export(const std::string &method, ITransportLayer
   return ACK;
 }
 
+JSONRPC_STATUS CAudioLibrary::GetChanges(const std::string& method,
+                                         ITransportLayer* transport,
+                                         IClient* client,
+                                         const CVariant& parameterObject,
+                                         CVariant& result)
+{
+  CMusicDatabase musicdatabase;
+  if (!musicdatabase.Open())
+    return InternalError;
+
+  return HandleChanges(musicdatabase, parameterObject, result);
+}
+
 JSONRPC_STATUS CAudioLibrary::Clean(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant &parameterObject, CVariant &result)
 {
   std::string cmd = StringUtils::Format(
@@ -15,6 +15,7 @@
 #include "Util.h"
 #include "VideoLibrary.h"
 #include "addons/kodi-dev-kit/include/kodi/c-api/addon-instance/pvr/pvr_epg.h" // EPG_TAG_INVALID_UID
+#include "dbwrappers/Database.h"
 #include "filesystem/Directory.h"
 #include "imagefiles/ImageFileURL.h"
 #include "music/MusicThumbLoader.h"
@@ -555,3 +556,32 @@ void CFileItemHandler::Sort(CFileItemList &items, const CVariant &parameterObjec
 
   items.Sort(sorting);
 }
+
+JSONRPC_STATUS CFileItemHandler::HandleChanges(CDatabase& database,
+                                               const CVariant& parameterObject,
+                                               CVariant& result)
+{
+  const int64_t since = parameterObject["since"].asInteger();
+  const auto limit = static_cast<unsigned int>(parameterObject["limit"].asUnsignedInteger());
+
+  std::vector<CDatabase::Change> changes;
+  int64_t latest;
+  if (!database.GetChanges(since, limit, changes, latest))
+    return InternalError;
+
+  result["changes"] = CVariant(CVariant::VariantTypeArray);
+  for (const CDatabase::Change& change : changes)
+  {
+    CVariant object(CVariant::VariantTypeObject);
+    object["sequence"] = change.sequence;
+    object["type"] = change.mediaType;
+    object["id"] = change.id;
+    object["action"] = change.removed ? "remove" : "update";
+    result["changes"].push_back(std::move(object));
+  }
+  // where to continue from, the caller is up to date once it reaches latest
+  result["sequence"] = changes.empty() ? since : changes.back().sequence;
+  result["latest"] = latest;
+
+  return OK;
+}
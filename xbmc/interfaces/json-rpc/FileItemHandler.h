@@ -14,6 +14,7 @@
 #include <memory>
 #include <set>
 
+class CDatabase;
 class CFileItem;
 class CFileItemList;
 class CThumbLoader;
@@ -52,6 +53,12 @@ namespace JSONRPC
                                CThumbLoader* thumbLoader = nullptr);
 
     static bool FillFileItemList(const CVariant &parameterObject, CFileItemList &list);
+
+    //! Fill the result of the GetChanges methods with the changes recorded in the database
+    static JSONRPC_STATUS HandleChanges(CDatabase& database,
+                                       const CVariant& parameterObject,
+                                       CVariant& result);
+
   private:
     static void Sort(CFileItemList &items, const CVariant& parameterObject);
     static bool GetField(const std::string& field,
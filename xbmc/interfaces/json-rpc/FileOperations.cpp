@@ -17,6 +17,7 @@
 #include "Util.h"
 #include "VideoLibrary.h"
 #include "filesystem/Directory.h"
+#include "filesystem/FileCacheStats.h"
 #include "media/MediaLockState.h"
 #include "playlists/PlayListFileItemClassify.h"
 #include "settings/AdvancedSettings.h"
@@ -289,6 +290,67 @@ JSONRPC_STATUS CFileOperations::Download(const std::string &method, ITransportLa
   return transport->Download(parameterObject["path"].asString().c_str(), result) ? OK : InvalidParams;
 }
 
+JSONRPC_STATUS CFileOperations::GetCacheStatistics(const std::string& method,
+                                                   ITransportLayer* transport,
+                                                   IClient* client,
+                                                   const CVariant& parameterObject,
+                                                   CVariant& result)
+{
+  result["sources"] = CVariant(CVariant::VariantTypeArray);
+  for (const CFileCacheStats::Stats& stats : CFileCacheStats::GetStats())
+  {
+    CVariant source;
+    source["source"] = stats.source;
+    source["open"] = stats.open;
+    source["bytesfetched"] = stats.bytesFetched;
+    source["bytesread"] = stats.bytesRead;
+    source["fetchrate"] = stats.GetFetchRate();
+    source["seeks"] = stats.seeks;
+    source["cachedseeks"] = stats.cachedSeeks;
+    source["cachehitratio"] = stats.GetHitRatio();
+    source["stalls"] = stats.stalls;
+    source["stalltime"] = stats.stallTime.count();
+    source["longeststall"] = stats.longestStall.count();
+
+    CVariant latency(CVariant::VariantTypeArray);
+    for (size_t i = 0; i < stats.refillLatency.size(); i++)
+    {
+      CVariant bucket;
+      // the last bucket has no upper bound
+      bucket["upto"] = i < CFileCacheStats::LATENCY_BOUNDS_MS.size()
+                           ? CVariant(CFileCacheStats::LATENCY_BOUNDS_MS[i])
+                           : CVariant(CVariant::VariantTypeNull);
+      bucket["count"] = stats.refillLatency[i];
+      latency.push_back(bucket);
+    }
+    source["refilllatency"] = latency;
+    result["sources"].push_back(source);
+  }
+  return OK;
+}
+
+JSONRPC_STATUS CFileOperations::TestSpeed(const std::string& method,
+                                          ITransportLayer* transport,
+                                          IClient* client,
+                                          const CVariant& parameterObject,
+                                          CVariant& result)
+{
+  const std::string file = parameterObject["file"].asString();
+  if (!CFileUtils::RemoteAccessAllowed(file))
+    return InvalidParams;
+
+  CFileCacheStats::SpeedTest test;
+  if (!CFileCacheStats::TestSpeed(file, parameterObject["size"].asInteger(), test))
+    return FailedToExecute;
+
+  result["bytes"] = test.bytes;
+  result["opentime"] = test.openTime.count();
+  result["firstbytetime"] = test.firstByteTime.count();
+  result["readtime"] = test.readTime.count();
+  result["rate"] = test.GetRate();
+  return OK;
+}
+
 bool CFileOperations::FillFileItem(
     const std::shared_ptr<CFileItem>& originalItem,
     std::shared_ptr<CFileItem>& item,
@@ -31,11 +31,20 @@
 #include "utils/Variant.h"
 #include "utils/log.h"
 
+#include <algorithm>
+#include <atomic>
+#include <future>
 #include <string.h>
 
 using namespace KODI;
 using namespace JSONRPC;
 
+namespace
+{
+// calls of a batch handled at the same time
+constexpr size_t MAX_PARALLEL_CALLS = 4;
+} // namespace
+
 bool CJSONRPC::m_initialized = false;
 
 void CJSONRPC::Initialize()
@@ -241,7 +250,20 @@ JSONRPC_STATUS CJSONRPC::NotifyAll(const std::string &method, ITransportLayer *t
 
 std::string CJSONRPC::MethodCall(const std::string &inputString, ITransportLayer *transport, IClient *client)
 {
-  CVariant inputroot, outputroot, result;
+  CVariant outputroot;
+  std::string str;
+  if (MethodCall(inputString, transport, client, outputroot))
+    CJSONVariantWriter::Write(outputroot, str, CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_jsonOutputCompact);
+
+  return str;
+}
+
+bool CJSONRPC::MethodCall(const std::string& inputString,
+                          ITransportLayer* transport,
+                          IClient* client,
+                          CVariant& outputroot)
+{
+  CVariant inputroot;
   bool hasResponse = false;
 
   CLog::Log(LOGDEBUG, LOGJSONRPC, "JSONRPC: Incoming request: {}", inputString);
@@ -258,13 +280,33 @@ std::string CJSONRPC::MethodCall(const std::string &inputString, ITransportLayer
       }
       else
       {
-        for (CVariant::const_iterator_array itr = inputroot.begin_array();
-             itr != inputroot.end_array(); ++itr)
+        // runs of read-only calls are handled in parallel, everything else in order, so a call
+        // still sees the effects of all calls before it
+        const size_t size = inputroot.size();
+        std::vector<std::optional<CVariant>> responses(size);
+        for (size_t begin = 0; begin < size;)
+        {
+          size_t end = begin;
+          while (end < size && CanRunInParallel(inputroot[end]))
+            end++;
+
+          if (end - begin > 1)
+            HandleParallel(inputroot, begin, end, responses, transport, client);
+          else
+          {
+            end = begin + 1;
+            CVariant response;
+            if (HandleMethodCall(inputroot[begin], response, transport, client))
+              responses[begin] = std::move(response);
+          }
+          begin = end;
+        }
+
+        for (auto& response : responses)
         {
-          CVariant response;
-          if (HandleMethodCall(*itr, response, transport, client))
+          if (response)
           {
-            outputroot.append(response);
+            outputroot.append(std::move(*response));
             hasResponse = true;
           }
         }
@@ -280,11 +322,7 @@ std::string CJSONRPC::MethodCall(const std::string &inputString, ITransportLayer
     hasResponse = true;
   }
 
-  std::string str;
-  if (hasResponse)
-    CJSONVariantWriter::Write(outputroot, str, CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_jsonOutputCompact);
-
-  return str;
+  return hasResponse;
 }
 
 bool CJSONRPC::HandleMethodCall(const CVariant& request, CVariant& response, ITransportLayer *transport, IClient *client)
@@ -322,6 +360,48 @@ bool CJSONRPC::HandleMethodCall(const CVariant& request, CVariant& response, ITr
   return !isNotification;
 }
 
+bool CJSONRPC::CanRunInParallel(const CVariant& request)
+{
+  if (!IsProperJSONRPC(request))
+    return false;
+
+  std::string methodName = request["method"].asString();
+  StringUtils::ToLower(methodName);
+
+  // library getters only read from their own database connections, other read-only methods
+  // query application or gui state which is not meant to be accessed concurrently
+  OperationPermission permission;
+  return (StringUtils::StartsWith(methodName, "videolibrary.get") ||
+          StringUtils::StartsWith(methodName, "audiolibrary.get")) &&
+         CJSONServiceDescription::GetPermission(methodName, permission) && permission == ReadData;
+}
+
+void CJSONRPC::HandleParallel(const CVariant& batch,
+                              size_t begin,
+                              size_t end,
+                              std::vector<std::optional<CVariant>>& responses,
+                              ITransportLayer* transport,
+                              IClient* client)
+{
+  std::atomic<size_t> next{begin};
+  const auto worker = [&]()
+  {
+    for (size_t i = next++; i < end; i = next++)
+    {
+      CVariant response;
+      if (HandleMethodCall(batch[i], response, transport, client))
+        responses[i] = std::move(response);
+    }
+  };
+
+  std::vector<std::future<void>> workers;
+  for (size_t i = 1; i < std::min(MAX_PARALLEL_CALLS, end - begin); ++i)
+    workers.emplace_back(std::async(std::launch::async, worker));
+  worker();
+  for (const auto& result : workers)
+    result.wait();
+}
+
 inline bool CJSONRPC::IsProperJSONRPC(const CVariant& inputroot)
 {
   return inputroot.isMember("jsonrpc") && inputroot["jsonrpc"].isString() && inputroot["jsonrpc"] == CVariant("2.0") && inputroot.isMember("method") && inputroot["method"].isString() && (!inputroot.isMember("params") || inputroot["params"].isArray() || inputroot["params"].isObject());
@@ -13,8 +13,10 @@
 
 #include <iostream>
 #include <map>
+#include <optional>
 #include <stdio.h>
 #include <string>
+#include <vector>
 
 class CVariant;
 
@@ -53,6 +55,22 @@ namespace JSONRPC
      */
     static std::string MethodCall(const std::string &inputString, ITransportLayer *transport, IClient *client);
 
+    /*!
+     \brief Handles an incoming JSON-RPC request without serializing the response
+     \param inputString received JSON-RPC request
+     \param transport Transport protocol on which the request arrived
+     \param client Client which sent the request
+     \param response [out] JSON-RPC response to be sent back to the client
+     \return true if there is a response to be sent, false for notifications
+
+     Same as MethodCall() above but leaves the serialization of the response
+     to the caller, e.g. to stream large responses to the client.
+     */
+    static bool MethodCall(const std::string& inputString,
+                           ITransportLayer* transport,
+                           IClient* client,
+                           CVariant& response);
+
     static JSONRPC_STATUS Introspect(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant& parameterObject, CVariant &result);
     static JSONRPC_STATUS Version(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant& parameterObject, CVariant &result);
     static JSONRPC_STATUS Permission(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant& parameterObject, CVariant &result);
@@ -63,6 +81,13 @@ namespace JSONRPC
 
   private:
     static bool HandleMethodCall(const CVariant& request, CVariant& response, ITransportLayer *transport, IClient *client);
+    static bool CanRunInParallel(const CVariant& request);
+    static void HandleParallel(const CVariant& batch,
+                               size_t begin,
+                               size_t end,
+                               std::vector<std::optional<CVariant>>& responses,
+                               ITransportLayer* transport,
+                               IClient* client);
     static inline bool IsProperJSONRPC(const CVariant& inputroot);
 
     inline static void BuildResponse(const CVariant& request, JSONRPC_STATUS code, const CVariant& result, CVariant& response);
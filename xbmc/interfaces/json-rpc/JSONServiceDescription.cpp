@@ -69,6 +69,8 @@ JsonRpcMethodMap CJSONServiceDescription::m_methodMaps[] = {
   { "Player.SetViewMode",                           CPlayerOperations::SetViewMode },
   { "Player.GetViewMode",                           CPlayerOperations::GetViewMode },
   { "Player.Rotate",                                CPlayerOperations::Rotate },
+  { "Player.SetSyncGroup",                          CPlayerOperations::SetSyncGroup },
+  { "Player.GetSyncGroup",                          CPlayerOperations::GetSyncGroup },
 
   { "Player.Open",                                  CPlayerOperations::Open },
   { "Player.GoTo",                                  CPlayerOperations::GoTo },
@@ -98,6 +100,8 @@ JsonRpcMethodMap CJSONServiceDescription::m_methodMaps[] = {
   { "Files.SetFileDetails",                         CFileOperations::SetFileDetails },
   { "Files.PrepareDownload",                        CFileOperations::PrepareDownload },
   { "Files.Download",                               CFileOperations::Download },
+  { "Files.GetCacheStatistics",                     CFileOperations::GetCacheStatistics },
+  { "Files.TestSpeed",                              CFileOperations::TestSpeed },
 
 // Music Library
   { "AudioLibrary.GetProperties",                   CAudioLibrary::GetProperties },
@@ -123,6 +127,7 @@ JsonRpcMethodMap CJSONServiceDescription::m_methodMaps[] = {
   { "AudioLibrary.RefreshAlbum",                    CAudioLibrary::RefreshAlbum },
   { "AudioLibrary.Scan",                            CAudioLibrary::Scan },
   { "AudioLibrary.Export",                          CAudioLibrary::Export },
+  { "AudioLibrary.GetChanges",                     CAudioLibrary::GetChanges },
   { "AudioLibrary.Clean",                           CAudioLibrary::Clean },
 
 // Video Library
@@ -162,6 +167,7 @@ JsonRpcMethodMap CJSONServiceDescription::m_methodMaps[] = {
   { "VideoLibrary.RemoveMusicVideo",                CVideoLibrary::RemoveMusicVideo },
   { "VideoLibrary.Scan",                            CVideoLibrary::Scan },
   { "VideoLibrary.Export",                          CVideoLibrary::Export },
+  { "VideoLibrary.GetChanges",                     CVideoLibrary::GetChanges },
   { "VideoLibrary.Clean",                           CVideoLibrary::Clean },
 
 // Addon operations
@@ -256,7 +262,9 @@ JsonRpcMethodMap CJSONServiceDescription::m_methodMaps[] = {
 
 // XBMC operations
   { "XBMC.GetInfoLabels",                           CXBMCOperations::GetInfoLabels },
-  { "XBMC.GetInfoBooleans",                         CXBMCOperations::GetInfoBooleans }
+  { "XBMC.GetInfoBooleans",                         CXBMCOperations::GetInfoBooleans },
+  { "XBMC.SetTracing",                              CXBMCOperations::SetTracing },
+  { "XBMC.GetTrace",                                CXBMCOperations::GetTrace }
 };
 
 // clang-format on
@@ -612,6 +620,8 @@ bool JSONSchemaTypeDefinition::Parse(const CVariant &value, bool isParameter /*
       if (approved)
         enums.push_back(*enumItr);
     }
+
+    HashEnums();
   }
 
   if (type != ObjectValue)
@@ -844,7 +854,28 @@ JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value,
     }
 
     // If every array element is unique we need to check each one
-    if (uniqueItems)
+    // Arrays of strings (like "properties") are checked through a hash set
+    bool allStrings = uniqueItems;
+    for (unsigned int index = 0; allStrings && index < outputValue.size(); index++)
+      allStrings = outputValue[index].isString();
+
+    if (allStrings)
+    {
+      std::unordered_set<std::string> seen;
+      seen.reserve(outputValue.size());
+      for (unsigned int index = 0; index < outputValue.size(); index++)
+      {
+        if (!seen.insert(outputValue[index].asString()).second)
+        {
+          CLog::Log(LOGDEBUG, "JSONRPC: Not unique array element at index {} in type {}", index,
+                    name);
+          errorMessage = StringUtils::Format("Array element at index {} is not unique", index);
+          errorData["message"] = errorMessage.c_str();
+          return InvalidParams;
+        }
+      }
+    }
+    else if (uniqueItems)
     {
       for (unsigned int checkingIndex = 0; checkingIndex < outputValue.size(); checkingIndex++)
       {
@@ -951,12 +982,18 @@ JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value,
   if (!enums.empty())
   {
     bool valid = false;
-    for (const auto& enumItr : enums)
+    // Strings can only ever match a string enum value
+    if (value.isString())
+      valid = stringEnums.contains(value.asString());
+    else
     {
-      if (enumItr == value)
+      for (const auto& enumItr : enums)
       {
-        valid = true;
-        break;
+        if (enumItr == value)
+        {
+          valid = true;
+          break;
+        }
       }
     }
 
@@ -1194,6 +1231,16 @@ void JSONSchemaTypeDefinition::Print(bool isParameter, bool isGlobal, bool print
   }
 }
 
+void JSONSchemaTypeDefinition::HashEnums()
+{
+  stringEnums.clear();
+  for (const auto& enumItr : enums)
+  {
+    if (enumItr.isString())
+      stringEnums.insert(enumItr.asString());
+  }
+}
+
 void JSONSchemaTypeDefinition::ResolveReference()
 {
   // Check and set the reference type before recursing
@@ -1727,6 +1774,7 @@ bool CJSONServiceDescription::AddEnum(const std::string &name, const std::vector
       return false;
   }
   definition->enums.insert(definition->enums.begin(), values.begin(), values.end());
+  definition->HashEnums();
 
   int schemaType = (int)AnyValue;
   for (unsigned int index = 0; index < types.size(); index++)
@@ -1978,6 +2026,17 @@ JSONRPC_STATUS CJSONServiceDescription::CheckCall(const char* const method, cons
   return MethodNotFound;
 }
 
+bool CJSONServiceDescription::GetPermission(const std::string& method,
+                                            OperationPermission& permission)
+{
+  CJsonRpcMethodMap::JsonRpcMethodIterator iter = m_actionMap.find(method);
+  if (iter == m_actionMap.end())
+    return false;
+
+  permission = iter->second.permission;
+  return true;
+}
+
 JSONSchemaTypeDefinitionPtr CJSONServiceDescription::GetType(const std::string &identification)
 {
   std::map<std::string, JSONSchemaTypeDefinitionPtr>::iterator iter = m_types.find(identification);
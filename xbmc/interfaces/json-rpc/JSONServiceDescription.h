@@ -14,6 +14,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 namespace JSONRPC
@@ -40,6 +41,7 @@ namespace JSONRPC
     JSONRPC_STATUS Check(const CVariant& value, CVariant& outputValue, CVariant& errorData) const;
     void Print(bool isParameter, bool isGlobal, bool printDefault, bool printDescriptions, CVariant &output) const;
     void ResolveReference();
+    void HashEnums();
 
     std::string missingReference;
 
@@ -147,6 +149,12 @@ namespace JSONRPC
      */
     std::vector<CVariant> enums;
 
+    /*!
+     \brief The string values of "enums" for
+     lookups without comparing every value
+     */
+    std::unordered_set<std::string> stringEnums;
+
     /*!
      \brief List of possible values in an array
      */
@@ -385,6 +393,14 @@ namespace JSONRPC
      */
     static JSONRPC_STATUS CheckCall(const char* method, const CVariant &requestParameters, ITransportLayer *transport, IClient *client, bool notification, MethodCall &methodCall, CVariant &outputParameters);
 
+    /*!
+     \brief Get the permission needed to call a method
+     \param method Lower case name of the method
+     \param permission Permission needed to call the method
+     \return false if there is no such method
+     */
+    static bool GetPermission(const std::string& method, OperationPermission& permission);
+
     static JSONSchemaTypeDefinitionPtr GetType(const std::string &identification);
 
     static void ResolveReferences();
@@ -146,7 +146,7 @@ JSONRPC_STATUS CPVROperations::GetChannels(const std::string& method,
 
   CFileItemList channels;
   const auto groupMembers = channelGroup->GetMembers(CPVRChannelGroup::Include::ONLY_VISIBLE);
-  for (const auto& groupMember : groupMembers)
+  for (const auto& groupMember : *groupMembers)
   {
     channels.Add(std::make_shared<CFileItem>(groupMember));
   }
@@ -408,7 +408,7 @@ void CPVROperations::FillChannelGroupDetails(
   {
     CFileItemList channels;
     const auto groupMembers{channelGroup->GetMembers(CPVRChannelGroup::Include::ONLY_VISIBLE)};
-    for (const auto& groupMember : groupMembers)
+    for (const auto& groupMember : *groupMembers)
     {
       channels.Add(std::make_shared<CFileItem>(groupMember));
     }
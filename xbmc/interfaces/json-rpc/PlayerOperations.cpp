@@ -32,6 +32,8 @@
 #include "messaging/ApplicationMessenger.h"
 #include "music/MusicDatabase.h"
 #include "music/MusicFileItemClassify.h"
+#include "network/Network.h"
+#include "network/PlaybackSync.h"
 #include "pictures/SlideShowDelegator.h"
 #include "pvr/PVRManager.h"
 #include "pvr/PVRPlaybackState.h"
@@ -821,6 +823,71 @@ JSONRPC_STATUS CPlayerOperations::Rotate(const std::string &method, ITransportLa
   }
 }
 
+JSONRPC_STATUS CPlayerOperations::SetSyncGroup(const std::string& method,
+                                               ITransportLayer* transport,
+                                               IClient* client,
+                                               const CVariant& parameterObject,
+                                               CVariant& result)
+{
+  const auto playbackSync = CServiceBroker::GetPlaybackSync();
+  if (!playbackSync)
+    return FailedToExecute;
+
+  const std::string role = parameterObject["role"].asString();
+  const int port = static_cast<int>(parameterObject["port"].asInteger());
+  if (role == "master")
+  {
+    // only answer on the LAN, not on every interface
+    const CNetworkInterface* iface = CServiceBroker::GetNetwork().GetFirstConnectedInterface();
+    if (!iface)
+      return FailedToExecute;
+    return playbackSync->SetMaster(iface->GetCurrentIPAddress(), port) ? ACK : FailedToExecute;
+  }
+
+  if (role == "follower")
+  {
+    const std::string master = parameterObject["master"].asString();
+    if (master.empty())
+      return InvalidParams;
+    return playbackSync->SetFollower(master, port) ? ACK : FailedToExecute;
+  }
+
+  playbackSync->Leave();
+  return ACK;
+}
+
+JSONRPC_STATUS CPlayerOperations::GetSyncGroup(const std::string& method,
+                                               ITransportLayer* transport,
+                                               IClient* client,
+                                               const CVariant& parameterObject,
+                                               CVariant& result)
+{
+  const auto playbackSync = CServiceBroker::GetPlaybackSync();
+  if (!playbackSync)
+    return FailedToExecute;
+
+  const CPlaybackSync::Status status = playbackSync->GetStatus();
+  switch (status.role)
+  {
+    case CPlaybackSync::Role::MASTER:
+      result["role"] = "master";
+      break;
+    case CPlaybackSync::Role::FOLLOWER:
+      result["role"] = "follower";
+      break;
+    default:
+      result["role"] = "none";
+      break;
+  }
+  result["master"] = status.master;
+  result["port"] = status.port;
+  result["synchronised"] = status.synchronised;
+  result["offset"] = status.offset / 1000.0;
+  result["roundtrip"] = status.roundTrip / 1000.0;
+  result["error"] = status.error / 1000.0;
+  return OK;
+}
+
 JSONRPC_STATUS CPlayerOperations::Open(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant &parameterObject, CVariant &result)
 {
   CVariant options = parameterObject["options"];
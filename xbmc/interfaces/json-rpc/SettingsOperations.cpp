@@ -8,10 +8,12 @@
 
 #include "SettingsOperations.h"
 
+#include "GUIInfoManager.h"
 #include "ServiceBroker.h"
 #include "addons/Addon.h"
 #include "addons/Skin.h"
 #include "addons/addoninfo/AddonInfo.h"
+#include "guilib/GUIComponent.h"
 #include "guilib/LocalizeStrings.h"
 #include "settings/SettingAddon.h"
 #include "settings/SettingControl.h"
@@ -901,5 +903,7 @@ JSONRPC_STATUS CSettingsOperations::SetSkinSettingValue(const std::string& metho
     return InvalidParams;
   }
 
+  CServiceBroker::GetGUI()->GetInfoManager().InvalidateSkinSettings();
+
   return OK;
 }
@@ -1003,6 +1003,19 @@ JSONRPC_STATUS CVideoLibrary::Export(const std::string &method, ITransportLayer
   return ACK;
 }
 
+JSONRPC_STATUS CVideoLibrary::GetChanges(const std::string& method,
+                                         ITransportLayer* transport,
+                                         IClient* client,
+                                         const CVariant& parameterObject,
+                                         CVariant& result)
+{
+  CVideoDatabase videodatabase;
+  if (!videodatabase.Open())
+    return InternalError;
+
+  return HandleChanges(videodatabase, parameterObject, result);
+}
+
 JSONRPC_STATUS CVideoLibrary::Clean(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant &parameterObject, CVariant &result)
 {
   std::string directory = parameterObject["directory"].asString();
@@ -11,6 +11,7 @@
 #include "ServiceBroker.h"
 #include "messaging/ApplicationMessenger.h"
 #include "powermanagement/PowerManager.h"
+#include "utils/Trace.h"
 #include "utils/Variant.h"
 
 using namespace JSONRPC;
@@ -86,3 +87,19 @@ JSONRPC_STATUS CXBMCOperations::GetInfoBooleans(const std::string &method, ITran
 
   return OK;
 }
+
+JSONRPC_STATUS CXBMCOperations::SetTracing(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant &parameterObject, CVariant &result)
+{
+  if (parameterObject["enabled"].asBoolean())
+    CTrace::Start(static_cast<size_t>(parameterObject["eventsperthread"].asUnsignedInteger()));
+  else
+    CTrace::Stop();
+
+  return ACK;
+}
+
+JSONRPC_STATUS CXBMCOperations::GetTrace(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant &parameterObject, CVariant &result)
+{
+  CTrace::Export(result);
+  return OK;
+}
@@ -39,6 +39,19 @@ namespace XBMCAddon
       return ret;
     }
 
+    unsigned long File::readinto(XbmcCommons::WritableBuffer& buffer)
+    {
+      DelayedCallGuard dg(languageHook);
+      while (buffer.remaining() > 0)
+      {
+        ssize_t bytesRead = file->Read(buffer.curPosition(), buffer.remaining());
+        if (bytesRead <= 0) // failure or EOF, return whatever we have already
+          break;
+        buffer.forward(bytesRead);
+      }
+      return static_cast<unsigned long>(buffer.position());
+    }
+
     bool File::write(XbmcCommons::Buffer& buffer)
     {
       DelayedCallGuard dg(languageHook);
@@ -149,6 +149,45 @@ namespace XBMCAddon
       XbmcCommons::Buffer readBytes(unsigned long numBytes = 0);
 #endif
 
+#ifdef DOXYGEN_SHOULD_USE_THIS
+      ///
+      /// \ingroup python_file
+      /// @brief \python_func{ readinto(buffer) }
+      /// Read bytes from file into an existing buffer.
+      ///
+      /// @param buffer             bytearray, memoryview or any other
+      ///                               writable bytes-like object to fill
+      /// @return                       Number of bytes read, less than the
+      ///                               size of the buffer only at the end of
+      ///                               the file
+      ///
+      /// @note The data is read straight into the memory of the buffer, so
+      ///       reusing one buffer for all reads, like a proxy streaming a file
+      ///       does, avoids allocating and copying a new bytearray per read.
+      ///
+      ///
+      ///-----------------------------------------------------------------------
+      /// @python_v22 New function added.
+      ///
+      /// **Example:**
+      /// ~~~~~~~~~~~~~{.py}
+      /// ..
+      /// buffer = bytearray(65536)
+      /// view = memoryview(buffer)
+      /// with xbmcvfs.File(file) as f:
+      ///   while True:
+      ///     size = f.readinto(buffer)
+      ///     if size == 0:
+      ///       break
+      ///     sock.sendall(view[:size])
+      /// ..
+      /// ~~~~~~~~~~~~~
+      ///
+      readinto(...);
+#else
+      unsigned long readinto(XbmcCommons::WritableBuffer& buffer);
+#endif
+
 #ifdef DOXYGEN_SHOULD_USE_THIS
       ///
       /// \ingroup python_file
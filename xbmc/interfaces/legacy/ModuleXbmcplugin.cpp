@@ -10,8 +10,10 @@
 
 #include "FileItem.h"
 #include "FileItemList.h"
+#include "LanguageHook.h"
 #include "SortFileItem.h"
 #include "filesystem/PluginDirectory.h"
+#include "utils/StringUtils.h"
 
 namespace XBMCAddon
 {
@@ -50,6 +52,57 @@ namespace XBMCAddon
       return XFILE::CPluginDirectory::AddItems(handle, &fitems, totalItems);
     }
 
+    bool addDirectoryItemsFromDicts(int handle,
+                                    const std::vector<Tuple<String, Properties, bool>>& items,
+                                    int totalItems)
+    {
+      CFileItemList fitems;
+      for (const auto& entry : items)
+      {
+        const Properties& dictionary = entry.second();
+        const auto get = [&dictionary](const char* key)
+        {
+          const auto it = dictionary.find(key);
+          return it != dictionary.end() ? it->second : emptyString;
+        };
+
+        // offscreen, so none of the setters needs the gui lock
+        AddonClass::Ref<xbmcgui::ListItem> listItem(
+            new xbmcgui::ListItem(get("label"), get("label2"), entry.first(), true));
+        listItem->item->SetFolder(entry.GetNumValuesSet() > 2 ? entry.third() : false);
+
+        xbmcgui::InfoLabelDict infoLabels;
+        Properties art;
+        Properties properties;
+        for (const auto& [key, value] : dictionary)
+        {
+          if (StringUtils::StartsWith(key, "info."))
+            infoLabels[key.substr(5)].former() = value;
+          else if (StringUtils::StartsWith(key, "art."))
+            art.emplace(key.substr(4), value);
+          else if (key == "mimetype")
+            listItem->item->SetMimeType(value);
+          else if (key != "label" && key != "label2" && key != "infotype")
+            properties.emplace(key, value);
+        }
+
+        if (!infoLabels.empty())
+        {
+          const String infoType = get("infotype");
+          listItem->setInfo(infoType.empty() ? "video" : infoType.c_str(), infoLabels);
+        }
+        if (!art.empty())
+          listItem->setArt(art);
+        if (!properties.empty())
+          listItem->setProperties(properties);
+
+        fitems.Add(listItem->item);
+      }
+
+      DelayedCallGuard dg;
+      return XFILE::CPluginDirectory::AddItems(handle, &fitems, totalItems);
+    }
+
     void endOfDirectory(int handle, bool succeeded, bool updateListing,
                         bool cacheToDisc)
     {
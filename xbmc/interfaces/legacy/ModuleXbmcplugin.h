@@ -105,6 +105,57 @@ namespace XBMCAddon
                            int totalItems = 0);
 #endif
 
+#ifdef DOXYGEN_SHOULD_USE_THIS
+    ///
+    /// \ingroup python_xbmcplugin
+    /// @brief \python_func{ xbmcplugin.addDirectoryItemsFromDicts(handle, items[, totalItems]) }
+    /// Callback function to pass directory contents back to Kodi as a list of
+    /// plain dictionaries instead of ListItem objects.
+    ///
+    /// @param handle               integer - handle the plugin was started
+    ///                             with.
+    /// @param items                List - list of (url, dictionary[, isFolder])
+    ///                             as a tuple to add.
+    /// @param totalItems           [opt] integer - total number of items
+    ///                             that will be passed.(used for progressbar)
+    /// @return                     Returns a bool for successful completion.
+    ///
+    /// The dictionary of an item takes the following keys, all values are
+    /// strings:
+    /// | Key                | Description                                          |
+    /// |-------------------:|:-----------------------------------------------------|
+    /// | label              | The label of the item
+    /// | label2             | The second label of the item
+    /// | mimetype           | The mime type of the item
+    /// | infotype           | Type of the info labels: video (default), music, game or pictures
+    /// | info.<label>       | An info label, see \ref XBMCAddon::xbmcgui::ListItem::setInfo "setInfo()"
+    /// | art.<type>         | An image, see \ref XBMCAddon::xbmcgui::ListItem::setArt "setArt()"
+    ///
+    /// Any other key is set as a property of the item.
+    ///
+    /// @remark The items are built in one go without creating a ListItem
+    /// object for each of them, which is a lot faster for large lists. Use
+    /// addDirectoryItems() for items which need more than the above.
+    ///
+    ///
+    /// ------------------------------------------------------------------------
+    /// @python_v22 New function added.
+    ///
+    /// **Example:**
+    /// ~~~~~~~~~~~~~{.py}
+    /// ..
+    /// items = [(url, {'label': title, 'info.year': '2009', 'art.thumb': thumb}, False)]
+    /// xbmcplugin.addDirectoryItemsFromDicts(int(sys.argv[1]), items)
+    /// ..
+    /// ~~~~~~~~~~~~~
+    ///
+     addDirectoryItemsFromDicts(...);
+#else
+    bool addDirectoryItemsFromDicts(int handle,
+                                    const std::vector<Tuple<String, Properties, bool>>& items,
+                                    int totalItems = 0);
+#endif
+
 #ifdef DOXYGEN_SHOULD_USE_THIS
     ///
     /// \ingroup python_xbmcplugin
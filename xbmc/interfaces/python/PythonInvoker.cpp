@@ -46,6 +46,7 @@
 #include "XBPython.h"
 
 #include <cassert>
+#include <chrono>
 #include <iterator>
 
 #ifdef TARGET_WINDOWS
@@ -150,6 +151,8 @@ bool CPythonInvoker::execute(const std::string& script, std::vector<std::wstring
   std::string scriptDir = URIUtils::GetDirectory(realFilename);
   URIUtils::RemoveSlashAtEnd(scriptDir);
 
+  const auto startTime = std::chrono::steady_clock::now();
+
   // set m_threadState if it's not set.
   PyThreadState* l_threadState = nullptr;
   bool newInterp = false;
@@ -184,6 +187,8 @@ bool CPythonInvoker::execute(const std::string& script, std::vector<std::wstring
       l_threadState = m_threadState;
   }
 
+  const auto interpreterTime = std::chrono::steady_clock::now();
+
   // get the GIL
   PyEval_RestoreThread(l_threadState);
   if (newInterp)
@@ -321,7 +326,18 @@ bool CPythonInvoker::execute(const std::string& script, std::vector<std::wstring
         setState(InvokerStateRunning);
         XBMCAddon::Python::PyContext
             pycontext; // this is a guard class that marks this callstack as being in a python context
+        const auto initializedTime = std::chrono::steady_clock::now();
         executeScript(fp, realFilename, moduleDict);
+
+        using std::chrono::duration_cast, std::chrono::milliseconds;
+        CLog::Log(LOGDEBUG,
+                  "CPythonInvoker({}, {}): {} interpreter {} ms, initialization {} ms, "
+                  "script {} ms",
+                  GetId(), m_sourceFile, newInterp ? "new" : "reused",
+                  duration_cast<milliseconds>(interpreterTime - startTime).count(),
+                  duration_cast<milliseconds>(initializedTime - interpreterTime).count(),
+                  duration_cast<milliseconds>(std::chrono::steady_clock::now() - initializedTime)
+                      .count());
       }
       else
         CLog::Log(LOGERROR, "CPythonInvoker({}, {}): {} not found!", GetId(), m_sourceFile,
@@ -36,7 +36,9 @@
 
 XBPython::XBPython()
 {
-  CServiceBroker::GetAnnouncementManager()->AddAnnouncer(this);
+  // monitors of add-ons must not hold up any other announcer
+  CServiceBroker::GetAnnouncementManager()->AddAnnouncer(this, ANNOUNCEMENT::ANNOUNCE_ALL,
+                                                         ANNOUNCEMENT::AnnouncerQueue::COALESCE);
 
   CLog::Log(LOGDEBUG, "initializing python engine.");
   // Darwin packs .pyo files, we need PYTHONOPTIMIZE on in order to load them.
@@ -178,6 +178,20 @@ namespace PythonBindings
     void SetMessage(const std::string &exceptionType, const std::string &exceptionValue, const std::string &exceptionTraceback);
   };
 
+  /**
+   * Releases a buffer exported by a python object with PyObject_GetBuffer when
+   *  going out of scope.
+   */
+  struct PyBufferRelease
+  {
+    Py_buffer* view;
+
+    explicit PyBufferRelease(Py_buffer* view_) : view(view_) {}
+    PyBufferRelease(const PyBufferRelease&) = delete;
+    PyBufferRelease& operator=(const PyBufferRelease&) = delete;
+    ~PyBufferRelease() { PyBuffer_Release(view); }
+  };
+
   template<class T> struct PythonCompare
   {
     static inline int compare(PyObject* obj1, PyObject* obj2, const char* swigType, const char* methodNamespacePrefix, const char* methodNameForErrorString)
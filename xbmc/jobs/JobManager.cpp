@@ -10,10 +10,12 @@
 
 #include "jobs/IJobCallback.h"
 #include "threads/Thread.h"
+#include "utils/Trace.h"
 #include "utils/log.h"
 
 #include <algorithm>
 #include <chrono>
+#include <iterator>
 #include <mutex>
 #include <stdexcept>
 #include <thread>
@@ -44,7 +46,7 @@ public:
 
   void Process() override
   {
-    SetPriority(ThreadPriority::LOWEST);
+    SetThreadClass(ThreadClass::BACKGROUND);
     while (true)
     {
       // request an item from our manager (this call is blocking)
@@ -55,6 +57,8 @@ public:
       bool success{false};
       try
       {
+        CTraceZone zone(*job->GetType() ? job->GetType() : "CJob::DoWork");
+        CTrace::FlowEnd("CJobManager::AddJob", reinterpret_cast<uintptr_t>(job));
         success = job->DoWork();
       }
       catch (...)
@@ -110,6 +114,18 @@ void CJobManager::CancelJobs()
                           });
     m_jobQueue[priority].clear();
   }
+  m_queued = 0;
+
+  // and the ones waiting for others
+  std::ranges::for_each(m_blocked,
+                        [](BlockedItem& item)
+                        {
+                          if (item.work.GetCallback())
+                            item.work.GetCallback()->OnJobAbort(item.work.GetId(),
+                                                                item.work.GetJob());
+                          item.work.FreeJob();
+                        });
+  m_blocked.clear();
 
   // cancel any callbacks on jobs still processing
   std::ranges::for_each(m_processing,
@@ -132,13 +148,44 @@ void CJobManager::CancelJobs()
 
 unsigned int CJobManager::AddJob(CJob* job, IJobCallback* callback, CJob::PRIORITY priority)
 {
+  return AddJob(job, callback, priority, {});
+}
+
+unsigned int CJobManager::AddJob(CJob* job,
+                                 IJobCallback* callback,
+                                 CJob::PRIORITY priority,
+                                 const std::vector<unsigned int>& dependencies)
+{
+  CTraceZone zone("CJobManager::AddJob");
+  std::unique_lock lock(m_section);
+  return QueueJob(job, callback, priority, dependencies);
+}
+
+std::vector<unsigned int> CJobManager::AddJobs(const std::vector<CJob*>& jobs,
+                                               IJobCallback* callback,
+                                               CJob::PRIORITY priority)
+{
+  CTraceZone zone("CJobManager::AddJobs");
+  std::vector<unsigned int> ids;
+  ids.reserve(jobs.size());
+
   std::unique_lock lock(m_section);
+  for (CJob* job : jobs)
+    ids.emplace_back(QueueJob(job, callback, priority, {}));
+  return ids;
+}
 
+unsigned int CJobManager::QueueJob(CJob* job,
+                                   IJobCallback* callback,
+                                   CJob::PRIORITY priority,
+                                   const std::vector<unsigned int>& dependencies)
+{
   // Check if we are not running or have this job already.  In either case, we're done.
   if (!m_running ||
       std::ranges::find_if(m_jobQueue[priority], [job](const CWorkItem& wi)
                            { return wi.GetJob()->Equals(job); }) != m_jobQueue[priority].cend())
   {
+    m_jobsRejected++;
     delete job;
     return 0;
   }
@@ -150,12 +197,79 @@ unsigned int CJobManager::AddJob(CJob* job, IJobCallback* callback, CJob::PRIORI
 
   // create a work item for this job
   CWorkItem work(job, m_jobCounter, priority, callback);
+  m_jobsAdded++;
+  CTrace::FlowBegin("CJobManager::AddJob", reinterpret_cast<uintptr_t>(job));
+
+  // hold it back while any of its dependencies is still around
+  std::vector<unsigned int> waitingFor;
+  std::ranges::copy_if(dependencies, std::back_inserter(waitingFor),
+                       [this](unsigned int id) { return IsPending(id); });
+  if (!waitingFor.empty())
+  {
+    m_blocked.emplace_back(BlockedItem{work, std::move(waitingFor)});
+    return work.GetId();
+  }
+
   m_jobQueue[priority].emplace_back(work);
+  m_peakQueued = std::max(m_peakQueued, ++m_queued);
+  CTrace::Counter("CJobManager queued", static_cast<int64_t>(m_queued));
 
   StartWorkers(priority);
   return work.GetId();
 }
 
+bool CJobManager::IsPending(unsigned int jobID) const
+{
+  const auto matches = [jobID](const CWorkItem& wi) { return wi.GetId() == jobID; };
+
+  return std::ranges::any_of(m_jobQueue,
+                             [&matches](const JobQueue& queue)
+                             { return std::ranges::any_of(queue, matches); }) ||
+         std::ranges::any_of(m_processing, matches) ||
+         std::ranges::any_of(m_blocked, [&matches](const BlockedItem& item)
+                             { return matches(item.work); });
+}
+
+void CJobManager::ReleaseDependents(unsigned int jobID)
+{
+  std::vector<CWorkItem> ready;
+  std::erase_if(m_blocked,
+                [jobID, &ready](BlockedItem& item)
+                {
+                  std::erase(item.waitingFor, jobID);
+                  if (!item.waitingFor.empty())
+                    return false;
+                  ready.emplace_back(item.work);
+                  return true;
+                });
+
+  for (const CWorkItem& work : ready)
+  {
+    m_jobQueue[work.GetPriority()].emplace_back(work);
+    m_peakQueued = std::max(m_peakQueued, ++m_queued);
+    StartWorkers(work.GetPriority());
+  }
+}
+
+void CJobManager::CancelDependents(unsigned int jobID)
+{
+  std::vector<CWorkItem> cancelled;
+  std::erase_if(m_blocked,
+                [jobID, &cancelled](const BlockedItem& item)
+                {
+                  if (std::ranges::find(item.waitingFor, jobID) == item.waitingFor.cend())
+                    return false;
+                  cancelled.emplace_back(item.work);
+                  return true;
+                });
+
+  for (CWorkItem& work : cancelled)
+  {
+    work.FreeJob();
+    CancelDependents(work.GetId());
+  }
+}
+
 void CJobManager::CancelJob(unsigned int jobID)
 {
   std::unique_lock lock(m_section);
@@ -170,14 +284,30 @@ void CJobManager::CancelJob(unsigned int jobID)
     {
       i->FreeJob();
       m_jobQueue[priority].erase(i);
+      m_queued--;
+      CancelDependents(jobID);
       return;
     }
   }
+  // or if it is waiting for other jobs
+  const auto blocked = std::ranges::find_if(
+      m_blocked, [jobID](const auto& item) { return item.work.GetId() == jobID; });
+  if (blocked != m_blocked.cend())
+  {
+    CWorkItem work(blocked->work);
+    m_blocked.erase(blocked);
+    work.FreeJob();
+    CancelDependents(jobID);
+    return;
+  }
   // or if we're processing it
   const auto it =
       std::ranges::find_if(m_processing, [jobID](const auto& wi) { return wi.GetId() == jobID; });
   if (it != m_processing.cend())
+  {
     it->SetCallback(nullptr); // job is in progress, so only thing to do is to remove callback
+    CancelDependents(jobID);
+  }
 }
 
 void CJobManager::StartWorkers(CJob::PRIORITY priority)
@@ -197,6 +327,7 @@ void CJobManager::StartWorkers(CJob::PRIORITY priority)
 
   // everyone is busy - we need more workers
   m_workers.emplace_back(new CJobWorker(*this));
+  m_workersStarted++;
 }
 
 CJob* CJobManager::PopJob()
@@ -214,6 +345,7 @@ CJob* CJobManager::PopJob()
       // pop the job off the queue
       const CWorkItem job{m_jobQueue[priority].front()};
       m_jobQueue[priority].pop_front();
+      m_queued--;
 
       // add to the processing vector
       m_processing.emplace_back(job);
@@ -322,11 +454,32 @@ void CJobManager::OnJobComplete(bool success, CJob* job)
     const auto j = std::ranges::find_if(m_processing, JobFinder(job));
     if (j != m_processing.cend())
       m_processing.erase(j);
+    m_jobsCompleted++;
+    if (!m_blocked.empty())
+      ReleaseDependents(item.GetId());
     lock.unlock();
     item.FreeJob();
   }
 }
 
+CJobManager::Stats CJobManager::GetStats() const
+{
+  std::unique_lock lock(m_section);
+
+  Stats stats;
+  for (size_t priority = 0; priority < m_jobQueue.size(); ++priority)
+    stats.queued[priority] = m_jobQueue[priority].size();
+  stats.peakQueued = m_peakQueued;
+  stats.processing = m_processing.size();
+  stats.blocked = m_blocked.size();
+  stats.workers = m_workers.size();
+  stats.added = m_jobsAdded;
+  stats.rejected = m_jobsRejected;
+  stats.completed = m_jobsCompleted;
+  stats.workersStarted = m_workersStarted;
+  return stats;
+}
+
 void CJobManager::RemoveWorker(const CJobWorker* worker)
 {
   std::unique_lock lock(m_section);
@@ -14,6 +14,7 @@
 #include "threads/Event.h"
 
 #include <array>
+#include <stdint.h>
 #include <queue>
 #include <string>
 #include <vector>
@@ -34,6 +35,22 @@ class IJobCallback;
 class CJobManager final
 {
 public:
+  /*!
+   \brief Snapshot of the scheduler state, see GetStats()
+   */
+  struct Stats
+  {
+    std::array<size_t, CJob::PRIORITY_DEDICATED + 1> queued{}; /**< pending jobs per priority */
+    size_t peakQueued{0}; /**< highest number of pending jobs seen at once */
+    size_t processing{0}; /**< jobs currently being worked on */
+    size_t blocked{0}; /**< jobs waiting for their dependencies */
+    size_t workers{0}; /**< worker threads alive */
+    uint64_t added{0}; /**< jobs accepted by AddJob() */
+    uint64_t rejected{0}; /**< jobs dropped by AddJob() as duplicates or while stopped */
+    uint64_t completed{0}; /**< jobs that finished processing */
+    uint64_t workersStarted{0}; /**< worker threads spawned */
+  };
+
   CJobManager() = default;
 
   /*!
@@ -58,6 +75,36 @@ public:
                       IJobCallback* callback,
                       CJob::PRIORITY priority = CJob::PRIORITY_LOW);
 
+  /*!
+   \brief Add a job that must not start before other jobs have finished.
+   The job is held back until every job listed in dependencies has completed, successfully or
+   not, and is then queued at the given priority. Ids of jobs that already finished are ignored.
+   Cancelling a job, or CancelJobs(), also cancels every job waiting on it.
+   \param job a pointer to the job to add. The job should be subclassed from CJob
+   \param callback a pointer to an IJobCallback instance to receive job progress and completion notices.
+   \param priority the priority that this job should run at.
+   \param dependencies ids of the jobs, retrieved previously from AddJob(), to wait for.
+   \return On success, a unique identifier for this job, 0 otherwise.
+   \sa AddJob(), CancelJob()
+   */
+  unsigned int AddJob(CJob* job,
+                      IJobCallback* callback,
+                      CJob::PRIORITY priority,
+                      const std::vector<unsigned int>& dependencies);
+
+  /*!
+   \brief Add several jobs sharing a callback and priority at once.
+   Equivalent to calling AddJob() for each job in order, but takes the manager lock only once.
+   \param jobs the jobs to add, ownership is taken for all of them.
+   \param callback a pointer to an IJobCallback instance to receive job progress and completion notices.
+   \param priority the priority that these jobs should run at.
+   \return the identifier for each job in the same order, 0 for jobs that could not be added.
+   \sa AddJob()
+   */
+  std::vector<unsigned int> AddJobs(const std::vector<CJob*>& jobs,
+                                    IJobCallback* callback,
+                                    CJob::PRIORITY priority = CJob::PRIORITY_LOW);
+
   /*!
    \brief Add a function f to this job manager for asynchronous execution.
    \param f the function to add.
@@ -159,6 +206,11 @@ public:
    */
   CJob* GetNextJob();
 
+  /*!
+   \brief Get queue depth and throughput counters, mainly for diagnostics
+   */
+  Stats GetStats() const;
+
 private:
   CJobManager(const CJobManager&) = delete;
   CJobManager const& operator=(CJobManager const&) = delete;
@@ -197,6 +249,20 @@ private:
     CJob::PRIORITY m_priority{CJob::PRIORITY::PRIORITY_LOW};
   };
 
+  struct BlockedItem
+  {
+    CWorkItem work;
+    std::vector<unsigned int> waitingFor;
+  };
+
+  unsigned int QueueJob(CJob* job,
+                        IJobCallback* callback,
+                        CJob::PRIORITY priority,
+                        const std::vector<unsigned int>& dependencies);
+  bool IsPending(unsigned int jobID) const;
+  void ReleaseDependents(unsigned int jobID);
+  void CancelDependents(unsigned int jobID);
+
   /*! \brief Pop a job off the job queue and add to the processing queue ready to process
    \return the job to process, nullptr if no jobs are available
    */
@@ -207,6 +273,12 @@ private:
   static unsigned int GetMaxWorkers(CJob::PRIORITY priority);
 
   unsigned int m_jobCounter{0};
+  size_t m_queued{0};
+  size_t m_peakQueued{0};
+  uint64_t m_jobsAdded{0};
+  uint64_t m_jobsRejected{0};
+  uint64_t m_jobsCompleted{0};
+  uint64_t m_workersStarted{0};
 
   using JobQueue = std::deque<CWorkItem>;
   using Processing = std::vector<CWorkItem>;
@@ -215,6 +287,7 @@ private:
   std::array<JobQueue, CJob::PRIORITY_DEDICATED + 1> m_jobQueue;
   bool m_pauseJobs{false};
   Processing m_processing;
+  std::vector<BlockedItem> m_blocked;
   Workers m_workers;
 
   mutable CCriticalSection m_section;
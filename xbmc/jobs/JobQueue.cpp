@@ -58,6 +58,8 @@ void CJobQueue::CancelJob(const CJob* job)
   {
     i->CancelJob();
     m_processing.erase(i);
+    // the cancelled job won't report back, so its slot has to be handed on here
+    QueueNextJob();
     return;
   }
   const auto j = std::ranges::find_if(m_jobQueue, JobFinder(job));
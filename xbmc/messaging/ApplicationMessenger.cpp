@@ -14,6 +14,7 @@
 #include "utils/log.h"
 #include "windowing/GraphicContext.h"
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
 #include <utility>
@@ -60,27 +61,19 @@ void CApplicationMessenger::Cleanup()
 {
   std::unique_lock lock(m_critSection);
 
-  while (!m_vecMessages.empty())
+  for (const ThreadMessage& msg : m_vecMessages)
   {
-    ThreadMessage* pMsg = m_vecMessages.front();
-
-    if (pMsg->waitEvent)
-      pMsg->waitEvent->Set();
-
-    delete pMsg;
-    m_vecMessages.pop();
+    if (msg.waitEvent)
+      msg.waitEvent->Set();
   }
+  m_vecMessages.clear();
 
-  while (!m_vecWindowMessages.empty())
+  for (const ThreadMessage& msg : m_vecWindowMessages)
   {
-    ThreadMessage* pMsg = m_vecWindowMessages.front();
-
-    if (pMsg->waitEvent)
-      pMsg->waitEvent->Set();
-
-    delete pMsg;
-    m_vecWindowMessages.pop();
+    if (msg.waitEvent)
+      msg.waitEvent->Set();
   }
+  m_vecWindowMessages.clear();
 }
 
 int CApplicationMessenger::SendMsg(ThreadMessage&& message, bool wait)
@@ -90,13 +83,13 @@ int CApplicationMessenger::SendMsg(ThreadMessage&& message, bool wait)
 
   if (wait)
   {
-    //Initialize result here as it's not needed for posted messages
-    message.result = std::make_shared<int>(-1);
     // check that we're not being called from our application thread, else we'll be waiting
     // forever!
     if (m_guiThreadId != CThread::GetCurrentThreadId())
     {
+      // shared with the message, it may still be handled after the sender stopped waiting
       message.waitEvent = std::make_shared<CEvent>(true);
+      message.result = std::make_shared<int>(-1);
       waitEvent = message.waitEvent;
       result = message.result;
     }
@@ -104,6 +97,7 @@ int CApplicationMessenger::SendMsg(ThreadMessage&& message, bool wait)
     {
       //OutputDebugString("Attempting to wait on a SendMessage() from our application thread will cause lockup!\n");
       //OutputDebugString("Sending immediately\n");
+      message.result = std::make_shared<int>(-1);
       ProcessMessage(&message);
       return *message.result;
     }
@@ -113,14 +107,29 @@ int CApplicationMessenger::SendMsg(ThreadMessage&& message, bool wait)
   if (m_bStop)
     return -1;
 
-  ThreadMessage* msg = new ThreadMessage(std::move(message));
-
   std::unique_lock lock(m_critSection);
 
-  if (msg->dwMessage == TMSG_GUI_MESSAGE)
-    m_vecWindowMessages.push(msg);
+  if (message.dwMessage == TMSG_GUI_MESSAGE)
+  {
+    // the same refresh queued already is replaced, it's handled once after the messages queued
+    // since. Nobody may be waiting for the replaced one.
+    const auto& msg = *static_cast<const CGUIMessage*>(message.lpVoid);
+    const auto repeated = std::ranges::find_if(
+        m_vecWindowMessages,
+        [&message, &msg](const ThreadMessage& queued)
+        {
+          return !queued.waitEvent && queued.param1 == message.param1 &&
+                 msg.IsRepeatOf(*static_cast<CGUIMessage*>(queued.lpVoid));
+        });
+    if (repeated != m_vecWindowMessages.end())
+    {
+      delete static_cast<CGUIMessage*>(repeated->lpVoid);
+      m_vecWindowMessages.erase(repeated);
+    }
+    m_vecWindowMessages.emplace_back(std::move(message));
+  }
   else
-    m_vecMessages.push(msg);
+    m_vecMessages.emplace_back(std::move(message));
   lock.unlock(); // this releases the lock on the vec of messages and
       //   allows the ProcessMessage to execute and therefore
       //   delete the message itself. Therefore any access
@@ -204,21 +213,20 @@ void CApplicationMessenger::ProcessMessages()
   std::unique_lock lock(m_critSection);
   while (!m_vecMessages.empty())
   {
-    ThreadMessage* pMsg = m_vecMessages.front();
     //first remove the message from the queue, else the message could be processed more then once
-    m_vecMessages.pop();
+    ThreadMessage msg = std::move(m_vecMessages.front());
+    m_vecMessages.pop_front();
 
     //Leave here as the message might make another
     //thread call processmessages or sendmessage
 
-    std::shared_ptr<CEvent> waitEvent = pMsg->waitEvent;
+    std::shared_ptr<CEvent> waitEvent = msg.waitEvent;
     lock.unlock(); // <- see the large comment in SendMessage ^
 
-    ProcessMessage(pMsg);
+    ProcessMessage(&msg);
 
     if (waitEvent)
       waitEvent->Set();
-    delete pMsg;
 
     lock.lock();
   }
@@ -253,19 +261,18 @@ void CApplicationMessenger::ProcessWindowMessages()
   //message type is window, process window messages
   while (!m_vecWindowMessages.empty())
   {
-    ThreadMessage* pMsg = m_vecWindowMessages.front();
     //first remove the message from the queue, else the message could be processed more then once
-    m_vecWindowMessages.pop();
+    ThreadMessage msg = std::move(m_vecWindowMessages.front());
+    m_vecWindowMessages.pop_front();
 
     // leave here in case we make more thread messages from this one
 
-    std::shared_ptr<CEvent> waitEvent = pMsg->waitEvent;
+    std::shared_ptr<CEvent> waitEvent = msg.waitEvent;
     lock.unlock(); // <- see the large comment in SendMessage ^
 
-    ProcessMessage(pMsg);
+    ProcessMessage(&msg);
     if (waitEvent)
       waitEvent->Set();
-    delete pMsg;
 
     lock.lock();
   }
@@ -56,6 +56,7 @@
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
 #include "storage/MediaManager.h"
+#include "utils/FileExistenceChecker.h"
 #include "utils/FileUtils.h"
 #include "utils/LegacyPathTranslation.h"
 #include "utils/MathUtils.h"
@@ -71,6 +72,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 using namespace KODI;
@@ -215,7 +217,7 @@ void CMusicDatabase::CreateTables()
               " iBitRate INTEGER NOT NULL DEFAULT 0, "
               " iSampleRate INTEGER NOT NULL DEFAULT 0, iChannels INTEGER NOT NULL DEFAULT 0, "
               " strVideoURL TEXT, "
-              " strReplayGain text, "
+              " strReplayGain text, bReplayGainFailed INTEGER NOT NULL DEFAULT 0, "
               " dateAdded TEXT, dateNew TEXT, dateModified TEXT)");
   CLog::Log(LOGINFO, "create song_artist table");
   m_pDS->exec("CREATE TABLE song_artist (idArtist integer, idSong integer, idRole integer, iOrder "
@@ -251,6 +253,8 @@ void CMusicDatabase::CreateTables()
 
   CLog::Log(LOGINFO, "create removed_link table");
   m_pDS->exec("CREATE TABLE removed_link (idArtist INTEGER, idMedia INTEGER, idRole INTEGER)");
+
+  CreateChangelogTable();
 }
 
 void CMusicDatabase::CreateAnalytics()
@@ -302,6 +306,10 @@ void CMusicDatabase::CreateAnalytics()
 
   m_pDS->exec("CREATE INDEX ix_art ON art(media_id, media_type(20), type(20))");
 
+  CreateFullTextIndex("artist", "idArtist", {"strArtist"});
+  CreateFullTextIndex("album", "idAlbum", {"strAlbum"});
+  CreateFullTextIndex("song", "idSong", {"strTitle"});
+
   CLog::Log(LOGINFO, "create triggers");
   m_pDS->exec("CREATE TRIGGER tgrDeleteAlbum AFTER delete ON album FOR EACH ROW BEGIN"
               "  DELETE FROM song WHERE song.idAlbum = old.idAlbum;"
@@ -407,6 +415,14 @@ void CMusicDatabase::CreateAnalytics()
               "END");
   CreateRemovedLinkTriggers(); // DELETE ON song_artist and album_artist tables
 
+  CreateChangelogAnalytics({{"artist", "idArtist", MediaTypeArtist},
+                            {"album", "idAlbum", MediaTypeAlbum},
+                            {"song", "idSong", MediaTypeSong}},
+                           {{"art", "media_id", ""},
+                            {"album_artist", "idAlbum", MediaTypeAlbum},
+                            {"song_artist", "idSong", MediaTypeSong},
+                            {"song_genre", "idSong", MediaTypeSong}});
+
   // Create native functions stored in DB (MySQL/MariaDB only)
   CreateNativeDBFunctions();
 
@@ -1385,7 +1401,8 @@ int CMusicDatabase::UpdateSong(int idSong,
     strSQL += PrepareSQL(", strArtistSort = '%s'", artistSort.c_str());
 
   strSQL += PrepareSQL(", iStartOffset = %i, iEndOffset = %i, rating = %.1f, userrating = %i, "
-                       "votes = %i, comment = '%s', mood = '%s', strReplayGain = '%s' ",
+                       "votes = %i, comment = '%s', mood = '%s', strReplayGain = '%s', "
+                       "bReplayGainFailed = 0 ",
                        iStartOffset, iEndOffset, static_cast<double>(rating), userrating, votes,
                        strComment.c_str(), strMood.c_str(), replayGain.Get().c_str());
 
@@ -3515,7 +3532,13 @@ bool CMusicDatabase::SearchArtists(const std::string& search, CFileItemList& art
 
     std::string strVariousArtists = g_localizeStrings.Get(340).c_str();
     std::string strSQL;
-    if (search.size() >= MIN_FULL_SEARCH_LENGTH)
+    const std::string fullText = search.size() >= MIN_FULL_SEARCH_LENGTH
+                                     ? GetFullTextCondition("artist", "idArtist", search)
+                                     : "";
+    if (!fullText.empty())
+      strSQL = "SELECT * FROM artist WHERE " + fullText +
+               PrepareSQL(" AND strArtist <> '%s' ", strVariousArtists.c_str());
+    else if (search.size() >= MIN_FULL_SEARCH_LENGTH)
       strSQL = PrepareSQL("SELECT * FROM artist "
                           "WHERE (strArtist LIKE '%s%%' OR strArtist LIKE '%% %s%%') "
                           "AND strArtist <> '%s' ",
@@ -4162,7 +4185,12 @@ bool CMusicDatabase::SearchSongs(const std::string& search, CFileItemList& items
       return false;
 
     std::string strSQL;
-    if (search.size() >= MIN_FULL_SEARCH_LENGTH)
+    const std::string fullText = search.size() >= MIN_FULL_SEARCH_LENGTH
+                                     ? GetFullTextCondition("song", "idSong", search)
+                                     : "";
+    if (!fullText.empty())
+      strSQL = "SELECT * FROM songview WHERE " + fullText + " LIMIT 1000";
+    else if (search.size() >= MIN_FULL_SEARCH_LENGTH)
       strSQL = PrepareSQL("SELECT * FROM songview "
                           "WHERE strTitle LIKE '%s%%' or strTitle LIKE '%% %s%%' LIMIT 1000",
                           search.c_str(), search.c_str());
@@ -4205,7 +4233,12 @@ bool CMusicDatabase::SearchAlbums(const std::string& search, CFileItemList& albu
       return false;
 
     std::string strSQL;
-    if (search.size() >= MIN_FULL_SEARCH_LENGTH)
+    const std::string fullText = search.size() >= MIN_FULL_SEARCH_LENGTH
+                                     ? GetFullTextCondition("album", "idAlbum", search)
+                                     : "";
+    if (!fullText.empty())
+      strSQL = "SELECT * FROM albumview WHERE " + fullText;
+    else if (search.size() >= MIN_FULL_SEARCH_LENGTH)
       strSQL = PrepareSQL("SELECT * FROM albumview "
                           "WHERE strAlbum LIKE '%s%%' OR strAlbum LIKE '%% %s%%'",
                           search.c_str(), search.c_str());
@@ -4241,27 +4274,19 @@ bool CMusicDatabase::SearchAlbums(const std::string& search, CFileItemList& albu
   return false;
 }
 
-bool CMusicDatabase::CleanupSongsByIds(const std::string& strSongIds)
+bool CMusicDatabase::CleanupSongs(CGUIDialogProgress* progressDialog /*= nullptr*/)
 {
   try
   {
-    if (nullptr == m_pDB)
-      return false;
-    if (nullptr == m_pDS)
+    if (!m_pDS)
       return false;
-    // ok, now find all idSong's
-    std::string strSQL = PrepareSQL("SELECT * FROM song JOIN path ON song.idPath = path.idPath "
-                                    "WHERE song.idSong IN %s",
-                                    strSongIds.c_str());
-    if (!m_pDS->query(strSQL))
+
+    // the files are checked in parallel, a directory listing at a time, and an interrupted
+    // check resumes where it left off, see CFileExistenceChecker
+    CFileExistenceChecker checker("special://database/MusicCleanCheckpoint.json", "all");
+    if (!m_pDS->query("SELECT song.idSong, song.strFileName, path.strPath FROM song "
+                      "JOIN path ON song.idPath = path.idPath"))
       return false;
-    int iRowsFound = m_pDS->num_rows();
-    if (iRowsFound == 0)
-    {
-      m_pDS->close();
-      return true;
-    }
-    std::vector<std::string> songsToDelete;
     while (!m_pDS->eof())
     { // get the full song path
       std::string strFileName = URIUtils::AddFileToFolder(
@@ -4278,87 +4303,42 @@ bool CMusicDatabase::CleanupSongsByIds(const std::string& strSongIds)
         URIUtils::RemoveSlashAtEnd(strFileName);
       }
 
-      if (!CFile::Exists(strFileName, false))
-      { // file no longer exists, so add to deletion list
-        songsToDelete.push_back(m_pDS->fv("song.idSong").get_asString());
-      }
+      checker.AddFile(m_pDS->fv("song.idSong").get_asInt(), strFileName);
       m_pDS->next();
     }
     m_pDS->close();
 
-    if (!songsToDelete.empty())
-    {
-      std::string strSongsToDelete = "(" + StringUtils::Join(songsToDelete, ",") + ")";
-      // ok, now delete these songs + all references to them from the linked tables
-      strSQL = "delete from song where idSong in " + strSongsToDelete;
-      m_pDS->exec(strSQL);
-      m_pDS->close();
-    }
-    return true;
-  }
-  catch (...)
-  {
-    CLog::Log(LOGERROR, "Exception in CMusicDatabase::CleanupSongsFromPaths()");
-  }
-  return false;
-}
+    const bool checked = checker.Run(
+        [progressDialog](size_t current, size_t total)
+        {
+          if (!progressDialog)
+            return true;
 
-bool CMusicDatabase::CleanupSongs(CGUIDialogProgress* progressDialog /*= nullptr*/)
-{
-  try
-  {
-    if (!m_pDS)
+          int percentage = static_cast<int>(current * 100 / total);
+          if (percentage > progressDialog->GetPercentage())
+          {
+            progressDialog->SetPercentage(percentage);
+            progressDialog->Progress();
+          }
+          return !progressDialog->IsCanceled();
+        });
+    if (!checked)
       return false;
 
-    // Count total number of songs
-    const int total = GetSingleValueInt("SELECT COUNT(1) FROM song", *m_pDS);
-    // No songs to clean
-    if (total == 0)
-      return true;
-
-    // run through all songs and get all unique path ids
-    int iLIMIT = 1000;
-    for (int i = 0;; i += iLIMIT)
+    // delete the songs that no longer exist + all references to them from the linked tables,
+    // in batches to keep the statements at a sensible size
+    const std::vector<int>& songsToDelete = checker.GetMissing();
+    constexpr size_t BATCH_SIZE = 1000;
+    for (size_t i = 0; i < songsToDelete.size(); i += BATCH_SIZE)
     {
-      std::string strSQL = PrepareSQL("SELECT song.idSong FROM song "
-                                      "ORDER BY song.idSong LIMIT %i OFFSET %i",
-                                      iLIMIT, i);
-      if (!m_pDS->query(strSQL))
-        return false;
-      int iRowsFound = m_pDS->num_rows();
-      // keep going until no rows are left!
-      if (iRowsFound == 0)
-      {
-        m_pDS->close();
-        return true;
-      }
-
-      std::vector<std::string> songIds;
-      while (!m_pDS->eof())
-      {
-        songIds.push_back(m_pDS->fv("song.idSong").get_asString());
-        m_pDS->next();
-      }
-      m_pDS->close();
-      std::string strSongIds = "(" + StringUtils::Join(songIds, ",") + ")";
-      CLog::Log(LOGDEBUG, "Checking songs from song ID list: {}", strSongIds);
-      if (progressDialog)
-      {
-        int percentage = i * 100 / total;
-        if (percentage > progressDialog->GetPercentage())
-        {
-          progressDialog->SetPercentage(percentage);
-          progressDialog->Progress();
-        }
-        if (progressDialog->IsCanceled())
-        {
-          m_pDS->close();
-          return false;
-        }
-      }
-      if (!CleanupSongsByIds(strSongIds))
-        return false;
+      std::string strSongIds;
+      for (size_t j = i; j < std::min(i + BATCH_SIZE, songsToDelete.size()); ++j)
+        strSongIds += StringUtils::Format("{},", songsToDelete[j]);
+      strSongIds.pop_back();
+      CLog::Log(LOGDEBUG, "Deleting songs from song ID list: ({})", strSongIds);
+      m_pDS->exec("DELETE FROM song WHERE idSong IN (" + strSongIds + ")");
     }
+    checker.Finish();
     return true;
   }
   catch (...)
@@ -7060,7 +7040,7 @@ bool CMusicDatabase::GetArtistsByWhereJSON(
           if (artistObj.isMember("musicbrainzartistid") && artistObj["musicbrainzartistid"].empty())
             artistObj["musicbrainzartistid"].append("");
 
-          result["artists"].append(artistObj);
+          result["artists"].append(std::move(artistObj));
           bHaveArtist = false;
           artistObj.clear();
         }
@@ -7604,7 +7584,7 @@ bool CMusicDatabase::GetAlbumsByWhereJSON(
             for (const auto& source : sources)
               albumObj["sourceid"].append(std::atoi(source.c_str()));
           }
-          result["albums"].append(albumObj);
+          result["albums"].append(std::move(albumObj));
           albumObj.clear();
           artistId = -1;
         }
@@ -8213,7 +8193,7 @@ bool CMusicDatabase::GetSongsByWhereJSON(
                 songObj[displayXXX] = "";
             }
           }
-          result["songs"].append(songObj);
+          result["songs"].append(std::move(songObj));
           bHaveSong = false;
           songObj.clear();
         }
@@ -9460,6 +9440,12 @@ void CMusicDatabase::UpdateTables(int version)
   if (version < 83)
     m_pDS->exec("ALTER TABLE song ADD strVideoURL TEXT");
 
+  if (version < 85)
+    CreateChangelogTable();
+
+  if (version < 86)
+    m_pDS->exec("ALTER TABLE song ADD bReplayGainFailed INTEGER NOT NULL DEFAULT 0");
+
   // Set the version of tag scanning required.
   // Not every schema change requires the tags to be rescanned, set to the highest schema version
   // that needs this. Forced rescanning (of music files that have not changed since they were
@@ -9480,7 +9466,7 @@ void CMusicDatabase::UpdateTables(int version)
 
 int CMusicDatabase::GetSchemaVersion() const
 {
-  return 83;
+  return 86;
 }
 
 int CMusicDatabase::GetMusicNeedsTagScan()
@@ -9610,10 +9596,13 @@ unsigned int CMusicDatabase::GetRandomSongIDs(const Filter& filter,
     if (nullptr == m_pDS)
       return 0;
 
-    std::string strSQL = "SELECT idSong FROM songview ";
+    // No ORDER BY RANDOM(): sorting the whole filtered library is what makes this slow on
+    // large (MySQL) libraries, the caller picks from the IDs at random instead
+    std::string strSQL = filter.where.empty() && filter.join.empty()
+                             ? "SELECT idSong FROM song "
+                             : "SELECT idSong FROM songview ";
     if (!CDatabase::BuildSQL(strSQL, filter, strSQL))
       return false;
-    strSQL += PrepareSQL(" ORDER BY RANDOM()");
 
     if (!m_pDS->query(strSQL))
       return 0;
@@ -11502,6 +11491,88 @@ bool CMusicDatabase::SetSongUserrating(int idSong, int userrating)
   return false;
 }
 
+bool CMusicDatabase::GetSongsWithoutReplayGain(
+    std::map<int, std::vector<ReplayGainSong>>& songsByAlbum)
+{
+  try
+  {
+    songsByAlbum.clear();
+    if (nullptr == m_pDB)
+      return false;
+    if (nullptr == m_pDS)
+      return false;
+
+    // Songs from cue sheets only span part of their file, they can't be measured
+    std::string sql =
+        "SELECT song.idSong, song.idAlbum, path.strPath, song.strFileName, "
+        "song.strReplayGain IS NULL OR song.strReplayGain = '', "
+        "song.iStartOffset = 0 AND song.iEndOffset = 0 AND song.bReplayGainFailed = 0 "
+        "FROM song JOIN path ON song.idPath = path.idPath "
+        "WHERE song.idAlbum IN (SELECT idAlbum FROM song "
+        "WHERE (strReplayGain IS NULL OR strReplayGain = '') AND bReplayGainFailed = 0 "
+        "AND iStartOffset = 0 AND iEndOffset = 0) "
+        "ORDER BY song.idAlbum, song.iTrack";
+    if (!m_pDS->query(sql))
+      return false;
+
+    while (!m_pDS->eof())
+    {
+      songsByAlbum[m_pDS->fv(1).get_asInt()].emplace_back(ReplayGainSong{
+          m_pDS->fv(0).get_asInt(),
+          URIUtils::AddFileToFolder(m_pDS->fv(2).get_asString(), m_pDS->fv(3).get_asString()),
+          m_pDS->fv(4).get_asInt() != 0, m_pDS->fv(5).get_asInt() != 0});
+      m_pDS->next();
+    }
+    m_pDS->close();
+    return true;
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "failed");
+  }
+  return false;
+}
+
+bool CMusicDatabase::SetSongReplayGain(int idSong, const ReplayGain& replayGain)
+{
+  try
+  {
+    if (nullptr == m_pDB)
+      return false;
+    if (nullptr == m_pDS)
+      return false;
+
+    std::string sql = PrepareSQL("UPDATE song SET strReplayGain = '%s' WHERE idSong = %i",
+                                 replayGain.Get().c_str(), idSong);
+    m_pDS->exec(sql);
+    return true;
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "({}) failed", idSong);
+  }
+  return false;
+}
+
+bool CMusicDatabase::SetSongReplayGainFailed(int idSong)
+{
+  try
+  {
+    if (nullptr == m_pDB)
+      return false;
+    if (nullptr == m_pDS)
+      return false;
+
+    m_pDS->exec(PrepareSQL("UPDATE song SET bReplayGainFailed = 1 WHERE idSong = %i", idSong));
+    return true;
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "({}) failed", idSong);
+  }
+  return false;
+}
+
 bool CMusicDatabase::SetAlbumUserrating(const int idAlbum, int userrating)
 {
   try
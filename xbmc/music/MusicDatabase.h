@@ -66,6 +66,19 @@ struct ArtForThumbLoader
   std::string url;
 };
 
+/*!
+\ingroup music
+\brief A song of an album to measure the replay gain of
+\sa CMusicDatabase::GetSongsWithoutReplayGain()
+*/
+struct ReplayGainSong
+{
+  int idSong;
+  std::string path;
+  bool needsGain; //!< has no replay gain from tags or an earlier analysis
+  bool measurable; //!< spans its whole file and didn't fail to decode before
+};
+
 class CGUIDialogProgress;
 class CFileItemList;
 
@@ -239,6 +252,18 @@ public:
   void CheckArtistLinksChanged();
   bool SetSongUserrating(const std::string& filePath, int userrating);
   bool SetSongUserrating(int idSong, int userrating);
+  /*! \brief Get the albums with songs that have no replay gain yet, from tags or an earlier
+  analysis, and that didn't fail to decode before.
+  All songs of those albums are returned, as the album gain is measured over all of them.
+  \param songsByAlbum [out] the songs in track order, by album id
+  \return true if successful
+  */
+  bool GetSongsWithoutReplayGain(std::map<int, std::vector<ReplayGainSong>>& songsByAlbum);
+  bool SetSongReplayGain(int idSong, const ReplayGain& replayGain);
+  /*! \brief Record that a song could not be decoded to measure its replay gain, so it isn't tried
+  again until its tags are rescanned.
+  */
+  bool SetSongReplayGainFailed(int idSong);
   bool SetSongVotes(const std::string& filePath, int votes);
   int GetSongByArtistAndAlbumAndTitle(const std::string& strArtist,
                                       const std::string& strAlbum,
@@ -640,9 +665,9 @@ public:
   /////////////////////////////////////////////////
   // Party Mode
   /////////////////////////////////////////////////
-  /*! \brief Gets song IDs in random order that match the filter criteria
+  /*! \brief Gets the IDs of the songs that match the filter criteria, to pick random songs from
   \param filter the criteria to apply in the query
-  \param songIDs a vector of <1, id> pairs suited to party mode use
+  \param songIDs a vector of <1, id> pairs suited to party mode use, in no particular order
   \return count of song ids found.
   */
   unsigned int GetRandomSongIDs(const Filter& filter, std::vector<std::pair<int, int>>& songIDs);
@@ -913,7 +938,6 @@ private:
   bool DeleteRemovedLinks();
 
   bool CleanupSongs(CGUIDialogProgress* progressDialog = nullptr);
-  bool CleanupSongsByIds(const std::string& strSongIds);
   bool CleanupPaths();
   bool CleanupAlbums();
   bool CleanupArtists();
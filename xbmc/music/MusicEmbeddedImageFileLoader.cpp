@@ -9,14 +9,24 @@
 #include "MusicEmbeddedImageFileLoader.h"
 
 #include "FileItem.h"
+#include "filesystem/File.h"
 #include "guilib/Texture.h"
 #include "imagefiles/ImageFileURL.h"
 #include "music/tags/ImusicInfoTagLoader.h"
 #include "music/tags/MusicInfoTag.h"
 #include "music/tags/MusicInfoTagLoaderFactory.h"
+#include "threads/CriticalSection.h"
 #include "utils/EmbeddedArt.h"
 
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
 using namespace MUSIC_INFO;
+using namespace XFILE;
 
 bool CMusicEmbeddedImageFileLoader::CanLoad(const std::string& specialType) const
 {
@@ -25,6 +35,89 @@ bool CMusicEmbeddedImageFileLoader::CanLoad(const std::string& specialType) cons
 
 namespace
 {
+// how far past the size of the art the tags holding it are searched, at both ends of the file
+constexpr int64_t ART_SEARCH_MARGIN = 1024 * 1024;
+// larger art isn't read from a recorded position, the location is more likely to be broken
+constexpr size_t MAX_ART_LENGTH = 64 * 1024 * 1024;
+
+int64_t FindArt(CFile& file, int64_t start, int64_t length, const std::vector<uint8_t>& data)
+{
+  std::vector<uint8_t> buffer(static_cast<size_t>(length));
+  if (file.Seek(start, SEEK_SET) != start ||
+      file.Read(buffer.data(), buffer.size()) != static_cast<ssize_t>(buffer.size()))
+    return -1;
+
+  const auto found = std::search(buffer.begin(), buffer.end(),
+                                 std::boyer_moore_horspool_searcher(data.begin(), data.end()));
+  if (found == buffer.end())
+    return -1;
+  return start + (found - buffer.begin());
+}
+
+// where the art of a music file was found, or that it wasn't, valid as long as the file is
+// unchanged
+struct ArtLocation
+{
+  int64_t fileSize;
+  int64_t fileTime;
+  int64_t offset; // -1 if the art isn't stored as is
+  size_t length;
+  std::string mime;
+};
+
+// the locations are looked up when the art of freshly scanned files is cached
+constexpr size_t MAX_ART_LOCATIONS = 20000;
+
+CCriticalSection s_locationsSection;
+std::unordered_map<std::string, ArtLocation> s_locations;
+
+std::optional<ArtLocation> GetArtLocation(const std::string& path, CFile& file)
+{
+  struct __stat64 st;
+  if (file.Stat(&st) != 0)
+    return {};
+
+  std::unique_lock lock(s_locationsSection);
+  const auto it = s_locations.find(path);
+  if (it == s_locations.end() || it->second.fileSize != st.st_size ||
+      it->second.fileTime != st.st_mtime)
+    return {};
+  return it->second;
+}
+
+void SetArtLocation(const std::string& path, CFile& file, ArtLocation location)
+{
+  struct __stat64 st;
+  if (file.Stat(&st) != 0)
+    return;
+
+  location.fileSize = st.st_size;
+  location.fileTime = st.st_mtime;
+
+  std::unique_lock lock(s_locationsSection);
+  if (s_locations.size() >= MAX_ART_LOCATIONS && !s_locations.contains(path))
+    s_locations.erase(s_locations.begin());
+  s_locations.insert_or_assign(path, std::move(location));
+}
+
+std::unique_ptr<CTexture> LoadArtAt(const std::string& path)
+{
+  CFile file;
+  if (!file.Open(path))
+    return nullptr;
+
+  const std::optional<ArtLocation> location = GetArtLocation(path, file);
+  if (!location || location->offset < 0 || location->length > MAX_ART_LENGTH)
+    return nullptr;
+
+  std::vector<uint8_t> data(location->length);
+  if (file.Seek(location->offset, SEEK_SET) != location->offset ||
+      file.Read(data.data(), data.size()) != static_cast<ssize_t>(data.size()))
+    return nullptr;
+
+  return CTexture::LoadFromFileInMemory(data.data(), data.size(), location->mime);
+}
+
 bool GetEmbeddedThumb(const std::string& path, EmbeddedArt& art)
 {
   CFileItem item(path, false);
@@ -40,8 +133,37 @@ bool GetEmbeddedThumb(const std::string& path, EmbeddedArt& art)
 std::unique_ptr<CTexture> CMusicEmbeddedImageFileLoader::Load(
     const IMAGE_FILES::CImageFileURL& imageFile) const
 {
+  // without a recorded location, or if that isn't an image anymore, the tags are read
+  std::unique_ptr<CTexture> texture = LoadArtAt(imageFile.GetTargetFile());
+  if (texture)
+    return texture;
+
   EmbeddedArt art;
   if (GetEmbeddedThumb(imageFile.GetTargetFile(), art))
     return CTexture::LoadFromFileInMemory(art.m_data.data(), art.m_size, art.m_mime);
   return nullptr;
 }
+
+bool CMusicEmbeddedImageFileLoader::LocateArt(const std::string& path, const EmbeddedArt& art)
+{
+  CFile file;
+  if (art.m_data.empty() || !file.Open(path))
+    return false;
+
+  // art that wasn't found is remembered as well, it isn't searched for again
+  if (const std::optional<ArtLocation> location = GetArtLocation(path, file);
+      location && location->length == art.m_data.size())
+    return location->offset >= 0;
+
+  // tags are at the start of most formats, APEv2 tags and MP4 files written without moving the
+  // moov atom to the front have them at the end
+  const int64_t fileLength = file.GetLength();
+  const int64_t length =
+      std::min(fileLength, static_cast<int64_t>(art.m_data.size()) + ART_SEARCH_MARGIN);
+  int64_t offset = FindArt(file, 0, length, art.m_data);
+  if (offset < 0 && length < fileLength)
+    offset = FindArt(file, fileLength - length, length, art.m_data);
+
+  SetArtLocation(path, file, {0, 0, offset, art.m_data.size(), art.m_mime});
+  return offset >= 0;
+}
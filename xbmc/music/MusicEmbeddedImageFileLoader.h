@@ -10,6 +10,10 @@
 
 #include "imagefiles/SpecialImageFileLoader.h"
 
+#include <string>
+
+class EmbeddedArt;
+
 namespace MUSIC_INFO
 {
 /*!
@@ -23,5 +27,18 @@ public:
 
   bool CanLoad(const std::string& specialType) const override;
   std::unique_ptr<CTexture> Load(const IMAGE_FILES::CImageFileURL& imageFile) const override;
+
+  /*!
+   * @brief Find and record where the data of embedded art is stored in a music file.
+   *
+   * The data is searched for where tags are, at the start and at the end of the file. Art which
+   * isn't stored as is, like the base64 encoded pictures of Ogg comments, isn't found. Load()
+   * reads the art from the recorded position instead of reading the tags, as long as the file is
+   * unchanged. Whether or not the art was found, it isn't searched for again in the same file.
+   * @param path the music file
+   * @param art the art loaded from the tags of the file
+   * @return true if the art was found
+  */
+  static bool LocateArt(const std::string& path, const EmbeddedArt& art);
 };
 } // namespace MUSIC_INFO
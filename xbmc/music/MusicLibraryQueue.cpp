@@ -19,7 +19,9 @@
 #include "music/jobs/MusicLibraryExportJob.h"
 #include "music/jobs/MusicLibraryImportJob.h"
 #include "music/jobs/MusicLibraryJob.h"
+#include "music/jobs/MusicLibraryReplayGainJob.h"
 #include "music/jobs/MusicLibraryScanningJob.h"
+#include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/Variant.h"
@@ -189,6 +191,11 @@ void CMusicLibraryQueue::StopLibraryScanning()
   Refresh();
 }
 
+void CMusicLibraryQueue::AnalyzeReplayGain()
+{
+  AddJob(new CMusicLibraryReplayGainJob());
+}
+
 void CMusicLibraryQueue::CleanLibrary(bool showDialog /* = false */)
 {
   CGUIDialogProgress* progress = NULL;
@@ -285,6 +292,13 @@ void CMusicLibraryQueue::OnJobComplete(unsigned int jobID, bool success, CJob *j
 {
   if (success)
   {
+    // measure the loudness of the songs added by a scan, unless they are tagged already
+    if (strcmp(job->GetType(), "MusicLibraryScanningJob") == 0 &&
+        CServiceBroker::GetSettingsComponent()
+            ->GetAdvancedSettings()
+            ->m_bMusicLibraryAnalyzeReplayGain)
+      AnalyzeReplayGain();
+
     if (QueueEmpty())
       Refresh();
   }
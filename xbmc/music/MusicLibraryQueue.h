@@ -71,6 +71,12 @@ public:
    */
   void StartArtistScan(const std::string& strDirectory, bool refresh = false);
 
+  /*!
+   \brief Enqueue a job measuring the loudness of the songs without replay gain tags, to store
+   their replay gain in the library.
+   */
+  void AnalyzeReplayGain();
+
   /*!
    \brief Check if a library scan or cleaning is in progress.
    \return True if a scan or clean is in progress, false otherwise
@@ -39,6 +39,8 @@
 #include "guilib/LocalizeStrings.h"
 #include "imagefiles/ImageFileURL.h"
 #include "interfaces/AnnouncementManager.h"
+#include "jobs/JobQueue.h"
+#include "music/MusicEmbeddedImageFileLoader.h"
 #include "music/MusicFileItemClassify.h"
 #include "music/MusicLibraryQueue.h"
 #include "music/MusicThumbLoader.h"
@@ -49,7 +51,9 @@
 #include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
+#include "threads/Event.h"
 #include "utils/Digest.h"
+#include "utils/EmbeddedArt.h"
 #include "utils/FileExtensionProvider.h"
 #include "utils/FileUtils.h"
 #include "utils/StringUtils.h"
@@ -58,6 +62,8 @@
 #include "utils/log.h"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <string_view>
 #include <utility>
 
@@ -486,8 +492,10 @@ bool CMusicInfoScanner::DoScan(const std::string& strDirectory)
 
   m_seenPaths.insert(strDirectory);
 
+  const auto advancedSettings = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+
   // Discard all excluded files defined by m_musicExcludeRegExps
-  const std::vector<std::string> &regexps = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_audioExcludeFromScanRegExps;
+  const std::vector<std::string>& regexps = advancedSettings->m_audioExcludeFromScanRegExps;
 
   if (CUtil::ExcludeFileOrFolder(strDirectory, regexps))
     return true;
@@ -495,6 +503,25 @@ bool CMusicInfoScanner::DoScan(const std::string& strDirectory)
   if (HasNoMedia(strDirectory))
     return true;
 
+  std::string dbHash;
+  const bool inDatabase = m_musicDatabase.GetPathHash(strDirectory, dbHash);
+
+  // the hash of a folder without subfolders is its modification time, which lets unchanged folders
+  // be skipped without listing them
+  std::string fastHash;
+  if (advancedSettings->m_bMusicLibraryUseFastHash && !(m_flags & SCAN_RESCAN) &&
+      !URIUtils::IsPlugin(strDirectory))
+    fastHash = GetFastHash(strDirectory, regexps);
+
+  if (inDatabase && !fastHash.empty() && StringUtils::EqualsNoCase(fastHash, dbHash))
+  {
+    CLog::Log(LOGDEBUG, "{} Skipping dir '{}' due to no change (fasthash)", __FUNCTION__,
+              CURL::GetRedacted(strDirectory));
+    if (m_handle)
+      OnDirectoryScanned(strDirectory);
+    return true;
+  }
+
   // load subfolder
   CFileItemList items;
   CDirectory::GetDirectory(strDirectory, items, CServiceBroker::GetFileExtensionProvider().GetMusicExtensions() + "|.jpg|.tbn|.lrc|.cdg", DIR_FLAG_DEFAULTS);
@@ -506,9 +533,18 @@ bool CMusicInfoScanner::DoScan(const std::string& strDirectory)
   std::string hash;
   GetPathHash(items, hash);
 
+  // the modification time of a folder changes when files are added, removed or renamed, but not
+  // when a subfolder changes
+  const bool hasSubFolders = std::any_of(items.cbegin(), items.cend(),
+                                         [&regexps](const CFileItemPtr& item) {
+                                           return item->IsFolder() &&
+                                                  !CUtil::ExcludeFileOrFolder(item->GetPath(),
+                                                                              regexps);
+                                         });
+  const std::string& newHash = fastHash.empty() || hasSubFolders ? hash : fastHash;
+
   // check whether we need to rescan or not
-  std::string dbHash;
-  if ((m_flags & SCAN_RESCAN) || !m_musicDatabase.GetPathHash(strDirectory, dbHash) || !StringUtils::EqualsNoCase(dbHash, hash))
+  if ((m_flags & SCAN_RESCAN) || !inDatabase || !StringUtils::EqualsNoCase(dbHash, hash))
   { // path has changed - rescan
     if (dbHash.empty())
       CLog::Log(LOGDEBUG, "{} Scanning dir '{}' as not in the database", __FUNCTION__,
@@ -532,12 +568,16 @@ bool CMusicInfoScanner::DoScan(const std::string& strDirectory)
     }
 
     // save information about this folder
-    m_musicDatabase.SetPathHash(strDirectory, hash);
+    m_musicDatabase.SetPathHash(strDirectory, newHash);
   }
   else
   { // path is the same - no need to rescan
     CLog::Log(LOGDEBUG, "{} Skipping dir '{}' due to no change", __FUNCTION__,
               CURL::GetRedacted(strDirectory));
+
+    // switch to the fast hash, once it's usable
+    if (!StringUtils::EqualsNoCase(dbHash, newHash))
+      m_musicDatabase.SetPathHash(strDirectory, newHash);
     m_currentItem += CountFiles(items, false);  // false for non-recursive
 
     // updated the dialog with our progress
@@ -574,11 +614,10 @@ CInfoScanner::InfoRet CMusicInfoScanner::ScanTags(const CFileItemList& items,
 {
   std::vector<std::string> regexps = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_audioExcludeFromScanRegExps;
 
+  std::vector<CFileItemPtr> files;
+  files.reserve(items.Size());
   for (int i = 0; i < items.Size(); ++i)
   {
-    if (m_bStop)
-      return InfoRet::CANCELLED;
-
     CFileItemPtr pItem = items[i];
 
     if (CUtil::ExcludeFileOrFolder(pItem->GetPath(), regexps))
@@ -588,15 +627,20 @@ CInfoScanner::InfoRet CMusicInfoScanner::ScanTags(const CFileItemList& items,
         MUSIC::IsLyrics(*pItem))
       continue;
 
+    files.emplace_back(std::move(pItem));
+  }
+
+  if (!LoadTags(files))
+    return InfoRet::CANCELLED;
+
+  for (const CFileItemPtr& pItem : files)
+  {
+    if (m_bStop)
+      return InfoRet::CANCELLED;
+
     m_currentItem++;
 
-    CMusicInfoTag& tag = *pItem->GetMusicInfoTag();
-    if (!tag.Loaded())
-    {
-      std::unique_ptr<IMusicInfoTagLoader> pLoader (CMusicInfoTagLoaderFactory::CreateLoader(*pItem));
-      if (nullptr != pLoader)
-        pLoader->Load(pItem->GetPath(), tag);
-    }
+    const CMusicInfoTag& tag = *pItem->GetMusicInfoTag();
 
     if (m_handle && m_itemCount>0)
       m_handle->SetPercentage(static_cast<float>(m_currentItem * 100) / static_cast<float>(m_itemCount));
@@ -620,6 +664,69 @@ CInfoScanner::InfoRet CMusicInfoScanner::ScanTags(const CFileItemList& items,
   return InfoRet::ADDED;
 }
 
+bool CMusicInfoScanner::LoadTags(const std::vector<CFileItemPtr>& items)
+{
+  const auto loadTag = [](CFileItem& item)
+  {
+    CMusicInfoTag& tag = *item.GetMusicInfoTag();
+    if (tag.Loaded())
+      return;
+
+    std::unique_ptr<IMusicInfoTagLoader> pLoader(CMusicInfoTagLoaderFactory::CreateLoader(item));
+    if (nullptr == pLoader)
+      return;
+
+    // the art is read along with the tags to record where it is in the file, so the thumbnail can
+    // later be loaded without reading the tags again
+    EmbeddedArt art;
+    if (pLoader->Load(item.GetPath(), tag, &art) && !art.Empty())
+      CMusicEmbeddedImageFileLoader::LocateArt(item.GetPath(), art);
+  };
+
+  const int readers =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_iMusicLibraryTagReaders;
+  if (readers <= 1 || items.size() <= 1)
+  {
+    for (const CFileItemPtr& item : items)
+    {
+      if (m_bStop)
+        return false;
+      loadTag(*item);
+    }
+    return true;
+  }
+
+  // the jobs only hold on to shared state, as those which are running when the scan is stopped
+  // finish after this returns
+  struct State
+  {
+    std::atomic<size_t> remaining;
+    CEvent done{true};
+  };
+  const auto state = std::make_shared<State>();
+  state->remaining = items.size();
+
+  // destroying the queue drops the jobs which haven't started yet
+  CJobQueue queue(false, readers, CJob::PRIORITY_DEDICATED);
+  for (const CFileItemPtr& item : items)
+  {
+    queue.Submit(
+        [item, state, loadTag]()
+        {
+          loadTag(*item);
+          if (--state->remaining == 0)
+            state->done.Set();
+        });
+  }
+
+  while (!state->done.Wait(std::chrono::milliseconds(100)))
+  {
+    if (m_bStop)
+      return false;
+  }
+  return true;
+}
+
 static bool SortSongsByTrack(const CSong& song, const CSong& song2)
 {
   return song.iTrack < song2.iTrack;
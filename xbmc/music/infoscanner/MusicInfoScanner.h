@@ -16,6 +16,9 @@
 #include "threads/Thread.h"
 #include "utils/ScraperUrl.h"
 
+#include <memory>
+#include <vector>
+
 class CAlbum;
 class CArtist;
 class CGUIDialogProgressBarHandle;
@@ -253,6 +256,14 @@ protected:
    \param scannedItems [in] list to populate with the scannedItems
    */
   InfoRet ScanTags(const CFileItemList& items, CFileItemList& scannedItems);
+
+  /*! \brief Load the tags of files which don't have them loaded yet
+   Tags are read by several jobs at once, as reading them from network shares is mostly spent
+   waiting for data.
+   \param items [in] list of files to load the tags of
+   \return false if the scan was stopped before all tags were loaded, true otherwise
+   */
+  bool LoadTags(const std::vector<std::shared_ptr<CFileItem>>& items);
   int GetPathHash(const CFileItemList &items, std::string &hash);
 
   void Run() override;
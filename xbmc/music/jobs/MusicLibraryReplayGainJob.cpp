@@ -0,0 +1,259 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "MusicLibraryReplayGainJob.h"
+
+#include "FileItem.h"
+#include "cores/paplayer/CodecFactory.h"
+#include "cores/paplayer/ICodec.h"
+#include "music/MusicDatabase.h"
+#include "music/tags/LoudnessMeter.h"
+#include "music/tags/ReplayGain.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <cstring>
+#include <future>
+#include <map>
+#include <memory>
+#include <optional>
+#include <stdint.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+// loudness of a track played back at its replay gain, as of ReplayGain 2.0
+constexpr double REFERENCE_LOUDNESS = -18.0; // LUFS
+constexpr size_t MAX_WORKERS = 4;
+constexpr size_t BUFFER_FRAMES = 4096;
+
+size_t GetSampleSize(AEDataFormat format)
+{
+  switch (format)
+  {
+    case AE_FMT_U8:
+      return 1;
+    case AE_FMT_S16NE:
+      return 2;
+    case AE_FMT_S32NE:
+    case AE_FMT_FLOAT:
+      return 4;
+    case AE_FMT_DOUBLE:
+      return 8;
+    default:
+      return 0;
+  }
+}
+
+void ToFloat(AEDataFormat format, const uint8_t* data, size_t count, float* samples)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    switch (format)
+    {
+      case AE_FMT_U8:
+        samples[i] = (static_cast<float>(data[i]) - 128.0f) / 128.0f;
+        break;
+      case AE_FMT_S16NE:
+      {
+        int16_t value;
+        std::memcpy(&value, data + i * sizeof(value), sizeof(value));
+        samples[i] = static_cast<float>(value) / 32768.0f;
+        break;
+      }
+      case AE_FMT_S32NE:
+      {
+        int32_t value;
+        std::memcpy(&value, data + i * sizeof(value), sizeof(value));
+        samples[i] = static_cast<float>(static_cast<double>(value) / 2147483648.0);
+        break;
+      }
+      case AE_FMT_FLOAT:
+        std::memcpy(samples + i, data + i * sizeof(float), sizeof(float));
+        break;
+      case AE_FMT_DOUBLE:
+      {
+        double value;
+        std::memcpy(&value, data + i * sizeof(value), sizeof(value));
+        samples[i] = static_cast<float>(value);
+        break;
+      }
+      default:
+        samples[i] = 0.0f;
+        break;
+    }
+  }
+}
+
+double GetChannelWeight(AEChannel channel)
+{
+  switch (channel)
+  {
+    case AE_CH_LFE:
+      return 0.0;
+    case AE_CH_BL:
+    case AE_CH_BR:
+    case AE_CH_SL:
+    case AE_CH_SR:
+      return 1.41;
+    default:
+      return 1.0;
+  }
+}
+
+std::optional<CLoudnessMeter> Analyze(const std::string& path, const std::atomic<bool>& cancelled)
+{
+  const CFileItem item(path, false);
+  std::unique_ptr<ICodec> codec(CodecFactory::CreateCodecDemux(item, 0));
+  if (!codec || !codec->Init(item, 0))
+  {
+    CLog::Log(LOGDEBUG, "CMusicLibraryReplayGainJob: unable to decode {}", path);
+    return {};
+  }
+
+  const AEAudioFormat& format = codec->m_format;
+  const size_t channels = format.m_channelLayout.Count();
+  const size_t sampleSize = GetSampleSize(format.m_dataFormat);
+  if (channels == 0 || sampleSize == 0 || format.m_sampleRate == 0)
+  {
+    CLog::Log(LOGDEBUG, "CMusicLibraryReplayGainJob: unsupported format of {}", path);
+    return {};
+  }
+
+  std::vector<double> weights;
+  for (unsigned int channel = 0; channel < channels; ++channel)
+    weights.emplace_back(GetChannelWeight(format.m_channelLayout[channel]));
+  CLoudnessMeter meter(format.m_sampleRate, std::move(weights));
+
+  const size_t frameSize = channels * sampleSize;
+  std::vector<uint8_t> buffer(BUFFER_FRAMES * frameSize);
+  std::vector<float> samples(BUFFER_FRAMES * channels);
+  // a read may end in the middle of a frame, its start is kept for the next one
+  size_t buffered = 0;
+  while (!cancelled)
+  {
+    size_t read = 0;
+    const int result = codec->ReadPCM(buffer.data() + buffered, buffer.size() - buffered, &read);
+    if (result == READ_ERROR)
+    {
+      CLog::Log(LOGDEBUG, "CMusicLibraryReplayGainJob: error decoding {}", path);
+      return {};
+    }
+
+    buffered += read;
+    const size_t frames = buffered / frameSize;
+    ToFloat(format.m_dataFormat, buffer.data(), frames * channels, samples.data());
+    meter.AddSamples(samples.data(), frames);
+    std::memmove(buffer.data(), buffer.data() + frames * frameSize, buffered - frames * frameSize);
+    buffered -= frames * frameSize;
+
+    if (result == READ_EOF)
+      return meter;
+  }
+  return {};
+}
+} // namespace
+
+CMusicLibraryReplayGainJob::CMusicLibraryReplayGainJob() = default;
+
+CMusicLibraryReplayGainJob::~CMusicLibraryReplayGainJob() = default;
+
+bool CMusicLibraryReplayGainJob::Cancel()
+{
+  m_cancelled = true;
+  return true;
+}
+
+bool CMusicLibraryReplayGainJob::Equals(const CJob* job) const
+{
+  // there is nothing to gain from analyzing the library twice
+  return strcmp(job->GetType(), GetType()) == 0;
+}
+
+bool CMusicLibraryReplayGainJob::Work(CMusicDatabase& db)
+{
+  std::map<int, std::vector<ReplayGainSong>> songsByAlbum;
+  if (!db.GetSongsWithoutReplayGain(songsByAlbum))
+    return false;
+
+  size_t analyzed = 0;
+  for (const auto& [idAlbum, songs] : songsByAlbum)
+  {
+    // the album gain is measured over all of its tracks, including those with replay gain tags,
+    // it can't be known if any of them can't be measured
+    const bool albumMeasurable =
+        std::ranges::all_of(songs, [](const ReplayGainSong& song) { return song.measurable; });
+    const auto needsDecoding = [albumMeasurable](const ReplayGainSong& song)
+    { return song.measurable && (song.needsGain || albumMeasurable); };
+
+    // the filters of the meter run serially over the samples of a track, so the tracks of an
+    // album are decoded and measured in parallel instead
+    std::vector<std::optional<CLoudnessMeter>> meters(songs.size());
+    std::atomic<size_t> next{0};
+    const auto worker = [this, &songs, &meters, &next, &needsDecoding]()
+    {
+      for (size_t i = next++; i < songs.size() && !m_cancelled; i = next++)
+      {
+        if (needsDecoding(songs[i]))
+          meters[i] = Analyze(songs[i].path, m_cancelled);
+      }
+    };
+
+    std::vector<std::future<void>> workers;
+    for (size_t i = 0; i < std::min(MAX_WORKERS, songs.size()); ++i)
+      workers.emplace_back(std::async(std::launch::async, worker));
+    for (const auto& result : workers)
+      result.wait();
+
+    if (m_cancelled)
+      return false;
+
+    // songs which can't be decoded aren't tried again by later runs
+    for (size_t i = 0; i < songs.size(); ++i)
+    {
+      if (needsDecoding(songs[i]) && !meters[i])
+        db.SetSongReplayGainFailed(songs[i].idSong);
+    }
+
+    std::optional<CLoudnessMeter> album;
+    if (albumMeasurable &&
+        std::ranges::all_of(meters, [](const auto& meter) { return meter.has_value(); }))
+    {
+      album.emplace(*meters.front());
+      for (size_t i = 1; i < meters.size(); ++i)
+        album->Add(*meters[i]);
+    }
+    const std::optional<double> albumLoudness = album ? album->GetLoudness() : std::nullopt;
+
+    for (size_t i = 0; i < songs.size(); ++i)
+    {
+      if (!songs[i].needsGain)
+        continue;
+      const std::optional<double> loudness = meters[i] ? meters[i]->GetLoudness() : std::nullopt;
+      if (!loudness)
+        continue;
+
+      ReplayGain replayGain;
+      replayGain.SetGain(ReplayGain::TRACK, static_cast<float>(REFERENCE_LOUDNESS - *loudness));
+      replayGain.SetPeak(ReplayGain::TRACK, meters[i]->GetPeak());
+      if (albumLoudness)
+      {
+        replayGain.SetGain(ReplayGain::ALBUM,
+                           static_cast<float>(REFERENCE_LOUDNESS - *albumLoudness));
+        replayGain.SetPeak(ReplayGain::ALBUM, album->GetPeak());
+      }
+      if (db.SetSongReplayGain(songs[i].idSong, replayGain))
+        analyzed++;
+    }
+  }
+
+  CLog::Log(LOGINFO, "CMusicLibraryReplayGainJob: measured the loudness of {} songs", analyzed);
+  return true;
+}
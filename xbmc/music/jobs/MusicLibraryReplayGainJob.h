@@ -0,0 +1,42 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "music/jobs/MusicLibraryJob.h"
+
+#include <atomic>
+
+/*!
+ \brief Music library job measuring the loudness (EBU R128) of the songs which have no replay gain
+ tags, to store track and album gain and peak for them in the database.
+
+ The tracks of an album are decoded in parallel, the album gain is measured over all of them.
+ Songs from cue sheets are skipped, songs failing to decode are recorded and not tried again.
+ */
+class CMusicLibraryReplayGainJob : public CMusicLibraryJob
+{
+public:
+  CMusicLibraryReplayGainJob();
+  ~CMusicLibraryReplayGainJob() override;
+
+  // specialization of CMusicLibraryJob
+  bool CanBeCancelled() const override { return true; }
+  bool Cancel() override;
+
+  // specialization of CJob
+  const char* GetType() const override { return "MusicLibraryReplayGainJob"; }
+  bool Equals(const CJob* job) const override;
+
+protected:
+  // implementation of CMusicLibraryJob
+  bool Work(CMusicDatabase& db) override;
+
+private:
+  std::atomic<bool> m_cancelled{false};
+};
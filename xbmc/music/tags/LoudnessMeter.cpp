@@ -0,0 +1,147 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "LoudnessMeter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace
+{
+constexpr double ABSOLUTE_GATE = -70.0; // LUFS
+constexpr double RELATIVE_GATE = -10.0; // LU
+
+double ToLoudness(double energy)
+{
+  return -0.691 + 10.0 * std::log10(energy);
+}
+
+double ToEnergy(double loudness)
+{
+  return std::pow(10.0, (loudness + 0.691) / 10.0);
+}
+} // namespace
+
+CLoudnessMeter::CLoudnessMeter(unsigned int sampleRate, std::vector<double> weights)
+  : m_weights(std::move(weights)),
+    m_channels(m_weights.size()),
+    m_subBlockFrames(std::max(1u, sampleRate / 10))
+{
+  // The K-weighting filter of BS.1770 is only specified for 48kHz, the coefficients for other
+  // sample rates are derived from the analog prototypes of its two stages.
+  const double rate = static_cast<double>(std::max(1u, sampleRate));
+
+  // stage 1, a high shelf modelling the acoustic effect of the head
+  {
+    constexpr double f0 = 1681.974450955533;
+    constexpr double gain = 3.999843853973347;
+    constexpr double q = 0.7071752369554196;
+    const double k = std::tan(std::numbers::pi * f0 / rate);
+    const double vh = std::pow(10.0, gain / 20.0);
+    const double vb = std::pow(vh, 0.4996667741545416);
+    const double a0 = 1.0 + k / q + k * k;
+    m_shelf.b = {(vh + vb * k / q + k * k) / a0, 2.0 * (k * k - vh) / a0,
+                 (vh - vb * k / q + k * k) / a0};
+    m_shelf.a = {2.0 * (k * k - 1.0) / a0, (1.0 - k / q + k * k) / a0};
+  }
+
+  // stage 2, a high pass
+  {
+    constexpr double f0 = 38.13547087602444;
+    constexpr double q = 0.5003270373238773;
+    const double k = std::tan(std::numbers::pi * f0 / rate);
+    const double a0 = 1.0 + k / q + k * k;
+    m_highPass.b = {1.0, -2.0, 1.0};
+    m_highPass.a = {2.0 * (k * k - 1.0) / a0, (1.0 - k / q + k * k) / a0};
+  }
+}
+
+void CLoudnessMeter::AddSamples(const float* samples, size_t frames)
+{
+  const size_t channels = m_channels.size();
+  if (channels == 0)
+    return;
+
+  for (size_t frame = 0; frame < frames; ++frame, samples += channels)
+  {
+    double sum = 0.0;
+    for (size_t channel = 0; channel < channels; ++channel)
+    {
+      const double x = samples[channel];
+      m_peak = std::max(m_peak, std::abs(samples[channel]));
+
+      // both stages in transposed direct form II
+      ChannelState& state = m_channels[channel];
+      const double shelved = m_shelf.b[0] * x + state.shelf[0];
+      state.shelf[0] = m_shelf.b[1] * x - m_shelf.a[0] * shelved + state.shelf[1];
+      state.shelf[1] = m_shelf.b[2] * x - m_shelf.a[1] * shelved;
+
+      const double y = m_highPass.b[0] * shelved + state.highPass[0];
+      state.highPass[0] = m_highPass.b[1] * shelved - m_highPass.a[0] * y + state.highPass[1];
+      state.highPass[1] = m_highPass.b[2] * shelved - m_highPass.a[1] * y;
+
+      sum += m_weights[channel] * y * y;
+    }
+
+    m_subBlockSum += sum;
+    if (++m_subBlockPosition < m_subBlockFrames)
+      continue;
+
+    m_subBlocks[m_subBlockCount++ % m_subBlocks.size()] =
+        m_subBlockSum / static_cast<double>(m_subBlockFrames);
+    m_subBlockPosition = 0;
+    m_subBlockSum = 0.0;
+
+    if (m_subBlockCount >= m_subBlocks.size())
+    {
+      double energy = 0.0;
+      for (double subBlock : m_subBlocks)
+        energy += subBlock;
+      m_blocks.push_back(energy / static_cast<double>(m_subBlocks.size()));
+    }
+  }
+}
+
+void CLoudnessMeter::Add(const CLoudnessMeter& other)
+{
+  m_blocks.insert(m_blocks.end(), other.m_blocks.begin(), other.m_blocks.end());
+  m_peak = std::max(m_peak, other.m_peak);
+}
+
+std::optional<double> CLoudnessMeter::GetLoudness() const
+{
+  const auto average = [this](double threshold) -> std::optional<double>
+  {
+    double sum = 0.0;
+    size_t count = 0;
+    for (double block : m_blocks)
+    {
+      if (block >= threshold)
+      {
+        sum += block;
+        count++;
+      }
+    }
+    if (count == 0)
+      return {};
+    return sum / static_cast<double>(count);
+  };
+
+  const double absoluteThreshold = ToEnergy(ABSOLUTE_GATE);
+  const std::optional<double> ungated = average(absoluteThreshold);
+  if (!ungated)
+    return {};
+
+  const double relativeThreshold = ToEnergy(ToLoudness(*ungated) + RELATIVE_GATE);
+  const std::optional<double> gated = average(std::max(absoluteThreshold, relativeThreshold));
+  if (!gated)
+    return {};
+
+  return ToLoudness(*gated);
+}
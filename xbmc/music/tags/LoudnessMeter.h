@@ -0,0 +1,84 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <array>
+#include <optional>
+#include <stddef.h>
+#include <vector>
+
+/*!
+ \brief Measures the integrated loudness and the sample peak of audio as specified by
+ EBU R128 / ITU-R BS.1770.
+
+ The samples are K-weighted, their mean square is taken over 400ms blocks overlapping by 75% and
+ the loudness is the average of the blocks left after the absolute (-70 LUFS) and the relative
+ (-10 LU) gate.
+ */
+class CLoudnessMeter
+{
+public:
+  /*!
+   \param sampleRate the sample rate of the audio
+   \param weights the weight of every channel, 1.0 for front and center channels, 1.41 for
+   surround channels and 0.0 for LFE channels
+   */
+  CLoudnessMeter(unsigned int sampleRate, std::vector<double> weights);
+
+  /*!
+   \brief Add interleaved samples, with one sample for every channel per frame.
+   */
+  void AddSamples(const float* samples, size_t frames);
+
+  /*!
+   \brief Add the measurements of another meter, so the loudness of both (e.g. all tracks of an
+   album) is measured as one.
+   */
+  void Add(const CLoudnessMeter& other);
+
+  /*!
+   \brief Get the integrated loudness in LUFS.
+   \return the loudness, nothing if the audio was too short or too quiet to be measured
+   */
+  std::optional<double> GetLoudness() const;
+
+  /*!
+   \brief Get the highest absolute sample value, 1.0 is full digital scale.
+   */
+  float GetPeak() const { return m_peak; }
+
+private:
+  struct Biquad
+  {
+    std::array<double, 3> b;
+    std::array<double, 2> a;
+  };
+
+  struct ChannelState
+  {
+    // the delay lines of both filter stages
+    std::array<double, 2> shelf{};
+    std::array<double, 2> highPass{};
+  };
+
+  std::vector<double> m_weights;
+  Biquad m_shelf;
+  Biquad m_highPass;
+  std::vector<ChannelState> m_channels;
+
+  size_t m_subBlockFrames;
+  size_t m_subBlockPosition{0};
+  double m_subBlockSum{0.0};
+  // weighted mean squares of the last 100ms sub blocks, a 400ms block spans four of them
+  std::array<double, 4> m_subBlocks{};
+  size_t m_subBlockCount{0};
+
+  std::vector<double> m_blocks;
+  float m_peak{0.0f};
+};
@@ -0,0 +1,93 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "music/tags/LoudnessMeter.h"
+
+#include <cmath>
+#include <numbers>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+// stereo 1kHz sine wave with the given peak level in dBFS
+std::vector<float> MakeSine(unsigned int sampleRate, double level, double seconds)
+{
+  const double amplitude = std::pow(10.0, level / 20.0);
+  const size_t frames = static_cast<size_t>(sampleRate * seconds);
+  std::vector<float> samples;
+  samples.reserve(frames * 2);
+  for (size_t frame = 0; frame < frames; ++frame)
+  {
+    const float sample = static_cast<float>(
+        amplitude * std::sin(2.0 * std::numbers::pi * 1000.0 * frame / sampleRate));
+    samples.push_back(sample);
+    samples.push_back(sample);
+  }
+  return samples;
+}
+} // namespace
+
+TEST(TestLoudnessMeter, Sine)
+{
+  // EBU Tech 3341 test case 1: a -23 dBFS sine wave measures -23 LUFS
+  for (unsigned int sampleRate : {44100u, 48000u})
+  {
+    CLoudnessMeter meter(sampleRate, {1.0, 1.0});
+    const std::vector<float> samples = MakeSine(sampleRate, -23.0, 20.0);
+    meter.AddSamples(samples.data(), samples.size() / 2);
+
+    ASSERT_TRUE(meter.GetLoudness().has_value());
+    EXPECT_NEAR(-23.0, *meter.GetLoudness(), 0.1);
+    EXPECT_NEAR(std::pow(10.0, -23.0 / 20.0), meter.GetPeak(), 0.001);
+  }
+}
+
+TEST(TestLoudnessMeter, Gating)
+{
+  // EBU Tech 3341 test case 3: quiet parts below the relative gate don't count
+  CLoudnessMeter meter(48000, {1.0, 1.0});
+  for (const auto& [level, seconds] : {std::pair{-36.0, 10.0}, {-23.0, 60.0}, {-36.0, 10.0}})
+  {
+    const std::vector<float> samples = MakeSine(48000, level, seconds);
+    meter.AddSamples(samples.data(), samples.size() / 2);
+  }
+
+  ASSERT_TRUE(meter.GetLoudness().has_value());
+  EXPECT_NEAR(-23.0, *meter.GetLoudness(), 0.1);
+}
+
+TEST(TestLoudnessMeter, Silence)
+{
+  CLoudnessMeter meter(48000, {1.0, 1.0});
+  const std::vector<float> samples(48000 * 2 * 5, 0.0f);
+  meter.AddSamples(samples.data(), samples.size() / 2);
+
+  EXPECT_FALSE(meter.GetLoudness().has_value());
+  EXPECT_EQ(0.0f, meter.GetPeak());
+}
+
+TEST(TestLoudnessMeter, Add)
+{
+  CLoudnessMeter album(48000, {1.0, 1.0});
+  for (double level : {-20.0, -26.0})
+  {
+    CLoudnessMeter track(48000, {1.0, 1.0});
+    const std::vector<float> samples = MakeSine(48000, level, 10.0);
+    track.AddSamples(samples.data(), samples.size() / 2);
+    album.Add(track);
+  }
+
+  // the average energy of both tracks
+  const double expected = 10.0 * std::log10((std::pow(10.0, -2.0) + std::pow(10.0, -2.6)) / 2.0);
+  ASSERT_TRUE(album.GetLoudness().has_value());
+  EXPECT_NEAR(expected, *album.GetLoudness(), 0.1);
+  EXPECT_NEAR(0.1, album.GetPeak(), 0.001);
+}
@@ -8,6 +8,8 @@
 
 #include "DNSNameCache.h"
 
+#include "ServiceBroker.h"
+#include "jobs/JobManager.h"
 #include "network/Network.h"
 #include "utils/log.h"
 
@@ -16,8 +18,6 @@
 #include <utility>
 
 #if !defined(TARGET_WINDOWS) && defined(HAS_FILESYSTEM_SMB)
-#include "ServiceBroker.h"
-
 #include "platform/posix/filesystem/SMBWSDiscovery.h"
 #endif
 
@@ -46,11 +46,67 @@ bool CDNSNameCache::Lookup(const std::string& strHostName, std::string& strIpAdd
     return true;
   }
 
-  // check if there's a custom entry or if it's already cached
-  if (GetCached(strHostName, strIpAddress))
-    return true;
+  std::promise<std::string> promise;
+  std::shared_future<std::string> result;
+  {
+    std::lock_guard lock(m_critical);
+
+    // check if there's a custom entry or if it's already cached
+    if (GetCached(strHostName, strIpAddress))
+      return true;
+
+    // don't wait on hosts which could not be resolved a moment ago all over again
+    if (auto iter = m_failed.find(strHostName); iter != m_failed.end())
+    {
+      if (iter->second > std::chrono::steady_clock::now())
+        return false;
+      m_failed.erase(iter);
+    }
+
+    // join a query already in progress for the same host
+    if (auto iter = m_pending.find(strHostName); iter != m_pending.end())
+      result = iter->second;
+    else
+      m_pending.emplace(strHostName, promise.get_future().share());
+  }
+
+  if (result.valid())
+  {
+    strIpAddress = result.get();
+    return !strIpAddress.empty();
+  }
+
+  strIpAddress = Resolve(strHostName);
+  {
+    std::lock_guard lock(m_critical);
+    if (strIpAddress.empty())
+      m_failed.insert_or_assign(strHostName, std::chrono::steady_clock::now() + NEGATIVE_TTL);
+    else
+      Add(strHostName, strIpAddress);
+    m_pending.erase(strHostName);
+  }
+  promise.set_value(strIpAddress);
+
+  return !strIpAddress.empty();
+}
 
-  // perform dns lookup
+void CDNSNameCache::Prefetch(const std::vector<std::string>& hostNames)
+{
+  for (const std::string& hostName : hostNames)
+  {
+    CServiceBroker::GetJobManager()->Submit(
+        [cache = weak_from_this(), hostName]()
+        {
+          std::string ipAddress;
+          if (const auto dnsNameCache = cache.lock())
+            dnsNameCache->Lookup(hostName, ipAddress);
+        });
+  }
+}
+
+std::string CDNSNameCache::Resolve(const std::string& strHostName)
+{
+  // AF_UNSPEC queries for IPv4 and IPv6 addresses at the same time
   addrinfo hints{};
   addrinfo* res;
 
@@ -60,14 +116,13 @@ bool CDNSNameCache::Lookup(const std::string& strHostName, std::string& strIpAdd
 
   if (getaddrinfo(strHostName.c_str(), nullptr, &hints, &res) == 0)
   {
-    strIpAddress = CNetworkBase::GetIpStr(res->ai_addr);
+    std::string strIpAddress = CNetworkBase::GetIpStr(res->ai_addr);
     freeaddrinfo(res);
-    Add(strHostName, strIpAddress);
-    return true;
+    return strIpAddress;
   }
 
   CLog::Log(LOGERROR, "Unable to lookup host: '{}'", strHostName);
-  return false;
+  return {};
 }
 
 bool CDNSNameCache::GetCached(const std::string& strHostName, std::string& strIpAddress) const
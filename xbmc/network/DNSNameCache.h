@@ -11,11 +11,14 @@
 #include "threads/CriticalSection.h"
 
 #include <chrono>
+#include <future>
+#include <memory>
 #include <optional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
-class CDNSNameCache final
+class CDNSNameCache final : public std::enable_shared_from_this<CDNSNameCache>
 {
 public:
   /*!
@@ -44,7 +47,9 @@ public:
   /*!
    * \brief Get the IP for the hostname from the cache or query it form the DNS
    *
-   * If a successful DNS query was performed the result is added to the cache for the duration of \ref TTL
+   * If a successful DNS query was performed the result is added to the cache for the duration of \ref TTL,
+   * failed queries are not repeated for \ref NEGATIVE_TTL. Concurrent lookups of the same hostname
+   * wait on a single DNS query.
    *
    * \param strHostName The hostname to look up
    * \param[out] strIpAddress Contains the IP for the hostname if the info can be provided, otherwise unchanged
@@ -52,9 +57,18 @@ public:
    * \return true if the IP is cached or the DNS query was successful
    */
   bool Lookup(const std::string& strHostName, std::string& strIpAddress);
+  /*!
+   * \brief Look up hostnames in the background, so they are cached by the time they are needed
+   *
+   * \param hostNames The hostnames to look up
+   */
+  void Prefetch(const std::vector<std::string>& hostNames);
 
 private:
   static constexpr std::chrono::seconds TTL{60};
+  static constexpr std::chrono::seconds NEGATIVE_TTL{30};
+
+  static std::string Resolve(const std::string& strHostName);
 
   struct CacheEntry
   {
@@ -66,4 +80,7 @@ private:
 
   mutable CCriticalSection m_critical;
   mutable std::unordered_map<std::string, CacheEntry> m_hostToIp;
+  std::unordered_map<std::string, std::chrono::steady_clock::time_point> m_failed;
+  //! results of the DNS queries in progress, empty if the query failed
+  std::unordered_map<std::string, std::shared_future<std::string>> m_pending;
 };
@@ -19,17 +19,23 @@ bool IsInternetStream(const CFileItem& item)
   if (item.HasProperty("IsHTTPDirectory"))
     return false;
 
-  return URIUtils::IsInternetStream(item.GetDynURL());
+  return item.GetCachedClassification(CFileItem::CachedClassification::INTERNET_STREAM,
+                                      [](const CFileItem& fileItem)
+                                      { return URIUtils::IsInternetStream(fileItem.GetDynURL()); });
 }
 
 bool IsRemote(const CFileItem& item)
 {
-  return URIUtils::IsRemote(item.GetPath());
+  return item.GetCachedClassification(CFileItem::CachedClassification::REMOTE,
+                                      [](const CFileItem& fileItem)
+                                      { return URIUtils::IsRemote(fileItem.GetPath()); });
 }
 
 bool IsStreamedFilesystem(const CFileItem& item)
 {
-  return URIUtils::IsStreamedFilesystem(item.GetDynPath());
+  return item.GetCachedClassification(
+      CFileItem::CachedClassification::STREAMED_FILESYSTEM, [](const CFileItem& fileItem)
+      { return URIUtils::IsStreamedFilesystem(fileItem.GetDynPath()); });
 }
 
 } // namespace KODI::NETWORK
@@ -0,0 +1,388 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "PlaybackSync.h"
+
+#include "ServiceBroker.h"
+#include "cores/VideoPlayer/Interface/TimingConstants.h"
+#include "network/DNSNameCache.h"
+#include "network/Socket.h"
+#include "utils/TimeUtils.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <array>
+#include <mutex>
+
+using namespace SOCKETS;
+using namespace std::chrono_literals;
+
+namespace
+{
+constexpr std::array<uint8_t, 4> MAGIC = {'K', 'S', 'Y', 'N'};
+constexpr uint8_t VERSION = 2;
+constexpr uint8_t TYPE_REQUEST = 1;
+constexpr uint8_t TYPE_RESPONSE = 2;
+
+constexpr size_t HEADER_SIZE = 8;
+// header, t0, t1, t2, state time, playing time, speed, item hash
+constexpr size_t RESPONSE_SIZE = HEADER_SIZE + 7 * 8;
+// header and t0, padded to the size of the response so the master never sends more than it got
+constexpr size_t REQUEST_SIZE = RESPONSE_SIZE;
+constexpr size_t PACKET_SIZE = RESPONSE_SIZE;
+
+// followers exchange time quickly until they have a few samples, then every REQUEST_INTERVAL
+constexpr int64_t FAST_REQUEST_INTERVAL = 50000;
+constexpr int64_t REQUEST_INTERVAL = 250000;
+constexpr size_t FAST_SAMPLES = 8;
+// samples the offset is chosen from, about 4 seconds
+constexpr size_t MAX_SAMPLES = 16;
+// the master is considered lost without a response for this long
+constexpr int64_t RESPONSE_TIMEOUT = 2000000;
+constexpr int LISTEN_TIMEOUT_MS = 20;
+
+void Put64(uint8_t* buffer, int64_t value)
+{
+  for (int i = 7; i >= 0; --i)
+  {
+    buffer[i] = static_cast<uint8_t>(value & 0xff);
+    value = static_cast<int64_t>(static_cast<uint64_t>(value) >> 8);
+  }
+}
+
+int64_t Get64(const uint8_t* buffer)
+{
+  uint64_t value = 0;
+  for (int i = 0; i < 8; ++i)
+    value = (value << 8) | buffer[i];
+  return static_cast<int64_t>(value);
+}
+
+void PutHeader(uint8_t* buffer, uint8_t type)
+{
+  std::ranges::copy(MAGIC, buffer);
+  buffer[4] = VERSION;
+  buffer[5] = type;
+  buffer[6] = 0;
+  buffer[7] = 0;
+}
+
+bool CheckHeader(const uint8_t* buffer, int size, uint8_t type, size_t minSize)
+{
+  return size >= static_cast<int>(minSize) && std::equal(MAGIC.begin(), MAGIC.end(), buffer) &&
+         buffer[4] == VERSION && buffer[5] == type;
+}
+
+bool IsSameAddress(const CAddress& a, const CAddress& b)
+{
+  if (a.saddr.saddr_generic.sa_family != b.saddr.saddr_generic.sa_family)
+    return false;
+  if (a.saddr.saddr_generic.sa_family == AF_INET6)
+    return a.saddr.saddr6.sin6_port == b.saddr.saddr6.sin6_port &&
+           std::ranges::equal(a.saddr.saddr6.sin6_addr.s6_addr, b.saddr.saddr6.sin6_addr.s6_addr);
+  return a.saddr.saddr4.sin_port == b.saddr.saddr4.sin_port &&
+         a.saddr.saddr4.sin_addr.s_addr == b.saddr.saddr4.sin_addr.s_addr;
+}
+
+bool IsIPv6Socket(CUDPSocket& socket)
+{
+  sockaddr_storage address = {};
+  socklen_t size = sizeof(address);
+  if (getsockname(socket.Socket(), reinterpret_cast<sockaddr*>(&address), &size) != 0)
+    return false;
+  return address.ss_family == AF_INET6;
+}
+} // namespace
+
+CPlaybackSync::CPlaybackSync() : CThread("PlaybackSync")
+{
+}
+
+CPlaybackSync::~CPlaybackSync()
+{
+  StopThread();
+}
+
+int64_t CPlaybackSync::GetTime()
+{
+  const int64_t counter = CurrentHostCounter();
+  const int64_t frequency = CurrentHostFrequency();
+  return counter / frequency * 1000000 + counter % frequency * 1000000 / frequency;
+}
+
+uint64_t CPlaybackSync::HashItem(const std::string& item)
+{
+  // FNV-1a, the hash has to be the same on all platforms
+  uint64_t hash = 0xcbf29ce484222325;
+  for (const char c : item)
+  {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= 0x100000001b3;
+  }
+  return hash;
+}
+
+bool CPlaybackSync::SetMaster(const std::string& address, int port)
+{
+  in6_addr address6;
+  in_addr address4;
+  if (inet_pton(AF_INET6, address.c_str(), &address6) != 1 &&
+      inet_pton(AF_INET, address.c_str(), &address4) != 1)
+  {
+    CLog::LogF(LOGERROR, "Invalid address {}", address);
+    return false;
+  }
+
+  Start(Role::MASTER, "", address, port);
+
+  // wait for the thread to bind the port
+  for (int i = 0; i < 100 && IsRunning(); ++i)
+  {
+    {
+      std::unique_lock lock(m_section);
+      if (m_bound)
+        return true;
+    }
+    CThread::Sleep(10ms);
+  }
+  Leave();
+  return false;
+}
+
+bool CPlaybackSync::SetFollower(const std::string& master, int port)
+{
+  std::string address = master;
+  in6_addr address6;
+  in_addr address4;
+  if (inet_pton(AF_INET6, master.c_str(), &address6) != 1 &&
+      inet_pton(AF_INET, master.c_str(), &address4) != 1)
+  {
+    const auto dnsCache = CServiceBroker::GetDNSNameCache();
+    if (!dnsCache || !dnsCache->Lookup(master, address))
+    {
+      CLog::LogF(LOGERROR, "Unable to resolve {}", master);
+      return false;
+    }
+  }
+
+  Start(Role::FOLLOWER, master, address, port);
+  return true;
+}
+
+void CPlaybackSync::Leave()
+{
+  StopThread();
+
+  std::unique_lock lock(m_section);
+  m_role = Role::NONE;
+  m_bound = false;
+  m_master.clear();
+  m_address.clear();
+  m_item = 0;
+  m_samples.clear();
+  m_lastResponse = 0;
+}
+
+void CPlaybackSync::Start(Role role,
+                          const std::string& master,
+                          const std::string& address,
+                          int port)
+{
+  Leave();
+
+  {
+    std::unique_lock lock(m_section);
+    m_role = role;
+    m_master = master;
+    m_address = address;
+    m_port = port;
+  }
+  Create();
+}
+
+CPlaybackSync::Role CPlaybackSync::GetRole() const
+{
+  std::unique_lock lock(m_section);
+  return m_role;
+}
+
+CPlaybackSync::Status CPlaybackSync::GetStatus() const
+{
+  std::unique_lock lock(m_section);
+  Status status;
+  status.role = m_role;
+  status.master = m_master;
+  status.port = m_port;
+  status.synchronised = m_role == Role::FOLLOWER && m_lastResponse != 0 &&
+                        GetTime() - m_lastResponse < RESPONSE_TIMEOUT;
+  status.offset = m_best.offset;
+  status.roundTrip = m_best.roundTrip;
+  status.error = m_error;
+  return status;
+}
+
+void CPlaybackSync::Publish(const std::string& item, double time, int speed)
+{
+  std::unique_lock lock(m_section);
+  if (m_role != Role::MASTER)
+    return;
+
+  m_item = item.empty() ? 0 : HashItem(item);
+  m_stateTime = GetTime();
+  m_playTime = time;
+  m_speed = speed;
+}
+
+bool CPlaybackSync::GetReference(const std::string& item, double& time) const
+{
+  const int64_t now = GetTime();
+
+  std::unique_lock lock(m_section);
+  if (m_role != Role::FOLLOWER || m_lastResponse == 0 || now - m_lastResponse > RESPONSE_TIMEOUT)
+    return false;
+  if (m_speed != DVD_PLAYSPEED_NORMAL || m_item == 0 || m_item != HashItem(item))
+    return false;
+
+  // the playing time of the master advanced since it was sampled
+  const int64_t masterNow = now + m_best.offset;
+  time = m_playTime + static_cast<double>(masterNow - m_stateTime) * DVD_TIME_BASE / 1000000;
+  return true;
+}
+
+void CPlaybackSync::SetError(double error)
+{
+  std::unique_lock lock(m_section);
+  m_error = error;
+}
+
+void CPlaybackSync::AddSample(int64_t sent,
+                              int64_t received,
+                              int64_t masterReceived,
+                              int64_t masterSent)
+{
+  const int64_t roundTrip = (received - sent) - (masterSent - masterReceived);
+  if (roundTrip < 0)
+    return;
+
+  m_samples.push_back({((masterReceived - sent) + (masterSent - received)) / 2, roundTrip});
+  if (m_samples.size() > MAX_SAMPLES)
+    m_samples.pop_front();
+
+  // the exchange with the shortest round trip was delayed the least and is the most accurate
+  m_best = *std::ranges::min_element(m_samples, {}, &Sample::roundTrip);
+}
+
+void CPlaybackSync::Process()
+{
+  Role role;
+  std::string address;
+  int port;
+  {
+    std::unique_lock lock(m_section);
+    role = m_role;
+    address = m_address;
+    port = m_port;
+  }
+
+  // the master only answers on the LAN address it was given, not on every interface
+  std::unique_ptr<CUDPSocket> socket = CSocketFactory::CreateUDPSocket();
+  if (!socket || !(role == Role::MASTER ? socket->Bind(CAddress(address.c_str()), port)
+                                        : socket->Bind(false, 0)))
+  {
+    CLog::LogF(LOGERROR, "Unable to bind the playback sync socket");
+    return;
+  }
+
+  CAddress master;
+  if (role == Role::MASTER)
+  {
+    std::unique_lock lock(m_section);
+    m_bound = true;
+    CLog::LogF(LOGINFO, "Playback sync master listening on {} port {}", address, port);
+  }
+  else
+  {
+    // a dual stack socket reaches IPv4 hosts through mapped addresses
+    in_addr address4;
+    if (IsIPv6Socket(*socket) && inet_pton(AF_INET, address.c_str(), &address4) == 1)
+      address = "::ffff:" + address;
+    master.SetAddress(address.c_str());
+    if (master.saddr.saddr_generic.sa_family == AF_INET6)
+      master.saddr.saddr6.sin6_port = htons(static_cast<uint16_t>(port));
+    else
+      master.saddr.saddr4.sin_port = htons(static_cast<uint16_t>(port));
+    CLog::LogF(LOGINFO, "Playback sync following {} port {}", address, port);
+  }
+
+  CSocketListener listener;
+  listener.AddSocket(socket.get());
+  std::array<uint8_t, PACKET_SIZE> buffer;
+  int64_t lastRequest = 0;
+
+  while (!m_bStop)
+  {
+    if (role == Role::FOLLOWER)
+    {
+      const int64_t now = GetTime();
+      size_t samples;
+      {
+        std::unique_lock lock(m_section);
+        samples = m_samples.size();
+      }
+      if (now - lastRequest >= (samples < FAST_SAMPLES ? FAST_REQUEST_INTERVAL : REQUEST_INTERVAL))
+      {
+        buffer.fill(0);
+        PutHeader(buffer.data(), TYPE_REQUEST);
+        Put64(buffer.data() + HEADER_SIZE, GetTime());
+        socket->SendTo(master, REQUEST_SIZE, buffer.data());
+        lastRequest = now;
+      }
+    }
+
+    if (!listener.Listen(LISTEN_TIMEOUT_MS))
+      continue;
+
+    CAddress from;
+    const int size = socket->Read(from, PACKET_SIZE, buffer.data());
+    const int64_t received = GetTime();
+
+    if (role == Role::MASTER && CheckHeader(buffer.data(), size, TYPE_REQUEST, REQUEST_SIZE))
+    {
+      const int64_t sent = Get64(buffer.data() + HEADER_SIZE);
+      uint8_t* response = buffer.data();
+      PutHeader(response, TYPE_RESPONSE);
+      Put64(response + HEADER_SIZE, sent);
+      Put64(response + HEADER_SIZE + 8, received);
+      {
+        std::unique_lock lock(m_section);
+        Put64(response + HEADER_SIZE + 24, m_stateTime);
+        Put64(response + HEADER_SIZE + 32, static_cast<int64_t>(m_playTime));
+        Put64(response + HEADER_SIZE + 40, m_speed);
+        Put64(response + HEADER_SIZE + 48, static_cast<int64_t>(m_item));
+      }
+      // stamped last, so the time of the master is taken as late as possible
+      Put64(response + HEADER_SIZE + 16, GetTime());
+      socket->SendTo(from, static_cast<int>(RESPONSE_SIZE), response);
+    }
+    else if (role == Role::FOLLOWER && IsSameAddress(from, master) &&
+             CheckHeader(buffer.data(), size, TYPE_RESPONSE, RESPONSE_SIZE))
+    {
+      const uint8_t* response = buffer.data();
+      std::unique_lock lock(m_section);
+      AddSample(Get64(response + HEADER_SIZE), received, Get64(response + HEADER_SIZE + 8),
+                Get64(response + HEADER_SIZE + 16));
+      m_stateTime = Get64(response + HEADER_SIZE + 24);
+      m_playTime = static_cast<double>(Get64(response + HEADER_SIZE + 32));
+      m_speed = static_cast<int>(Get64(response + HEADER_SIZE + 40));
+      m_item = static_cast<uint64_t>(Get64(response + HEADER_SIZE + 48));
+      m_lastResponse = received;
+    }
+  }
+
+  CLog::LogF(LOGINFO, "Playback sync stopped");
+}
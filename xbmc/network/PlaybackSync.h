@@ -0,0 +1,136 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+#include "threads/Thread.h"
+
+#include <deque>
+#include <stdint.h>
+#include <string>
+
+/*!
+ * \brief Synchronises the playback of several Kodi instances, e.g. in multiple rooms.
+ *
+ * One instance is the master of a group, the others follow it. The master answers time requests
+ * of the followers on a UDP port of its LAN address, together with a hash of the name of the item
+ * it plays and its playing time. A response is never larger than the request, and followers only
+ * take responses from the master they follow. Followers estimate the offset between their clock
+ * and the one of the master from these exchanges the way NTP does, keeping the exchange with the
+ * shortest round trip of the last ones, and so know where the master is in the item at any time. The player of a follower steers its clock towards that
+ * reference (CDVDClock::FollowReference), audio is resampled to follow the clock.
+ *
+ * Instances start playback on their own, usually a JSON-RPC client opens the same item on all of
+ * them, items are matched by file name.
+ */
+class CPlaybackSync : private CThread
+{
+public:
+  enum class Role
+  {
+    NONE,
+    MASTER,
+    FOLLOWER
+  };
+
+  struct Status
+  {
+    Role role{Role::NONE};
+    std::string master;
+    int port{0};
+    //! whether a follower has exchanged time with its master lately
+    bool synchronised{false};
+    //! offset of the clock of the master, in microseconds
+    int64_t offset{0};
+    //! round trip of the exchange the offset is taken from, in microseconds
+    int64_t roundTrip{0};
+    //! last playing time error reported by the player, in microseconds
+    double error{0};
+  };
+
+  static constexpr int DEFAULT_PORT = 34890;
+
+  CPlaybackSync();
+  ~CPlaybackSync() override;
+
+  /*!
+   * \brief Become the master of a group, answering the followers on the given UDP port.
+   * \param address local address to answer on, usually the one of the LAN interface
+   * \return false if the address is invalid or the port can't be bound
+   */
+  bool SetMaster(const std::string& address, int port = DEFAULT_PORT);
+
+  /*!
+   * \brief Follow the master on the given host.
+   * \return false if the host can't be resolved
+   */
+  bool SetFollower(const std::string& master, int port = DEFAULT_PORT);
+
+  //! Leave the group
+  void Leave();
+
+  Role GetRole() const;
+  Status GetStatus() const;
+
+  /*!
+   * \brief Publish the playing state of the master, called by its player.
+   * \param item file name of the playing item, empty if nothing plays
+   * \param time playing time in DVD_TIME_BASE units
+   * \param speed playing speed, DVD_PLAYSPEED_NORMAL for normal playback
+   */
+  void Publish(const std::string& item, double time, int speed);
+
+  /*!
+   * \brief Get the time the master is playing now, called by the player of a follower.
+   * \param item file name of the item the follower plays
+   * \param time [out] the playing time of the master in DVD_TIME_BASE units
+   * \return false if the master doesn't play this item at normal speed or isn't reachable
+   */
+  bool GetReference(const std::string& item, double& time) const;
+
+  //! Report the playing time error of a follower, for GetStatus()
+  void SetError(double error);
+
+  //! Time of the monotonic clock exchanged between the instances, in microseconds
+  static int64_t GetTime();
+
+protected:
+  void Process() override;
+
+private:
+  struct Sample
+  {
+    int64_t offset;
+    int64_t roundTrip;
+  };
+
+  void Start(Role role, const std::string& master, const std::string& address, int port);
+  //! Hash of the item name exchanged instead of the name itself
+  static uint64_t HashItem(const std::string& item);
+  void AddSample(int64_t sent, int64_t received, int64_t masterReceived, int64_t masterSent);
+
+  mutable CCriticalSection m_section;
+  Role m_role{Role::NONE};
+  bool m_bound{false};
+  std::string m_master;
+  std::string m_address;
+  int m_port{0};
+
+  // state of the master, published by its player or received from it
+  uint64_t m_item{0};
+  int64_t m_stateTime{0};
+  double m_playTime{0};
+  int m_speed{0};
+  int64_t m_lastResponse{0};
+
+  // clock offset estimation of a follower
+  std::deque<Sample> m_samples;
+  Sample m_best{0, 0};
+  double m_error{0};
+};
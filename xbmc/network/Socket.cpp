@@ -106,6 +106,29 @@ bool CPosixUDPSocket::Bind(bool localOnly, int port, int range)
       m_addr = CAddress("0.0.0.0");
   }
 
+  return BindPort(port, range);
+}
+
+bool CPosixUDPSocket::Bind(const CAddress& addr, int port, int range)
+{
+  // close any existing sockets
+  Close();
+
+  m_ipv6Socket = addr.saddr.saddr_generic.sa_family == AF_INET6;
+  m_iSock = socket(m_ipv6Socket ? AF_INET6 : AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+  if (m_iSock == INVALID_SOCKET)
+  {
+    CLog::Log(LOGERROR, "UDP: Could not create socket");
+    CLog::Log(LOGERROR, "UDP: {}", strerror(errno));
+    return false;
+  }
+
+  m_addr = addr;
+  return BindPort(port, range);
+}
+
+bool CPosixUDPSocket::BindPort(int port, int range)
+{
   // bind the socket ( try from port to port+range )
   for (m_iPort = port; m_iPort <= port + range; ++m_iPort)
   {
@@ -168,6 +168,10 @@ namespace SOCKETS
       {
         m_Type = ST_UDP;
       }
+    using CBaseSocket::Bind;
+    // bind to the given local address only, e.g. the one of the LAN interface
+    virtual bool Bind(const CAddress& addr, int port, int range=0) = 0;
+
     // I/O functions
     virtual int SendTo(const CAddress& addr, const int bufferlength,
                        const void* buffer) = 0;
@@ -187,8 +191,11 @@ namespace SOCKETS
   {
   public:
     CPosixUDPSocket() = default;
+    // the destructor of the base class only reaches its own Close()
+    ~CPosixUDPSocket() override { Close(); }
 
     bool Bind(bool localOnly, int port, int range=0) override;
+    bool Bind(const CAddress& addr, int port, int range=0) override;
     bool Connect() override { return false; }
     bool Listen(int timeout);
     int SendTo(const CAddress& addr, const int datasize, const void* data) override;
@@ -207,6 +214,7 @@ namespace SOCKETS
 
   private:
     bool CheckIPv6(int port, int range);
+    bool BindPort(int port, int range);
 
     bool m_ipv6Socket{false};
   };
@@ -18,6 +18,7 @@
 #include "utils/log.h"
 #include "websocket/WebSocketManager.h"
 
+#include <algorithm>
 #include <mutex>
 #include <stdio.h>
 #include <stdlib.h>
@@ -25,6 +26,10 @@
 #include <arpa/inet.h>
 #include <memory.h>
 #include <netinet/in.h>
+#if !defined(TARGET_WINDOWS)
+#include <fcntl.h>
+#include <poll.h>
+#endif
 
 using namespace std::chrono_literals;
 
@@ -58,8 +63,44 @@ using namespace JSONRPC;
 namespace
 {
 constexpr size_t maxBufferLength = 64 * 1024;
+// announcements following another one within this window are coalesced and sent together
+constexpr auto announcementWindow = 100ms;
+// no more requests are read from a client while this much of its output is still pending
+constexpr size_t outputHighWater = 1024 * 1024;
+// clients not taking their output are dropped once this much is pending or nothing could be
+// written for this long, so they don't hold up the others
+constexpr size_t maxOutputLength = 16 * 1024 * 1024;
+constexpr auto outputTimeout = 30s;
+
+bool SetNonBlocking(SOCKET socket)
+{
+#ifdef TARGET_WINDOWS
+  u_long nonblocking = 1;
+  return ioctlsocket(socket, FIONBIO, &nonblocking) == 0;
+#else
+  return fcntl(socket, F_SETFL, fcntl(socket, F_GETFL) | O_NONBLOCK) == 0;
+#endif
+}
+
+bool WouldBlock()
+{
+#ifdef TARGET_WINDOWS
+  return WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+  return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+#endif
 }
 
+int PollSockets(std::vector<pollfd>& fds, std::chrono::milliseconds timeout)
+{
+#ifdef TARGET_WINDOWS
+  return WSAPoll(fds.data(), static_cast<ULONG>(fds.size()), static_cast<INT>(timeout.count()));
+#else
+  return poll(fds.data(), fds.size(), static_cast<int>(timeout.count()));
+#endif
+}
+} // namespace
+
 CTCPServer *CTCPServer::ServerInstance = NULL;
 
 bool CTCPServer::StartServer(int port, bool nonlocal)
@@ -108,31 +149,35 @@ void CTCPServer::Process()
 {
   m_bStop = false;
 
+  std::vector<pollfd> fds;
   while (!m_bStop)
   {
-    SOCKET          max_fd = 0;
-    fd_set          rfds;
-    struct timeval  to     = {1, 0};
-    FD_ZERO(&rfds);
+    // wake up in time to flush coalesced announcements
+    const std::chrono::milliseconds timeout =
+        m_connections.empty() ? 1000ms
+                              : std::chrono::duration_cast<std::chrono::milliseconds>(
+                                    announcementWindow);
 
+    fds.clear();
     for (auto& it : m_servers)
-    {
-      FD_SET(it, &rfds);
-      if ((intptr_t)it > (intptr_t)max_fd)
-        max_fd = it;
-    }
+      fds.push_back({it, POLLIN, 0});
 
-    for (unsigned int i = 0; i < m_connections.size(); i++)
+    for (const auto& connection : m_connections)
     {
-      FD_SET(m_connections[i]->m_socket, &rfds);
-      if ((intptr_t)m_connections[i]->m_socket > (intptr_t)max_fd)
-        max_fd = m_connections[i]->m_socket;
+      // stop reading requests from clients not taking their responses
+      const size_t pending = connection->GetPendingOutput();
+      short events = 0;
+      if (pending < outputHighWater)
+        events |= POLLIN;
+      if (pending > 0)
+        events |= POLLOUT;
+      fds.push_back({connection->m_socket, events, 0});
     }
 
-    int res = select((intptr_t)max_fd+1, &rfds, NULL, NULL, &to);
-    if (res < 0)
+    int res = PollSockets(fds, timeout);
+    if (res < 0 && errno != EINTR)
     {
-      CLog::Log(LOGERROR, "JSONRPC Server: Select failed");
+      CLog::Log(LOGERROR, "JSONRPC Server: Poll failed");
       CThread::Sleep(1000ms);
       Initialize();
     }
@@ -140,13 +185,18 @@ void CTCPServer::Process()
     {
       for (int i = m_connections.size() - 1; i >= 0; i--)
       {
-        int socket = m_connections[i]->m_socket;
-        if (FD_ISSET(socket, &rfds))
+        const short revents = fds[m_servers.size() + i].revents;
+        bool close = (revents & (POLLERR | POLLNVAL)) != 0;
+
+        if (!close && (revents & POLLOUT))
+          close = !m_connections[i]->Flush();
+
+        if (!close && (revents & (POLLIN | POLLHUP)))
         {
+          int socket = m_connections[i]->m_socket;
           char buffer[RECEIVEBUFFER] = {};
           int  nread = 0;
           nread = recv(socket, (char*)&buffer, RECEIVEBUFFER, 0);
-          bool close = false;
           if (nread > 0)
           {
             std::string response;
@@ -173,30 +223,31 @@ void CTCPServer::Process()
             close = m_connections[i]->Closing();
           }
           else
-            close = true;
+            close = nread == 0 || !WouldBlock();
+        }
 
-          if (close)
-          {
-            CLog::Log(LOGINFO, "JSONRPC Server: Disconnection detected");
-            m_connections[i]->Disconnect();
-            delete m_connections[i];
-            m_connections.erase(m_connections.begin() + i);
-          }
+        if (close)
+        {
+          CLog::Log(LOGINFO, "JSONRPC Server: Disconnection detected");
+          m_connections[i]->Disconnect();
+          delete m_connections[i];
+          m_connections.erase(m_connections.begin() + i);
         }
       }
 
-      for (auto& it : m_servers)
+      for (size_t i = 0; i < m_servers.size(); i++)
       {
-        if (FD_ISSET(it, &rfds))
+        if (fds[i].revents & POLLIN)
         {
           CLog::Log(LOGDEBUG, "JSONRPC Server: New connection detected");
           CTCPClient *newconnection = new CTCPClient();
-          newconnection->m_socket =
-              accept(it, (sockaddr*)&newconnection->m_cliaddr, &newconnection->m_addrlen);
+          newconnection->m_socket = accept(m_servers[i], (sockaddr*)&newconnection->m_cliaddr,
+                                           &newconnection->m_addrlen);
 
           if (newconnection->m_socket == INVALID_SOCKET)
           {
             CLog::Log(LOGERROR, "JSONRPC Server: Accept of new connection failed: {}", errno);
+            delete newconnection;
             if (EBADF == errno)
             {
               CThread::Sleep(1000ms);
@@ -204,6 +255,12 @@ void CTCPServer::Process()
               break;
             }
           }
+          else if (!SetNonBlocking(newconnection->m_socket))
+          {
+            CLog::Log(LOGERROR, "JSONRPC Server: Unable to make new connection non-blocking");
+            newconnection->Disconnect();
+            delete newconnection;
+          }
           else
           {
             CLog::Log(LOGINFO, "JSONRPC Server: New connection added");
@@ -212,6 +269,18 @@ void CTCPServer::Process()
         }
       }
     }
+
+    for (int i = m_connections.size() - 1; i >= 0; i--)
+    {
+      m_connections[i]->FlushAnnouncements();
+      if (m_connections[i]->IsStalled())
+      {
+        CLog::Log(LOGWARNING, "JSONRPC Server: Dropping client not taking its output");
+        m_connections[i]->Disconnect();
+        delete m_connections[i];
+        m_connections.erase(m_connections.begin() + i);
+      }
+    }
   }
 
   Deinitialize();
@@ -250,7 +319,7 @@ void CTCPServer::Announce(ANNOUNCEMENT::AnnouncementFlag flag,
         continue;
     }
 
-    m_connections[i]->Send(str.c_str(), str.size());
+    m_connections[i]->QueueAnnouncement(str);
   }
 }
 
@@ -265,7 +334,8 @@ bool CTCPServer::Initialize()
 
   if (started)
   {
-    CServiceBroker::GetAnnouncementManager()->AddAnnouncer(this);
+    CServiceBroker::GetAnnouncementManager()->AddAnnouncer(
+        this, ANNOUNCEMENT::ANNOUNCE_ALL, ANNOUNCEMENT::AnnouncerQueue::COALESCE);
     CLog::Log(LOGINFO, "JSONRPC Server: Successfully initialized");
     return true;
   }
@@ -542,12 +612,114 @@ bool CTCPServer::CTCPClient::SetAnnouncementFlags(int flags)
 
 void CTCPServer::CTCPClient::Send(const char *data, unsigned int size)
 {
-  unsigned int sent = 0;
-  do
+  std::unique_lock lock(m_critSection);
+  if (m_socket == INVALID_SOCKET || m_failed)
+    return;
+
+  // whatever the socket doesn't take right away is written by the server thread once it can be
+  const size_t pending = m_output.size() - m_outputOffset;
+  if (pending > 0 && pending + size > maxOutputLength)
+  {
+    CLog::Log(LOGWARNING, "JSONRPC Server: client output buffer size {} exceeded",
+              maxOutputLength);
+    m_failed = true;
+    return;
+  }
+
+  if (pending == 0)
+    m_lastOutput = std::chrono::steady_clock::now();
+  m_output.append(data, size);
+  Flush();
+}
+
+bool CTCPServer::CTCPClient::Flush()
+{
+  std::unique_lock lock(m_critSection);
+  while (!m_failed && m_socket != INVALID_SOCKET && m_outputOffset < m_output.size())
+  {
+    const int sent = send(m_socket, m_output.data() + m_outputOffset,
+                          m_output.size() - m_outputOffset, 0);
+    if (sent < 0)
+    {
+      if (!WouldBlock())
+        m_failed = true;
+      break;
+    }
+
+    m_outputOffset += sent;
+    m_lastOutput = std::chrono::steady_clock::now();
+  }
+
+  if (m_outputOffset == m_output.size())
+  {
+    m_output.clear();
+    m_outputOffset = 0;
+  }
+  else if (m_outputOffset > m_output.size() / 2)
+  {
+    m_output.erase(0, m_outputOffset);
+    m_outputOffset = 0;
+  }
+
+  return !m_failed;
+}
+
+size_t CTCPServer::CTCPClient::GetPendingOutput()
+{
+  std::unique_lock lock(m_critSection);
+  return m_output.size() - m_outputOffset;
+}
+
+bool CTCPServer::CTCPClient::IsStalled()
+{
+  std::unique_lock lock(m_critSection);
+  return m_failed || (m_outputOffset < m_output.size() &&
+                      std::chrono::steady_clock::now() - m_lastOutput > outputTimeout);
+}
+
+void CTCPServer::CTCPClient::Send(const std::vector<std::string>& messages)
+{
+  std::string data;
+  for (const auto& message : messages)
+    data += message;
+
+  Send(data.c_str(), data.size());
+}
+
+void CTCPServer::CTCPClient::QueueAnnouncement(const std::string& announcement)
+{
+  std::unique_lock lock(m_critSection);
+
+  // send the first announcement in a while right away
+  const auto now = std::chrono::steady_clock::now();
+  if (m_announcements.empty() && now - m_lastAnnouncement >= announcementWindow)
+  {
+    m_lastAnnouncement = now;
+    Send(announcement.c_str(), announcement.size());
+    return;
+  }
+
+  // of identical announcements (e.g. repeated updates of the same item) only the latest is kept so
+  // the client still ends up in the right state
+  m_announcements.erase(std::remove(m_announcements.begin(), m_announcements.end(), announcement),
+                        m_announcements.end());
+  m_announcements.push_back(announcement);
+}
+
+void CTCPServer::CTCPClient::FlushAnnouncements()
+{
+  std::vector<std::string> announcements;
   {
     std::unique_lock lock(m_critSection);
-    sent += send(m_socket, data + sent, size - sent, 0);
-  } while (sent < size);
+    const auto now = std::chrono::steady_clock::now();
+    if (m_announcements.empty() || now - m_lastAnnouncement < announcementWindow)
+      return;
+
+    m_lastAnnouncement = now;
+    announcements.swap(m_announcements);
+  }
+
+  Send(announcements);
 }
 
 void CTCPServer::CTCPClient::PushBuffer(CTCPServer *host, const char *buffer, int length)
@@ -627,6 +799,8 @@ void CTCPServer::CTCPClient::Disconnect()
   if (m_socket > 0)
   {
     std::unique_lock lock(m_critSection);
+    // best effort, a client not reading anymore won't get the rest
+    Flush();
     shutdown(m_socket, SHUT_RDWR);
     closesocket(m_socket);
     m_socket = INVALID_SOCKET;
@@ -645,6 +819,12 @@ void CTCPServer::CTCPClient::Copy(const CTCPClient& client)
   m_beginChar         = client.m_beginChar;
   m_endChar           = client.m_endChar;
   m_buffer            = client.m_buffer;
+  m_announcements     = client.m_announcements;
+  m_lastAnnouncement  = client.m_lastAnnouncement;
+  m_output            = client.m_output;
+  m_outputOffset      = client.m_outputOffset;
+  m_lastOutput        = client.m_lastOutput;
+  m_failed            = client.m_failed;
 }
 
 CTCPServer::CWebSocketClient::CWebSocketClient(CWebSocket *websocket)
@@ -685,13 +865,41 @@ CTCPServer::CWebSocketClient& CTCPServer::CWebSocketClient::operator=(const CWeb
 
 void CTCPServer::CWebSocketClient::Send(const char *data, unsigned int size)
 {
+  // the websocket may keep compression state so messages must be framed one at a time
+  std::unique_lock lock(m_critSection);
   const CWebSocketMessage *msg = m_websocket->Send(WebSocketTextFrame, data, size);
   if (msg == NULL || !msg->IsComplete())
+  {
+    delete msg;
     return;
+  }
 
   std::vector<const CWebSocketFrame *> frames = msg->GetFrames();
   for (unsigned int index = 0; index < frames.size(); index++)
     CTCPClient::Send(frames.at(index)->GetFrameData(), (unsigned int)frames.at(index)->GetFrameLength());
+
+  delete msg;
+}
+
+void CTCPServer::CWebSocketClient::Send(const std::vector<std::string>& messages)
+{
+  // write the frames of all messages at once
+  std::unique_lock lock(m_critSection);
+  std::string data;
+  for (const auto& message : messages)
+  {
+    const CWebSocketMessage* msg =
+        m_websocket->Send(WebSocketTextFrame, message.c_str(), message.size());
+    if (msg != NULL && msg->IsComplete())
+    {
+      for (const CWebSocketFrame* frame : msg->GetFrames())
+        data.append(frame->GetFrameData(), static_cast<size_t>(frame->GetFrameLength()));
+    }
+    delete msg;
+  }
+
+  if (!data.empty())
+    CTCPClient::Send(data.c_str(), data.size());
 }
 
 void CTCPServer::CWebSocketClient::PushBuffer(CTCPServer *host, const char *buffer, int length)
@@ -15,6 +15,8 @@
 #include "threads/Thread.h"
 #include "websocket/WebSocket.h"
 
+#include <chrono>
+#include <string>
 #include <vector>
 
 #include <sys/socket.h>
@@ -65,9 +67,24 @@ namespace JSONRPC
       bool SetAnnouncementFlags(int flags) override;
 
       virtual void Send(const char *data, unsigned int size);
+      virtual void Send(const std::vector<std::string>& messages);
       virtual void PushBuffer(CTCPServer *host, const char *buffer, int length);
       virtual void Disconnect();
 
+      void QueueAnnouncement(const std::string& announcement);
+      void FlushAnnouncements();
+
+      /*!
+       \brief Write as much of the buffered output as the socket takes without blocking.
+       \return false if the connection failed
+       */
+      bool Flush();
+      size_t GetPendingOutput();
+      /*!
+       \brief Whether the client stopped taking its output and should be dropped.
+       */
+      bool IsStalled();
+
       virtual bool IsNew() const { return m_new; }
       virtual bool Closing() const { return false; }
 
@@ -84,6 +101,12 @@ namespace JSONRPC
       int m_beginBrackets, m_endBrackets;
       char m_beginChar, m_endChar;
       std::string m_buffer;
+      std::vector<std::string> m_announcements;
+      std::chrono::steady_clock::time_point m_lastAnnouncement;
+      std::string m_output;
+      size_t m_outputOffset{0};
+      std::chrono::steady_clock::time_point m_lastOutput;
+      bool m_failed{false};
     };
 
     class CWebSocketClient : public CTCPClient
@@ -96,6 +119,7 @@ namespace JSONRPC
       ~CWebSocketClient() override;
 
       void Send(const char *data, unsigned int size) override;
+      void Send(const std::vector<std::string>& messages) override;
       void PushBuffer(CTCPServer *host, const char *buffer, int length) override;
       void Disconnect() override;
 
@@ -12,8 +12,10 @@
 #include "ServiceBroker.h"
 #include "XBDateTime.h"
 #include "filesystem/File.h"
+#include "filesystem/SpecialProtocol.h"
 #include "network/httprequesthandler/HTTPRequestHandlerUtils.h"
 #include "network/httprequesthandler/IHTTPRequestHandler.h"
+#include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/FileUtils.h"
@@ -24,13 +26,16 @@
 #include "utils/log.h"
 
 #include <algorithm>
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <stdexcept>
 #include <utility>
 
 #if defined(TARGET_POSIX)
+#include <fcntl.h>
 #include <pthread.h>
+#include <unistd.h>
 #endif
 
 #include <inttypes.h>
@@ -60,6 +65,11 @@ typedef struct
   uint64_t writePosition;
 } HttpFileDownloadContext;
 
+typedef struct
+{
+  std::shared_ptr<IHTTPRequestHandler> handler;
+} HttpStreamDownloadContext;
+
 CWebServer::CWebServer()
   : m_authenticationUsername("kodi"),
     m_authenticationPassword(""),
@@ -92,6 +102,50 @@ static MHD_Response* create_response(size_t size, const void* data, int free, in
   return MHD_create_response_from_buffer(size, const_cast<void*>(data), mode);
 }
 
+static bool etag_matches(const std::string& ifNoneMatch, const std::string& etag)
+{
+  for (std::string tag : StringUtils::Split(ifNoneMatch, ","))
+  {
+    StringUtils::Trim(tag);
+    // If-None-Match uses the weak comparison
+    if (tag.starts_with("W/"))
+      tag.erase(0, 2);
+
+    if (tag == "*" || tag == etag)
+      return true;
+  }
+
+  return false;
+}
+
+static MHD_Response* create_local_file_response(const std::string& filePath,
+                                                uint64_t offset,
+                                                uint64_t length)
+{
+#if defined(TARGET_POSIX)
+  // local files are handed to mhd as a file descriptor so it can sendfile() them instead of
+  // copying every chunk through CFile and our content reader callback
+  if (!URIUtils::IsHD(filePath))
+    return nullptr;
+
+  const std::string localPath = CSpecialProtocol::TranslatePath(filePath);
+  if (localPath.empty() || localPath[0] != '/')
+    return nullptr;
+
+  const int fd = open(localPath.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0)
+    return nullptr;
+
+  MHD_Response* response = MHD_create_response_from_fd_at_offset64(length, fd, offset);
+  if (response == nullptr)
+    close(fd);
+
+  return response;
+#else
+  return nullptr;
+#endif
+}
+
 MHD_RESULT CWebServer::AskForAuthentication(const HTTPRequest& request) const
 {
   struct MHD_Response* response = create_response(0, nullptr, MHD_NO, MHD_NO);
@@ -209,6 +263,23 @@ MHD_RESULT CWebServer::HandlePartialRequest(struct MHD_Connection* connection,
         {
           bool cacheable = IsRequestCacheable(request);
 
+          // handle If-None-Match (but only if the response is cacheable)
+          const std::string ifNoneMatch = HTTPRequestHandlerUtils::GetRequestHeaderValue(
+              connection, MHD_HEADER_KIND, MHD_HTTP_HEADER_IF_NONE_MATCH);
+          std::string etag;
+          if (cacheable && !ifNoneMatch.empty() && handler->GetETag(etag) &&
+              etag_matches(ifNoneMatch, etag))
+          {
+            struct MHD_Response* response = create_response(0, nullptr, MHD_NO, MHD_NO);
+            if (response == nullptr)
+            {
+              m_logger->error("failed to create a HTTP 304 response");
+              return MHD_NO;
+            }
+
+            return FinalizeRequest(handler, MHD_HTTP_NOT_MODIFIED, response);
+          }
+
           CDateTime lastModified;
           if (handler->GetLastModifiedDate(lastModified) && lastModified.IsValid())
           {
@@ -220,8 +291,10 @@ MHD_RESULT CWebServer::HandlePartialRequest(struct MHD_Connection* connection,
 
             CDateTime ifModifiedSinceDate;
             CDateTime ifUnmodifiedSinceDate;
-            // handle If-Modified-Since (but only if the response is cacheable)
-            if (cacheable && ifModifiedSinceDate.SetFromRFC1123DateTime(ifModifiedSince) &&
+            // handle If-Modified-Since (but only if the response is cacheable and there was no
+            // If-None-Match, which takes precedence)
+            if (cacheable && ifNoneMatch.empty() &&
+                ifModifiedSinceDate.SetFromRFC1123DateTime(ifModifiedSince) &&
                 lastModified.GetAsUTCDateTime() <= ifModifiedSinceDate)
             {
               struct MHD_Response* response = create_response(0, nullptr, MHD_NO, MHD_NO);
@@ -325,6 +398,8 @@ MHD_RESULT CWebServer::HandleRequest(const std::shared_ptr<IHTTPRequestHandler>&
   if (handler == nullptr)
     return MHD_NO;
 
+  const auto start = std::chrono::steady_clock::now();
+
   HTTPRequest request = handler->GetRequest();
   MHD_RESULT ret = handler->HandleRequest();
   if (ret == MHD_NO)
@@ -349,6 +424,10 @@ MHD_RESULT CWebServer::HandleRequest(const std::shared_ptr<IHTTPRequestHandler>&
       ret = CreateFileDownloadResponse(handler, response);
       break;
 
+    case HTTPStreamDownload:
+      ret = CreateStreamDownloadResponse(handler, response);
+      break;
+
     case HTTPMemoryDownloadNoFreeNoCopy:
     case HTTPMemoryDownloadNoFreeCopy:
     case HTTPMemoryDownloadFreeNoCopy:
@@ -372,9 +451,31 @@ MHD_RESULT CWebServer::HandleRequest(const std::shared_ptr<IHTTPRequestHandler>&
     return SendErrorResponse(request, MHD_HTTP_INTERNAL_SERVER_ERROR, request.method);
   }
 
+  UpdateHandlerStatistics(*handler, std::chrono::duration_cast<std::chrono::microseconds>(
+                                        std::chrono::steady_clock::now() - start));
+
   return FinalizeRequest(handler, responseDetails.status, response);
 }
 
+void CWebServer::UpdateHandlerStatistics(const IHTTPRequestHandler& handler,
+                                         std::chrono::microseconds duration)
+{
+  if (!CServiceBroker::GetLogging().CanLogComponent(LOGWEBSERVER))
+    return;
+
+  const std::string name = handler.GetName();
+
+  std::unique_lock<CCriticalSection> lock(m_statisticsSection);
+  HandlerStatistics& statistics = m_handlerStatistics[name];
+  statistics.requests++;
+  statistics.total += duration;
+  statistics.max = std::max(statistics.max, duration);
+
+  m_logger->debug("{} handler took {} us (requests: {}, average: {} us, max: {} us)", name,
+                  duration.count(), statistics.requests,
+                  statistics.total.count() / statistics.requests, statistics.max.count());
+}
+
 MHD_RESULT CWebServer::FinalizeRequest(const std::shared_ptr<IHTTPRequestHandler>& handler,
                                        int responseStatus,
                                        struct MHD_Response* response)
@@ -394,6 +495,11 @@ MHD_RESULT CWebServer::FinalizeRequest(const std::shared_ptr<IHTTPRequestHandler
   if (handler->GetLastModifiedDate(lastModified) && lastModified.IsValid())
     handler->AddResponseHeader(MHD_HTTP_HEADER_LAST_MODIFIED, lastModified.GetAsRFC1123DateTime());
 
+  // if the request handler has an entity tag for the response, add it
+  std::string etag;
+  if (handler->CanBeCached() && handler->GetETag(etag))
+    handler->AddResponseHeader(MHD_HTTP_HEADER_ETAG, etag);
+
   // check if the request handler has set Cache-Control and add it if not
   if (!handler->HasResponseHeader(MHD_HTTP_HEADER_CACHE_CONTROL))
   {
@@ -887,18 +993,25 @@ MHD_RESULT CWebServer::CreateFileDownloadResponse(
   // set the initial write position
   context->ranges.GetFirstPosition(context->writePosition);
 
-  // create the response object
-  response =
-      MHD_create_response_from_callback(totalLength, 2048, &CWebServer::ContentReaderCallback,
-                                        context.get(), &CWebServer::ContentReaderFreeCallback);
+  // a single range of a local file doesn't need any boundaries so mhd can send it directly
+  if (context->rangeCountTotal == 1)
+    response = create_local_file_response(filePath, context->writePosition, totalLength);
+
   if (response == nullptr)
   {
-    m_logger->error("failed to create a HTTP response for {} to be filled from{}", request.pathUrl,
-                    filePath);
-    return MHD_NO;
-  }
+    // create the response object
+    response =
+        MHD_create_response_from_callback(totalLength, 2048, &CWebServer::ContentReaderCallback,
+                                          context.get(), &CWebServer::ContentReaderFreeCallback);
+    if (response == nullptr)
+    {
+      m_logger->error("failed to create a HTTP response for {} to be filled from{}",
+                      request.pathUrl, filePath);
+      return MHD_NO;
+    }
 
-  context.release(); // ownership was passed to mhd
+    context.release(); // ownership was passed to mhd
+  }
 
   // add Content-Range header
   if (ranged)
@@ -913,6 +1026,33 @@ MHD_RESULT CWebServer::CreateFileDownloadResponse(
   return MHD_YES;
 }
 
+MHD_RESULT CWebServer::CreateStreamDownloadResponse(
+    const std::shared_ptr<IHTTPRequestHandler>& handler, struct MHD_Response*& response) const
+{
+  if (handler == nullptr)
+    return MHD_NO;
+
+  const HTTPRequest& request = handler->GetRequest();
+
+  std::unique_ptr<HttpStreamDownloadContext> context =
+      std::make_unique<HttpStreamDownloadContext>();
+  context->handler = handler;
+
+  // the length is unknown so the response is sent with chunked transfer encoding
+  response = MHD_create_response_from_callback(MHD_SIZE_UNKNOWN, 64 * 1024,
+                                               &CWebServer::StreamReaderCallback, context.get(),
+                                               &CWebServer::StreamReaderFreeCallback);
+  if (response == nullptr)
+  {
+    m_logger->error("failed to create a HTTP response for {} to be streamed", request.pathUrl);
+    return MHD_NO;
+  }
+
+  context.release(); // ownership was passed to mhd
+
+  return MHD_YES;
+}
+
 MHD_RESULT CWebServer::CreateErrorResponse(struct MHD_Connection* connection,
                                            int responseType,
                                            HTTPMethod method,
@@ -1114,6 +1254,33 @@ void CWebServer::ContentReaderFreeCallback(void* cls)
     GetLogger()->debug("[OUT] done");
 }
 
+ssize_t CWebServer::StreamReaderCallback(void* cls, uint64_t pos, char* buf, size_t max)
+{
+  HttpStreamDownloadContext* context = static_cast<HttpStreamDownloadContext*>(cls);
+  if (context == nullptr || context->handler == nullptr)
+    return MHD_CONTENT_READER_END_WITH_ERROR;
+
+  ssize_t res = context->handler->ReadResponseStream(buf, max);
+  if (res < 0)
+    return MHD_CONTENT_READER_END_WITH_ERROR;
+  if (res == 0)
+    return MHD_CONTENT_READER_END_OF_STREAM;
+
+  if (CServiceBroker::GetLogging().CanLogComponent(LOGWEBSERVER))
+    GetLogger()->debug("[OUT] streamed {} bytes from {}", res, pos);
+
+  return res;
+}
+
+void CWebServer::StreamReaderFreeCallback(void* cls)
+{
+  HttpStreamDownloadContext* context = static_cast<HttpStreamDownloadContext*>(cls);
+  delete context;
+
+  if (CServiceBroker::GetLogging().CanLogComponent(LOGWEBSERVER))
+    GetLogger()->debug("[OUT] done");
+}
+
 static Logger GetMhdLogger()
 {
   return CServiceBroker::GetLogging().GetLogger("libmicrohttpd");
@@ -1191,9 +1358,35 @@ bool CWebServer::LoadCert(std::string& skey, std::string& scert)
 
 struct MHD_Daemon* CWebServer::StartMHD(unsigned int flags, int port)
 {
-  unsigned int timeout = 60 * 60 * 24;
+  const std::shared_ptr<CAdvancedSettings> advancedSettings =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+  const unsigned int timeout = advancedSettings->m_webserverConnectionTimeout;
+  const unsigned int connectionLimit = advancedSettings->m_webserverConnectionLimit;
   const char* ciphers = "PFS:-VERS-TLS1.0:-VERS-TLS1.1";
 
+  // one thread per connection by default
+  // WARNING: set MHD_OPTION_CONNECTION_TIMEOUT to something higher than 1
+  // otherwise on libmicrohttpd 0.4.4-1 it spins a busy loop
+  unsigned int threading = MHD_USE_THREAD_PER_CONNECTION;
+#if (MHD_VERSION >= 0x00095207)
+  // MHD_USE_THREAD_PER_CONNECTION must be used only with MHD_USE_INTERNAL_POLLING_THREAD since
+  // 0.9.54
+  threading |= MHD_USE_INTERNAL_POLLING_THREAD;
+#endif
+
+  // a fixed pool of worker threads each polling their share of the connections avoids spawning a
+  // thread for every short lived request of clients polling JSON-RPC
+  MHD_OptionItem threadPool[] = {{MHD_OPTION_END, 0, nullptr}, {MHD_OPTION_END, 0, nullptr}};
+#if (MHD_VERSION >= 0x00095300)
+  if (advancedSettings->m_webserverThreadPoolSize > 1)
+  {
+    // MHD_USE_AUTO picks epoll where it is available
+    threading = MHD_USE_INTERNAL_POLLING_THREAD | MHD_USE_AUTO;
+    threadPool[0] = {MHD_OPTION_THREAD_POOL_SIZE,
+                     static_cast<intptr_t>(advancedSettings->m_webserverThreadPoolSize), nullptr};
+  }
+#endif
+
   MHD_set_panic_func(&panicHandlerForMHD, nullptr);
 
   if (CServiceBroker::GetSettingsComponent()->GetSettings()->GetBool(
@@ -1201,45 +1394,25 @@ struct MHD_Daemon* CWebServer::StartMHD(unsigned int flags, int port)
       MHD_is_feature_supported(MHD_FEATURE_SSL) == MHD_YES && LoadCert(m_key, m_cert))
     // SSL enabled
     return MHD_start_daemon(
-        flags |
-            // one thread per connection
-            // WARNING: set MHD_OPTION_CONNECTION_TIMEOUT to something higher than 1
-            // otherwise on libmicrohttpd 0.4.4-1 it spins a busy loop
-            MHD_USE_THREAD_PER_CONNECTION
-#if (MHD_VERSION >= 0x00095207)
-            |
-            MHD_USE_INTERNAL_POLLING_THREAD /* MHD_USE_THREAD_PER_CONNECTION must be used only with
-                                               MHD_USE_INTERNAL_POLLING_THREAD since 0.9.54 */
-#endif
-            | MHD_USE_DEBUG /* Print MHD error messages to log */
+        flags | threading | MHD_USE_DEBUG /* Print MHD error messages to log */
             | MHD_USE_SSL,
         port, 0, 0, &CWebServer::AnswerToConnection, this,
 
-        MHD_OPTION_EXTERNAL_LOGGER, &logFromMHD, 0, MHD_OPTION_CONNECTION_LIMIT, 512,
+        MHD_OPTION_EXTERNAL_LOGGER, &logFromMHD, 0, MHD_OPTION_CONNECTION_LIMIT, connectionLimit,
         MHD_OPTION_CONNECTION_TIMEOUT, timeout, MHD_OPTION_URI_LOG_CALLBACK,
         &CWebServer::UriRequestLogger, this, MHD_OPTION_THREAD_STACK_SIZE, m_thread_stacksize,
         MHD_OPTION_HTTPS_MEM_KEY, m_key.c_str(), MHD_OPTION_HTTPS_MEM_CERT, m_cert.c_str(),
-        MHD_OPTION_HTTPS_PRIORITIES, ciphers, MHD_OPTION_END);
+        MHD_OPTION_HTTPS_PRIORITIES, ciphers, MHD_OPTION_ARRAY, threadPool, MHD_OPTION_END);
 
   // No SSL
   return MHD_start_daemon(
-      flags |
-          // one thread per connection
-          // WARNING: set MHD_OPTION_CONNECTION_TIMEOUT to something higher than 1
-          // otherwise on libmicrohttpd 0.4.4-1 it spins a busy loop
-          MHD_USE_THREAD_PER_CONNECTION
-#if (MHD_VERSION >= 0x00095207)
-          | MHD_USE_INTERNAL_POLLING_THREAD /* MHD_USE_THREAD_PER_CONNECTION must be used only with
-                                               MHD_USE_INTERNAL_POLLING_THREAD since 0.9.54 */
-#endif
-          | MHD_USE_DEBUG /* Print MHD error messages to log */
-      ,
+      flags | threading | MHD_USE_DEBUG /* Print MHD error messages to log */,
       port, 0, 0, &CWebServer::AnswerToConnection, this,
 
-      MHD_OPTION_EXTERNAL_LOGGER, &logFromMHD, 0, MHD_OPTION_CONNECTION_LIMIT, 512,
+      MHD_OPTION_EXTERNAL_LOGGER, &logFromMHD, 0, MHD_OPTION_CONNECTION_LIMIT, connectionLimit,
       MHD_OPTION_CONNECTION_TIMEOUT, timeout, MHD_OPTION_URI_LOG_CALLBACK,
       &CWebServer::UriRequestLogger, this, MHD_OPTION_THREAD_STACK_SIZE, m_thread_stacksize,
-      MHD_OPTION_END);
+      MHD_OPTION_ARRAY, threadPool, MHD_OPTION_END);
 }
 
 bool CWebServer::Start(uint16_t port, const std::string& username, const std::string& password)
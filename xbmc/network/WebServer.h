@@ -12,7 +12,10 @@
 #include "threads/CriticalSection.h"
 #include "utils/logtypes.h"
 
+#include <chrono>
+#include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace XFILE
@@ -76,6 +79,7 @@ private:
 
   MHD_RESULT CreateRedirect(struct MHD_Connection *connection, const std::string &strURL, struct MHD_Response *&response) const;
   MHD_RESULT CreateFileDownloadResponse(const std::shared_ptr<IHTTPRequestHandler>& handler, struct MHD_Response *&response) const;
+  MHD_RESULT CreateStreamDownloadResponse(const std::shared_ptr<IHTTPRequestHandler>& handler, struct MHD_Response *&response) const;
   MHD_RESULT CreateErrorResponse(struct MHD_Connection *connection, int responseType, HTTPMethod method, struct MHD_Response *&response) const;
   MHD_RESULT CreateMemoryDownloadResponse(struct MHD_Connection *connection, const void *data, size_t size, bool free, bool copy, struct MHD_Response *&response) const;
 
@@ -94,6 +98,8 @@ private:
 
   static ssize_t ContentReaderCallback (void *cls, uint64_t pos, char *buf, size_t max);
   static void ContentReaderFreeCallback(void *cls);
+  static ssize_t StreamReaderCallback(void *cls, uint64_t pos, char *buf, size_t max);
+  static void StreamReaderFreeCallback(void *cls);
 
   static MHD_RESULT AnswerToConnection (void *cls, struct MHD_Connection *connection,
                         const char *url, const char *method,
@@ -106,6 +112,9 @@ private:
 
   bool LoadCert(std::string &skey, std::string &scert);
 
+  void UpdateHandlerStatistics(const IHTTPRequestHandler& handler,
+                               std::chrono::microseconds duration);
+
   static Logger GetLogger();
 
   uint16_t m_port = 0;
@@ -121,5 +130,14 @@ private:
   mutable CCriticalSection m_critSection;
   std::vector<IHTTPRequestHandler *> m_requestHandlers;
 
+  struct HandlerStatistics
+  {
+    uint64_t requests = 0;
+    std::chrono::microseconds total{0};
+    std::chrono::microseconds max{0};
+  };
+  CCriticalSection m_statisticsSection;
+  std::map<std::string, HandlerStatistics> m_handlerStatistics;
+
   Logger m_logger;
 };
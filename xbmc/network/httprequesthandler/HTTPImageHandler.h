@@ -22,6 +22,7 @@ public:
   bool CanHandleRequest(const HTTPRequest &request) const override;
 
   int GetPriority() const override { return 5; }
+  std::string GetName() const override { return "image"; }
   int GetMaximumAgeForCaching() const override { return 60 * 60 * 24 * 7; }
 
 protected:
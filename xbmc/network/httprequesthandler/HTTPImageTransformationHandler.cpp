@@ -8,14 +8,20 @@
 
 #include "HTTPImageTransformationHandler.h"
 
+#include "ServiceBroker.h"
+#include "TextureCache.h"
 #include "TextureCacheJob.h"
 #include "URL.h"
+#include "filesystem/File.h"
 #include "filesystem/ImageFile.h"
+#include "imagefiles/ImageFileURL.h"
 #include "network/WebServer.h"
 #include "network/httprequesthandler/HTTPRequestHandlerUtils.h"
+#include "utils/Crc32.h"
 #include "utils/Mime.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
+#include "utils/log.h"
 
 #include <charconv>
 #include <map>
@@ -65,13 +71,48 @@ CHTTPImageTransformationHandler::CHTTPImageTransformationHandler(const HTTPReque
   StringUtils::ToLower(ext);
   m_response.contentType = CMime::GetMimeType(ext);
 
-  //! @todo determine the maximum age
+  // get the transformation options
+  std::map<std::string, std::string> options;
+  HTTPRequestHandlerUtils::GetRequestHeaderValues(m_request.connection, MHD_GET_ARGUMENT_KIND, options);
+
+  std::map<std::string, std::string>::const_iterator option = options.find(TRANSFORMATION_OPTION_WIDTH);
+  if (option != options.end())
+  {
+    const std::string& str = option->second;
+    std::from_chars(str.data(), str.data() + str.size(), m_width);
+  }
+
+  option = options.find(TRANSFORMATION_OPTION_HEIGHT);
+  if (option != options.end())
+  {
+    const std::string& str = option->second;
+    std::from_chars(str.data(), str.data() + str.size(), m_height);
+  }
+
+  option = options.find(TRANSFORMATION_OPTION_SCALING_ALGORITHM);
+  if (option != options.end())
+    m_scalingAlgorithm = CPictureScalingAlgorithm::FromString(option->second);
 
   // determine the last modified date
   struct __stat64 statBuffer;
   if (imageFile.Stat(pathToUrl, &statBuffer) != 0)
     return;
 
+  // the transformed image is cached under a key which changes with the source image, like the hash
+  // of CTextureCacheJob, so outdated copies are simply never used again and age out of the cache
+  if (statBuffer.st_mtime != 0 || statBuffer.st_size != 0)
+  {
+    IMAGE_FILES::CImageFileURL cacheUrl(m_url);
+    cacheUrl.AddOption("transform_width", std::to_string(m_width));
+    cacheUrl.AddOption("transform_height", std::to_string(m_height));
+    cacheUrl.AddOption("transform_scaling",
+                       CPictureScalingAlgorithm::ToString(m_scalingAlgorithm));
+    cacheUrl.AddOption("transform_hash",
+                       StringUtils::Format("d{}s{}", static_cast<int64_t>(statBuffer.st_mtime),
+                                           static_cast<int64_t>(statBuffer.st_size)));
+    m_cacheKey = cacheUrl.ToString();
+  }
+
   struct tm *time;
 #ifdef HAVE_LOCALTIME_R
   struct tm result = {};
@@ -111,34 +152,23 @@ MHD_RESULT CHTTPImageTransformationHandler::HandleRequest()
   if (m_response.type == HTTPError)
     return MHD_YES;
 
-  // get the transformation options
-  std::map<std::string, std::string> options;
-  HTTPRequestHandlerUtils::GetRequestHeaderValues(m_request.connection, MHD_GET_ARGUMENT_KIND, options);
-
-  unsigned int width = 0;
-  std::map<std::string, std::string>::const_iterator option = options.find(TRANSFORMATION_OPTION_WIDTH);
-  if (option != options.end())
+  // serve a previously transformed image straight from the texture cache
+  if (!m_cacheKey.empty())
   {
-    const std::string& str = option->second;
-    std::from_chars(str.data(), str.data() + str.size(), width);
-  }
-
-  unsigned int height = 0;
-  option = options.find(TRANSFORMATION_OPTION_HEIGHT);
-  if (option != options.end())
-  {
-    const std::string& str = option->second;
-    std::from_chars(str.data(), str.data() + str.size(), height);
+    bool needsRecaching;
+    const std::string cachedFile =
+        CServiceBroker::GetTextureCache()->CheckCachedImage(m_cacheKey, needsRecaching);
+    if (!cachedFile.empty() && XFILE::CFile::Exists(cachedFile))
+    {
+      m_cachedFile = cachedFile;
+      m_response.type = HTTPFileDownload;
+      return MHD_YES;
+    }
   }
 
-  auto scalingAlgorithm{CPictureScalingAlgorithm::NoAlgorithm};
-  option = options.find(TRANSFORMATION_OPTION_SCALING_ALGORITHM);
-  if (option != options.end())
-    scalingAlgorithm = CPictureScalingAlgorithm::FromString(option->second);
-
   // resize the image into the local buffer
   size_t bufferSize;
-  if (!CTextureCacheJob::ResizeTexture(m_url, height, width, scalingAlgorithm, m_buffer,
+  if (!CTextureCacheJob::ResizeTexture(m_url, m_height, m_width, m_scalingAlgorithm, m_buffer,
                                        bufferSize))
   {
     m_response.status = MHD_HTTP_INTERNAL_SERVER_ERROR;
@@ -147,6 +177,8 @@ MHD_RESULT CHTTPImageTransformationHandler::HandleRequest()
     return MHD_YES;
   }
 
+  CacheImage(bufferSize);
+
   // store the size of the image
   m_response.totalLength = bufferSize;
 
@@ -172,3 +204,41 @@ bool CHTTPImageTransformationHandler::GetLastModifiedDate(CDateTime &lastModifie
   lastModified = m_lastModified;
   return true;
 }
+
+bool CHTTPImageTransformationHandler::GetETag(std::string& etag) const
+{
+  if (m_cacheKey.empty())
+    return false;
+
+  etag = StringUtils::Format("\"{:08x}\"", Crc32::Compute(m_cacheKey));
+  return true;
+}
+
+void CHTTPImageTransformationHandler::CacheImage(size_t size) const
+{
+  if (m_cacheKey.empty() || m_buffer == nullptr || size == 0)
+    return;
+
+  // the image is encoded in the format of the source image
+  CTextureDetails details;
+  details.file = CTextureCache::GetCacheFile(m_cacheKey);
+  const std::string ext = URIUtils::GetExtension(CURL(m_url).GetHostName());
+  if (!ext.empty())
+    details.file += ext;
+  details.width = m_width;
+  details.height = m_height;
+
+  const std::string cachedFile = CTextureCache::GetCachedPath(details.file);
+  XFILE::CFile file;
+  if (!file.OpenForWrite(cachedFile, true) ||
+      file.Write(m_buffer, size) != static_cast<ssize_t>(size))
+  {
+    CLog::Log(LOGDEBUG, "CHTTPImageTransformationHandler: unable to cache {}", cachedFile);
+    file.Close();
+    XFILE::CFile::Delete(cachedFile);
+    return;
+  }
+  file.Close();
+
+  CServiceBroker::GetTextureCache()->AddCachedTexture(m_cacheKey, details);
+}
@@ -10,6 +10,7 @@
 
 #include "XBDateTime.h"
 #include "network/httprequesthandler/IHTTPRequestHandler.h"
+#include "pictures/PictureScalingAlgorithm.h"
 
 #include <stdint.h>
 #include <string>
@@ -28,19 +29,34 @@ public:
   bool CanHandleRanges() const override { return true; }
   bool CanBeCached() const override { return true; }
   bool GetLastModifiedDate(CDateTime &lastModified) const override;
+  bool GetETag(std::string& etag) const override;
+  int GetMaximumAgeForCaching() const override { return 60 * 60 * 24 * 7; }
+
+  std::string GetResponseFile() const override { return m_cachedFile; }
 
   HttpResponseRanges GetResponseData() const override { return m_responseData; }
 
   // priority must be higher than the one of CHTTPImageHandler
   int GetPriority() const override { return 6; }
+  std::string GetName() const override { return "imagetransformation"; }
 
 protected:
   explicit CHTTPImageTransformationHandler(const HTTPRequest &request);
 
 private:
+  void CacheImage(size_t size) const;
+
   std::string m_url;
   CDateTime m_lastModified;
 
+  unsigned int m_width = 0;
+  unsigned int m_height = 0;
+  CPictureScalingAlgorithm::Algorithm m_scalingAlgorithm = CPictureScalingAlgorithm::NoAlgorithm;
+
+  // texture cache key of the transformed image, empty if it can't be cached
+  std::string m_cacheKey;
+  std::string m_cachedFile;
+
   uint8_t* m_buffer;
   HttpResponseRanges m_responseData;
 };
@@ -13,12 +13,16 @@
 #include "interfaces/json-rpc/JSONRPC.h"
 #include "interfaces/json-rpc/JSONServiceDescription.h"
 #include "network/httprequesthandler/HTTPRequestHandlerUtils.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
 #include "utils/FileUtils.h"
 #include "utils/JSONVariantWriter.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
 
 #define MAX_HTTP_POST_SIZE 65536
+// responses up to this size are sent in one piece, larger ones are streamed while serializing
+#define MAX_HTTP_BUFFERED_RESPONSE_SIZE 65536
 
 bool CHTTPJsonRpcHandler::CanHandleRequest(const HTTPRequest &request) const
 {
@@ -72,10 +76,51 @@ MHD_RESULT CHTTPJsonRpcHandler::HandleRequest()
 
   if (isRequest)
   {
-    m_responseData = JSONRPC::CJSONRPC::MethodCall(m_requestData, &m_transportLayer, &client);
+    if (JSONRPC::CJSONRPC::MethodCall(m_requestData, &m_transportLayer, &client, m_result))
+    {
+      m_responseWriter = std::make_unique<CJSONVariantStreamWriter>(
+          m_result,
+          CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_jsonOutputCompact);
+
+      // serialize the beginning of the response to find out whether it has to be streamed
+      m_responseData.resize(MAX_HTTP_BUFFERED_RESPONSE_SIZE);
+      size_t length = 0;
+      while (length < m_responseData.size() && !m_responseWriter->IsDone())
+        length += m_responseWriter->Read(&m_responseData[length], m_responseData.size() - length);
+      m_responseData.resize(length);
+
+      if (m_responseWriter->HasFailed())
+        m_responseData.clear();
+
+      if (m_responseWriter->IsDone())
+      {
+        m_responseWriter.reset();
+        m_result.clear();
+      }
+    }
 
     if (!jsonpCallback.empty())
-      m_responseData = jsonpCallback + "(" + m_responseData + ");";
+    {
+      m_responseData = jsonpCallback + "(" + m_responseData;
+      m_responseSuffix = ");";
+      if (m_responseWriter == nullptr)
+      {
+        m_responseData += m_responseSuffix;
+        m_responseSuffix.clear();
+      }
+    }
+
+    if (m_responseWriter != nullptr)
+    {
+      m_requestData.clear();
+
+      m_response.type = HTTPStreamDownload;
+      m_response.status = MHD_HTTP_OK;
+      m_response.contentType = "application/json";
+      m_response.totalLength = 0;
+
+      return MHD_YES;
+    }
   }
   else if (jsonpCallback.empty())
   {
@@ -110,6 +155,50 @@ MHD_RESULT CHTTPJsonRpcHandler::HandleRequest()
   return MHD_YES;
 }
 
+ssize_t CHTTPJsonRpcHandler::ReadResponseStream(char* buffer, size_t size)
+{
+  size_t written = 0;
+
+  // first the part of the response which has already been serialized
+  if (m_responseOffset < m_responseData.size())
+  {
+    written = m_responseData.copy(buffer, size, m_responseOffset);
+    m_responseOffset += written;
+    if (m_responseOffset >= m_responseData.size())
+      std::string().swap(m_responseData);
+  }
+
+  while (written < size && m_responseWriter != nullptr)
+  {
+    if (m_responseWriter->IsDone())
+    {
+      const bool failed = m_responseWriter->HasFailed();
+      m_responseWriter.reset();
+      m_result.clear();
+
+      // the beginning of the response has already been sent so all we can do is abort
+      if (failed)
+      {
+        CLog::Log(LOGERROR, "CHTTPJsonRpcHandler: failed to serialize the JSON-RPC response");
+        return -1;
+      }
+      break;
+    }
+
+    written += m_responseWriter->Read(buffer + written, size - written);
+  }
+
+  // and finally the end of a JSONP response
+  if (written < size && m_responseWriter == nullptr && !m_responseSuffix.empty())
+  {
+    const size_t count = m_responseSuffix.copy(buffer + written, size - written);
+    m_responseSuffix.erase(0, count);
+    written += count;
+  }
+
+  return static_cast<ssize_t>(written);
+}
+
 HttpResponseRanges CHTTPJsonRpcHandler::GetResponseData() const
 {
   HttpResponseRanges ranges;
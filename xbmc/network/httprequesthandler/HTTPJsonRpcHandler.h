@@ -11,7 +11,10 @@
 #include "interfaces/json-rpc/IClient.h"
 #include "interfaces/json-rpc/ITransportLayer.h"
 #include "network/httprequesthandler/IHTTPRequestHandler.h"
+#include "utils/JSONVariantWriter.h"
+#include "utils/Variant.h"
 
+#include <memory>
 #include <string>
 
 class CHTTPJsonRpcHandler : public IHTTPRequestHandler
@@ -27,8 +30,10 @@ public:
   MHD_RESULT HandleRequest() override;
 
   HttpResponseRanges GetResponseData() const override;
+  ssize_t ReadResponseStream(char* buffer, size_t size) override;
 
   int GetPriority() const override { return 5; }
+  std::string GetName() const override { return "jsonrpc"; }
 
 protected:
   explicit CHTTPJsonRpcHandler(const HTTPRequest &request)
@@ -41,6 +46,10 @@ private:
   std::string m_requestData;
   std::string m_responseData;
   CHttpResponseRange m_responseRange;
+  CVariant m_result;
+  std::unique_ptr<CJSONVariantStreamWriter> m_responseWriter;
+  size_t m_responseOffset = 0;
+  std::string m_responseSuffix;
 
   class CHTTPTransportLayer : public JSONRPC::ITransportLayer
   {
@@ -32,6 +32,7 @@ public:
   std::string GetRedirectUrl() const override { return m_redirectUrl; }
 
   int GetPriority() const override { return 3; }
+  std::string GetName() const override { return "python"; }
 
 protected:
   explicit CHTTPPythonHandler(const HTTPRequest &request);
@@ -26,6 +26,7 @@ public:
   HttpResponseRanges GetResponseData() const override;
 
   int GetPriority() const override { return 4; }
+  std::string GetName() const override { return "webinterfaceaddons"; }
 
 protected:
   explicit CHTTPWebinterfaceAddonsHandler(const HTTPRequest &request)
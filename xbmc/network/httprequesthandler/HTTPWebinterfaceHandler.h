@@ -21,6 +21,7 @@ public:
 
   IHTTPRequestHandler* Create(const HTTPRequest &request) const override { return new CHTTPWebinterfaceHandler(request); }
   bool CanHandleRequest(const HTTPRequest &request) const override;
+  std::string GetName() const override { return "webinterface"; }
 
   static int ResolveUrl(const std::string &url, std::string &path);
   static int ResolveUrl(const std::string &url, std::string &path, ADDON::AddonPtr &addon);
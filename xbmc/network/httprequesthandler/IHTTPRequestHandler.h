@@ -60,7 +60,9 @@ typedef enum HTTPResponseType
   HTTPMemoryDownloadFreeNoCopy,
   // creates a HTTP response from a buffer by copying followed by freeing the buffer
   // the buffer must have been malloc'ed and not new'ed
-  HTTPMemoryDownloadFreeCopy
+  HTTPMemoryDownloadFreeCopy,
+  // creates a HTTP response of unknown length with the content provided piece by piece
+  HTTPStreamDownload
 } HTTPResponseType;
 
 typedef struct HTTPRequest
@@ -107,6 +109,12 @@ public:
    */
   virtual int GetPriority() const { return 0; }
 
+  /*!
+   * \brief Returns a short name identifying the HTTP request handler in logs
+   * and request statistics.
+   */
+  virtual std::string GetName() const { return "unknown"; }
+
   /*!
   * \brief Checks if the HTTP request handler can handle the given request.
   *
@@ -146,6 +154,13 @@ public:
   */
   virtual bool GetLastModifiedDate(CDateTime &lastModified) const { return false; }
 
+  /*!
+   * \brief Returns the entity tag (including the quotes) identifying the response data.
+   *
+   * \details This is only used if the response can be cached.
+   */
+  virtual bool GetETag(std::string& etag) const { return false; }
+
   /*!
    * \brief Returns the ranges with raw data belonging to the response.
    *
@@ -153,6 +168,18 @@ public:
    */
   virtual HttpResponseRanges GetResponseData() const { return HttpResponseRanges(); }
 
+  /*!
+   * \brief Fills the given buffer with the next part of the response data.
+   *
+   * \details This is only used if the response type is HTTPStreamDownload.
+   *
+   * \param buffer Buffer to be filled
+   * \param size Size of the buffer
+   * \return Number of bytes written to the buffer, 0 at the end of the data or a negative value
+   *         on error.
+   */
+  virtual ssize_t ReadResponseStream(char* buffer, size_t size) { return -1; }
+
   /*!
   * \brief Returns the URL to which the request should be redirected.
   *
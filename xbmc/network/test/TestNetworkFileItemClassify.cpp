@@ -214,3 +214,25 @@ TEST(TestNetworkWorkFileItemClassify, StreamedFilesystemStacks)
   EXPECT_FALSE(NETWORK::IsStreamedFilesystem(CFileItem(stackPath, false)));
   EXPECT_FALSE(NETWORK::IsStreamedFilesystem(CFileItem(stackPath, true)));
 }
+
+TEST(TestNetworkFileItemClassify, CachedClassification)
+{
+  CFileItem item("/home/user/movie.mkv", false);
+  EXPECT_FALSE(NETWORK::IsInternetStream(item));
+  EXPECT_FALSE(NETWORK::IsRemote(item));
+
+  // changing the path must drop the cached results
+  item.SetPath("http://some.where/movie.mkv");
+  EXPECT_TRUE(NETWORK::IsInternetStream(item));
+  EXPECT_TRUE(NETWORK::IsRemote(item));
+
+  // the dynamic path takes precedence for streams
+  item.SetDynPath("/home/user/movie.mkv");
+  EXPECT_FALSE(NETWORK::IsInternetStream(item));
+  EXPECT_FALSE(NETWORK::IsStreamedFilesystem(item));
+
+  // copies keep the results of the source item
+  const CFileItem copy(item);
+  EXPECT_FALSE(NETWORK::IsInternetStream(copy));
+  EXPECT_TRUE(NETWORK::IsRemote(copy));
+}
@@ -0,0 +1,106 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/VideoPlayer/Interface/TimingConstants.h"
+#include "network/PlaybackSync.h"
+#include "network/Socket.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <string_view>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+constexpr int TEST_PORT = 34899;
+
+bool WaitForReference(const CPlaybackSync& follower, const std::string& item, double& time)
+{
+  for (int i = 0; i < 300; ++i)
+  {
+    if (follower.GetReference(item, time))
+      return true;
+    std::this_thread::sleep_for(10ms);
+  }
+  return false;
+}
+} // namespace
+
+TEST(TestPlaybackSync, Loopback)
+{
+  CPlaybackSync master;
+  CPlaybackSync follower;
+  ASSERT_TRUE(master.SetMaster("127.0.0.1", TEST_PORT));
+  ASSERT_TRUE(follower.SetFollower("127.0.0.1", TEST_PORT));
+  EXPECT_EQ(CPlaybackSync::Role::MASTER, master.GetRole());
+  EXPECT_EQ(CPlaybackSync::Role::FOLLOWER, follower.GetRole());
+
+  const int64_t published = CPlaybackSync::GetTime();
+  master.Publish("movie.mkv", DVD_MSEC_TO_TIME(60000), DVD_PLAYSPEED_NORMAL);
+
+  double time;
+  ASSERT_TRUE(WaitForReference(follower, "movie.mkv", time));
+  const double elapsed =
+      static_cast<double>(CPlaybackSync::GetTime() - published) * DVD_TIME_BASE / 1000000;
+  // both use the same clock, so the offset is close to 0 and the reference is the playing time
+  // of the master advanced since it was published
+  EXPECT_LT(std::abs(time - (DVD_MSEC_TO_TIME(60000) + elapsed)), DVD_MSEC_TO_TIME(20));
+
+  const CPlaybackSync::Status status = follower.GetStatus();
+  EXPECT_TRUE(status.synchronised);
+  EXPECT_LT(std::abs(status.offset), 5000);
+
+  // another item or a paused master isn't followed
+  EXPECT_FALSE(follower.GetReference("other.mkv", time));
+  master.Publish("movie.mkv", DVD_MSEC_TO_TIME(60000), DVD_PLAYSPEED_PAUSE);
+  std::this_thread::sleep_for(500ms);
+  EXPECT_FALSE(follower.GetReference("movie.mkv", time));
+
+  follower.Leave();
+  EXPECT_EQ(CPlaybackSync::Role::NONE, follower.GetRole());
+  EXPECT_FALSE(follower.GetReference("movie.mkv", time));
+}
+
+TEST(TestPlaybackSync, Requests)
+{
+  using namespace SOCKETS;
+
+  CPlaybackSync master;
+  ASSERT_TRUE(master.SetMaster("127.0.0.1", TEST_PORT));
+  master.Publish("movie.mkv", DVD_MSEC_TO_TIME(60000), DVD_PLAYSPEED_NORMAL);
+
+  std::unique_ptr<CUDPSocket> socket = CSocketFactory::CreateUDPSocket();
+  ASSERT_TRUE(socket && socket->Bind(CAddress("127.0.0.1"), 0));
+  CSocketListener listener;
+  listener.AddSocket(socket.get());
+  CAddress address("127.0.0.1");
+  address.saddr.saddr4.sin_port = htons(TEST_PORT);
+
+  // version 2 request
+  std::array<uint8_t, 64> request{'K', 'S', 'Y', 'N', 2, 1};
+  std::array<uint8_t, 1024> response;
+
+  // a request smaller than the response isn't answered
+  socket->SendTo(address, 16, request.data());
+  EXPECT_FALSE(listener.Listen(200));
+
+  // the response is as large as the request and doesn't hold the name of the item
+  socket->SendTo(address, static_cast<int>(request.size()), request.data());
+  ASSERT_TRUE(listener.Listen(1000));
+  CAddress from;
+  const int size = socket->Read(from, static_cast<int>(response.size()), response.data());
+  EXPECT_EQ(static_cast<int>(request.size()), size);
+  EXPECT_EQ(2, response[5]);
+  const std::string_view item = "movie";
+  EXPECT_TRUE(std::ranges::search(response, item).empty());
+}
@@ -20,6 +20,7 @@
 #include "UPnPSettings.h"
 #include "URL.h"
 #include "cores/playercorefactory/PlayerCoreFactory.h"
+#include "filesystem/NptXbmcFile.h"
 #include "interfaces/AnnouncementManager.h"
 #include "messaging/ApplicationMessenger.h"
 #include "network/Network.h"
@@ -838,6 +839,9 @@ void CUPnP::StopServer()
 
   m_UPnP->RemoveDevice(m_ServerHolder->m_Device);
   m_ServerHolder->m_Device = NULL;
+
+  // don't keep connections to the sources of the files served last
+  NPT_XbmcFileCachePool::Clear();
 }
 
 /*----------------------------------------------------------------------
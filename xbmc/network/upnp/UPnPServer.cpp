@@ -80,6 +80,9 @@ const char* video_containers[] = {
     "library://video/movies/titles.xml/", "library://video/tvshows/titles.xml/",
     "videodb://recentlyaddedmovies/", "videodb://recentlyaddedepisodes/"};
 
+// the DIDL-Lite cache is simply dropped once it grows beyond this
+constexpr size_t DIDL_CACHE_MAX_ENTRIES = 20000;
+
 /*----------------------------------------------------------------------
 |   CUPnPServer::CUPnPServer
 +---------------------------------------------------------------------*/
@@ -134,8 +137,9 @@ NPT_Result CUPnPServer::SetupServices()
   OnScanCompleted(VideoLibrary);
 
   // now safe to start passing on new notifications
-  CServiceBroker::GetAnnouncementManager()->AddAnnouncer(this, ANNOUNCEMENT::VideoLibrary |
-                                                                   ANNOUNCEMENT::AudioLibrary);
+  CServiceBroker::GetAnnouncementManager()->AddAnnouncer(
+      this, ANNOUNCEMENT::VideoLibrary | ANNOUNCEMENT::AudioLibrary,
+      ANNOUNCEMENT::AnnouncerQueue::COALESCE);
 
   return result;
 }
@@ -158,6 +162,7 @@ void CUPnPServer::OnScanCompleted(int type)
   else
     return;
   m_scanning = false;
+  ClearDidlCache();
   PropagateUpdates();
 }
 
@@ -225,6 +230,15 @@ failed:
   m_logger->error("Unable to propagate updates");
 }
 
+/*----------------------------------------------------------------------
+|   CUPnPServer::ClearDidlCache
++---------------------------------------------------------------------*/
+void CUPnPServer::ClearDidlCache()
+{
+  NPT_AutoLock lock(m_DidlMutex);
+  m_DidlCache.clear();
+}
+
 /*----------------------------------------------------------------------
 |   CUPnPServer::SetupIcons
 +---------------------------------------------------------------------*/
@@ -533,6 +547,8 @@ void CUPnPServer::Announce(AnnouncementFlag flag,
   }
   else
   {
+    ClearDidlCache();
+
     // handle both updates & removals
     if (!data["item"].isNull())
     {
@@ -792,6 +808,20 @@ NPT_Result CUPnPServer::OnBrowseDirectChildren(PLT_ActionReference& action,
     return NPT_FAILURE;
   }
 
+  // Don't pass parent_id if action is Search not BrowseDirectChildren, as
+  // we want the engine to determine the best parent id, not necessarily the one
+  // passed
+  NPT_String action_name = action->GetActionDesc().GetName();
+  const char* response_parent_id =
+      (action_name.Compare("Search", true) == 0) ? NULL : parent_id.GetChars();
+
+  // the flat library containers can hold tens of thousands of items, let the
+  // database sort them and only hand out the requested window
+  if (GetLibraryPage(static_cast<const char*>(parent_id), filter, starting_index, requested_count,
+                     sort_criteria, items))
+    return BuildResponse(action, items, filter, starting_index, requested_count, sort_criteria,
+                         context, response_parent_id, true);
+
   items.SetPath(static_cast<const char*>(parent_id));
 
   // guard against loading while saving to the same cache file
@@ -867,13 +897,146 @@ NPT_Result CUPnPServer::OnBrowseDirectChildren(PLT_ActionReference& action,
     }
   }
 
-  // Don't pass parent_id if action is Search not BrowseDirectChildren, as
-  // we want the engine to determine the best parent id, not necessarily the one
-  // passed
-  NPT_String action_name = action->GetActionDesc().GetName();
   return BuildResponse(action, items, filter, starting_index, requested_count, sort_criteria,
-                       context,
-                       (action_name.Compare("Search", true) == 0) ? NULL : parent_id.GetChars());
+                       context, response_parent_id);
+}
+
+/*----------------------------------------------------------------------
+|   GetSortFromCriteria
++---------------------------------------------------------------------*/
+static bool GetSortFromCriteria(const char* sort_criteria,
+                                const std::string& media_type,
+                                SortDescription& sorting)
+{
+  // only the first criterion is honoured, eg "+dc:title,-dc:date"
+  std::string criteria = sort_criteria ? sort_criteria : "";
+  criteria = criteria.substr(0, criteria.find(','));
+  StringUtils::Trim(criteria);
+  if (criteria.empty())
+    return false;
+
+  sorting.sortOrder = SortOrderAscending;
+  if (criteria[0] == '-' || criteria[0] == '+')
+  {
+    if (criteria[0] == '-')
+      sorting.sortOrder = SortOrderDescending;
+    criteria.erase(0, 1);
+  }
+
+  if (criteria == "dc:title")
+  {
+    if (media_type == MediaTypeAlbum)
+      sorting.sortBy = SortByAlbum;
+    else if (media_type == MediaTypeArtist)
+      sorting.sortBy = SortByArtist;
+    else
+      sorting.sortBy = SortByTitle;
+  }
+  else if (criteria == "dc:date")
+    sorting.sortBy = SortByYear;
+  else if (criteria == "upnp:album")
+    sorting.sortBy = SortByAlbum;
+  else if (criteria == "upnp:artist" || criteria == "dc:creator")
+    sorting.sortBy = SortByArtist;
+  else if (criteria == "upnp:genre")
+    sorting.sortBy = SortByGenre;
+  else if (criteria == "upnp:originalTrackNumber")
+    sorting.sortBy = SortByTrackNumber;
+  else
+    return false;
+
+  return true;
+}
+
+/*----------------------------------------------------------------------
+|   CUPnPServer::GetLibraryPage
++---------------------------------------------------------------------*/
+bool CUPnPServer::GetLibraryPage(const std::string& path,
+                                 const NPT_String& filter,
+                                 NPT_UInt32 starting_index,
+                                 NPT_UInt32 requested_count,
+                                 const char* sort_criteria,
+                                 CFileItemList& items)
+{
+  std::string media_type;
+  if (path == "musicdb://songs/")
+    media_type = MediaTypeSong;
+  else if (path == "musicdb://albums/")
+    media_type = MediaTypeAlbum;
+  else if (path == "musicdb://artists/")
+    media_type = MediaTypeArtist;
+  else if (path == "videodb://movies/titles/")
+    media_type = MediaTypeMovie;
+  else if (path == "videodb://tvshows/titles/")
+    media_type = MediaTypeTvShow;
+  else if (path == "videodb://musicvideos/titles/")
+    media_type = MediaTypeMusicVideo;
+  else
+    return false;
+
+  // same order as a full listing of the container would have, unless the
+  // client asked for something we can sort by
+  SortDescription sorting;
+  if (!GetSortFromCriteria(sort_criteria, media_type, sorting))
+  {
+    CFileItemList container(path);
+    std::unique_ptr<CGUIViewState> viewState(CGUIViewState::GetViewState(
+        IsVideoDb(container) ? WINDOW_VIDEO_NAV : -1, container));
+    if (viewState)
+      sorting = viewState->GetSortMethod();
+  }
+
+  const NPT_UInt32 max_count =
+      (requested_count == 0) ? m_MaxReturnedItems : std::min(requested_count, m_MaxReturnedItems);
+  sorting.limitStart = static_cast<int>(starting_index);
+  sorting.limitEnd = static_cast<int>(starting_index + max_count);
+
+  items.SetPath(path);
+
+  bool result;
+  if (StringUtils::StartsWith(path, "musicdb://"))
+  {
+    CMusicDatabase db;
+    if (!db.Open())
+      return false;
+
+    if (media_type == MediaTypeSong)
+      result = db.GetSongsByWhere(path, CDatabase::Filter(), items, sorting);
+    else if (media_type == MediaTypeAlbum)
+      result = db.GetAlbumsByWhere(path, CDatabase::Filter(), items, sorting);
+    else
+      result = db.GetArtistsNav(path, items,
+                                !CServiceBroker::GetSettingsComponent()->GetSettings()->GetBool(
+                                    CSettings::SETTING_MUSICLIBRARY_SHOWCOMPILATIONARTISTS),
+                                -1, -1, -1, CDatabase::Filter(), sorting);
+  }
+  else
+  {
+    CVideoDatabase db;
+    if (!db.Open())
+      return false;
+
+    const int details = GetRequiredVideoDbDetails(filter);
+    if (media_type == MediaTypeMovie)
+      result = db.GetMoviesNav(path, items, -1, -1, -1, -1, -1, -1, -1, -1, sorting, details);
+    else if (media_type == MediaTypeTvShow)
+      result = db.GetTvShowsNav(path, items, -1, -1, -1, -1, -1, -1, sorting, details);
+    else
+      result = db.GetMusicVideosNav(path, items, -1, -1, -1, -1, -1, -1, -1, sorting, details);
+  }
+
+  if (!result)
+  {
+    // let the regular directory listing have a go
+    items.Clear();
+    return false;
+  }
+
+  // a window past the end isn't trimmed by the sorting, make sure it comes back empty
+  if (static_cast<int>(starting_index) >= items.GetProperty("total").asInteger())
+    items.ClearItems();
+
+  return true;
 }
 
 /*----------------------------------------------------------------------
@@ -886,7 +1049,8 @@ NPT_Result CUPnPServer::BuildResponse(PLT_ActionReference& action,
                                       NPT_UInt32 requested_count,
                                       const char* sort_criteria,
                                       const PLT_HttpRequestContext& context,
-                                      const char* parent_id /* = NULL */)
+                                      const char* parent_id /* = NULL */,
+                                      bool paged /* = false */)
 {
   NPT_COMPILER_UNUSED(sort_criteria);
 
@@ -930,25 +1094,60 @@ NPT_Result CUPnPServer::BuildResponse(PLT_ActionReference& action,
   NPT_UInt32 max_count = (requested_count == 0) ? m_MaxReturnedItems
                                                 : std::min((unsigned long)requested_count,
                                                            (unsigned long)m_MaxReturnedItems);
-  NPT_UInt32 stop_index = std::min((unsigned long)(starting_index + max_count),
+  // a paged list only holds the requested window, the size of the whole
+  // container was reported by the database
+  NPT_UInt32 first_index = paged ? 0 : starting_index;
+  NPT_UInt32 stop_index = std::min((unsigned long)(first_index + max_count),
                                    (unsigned long)items.Size()); // don't return more than we can
 
   NPT_Cardinal count = 0;
-  NPT_Cardinal total = items.Size();
+  NPT_Cardinal total =
+      paged ? static_cast<NPT_Cardinal>(items.GetProperty("total").asInteger()) : items.Size();
   NPT_String didl = didl_header;
   PLT_MediaObjectReference object;
-  for (unsigned long i = starting_index; i < stop_index; ++i)
+
+  // the DIDL of an item depends on what was asked for and how the client
+  // reaches us, so all of that goes into the cache key
+  const std::string cache_prefix = StringUtils::Format(
+      "{}|{}|{}|{}|{}|", items.GetPath(), filter, parent_id ? parent_id : "",
+      static_cast<int>(GetClientQuirks(&context)),
+      context.GetLocalAddress().ToString().GetChars());
+
+  for (unsigned long i = first_index; i < stop_index; ++i)
   {
-    object = Build(items[i], true, context, thumb_loader, parent_id);
-    if (object.IsNull())
+    NPT_String tmp;
+    const bool cacheable = URIUtils::IsMusicDb(items[i]->GetPath()) ||
+                           URIUtils::IsVideoDb(items[i]->GetPath()) ||
+                           StringUtils::StartsWith(items[i]->GetPath(), "library://");
+    const std::string cache_key = cache_prefix + items[i]->GetPath();
+    if (cacheable)
     {
-      // don't tell the client this item ever existed
-      --total;
-      continue;
+      NPT_AutoLock lock(m_DidlMutex);
+      auto cached = m_DidlCache.find(cache_key);
+      if (cached != m_DidlCache.end())
+        tmp = cached->second;
     }
 
-    NPT_String tmp;
-    NPT_CHECK(PLT_Didl::ToDidl(*object.AsPointer(), filter, tmp));
+    if (tmp.IsEmpty())
+    {
+      object = Build(items[i], true, context, thumb_loader, parent_id);
+      if (object.IsNull())
+      {
+        // don't tell the client this item ever existed
+        --total;
+        continue;
+      }
+
+      NPT_CHECK(PLT_Didl::ToDidl(*object.AsPointer(), filter, tmp));
+
+      if (cacheable)
+      {
+        NPT_AutoLock lock(m_DidlMutex);
+        if (m_DidlCache.size() >= DIDL_CACHE_MAX_ENTRIES)
+          m_DidlCache.clear();
+        m_DidlCache[cache_key] = tmp;
+      }
+    }
 
     // Neptunes string growing is dead slow for small additions
     if (didl.GetCapacity() < tmp.GetLength() + didl.GetLength())
@@ -112,6 +112,14 @@ public:
     void OnScanCompleted(int type);
     void UpdateContainer(const std::string& id);
     void PropagateUpdates();
+    void ClearDidlCache();
+
+    bool GetLibraryPage(const std::string& path,
+                        const NPT_String& filter,
+                        NPT_UInt32 starting_index,
+                        NPT_UInt32 requested_count,
+                        const char* sort_criteria,
+                        CFileItemList& items);
 
     PLT_MediaObject* Build(const std::shared_ptr<CFileItem>& item,
                            bool with_count,
@@ -125,7 +133,8 @@ public:
                              NPT_UInt32                    requested_count,
                              const char*                   sort_criteria,
                              const PLT_HttpRequestContext& context,
-                             const char*                   parent_id /* = NULL */);
+                             const char*                   parent_id /* = NULL */,
+                             bool                          paged = false);
 
     // class methods
     static void DefaultSortItems(CFileItemList& items);
@@ -142,6 +151,10 @@ public:
 
     NPT_Mutex m_CacheMutex;
 
+    // DIDL-Lite fragments of library items, dropped on any library change
+    NPT_Mutex m_DidlMutex;
+    std::map<std::string, NPT_String> m_DidlCache;
+
     NPT_Mutex m_FileMutex;
     NPT_Map<NPT_String, NPT_String> m_FileMap;
 
@@ -43,10 +43,8 @@ CWebSocketFrame::CWebSocketFrame(const char* data, uint64_t length)
 
   // Get the FIN flag
   m_final = ((m_data[0] & MASK_FIN) == MASK_FIN);
-  // Get the RSV1 - RSV3 flags
-  m_extension |= m_data[0] & MASK_RSV1;
-  m_extension |= (m_data[0] & MASK_RSV2) << 1;
-  m_extension |= (m_data[0] & MASK_RSV3) << 2;
+  // Get the RSV1 - RSV3 flags (in the same order as they are set when creating a frame)
+  m_extension = (m_data[0] & MASK_RSV) >> 4;
   // Get the opcode
   m_opcode = (WebSocketFrameOpcode)(m_data[0] & MASK_OPCODE);
   if (m_opcode >= WebSocketUnknownFrame)
@@ -371,7 +369,7 @@ const CWebSocketMessage* CWebSocket::Handle(const char* &buffer, size_t &length,
             return NULL;
         }
 
-        CWebSocketMessage *msg = m_message;
+        CWebSocketMessage *msg = DecodeMessage(m_message);
         m_message = NULL;
         return msg;
       }
@@ -412,7 +410,12 @@ const CWebSocketMessage* CWebSocket::Handle(const char* &buffer, size_t &length,
 
 const CWebSocketMessage* CWebSocket::Send(WebSocketFrameOpcode opcode, const char* data /* = NULL */, uint32_t length /* = 0 */)
 {
-  CWebSocketFrame *frame = GetFrame(opcode, data, length);
+  return send(opcode, data, length, 0);
+}
+
+const CWebSocketMessage* CWebSocket::send(WebSocketFrameOpcode opcode, const char* data, uint32_t length, int8_t extension)
+{
+  CWebSocketFrame *frame = GetFrame(opcode, data, length, true, false, 0, extension);
   if (frame == NULL || !frame->IsValid())
   {
     CLog::Log(LOGINFO, "WebSocket: Trying to send an invalid frame");
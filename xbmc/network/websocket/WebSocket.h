@@ -133,4 +133,12 @@ protected:
   virtual CWebSocketFrame* GetFrame(const char* data, uint64_t length) = 0;
   virtual CWebSocketFrame* GetFrame(WebSocketFrameOpcode opcode, const char* data = NULL, uint32_t length = 0, bool final = true, bool masked = false, int32_t mask = 0, int8_t extension = 0) = 0;
   virtual CWebSocketMessage* GetMessage() = 0;
+
+  /*!
+   * \brief Turns a complete message as received into the message to process, e.g. by undoing
+   * a negotiated compression. Returns NULL if the message has to be dropped.
+   */
+  virtual CWebSocketMessage* DecodeMessage(CWebSocketMessage* message) { return message; }
+
+  const CWebSocketMessage* send(WebSocketFrameOpcode opcode, const char* data, uint32_t length, int8_t extension);
 };
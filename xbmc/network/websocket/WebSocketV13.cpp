@@ -15,9 +15,12 @@
 #include "utils/log.h"
 
 #include <algorithm>
+#include <cstring>
 #include <sstream>
 #include <string>
 
+#include <zlib.h>
+
 #define WS_HTTP_METHOD          "GET"
 #define WS_HTTP_TAG             "HTTP/"
 
@@ -30,10 +33,35 @@
 #define WS_HEADER_ACCEPT        "Sec-WebSocket-Accept"
 #define WS_HEADER_PROTOCOL      "Sec-WebSocket-Protocol"
 #define WS_HEADER_PROTOCOL_LC   "sec-websocket-protocol"    // "Sec-WebSocket-Protocol"
+#define WS_HEADER_EXTENSIONS    "Sec-WebSocket-Extensions"
+#define WS_HEADER_EXTENSIONS_LC "sec-websocket-extensions"  // "Sec-WebSocket-Extensions"
 
 #define WS_PROTOCOL_JSONRPC     "jsonrpc.xbmc.org"
 #define WS_HEADER_UPGRADE_VALUE "websocket"
 
+#define WS_EXTENSION_DEFLATE          "permessage-deflate"
+#define WS_EXTENSION_DEFLATE_RESPONSE WS_EXTENSION_DEFLATE "; server_no_context_takeover; client_no_context_takeover"
+// the RSV1 flag marks compressed messages
+#define WS_EXTENSION_DEFLATE_FLAG     0x04
+
+namespace
+{
+// smaller messages (like most responses) aren't worth compressing
+constexpr uint32_t DeflateMinLength = 256;
+// limit of a decompressed message to protect against decompression bombs
+constexpr size_t InflateMaxLength = 1024 * 1024;
+// the tail of a sync flush which is stripped from compressed messages
+constexpr char DeflateTail[] = {'\x00', '\x00', '\xff', '\xff'};
+} // namespace
+
+CWebSocketV13::~CWebSocketV13()
+{
+  if (m_deflateStream)
+    deflateEnd(m_deflateStream.get());
+  if (m_inflateStream)
+    inflateEnd(m_inflateStream.get());
+}
+
 bool CWebSocketV13::Handshake(const char* data, size_t length, std::string &response)
 {
   std::string strHeader(data, length);
@@ -127,6 +155,10 @@ bool CWebSocketV13::Handshake(const char* data, size_t length, std::string &resp
     }
   }
 
+  // There might be a "Sec-WebSocket-Extensions" header
+  value = header.getValue(WS_HEADER_EXTENSIONS_LC);
+  m_deflate = value && negotiateDeflate(value);
+
   CHttpResponse httpResponse(HTTP::Get, HTTP::SwitchingProtocols, HTTP::Version1_1);
   httpResponse.AddHeader(WS_HEADER_UPGRADE, WS_HEADER_UPGRADE_VALUE);
   httpResponse.AddHeader(WS_HEADER_CONNECTION, WS_HEADER_UPGRADE);
@@ -134,6 +166,8 @@ bool CWebSocketV13::Handshake(const char* data, size_t length, std::string &resp
   httpResponse.AddHeader(WS_HEADER_ACCEPT, responseKey);
   if (!websocketProtocol.empty())
     httpResponse.AddHeader(WS_HEADER_PROTOCOL, websocketProtocol);
+  if (m_deflate)
+    httpResponse.AddHeader(WS_HEADER_EXTENSIONS, WS_EXTENSION_DEFLATE_RESPONSE);
 
   response = httpResponse.Create();
 
@@ -152,3 +186,149 @@ const CWebSocketFrame* CWebSocketV13::Close(WebSocketCloseReason reason /* = Web
 
   return close(reason, message);
 }
+
+const CWebSocketMessage* CWebSocketV13::Send(WebSocketFrameOpcode opcode, const char* data /* = NULL */, uint32_t length /* = 0 */)
+{
+  if (m_deflate && data != NULL && length >= DeflateMinLength &&
+      (opcode == WebSocketTextFrame || opcode == WebSocketBinaryFrame))
+  {
+    std::string compressed;
+    if (deflate(data, length, compressed))
+      return send(opcode, compressed.c_str(), static_cast<uint32_t>(compressed.size()), WS_EXTENSION_DEFLATE_FLAG);
+  }
+
+  return CWebSocketV8::Send(opcode, data, length);
+}
+
+CWebSocketMessage* CWebSocketV13::DecodeMessage(CWebSocketMessage* message)
+{
+  const std::vector<const CWebSocketFrame*>& frames = message->GetFrames();
+  if (frames.empty() || (frames.front()->GetExtension() & WS_EXTENSION_DEFLATE_FLAG) == 0)
+    return message;
+
+  std::string compressed;
+  for (const CWebSocketFrame* frame : frames)
+  {
+    if (frame->GetLength() > 0)
+      compressed.append(frame->GetApplicationData(), static_cast<size_t>(frame->GetLength()));
+  }
+  compressed.append(DeflateTail, sizeof(DeflateTail));
+
+  std::string data;
+  if (!m_deflate || !inflate(compressed, data))
+  {
+    CLog::Log(LOGINFO, "WebSocket [RFC6455]: invalid compressed message received");
+    delete message;
+    Fail();
+    return NULL;
+  }
+
+  CWebSocketMessage* msg = GetMessage();
+  if (msg != NULL)
+    msg->AddFrame(GetFrame(frames.front()->GetOpcode(), data.c_str(), static_cast<uint32_t>(data.size())));
+
+  delete message;
+  return msg;
+}
+
+bool CWebSocketV13::negotiateDeflate(const std::string& extensions) const
+{
+  // accept the first permessage-deflate offer we can fulfil. We always reset the compression
+  // context after every message which clients must accept, see RFC 7692 7.1.1
+  for (const std::string& offer : StringUtils::Split(extensions, ","))
+  {
+    std::vector<std::string> parameters = StringUtils::Split(offer, ";");
+    if (parameters.empty() ||
+        !StringUtils::EqualsNoCase(StringUtils::Trim(parameters.front()), WS_EXTENSION_DEFLATE))
+      continue;
+
+    // we don't limit our window so we can't take an offer asking for that
+    const bool acceptable = std::all_of(parameters.begin() + 1, parameters.end(), [](std::string& parameter) {
+      StringUtils::Trim(parameter);
+      return parameter == "server_no_context_takeover" || parameter == "client_no_context_takeover" ||
+             StringUtils::StartsWith(parameter, "client_max_window_bits");
+    });
+    if (acceptable)
+      return true;
+  }
+
+  return false;
+}
+
+bool CWebSocketV13::deflate(const char* data, uint32_t length, std::string& result)
+{
+  if (!m_deflateStream)
+  {
+    m_deflateStream = std::make_unique<z_stream>();
+    std::memset(m_deflateStream.get(), 0, sizeof(z_stream));
+    if (deflateInit2(m_deflateStream.get(), Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8,
+                     Z_DEFAULT_STRATEGY) != Z_OK)
+    {
+      CLog::Log(LOGWARNING, "WebSocket [RFC6455]: failed to initialize compression");
+      m_deflateStream.reset();
+      m_deflate = false;
+      return false;
+    }
+  }
+
+  z_stream* stream = m_deflateStream.get();
+  stream->next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+  stream->avail_in = length;
+
+  // leave some room for the block and the empty block of the sync flush
+  result.resize(deflateBound(stream, length) + 16);
+  stream->next_out = reinterpret_cast<Bytef*>(result.data());
+  stream->avail_out = static_cast<uInt>(result.size());
+
+  const int ret = ::deflate(stream, Z_SYNC_FLUSH);
+  const bool flushed = stream->avail_out > 0;
+  result.resize(result.size() - stream->avail_out);
+  deflateReset(stream);
+
+  if (ret != Z_OK || !flushed || result.size() < sizeof(DeflateTail))
+    return false;
+
+  // the receiver appends the tail again before decompressing
+  result.resize(result.size() - sizeof(DeflateTail));
+
+  return result.size() < length;
+}
+
+bool CWebSocketV13::inflate(const std::string& data, std::string& result)
+{
+  if (!m_inflateStream)
+  {
+    m_inflateStream = std::make_unique<z_stream>();
+    std::memset(m_inflateStream.get(), 0, sizeof(z_stream));
+    if (inflateInit2(m_inflateStream.get(), -MAX_WBITS) != Z_OK)
+    {
+      m_inflateStream.reset();
+      return false;
+    }
+  }
+
+  z_stream* stream = m_inflateStream.get();
+  stream->next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+  stream->avail_in = static_cast<uInt>(data.size());
+
+  result.clear();
+  char buffer[16384];
+  bool success = true;
+  int ret;
+  do
+  {
+    stream->next_out = reinterpret_cast<Bytef*>(buffer);
+    stream->avail_out = sizeof(buffer);
+    ret = ::inflate(stream, Z_SYNC_FLUSH);
+    result.append(buffer, sizeof(buffer) - stream->avail_out);
+
+    // no progress possible because all of the input has been consumed
+    if (ret == Z_BUF_ERROR && stream->avail_in == 0)
+      break;
+
+    success = (ret == Z_OK || ret == Z_STREAM_END) && result.size() <= InflateMaxLength;
+  } while (success && ret != Z_STREAM_END && (stream->avail_in > 0 || stream->avail_out == 0));
+  inflateReset(stream);
+
+  return success;
+}
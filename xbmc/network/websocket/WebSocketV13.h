@@ -10,13 +10,31 @@
 
 #include "WebSocketV8.h"
 
+#include <memory>
 #include <string>
 
+struct z_stream_s;
+
 class CWebSocketV13 : public CWebSocketV8
 {
 public:
   CWebSocketV13() { m_version = 13; }
+  ~CWebSocketV13() override;
 
   bool Handshake(const char* data, size_t length, std::string &response) override;
+  const CWebSocketMessage* Send(WebSocketFrameOpcode opcode, const char* data = NULL, uint32_t length = 0) override;
   const CWebSocketFrame* Close(WebSocketCloseReason reason = WebSocketCloseNormal, const std::string &message = "") override;
+
+protected:
+  CWebSocketMessage* DecodeMessage(CWebSocketMessage* message) override;
+
+private:
+  bool negotiateDeflate(const std::string& extensions) const;
+  bool deflate(const char* data, uint32_t length, std::string& result);
+  bool inflate(const std::string& data, std::string& result);
+
+  // permessage-deflate (RFC 7692) has been negotiated, without context takeover in both directions
+  bool m_deflate = false;
+  std::unique_ptr<z_stream_s> m_deflateStream;
+  std::unique_ptr<z_stream_s> m_inflateStream;
 };
@@ -60,7 +60,8 @@ public:
   /*!
    * \brief Trigger a scan for events
    *
-   * \param bWait If true, this blocks until all events are handled
+   * \param bWait If true, events are handled on the calling thread before
+   *              returning
    */
   void HandleEvents(bool bWait);
 
@@ -79,11 +79,13 @@ void CEventScanner::HandleEvents(bool bWait)
 {
   if (bWait)
   {
-    std::unique_lock lock(m_pollMutex);
-
-    m_scanFinishedEvent.Reset();
-    m_scanEvent.Set();
-    m_scanFinishedEvent.Wait();
+    // Scan on the calling thread. Handing the scan to the scanner thread and
+    // waiting for it costs two wake-ups right when the caller needs its input,
+    // which adds noticeable latency on slow devices. The lock mutex keeps the
+    // scan exclusive with the scanner thread.
+    std::unique_lock lock(m_lockMutex);
+    if (m_activeLocks.empty())
+      m_callback.ProcessEvents();
   }
   else
   {
@@ -137,8 +139,6 @@ void CEventScanner::Process()
         m_callback.ProcessEvents();
     }
 
-    m_scanFinishedEvent.Set();
-
     auto now = std::chrono::steady_clock::now();
     auto scanIntervalMs = GetScanIntervalMs();
 
@@ -28,7 +28,9 @@ class IEventScannerCallback;
  * \brief Class to scan for peripheral events
  *
  * By default, a rate of 60 Hz is used. A client can obtain control over when
- * input is handled by registering for a polling handle.
+ * input is handled by registering for a polling handle. A blocking poll
+ * through the handle scans on the polling thread itself, so a game loop gets
+ * the input that arrived right up to the start of its frame.
  */
 class CEventScanner : public IEventPollCallback, public IEventLockCallback, protected CThread
 {
@@ -70,9 +72,7 @@ private:
   std::set<void*> m_activeHandles;
   std::set<void*> m_activeLocks;
   CEvent m_scanEvent;
-  CEvent m_scanFinishedEvent;
   mutable CCriticalSection m_handleMutex;
-  CCriticalSection m_lockMutex;
-  CCriticalSection m_pollMutex; // Prevent two poll handles from polling at once
+  CCriticalSection m_lockMutex; // Also prevents two scans from running at once
 };
 } // namespace PERIPHERALS
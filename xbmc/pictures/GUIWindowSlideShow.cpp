@@ -20,6 +20,7 @@
 #include "application/ApplicationPlayer.h"
 #include "application/ApplicationPowerHandling.h"
 #include "filesystem/Directory.h"
+#include "filesystem/File.h"
 #include "guilib/GUIComponent.h"
 #include "guilib/GUILabelControl.h"
 #include "guilib/GUIWindowManager.h"
@@ -42,9 +43,11 @@
 #include "utils/URIUtils.h"
 #include "utils/Variant.h"
 #include "utils/XTimeUtils.h"
+#include "utils/Mime.h"
 #include "utils/log.h"
 #include "video/VideoFileItemClassify.h"
 
+#include <algorithm>
 #include <memory>
 #include <random>
 
@@ -57,6 +60,11 @@ using namespace std::chrono_literals;
 #define MAX_ZOOM_FACTOR                     10
 #define MAX_PICTURE_SIZE             2048*2048
 
+#define PREFETCH_AHEAD                       2 // slides after the next one
+#define PREFETCH_BEHIND                      1 // slides before the current one
+#define PREFETCH_MAX_FILE_SIZE  (64*1024*1024)
+#define PREFETCH_CHUNK_SIZE        (256*1024)
+
 #define IMMEDIATE_TRANSITION_TIME          1
 
 #define PICTURE_MOVE_AMOUNT              0.02f
@@ -99,8 +107,7 @@ void CBackgroundPicLoader::Process()
       if (m_pCallback)
       {
         auto start = std::chrono::steady_clock::now();
-        std::unique_ptr<CTexture> texture =
-            CTexture::LoadFromFile(m_strFileName, m_maxWidth, m_maxHeight);
+        std::unique_ptr<CTexture> texture = Load(m_strFileName, m_maxWidth, m_maxHeight);
 
         auto end = std::chrono::steady_clock::now();
         auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
@@ -112,6 +119,9 @@ void CBackgroundPicLoader::Process()
         if (texture)
         {
           bFullSize = ((int)texture->GetWidth() < m_maxWidth) && ((int)texture->GetHeight() < m_maxHeight);
+          if (!bFullSize)
+            bFullSize = texture->GetWidth() >= texture->GetOriginalWidth() &&
+                        texture->GetHeight() >= texture->GetOriginalHeight();
           if (!bFullSize)
           {
             int iSize = texture->GetWidth() * texture->GetHeight() - MAX_PICTURE_SIZE;
@@ -128,12 +138,98 @@ void CBackgroundPicLoader::Process()
         m_isLoading = false;
       }
     }
+    else
+      PrefetchNext();
   }
   if (count > 0)
     CLog::Log(LOGDEBUG, "Time for loading {} images: {} ms, average {} ms", count,
               totalTime.count(), totalTime.count() / count);
 }
 
+std::unique_ptr<CTexture> CBackgroundPicLoader::Load(const std::string& file,
+                                                     int maxWidth,
+                                                     int maxHeight)
+{
+  // scale down to the size shown instead of keeping the full picture, which also lets the
+  // decoder skip most of the work for big JPEGs
+  std::vector<uint8_t> data;
+  {
+    std::unique_lock lock(m_prefetchSection);
+    auto it = m_prefetched.find(file);
+    if (it != m_prefetched.end())
+    {
+      data = std::move(it->second);
+      m_prefetched.erase(it);
+      std::erase(m_prefetchFiles, file);
+    }
+  }
+
+  if (!data.empty())
+  {
+    const CURL url(file);
+    const std::string mimeType =
+        url.GetFileType().empty() ? CMime::GetMimeType(url) : "image/" + url.GetFileType();
+    std::unique_ptr<CTexture> texture = CTexture::LoadFromFileInMemory(
+        data.data(), data.size(), mimeType, maxWidth, maxHeight, CAspectRatio::KEEP);
+    if (texture)
+      return texture;
+  }
+
+  return CTexture::LoadFromFile(file, maxWidth, maxHeight, CAspectRatio::KEEP);
+}
+
+void CBackgroundPicLoader::Prefetch(const std::vector<std::string>& files)
+{
+  std::unique_lock lock(m_prefetchSection);
+  m_prefetchFiles = files;
+  std::erase_if(m_prefetched, [&files](const auto& prefetched)
+                { return std::ranges::find(files, prefetched.first) == files.end(); });
+}
+
+void CBackgroundPicLoader::PrefetchNext()
+{
+  std::string file;
+  {
+    std::unique_lock lock(m_prefetchSection);
+    auto it = std::ranges::find_if(m_prefetchFiles, [this](const std::string& prefetchFile)
+                                   { return !m_prefetched.contains(prefetchFile); });
+    if (it == m_prefetchFiles.end())
+      return;
+    file = *it;
+  }
+
+  // an empty buffer marks files that can't or shouldn't be prefetched, they are loaded as usual
+  std::vector<uint8_t> data;
+  CFile picture;
+  if (picture.Open(file))
+  {
+    const int64_t length = picture.GetLength();
+    if (length > 0 && length <= PREFETCH_MAX_FILE_SIZE)
+    {
+      data.resize(static_cast<size_t>(length));
+      size_t total = 0;
+      while (total < data.size())
+      {
+        // loading a picture takes priority, the prefetch will be picked up again later
+        if (m_isLoading || m_bStop)
+          return;
+
+        const ssize_t read = picture.Read(data.data() + total,
+                                          std::min<size_t>(data.size() - total, PREFETCH_CHUNK_SIZE));
+        if (read <= 0)
+          break;
+        total += read;
+      }
+      if (total < data.size())
+        data.clear();
+    }
+  }
+
+  std::unique_lock lock(m_prefetchSection);
+  if (std::ranges::find(m_prefetchFiles, file) != m_prefetchFiles.end())
+    m_prefetched[file] = std::move(data);
+}
+
 void CBackgroundPicLoader::LoadPic(int iPic, int iSlideNumber, const std::string &strFileName, const int maxWidth, const int maxHeight)
 {
   m_iPic = iPic;
@@ -263,6 +359,7 @@ void CGUIWindowSlideShow::Reset()
   m_iCurrentPic = 0;
   m_iDirection = 1;
   m_iLastFailedNextSlide = -1;
+  m_prefetchedFor = {-1, -1};
   m_slides.clear();
   AnnouncePlaylistClear();
   m_Resolution = CServiceBroker::GetWinSystem()->GetGfxContext().GetVideoResolution();
@@ -568,6 +665,8 @@ void CGUIWindowSlideShow::Process(unsigned int currentTime, CDirtyRegionList &re
     }
   }
 
+  UpdatePrefetch();
+
   bool bPlayVideo = IsVideo(*m_slides.at(m_iCurrentSlide)) && m_iVideoSlide != m_iCurrentSlide;
   if (bPlayVideo)
     bSlideShow = false;
@@ -1404,6 +1503,36 @@ void CGUIWindowSlideShow::GetCheckedSize(float width, float height, int &maxWidt
   maxHeight = CServiceBroker::GetRenderSystem()->GetMaxTextureSize();
 }
 
+void CGUIWindowSlideShow::UpdatePrefetch()
+{
+  const std::pair<int, int> slides{m_iCurrentSlide, m_iNextSlide};
+  if (slides == m_prefetchedFor || m_slides.empty())
+    return;
+  m_prefetchedFor = slides;
+
+  // the next slide comes first, it may not have been handed to the loader yet
+  const int count = static_cast<int>(m_slides.size());
+  std::vector<int> slideNumbers;
+  for (int i = 0; i <= PREFETCH_AHEAD; i++)
+    slideNumbers.emplace_back(m_iNextSlide + i * m_iDirection);
+  for (int i = 1; i <= PREFETCH_BEHIND; i++)
+    slideNumbers.emplace_back(m_iCurrentSlide - i * m_iDirection);
+
+  std::vector<std::string> files;
+  for (int slideNumber : slideNumbers)
+  {
+    slideNumber = ((slideNumber % count) + count) % count;
+    const CFileItemPtr& item = m_slides.at(slideNumber);
+    if (slideNumber == m_iCurrentSlide || IsVideo(*item))
+      continue;
+
+    const std::string path = item->GetDynPath();
+    if (!path.empty() && std::ranges::find(files, path) == files.end())
+      files.emplace_back(path);
+  }
+  m_pBackgroundLoader->Prefetch(files);
+}
+
 std::string CGUIWindowSlideShow::GetPicturePath(CFileItem *item)
 {
   bool isVideo = IsVideo(*item);
@@ -12,11 +12,18 @@
 #include "guilib/GUIDialog.h"
 #include "interfaces/IAnnouncer.h"
 #include "interfaces/ISlideShowDelegate.h"
+#include "threads/CriticalSection.h"
 #include "threads/Event.h"
 #include "threads/Thread.h"
 
+#include <atomic>
+#include <map>
 #include <memory>
 #include <set>
+#include <stdint.h>
+#include <string>
+#include <utility>
+#include <vector>
 
 class CFileItemList;
 class CVariant;
@@ -35,8 +42,18 @@ public:
   int SlideNumber() const { return m_iSlideNumber; }
   int Pic() const { return m_iPic; }
 
+  /*!
+   \brief Set the pictures likely to be shown after the ones being loaded, in order of priority.
+   Their data is read into memory while the loader is idle so that decoding them later doesn't
+   wait on the (network) file system.
+   */
+  void Prefetch(const std::vector<std::string>& files);
+
 private:
   void Process() override;
+  std::unique_ptr<CTexture> Load(const std::string& file, int maxWidth, int maxHeight);
+  void PrefetchNext();
+
   int m_iPic = 0;
   int m_iSlideNumber = 0;
   std::string m_strFileName;
@@ -44,7 +61,11 @@ private:
   int m_maxHeight = 0;
 
   CEvent m_loadPic;
-  bool m_isLoading = false;
+  std::atomic<bool> m_isLoading = false;
+
+  CCriticalSection m_prefetchSection;
+  std::vector<std::string> m_prefetchFiles;
+  std::map<std::string, std::vector<uint8_t>> m_prefetched;
 
   CGUIWindowSlideShow* m_pCallback = nullptr;
 };
@@ -133,6 +154,7 @@ private:
   void GetCheckedSize(float width, float height, int &maxWidth, int &maxHeight);
   std::string GetPicturePath(CFileItem *item);
   int  GetNextSlide();
+  void UpdatePrefetch();
 
   void AnnouncePlayerPlay(const CFileItemPtr& item);
   void AnnouncePlayerPause(const CFileItemPtr& item);
@@ -166,6 +188,7 @@ private:
   std::unique_ptr<CBackgroundPicLoader> m_pBackgroundLoader;
   int m_iLastFailedNextSlide;
   bool m_bLoadNextPic;
+  std::pair<int, int> m_prefetchedFor{-1, -1};
   RESOLUTION m_Resolution = RES_INVALID;
   CPoint m_firstGesturePoint;
 };
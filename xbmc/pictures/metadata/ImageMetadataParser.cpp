@@ -59,6 +59,83 @@ bool IsOnlySpaces(const std::string& str)
 {
   return std::all_of(str.begin(), str.end(), [](unsigned char c) { return std::isspace(c); });
 }
+
+// give up on headers bigger than this and load the whole file instead
+constexpr size_t MAX_JPEG_HEADER_SIZE = 16 * 1024 * 1024;
+
+bool ReadFully(CFile& file, uint8_t* buffer, size_t size)
+{
+  while (size > 0)
+  {
+    const ssize_t read = file.Read(buffer, size);
+    if (read <= 0)
+      return false;
+    buffer += read;
+    size -= read;
+  }
+  return true;
+}
+
+/*!
+ \brief Read the segments of a JPEG that hold the metadata we are interested in.
+
+ All metadata is stored in front of the compressed image data, so only the file's header is
+ read. Segments exiv2 doesn't need (tables, ICC profiles, multi-picture previews, ...) are
+ skipped by seeking past them. The result is a JPEG without image data that exiv2 can read.
+ \return false if the file is no JPEG or its header couldn't be read.
+ */
+bool ReadJpegMetadataSegments(CFile& file, std::vector<uint8_t>& buffer)
+{
+  uint8_t marker[2];
+  if (!ReadFully(file, marker, 2) || marker[0] != 0xFF || marker[1] != 0xD8)
+    return false;
+  buffer.assign(marker, marker + 2);
+
+  while (buffer.size() < MAX_JPEG_HEADER_SIZE)
+  {
+    if (!ReadFully(file, marker, 2) || marker[0] != 0xFF)
+      return false;
+
+    uint8_t type = marker[1];
+    while (type == 0xFF) // fill bytes
+    {
+      if (!ReadFully(file, &type, 1))
+        return false;
+    }
+
+    // start of scan: the image data follows, everything exiv2 reads comes before it
+    if (type == 0xDA || type == 0xD9)
+    {
+      buffer.insert(buffer.end(), {0xFF, type});
+      return true;
+    }
+    // markers without a segment
+    if (type == 0x01 || (type >= 0xD0 && type <= 0xD7))
+      continue;
+
+    uint8_t length[2];
+    if (!ReadFully(file, length, 2))
+      return false;
+    const size_t size = (length[0] << 8) | length[1];
+    if (size < 2)
+      return false;
+
+    const bool isFrame = type >= 0xC0 && type <= 0xCF && type != 0xC4 && type != 0xC8 &&
+                         type != 0xCC; // SOFn, needed for size and color information
+    if (isFrame || type == 0xE1 /* APP1: Exif, XMP */ || type == 0xED /* APP13: IPTC */ ||
+        type == 0xFE /* COM */)
+    {
+      buffer.insert(buffer.end(), {0xFF, type, length[0], length[1]});
+      const size_t offset = buffer.size();
+      buffer.resize(offset + size - 2);
+      if (!ReadFully(file, buffer.data() + offset, size - 2))
+        return false;
+    }
+    else if (file.Seek(size - 2, SEEK_CUR) < 0)
+      return false;
+  }
+  return false;
+}
 } // namespace
 
 CImageMetadataParser::CImageMetadataParser() : m_imageMetadata(std::make_unique<ImageMetadata>())
@@ -67,17 +144,19 @@ CImageMetadataParser::CImageMetadataParser() : m_imageMetadata(std::make_unique<
 
 std::unique_ptr<ImageMetadata> CImageMetadataParser::ExtractMetadata(const std::string& picFileName)
 {
-  // read image file to a buffer so it can be fed to libexiv2
+  // read image file to a buffer so it can be fed to libexiv2, for JPEGs only the metadata
+  // segments are needed which saves reading megabytes of image data from (network) storage
   CFile file;
   std::vector<uint8_t> outputBuffer;
-  ssize_t readbytes = file.LoadFile(picFileName, outputBuffer);
-  if (readbytes <= 0)
+  const bool isJpeg = file.Open(picFileName) && ReadJpegMetadataSegments(file, outputBuffer);
+  file.Close();
+  if (!isJpeg && file.LoadFile(picFileName, outputBuffer) <= 0)
   {
     return nullptr;
   }
 
   // read image metadata
-  auto image = Exiv2::ImageFactory::open(outputBuffer.data(), readbytes);
+  auto image = Exiv2::ImageFactory::open(outputBuffer.data(), outputBuffer.size());
   image->readMetadata();
 
   CImageMetadataParser parser;
@@ -55,5 +55,11 @@ void GetMemoryStatus(MemoryStatus* buffer)
   }
 }
 
+int GetMemoryPressure()
+{
+  // apps can't read /proc/pressure, low memory is signalled to CXBMCApp::onLowMemory()
+  return -1;
+}
+
 } // namespace MEMORY
 } // namespace KODI
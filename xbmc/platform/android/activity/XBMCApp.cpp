@@ -43,6 +43,7 @@
 #include "settings/SettingsComponent.h"
 #include "threads/Event.h"
 #include "utils/JSONVariantParser.h"
+#include "utils/MemoryBudget.h"
 #include "utils/StringUtils.h"
 #include "utils/TimeUtils.h"
 #include "utils/URIUtils.h"
@@ -423,7 +424,8 @@ void CXBMCApp::onConfigurationChanged()
 void CXBMCApp::onLowMemory()
 {
   android_printf("%s: ", __PRETTY_FUNCTION__);
-  // can't do much as we don't want to close completely
+  // release the caches, the system is about to kill background processes
+  CMemoryBudget::SignalPressure(MemoryPressure::CRITICAL);
 }
 
 void CXBMCApp::onCreateWindow(ANativeWindow* window)
@@ -89,5 +89,10 @@ void GetMemoryStatus(MemoryStatus* buffer)
   }
 }
 
+int GetMemoryPressure()
+{
+  return -1;
+}
+
 }
 }
@@ -79,5 +79,10 @@ void GetMemoryStatus(MemoryStatus* buffer)
   buffer->availPhys = mem_inactive + mem_cache + mem_free;
 }
 
+int GetMemoryPressure()
+{
+  return -1;
+}
+
 }
 }
@@ -10,6 +10,7 @@
 
 #include "ServiceBroker.h"
 #include "application/AppParams.h"
+#include "cores/AudioEngine/Sinks/AESinkNULL.h"
 #include "utils/StringUtils.h"
 
 #include "platform/freebsd/OptionalsReg.h"
@@ -99,6 +100,10 @@ bool CPlatformFreebsd::InitStageOne()
   {
     OPTIONALS::SndioRegister();
   }
+  else if (sink == "null")
+  {
+    CAESinkNULL::Register();
+  }
   else if (sink == "alsa+pulseaudio")
   {
     OPTIONALS::ALSARegister();
@@ -14,8 +14,11 @@
 
 #include "platform/linux/SysfsPath.h"
 
+#include <algorithm>
+#include <cstdlib>
 #include <exception>
 #include <fstream>
+#include <optional>
 #include <regex>
 #include <sstream>
 #include <vector>
@@ -62,6 +65,64 @@ public:
   std::string cpu;
   std::size_t state[STATE_MAX];
 };
+
+// cores are only told apart when the slower ones reach at most this share of the faster ones,
+// smaller differences are favored cores or boost bins of otherwise equal cores
+constexpr double EFFICIENCY_CAPACITY_RATIO = 0.9;
+
+std::optional<int> ReadInt(const std::string& path)
+{
+  CSysfsPath sysfsPath{path};
+  if (!sysfsPath.Exists())
+    return std::nullopt;
+  return sysfsPath.Get<int>();
+}
+
+// parse a list of cpus like "0-3,8"
+std::vector<int> ParseCpuList(const std::string& list)
+{
+  std::vector<int> cpus;
+  for (const std::string& range : StringUtils::Split(list, ','))
+  {
+    const std::vector<std::string> bounds = StringUtils::Split(range, '-');
+    if (bounds.empty() || bounds.size() > 2)
+      return {};
+    const int first = std::atoi(bounds.front().c_str());
+    const int last = std::atoi(bounds.back().c_str());
+    for (int cpu = first; cpu <= last; cpu++)
+      cpus.emplace_back(cpu);
+  }
+  return cpus;
+}
+
+// the cores above the largest significant gap between the capacities, empty if there is none
+std::vector<int> GetFasterCores(const std::vector<int>& capacities)
+{
+  std::vector<int> sorted = capacities;
+  std::ranges::sort(sorted);
+  double lowestRatio = EFFICIENCY_CAPACITY_RATIO;
+  std::optional<int> threshold;
+  for (size_t i = 1; i < sorted.size(); i++)
+  {
+    const double ratio = static_cast<double>(sorted[i - 1]) / sorted[i];
+    if (sorted[i - 1] > 0 && ratio <= lowestRatio)
+    {
+      lowestRatio = ratio;
+      threshold = sorted[i];
+    }
+  }
+
+  std::vector<int> cores;
+  if (threshold)
+  {
+    for (size_t core = 0; core < capacities.size(); core++)
+    {
+      if (capacities[core] >= *threshold)
+        cores.emplace_back(static_cast<int>(core));
+    }
+  }
+  return cores;
+}
 } // namespace
 
 std::shared_ptr<CCPUInfo> CCPUInfo::GetCPUInfo()
@@ -136,6 +197,61 @@ CCPUInfoLinux::CCPUInfoLinux()
     m_cores.emplace_back(coreInfo);
   }
 
+  // only the cores of a heterogeneous cpu are told apart, by the capacity they report to the
+  // scheduler or, on hybrid x86 cpus, by their core type. The maximum frequency alone also
+  // differs between the favored cores and the others of a cpu whose cores are all alike.
+  std::vector<int> capacities;
+  for (int core = 0; core < m_cpuCount; core++)
+  {
+    const auto capacity =
+        ReadInt("/sys/devices/system/cpu/cpu" + std::to_string(core) + "/cpu_capacity");
+    if (!capacity)
+      break;
+
+    capacities.emplace_back(*capacity);
+  }
+
+  if (capacities.size() == static_cast<size_t>(m_cpuCount))
+  {
+    m_performanceCores = GetFasterCores(capacities);
+  }
+  else if (CSysfsPath{"/sys/devices/cpu_core/cpus"}.Exists() &&
+           CSysfsPath{"/sys/devices/cpu_atom/cpus"}.Exists())
+  {
+    const std::vector<int> coreCpus = ParseCpuList(
+        CSysfsPath{"/sys/devices/cpu_core/cpus"}.Get<std::string>().value_or(""));
+    const std::vector<int> atomCpus = ParseCpuList(
+        CSysfsPath{"/sys/devices/cpu_atom/cpus"}.Get<std::string>().value_or(""));
+
+    // the types only count when the atom cores are markedly slower
+    std::optional<int> slowestCore;
+    std::optional<int> fastestAtom;
+    for (int cpu : coreCpus)
+    {
+      const auto freq = ReadInt("/sys/devices/system/cpu/cpu" + std::to_string(cpu) +
+                                "/cpufreq/cpuinfo_max_freq");
+      if (freq)
+        slowestCore = std::min(slowestCore.value_or(*freq), *freq);
+    }
+    for (int cpu : atomCpus)
+    {
+      const auto freq = ReadInt("/sys/devices/system/cpu/cpu" + std::to_string(cpu) +
+                                "/cpufreq/cpuinfo_max_freq");
+      if (freq)
+        fastestAtom = std::max(fastestAtom.value_or(*freq), *freq);
+    }
+
+    if (slowestCore && fastestAtom &&
+        *fastestAtom <= *slowestCore * EFFICIENCY_CAPACITY_RATIO)
+    {
+      for (int cpu : coreCpus)
+      {
+        if (cpu >= 0 && cpu < m_cpuCount)
+          m_performanceCores.emplace_back(cpu);
+      }
+    }
+  }
+
 #if defined(__i386__) || defined(__x86_64__)
   unsigned int eax;
   unsigned int ebx;
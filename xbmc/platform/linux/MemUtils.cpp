@@ -79,5 +79,21 @@ void GetMemoryStatus(MemoryStatus* buffer)
       available > 0 ? available * 1024 : (free + cached + reclaimable + buffers) * 1024;
 }
 
+int GetMemoryPressure()
+{
+  // pressure stall information, "some avg10=1.23 avg60=0.50 avg300=0.10 total=12345"
+  std::ifstream file("/proc/pressure/memory");
+  if (!file.is_open())
+    return -1;
+
+  std::string token;
+  while (file >> token)
+  {
+    if (token.starts_with("avg10="))
+      return static_cast<int>(std::strtof(token.c_str() + 6, nullptr));
+  }
+  return -1;
+}
+
 }
 }
@@ -10,6 +10,7 @@
 
 #include "ServiceBroker.h"
 #include "application/AppParams.h"
+#include "cores/AudioEngine/Sinks/AESinkNULL.h"
 #include "filesystem/SpecialProtocol.h"
 
 #if defined(HAS_ALSA)
@@ -111,6 +112,10 @@ bool CPlatformLinux::InitStageOne()
   {
     OPTIONALS::SndioRegister();
   }
+  else if (sink == "null")
+  {
+    CAESinkNULL::Register();
+  }
   else if (sink == "alsa+pulseaudio")
   {
     OPTIONALS::ALSARegister();
@@ -89,3 +89,8 @@ bool CLinuxStorageProvider::PumpDriveChangeEvents(IStorageEventsCallback *callba
 {
   return m_instance->PumpDriveChangeEvents(callback);
 }
+
+bool CLinuxStorageProvider::NotifiesOpticalDriveChanges() const
+{
+  return m_instance->NotifiesOpticalDriveChanges();
+}
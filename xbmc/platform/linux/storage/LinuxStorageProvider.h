@@ -25,6 +25,7 @@ public:
   bool Eject(const std::string& mountpath) override;
   std::vector<std::string> GetDiskUsage() override;
   bool PumpDriveChangeEvents(IStorageEventsCallback *callback) override;
+  bool NotifiesOpticalDriveChanges() const override;
 
 private:
   IStorageProvider *m_instance;
@@ -269,6 +269,11 @@ bool CUDevProvider::PumpDriveChangeEvents(IStorageEventsCallback *callback)
           callback->OnStorageSafelyRemoved(storageDevice);
         changed = true;
       }
+      // media changes and eject requests of optical drives come as change events of the drive
+      const char* cdrom = udev_device_get_property_value(dev, "ID_CDROM");
+      if (strcmp(action, "change") == 0 && cdrom && strcmp(cdrom, "1") == 0 && callback)
+        callback->OnOpticalDriveChanged();
+
       // browse disk dialog is not wanted for blu-rays
       const char *bd = udev_device_get_property_value(dev, "ID_CDROM_MEDIA_BD");
       if (strcmp(action, "change") == 0 && !(bd && strcmp(bd, "1") == 0))
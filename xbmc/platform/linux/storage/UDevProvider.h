@@ -33,6 +33,7 @@ public:
   std::vector<std::string> GetDiskUsage() override;
 
   bool PumpDriveChangeEvents(IStorageEventsCallback *callback) override;
+  bool NotifiesOpticalDriveChanges() const override { return true; }
 
 private:
   void GetDisks(std::vector<CMediaSource>& devices, bool removable);
@@ -517,7 +517,7 @@ bool CUDisks2Provider::HandlePropertiesChanged(DBusMessage *msg, IStorageEventsC
 
   if (strcmp(iface, UDISKS2_INTERFACE_DRIVE) == 0)
   {
-    return DrivePropertiesChanged(object, &propsIter);
+    return DrivePropertiesChanged(object, &propsIter, callback);
   }
   else if (strcmp(iface, UDISKS2_INTERFACE_BLOCK) == 0)
   {
@@ -531,7 +531,9 @@ bool CUDisks2Provider::HandlePropertiesChanged(DBusMessage *msg, IStorageEventsC
   return false;
 }
 
-bool CUDisks2Provider::DrivePropertiesChanged(const char *object, DBusMessageIter *propsIter)
+bool CUDisks2Provider::DrivePropertiesChanged(const char* object,
+                                              DBusMessageIter* propsIter,
+                                              IStorageEventsCallback* callback)
 {
   if (m_drives.contains(object))
   {
@@ -541,6 +543,10 @@ bool CUDisks2Provider::DrivePropertiesChanged(const char *object, DBusMessageIte
                                         std::placeholders::_2, std::placeholders::_3);
     ParseProperties(drive, propsIter, ParseDriveProperty);
     CLog::Log(LOGDEBUG, LOGDBUS, "UDisks2: After update: {}", drive->ToString());
+
+    // media and tray changes of optical drives are properties of the drive
+    if (drive->IsOptical() && callback)
+      callback->OnOpticalDriveChanged();
   }
   return false;
 }
@@ -152,6 +152,7 @@ public:
   void Initialize() override;
 
   bool PumpDriveChangeEvents(IStorageEventsCallback *callback) override;
+  bool NotifiesOpticalDriveChanges() const override { return true; }
 
   static bool HasUDisks2();
 
@@ -190,7 +191,9 @@ private:
   void HandleInterfacesAdded(DBusMessage *msg);
   bool HandlePropertiesChanged(DBusMessage *msg, IStorageEventsCallback *callback);
 
-  bool DrivePropertiesChanged(const char *object, DBusMessageIter *propsIter);
+  bool DrivePropertiesChanged(const char* object,
+                              DBusMessageIter* propsIter,
+                              IStorageEventsCallback* callback);
   bool BlockPropertiesChanged(const char *object, DBusMessageIter *propsIter);
   bool FilesystemPropertiesChanged(const char *object, DBusMessageIter *propsIter, IStorageEventsCallback *callback);
 
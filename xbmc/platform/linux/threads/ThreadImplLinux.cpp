@@ -15,6 +15,9 @@
 #include <array>
 #include <mutex>
 
+#include <sched.h>
+#include <string.h>
+
 #include <sys/resource.h>
 #include <unistd.h>
 
@@ -103,3 +106,30 @@ bool CThreadImplLinux::SetPriority(const ThreadPriority& priority)
 
   return true;
 }
+
+bool CThreadImplLinux::SetAffinity(const std::vector<int>& cores)
+{
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (cores.empty())
+  {
+    // undo the restriction the thread may have inherited from its creator
+    const long count = sysconf(_SC_NPROCESSORS_CONF);
+    for (long core = 0; core < count && core < CPU_SETSIZE; core++)
+      CPU_SET(core, &set);
+  }
+  else
+  {
+    for (int core : cores)
+      CPU_SET(core, &set);
+  }
+
+  if (sched_setaffinity(m_threadID, sizeof(set), &set) != 0)
+  {
+    CLog::Log(LOGWARNING, "[threads] name: '{}' failed to set the affinity: {}", m_name,
+              strerror(errno));
+    return false;
+  }
+
+  return true;
+}
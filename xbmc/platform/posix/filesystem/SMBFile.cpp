@@ -27,6 +27,7 @@
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <cstring>
 #include <inttypes.h>
 #include <mutex>
@@ -34,6 +35,11 @@
 
 #include <libsmbclient.h>
 
+// Number of chunks requested from the server per read while a file is read sequentially
+#define SMB_READAHEAD_CHUNKS 4
+// Number of reads without a seek in between before reading ahead
+#define SMB_READAHEAD_MIN_READS 2
+
 using namespace XFILE;
 
 void xb_smbc_log(void* private_ptr, int level, const char* msg)
@@ -406,7 +412,10 @@ int64_t CSMBFile::GetPosition()
   std::unique_lock lock(smb);
   if (!smb.IsSmbValid())
     return -1;
-  return smbc_lseek(m_fd, 0, SEEK_CUR);
+  const int64_t pos = smbc_lseek(m_fd, 0, SEEK_CUR);
+  if (pos < 0)
+    return pos;
+  return pos - GetBuffered();
 }
 
 int64_t CSMBFile::GetLength()
@@ -604,6 +613,44 @@ ssize_t CSMBFile::Read(void *lpBuf, size_t uiBufSize)
     return -1;
   smb.SetActivityTime();
 
+  uint8_t* buffer = static_cast<uint8_t*>(lpBuf);
+  size_t copied = std::min(uiBufSize, GetBuffered());
+  if (copied > 0)
+  {
+    std::memcpy(buffer, m_readAhead.data() + m_readAheadPos, copied);
+    m_readAheadPos += copied;
+    if (copied == uiBufSize)
+      return copied;
+  }
+
+  // only read ahead once the file is read sequentially, seeks throw the buffer away
+  size_t readAhead = 0;
+  if (++m_sequentialReads >= SMB_READAHEAD_MIN_READS)
+    readAhead = static_cast<size_t>(GetChunkSize()) * SMB_READAHEAD_CHUNKS;
+  if (uiBufSize - copied >= readAhead)
+  {
+    const ssize_t bytesRead = ReadFromServer(buffer + copied, uiBufSize - copied);
+    if (bytesRead < 0)
+      return copied > 0 ? static_cast<ssize_t>(copied) : bytesRead;
+    return copied + bytesRead;
+  }
+
+  m_readAhead.resize(readAhead);
+  m_readAheadPos = 0;
+  m_readAheadSize = 0;
+  const ssize_t bytesRead = ReadFromServer(m_readAhead.data(), readAhead);
+  if (bytesRead < 0)
+    return copied > 0 ? static_cast<ssize_t>(copied) : bytesRead;
+
+  m_readAheadSize = bytesRead;
+  const size_t size = std::min(uiBufSize - copied, GetBuffered());
+  std::memcpy(buffer + copied, m_readAhead.data(), size);
+  m_readAheadPos = size;
+  return copied + size;
+}
+
+ssize_t CSMBFile::ReadFromServer(void* lpBuf, size_t uiBufSize)
+{
   ssize_t bytesRead = smbc_read(m_fd, lpBuf, (int)uiBufSize);
 
   if (m_allowRetry && bytesRead < 0 && errno == EINVAL )
@@ -620,6 +667,13 @@ ssize_t CSMBFile::Read(void *lpBuf, size_t uiBufSize)
   return bytesRead;
 }
 
+void CSMBFile::DropReadAhead()
+{
+  m_readAheadPos = 0;
+  m_readAheadSize = 0;
+  m_sequentialReads = 0;
+}
+
 int64_t CSMBFile::Seek(int64_t iFilePosition, int iWhence)
 {
   if (m_fd == -1) return -1;
@@ -628,6 +682,32 @@ int64_t CSMBFile::Seek(int64_t iFilePosition, int iWhence)
   if (!smb.IsSmbValid())
     return -1;
   smb.SetActivityTime();
+
+  // the server position is ahead of ours by what is still buffered
+  if (GetBuffered() > 0 && iWhence != SEEK_END)
+  {
+    const int64_t serverPos = smbc_lseek(m_fd, 0, SEEK_CUR);
+    if (serverPos < 0)
+    {
+      CLog::Log(LOGERROR, "{} - Error( {}, {}, {} )", __FUNCTION__, serverPos, errno,
+                strerror(errno));
+      return -1;
+    }
+
+    const int64_t bufferStart = serverPos - m_readAheadSize;
+    if (iWhence == SEEK_CUR)
+      iFilePosition += serverPos - GetBuffered();
+    iWhence = SEEK_SET;
+
+    // stay within the buffer if possible
+    if (iFilePosition >= bufferStart && iFilePosition < serverPos)
+    {
+      m_readAheadPos = static_cast<size_t>(iFilePosition - bufferStart);
+      return iFilePosition;
+    }
+  }
+  DropReadAhead();
+
   int64_t pos = smbc_lseek(m_fd, iFilePosition, iWhence);
 
   if ( pos < 0 )
@@ -641,6 +721,10 @@ int64_t CSMBFile::Seek(int64_t iFilePosition, int iWhence)
 
 void CSMBFile::Close()
 {
+  DropReadAhead();
+  m_readAhead.clear();
+  m_readAhead.shrink_to_fit();
+
   if (m_fd != -1)
   {
     CLog::Log(LOGDEBUG, "CSMBFile::Close closing fd {}", m_fd);
@@ -661,6 +745,11 @@ ssize_t CSMBFile::Write(const void* lpBuf, size_t uiBufSize)
   if (!smb.IsSmbValid())
     return -1;
 
+  // move the server position back to ours before writing
+  if (GetBuffered() > 0)
+    smbc_lseek(m_fd, -static_cast<off_t>(GetBuffered()), SEEK_CUR);
+  DropReadAhead();
+
   return  smbc_write(m_fd, lpBuf, uiBufSize);
 }
 
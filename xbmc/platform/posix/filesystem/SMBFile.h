@@ -19,6 +19,9 @@
 #include "filesystem/IFile.h"
 #include "threads/CriticalSection.h"
 
+#include <cstdint>
+#include <vector>
+
 #define NT_STATUS_CONNECTION_REFUSED long(0xC0000000 | 0x0236)
 #define NT_STATUS_INVALID_HANDLE long(0xC0000000 | 0x0008)
 #define NT_STATUS_ACCESS_DENIED long(0xC0000000 | 0x0022)
@@ -86,8 +89,19 @@ protected:
   CURL m_url;
   bool IsValidFile(const std::string& strFileName);
   std::string GetAuthenticatedPath(const CURL &url);
+  ssize_t ReadFromServer(void* lpBuf, size_t uiBufSize);
+  size_t GetBuffered() const { return m_readAheadSize - m_readAheadPos; }
+  void DropReadAhead();
+
   int64_t m_fileSize;
   int m_fd;
   bool m_allowRetry;
+
+  // Sequential reads are served from a buffer filled with a few chunks at a
+  // time, so libsmbclient can keep several read requests in flight
+  std::vector<uint8_t> m_readAhead;
+  size_t m_readAheadPos = 0;
+  size_t m_readAheadSize = 0;
+  unsigned int m_sequentialReads = 0;
 };
 }
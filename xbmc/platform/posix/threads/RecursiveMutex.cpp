@@ -8,6 +8,9 @@
 
 #include "RecursiveMutex.h"
 
+#include "threads/SpinWait.h"
+#include "utils/Trace.h"
+
 namespace XbmcThreads
 {
 
@@ -27,4 +30,13 @@ pthread_mutexattr_t& CRecursiveMutex::getRecursiveAttr()
   return recursiveAttr;
 }
 
+void CRecursiveMutex::lockContended()
+{
+  if (TrySpinLock(*this))
+    return;
+
+  CTraceZone zone("lock wait");
+  pthread_mutex_lock(&m_mutex);
+}
+
 } // namespace XbmcThreads
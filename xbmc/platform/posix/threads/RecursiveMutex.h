@@ -28,6 +28,8 @@ private:
 
   static pthread_mutexattr_t& getRecursiveAttr();
 
+  void lockContended();
+
 public:
   CRecursiveMutex(const CRecursiveMutex&) = delete;
   CRecursiveMutex& operator=(const CRecursiveMutex&) = delete;
@@ -36,7 +38,11 @@ public:
 
   inline ~CRecursiveMutex() { pthread_mutex_destroy(&m_mutex); }
 
-  inline void lock() { pthread_mutex_lock(&m_mutex); }
+  inline void lock()
+  {
+    if (!try_lock())
+      lockContended();
+  }
 
   inline void unlock() { pthread_mutex_unlock(&m_mutex); }
 
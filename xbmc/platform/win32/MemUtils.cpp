@@ -36,5 +36,10 @@ void GetMemoryStatus(MemoryStatus* buffer)
   buffer->availPhys = memory.ullAvailPhys;
 }
 
+int GetMemoryPressure()
+{
+  return -1;
+}
+
 }
 }
@@ -21,9 +21,76 @@
 #include "video/VideoInfoTag.h"
 
 #include <inttypes.h>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 using namespace XFILE;
 
+namespace
+{
+/*!
+ \brief Parse the part of an #EXTINF line after the colon, e.g.
+ -1 tvg-id="bbc1" group-title="News, UK",BBC One
+
+ The title starts after the first comma outside of quotes, as attribute values of IPTV lists may
+ contain commas themselves.
+ */
+bool ParseInfo(std::string_view info,
+               int& duration,
+               std::string& title,
+               std::vector<std::pair<std::string, std::string>>& attributes)
+{
+  bool quoted = false;
+  size_t comma = std::string_view::npos;
+  for (size_t i = 0; i < info.size(); ++i)
+  {
+    if (info[i] == '"')
+      quoted = !quoted;
+    else if (info[i] == ',' && !quoted)
+    {
+      comma = i;
+      break;
+    }
+  }
+  if (comma == std::string_view::npos)
+    return false;
+
+  title = info.substr(comma + 1);
+  std::string_view rest = info.substr(0, comma);
+  duration = atoi(std::string(rest.substr(0, rest.find(' '))).c_str());
+
+  // attributes are key="value" pairs separated by spaces
+  size_t pos = rest.find(' ');
+  while (pos != std::string_view::npos && pos < rest.size())
+  {
+    const size_t keyStart = rest.find_first_not_of(' ', pos);
+    const size_t equals = rest.find('=', keyStart);
+    if (keyStart == std::string_view::npos || equals == std::string_view::npos)
+      break;
+
+    std::string_view key = rest.substr(keyStart, equals - keyStart);
+    std::string_view value;
+    if (equals + 1 < rest.size() && rest[equals + 1] == '"')
+    {
+      const size_t end = rest.find('"', equals + 2);
+      value = rest.substr(equals + 2,
+                          end == std::string_view::npos ? std::string_view::npos : end - equals - 2);
+      pos = end == std::string_view::npos ? end : end + 1;
+    }
+    else
+    {
+      pos = rest.find(' ', equals);
+      value = rest.substr(equals + 1,
+                          pos == std::string_view::npos ? std::string_view::npos : pos - equals - 1);
+    }
+    if (!key.empty())
+      attributes.emplace_back(key, value);
+  }
+  return true;
+}
+} // namespace
+
 namespace KODI::PLAYLIST
 {
 
@@ -94,21 +161,17 @@ bool CPlayListM3U::Load(const std::string& strFileName)
 
     if (StringUtils::StartsWith(strLine, InfoMarker))
     {
-      // start of info
-      size_t iColon = strLine.find(':');
-      size_t iComma = strLine.find(',');
+      // start of info, with the duration, attributes and the title
+      const size_t iColon = strLine.find(':');
       if (iColon != std::string::npos &&
-          iComma != std::string::npos &&
-          iComma > iColon)
+          ParseInfo(std::string_view(strLine).substr(iColon + 1), lDuration, strInfo, properties))
       {
-        // Read the info and duration
-        iColon++;
-        std::string strLength = strLine.substr(iColon, iComma - iColon);
-        lDuration = atoi(strLength.c_str());
-        iComma++;
-        strInfo = strLine.substr(iComma);
         if (!utf8)
+        {
           g_charsetConverter.unknownToUTF8(strInfo);
+          for (auto& property : properties)
+            g_charsetConverter.unknownToUTF8(property.second);
+        }
       }
     }
     else if (StringUtils::StartsWith(strLine, OffsetMarker))
@@ -185,20 +248,23 @@ bool CPlayListM3U::Load(const std::string& strFileName)
           if (iEndOffset)
             lDuration = static_cast<int>(CUtil::ConvertMilliSecsToSecsIntRounded(iEndOffset - iStartOffset));
         }
-        if (VIDEO::IsVideo(*newItem) &&
-            !newItem->HasVideoInfoTag()) // File is a video and needs a VideoInfoTag
-          newItem->GetVideoInfoTag()->Reset(); // Force VideoInfoTag creation
-        if (lDuration && MUSIC::IsAudio(*newItem))
-          newItem->GetMusicInfoTag()->SetDuration(lDuration);
         for (auto &prop : properties)
         {
           newItem->SetProperty(prop.first, prop.second);
         }
 
+        // set before the type checks below, so streams without an extension are recognised
+        // without looking them up
         newItem->SetMimeType(newItem->GetProperty("mimetype").asString());
         if (!newItem->GetMimeType().empty())
           newItem->SetContentLookup(false);
 
+        if (VIDEO::IsVideo(*newItem) &&
+            !newItem->HasVideoInfoTag()) // File is a video and needs a VideoInfoTag
+          newItem->GetVideoInfoTag()->Reset(); // Force VideoInfoTag creation
+        if (lDuration && MUSIC::IsAudio(*newItem))
+          newItem->GetMusicInfoTag()->SetDuration(lDuration);
+
         Add(newItem);
 
         // Reset the values just in case there part of the file have the extended marker
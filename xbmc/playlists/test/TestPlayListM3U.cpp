@@ -0,0 +1,42 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileItem.h"
+#include "playlists/PlayListM3U.h"
+#include "test/TestUtils.h"
+
+#include <gtest/gtest.h>
+
+using namespace KODI;
+
+TEST(TestPlayListM3U, Load)
+{
+  const std::string filename = XBMC_REF_FILE_PATH("/xbmc/playlists/test/test.m3u8");
+  PLAYLIST::CPlayListM3U playlist;
+
+  EXPECT_TRUE(playlist.Load(filename));
+  ASSERT_EQ(playlist.size(), 3);
+
+  // the title starts after the first comma outside of the quoted attribute values
+  const CFileItemPtr channel{playlist[0]};
+  EXPECT_EQ("BBC One, HD", channel->GetLabel());
+  EXPECT_EQ("http://example.com/bbc1.ts", channel->GetPath());
+  EXPECT_EQ("bbc1", channel->GetProperty("tvg-id").asString());
+  EXPECT_EQ("http://example.com/logo, one.png", channel->GetProperty("tvg-logo").asString());
+  EXPECT_EQ("News, UK", channel->GetProperty("group-title").asString());
+  EXPECT_EQ("video/mp2t", channel->GetMimeType());
+
+  // the attributes of an entry don't carry over to the next one
+  const CFileItemPtr song{playlist[1]};
+  EXPECT_EQ("Artist - Song", song->GetLabel());
+  EXPECT_FALSE(song->HasProperty("group-title"));
+  EXPECT_FALSE(song->HasProperty("mimetype"));
+
+  // without #EXTINF the file name is the title
+  EXPECT_EQ("plain.mp3", playlist[2]->GetLabel());
+}
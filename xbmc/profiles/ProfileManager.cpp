@@ -49,6 +49,7 @@
 #endif
 #include "threads/SingleLock.h"
 #include "utils/FileUtils.h"
+#include "utils/SaveFileStateJob.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/Variant.h"
@@ -261,6 +262,9 @@ void CProfileManager::PrepareLoadProfile(unsigned int profileIndex)
   PVR::CPVRManager &pvrManager = CServiceBroker::GetPVRManager();
   CNetworkBase &networkManager = CServiceBroker::GetNetwork();
 
+  // file states belong to the databases of the profile being left
+  CSaveFileState::Flush();
+
   contextMenuManager.Deinit();
 
   serviceAddons.Stop();
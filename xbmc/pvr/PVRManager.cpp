@@ -47,9 +47,12 @@
 #include "utils/log.h"
 
 #include <algorithm>
+#include <chrono>
+#include <future>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -708,6 +711,16 @@ bool CPVRManager::UpdateComponents(ManagerState stateToCheck,
   if (newClients.empty())
     return !m_knownClients.empty();
 
+  auto phaseStart = std::chrono::steady_clock::now();
+  const auto logPhaseDone = [&phaseStart, &newClients](std::string_view phase)
+  {
+    const auto now = std::chrono::steady_clock::now();
+    CLog::LogFC(LOGDEBUG, LOGPVR, "Loaded {} of {} new client(s) in {} ms", phase,
+                newClients.size(),
+                std::chrono::duration_cast<std::chrono::milliseconds>(now - phaseStart).count());
+    phaseStart = now;
+  };
+
   // Load all channels and groups
   if (progressHandler)
     progressHandler->UpdateProgress(g_localizeStrings.Get(19236), 0); // Loading channels and groups
@@ -720,6 +733,8 @@ bool CPVRManager::UpdateComponents(ManagerState stateToCheck,
     return false;
   }
 
+  logPhaseDone("providers");
+
   if (stateToCheck != GetState())
     return false;
 
@@ -731,12 +746,20 @@ bool CPVRManager::UpdateComponents(ManagerState stateToCheck,
     return false;
   }
 
+  logPhaseDone("channels and groups");
+
+  // Timers and recordings only depend on the channels, not on each other. Load the recordings
+  // while the timers are loaded, so the round trips to the backends don't add up.
+  std::future<bool> recordingsLoaded = std::async(std::launch::async, [this, &newClients]()
+                                                  { return m_recordings->Update(newClients); });
+
   // Load all timers
   if (progressHandler)
     progressHandler->UpdateProgress(g_localizeStrings.Get(19237), 50); // Loading timers
 
   if (!m_timers->Update(newClients))
   {
+    recordingsLoaded.wait();
     CLog::LogF(LOGERROR, "Failed to load PVR timers.");
     m_knownClients.clear(); // start over
     PublishEvent(PVREvent::ClientsInvalidated);
@@ -747,7 +770,10 @@ bool CPVRManager::UpdateComponents(ManagerState stateToCheck,
   if (progressHandler)
     progressHandler->UpdateProgress(g_localizeStrings.Get(19238), 75); // Loading recordings
 
-  if (!m_recordings->Update(newClients))
+  const bool recordingsOk = recordingsLoaded.get();
+  logPhaseDone("timers and recordings");
+
+  if (!recordingsOk)
   {
     CLog::LogF(LOGERROR, "Failed to load PVR recordings.");
     m_knownClients.clear(); // start over
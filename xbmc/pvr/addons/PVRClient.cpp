@@ -508,6 +508,10 @@ void CPVRClient::ResetProperties()
   m_ifc.pvr->toKodi->TransferProviderEntry = cb_transfer_provider_entry;
   m_ifc.pvr->toKodi->TransferTimerEntry = cb_transfer_timer_entry;
   m_ifc.pvr->toKodi->TransferRecordingEntry = cb_transfer_recording_entry;
+  m_ifc.pvr->toKodi->TransferChannelEntries = cb_transfer_channel_entries;
+  m_ifc.pvr->toKodi->TransferEpgEntries = cb_transfer_epg_entries;
+  m_ifc.pvr->toKodi->TransferRecordingEntries = cb_transfer_recording_entries;
+  m_ifc.pvr->toKodi->TransferTimerEntries = cb_transfer_timer_entries;
   m_ifc.pvr->toKodi->AddMenuHook = cb_add_menu_hook;
   m_ifc.pvr->toKodi->RecordingNotification = cb_recording_notification;
   m_ifc.pvr->toKodi->TriggerChannelUpdate = cb_trigger_channel_update;
@@ -2265,19 +2269,28 @@ void CPVRClient::cb_transfer_channel_group_member(void* kodiInstance,
 void CPVRClient::cb_transfer_epg_entry(void* kodiInstance,
                                        const PVR_HANDLE handle,
                                        const EPG_TAG* epgentry)
+{
+  cb_transfer_epg_entries(kodiInstance, handle, epgentry, 1);
+}
+
+void CPVRClient::cb_transfer_epg_entries(void* kodiInstance,
+                                         const PVR_HANDLE handle,
+                                         const EPG_TAG* epgentries,
+                                         size_t count)
 {
   HandleAddonCallback(std::source_location::current().function_name(), kodiInstance,
-                      [handle, epgentry](const CPVRClient* client)
+                      [handle, epgentries, count](const CPVRClient* client)
                       {
-                        if (!handle || !epgentry)
+                        if (!handle || !epgentries)
                         {
                           CLog::LogF(LOGERROR, "Invalid callback parameter(s)");
                           return;
                         }
 
-                        // transfer this entry to the epg
+                        // transfer these entries to the epg
                         auto* epg{static_cast<CPVREpg*>(handle->dataAddress)};
-                        epg->UpdateEntry(epgentry, client->GetID());
+                        for (size_t i = 0; i < count; ++i)
+                          epg->UpdateEntry(&epgentries[i], client->GetID());
                       });
 }
 
@@ -2305,41 +2318,62 @@ void CPVRClient::cb_transfer_provider_entry(void* kodiInstance,
 void CPVRClient::cb_transfer_channel_entry(void* kodiInstance,
                                            const PVR_HANDLE handle,
                                            const PVR_CHANNEL* channel)
+{
+  cb_transfer_channel_entries(kodiInstance, handle, channel, 1);
+}
+
+void CPVRClient::cb_transfer_channel_entries(void* kodiInstance,
+                                             const PVR_HANDLE handle,
+                                             const PVR_CHANNEL* channels,
+                                             size_t count)
 {
   HandleAddonCallback(
       std::source_location::current().function_name(), kodiInstance,
-      [handle, channel](const CPVRClient* client)
+      [handle, channels, count](const CPVRClient* client)
       {
-        if (!handle || !channel)
+        if (!handle || !channels)
         {
           CLog::LogF(LOGERROR, "Invalid callback parameter(s)");
           return;
         }
 
-        auto* channels{
+        auto* kodiChannels{
             static_cast<std::vector<std::shared_ptr<CPVRChannel>>*>(handle->dataAddress)};
-        channels->emplace_back(std::make_shared<CPVRChannel>(*channel, client->GetID()));
+        kodiChannels->reserve(kodiChannels->size() + count);
+        for (size_t i = 0; i < count; ++i)
+          kodiChannels->emplace_back(std::make_shared<CPVRChannel>(channels[i], client->GetID()));
       });
 }
 
 void CPVRClient::cb_transfer_recording_entry(void* kodiInstance,
                                              const PVR_HANDLE handle,
                                              const PVR_RECORDING* recording)
+{
+  cb_transfer_recording_entries(kodiInstance, handle, recording, 1);
+}
+
+void CPVRClient::cb_transfer_recording_entries(void* kodiInstance,
+                                               const PVR_HANDLE handle,
+                                               const PVR_RECORDING* recordings,
+                                               size_t count)
 {
   HandleAddonCallback(std::source_location::current().function_name(), kodiInstance,
-                      [handle, recording](const CPVRClient* client)
+                      [handle, recordings, count](const CPVRClient* client)
                       {
-                        if (!handle || !recording)
+                        if (!handle || !recordings)
                         {
                           CLog::LogF(LOGERROR, "Invalid callback parameter(s)");
                           return;
                         }
 
-                        // transfer this entry to the recordings container
-                        const auto transferRecording{
-                            std::make_shared<CPVRRecording>(*recording, client->GetID())};
-                        auto* recordings{static_cast<CPVRRecordings*>(handle->dataAddress)};
-                        recordings->UpdateFromClient(transferRecording, *client);
+                        // transfer these entries to the recordings container
+                        auto* kodiRecordings{static_cast<CPVRRecordings*>(handle->dataAddress)};
+                        for (size_t i = 0; i < count; ++i)
+                        {
+                          const auto transferRecording{
+                              std::make_shared<CPVRRecording>(recordings[i], client->GetID())};
+                          kodiRecordings->UpdateFromClient(transferRecording, *client);
+                        }
                       });
 }
 
@@ -2347,27 +2381,40 @@ void CPVRClient::cb_transfer_timer_entry(void* kodiInstance,
                                          const PVR_HANDLE handle,
                                          const PVR_TIMER* timer)
 {
-  HandleAddonCallback(std::source_location::current().function_name(), kodiInstance,
-                      [handle, timer](const CPVRClient* client)
-                      {
-                        if (!handle || !timer)
-                        {
-                          CLog::LogF(LOGERROR, "Invalid callback parameter(s)");
-                          return;
-                        }
+  cb_transfer_timer_entries(kodiInstance, handle, timer, 1);
+}
 
-                        // Note: channel can be nullptr here, for instance for epg-based timer rules
-                        //       ("record on any channel" condition)
-                        const std::shared_ptr<CPVRChannel> channel =
-                            CServiceBroker::GetPVRManager().ChannelGroups()->GetByUniqueID(
-                                timer->iClientChannelUid, client->GetID());
-
-                        // transfer this entry to the timers container
-                        const auto transferTimer{
-                            std::make_shared<CPVRTimerInfoTag>(*timer, channel, client->GetID())};
-                        auto* timers{static_cast<CPVRTimersContainer*>(handle->dataAddress)};
-                        timers->UpdateFromClient(transferTimer);
-                      });
+void CPVRClient::cb_transfer_timer_entries(void* kodiInstance,
+                                           const PVR_HANDLE handle,
+                                           const PVR_TIMER* timers,
+                                           size_t count)
+{
+  HandleAddonCallback(
+      std::source_location::current().function_name(), kodiInstance,
+      [handle, timers, count](const CPVRClient* client)
+      {
+        if (!handle || !timers)
+        {
+          CLog::LogF(LOGERROR, "Invalid callback parameter(s)");
+          return;
+        }
+
+        const std::shared_ptr<const CPVRChannelGroupsContainer> groups{
+            CServiceBroker::GetPVRManager().ChannelGroups()};
+        auto* kodiTimers{static_cast<CPVRTimersContainer*>(handle->dataAddress)};
+        for (size_t i = 0; i < count; ++i)
+        {
+          // Note: channel can be nullptr here, for instance for epg-based timer rules
+          //       ("record on any channel" condition)
+          const std::shared_ptr<CPVRChannel> channel{
+              groups->GetByUniqueID(timers[i].iClientChannelUid, client->GetID())};
+
+          // transfer this entry to the timers container
+          const auto transferTimer{
+              std::make_shared<CPVRTimerInfoTag>(timers[i], channel, client->GetID())};
+          kodiTimers->UpdateFromClient(transferTimer);
+        }
+      });
 }
 
 void CPVRClient::cb_add_menu_hook(void* kodiInstance, const PVR_MENUHOOK* hook)
@@ -999,6 +999,18 @@ private:
                                     const PVR_HANDLE handle,
                                     const EPG_TAG* entry);
 
+  /*!
+   * @brief Transfer several EPG tags from the add-on to Kodi at once
+   * @param kodiInstance Pointer to Kodi's CPVRClient class
+   * @param handle The handle parameter that Kodi used when requesting the EPG data
+   * @param entries The entries to transfer to Kodi
+   * @param count The number of entries
+   */
+  static void cb_transfer_epg_entries(void* kodiInstance,
+                                      const PVR_HANDLE handle,
+                                      const EPG_TAG* entries,
+                                      size_t count);
+
   /*!
    * @brief Transfer a channel entry from the add-on to Kodi
    * @param kodiInstance Pointer to Kodi's CPVRClient class
@@ -1009,6 +1021,18 @@ private:
                                         const PVR_HANDLE handle,
                                         const PVR_CHANNEL* entry);
 
+  /*!
+   * @brief Transfer several channel entries from the add-on to Kodi at once
+   * @param kodiInstance Pointer to Kodi's CPVRClient class
+   * @param handle The handle parameter that Kodi used when requesting the channel list
+   * @param entries The entries to transfer to Kodi
+   * @param count The number of entries
+   */
+  static void cb_transfer_channel_entries(void* kodiInstance,
+                                          const PVR_HANDLE handle,
+                                          const PVR_CHANNEL* entries,
+                                          size_t count);
+
   /*!
    * @brief Transfer a provider entry from the add-on to Kodi
    * @param kodiInstance Pointer to Kodi's CPVRClient class
@@ -1029,6 +1053,18 @@ private:
                                       const PVR_HANDLE handle,
                                       const PVR_TIMER* entry);
 
+  /*!
+   * @brief Transfer several timer entries from the add-on to Kodi at once
+   * @param kodiInstance Pointer to Kodi's CPVRClient class
+   * @param handle The handle parameter that Kodi used when requesting the timers list
+   * @param entries The entries to transfer to Kodi
+   * @param count The number of entries
+   */
+  static void cb_transfer_timer_entries(void* kodiInstance,
+                                        const PVR_HANDLE handle,
+                                        const PVR_TIMER* entries,
+                                        size_t count);
+
   /*!
    * @brief Transfer a recording entry from the add-on to Kodi
    * @param kodiInstance Pointer to Kodi's CPVRClient class
@@ -1039,6 +1075,18 @@ private:
                                           const PVR_HANDLE handle,
                                           const PVR_RECORDING* entry);
 
+  /*!
+   * @brief Transfer several recording entries from the add-on to Kodi at once
+   * @param kodiInstance Pointer to Kodi's CPVRClient class
+   * @param handle The handle parameter that Kodi used when requesting the recordings list
+   * @param entries The entries to transfer to Kodi
+   * @param count The number of entries
+   */
+  static void cb_transfer_recording_entries(void* kodiInstance,
+                                            const PVR_HANDLE handle,
+                                            const PVR_RECORDING* entries,
+                                            size_t count);
+
   /*!
    * @brief Add or replace a menu hook for the context menu for this add-on
    * @param kodiInstance Pointer to Kodi's CPVRClient class
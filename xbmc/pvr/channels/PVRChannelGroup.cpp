@@ -118,6 +118,7 @@ void CPVRChannelGroup::Unload()
 {
   std::unique_lock lock(m_critSection);
   m_sortedMembers.clear();
+  m_membersSnapshot.reset();
   m_members.clear();
   m_failedClients.clear();
 }
@@ -209,12 +210,14 @@ void CPVRChannelGroup::SortByClientChannelNumber()
 {
   std::unique_lock lock(m_critSection);
   std::ranges::sort(m_sortedMembers, sortByClientChannelNumber());
+  m_membersSnapshot.reset();
 }
 
 void CPVRChannelGroup::SortByChannelNumber()
 {
   std::unique_lock lock(m_critSection);
   std::ranges::sort(m_sortedMembers, sortByChannelNumber());
+  m_membersSnapshot.reset();
 }
 
 void CPVRChannelGroup::UpdateClientPriorities()
@@ -459,33 +462,38 @@ std::shared_ptr<CPVRChannelGroupMember> CPVRChannelGroup::GetPreviousChannelGrou
   return previousMember;
 }
 
-std::vector<std::shared_ptr<CPVRChannelGroupMember>> CPVRChannelGroup::GetMembers(
-    Include eFilter /* = Include::ALL */) const
+std::shared_ptr<const std::vector<std::shared_ptr<CPVRChannelGroupMember>>> CPVRChannelGroup::
+    GetMembers(Include eFilter /* = Include::ALL */) const
 {
   std::unique_lock lock(m_critSection);
-  if (eFilter == Include::ALL)
-    return m_sortedMembers;
+  // readers share one copy of the members until they change, instead of copying them every time
+  if (!m_membersSnapshot)
+    m_membersSnapshot =
+        std::make_shared<const std::vector<std::shared_ptr<CPVRChannelGroupMember>>>(
+            m_sortedMembers);
 
-  std::vector<std::shared_ptr<CPVRChannelGroupMember>> members;
-  for (const auto& member : m_sortedMembers)
+  const auto snapshot{m_membersSnapshot};
+  lock.unlock();
+
+  const auto isIncluded = [eFilter](const std::shared_ptr<CPVRChannelGroupMember>& member)
   {
     switch (eFilter)
     {
       case Include::ONLY_HIDDEN:
-        if (!member->Channel()->IsHidden())
-          continue;
-        break;
+        return member->Channel()->IsHidden();
       case Include::ONLY_VISIBLE:
-        if (member->Channel()->IsHidden())
-          continue;
-        break;
+        return !member->Channel()->IsHidden();
       default:
-        break;
+        return true;
     }
+  };
 
-    members.emplace_back(member);
-  }
+  // the snapshot will do unless the filter actually drops members
+  if (eFilter == Include::ALL || std::ranges::all_of(*snapshot, isIncluded))
+    return snapshot;
 
+  auto members{std::make_shared<std::vector<std::shared_ptr<CPVRChannelGroupMember>>>()};
+  std::ranges::copy_if(*snapshot, std::back_inserter(*members), isIncluded);
   return members;
 }
 
@@ -547,6 +555,7 @@ int CPVRChannelGroup::LoadFromDatabase(const std::vector<std::shared_ptr<CPVRCli
       {
         // Ignore data from unknown/disabled clients
         m_sortedMembers.emplace_back(member);
+        m_membersSnapshot.reset();
         m_members.try_emplace({member->ChannelClientID(), member->ChannelUID()}, member);
       }
     }
@@ -631,6 +640,7 @@ bool CPVRChannelGroup::UpdateFromClient(const std::shared_ptr<CPVRChannelGroupMe
       channel->SetDateTimeAdded(CDateTime::GetUTCDateTime());
 
     m_sortedMembers.emplace_back(groupMember);
+    m_membersSnapshot.reset();
     m_members.try_emplace(channel->StorageId(), groupMember);
 
     CLog::LogFC(LOGDEBUG, LOGPVR, "Added {} channel group member '{}' to group '{}'",
@@ -708,6 +718,7 @@ std::vector<std::shared_ptr<CPVRChannelGroupMember>> CPVRChannelGroup::RemoveDel
 
       m_members.erase(channel->StorageId());
       it = m_sortedMembers.erase(it);
+      m_membersSnapshot.reset();
       continue;
     }
 
@@ -723,6 +734,7 @@ std::vector<std::shared_ptr<CPVRChannelGroupMember>> CPVRChannelGroup::RemoveDel
 
         m_members.erase(channel->StorageId());
         it = m_sortedMembers.erase(it);
+        m_membersSnapshot.reset();
         continue;
       }
     }
@@ -783,6 +795,7 @@ bool CPVRChannelGroup::RemoveFromGroup(
     {
       m_members.erase(storageId);
       m_sortedMembers.erase(it);
+      m_membersSnapshot.reset();
       bReturn = true;
       break;
     }
@@ -823,6 +836,7 @@ bool CPVRChannelGroup::AppendToGroup(
     newMember->SetClientPriority(groupMember->ClientPriority());
 
     m_sortedMembers.emplace_back(newMember);
+    m_membersSnapshot.reset();
     m_members.try_emplace(channel->StorageId(), newMember);
 
     SortAndRenumber();
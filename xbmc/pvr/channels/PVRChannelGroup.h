@@ -322,9 +322,10 @@ public:
   /*!
    * @brief Get the current members of this group
    * @param eFilter A filter to apply.
-   * @return The group members
+   * @return The group members. An immutable snapshot, shared between all callers until the
+   * members of the group change.
    */
-  std::vector<std::shared_ptr<CPVRChannelGroupMember>> GetMembers(
+  std::shared_ptr<const std::vector<std::shared_ptr<CPVRChannelGroupMember>>> GetMembers(
       Include eFilter = Include::ALL) const;
 
   /*!
@@ -631,6 +632,8 @@ private:
   int m_iPosition{0}; /*!< the local position of this group within the group list */
   std::vector<std::shared_ptr<CPVRChannelGroupMember>>
       m_sortedMembers; /*!< members sorted by channel number */
+  mutable std::shared_ptr<const std::vector<std::shared_ptr<CPVRChannelGroupMember>>>
+      m_membersSnapshot; /*!< copy of m_sortedMembers handed out by GetMembers, reset on change */
   CEventSource<PVREvent> m_events;
   mutable std::shared_ptr<CPVRChannelGroupSettings> m_settings;
 
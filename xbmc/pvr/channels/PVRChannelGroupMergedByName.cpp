@@ -148,7 +148,7 @@ bool CPVRChannelGroupMergedByName::UpdateGroupMembers(
       case CPVRChannelGroup::Origin::CLIENT:
       {
         const auto members{group->GetMembers()};
-        for (const auto& member : members)
+        for (const auto& member : *members)
         {
           groupMembers.emplace_back(std::make_shared<CPVRChannelGroupMember>(
               GroupID(), GroupName(), GetClientID(), member->Channel()));
@@ -255,7 +255,7 @@ std::vector<std::shared_ptr<CPVRChannelGroupMember>> CPVRChannelGroups::GetMembe
     std::unique_lock lock(m_critSection);
 
     const auto allGroupMembers = GetGroupAll()->GetMembers();
-    for (const auto& groupMember : allGroupMembers)
+    for (const auto& groupMember : *allGroupMembers)
     {
       if (!group->IsGroupMember(groupMember) &&
           (group->IsChannelsOwner() || !groupMember->Channel()->IsHidden()))
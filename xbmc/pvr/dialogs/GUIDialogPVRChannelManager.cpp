@@ -824,9 +824,9 @@ void CGUIDialogPVRChannelManager::Update()
 
   channels->UpdateFromClients({});
 
-  const std::vector<std::shared_ptr<CPVRChannelGroupMember>> groupMembers = channels->GetMembers();
+  const auto groupMembers = channels->GetMembers();
   std::shared_ptr<CFileItem> channelFile;
-  for (const auto& member : groupMembers)
+  for (const auto& member : *groupMembers)
   {
     channelFile = std::make_shared<CFileItem>(member);
     const std::shared_ptr<const CPVRChannel> channel(channelFile->GetPVRChannelInfoTag());
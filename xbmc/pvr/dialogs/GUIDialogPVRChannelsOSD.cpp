@@ -197,9 +197,8 @@ void CGUIDialogPVRChannelsOSD::Update()
         pvrMgr.PlaybackState()->GetActiveChannelGroup(channel->IsRadio());
     if (group)
     {
-      const std::vector<std::shared_ptr<CPVRChannelGroupMember>> groupMembers =
-          group->GetMembers(CPVRChannelGroup::Include::ONLY_VISIBLE);
-      for (const auto& groupMember : groupMembers)
+      const auto groupMembers = group->GetMembers(CPVRChannelGroup::Include::ONLY_VISIBLE);
+      for (const auto& groupMember : *groupMembers)
       {
         m_vecItems->Add(std::make_shared<CFileItem>(groupMember));
       }
@@ -635,9 +635,8 @@ void CGUIDialogPVRGroupManager::Update()
         CONTROL_IN_GROUP_LABEL,
         StringUtils::Format("{} {}", g_localizeStrings.Get(19220), m_selectedGroup->GroupName()));
 
-    const std::vector<std::shared_ptr<CPVRChannelGroupMember>> groupMembers =
-        m_selectedGroup->GetMembers(CPVRChannelGroup::Include::ONLY_VISIBLE);
-    for (const auto& groupMember : groupMembers)
+    const auto groupMembers = m_selectedGroup->GetMembers(CPVRChannelGroup::Include::ONLY_VISIBLE);
+    for (const auto& groupMember : *groupMembers)
     {
       m_groupMembers->Add(std::make_shared<CFileItem>(groupMember));
     }
@@ -708,7 +707,7 @@ void CGUIDialogPVRGroupManager::ClearGroupThumbnails(const CFileItem& changedIte
       if (!group)
         continue;
 
-      for (const auto& member : group->GetMembers())
+      for (const auto& member : *group->GetMembers())
       {
         // If this channel group member is a member of the changed group, update this group's thumb.
         if (changedGroup->IsGroupMember(member))
@@ -88,11 +88,10 @@ void CGUIDialogPVRGuideSearch::UpdateChannelSpin()
     group = CServiceBroker::GetPVRManager().ChannelGroups()->GetGroupAll(m_searchFilter->IsRadio());
 
   m_channelsMap.clear();
-  const std::vector<std::shared_ptr<CPVRChannelGroupMember>> groupMembers =
-      group->GetMembers(CPVRChannelGroup::Include::ONLY_VISIBLE);
+  const auto groupMembers = group->GetMembers(CPVRChannelGroup::Include::ONLY_VISIBLE);
   int iIndex = 0;
   int iSelectedChannel = EPG_SEARCH_UNSET;
-  for (const auto& groupMember : groupMembers)
+  for (const auto& groupMember : *groupMembers)
   {
     labels.emplace_back(groupMember->Channel()->ChannelName(), iIndex);
     m_channelsMap.try_emplace(iIndex, groupMember);
@@ -39,6 +39,12 @@ using namespace std::chrono_literals;
 namespace PVR
 {
 
+namespace
+{
+// how often observers are told about refreshed tables while an update runs
+constexpr auto EPG_UPDATE_NOTIFICATION_INTERVAL = 2s;
+} // unnamed namespace
+
 class CEpgUpdateRequest
 {
 public:
@@ -208,6 +214,17 @@ void CPVREpgContainer::Notify(const PVREvent& event)
     m_bUpdateNotificationPending = true;
     return;
   }
+  else if (event == PVREvent::Epg)
+  {
+    // an update announces every table it refreshed, which are up to thousands in a row. Announce
+    // them together while it runs, see UpdateEPG.
+    std::unique_lock lock(m_critSection);
+    if (m_bIsUpdating)
+    {
+      m_bUpdateNotificationPending = true;
+      return;
+    }
+  }
   else if (event == PVREvent::EpgUpdatePending)
   {
     SetHasPendingUpdates(true);
@@ -222,6 +239,16 @@ void CPVREpgContainer::Notify(const PVREvent& event)
   m_events.Publish(event);
 }
 
+void CPVREpgContainer::PublishPendingUpdateNotification()
+{
+  std::unique_lock lock(m_critSection);
+  if (m_bUpdateNotificationPending)
+  {
+    m_bUpdateNotificationPending = false;
+    m_events.Publish(PVREvent::Epg);
+  }
+}
+
 void CPVREpgContainer::LoadFromDatabase()
 {
   std::unique_lock lock(m_critSection);
@@ -425,14 +452,7 @@ void CPVREpgContainer::Process()
 
     /* check for pending update notifications */
     if (!m_bStop)
-    {
-      std::unique_lock lock(m_critSection);
-      if (m_bUpdateNotificationPending)
-      {
-        m_bUpdateNotificationPending = false;
-        m_events.Publish(PVREvent::Epg);
-      }
-    }
+      PublishPendingUpdateNotification();
 
     /* check for changes that need to be saved every 60 seconds */
     if ((iNow - iLastSave > 60) && !InterruptUpdate())
@@ -771,6 +791,7 @@ bool CPVREpgContainer::UpdateEPG(bool bOnlyPending /* = false */)
         g_localizeStrings.Get(19004)); // Loading programme guide
 
   size_t counter = 0;
+  XbmcThreads::EndTime<> notifyTimeout{EPG_UPDATE_NOTIFICATION_INTERVAL};
   for (const auto& [_, epg] : epgsToUpdate)
   {
     if (InterruptUpdate())
@@ -779,6 +800,12 @@ bool CPVREpgContainer::UpdateEPG(bool bOnlyPending /* = false */)
       break;
     }
 
+    if (notifyTimeout.IsTimePast())
+    {
+      PublishPendingUpdateNotification();
+      notifyTimeout.Set(EPG_UPDATE_NOTIFICATION_INTERVAL);
+    }
+
     if (!epg)
       continue;
 
@@ -250,6 +250,11 @@ public:
   bool DeleteSavedSearch(const CPVREpgSearchFilter& search);
 
 private:
+  /*!
+   * @brief Tell observers about updated EPG data if any update notification is pending.
+   */
+  void PublishPendingUpdateNotification();
+
   /*!
    * @brief Notify EPG table observers when the currently active tag changed.
    * @return True if the check was done, false if it was not the right time to check
@@ -430,54 +430,132 @@ std::vector<std::shared_ptr<CPVREpg>> CPVREpgDatabase::GetAll()
   return result;
 }
 
+// the epgtags columns, looked up once per result set instead of by name for every field of every
+// row. Field lookups by name convert the name to lower case first.
+struct CPVREpgDatabase::TagColumns
+{
+  explicit TagColumns(dbiplus::Dataset& ds)
+    : idEpg(ds.fieldIndex("idEpg")),
+      sIconPath(ds.fieldIndex("sIconPath")),
+      sParentalRatingIcon(ds.fieldIndex("sParentalRatingIcon")),
+      iStartTime(ds.fieldIndex("iStartTime")),
+      iEndTime(ds.fieldIndex("iEndTime")),
+      sFirstAired(ds.fieldIndex("sFirstAired")),
+      iBroadcastUid(ds.fieldIndex("iBroadcastUid")),
+      idBroadcast(ds.fieldIndex("idBroadcast")),
+      sTitle(ds.fieldIndex("sTitle")),
+      sPlotOutline(ds.fieldIndex("sPlotOutline")),
+      sPlot(ds.fieldIndex("sPlot")),
+      sOriginalTitle(ds.fieldIndex("sOriginalTitle")),
+      sCast(ds.fieldIndex("sCast")),
+      sDirector(ds.fieldIndex("sDirector")),
+      sWriter(ds.fieldIndex("sWriter")),
+      iYear(ds.fieldIndex("iYear")),
+      sIMDBNumber(ds.fieldIndex("sIMDBNumber")),
+      iParentalRating(ds.fieldIndex("iParentalRating")),
+      iStarRating(ds.fieldIndex("iStarRating")),
+      iEpisodeId(ds.fieldIndex("iEpisodeId")),
+      iEpisodePart(ds.fieldIndex("iEpisodePart")),
+      sEpisodeName(ds.fieldIndex("sEpisodeName")),
+      iSeriesId(ds.fieldIndex("iSeriesId")),
+      iFlags(ds.fieldIndex("iFlags")),
+      sSeriesLink(ds.fieldIndex("sSeriesLink")),
+      sParentalRatingCode(ds.fieldIndex("sParentalRatingCode")),
+      sParentalRatingSource(ds.fieldIndex("sParentalRatingSource")),
+      iGenreType(ds.fieldIndex("iGenreType")),
+      iGenreSubType(ds.fieldIndex("iGenreSubType")),
+      sGenre(ds.fieldIndex("sGenre")),
+      sTitleExtraInfo(ds.fieldIndex("sTitleExtraInfo"))
+  {
+  }
+
+  int idEpg;
+  int sIconPath;
+  int sParentalRatingIcon;
+  int iStartTime;
+  int iEndTime;
+  int sFirstAired;
+  int iBroadcastUid;
+  int idBroadcast;
+  int sTitle;
+  int sPlotOutline;
+  int sPlot;
+  int sOriginalTitle;
+  int sCast;
+  int sDirector;
+  int sWriter;
+  int iYear;
+  int sIMDBNumber;
+  int iParentalRating;
+  int iStarRating;
+  int iEpisodeId;
+  int iEpisodePart;
+  int sEpisodeName;
+  int iSeriesId;
+  int iFlags;
+  int sSeriesLink;
+  int sParentalRatingCode;
+  int sParentalRatingSource;
+  int iGenreType;
+  int iGenreSubType;
+  int sGenre;
+  int sTitleExtraInfo;
+};
+
 std::shared_ptr<CPVREpgInfoTag> CPVREpgDatabase::CreateEpgTag(dbiplus::Dataset& ds) const
+{
+  return CreateEpgTag(ds, TagColumns(ds));
+}
+
+std::shared_ptr<CPVREpgInfoTag> CPVREpgDatabase::CreateEpgTag(dbiplus::Dataset& ds,
+                                                              const TagColumns& columns) const
 {
   if (!ds.eof())
   {
     std::shared_ptr<CPVREpgInfoTag> newTag{std::make_shared<CPVREpgInfoTag>(
-        m_pDS->fv("idEpg").get_asInt(), m_pDS->fv("sIconPath").get_asString(),
-        m_pDS->fv("sParentalRatingIcon").get_asString())};
+        ds.fv(columns.idEpg).get_asInt(), ds.fv(columns.sIconPath).get_asString(),
+        ds.fv(columns.sParentalRatingIcon).get_asString())};
 
-    auto iStartTime{static_cast<time_t>(m_pDS->fv("iStartTime").get_asInt())};
+    auto iStartTime{static_cast<time_t>(ds.fv(columns.iStartTime).get_asInt())};
     const CDateTime startTime(iStartTime);
     newTag->m_startTime = startTime;
 
-    auto iEndTime{static_cast<time_t>(m_pDS->fv("iEndTime").get_asInt())};
+    auto iEndTime{static_cast<time_t>(ds.fv(columns.iEndTime).get_asInt())};
     const CDateTime endTime(iEndTime);
     newTag->m_endTime = endTime;
 
-    const std::string sFirstAired = m_pDS->fv("sFirstAired").get_asString();
+    const std::string sFirstAired = ds.fv(columns.sFirstAired).get_asString();
     if (!sFirstAired.empty())
       newTag->m_firstAired.SetFromW3CDate(sFirstAired);
 
-    int iBroadcastUID = m_pDS->fv("iBroadcastUid").get_asInt();
+    int iBroadcastUID = ds.fv(columns.iBroadcastUid).get_asInt();
     // Compat: null value for broadcast uid changed from numerical -1 to 0 with PVR Addon API v4.0.0
     newTag->m_iUniqueBroadcastID = iBroadcastUID == -1 ? EPG_TAG_INVALID_UID : iBroadcastUID;
 
-    newTag->m_iDatabaseID = m_pDS->fv("idBroadcast").get_asInt();
-    newTag->m_strTitle = m_pDS->fv("sTitle").get_asString();
-    newTag->m_strPlotOutline = m_pDS->fv("sPlotOutline").get_asString();
-    newTag->m_strPlot = m_pDS->fv("sPlot").get_asString();
-    newTag->m_strOriginalTitle = m_pDS->fv("sOriginalTitle").get_asString();
-    newTag->m_cast = CPVREpgInfoTag::Tokenize(m_pDS->fv("sCast").get_asString());
-    newTag->m_directors = CPVREpgInfoTag::Tokenize(m_pDS->fv("sDirector").get_asString());
-    newTag->m_writers = CPVREpgInfoTag::Tokenize(m_pDS->fv("sWriter").get_asString());
-    newTag->m_iYear = m_pDS->fv("iYear").get_asInt();
-    newTag->m_strIMDBNumber = m_pDS->fv("sIMDBNumber").get_asString();
-    newTag->m_parentalRating = m_pDS->fv("iParentalRating").get_asInt();
-    newTag->m_iStarRating = m_pDS->fv("iStarRating").get_asInt();
-    newTag->m_iEpisodeNumber = m_pDS->fv("iEpisodeId").get_asInt();
-    newTag->m_iEpisodePart = m_pDS->fv("iEpisodePart").get_asInt();
-    newTag->m_strEpisodeName = m_pDS->fv("sEpisodeName").get_asString();
-    newTag->m_iSeriesNumber = m_pDS->fv("iSeriesId").get_asInt();
-    newTag->m_iFlags = m_pDS->fv("iFlags").get_asInt();
-    newTag->m_strSeriesLink = m_pDS->fv("sSeriesLink").get_asString();
-    newTag->m_parentalRatingCode = m_pDS->fv("sParentalRatingCode").get_asString();
-    newTag->m_parentalRatingSource = m_pDS->fv("sParentalRatingSource").get_asString();
-    newTag->m_iGenreType = m_pDS->fv("iGenreType").get_asInt();
-    newTag->m_iGenreSubType = m_pDS->fv("iGenreSubType").get_asInt();
-    newTag->m_strGenreDescription = m_pDS->fv("sGenre").get_asString();
-    newTag->m_titleExtraInfo = m_pDS->fv("sTitleExtraInfo").get_asString();
+    newTag->m_iDatabaseID = ds.fv(columns.idBroadcast).get_asInt();
+    newTag->m_strTitle = ds.fv(columns.sTitle).get_asString();
+    newTag->m_strPlotOutline = ds.fv(columns.sPlotOutline).get_asString();
+    newTag->m_strPlot = ds.fv(columns.sPlot).get_asString();
+    newTag->m_strOriginalTitle = ds.fv(columns.sOriginalTitle).get_asString();
+    newTag->m_cast = CPVREpgInfoTag::Tokenize(ds.fv(columns.sCast).get_asString());
+    newTag->m_directors = CPVREpgInfoTag::Tokenize(ds.fv(columns.sDirector).get_asString());
+    newTag->m_writers = CPVREpgInfoTag::Tokenize(ds.fv(columns.sWriter).get_asString());
+    newTag->m_iYear = ds.fv(columns.iYear).get_asInt();
+    newTag->m_strIMDBNumber = ds.fv(columns.sIMDBNumber).get_asString();
+    newTag->m_parentalRating = ds.fv(columns.iParentalRating).get_asInt();
+    newTag->m_iStarRating = ds.fv(columns.iStarRating).get_asInt();
+    newTag->m_iEpisodeNumber = ds.fv(columns.iEpisodeId).get_asInt();
+    newTag->m_iEpisodePart = ds.fv(columns.iEpisodePart).get_asInt();
+    newTag->m_strEpisodeName = ds.fv(columns.sEpisodeName).get_asString();
+    newTag->m_iSeriesNumber = ds.fv(columns.iSeriesId).get_asInt();
+    newTag->m_iFlags = ds.fv(columns.iFlags).get_asInt();
+    newTag->m_strSeriesLink = ds.fv(columns.sSeriesLink).get_asString();
+    newTag->m_parentalRatingCode = ds.fv(columns.sParentalRatingCode).get_asString();
+    newTag->m_parentalRatingSource = ds.fv(columns.sParentalRatingSource).get_asString();
+    newTag->m_iGenreType = ds.fv(columns.iGenreType).get_asInt();
+    newTag->m_iGenreSubType = ds.fv(columns.iGenreSubType).get_asInt();
+    newTag->m_strGenreDescription = ds.fv(columns.sGenre).get_asString();
+    newTag->m_titleExtraInfo = ds.fv(columns.sTitleExtraInfo).get_asString();
 
     return newTag;
   }
@@ -820,9 +898,10 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgDatabase::GetEpgTags(
       if (m_pDS->query(strQuery))
       {
         std::vector<std::shared_ptr<CPVREpgInfoTag>> tags;
+        const TagColumns columns(*m_pDS);
         while (!m_pDS->eof())
         {
-          tags.emplace_back(CreateEpgTag(*m_pDS));
+          tags.emplace_back(CreateEpgTag(*m_pDS, columns));
           m_pDS->next();
         }
         m_pDS->close();
@@ -1005,9 +1084,10 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgDatabase::GetEpgTagsByMinSta
     try
     {
       std::vector<std::shared_ptr<CPVREpgInfoTag>> tags;
+      const TagColumns columns(*m_pDS);
       while (!m_pDS->eof())
       {
-        tags.emplace_back(CreateEpgTag(*m_pDS));
+        tags.emplace_back(CreateEpgTag(*m_pDS, columns));
         m_pDS->next();
       }
       m_pDS->close();
@@ -1045,9 +1125,10 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgDatabase::GetEpgTagsByMinEnd
     try
     {
       std::vector<std::shared_ptr<CPVREpgInfoTag>> tags;
+      const TagColumns columns(*m_pDS);
       while (!m_pDS->eof())
       {
-        tags.emplace_back(CreateEpgTag(*m_pDS));
+        tags.emplace_back(CreateEpgTag(*m_pDS, columns));
         m_pDS->next();
       }
       m_pDS->close();
@@ -1098,9 +1179,10 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgDatabase::GetAllEpgTags(int
     try
     {
       std::vector<std::shared_ptr<CPVREpgInfoTag>> tags;
+      const TagColumns columns(*m_pDS);
       while (!m_pDS->eof())
       {
-        tags.emplace_back(CreateEpgTag(*m_pDS));
+        tags.emplace_back(CreateEpgTag(*m_pDS, columns));
         m_pDS->next();
       }
       m_pDS->close();
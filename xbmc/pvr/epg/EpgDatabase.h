@@ -378,7 +378,11 @@ private:
 
   int GetMinSchemaVersion() const override { return 4; }
 
+  struct TagColumns;
+
   std::shared_ptr<CPVREpgInfoTag> CreateEpgTag(dbiplus::Dataset& ds) const;
+  std::shared_ptr<CPVREpgInfoTag> CreateEpgTag(dbiplus::Dataset& ds,
+                                               const TagColumns& columns) const;
 
   std::shared_ptr<CPVREpgSearchFilter> CreateEpgSearchFilter(bool bRadio,
                                                              dbiplus::Dataset& ds) const;
@@ -158,15 +158,18 @@ bool CPVREpgTagsContainer::UpdateEntries(const CPVREpgTagsContainer& tags)
     }
 
     bool bResetCache = false;
-    for (const auto& [_, tag] : tags.m_changedTags)
+    // both the new and the existing tags are ordered by start time, so walk them side by side
+    // instead of searching all existing tags for every new one
+    auto it = existingTags.cbegin();
+    for (const auto& [start, tag] : tags.m_changedTags)
     {
       tag->SetChannelData(m_channelData);
       tag->SetEpgID(m_iEpgID);
 
-      const auto it = std::ranges::find_if(existingTags, [&tag](const auto& t)
-                                           { return t->StartAsUTC() == tag->StartAsUTC(); });
+      while (it != existingTags.cend() && (*it)->StartAsUTC() < start)
+        ++it;
 
-      if (it != existingTags.cend())
+      if (it != existingTags.cend() && (*it)->StartAsUTC() == start)
       {
         const std::shared_ptr<CPVREpgInfoTag>& existingTag = *it;
 
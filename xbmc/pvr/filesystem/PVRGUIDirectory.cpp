@@ -760,7 +760,7 @@ std::shared_ptr<CPVRChannelGroupMember> GetFirstMatchingGroupMember(
   return {};
 }
 
-std::vector<std::shared_ptr<CPVRChannelGroupMember>> GetChannelGroupMembers(
+std::shared_ptr<const std::vector<std::shared_ptr<CPVRChannelGroupMember>>> GetChannelGroupMembers(
     const CPVRChannelsPath& path)
 {
   const std::string& groupName{path.GetGroupName()};
@@ -775,17 +775,16 @@ std::vector<std::shared_ptr<CPVRChannelGroupMember>> GetChannelGroupMembers(
     group = CServiceBroker::GetPVRManager().ChannelGroups()->GetGroupAll(path.IsRadio());
     if (group)
     {
-      std::vector<std::shared_ptr<CPVRChannelGroupMember>> result;
+      auto result{std::make_shared<std::vector<std::shared_ptr<CPVRChannelGroupMember>>>()};
 
-      const std::vector<std::shared_ptr<CPVRChannelGroupMember>> allGroupMembers{
-          group->GetMembers(CPVRChannelGroup::Include::ONLY_VISIBLE)};
-      for (const auto& allGroupMember : allGroupMembers)
+      const auto allGroupMembers{group->GetMembers(CPVRChannelGroup::Include::ONLY_VISIBLE)};
+      for (const auto& allGroupMember : *allGroupMembers)
       {
         std::shared_ptr<CPVRChannelGroupMember> member{
             GetLastWatchedChannelGroupMember(allGroupMember->Channel())};
         if (member)
         {
-          result.emplace_back(member);
+          result->emplace_back(member);
           continue; // Process next 'All channels' group member.
         }
 
@@ -796,12 +795,12 @@ std::vector<std::shared_ptr<CPVRChannelGroupMember>> GetChannelGroupMembers(
           // because their path is invalid (it contains the group).
           member = GetFirstMatchingGroupMember(allGroupMember->Channel());
           if (member)
-            result.emplace_back(member);
+            result->emplace_back(member);
         }
         else
         {
           // Use the 'All channels' group member.
-          result.emplace_back(allGroupMember);
+          result->emplace_back(allGroupMember);
         }
       }
       return result;
@@ -819,7 +818,7 @@ std::vector<std::shared_ptr<CPVRChannelGroupMember>> GetChannelGroupMembers(
     return group->GetMembers(CPVRChannelGroup::Include::ALL);
 
   CLog::LogF(LOGERROR, "Unable to obtain members for channel group '{}'", groupName);
-  return {};
+  return std::make_shared<const std::vector<std::shared_ptr<CPVRChannelGroupMember>>>();
 }
 } // unnamed namespace
 
@@ -856,9 +855,8 @@ bool CPVRGUIDirectory::GetChannelsDirectory(CFileItemList& results) const
       const bool playedOnly{(m_url.HasOption("view") && (m_url.GetOption("view") == "lastplayed"))};
       const bool dateAdded{(m_url.HasOption("view") && (m_url.GetOption("view") == "dateadded"))};
       const bool showHiddenChannels{path.IsHiddenChannelGroup()};
-      const std::vector<std::shared_ptr<CPVRChannelGroupMember>> groupMembers{
-          GetChannelGroupMembers(path)};
-      for (const auto& groupMember : groupMembers)
+      const auto groupMembers{GetChannelGroupMembers(path)};
+      for (const auto& groupMember : *groupMembers)
       {
         const std::shared_ptr<const CPVRChannel> channel{groupMember->Channel()};
 
@@ -1070,9 +1068,8 @@ bool CPVRGUIDirectory::GetProvidersDirectory(CFileItemList& results) const
       if (group)
       {
         const bool checkUid{path.GetProviderUid() != PVR_PROVIDER_INVALID_UID};
-        const std::vector<std::shared_ptr<CPVRChannelGroupMember>> allGroupMembers{
-            group->GetMembers(CPVRChannelGroup::Include::ONLY_VISIBLE)};
-        for (const auto& allGroupMember : allGroupMembers)
+        const auto allGroupMembers{group->GetMembers(CPVRChannelGroup::Include::ONLY_VISIBLE)};
+        for (const auto& allGroupMember : *allGroupMembers)
         {
           const std::shared_ptr<const CPVRChannel> channel{allGroupMember->Channel()};
 
@@ -523,12 +523,14 @@ bool CGUIEPGGridContainerModel::FreeProgrammeMemory(int firstChannel,
 
   bool newChannels = false;
 
-  if (channelsChanged)
+  if (channelsChanged || blocksChanged)
   {
-    // purge epg tags for inactive channels
+    // purge epg tags for inactive channels. While only scrolling through the channels, keep the
+    // ones up to a page away, so scrolling back and forth doesn't fetch them from the db again.
+    const int margin = blocksChanged ? 0 : lastChannel - firstChannel + 1;
     for (auto it = m_epgItems.begin(); it != m_epgItems.end();)
     {
-      if ((*it).first < firstChannel || (*it).first > lastChannel)
+      if ((*it).first < firstChannel - margin || (*it).first > lastChannel + margin)
       {
         it = m_epgItems.erase(it);
         continue; // next channel
@@ -547,11 +549,8 @@ bool CGUIEPGGridContainerModel::FreeProgrammeMemory(int firstChannel,
     std::vector<std::shared_ptr<CPVREpgInfoTag>> tags;
     for (int i = firstChannel; i <= lastChannel; ++i)
     {
-      auto it = m_epgItems.find(i);
-      if (it == m_epgItems.end())
-        it = m_epgItems.try_emplace(i).first;
-
-      if (blocksChanged || i < m_firstActiveChannel || i > m_lastActiveChannel)
+      auto [it, inserted] = m_epgItems.try_emplace(i);
+      if (blocksChanged || inserted)
       {
         EpgTags& epgTags = (*it).second;
 
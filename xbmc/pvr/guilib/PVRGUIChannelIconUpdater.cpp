@@ -11,6 +11,7 @@
 #include "FileItem.h"
 #include "FileItemList.h"
 #include "ServiceBroker.h"
+#include "TextureCache.h"
 #include "Util.h"
 #include "filesystem/Directory.h"
 #include "guilib/LocalizeStrings.h"
@@ -25,13 +26,23 @@
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
+#include <atomic>
+#include <future>
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 using namespace PVR;
 
+namespace
+{
+// icons checked for existence at the same time
+constexpr size_t MAX_ICON_CHECKS = 8;
+} // unnamed namespace
+
 void CPVRGUIChannelIconUpdater::SearchAndUpdateMissingChannelIcons() const
 {
   const std::string iconPath = CServiceBroker::GetSettingsComponent()->GetSettings()->GetString(
@@ -52,56 +63,82 @@ void CPVRGUIChannelIconUpdater::SearchAndUpdateMissingChannelIcons() const
   // create a map for fast lookup of normalized file base name
   using FileNamesMap = std::map<std::string, std::string, std::less<>>;
   FileNamesMap fileItemMap;
+  std::unordered_set<std::string> listedIcons;
   for (const auto& item : fileItemList)
   {
     std::string baseName = URIUtils::GetFileName(item->GetPath());
     URIUtils::RemoveExtension(baseName);
     StringUtils::ToLower(baseName);
     fileItemMap.try_emplace(std::move(baseName), item->GetPath());
+    listedIcons.insert(item->GetPath());
+  }
+
+  std::vector<std::shared_ptr<CPVRChannel>> channels;
+  for (const auto& group : m_groups)
+  {
+    const auto members = group->GetMembers();
+    for (const auto& member : *members)
+      channels.emplace_back(member->Channel());
   }
 
   std::unique_ptr<CPVRGUIProgressHandler> progressHandler;
-  if (!m_groups.empty())
+  if (!channels.empty())
     progressHandler = std::make_unique<CPVRGUIProgressHandler>(
         g_localizeStrings.Get(19286)); // Searching for channel icons
 
-  for (const auto& group : m_groups)
+  // check whether the icons already set still exist. icons from the icon path are known to exist
+  // from its listing, the others are checked several at a time as they may be on network shares
+  std::vector<char> iconExists(channels.size(), false);
+  std::atomic<size_t> next{0};
+  const auto checkIcons = [&channels, &iconExists, &listedIcons, &next]()
   {
-    const std::vector<std::shared_ptr<CPVRChannelGroupMember>> members = group->GetMembers();
-    size_t channelIndex = 0;
-    for (const auto& member : members)
+    for (size_t i = next++; i < channels.size(); i = next++)
     {
-      const std::shared_ptr<CPVRChannel> channel = member->Channel();
-
-      progressHandler->UpdateProgress(channel->ChannelName(), channelIndex, members.size());
-      channelIndex++;
-
-      // skip if an icon is already set and exists
-      if (CFileUtils::Exists(channel->IconPath()))
-        continue;
-
-      // reset icon before searching for a new one
-      channel->SetIconPath("");
-
-      const std::string strChannelUid = StringUtils::Format("{:08}", channel->UniqueID());
-      std::string strLegalClientChannelName =
-          CUtil::MakeLegalFileName(channel->ClientChannelName());
-      StringUtils::ToLower(strLegalClientChannelName);
-      std::string strLegalChannelName = CUtil::MakeLegalFileName(channel->ChannelName());
-      StringUtils::ToLower(strLegalChannelName);
-
-      FileNamesMap::iterator itItem;
-      if ((itItem = fileItemMap.find(strLegalClientChannelName)) != fileItemMap.end() ||
-          (itItem = fileItemMap.find(strLegalChannelName)) != fileItemMap.end() ||
-          (itItem = fileItemMap.find(strChannelUid)) != fileItemMap.end())
-      {
-        channel->SetIconPath(itItem->second, CServiceBroker::GetSettingsComponent()
-                                                 ->GetAdvancedSettings()
-                                                 ->m_bPVRAutoScanIconsUserSet);
-      }
-
-      if (m_bUpdateDb)
-        channel->Persist();
+      const std::string clientIcon = channels[i]->ClientIconPath();
+      iconExists[i] = !clientIcon.empty() && (listedIcons.contains(clientIcon) ||
+                                              CFileUtils::Exists(channels[i]->IconPath()));
     }
+  };
+
+  std::vector<std::future<void>> workers;
+  for (size_t i = 0; i < std::min(MAX_ICON_CHECKS, channels.size()); ++i)
+    workers.emplace_back(std::async(std::launch::async, checkIcons));
+  for (const auto& worker : workers)
+    worker.wait();
+
+  const bool bIsUserSetIcon{
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_bPVRAutoScanIconsUserSet};
+  for (size_t i = 0; i < channels.size(); ++i)
+  {
+    const std::shared_ptr<CPVRChannel>& channel = channels[i];
+
+    progressHandler->UpdateProgress(channel->ChannelName(), i, channels.size());
+
+    // skip if an icon is already set and exists
+    if (iconExists[i])
+      continue;
+
+    // reset icon before searching for a new one
+    channel->SetIconPath("");
+
+    const std::string strChannelUid = StringUtils::Format("{:08}", channel->UniqueID());
+    std::string strLegalClientChannelName = CUtil::MakeLegalFileName(channel->ClientChannelName());
+    StringUtils::ToLower(strLegalClientChannelName);
+    std::string strLegalChannelName = CUtil::MakeLegalFileName(channel->ChannelName());
+    StringUtils::ToLower(strLegalChannelName);
+
+    FileNamesMap::iterator itItem;
+    if ((itItem = fileItemMap.find(strLegalClientChannelName)) != fileItemMap.end() ||
+        (itItem = fileItemMap.find(strLegalChannelName)) != fileItemMap.end() ||
+        (itItem = fileItemMap.find(strChannelUid)) != fileItemMap.end())
+    {
+      channel->SetIconPath(itItem->second, bIsUserSetIcon);
+
+      // cache the icon in the background now, instead of when the channel is first shown
+      CServiceBroker::GetTextureCache()->BackgroundCacheImage(channel->IconPath());
+    }
+
+    if (m_bUpdateDb)
+      channel->Persist();
   }
 }
@@ -397,6 +397,30 @@ void CPVRRecording::UpdateMetadata(CVideoDatabase& db, const CPVRClient& client)
   m_bGotMetaData = true;
 }
 
+void CPVRRecording::UpdateMetadata(CVideoDatabase& db,
+                                   const CPVRClient& client,
+                                   const VideoFilePlayState* state)
+{
+  if (m_bGotMetaData || !db.IsOpen())
+    return;
+
+  // files without a play state have never been played, there's nothing else stored for them
+  if (state)
+  {
+    if (!client.GetClientCapabilities().SupportsRecordingsPlayCount())
+      CVideoInfoTag::SetPlayCount(state->playCount);
+
+    if (!client.GetClientCapabilities().SupportsRecordingsLastPlayedPosition() &&
+        state->resumePoint.type == CBookmark::RESUME)
+      CVideoInfoTag::SetResumePoint(state->resumePoint);
+
+    m_lastPlayed = state->lastPlayed;
+    db.GetStreamDetails(m_strFileNameAndPath, m_streamDetails);
+  }
+
+  m_bGotMetaData = true;
+}
+
 void CPVRRecording::DeleteMetadata(CVideoDatabase& db) const
 {
   db.BeginTransaction();
@@ -23,6 +23,7 @@
 #include <vector>
 
 class CVideoDatabase;
+struct VideoFilePlayState;
 
 namespace EDL
 {
@@ -172,6 +173,17 @@ public:
    */
   void UpdateMetadata(CVideoDatabase& db, const CPVRClient& client);
 
+  /*!
+   * @brief Get metadata like the resume point and play count if the client doesn't handle it
+   * itself, from a play state read beforehand for many recordings at once.
+   * @param db The database to read the remaining data from.
+   * @param client The client this recording belongs to.
+   * @param state The play state of the recording, nullptr if it has none in the database.
+   */
+  void UpdateMetadata(CVideoDatabase& db,
+                      const CPVRClient& client,
+                      const VideoFilePlayState* state);
+
   /*!
    * @brief Delete metadata like the resume point and play count from the database.
    * @param db The database to delete the data from.
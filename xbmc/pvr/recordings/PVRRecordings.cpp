@@ -24,6 +24,8 @@
 #include <memory>
 #include <mutex>
 #include <ranges>
+#include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -53,6 +55,9 @@ bool CPVRRecordings::UpdateFromClients(const std::vector<std::shared_ptr<CPVRCli
   CServiceBroker::GetPVRManager().Clients()->GetRecordings(clients, this, false, failedClients);
   CServiceBroker::GetPVRManager().Clients()->GetRecordings(clients, this, true, failedClients);
 
+  UpdateMetadata(m_newRecordings);
+  m_newRecordings.clear();
+
   // remove recordings that were deleted at the backend
   for (auto it = m_recordings.cbegin(); it != m_recordings.cend();)
   {
@@ -236,7 +241,12 @@ void CPVRRecordings::UpdateFromClient(const std::shared_ptr<CPVRRecording>& tag,
   }
   else
   {
-    tag->UpdateMetadata(GetVideoDatabase(), client);
+    // while updating, the metadata of all new recordings is read at once when done
+    if (m_bIsUpdating)
+      m_newRecordings.emplace_back(tag);
+    else
+      tag->UpdateMetadata(GetVideoDatabase(), client);
+
     m_iLastId++;
     tag->SetRecordingID(m_iLastId);
     m_recordings.try_emplace({tag->ClientID(), tag->ClientRecordingID()}, tag);
@@ -365,6 +375,33 @@ bool CPVRRecordings::DeleteRecording(const std::shared_ptr<CPVRRecording>& recor
   return false;
 }
 
+void CPVRRecordings::UpdateMetadata(const std::vector<std::shared_ptr<CPVRRecording>>& recordings)
+{
+  if (recordings.empty())
+    return;
+
+  CVideoDatabase& db = GetVideoDatabase();
+  std::unordered_map<std::string, VideoFilePlayState> states;
+  const bool bGotStates = db.GetPlayStates(CPVRRecordingsPath::PATH_RECORDINGS, states);
+
+  for (const auto& recording : recordings)
+  {
+    const std::shared_ptr<const CPVRClient> client =
+        CServiceBroker::GetPVRManager().GetClient(recording->ClientID());
+    if (!client)
+      continue;
+
+    if (!bGotStates)
+    {
+      recording->UpdateMetadata(db, *client);
+      continue;
+    }
+
+    const auto it = states.find(recording->m_strFileNameAndPath);
+    recording->UpdateMetadata(db, *client, it != states.cend() ? &it->second : nullptr);
+  }
+}
+
 CVideoDatabase& CPVRRecordings::GetVideoDatabase()
 {
   if (!m_database)
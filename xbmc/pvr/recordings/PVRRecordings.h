@@ -166,6 +166,13 @@ private:
    */
   bool ChangeRecordingsPlayCount(const std::shared_ptr<CPVRRecording>& recording, int count);
 
+  /*!
+   * @brief Get the local metadata of the given recordings, reading the play states of all of them
+   * from the database at once.
+   * @param recordings The recordings
+   */
+  void UpdateMetadata(const std::vector<std::shared_ptr<CPVRRecording>>& recordings);
+
   mutable CCriticalSection m_critSection;
   bool m_bIsUpdating = false;
   std::map<CPVRRecordingUid, std::shared_ptr<CPVRRecording>> m_recordings;
@@ -175,5 +182,6 @@ private:
   bool m_bDeletedRadioRecordings = false;
   unsigned int m_iTVRecordings = 0;
   unsigned int m_iRadioRecordings = 0;
+  std::vector<std::shared_ptr<CPVRRecording>> m_newRecordings; // added by the running update
 };
 } // namespace PVR
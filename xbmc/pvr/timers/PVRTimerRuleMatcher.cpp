@@ -73,11 +73,29 @@ CDateTime CPVRTimerRuleMatcher::GetNextTimerStart() const
   return nextStart.GetAsUTCDateTime();
 }
 
+unsigned int CPVRTimerRuleMatcher::GetWeekDays() const
+{
+  if (m_timerRule->GetTimerType()->SupportsWeekdays())
+    return m_timerRule->WeekDays();
+
+  return PVR_WEEKDAY_ALLDAYS;
+}
+
+unsigned int CPVRTimerRuleMatcher::GetWeekDay(const CPVREpgInfoTag& epgTag)
+{
+  int startWeekday{epgTag.StartAsLocalTime().GetDayOfWeek()};
+  if (startWeekday == 0)
+    startWeekday = 7;
+
+  return 1 << (startWeekday - 1);
+}
+
 bool CPVRTimerRuleMatcher::Matches(const std::shared_ptr<const CPVREpgInfoTag>& epgTag) const
 {
-  return epgTag && epgTag->EndAsLocalTime() > m_start && MatchSeriesLink(epgTag) &&
-         MatchChannel(epgTag) && MatchStart(epgTag) && MatchEnd(epgTag) && MatchDayOfWeek(epgTag) &&
-         MatchSearchText(epgTag);
+  // cheapest checks first, the search text is matched against a regular expression
+  return epgTag && epgTag->EndAsLocalTime() > m_start && MatchDayOfWeek(epgTag) &&
+         MatchChannel(epgTag) && MatchSeriesLink(epgTag) && MatchStart(epgTag) &&
+         MatchEnd(epgTag) && MatchSearchText(epgTag);
 }
 
 bool CPVRTimerRuleMatcher::MatchSeriesLink(
@@ -157,16 +175,10 @@ bool CPVRTimerRuleMatcher::MatchEnd(const std::shared_ptr<const CPVREpgInfoTag>&
 
 bool CPVRTimerRuleMatcher::MatchDayOfWeek(const std::shared_ptr<const CPVREpgInfoTag>& epgTag) const
 {
-  if (m_timerRule->GetTimerType()->SupportsWeekdays() &&
-      m_timerRule->WeekDays() != PVR_WEEKDAY_ALLDAYS)
-  {
-    const CDateTime startEpgLocal{epgTag->StartAsLocalTime()};
-    int startWeekday{startEpgLocal.GetDayOfWeek()};
-    if (startWeekday == 0)
-      startWeekday = 7;
+  const unsigned int weekDays{GetWeekDays()};
+  if (weekDays != PVR_WEEKDAY_ALLDAYS)
+    return (GetWeekDay(*epgTag) & weekDays) != 0;
 
-    return ((1 << (startWeekday - 1)) & m_timerRule->WeekDays());
-  }
   return true;
 }
 
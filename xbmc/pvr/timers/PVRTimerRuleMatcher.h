@@ -30,6 +30,20 @@ public:
 
   std::shared_ptr<const CPVRChannel> GetChannel() const;
   CDateTime GetNextTimerStart() const;
+
+  /*!
+   * @brief Get the days of the week an EPG tag may start on to match the rule.
+   * @return The days as PVR_WEEKDAY_* flags, PVR_WEEKDAY_ALLDAYS if the rule is not restricted.
+   */
+  unsigned int GetWeekDays() const;
+
+  /*!
+   * @brief Get the day of the week an EPG tag starts on.
+   * @param epgTag The EPG tag.
+   * @return The day as one of the PVR_WEEKDAY_* flags.
+   */
+  static unsigned int GetWeekDay(const CPVREpgInfoTag& epgTag);
+
   bool Matches(const std::shared_ptr<const CPVREpgInfoTag>& epgTag) const;
 
 private:
@@ -27,10 +27,13 @@
 #include "utils/log.h"
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <numeric>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -463,25 +466,31 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> GetEpgTagsForTimerRule(
   return matches;
 }
 
-void AddTimerRuleToEpgMap(
-    const std::shared_ptr<CPVRTimerInfoTag>& timer,
-    const CDateTime& now,
-    std::map<std::shared_ptr<CPVREpg>, std::vector<std::shared_ptr<CPVRTimerRuleMatcher>>>& epgMap,
-    bool& bFetchedAllEpgs)
+// the rules to match against the tags of an EPG, by the day of the week a tag must start on
+using TimerRuleIndex = std::array<std::vector<std::shared_ptr<CPVRTimerRuleMatcher>>, 7>;
+
+void AddTimerRuleToIndex(const std::shared_ptr<CPVRTimerRuleMatcher>& matcher,
+                         TimerRuleIndex& index)
+{
+  const unsigned int weekDays{matcher->GetWeekDays()};
+  for (size_t day = 0; day < index.size(); ++day)
+  {
+    if (weekDays & (1 << day))
+      index[day].emplace_back(matcher);
+  }
+}
+
+void AddTimerRuleToEpgMap(const std::shared_ptr<CPVRTimerInfoTag>& timer,
+                          const CDateTime& now,
+                          std::map<std::shared_ptr<CPVREpg>, TimerRuleIndex>& epgMap,
+                          bool& bFetchedAllEpgs)
 {
   const std::shared_ptr<const CPVRChannel> channel = timer->Channel();
   if (channel)
   {
     const std::shared_ptr<CPVREpg> epg = channel->GetEPG();
     if (epg)
-    {
-      const auto matcher{std::make_shared<CPVRTimerRuleMatcher>(timer, now)};
-      auto it = epgMap.find(epg);
-      if (it == epgMap.cend())
-        epgMap.insert({epg, {matcher}});
-      else
-        it->second.emplace_back(matcher);
-    }
+      AddTimerRuleToIndex(std::make_shared<CPVRTimerRuleMatcher>(timer, now), epgMap[epg]);
   }
   else
   {
@@ -491,24 +500,13 @@ void AddTimerRuleToEpgMap(
       const std::vector<std::shared_ptr<CPVREpg>> epgs =
           CServiceBroker::GetPVRManager().EpgContainer().GetAllEpgs();
       for (const auto& epg : epgs)
-      {
-        const auto matcher{std::make_shared<CPVRTimerRuleMatcher>(timer, now)};
-        auto it = epgMap.find(epg);
-        if (it == epgMap.cend())
-          epgMap.insert({epg, {matcher}});
-        else
-          it->second.emplace_back(matcher);
-      }
+        epgMap.try_emplace(epg);
+
       bFetchedAllEpgs = true;
     }
-    else
-    {
-      for (auto& [_, matchers] : epgMap)
-      {
-        const auto matcher{std::make_shared<CPVRTimerRuleMatcher>(timer, now)};
-        matchers.emplace_back(matcher);
-      }
-    }
+
+    for (auto& [_, index] : epgMap)
+      AddTimerRuleToIndex(std::make_shared<CPVRTimerRuleMatcher>(timer, now), index);
   }
 }
 } // unnamed namespace
@@ -521,7 +519,7 @@ bool CPVRTimers::UpdateEntries(int iMaxNotificationDelay)
   bool bChanged = false;
   const CDateTime now = CDateTime::GetUTCDateTime();
   bool bFetchedAllEpgs = false;
-  std::map<std::shared_ptr<CPVREpg>, std::vector<std::shared_ptr<CPVRTimerRuleMatcher>>> epgMap;
+  std::map<std::shared_ptr<CPVREpg>, TimerRuleIndex> epgMap;
 
   std::unique_lock lock(m_critSection);
 
@@ -696,19 +694,27 @@ bool CPVRTimers::UpdateEntries(int iMaxNotificationDelay)
   }
 
   // create new children of local epg-based reminder timer rules
-  for (const auto& [epg, matchers] : epgMap)
+  for (const auto& [epg, index] : epgMap)
   {
     const auto epgTags{epg->GetTags()};
     for (const auto& epgTag : epgTags)
     {
-      if (GetTimerForEpgTag(epgTag))
-        continue;
+      if (epgTag->EndAsUTC() <= now)
+        continue; // over already, can't match any rule
 
-      for (const auto& matcher : matchers)
+      // only the rules for the day the tag starts on can match. looking for an existing timer for
+      // the tag means going through all timers, so only do it once a rule matches
+      std::optional<bool> hasTimer;
+      for (const auto& matcher : index[std::countr_zero(CPVRTimerRuleMatcher::GetWeekDay(*epgTag))])
       {
         if (!matcher->Matches(epgTag))
           continue;
 
+        if (!hasTimer)
+          hasTimer = GetTimerForEpgTag(epgTag) != nullptr;
+        if (*hasTimer)
+          break;
+
         const std::shared_ptr<CPVRTimerInfoTag> childTimer =
             CPVRTimerInfoTag::CreateReminderFromEpg(epgTag, matcher->GetTimerRule());
         if (childTimer)
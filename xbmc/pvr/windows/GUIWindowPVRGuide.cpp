@@ -788,10 +788,9 @@ bool CGUIWindowPVRGuideBase::RefreshTimelineItems()
         endDate = maxFutureDate;
 
       CFileItemList channels;
-      const std::vector<std::shared_ptr<CPVRChannelGroupMember>> groupMembers =
-          group->GetMembers(CPVRChannelGroup::Include::ONLY_VISIBLE);
+      const auto groupMembers = group->GetMembers(CPVRChannelGroup::Include::ONLY_VISIBLE);
 
-      for (const auto& groupMember : groupMembers)
+      for (const auto& groupMember : *groupMembers)
       {
         channels.Add(std::make_shared<CFileItem>(groupMember));
       }
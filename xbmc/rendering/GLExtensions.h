@@ -21,7 +21,9 @@ struct CGLExtensions
     ARB_pixel_buffer_object,
     ARB_texture_float,
     ARB_texture_swizzle,
+    ARB_timer_query,
     EXT_color_buffer_float,
+    EXT_disjoint_timer_query,
     EXT_framebuffer_object,
     EXT_texture_filter_anisotropic,
     EXT_texture_format_BGRA8888,
@@ -42,7 +44,9 @@ struct CGLExtensions
       {ARB_pixel_buffer_object, "GL_ARB_pixel_buffer_object"},
       {ARB_texture_float, "GL_ARB_texture_float"},
       {ARB_texture_swizzle, "GL_ARB_texture_swizzle"},
+      {ARB_timer_query, "GL_ARB_timer_query"},
       {EXT_color_buffer_float, "GL_EXT_color_buffer_float"},
+      {EXT_disjoint_timer_query, "GL_EXT_disjoint_timer_query"},
       {EXT_framebuffer_object, "GL_EXT_framebuffer_object"},
       {EXT_texture_filter_anisotropic, "GL_EXT_texture_filter_anisotropic"},
       {EXT_texture_format_BGRA8888, "GL_EXT_texture_format_BGRA8888"},
@@ -0,0 +1,151 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GLProgramCache.h"
+
+#include "Util.h"
+#include "filesystem/File.h"
+#include "utils/Digest.h"
+#include "utils/URIUtils.h"
+#include "utils/log.h"
+
+#include <cstring>
+#include <stdint.h>
+
+namespace
+{
+constexpr auto PROGRAM_CACHE_FOLDER = "special://temp/shadercache/";
+constexpr auto PROGRAM_CACHE_EXTENSION = ".bin";
+
+std::string GetCachePath(const std::string& cacheKey)
+{
+  return URIUtils::AddFileToFolder(PROGRAM_CACHE_FOLDER, cacheKey + PROGRAM_CACHE_EXTENSION);
+}
+
+bool SupportsProgramBinary()
+{
+#if defined(GL_PROGRAM_BINARY_RETRIEVABLE_HINT)
+  // Contexts without program binary support report no formats
+  GLint formatCount = 0;
+  glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+  return formatCount > 0;
+#else
+  return false;
+#endif
+}
+
+void UpdateString(KODI::UTILITY::CDigest& digest, GLenum name)
+{
+  const auto* value = reinterpret_cast<const char*>(glGetString(name));
+  if (value != nullptr)
+    digest.Update(value, std::strlen(value));
+}
+} // namespace
+
+std::string CGLProgramCache::MakeKey(const std::vector<std::string>& sources)
+{
+  KODI::UTILITY::CDigest digest{KODI::UTILITY::CDigest::Type::SHA256};
+
+  UpdateString(digest, GL_VENDOR);
+  UpdateString(digest, GL_RENDERER);
+  UpdateString(digest, GL_VERSION);
+
+  for (const std::string& source : sources)
+  {
+    // Include the length so that sources can't run into each other
+    const uint64_t size = source.size();
+    digest.Update(&size, sizeof(size));
+    digest.Update(source);
+  }
+
+  return digest.Finalize();
+}
+
+bool CGLProgramCache::LoadProgram(GLuint program, const std::string& cacheKey)
+{
+#if defined(GL_PROGRAM_BINARY_RETRIEVABLE_HINT)
+  if (!SupportsProgramBinary())
+    return false;
+
+  const std::string path = GetCachePath(cacheKey);
+  if (!XFILE::CFile::Exists(path))
+    return false;
+
+  uint32_t format = 0;
+  std::vector<uint8_t> data;
+  XFILE::CFile file;
+  if (file.LoadFile(path, data) <= static_cast<ssize_t>(sizeof(format)))
+    return false;
+
+  std::memcpy(&format, data.data(), sizeof(format));
+
+  glProgramBinary(program, static_cast<GLenum>(format), data.data() + sizeof(format),
+                  static_cast<GLsizei>(data.size() - sizeof(format)));
+
+  GLint status = GL_FALSE;
+  glGetProgramiv(program, GL_LINK_STATUS, &status);
+  if (status != GL_TRUE)
+  {
+    CLog::Log(LOGDEBUG, "CGLProgramCache: Cached program {} was rejected by the driver", cacheKey);
+    return false;
+  }
+
+  return true;
+#else
+  return false;
+#endif
+}
+
+void CGLProgramCache::PrepareProgram(GLuint program)
+{
+#if defined(GL_PROGRAM_BINARY_RETRIEVABLE_HINT)
+  if (SupportsProgramBinary())
+    glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+#endif
+}
+
+void CGLProgramCache::SaveProgram(GLuint program, const std::string& cacheKey)
+{
+#if defined(GL_PROGRAM_BINARY_RETRIEVABLE_HINT)
+  if (!SupportsProgramBinary())
+    return;
+
+  GLint length = 0;
+  glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+  if (length <= 0)
+    return;
+
+  std::vector<uint8_t> binary(length);
+  GLenum format = 0;
+  glGetProgramBinary(program, length, &length, &format, binary.data());
+  if (length <= 0)
+    return;
+
+  if (!CUtil::CreateDirectoryEx(PROGRAM_CACHE_FOLDER))
+    return;
+
+  const std::string path = GetCachePath(cacheKey);
+  const uint32_t storedFormat = static_cast<uint32_t>(format);
+
+  XFILE::CFile file;
+  if (!file.OpenForWrite(path, true))
+  {
+    CLog::Log(LOGDEBUG, "CGLProgramCache: Failed to open {} for writing", path);
+    return;
+  }
+
+  if (file.Write(&storedFormat, sizeof(storedFormat)) !=
+          static_cast<ssize_t>(sizeof(storedFormat)) ||
+      file.Write(binary.data(), length) != static_cast<ssize_t>(length))
+  {
+    CLog::Log(LOGDEBUG, "CGLProgramCache: Failed to write {}", path);
+    file.Close();
+    XFILE::CFile::Delete(path);
+  }
+#endif
+}
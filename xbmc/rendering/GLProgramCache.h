@@ -0,0 +1,57 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "system_gl.h"
+
+#include <string>
+#include <vector>
+
+/*!
+ * \brief On-disk cache of linked GL program binaries
+ *
+ * Compiling the many GUI and video shader variants from source adds
+ * noticeably to startup and to the start of playback on mobile GPUs. When the
+ * driver can retrieve program binaries (GL 4.1, GL_ARB_get_program_binary or
+ * GLES 3), linked programs are stored below special://temp/shadercache/ and
+ * loaded on the next run instead of being compiled again.
+ *
+ * Entries are keyed by the shader sources together with the GL vendor,
+ * renderer and version strings, so a driver update simply misses the cache.
+ * A binary the driver rejects is compiled from source and overwritten.
+ *
+ * All functions must be called with the GL context current.
+ */
+class CGLProgramCache
+{
+public:
+  /*!
+   * \brief Calculate the cache key for the given shader sources
+   */
+  static std::string MakeKey(const std::vector<std::string>& sources);
+
+  /*!
+   * \brief Link a program from a cached binary
+   *
+   * \return true if a binary was found and accepted by the driver
+   */
+  static bool LoadProgram(GLuint program, const std::string& cacheKey);
+
+  /*!
+   * \brief Request that the binary of a program can be retrieved
+   *
+   * Must be called before the program is linked from source.
+   */
+  static void PrepareProgram(GLuint program);
+
+  /*!
+   * \brief Store the binary of a linked program
+   */
+  static void SaveProgram(GLuint program, const std::string& cacheKey);
+};
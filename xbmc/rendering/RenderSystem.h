@@ -76,6 +76,18 @@ public:
 
   virtual std::string GetShaderPath(const std::string &filename) { return ""; }
 
+  /*!
+   \brief Enable or disable measuring the GPU time spent on each rendered frame
+   */
+  virtual void SetGPUFrameTiming(bool enable) {}
+
+  /*!
+   \brief Get the GPU time of a previously rendered frame
+   \param ms the measured time in milliseconds
+   \return false if timing is disabled, unsupported or no new result is available yet
+   */
+  virtual bool GetGPUFrameTime(float& ms) { return false; }
+
   void GetRenderVersion(unsigned int& major, unsigned int& minor) const;
   const std::string& GetRenderVendor() const { return m_RenderVendor; }
   const std::string& GetRenderRenderer() const { return m_RenderRenderer; }
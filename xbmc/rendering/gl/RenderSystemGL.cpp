@@ -251,6 +251,7 @@ bool CRenderSystemGL::DestroyRenderSystem()
     glDeleteVertexArrays(1, &m_vertexArray);
   }
 
+  SetGPUFrameTiming(false);
   ReleaseShaders();
   m_bRenderCreated = false;
 
@@ -271,6 +272,13 @@ bool CRenderSystemGL::BeginRender()
   }
 
   m_limitedColorRange = useLimited;
+
+  if (m_gpuQueries[0] != 0)
+  {
+    glBeginQuery(GL_TIME_ELAPSED, m_gpuQueries[m_gpuQueryIndex]);
+    m_gpuQueryActive = true;
+  }
+
   return true;
 }
 
@@ -279,6 +287,62 @@ bool CRenderSystemGL::EndRender()
   if (!m_bRenderCreated)
     return false;
 
+  if (m_gpuQueryActive)
+  {
+    glEndQuery(GL_TIME_ELAPSED);
+    m_gpuQueryPending[m_gpuQueryIndex] = true;
+    m_gpuQueryIndex ^= 1;
+    m_gpuQueryActive = false;
+  }
+
+  return true;
+}
+
+void CRenderSystemGL::SetGPUFrameTiming(bool enable)
+{
+  if (enable == (m_gpuQueries[0] != 0))
+    return;
+
+  if (enable)
+  {
+    if (!(m_RenderVersionMajor > 3 || (m_RenderVersionMajor == 3 && m_RenderVersionMinor >= 3)) &&
+        !CGLExtensions::IsExtensionSupported(CGLExtensions::ARB_timer_query))
+    {
+      CLog::Log(LOGINFO, "OpenGL: GPU frame timing requested but timer queries aren't available "
+                         "(GL_ARB_timer_query)");
+      return;
+    }
+    glGenQueries(m_gpuQueries.size(), m_gpuQueries.data());
+  }
+  else
+  {
+    glDeleteQueries(m_gpuQueries.size(), m_gpuQueries.data());
+    m_gpuQueries = {};
+  }
+
+  m_gpuQueryPending = {};
+  m_gpuQueryIndex = 0;
+  m_gpuQueryActive = false;
+}
+
+bool CRenderSystemGL::GetGPUFrameTime(float& ms)
+{
+  // after EndRender() the current index refers to the query of the previous frame,
+  // which is the one to be reused next
+  const GLuint query = m_gpuQueries[m_gpuQueryIndex];
+  if (query == 0 || !m_gpuQueryPending[m_gpuQueryIndex])
+    return false;
+
+  GLuint available = GL_FALSE;
+  glGetQueryObjectuiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+  if (available == GL_FALSE)
+    return false;
+
+  GLuint64 elapsed = 0;
+  glGetQueryObjectui64v(query, GL_QUERY_RESULT, &elapsed);
+  m_gpuQueryPending[m_gpuQueryIndex] = false;
+
+  ms = static_cast<float>(elapsed) / 1000000.0f;
   return true;
 }
 
@@ -13,6 +13,7 @@
 #include "utils/ColorUtils.h"
 #include "utils/Map.h"
 
+#include <array>
 #include <map>
 #include <memory>
 
@@ -105,6 +106,9 @@ public:
 
   std::string GetShaderPath(const std::string &filename) override;
 
+  void SetGPUFrameTiming(bool enable) override;
+  bool GetGPUFrameTime(float& ms) override;
+
   void GetGLVersion(int& major, int& minor);
   void GetGLSLVersion(int& major, int& minor);
 
@@ -145,4 +149,11 @@ protected:
   std::map<ShaderMethodGL, std::unique_ptr<CGLShader>> m_pShader;
   ShaderMethodGL m_method = ShaderMethodGL::SM_DEFAULT;
   GLuint m_vertexArray = GL_NONE;
+
+  // GL_TIME_ELAPSED queries used alternately, so the result of the previous
+  // frame can be read back without stalling the pipeline
+  std::array<GLuint, 2> m_gpuQueries{};
+  std::array<bool, 2> m_gpuQueryPending{};
+  unsigned int m_gpuQueryIndex = 0;
+  bool m_gpuQueryActive = false;
 };
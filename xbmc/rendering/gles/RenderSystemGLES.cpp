@@ -163,6 +163,7 @@ bool CRenderSystemGLES::DestroyRenderSystem()
   glFinish();
   PresentRenderImpl(true);
 
+  SetGPUFrameTiming(false);
   ReleaseShaders();
   m_bRenderCreated = false;
 
@@ -187,6 +188,14 @@ bool CRenderSystemGLES::BeginRender()
     InitialiseShaders();
   }
 
+#if defined(GL_EXT_disjoint_timer_query) && defined(TARGET_LINUX)
+  if (m_gpuQueries[0] != 0)
+  {
+    m_glBeginQuery(GL_TIME_ELAPSED_EXT, m_gpuQueries[m_gpuQueryIndex]);
+    m_gpuQueryActive = true;
+  }
+#endif
+
   return true;
 }
 
@@ -195,7 +204,102 @@ bool CRenderSystemGLES::EndRender()
   if (!m_bRenderCreated)
     return false;
 
+#if defined(GL_EXT_disjoint_timer_query) && defined(TARGET_LINUX)
+  if (m_gpuQueryActive)
+  {
+    m_glEndQuery(GL_TIME_ELAPSED_EXT);
+    m_gpuQueryPending[m_gpuQueryIndex] = true;
+    m_gpuQueryIndex ^= 1;
+    m_gpuQueryActive = false;
+  }
+#endif
+
+  return true;
+}
+
+void CRenderSystemGLES::SetGPUFrameTiming(bool enable)
+{
+#if defined(GL_EXT_disjoint_timer_query) && defined(TARGET_LINUX)
+  if (enable == (m_gpuQueries[0] != 0))
+    return;
+
+  if (enable)
+  {
+    if (!CGLExtensions::IsExtensionSupported(CGLExtensions::EXT_disjoint_timer_query))
+    {
+      CLog::Log(LOGINFO, "OpenGL(ES): GPU frame timing requested but timer queries aren't "
+                         "available (GL_EXT_disjoint_timer_query)");
+      return;
+    }
+
+    if (!m_glGenQueries)
+    {
+      try
+      {
+        m_glGenQueries =
+            CEGLUtils::GetRequiredProcAddress<PFNGLGENQUERIESEXTPROC>("glGenQueriesEXT");
+        m_glDeleteQueries =
+            CEGLUtils::GetRequiredProcAddress<PFNGLDELETEQUERIESEXTPROC>("glDeleteQueriesEXT");
+        m_glBeginQuery =
+            CEGLUtils::GetRequiredProcAddress<PFNGLBEGINQUERYEXTPROC>("glBeginQueryEXT");
+        m_glEndQuery = CEGLUtils::GetRequiredProcAddress<PFNGLENDQUERYEXTPROC>("glEndQueryEXT");
+        m_glGetQueryObjectuiv = CEGLUtils::GetRequiredProcAddress<PFNGLGETQUERYOBJECTUIVEXTPROC>(
+            "glGetQueryObjectuivEXT");
+        m_glGetQueryObjectui64v =
+            CEGLUtils::GetRequiredProcAddress<PFNGLGETQUERYOBJECTUI64VEXTPROC>(
+                "glGetQueryObjectui64vEXT");
+      }
+      catch (const std::runtime_error& e)
+      {
+        CLog::Log(LOGERROR, "OpenGL(ES): {}", e.what());
+        m_glGenQueries = nullptr;
+        return;
+      }
+    }
+    m_glGenQueries(m_gpuQueries.size(), m_gpuQueries.data());
+  }
+  else
+  {
+    m_glDeleteQueries(m_gpuQueries.size(), m_gpuQueries.data());
+    m_gpuQueries = {};
+  }
+
+  m_gpuQueryPending = {};
+  m_gpuQueryIndex = 0;
+  m_gpuQueryActive = false;
+#endif
+}
+
+bool CRenderSystemGLES::GetGPUFrameTime(float& ms)
+{
+#if defined(GL_EXT_disjoint_timer_query) && defined(TARGET_LINUX)
+  // after EndRender() the current index refers to the query of the previous frame,
+  // which is the one to be reused next
+  const GLuint query = m_gpuQueries[m_gpuQueryIndex];
+  if (query == 0 || !m_gpuQueryPending[m_gpuQueryIndex])
+    return false;
+
+  GLuint available = GL_FALSE;
+  m_glGetQueryObjectuiv(query, GL_QUERY_RESULT_AVAILABLE_EXT, &available);
+  if (available == GL_FALSE)
+    return false;
+
+  m_gpuQueryPending[m_gpuQueryIndex] = false;
+
+  // a disjoint operation (e.g. a frequency change) makes the result meaningless
+  GLint disjoint = GL_FALSE;
+  glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint);
+  if (disjoint != GL_FALSE)
+    return false;
+
+  GLuint64 elapsed = 0;
+  m_glGetQueryObjectui64v(query, GL_QUERY_RESULT_EXT, &elapsed);
+
+  ms = static_cast<float>(elapsed) / 1000000.0f;
   return true;
+#else
+  return false;
+#endif
 }
 
 void CRenderSystemGLES::InvalidateColorBuffer()
@@ -13,6 +13,7 @@
 #include "utils/ColorUtils.h"
 #include "utils/Map.h"
 
+#include <array>
 #include <map>
 
 #include <fmt/format.h>
@@ -123,6 +124,9 @@ public:
 
   std::string GetShaderPath(const std::string& filename) override;
 
+  void SetGPUFrameTiming(bool enable) override;
+  bool GetGPUFrameTime(float& ms) override;
+
   void InitialiseShaders();
   void ReleaseShaders();
   void EnableGUIShader(ShaderMethodGLES method);
@@ -159,4 +163,20 @@ protected:
   ShaderMethodGLES m_method = ShaderMethodGLES::SM_DEFAULT;
 
   GLint      m_viewPort[4];
+
+#if defined(GL_EXT_disjoint_timer_query) && defined(TARGET_LINUX)
+  // GL_TIME_ELAPSED_EXT queries used alternately, so the result of the previous
+  // frame can be read back without stalling the pipeline
+  std::array<GLuint, 2> m_gpuQueries{};
+  std::array<bool, 2> m_gpuQueryPending{};
+  unsigned int m_gpuQueryIndex{0};
+  bool m_gpuQueryActive{false};
+
+  PFNGLGENQUERIESEXTPROC m_glGenQueries{nullptr};
+  PFNGLDELETEQUERIESEXTPROC m_glDeleteQueries{nullptr};
+  PFNGLBEGINQUERYEXTPROC m_glBeginQuery{nullptr};
+  PFNGLENDQUERYEXTPROC m_glEndQuery{nullptr};
+  PFNGLGETQUERYOBJECTUIVEXTPROC m_glGetQueryObjectuiv{nullptr};
+  PFNGLGETQUERYOBJECTUI64VEXTPROC m_glGetQueryObjectui64v{nullptr};
+#endif
 };
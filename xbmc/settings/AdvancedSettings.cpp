@@ -20,8 +20,10 @@
 #include "settings/SettingsComponent.h"
 #include "settings/lib/Setting.h"
 #include "settings/lib/SettingsManager.h"
+#include "threads/ThreadPolicy.h"
 #include "utils/FileUtils.h"
 #include "utils/LangCodeExpander.h"
+#include "utils/MemoryBudget.h"
 #include "utils/Set.h"
 #include "utils/StringUtils.h"
 #include "utils/SystemInfo.h"
@@ -32,6 +34,7 @@
 
 #include <algorithm>
 #include <climits>
+#include <map>
 #include <regex>
 #include <string>
 #include <vector>
@@ -195,6 +198,9 @@ void CAdvancedSettings::Initialize()
   m_videoFpsDetect = 1;
   m_maxTempo = 1.55f;
   m_videoPreferStereoStream = false;
+  m_videoLiveLowLatency = false;
+  m_videoLiveTargetLatency = 1500;
+  m_videoLiveCatchUpSpeed = 1.05f;
 
   m_videoDefaultLatency = 0.0;
   m_videoDefaultHdrExtraLatency = 0.0;
@@ -334,6 +340,8 @@ void CAdvancedSettings::Initialize()
   m_imageRes = 720;
   m_imageScalingAlgorithm = CPictureScalingAlgorithm::Default;
   m_imageQualityJpeg = 4;
+  m_imageCacheCompressed = false;
+  m_imageCacheTiers = false;
 
   m_sambaclienttimeout = 30;
   m_sambadoscodepage = "";
@@ -362,8 +370,11 @@ void CAdvancedSettings::Initialize()
 
   m_bVideoLibraryAllItemsOnBottom = false;
   m_iVideoLibraryRecentlyAddedItems = 25;
+  m_iVideoLibraryListingCacheItems = 50000;
   m_bVideoLibraryCleanOnUpdate = false;
   m_bVideoLibraryUseFastHash = true;
+  m_iVideoLibraryScanPrefetchPerHost = 2;
+  m_iVideoLibraryScrapeConcurrency = 4;
   m_bVideoScannerIgnoreErrors = false;
   m_iVideoLibraryDateAdded = 1; // prefer mtime over ctime and current time
   m_minimumEpisodePlaylistDuration = 5 * 60; // 5 minutes
@@ -414,6 +425,17 @@ void CAdvancedSettings::Initialize()
   m_curlDisableIPV6 = false;      //Certain hardware/OS combinations have trouble
                                   //with ipv6.
   m_curlDisableHTTP2 = false;
+  m_curlParallelConnections = 0;
+  m_webserverThreadPoolSize = 0;
+  m_webserverConnectionLimit = 512;
+  m_webserverConnectionTimeout = 60 * 60 * 24;
+
+  m_scraperRequestsPerSecond = 10;
+  m_scraperRequestBurst = 10;
+
+  m_cacheSparseSize = 0;
+  m_cachePersistentDirectories = false;
+  m_cacheHttpSize = 64;
 
 #if defined(TARGET_WINDOWS_DESKTOP)
   m_minimizeToTray = false;
@@ -448,6 +470,7 @@ void CAdvancedSettings::Initialize()
   m_bPVRAutoScanIconsUserSet       = false;
   m_iPVRNumericChannelSwitchTimeout = 2000;
   m_iPVRTimeshiftThreshold = 10;
+  m_iPVRTimeshiftBufferSize = 0;
   m_bPVRTimeshiftSimpleOSD = true;
   m_PVRDefaultSortOrder.sortBy = SortByDate;
   m_PVRDefaultSortOrder.sortOrder = SortOrderDescending;
@@ -461,7 +484,7 @@ void CAdvancedSettings::Initialize()
 
   m_canWindowed = true;
   m_guiVisualizeDirtyRegions = false;
-  m_guiAlgorithmDirtyRegions = 3;
+  m_guiAlgorithmDirtyRegions = -1; // depends on the window system
   m_guiSmartRedraw = false;
   m_airTunesPort = 36666;
   m_airPlayPort = 36667;
@@ -631,6 +654,7 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
                       20, 80);
     XMLUtils::GetBoolean(pElement, "allowmultichannelfloat", m_AllowMultiChannelFloat);
     XMLUtils::GetBoolean(pElement, "superviseaudiodelay", m_superviseAudioDelay);
+    XMLUtils::GetUInt(pElement, "ripbuffersize", m_cddaRipBufferSize, 0, 1024);
   }
 
   pElement = pRootElement->FirstChildElement("x11");
@@ -693,6 +717,9 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetBoolean(pElement,"vdpauInvTelecine",m_videoVDPAUtelecine);
     XMLUtils::GetBoolean(pElement,"vdpauHDdeintSkipChroma",m_videoVDPAUdeintSkipChromaHD);
     XMLUtils::GetBoolean(pElement, "bypasscodecprofile", m_videoBypassCodecProfile);
+    XMLUtils::GetBoolean(pElement, "livelowlatency", m_videoLiveLowLatency);
+    XMLUtils::GetInt(pElement, "livetargetlatency", m_videoLiveTargetLatency, 500, 10000);
+    XMLUtils::GetFloat(pElement, "livecatchupspeed", m_videoLiveCatchUpSpeed, 1.01f, 1.25f);
 
     TiXmlElement* pAdjustRefreshrate = pElement->FirstChildElement("adjustrefreshrate");
     if (pAdjustRefreshrate)
@@ -842,6 +869,9 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetBoolean(pElement, "prioritiseapetags", m_prioritiseAPEv2tags);
     XMLUtils::GetBoolean(pElement, "allitemsonbottom", m_bMusicLibraryAllItemsOnBottom);
     XMLUtils::GetBoolean(pElement, "cleanonupdate", m_bMusicLibraryCleanOnUpdate);
+    XMLUtils::GetBoolean(pElement, "usefasthash", m_bMusicLibraryUseFastHash);
+    XMLUtils::GetInt(pElement, "tagreaders", m_iMusicLibraryTagReaders, 1, 16);
+    XMLUtils::GetBoolean(pElement, "analyzereplaygain", m_bMusicLibraryAnalyzeReplayGain);
     XMLUtils::GetBoolean(pElement, "artistsortonupdate", m_bMusicLibraryArtistSortOnUpdate);
     XMLUtils::GetString(pElement, "albumformat", m_strMusicLibraryAlbumFormat);
     XMLUtils::GetString(pElement, "itemseparator", m_musicItemSeparator);
@@ -868,8 +898,12 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
   {
     XMLUtils::GetBoolean(pElement, "allitemsonbottom", m_bVideoLibraryAllItemsOnBottom);
     XMLUtils::GetInt(pElement, "recentlyaddeditems", m_iVideoLibraryRecentlyAddedItems, 1, INT_MAX);
+    XMLUtils::GetInt(pElement, "listingcacheitems", m_iVideoLibraryListingCacheItems, 0, INT_MAX);
     XMLUtils::GetBoolean(pElement, "cleanonupdate", m_bVideoLibraryCleanOnUpdate);
     XMLUtils::GetBoolean(pElement, "usefasthash", m_bVideoLibraryUseFastHash);
+    XMLUtils::GetInt(pElement, "scanprefetchperhost", m_iVideoLibraryScanPrefetchPerHost, 0,
+                     INT_MAX);
+    XMLUtils::GetInt(pElement, "scrapeconcurrency", m_iVideoLibraryScrapeConcurrency, 1, 32);
     XMLUtils::GetString(pElement, "itemseparator", m_videoItemSeparator);
     XMLUtils::GetBoolean(pElement, "importwatchedstate", m_bVideoLibraryImportWatchedState);
     XMLUtils::GetBoolean(pElement, "importresumepoint", m_bVideoLibraryImportResumePoint);
@@ -909,9 +943,30 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetInt(pElement, "curlkeepaliveinterval", m_curlKeepAliveInterval, 0, 300);
     XMLUtils::GetBoolean(pElement, "disableipv6", m_curlDisableIPV6);
     XMLUtils::GetBoolean(pElement, "disablehttp2", m_curlDisableHTTP2);
+    XMLUtils::GetUInt(pElement, "curlparallelconnections", m_curlParallelConnections, 0, 16);
+    XMLUtils::GetUInt(pElement, "webserverthreads", m_webserverThreadPoolSize, 0, 64);
+    XMLUtils::GetUInt(pElement, "webserverconnectionlimit", m_webserverConnectionLimit, 1, 4096);
+    // libmicrohttpd busy loops with a timeout of 1 second or less
+    XMLUtils::GetUInt(pElement, "webserverconnectiontimeout", m_webserverConnectionTimeout, 2,
+                      60 * 60 * 24);
     XMLUtils::GetString(pElement, "catrustfile", m_caTrustFile);
   }
 
+  pElement = pRootElement->FirstChildElement("scrapers");
+  if (pElement)
+  {
+    XMLUtils::GetFloat(pElement, "requestspersecond", m_scraperRequestsPerSecond, 0, 1000);
+    XMLUtils::GetUInt(pElement, "requestburst", m_scraperRequestBurst, 1, 1000);
+  }
+
+  pElement = pRootElement->FirstChildElement("cache");
+  if (pElement)
+  {
+    XMLUtils::GetUInt(pElement, "sparsesize", m_cacheSparseSize, 0, 65536);
+    XMLUtils::GetBoolean(pElement, "persistentdirectories", m_cachePersistentDirectories);
+    XMLUtils::GetUInt(pElement, "httpsize", m_cacheHttpSize, 0, 4096);
+  }
+
   pElement = pRootElement->FirstChildElement("jsonrpc");
   if (pElement)
   {
@@ -953,6 +1008,51 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     CServiceBroker::GetLogging().SetLogLevel(m_logLevel);
   }
 
+  pElement = pRootElement->FirstChildElement("logging");
+  if (pElement)
+  {
+    int asyncQueueSize = 0;
+    std::string asyncOverflow;
+    XMLUtils::GetInt(pElement, "asyncqueuesize", asyncQueueSize, 0, 1000000);
+    XMLUtils::GetString(pElement, "asyncoverflow", asyncOverflow);
+    CServiceBroker::GetLogging().SetAsyncLogging(asyncQueueSize, asyncOverflow == "dropoldest");
+
+    // <component name="video">debug</component>
+    static const std::map<std::string, int, std::less<>> logLevels = {
+        {"debug", LOGDEBUG}, {"info", LOGINFO},   {"warning", LOGWARNING},
+        {"error", LOGERROR}, {"fatal", LOGFATAL}, {"none", LOGNONE}};
+    for (const TiXmlElement* component = pElement->FirstChildElement("component"); component;
+         component = component->NextSiblingElement("component"))
+    {
+      const char* name = component->Attribute("name");
+      const auto level = logLevels.find(component->FirstChild() ? component->FirstChild()->ValueStr()
+                                                                : std::string());
+      if (!name || level == logLevels.end() ||
+          !CServiceBroker::GetLogging().SetComponentLogLevel(name, level->second))
+        CLog::Log(LOGWARNING, "Ignoring invalid <logging> component override in {}", file);
+    }
+  }
+
+  int cacheMemoryBudget = 0;
+  if (XMLUtils::GetInt(pRootElement, "cachememorybudget", cacheMemoryBudget, 0, 16384))
+    CMemoryBudget::SetBudget(static_cast<size_t>(cacheMemoryBudget) * 1024 * 1024);
+
+  // <threads><audio priority="abovenormal" cores="performance"/></threads>
+  pElement = pRootElement->FirstChildElement("threads");
+  if (pElement)
+  {
+    for (const TiXmlElement* threadClass = pElement->FirstChildElement(); threadClass;
+         threadClass = threadClass->NextSiblingElement())
+    {
+      const char* priority = threadClass->Attribute("priority");
+      const char* cores = threadClass->Attribute("cores");
+      if (!CThreadPolicy::Set(threadClass->ValueStr(), priority ? priority : "",
+                              cores ? cores : ""))
+        CLog::Log(LOGWARNING, "Ignoring invalid <threads> entry <{}> in {}",
+                  threadClass->ValueStr(), file);
+    }
+  }
+
   XMLUtils::GetString(pRootElement, "cddbaddress", m_cddbAddress);
   XMLUtils::GetBoolean(pRootElement, "addsourceontop", m_addSourceOnTop);
 
@@ -1129,6 +1229,8 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
   if (XMLUtils::GetString(pRootElement, "imagescalingalgorithm", tmp))
     m_imageScalingAlgorithm = CPictureScalingAlgorithm::FromString(tmp);
   XMLUtils::GetUInt(pRootElement, "imagequalityjpeg", m_imageQualityJpeg, 0, 21);
+  XMLUtils::GetBoolean(pRootElement, "imagecachecompressed", m_imageCacheCompressed);
+  XMLUtils::GetBoolean(pRootElement, "imagecachetiers", m_imageCacheTiers);
   XMLUtils::GetBoolean(pRootElement, "playlistasfolders", m_playlistAsFolders);
   XMLUtils::GetBoolean(pRootElement, "uselocalecollation", m_useLocaleCollation);
   XMLUtils::GetBoolean(pRootElement, "detectasudf", m_detectAsUdf);
@@ -1186,6 +1288,7 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
                       60000);
     XMLUtils::GetInt(pPVR, "timeshiftthreshold", m_iPVRTimeshiftThreshold, 0, 60);
     XMLUtils::GetBoolean(pPVR, "timeshiftsimpleosd", m_bPVRTimeshiftSimpleOSD);
+    XMLUtils::GetInt(pPVR, "timeshiftbuffersize", m_iPVRTimeshiftBufferSize, 0, 16384);
     const TiXmlElement* pSortDecription = pPVR->FirstChildElement("pvrrecordings");
     if (pSortDecription)
     {
@@ -1294,6 +1397,9 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetBoolean(pElement, "visualizedirtyregions", m_guiVisualizeDirtyRegions);
     XMLUtils::GetInt(pElement, "algorithmdirtyregions",     m_guiAlgorithmDirtyRegions);
     XMLUtils::GetBoolean(pElement, "smartredraw", m_guiSmartRedraw);
+    XMLUtils::GetInt(pElement, "idlerenderfps", m_guiIdleRenderFps, 0, 60);
+    XMLUtils::GetInt(pElement, "idlerenderdelay", m_guiIdleRenderDelay, 1, 3600);
+    XMLUtils::GetBoolean(pElement, "skincache", m_guiSkinCache);
     XMLUtils::GetInt(pElement, "anisotropicfiltering", m_guiAnisotropicFiltering);
     XMLUtils::GetBoolean(pElement, "fronttobackrendering", m_guiFrontToBackRendering);
     XMLUtils::GetBoolean(pElement, "geometryclear", m_guiGeometryClear);
@@ -163,6 +163,7 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     unsigned int m_maxPassthroughOffSyncDuration = 50; // when 50 ms off adjust
     bool m_AllowMultiChannelFloat = false; // Android only switch to be removed in v22
     bool m_superviseAudioDelay = false; // Android only to correct broken audio firmwares
+    unsigned int m_cddaRipBufferSize = 128; ///< \brief MB of tracks read ahead by all rip jobs
 
     int   m_videoVDPAUScaling;
     float m_videoNonLinStretchRatio;
@@ -177,6 +178,9 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     int  m_videoFpsDetect;
     float m_maxTempo;
     bool m_videoPreferStereoStream = false;
+    bool m_videoLiveLowLatency = false;
+    int m_videoLiveTargetLatency = 1500; // ms behind the live edge in low latency mode
+    float m_videoLiveCatchUpSpeed = 1.05f;
 
     std::string m_videoDefaultPlayer;
     float m_videoPlayCountMinimumPercent;
@@ -239,6 +243,8 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     CPictureScalingAlgorithm::Algorithm m_imageScalingAlgorithm;
     unsigned int
         m_imageQualityJpeg; ///< \brief the stored jpeg quality the lower the better (default: 4)
+    bool m_imageCacheCompressed; ///< \brief also cache opaque images as DXT1 (default: false)
+    bool m_imageCacheTiers; ///< \brief also cache images at smaller sizes (default: false)
 
     int m_sambaclienttimeout;
     std::string m_sambadoscodepage;
@@ -255,6 +261,9 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     int m_iMusicLibraryDateAdded;
     bool m_bMusicLibraryAllItemsOnBottom;
     bool m_bMusicLibraryCleanOnUpdate;
+    bool m_bMusicLibraryUseFastHash{false};
+    int m_iMusicLibraryTagReaders{4};
+    bool m_bMusicLibraryAnalyzeReplayGain{false};
     bool m_bMusicLibraryArtistSortOnUpdate;
     bool m_bMusicLibraryUseISODates;
     bool m_bMusicLibraryArtistNavigatesToSongs;
@@ -267,8 +276,11 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
 
     bool m_bVideoLibraryAllItemsOnBottom;
     int m_iVideoLibraryRecentlyAddedItems;
+    int m_iVideoLibraryListingCacheItems;
     bool m_bVideoLibraryCleanOnUpdate;
     bool m_bVideoLibraryUseFastHash;
+    int m_iVideoLibraryScanPrefetchPerHost;
+    int m_iVideoLibraryScrapeConcurrency; ///< \brief episodes scraped at once by python scrapers
     bool m_bVideoLibraryImportWatchedState{true};
     bool m_bVideoLibraryImportResumePoint{true};
 
@@ -307,9 +319,20 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     int m_curlKeepAliveInterval;    // seconds
     bool m_curlDisableIPV6;
     bool m_curlDisableHTTP2;
+    unsigned int m_curlParallelConnections; ///< \brief parallel range requests for cached http, < 2 disables
+    unsigned int m_webserverThreadPoolSize; ///< \brief webserver worker threads, < 2 spawns a thread per connection
+    unsigned int m_webserverConnectionLimit; ///< \brief maximum concurrent webserver connections
+    unsigned int m_webserverConnectionTimeout; ///< \brief seconds an idle keep-alive connection stays open
 
     std::string m_caTrustFile;
 
+    float m_scraperRequestsPerSecond; ///< \brief scraper requests per host and second, 0 disables
+    unsigned int m_scraperRequestBurst; ///< \brief scraper requests per host allowed in a burst
+
+    unsigned int m_cacheSparseSize; ///< \brief size in MB of the sparse disk cache, 0 disables it
+    bool m_cachePersistentDirectories; ///< \brief keep archive listings on disk across restarts
+    unsigned int m_cacheHttpSize; ///< \brief size in MB of the http response cache, 0 disables it
+
     bool m_minimizeToTray; /* win32 only */
     bool m_fullScreen{false};
     bool m_startFullScreen;
@@ -336,6 +359,7 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
         m_iPVRNumericChannelSwitchTimeout; /*!< @brief time in msecs after that a channel switch occurs after entering a channel number, if confirmchannelswitch is disabled */
     int m_iPVRTimeshiftThreshold; /*!< @brief time diff between current playing time and timeshift buffer end, in seconds, before a playing stream is displayed as timeshifting. */
     bool m_bPVRTimeshiftSimpleOSD; /*!< @brief use simple timeshift OSD (with progress only for the playing event instead of progress for the whole ts buffer). */
+    int m_iPVRTimeshiftBufferSize; /*!< @brief size in MB of the local timeshift buffer for live streams of clients that can't pause them. defaults to 0 (disabled). */
     SortDescription m_PVRDefaultSortOrder; /*!< @brief SortDecription used to store default recording sort type and sort order */
 
     DatabaseSettings m_databaseMusic; // advanced music database setup
@@ -348,6 +372,9 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     bool m_guiVisualizeDirtyRegions;
     int  m_guiAlgorithmDirtyRegions;
     bool m_guiSmartRedraw;
+    int m_guiIdleRenderFps{0}; // 0 renders the idle gui at full rate
+    int m_guiIdleRenderDelay{10}; // seconds without input or window changes before it's idle
+    bool m_guiSkinCache{true}; // cache the loaded skin includes
     int32_t m_guiAnisotropicFiltering{0};
     bool m_guiFrontToBackRendering{false};
     bool m_guiGeometryClear{true};
@@ -12,6 +12,7 @@
 #include "URL.h"
 #include "Util.h"
 #include "media/MediaLockState.h"
+#include "network/DNSNameCache.h"
 #include "network/WakeOnAccess.h"
 #include "profiles/ProfileManager.h"
 #include "settings/SettingsComponent.h"
@@ -22,6 +23,7 @@
 #include "utils/XMLUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 
@@ -105,6 +107,27 @@ bool CMediaSourceSettings::Load(const std::string& file)
   GetSources(rootElement, "music", m_musicSources, m_defaultMusicSource);
   GetSources(rootElement, "games", m_gameSources, dummy);
 
+  // resolve the hosts of network shares in the background, so browsing them doesn't have to wait
+  if (const auto dnsNameCache = CServiceBroker::GetDNSNameCache())
+  {
+    std::vector<std::string> hostNames;
+    for (const auto* sources : {&m_videoSources, &m_programSources, &m_pictureSources,
+                                &m_fileSources, &m_musicSources, &m_gameSources})
+    {
+      for (const CMediaSource& source : *sources)
+      {
+        for (const std::string& path : source.vecPaths)
+        {
+          const CURL url(path);
+          if ((url.IsProtocol("smb") || url.IsProtocol("nfs")) && !url.GetHostName().empty() &&
+              std::ranges::find(hostNames, url.GetHostName()) == hostNames.end())
+            hostNames.emplace_back(url.GetHostName());
+        }
+      }
+    }
+    dnsNameCache->Prefetch(hostNames);
+  }
+
   return true;
 }
 
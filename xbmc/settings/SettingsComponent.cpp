@@ -54,6 +54,9 @@ void CreateUserDirs()
     CLog::Log(LOGWARNING, "Failed to remove the archive cache at {}", archiveCachePath);
 
   XFILE::CDirectory::Create(archiveCachePath);
+  XFILE::CDirectory::Create("special://temp/dircache"); // persistent directory cache
+  XFILE::CDirectory::Create("special://temp/httpcache"); // http response cache
+  XFILE::CDirectory::Create("special://temp/bluraycache"); // blu-ray playlist analysis
 }
 
 bool InitDirectoriesLinux(bool bPlatformDirectories)
@@ -20,6 +20,7 @@
 #include <map>
 #include <mutex>
 #include <shared_mutex>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 
@@ -28,31 +29,67 @@ const uint32_t CSettingsManager::MinimumSupportedVersion = 0;
 
 bool ParseSettingIdentifier(const std::string& settingId, std::string& categoryTag, std::string& settingTag)
 {
-  static const std::string Separator = ".";
-
   if (settingId.empty())
     return false;
 
-  std::vector<std::string> parts = StringUtils::Split(settingId, Separator);
-  if (parts.empty() || parts.at(0).empty())
+  const size_t separator = settingId.find('.');
+  if (separator == 0)
     return false;
 
-  if (parts.size() == 1)
+  if (separator == std::string::npos)
   {
-    settingTag = parts.at(0);
+    settingTag = settingId;
     return true;
   }
 
-  // get the category tag and remove it from the parts
-  categoryTag = parts.at(0);
-  parts.erase(parts.begin());
-
-  // put together the setting tag
-  settingTag = StringUtils::Join(parts, Separator);
+  // everything up to the first separator is the category tag
+  categoryTag = settingId.substr(0, separator);
+  settingTag = settingId.substr(separator + 1);
 
   return true;
 }
 
+/*!
+ \brief Lookup tables for the nodes of a settings values document.
+
+ Loading the values looks up every known setting in the document, which without
+ an index means scanning all children of the root element for every setting.
+ */
+struct CSettingsManager::NodeIndex
+{
+  explicit NodeIndex(const TiXmlNode* node)
+  {
+    for (const TiXmlElement* child = node->FirstChildElement(); child;
+         child = child->NextSiblingElement())
+    {
+      // keep the first match to behave like FirstChild()/FirstChildElement()
+      children.try_emplace(child->ValueStr(), child);
+
+      if (child->ValueStr() == SETTING_XML_ELM_SETTING)
+      {
+        const char* id = child->Attribute(SETTING_XML_ATTR_ID);
+        if (id)
+          settings.try_emplace(id, child);
+      }
+    }
+  }
+
+  const TiXmlElement* FindChild(std::string_view name) const
+  {
+    const auto it = children.find(name);
+    return it != children.end() ? it->second : nullptr;
+  }
+
+  const TiXmlElement* FindSetting(std::string_view id) const
+  {
+    const auto it = settings.find(id);
+    return it != settings.end() ? it->second : nullptr;
+  }
+
+  std::unordered_map<std::string_view, const TiXmlElement*> children;
+  std::unordered_map<std::string_view, const TiXmlElement*> settings;
+};
+
 CSettingsManager::CSettingsManager()
   : m_logger(CServiceBroker::GetLogging().GetLogger("CSettingsManager"))
 {
@@ -800,10 +837,11 @@ bool CSettingsManager::Deserialize(const TiXmlNode* node,
 
   // TODO: ideally this would be done by going through all <setting> elements
   // in node but as long as we have to support the v1- format that's not possible
+  const NodeIndex index(node);
   for (const auto& [settingname, setting] : m_settings)
   {
     bool settingUpdated = false;
-    if (LoadSetting(node, setting.setting, settingUpdated))
+    if (LoadSetting(node, setting.setting, settingUpdated, &index))
     {
       updated |= settingUpdated;
       if (loadedSettings)
@@ -1062,7 +1100,10 @@ void CSettingsManager::OnSettingsCleared()
     settingsHandler->OnSettingsCleared();
 }
 
-bool CSettingsManager::LoadSetting(const TiXmlNode* node, const SettingPtr& setting, bool& updated)
+bool CSettingsManager::LoadSetting(const TiXmlNode* node,
+                                   const SettingPtr& setting,
+                                   bool& updated,
+                                   const NodeIndex* index /* = nullptr */)
 {
   updated = false;
 
@@ -1084,7 +1125,7 @@ bool CSettingsManager::LoadSetting(const TiXmlNode* node, const SettingPtr& sett
   {
     const TiXmlNode* categoryNode = node;
     if (!categoryTag.empty())
-      categoryNode = node->FirstChild(categoryTag);
+      categoryNode = index ? index->FindChild(categoryTag) : node->FirstChild(categoryTag);
 
     if (categoryNode)
       settingElement = categoryNode->FirstChildElement(settingTag);
@@ -1093,14 +1134,19 @@ bool CSettingsManager::LoadSetting(const TiXmlNode* node, const SettingPtr& sett
   if (!settingElement)
   {
     // check if the setting is stored using its full setting identifier (v2+)
-    settingElement = node->FirstChildElement(SETTING_XML_ELM_SETTING);
-    while (settingElement)
+    if (index)
+      settingElement = index->FindSetting(settingId);
+    else
     {
-      const char* id = settingElement->Attribute(SETTING_XML_ATTR_ID);
-      if (id && settingId.compare(id) == 0)
-        break;
+      settingElement = node->FirstChildElement(SETTING_XML_ELM_SETTING);
+      while (settingElement)
+      {
+        const char* id = settingElement->Attribute(SETTING_XML_ATTR_ID);
+        if (id && settingId.compare(id) == 0)
+          break;
 
-      settingElement = settingElement->NextSiblingElement(SETTING_XML_ELM_SETTING);
+        settingElement = settingElement->NextSiblingElement(SETTING_XML_ELM_SETTING);
+      }
     }
   }
 
@@ -508,7 +508,11 @@ private:
   bool Serialize(TiXmlNode *parent) const;
   bool Deserialize(const TiXmlNode* node, bool& updated, LoadedSettings* loadedSettings = nullptr);
 
-  bool LoadSetting(const TiXmlNode* node, const std::shared_ptr<CSetting>& setting, bool& updated);
+  struct NodeIndex;
+  bool LoadSetting(const TiXmlNode* node,
+                   const std::shared_ptr<CSetting>& setting,
+                   bool& updated,
+                   const NodeIndex* index = nullptr);
   bool UpdateSetting(const TiXmlNode* node,
                      const std::shared_ptr<CSetting>& setting,
                      const CSettingUpdate& update);
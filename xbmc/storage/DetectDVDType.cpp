@@ -27,8 +27,16 @@
 using namespace MEDIA_DETECT;
 using namespace std::chrono_literals;
 
+namespace
+{
+// how often the drive state is checked after the storage provider reported a change, the drive
+// needs a while to spin up and read a disc
+constexpr int SETTLE_POLLS = 15;
+} // namespace
+
 CCriticalSection CDetectDVDMedia::m_muReadingMedia;
 CEvent CDetectDVDMedia::m_evAutorun;
+CEvent CDetectDVDMedia::m_evDriveChanged;
 DriveState CDetectDVDMedia::m_DriveState{DriveState::CLOSED_NO_MEDIA};
 CCdInfo* CDetectDVDMedia::m_pCdInfo = NULL;
 time_t CDetectDVDMedia::m_LastPoll = 0;
@@ -67,6 +75,10 @@ void CDetectDVDMedia::Process()
   const auto& components = CServiceBroker::GetAppComponents();
   const auto appPlayer = components.GetComponent<CApplicationPlayer>();
 
+  // only poll for a while after a change if the storage provider tells us about them
+  const bool notified = CServiceBroker::GetMediaManager().NotifiesOpticalDriveChanges();
+  int pollsLeft = SETTLE_POLLS;
+
   while (!m_bStop)
   {
     if (appPlayer->IsPlayingVideo())
@@ -77,6 +89,15 @@ void CDetectDVDMedia::Process()
     {
       UpdateDvdrom();
       m_bStartup = false;
+      if (notified && pollsLeft == 0 && !m_bAutorun)
+      {
+        AbortableWait(m_evDriveChanged);
+        pollsLeft = SETTLE_POLLS;
+        continue;
+      }
+      if (pollsLeft > 0)
+        pollsLeft--;
+
       CThread::Sleep(2000ms);
       if (m_bAutorun)
       {
@@ -383,6 +404,11 @@ void CDetectDVDMedia::UpdateState()
   m_pInstance->DetectMediaType();
 }
 
+void CDetectDVDMedia::OnDriveChanged()
+{
+  m_evDriveChanged.Set();
+}
+
 // Static function
 // Wait for drive, to finish media detection.
 void CDetectDVDMedia::WaitMediaReady()
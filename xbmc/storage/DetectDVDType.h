@@ -50,6 +50,13 @@ public:
   static const std::string &GetDVDPath();
 
   static void UpdateState();
+
+  /*!
+   \brief Check the drive state right away, called by the storage provider when the tray or the
+   media of the drive changed.
+   */
+  static void OnDriveChanged();
+
 protected:
   void UpdateDvdrom();
   DriveState PollDriveState();
@@ -62,6 +69,7 @@ protected:
 
 private:
   static CCriticalSection m_muReadingMedia;
+  static CEvent m_evDriveChanged;
 
   static DriveState m_DriveState;
   static time_t m_LastPoll;
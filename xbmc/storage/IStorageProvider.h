@@ -60,6 +60,10 @@ public:
     * @param device the storage device
     */
   virtual void OnStorageUnsafelyRemoved(const MEDIA_DETECT::STORAGE::StorageDevice& device) = 0;
+
+  /*! \brief Callback executed when the tray or the media of an optical drive changed
+    */
+  virtual void OnOpticalDriveChanged() {}
 };
 
 class IStorageProvider
@@ -87,6 +91,11 @@ public:
 
   virtual bool PumpDriveChangeEvents(IStorageEventsCallback *callback) = 0;
 
+  /*! \brief Whether PumpDriveChangeEvents() reports changes of optical drives to
+    * IStorageEventsCallback::OnOpticalDriveChanged(), so their state doesn't need to be polled.
+    */
+  virtual bool NotifiesOpticalDriveChanges() const { return false; }
+
   /**\brief Called by media manager to create platform storage provider
   *
   * This method used to create platform specified storage provider
@@ -813,6 +813,19 @@ void CMediaManager::OnStorageUnsafelyRemoved(const MEDIA_DETECT::STORAGE::Storag
                                         device.label);
 }
 
+void CMediaManager::OnOpticalDriveChanged()
+{
+#ifdef HAS_OPTICAL_DRIVE
+  MEDIA_DETECT::CDetectDVDMedia::OnDriveChanged();
+#endif
+}
+
+bool CMediaManager::NotifiesOpticalDriveChanges()
+{
+  std::unique_lock lock(m_CritSecStorageProvider);
+  return m_platformStorage && m_platformStorage->NotifiesOpticalDriveChanges();
+}
+
 UTILS::DISCS::DiscInfo CMediaManager::GetDiscInfo(const std::string& mediaPath)
 {
   UTILS::DISCS::DiscInfo info;
@@ -116,6 +116,16 @@ public:
   */
   void OnStorageUnsafelyRemoved(const MEDIA_DETECT::STORAGE::StorageDevice& device) override;
 
+  /*! \brief Callback executed when the tray or the media of an optical drive changed
+    * \sa IStorageEventsCallback
+  */
+  void OnOpticalDriveChanged() override;
+
+  /*! \brief Whether the storage provider reports changes of optical drives, so their state
+    * doesn't need to be polled
+  */
+  bool NotifiesOpticalDriveChanges();
+
   void OnJobComplete(unsigned int jobID, bool success, CJob *job) override { }
 
   bool playStubFile(const CFileItem& item);
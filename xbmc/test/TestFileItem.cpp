@@ -250,3 +250,23 @@ TEST(TestFileItem, MimeType)
   EXPECT_EQ("http://testdomain.com/api/movies", item.GetURL().Get());
   EXPECT_EQ("http://testdomain.com/api/movies", item.GetDynURL().Get());
 }
+
+TEST(TestFileItem, Properties)
+{
+  CFileItem source("Item");
+  source.SetProperty("Zeta", 26);
+  source.SetProperty("alpha", "a");
+  source.SetProperty("ALPHA", "b");
+  ASSERT_EQ(2u, source.GetProperties().size());
+  EXPECT_EQ("b", source.GetProperty("Alpha").asString());
+  EXPECT_TRUE(source.HasProperty("zeta"));
+
+  CFileItem item(source);
+  item.ClearProperty("ZETA");
+  EXPECT_FALSE(item.HasProperty("zeta"));
+  EXPECT_TRUE(source.HasProperty("zeta"));
+  EXPECT_EQ("alpha", item.GetProperties().begin()->first);
+
+  item.ClearProperties();
+  EXPECT_FALSE(item.HasProperties());
+}
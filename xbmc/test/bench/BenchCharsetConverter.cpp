@@ -0,0 +1,60 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/CharsetConverter.h"
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+const std::string UTF8 = "Die Hard – Stirb langsam (Ännchen, Ölçü, Смерть, 死ぬ) 1988";
+} // namespace
+
+static void CharsetConverter_Utf8ToW(benchmark::State& state)
+{
+  std::wstring wide;
+  for (auto _ : state)
+  {
+    g_charsetConverter.utf8ToW(UTF8, wide, false, false, false);
+    benchmark::DoNotOptimize(wide);
+  }
+}
+BENCHMARK(CharsetConverter_Utf8ToW);
+
+static void CharsetConverter_WToUtf8(benchmark::State& state)
+{
+  std::wstring wide;
+  g_charsetConverter.utf8ToW(UTF8, wide, false, false, false);
+  std::string utf8;
+  for (auto _ : state)
+  {
+    g_charsetConverter.wToUTF8(wide, utf8);
+    benchmark::DoNotOptimize(utf8);
+  }
+}
+BENCHMARK(CharsetConverter_WToUtf8);
+
+static void CharsetConverter_Utf8ToUtf32(benchmark::State& state)
+{
+  for (auto _ : state)
+    benchmark::DoNotOptimize(CCharsetConverter::utf8ToUtf32(UTF8));
+}
+BENCHMARK(CharsetConverter_Utf8ToUtf32);
+
+static void CharsetConverter_Utf8ToUtf32Visual(benchmark::State& state)
+{
+  std::u32string utf32;
+  for (auto _ : state)
+  {
+    CCharsetConverter::utf8ToUtf32Visual(UTF8, utf32, true);
+    benchmark::DoNotOptimize(utf32);
+  }
+}
+BENCHMARK(CharsetConverter_Utf8ToUtf32Visual);
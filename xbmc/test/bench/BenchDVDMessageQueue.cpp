@@ -0,0 +1,85 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/VideoPlayer/DVDDemuxers/DVDDemuxUtils.h"
+#include "cores/VideoPlayer/DVDMessage.h"
+#include "cores/VideoPlayer/DVDMessageQueue.h"
+#include "cores/VideoPlayer/Interface/DemuxPacket.h"
+
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include <benchmark/benchmark.h>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+std::shared_ptr<CDVDMsg> CreatePacket(int size, double pts)
+{
+  DemuxPacket* packet = CDVDDemuxUtils::AllocateDemuxPacket(size);
+  packet->iSize = size;
+  packet->pts = pts;
+  packet->dts = pts;
+  return std::make_shared<CDVDMsgDemuxerPacket>(packet);
+}
+} // namespace
+
+static void CDVDMessageQueue_PutGet(benchmark::State& state)
+{
+  CDVDMessageQueue queue("bench");
+  queue.Init();
+
+  const int batch = static_cast<int>(state.range(0));
+  double pts = 0.0;
+  for (auto _ : state)
+  {
+    for (int i = 0; i < batch; i++)
+      queue.Put(CreatePacket(4096, pts += 40000.0));
+
+    std::shared_ptr<CDVDMsg> msg;
+    for (int i = 0; i < batch; i++)
+      queue.Get(msg, 0ms);
+    benchmark::DoNotOptimize(msg);
+  }
+  state.SetItemsProcessed(state.iterations() * batch);
+  queue.End();
+}
+BENCHMARK(CDVDMessageQueue_PutGet)->Arg(1)->Arg(64);
+
+static void CDVDMessageQueue_ProducerConsumer(benchmark::State& state)
+{
+  const int count = static_cast<int>(state.range(0));
+  for (auto _ : state)
+  {
+    CDVDMessageQueue queue("bench");
+    queue.Init();
+
+    std::thread producer(
+        [&queue, count]()
+        {
+          double pts = 0.0;
+          for (int i = 0; i < count; i++)
+            queue.Put(CreatePacket(4096, pts += 40000.0));
+        });
+
+    std::shared_ptr<CDVDMsg> msg;
+    int received = 0;
+    while (received < count)
+    {
+      if (queue.Get(msg, 100ms) == MSGQ_OK)
+        received++;
+    }
+
+    producer.join();
+    queue.End();
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(CDVDMessageQueue_ProducerConsumer)->Arg(1000)->UseRealTime();
@@ -0,0 +1,68 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "BenchEnvironment.h"
+
+#include "ServiceBroker.h"
+#include "ServiceManager.h"
+#include "Util.h"
+#include "application/AppEnvironment.h"
+#include "application/AppParams.h"
+#include "application/Application.h"
+#include "filesystem/Directory.h"
+#include "filesystem/SpecialProtocol.h"
+#include "messaging/ApplicationMessenger.h"
+#include "platform/Filesystem.h"
+#include "utils/URIUtils.h"
+
+#include <memory>
+#include <system_error>
+
+namespace fs = KODI::PLATFORM::FILESYSTEM;
+
+bool CBenchEnvironment::SetUp()
+{
+  const auto params = std::make_shared<CAppParams>();
+  params->SetPlatformDirectories(false);
+
+  CAppEnvironment::SetUp(params);
+
+  CServiceBroker::RegisterAppMessenger(std::make_shared<KODI::MESSAGING::CApplicationMessenger>());
+
+  g_application.m_ServiceManager = std::make_unique<CServiceManager>();
+
+  const std::string xbmcPath = CUtil::GetHomePath();
+  if (xbmcPath.empty())
+    return false;
+
+  CSpecialProtocol::SetXBMCPath(xbmcPath);
+  CSpecialProtocol::SetXBMCBinPath(xbmcPath);
+  CSpecialProtocol::SetHomePath(URIUtils::AddFileToFolder(xbmcPath, "portable_data"));
+
+  std::error_code ec;
+  m_tempPath = fs::create_temp_directory(ec);
+  if (ec)
+    return false;
+
+  CSpecialProtocol::SetTempPath(m_tempPath);
+  CSpecialProtocol::SetProfilePath(m_tempPath);
+
+  return g_application.m_ServiceManager->InitForTesting();
+}
+
+void CBenchEnvironment::TearDown()
+{
+  if (!m_tempPath.empty())
+    XFILE::CDirectory::RemoveRecursive(m_tempPath);
+
+  g_application.m_ServiceManager->DeinitTesting();
+
+  CServiceBroker::UnregisterAppMessenger();
+
+  CAppEnvironment::TearDown();
+}
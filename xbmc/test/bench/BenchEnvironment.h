@@ -0,0 +1,29 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <string>
+
+/*!
+ \brief Minimal application environment for the benchmark binary.
+
+ Mirrors TestBasicEnvironment without depending on gtest: sets up the special
+ paths, a temporary profile directory and the services needed for testing.
+ */
+class CBenchEnvironment
+{
+public:
+  bool SetUp();
+  void TearDown();
+
+  const std::string& GetTempPath() const { return m_tempPath; }
+
+private:
+  std::string m_tempPath;
+};
@@ -0,0 +1,86 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "guilib/FFmpegImage.h"
+#include "guilib/TextureFormats.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+constexpr unsigned int WIDTH = 1920;
+constexpr unsigned int HEIGHT = 1080;
+
+// encode a synthetic gradient so the benchmark doesn't depend on reference files
+std::vector<uint8_t> EncodeImage(const std::string& mimeType, const std::string& fileName)
+{
+  std::vector<uint8_t> pixels(WIDTH * HEIGHT * 4);
+  for (unsigned int y = 0; y < HEIGHT; y++)
+  {
+    for (unsigned int x = 0; x < WIDTH; x++)
+    {
+      uint8_t* pixel = &pixels[(y * WIDTH + x) * 4];
+      pixel[0] = static_cast<uint8_t>(x);
+      pixel[1] = static_cast<uint8_t>(y);
+      pixel[2] = static_cast<uint8_t>(x ^ y);
+      pixel[3] = 0xff;
+    }
+  }
+
+  CFFmpegImage encoder(mimeType);
+  unsigned char* buffer = nullptr;
+  unsigned int size = 0;
+  std::vector<uint8_t> encoded;
+  if (encoder.CreateThumbnailFromSurface(pixels.data(), WIDTH, HEIGHT, XB_FMT_A8R8G8B8, WIDTH * 4,
+                                         fileName, buffer, size))
+    encoded.assign(buffer, buffer + size);
+  encoder.ReleaseThumbnailBuffer();
+  return encoded;
+}
+
+void Decode(benchmark::State& state, const std::string& mimeType, const std::string& fileName)
+{
+  std::vector<uint8_t> encoded = EncodeImage(mimeType, fileName);
+  if (encoded.empty())
+  {
+    state.SkipWithError("encoding the source image failed");
+    return;
+  }
+
+  std::vector<uint8_t> pixels(WIDTH * HEIGHT * 4);
+  for (auto _ : state)
+  {
+    CFFmpegImage image(mimeType);
+    if (!image.LoadImageFromMemory(encoded.data(), encoded.size(), WIDTH, HEIGHT) ||
+        !image.Decode(pixels.data(), image.Width(), image.Height(), image.Width() * 4,
+                      XB_FMT_A8R8G8B8))
+    {
+      state.SkipWithError("decoding failed");
+      break;
+    }
+    benchmark::DoNotOptimize(pixels.data());
+  }
+  state.SetBytesProcessed(state.iterations() * encoded.size());
+}
+} // namespace
+
+static void ImageDecode_Jpeg(benchmark::State& state)
+{
+  Decode(state, "image/jpeg", "bench.jpg");
+}
+BENCHMARK(ImageDecode_Jpeg)->Unit(benchmark::kMillisecond);
+
+static void ImageDecode_Png(benchmark::State& state)
+{
+  Decode(state, "image/png", "bench.png");
+}
+BENCHMARK(ImageDecode_Png)->Unit(benchmark::kMillisecond);
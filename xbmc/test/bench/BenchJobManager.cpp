@@ -0,0 +1,63 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ServiceBroker.h"
+#include "jobs/Job.h"
+#include "jobs/JobManager.h"
+#include "threads/Event.h"
+
+#include <atomic>
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+class CCountingJob : public CJob
+{
+public:
+  CCountingJob(std::atomic<int>& remaining, CEvent& done) : m_remaining(remaining), m_done(done) {}
+
+  bool DoWork() override
+  {
+    if (--m_remaining == 0)
+      m_done.Set();
+    return true;
+  }
+
+private:
+  std::atomic<int>& m_remaining;
+  CEvent& m_done;
+};
+} // namespace
+
+static void CJobManager_Throughput(benchmark::State& state)
+{
+  CServiceBroker::RegisterJobManager(std::make_shared<CJobManager>());
+  const auto jobManager = CServiceBroker::GetJobManager();
+
+  const int count = static_cast<int>(state.range(0));
+  const auto priority = static_cast<CJob::PRIORITY>(state.range(1));
+  for (auto _ : state)
+  {
+    std::atomic<int> remaining = count;
+    CEvent done;
+    for (int i = 0; i < count; i++)
+      jobManager->AddJob(new CCountingJob(remaining, done), nullptr, priority);
+    done.Wait();
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+
+  jobManager->CancelJobs();
+  jobManager->Restart();
+  CServiceBroker::UnregisterJobManager();
+}
+BENCHMARK(CJobManager_Throughput)
+    ->Args({1000, CJob::PRIORITY_LOW})
+    ->Args({1000, CJob::PRIORITY_HIGH})
+    ->UseRealTime();
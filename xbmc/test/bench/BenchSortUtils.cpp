@@ -0,0 +1,73 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/SortUtils.h"
+#include "utils/Variant.h"
+
+#include <memory>
+#include <random>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+SortItems CreateItems(int count)
+{
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<int> years(1950, 2025);
+  std::uniform_int_distribution<int> titles(0, count * 10);
+
+  SortItems items;
+  items.reserve(count);
+  for (int i = 0; i < count; i++)
+  {
+    auto item = std::make_shared<SortItem>();
+    const std::string title = "Title " + std::to_string(titles(generator));
+    (*item)[FieldLabel] = title;
+    (*item)[FieldTitle] = title;
+    (*item)[FieldYear] = years(generator);
+    (*item)[FieldDateAdded] = "2024-01-01 12:00:00";
+    (*item)[FieldPath] = "smb://server/share/" + title + ".mkv";
+    items.push_back(item);
+  }
+  return items;
+}
+
+void Sort(benchmark::State& state, SortBy sortBy, SortAttribute attributes)
+{
+  const SortItems items = CreateItems(static_cast<int>(state.range(0)));
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    SortItems copy = items;
+    state.ResumeTiming();
+    SortUtils::Sort(sortBy, SortOrderAscending, attributes, copy);
+    benchmark::DoNotOptimize(copy);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+} // namespace
+
+static void SortUtils_SortByLabel(benchmark::State& state)
+{
+  Sort(state, SortByLabel, SortAttributeNone);
+}
+BENCHMARK(SortUtils_SortByLabel)->Arg(1000)->Arg(10000);
+
+static void SortUtils_SortByTitleIgnoreArticle(benchmark::State& state)
+{
+  Sort(state, SortByTitle, SortAttributeIgnoreArticle);
+}
+BENCHMARK(SortUtils_SortByTitleIgnoreArticle)->Arg(1000)->Arg(10000);
+
+static void SortUtils_SortByYear(benchmark::State& state)
+{
+  Sort(state, SortByYear, SortAttributeNone);
+}
+BENCHMARK(SortUtils_SortByYear)->Arg(1000)->Arg(10000);
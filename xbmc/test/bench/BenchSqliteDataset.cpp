@@ -0,0 +1,151 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "dbwrappers/sqlitedataset.h"
+#include "filesystem/SpecialProtocol.h"
+
+#include <memory>
+#include <random>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+using namespace dbiplus;
+
+namespace
+{
+constexpr int MOVIES = 20000;
+constexpr int GENRES = 20;
+
+/*!
+ \brief Library-like database with a generated dataset, created once per run.
+
+ The schema follows the layout of the video library (movie, genre and the
+ genre_link table) so the queries exercise the same kind of joins.
+ */
+class CBenchLibrary
+{
+public:
+  static CBenchLibrary& Get()
+  {
+    static CBenchLibrary library;
+    return library;
+  }
+
+  Dataset& GetDataset() { return *m_ds; }
+
+private:
+  CBenchLibrary()
+  {
+    m_db.setHostName(CSpecialProtocol::TranslatePath("special://temp/").c_str());
+    m_db.setDatabase("bench-library.db");
+    m_db.connect(true);
+    m_ds.reset(m_db.CreateDataset());
+
+    m_ds->exec("DROP TABLE IF EXISTS movie");
+    m_ds->exec("DROP TABLE IF EXISTS genre");
+    m_ds->exec("DROP TABLE IF EXISTS genre_link");
+    m_ds->exec("CREATE TABLE movie (idMovie INTEGER PRIMARY KEY, c00 TEXT, c07 INTEGER, "
+               "rating REAL, playCount INTEGER, strPath TEXT)");
+    m_ds->exec("CREATE TABLE genre (genre_id INTEGER PRIMARY KEY, name TEXT)");
+    m_ds->exec("CREATE TABLE genre_link (genre_id INTEGER, media_id INTEGER, media_type TEXT)");
+    m_ds->exec("CREATE INDEX ix_movie_c07 ON movie (c07)");
+    m_ds->exec("CREATE UNIQUE INDEX ix_genre_link ON genre_link (genre_id, media_type, media_id)");
+    m_ds->exec("CREATE INDEX ix_genre_link_media ON genre_link (media_id, media_type)");
+
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> years(1950, 2025);
+    std::uniform_int_distribution<int> genres(1, GENRES);
+    std::uniform_real_distribution<double> ratings(1.0, 10.0);
+
+    m_db.start_transaction();
+    for (int i = 1; i <= GENRES; i++)
+      m_ds->exec("INSERT INTO genre (genre_id, name) VALUES (?, ?)",
+                 {field_value(i), field_value(("Genre " + std::to_string(i)).c_str())});
+    for (int i = 1; i <= MOVIES; i++)
+    {
+      const std::string title = "Movie " + std::to_string(i);
+      const std::string path = "smb://server/share/Movies/" + title + "/";
+      m_ds->exec("INSERT INTO movie (idMovie, c00, c07, rating, playCount, strPath) "
+                 "VALUES (?, ?, ?, ?, ?, ?)",
+                 {field_value(i), field_value(title.c_str()), field_value(years(generator)),
+                  field_value(ratings(generator)), field_value(i % 3), field_value(path.c_str())});
+      const int genre = genres(generator);
+      m_ds->exec("INSERT INTO genre_link (genre_id, media_id, media_type) VALUES (?, ?, 'movie')",
+                 {field_value(genre), field_value(i)});
+      m_ds->exec("INSERT INTO genre_link (genre_id, media_id, media_type) VALUES (?, ?, 'movie')",
+                 {field_value(genre % GENRES + 1), field_value(i)});
+    }
+    m_db.commit_transaction();
+  }
+
+  ~CBenchLibrary()
+  {
+    m_ds.reset();
+    m_db.disconnect();
+  }
+
+  SqliteDatabase m_db;
+  std::unique_ptr<Dataset> m_ds;
+};
+
+void RunQuery(benchmark::State& state, const std::string& sql, const BindList& params = {})
+{
+  Dataset& ds = CBenchLibrary::Get().GetDataset();
+  int64_t rows = 0;
+  for (auto _ : state)
+  {
+    if (!(params.empty() ? ds.query(sql) : ds.query(sql, params)))
+    {
+      state.SkipWithError("query failed");
+      break;
+    }
+    rows += ds.num_rows();
+    ds.close();
+  }
+  state.counters["rows"] = benchmark::Counter(static_cast<double>(rows),
+                                              benchmark::Counter::kAvgIterations);
+}
+} // namespace
+
+static void SqliteLibrary_LookupById(benchmark::State& state)
+{
+  RunQuery(state, "SELECT * FROM movie WHERE idMovie=?", {field_value(MOVIES / 2)});
+}
+BENCHMARK(SqliteLibrary_LookupById);
+
+static void SqliteLibrary_FilterByYear(benchmark::State& state)
+{
+  RunQuery(state, "SELECT idMovie, c00, rating FROM movie WHERE c07=? ORDER BY c00",
+           {field_value(2010)});
+}
+BENCHMARK(SqliteLibrary_FilterByYear);
+
+static void SqliteLibrary_SearchTitle(benchmark::State& state)
+{
+  RunQuery(state, "SELECT idMovie, c00 FROM movie WHERE c00 LIKE ? LIMIT 50",
+           {field_value("%ovie 12%")});
+}
+BENCHMARK(SqliteLibrary_SearchTitle);
+
+static void SqliteLibrary_MoviesByGenre(benchmark::State& state)
+{
+  RunQuery(state,
+           "SELECT movie.idMovie, movie.c00 FROM movie "
+           "JOIN genre_link ON genre_link.media_id=movie.idMovie AND genre_link.media_type='movie' "
+           "JOIN genre ON genre.genre_id=genre_link.genre_id "
+           "WHERE genre.name=? ORDER BY movie.rating DESC",
+           {field_value("Genre 7")});
+}
+BENCHMARK(SqliteLibrary_MoviesByGenre)->Unit(benchmark::kMillisecond);
+
+static void SqliteLibrary_FullListing(benchmark::State& state)
+{
+  RunQuery(state, "SELECT idMovie, c00, c07, rating, playCount, strPath FROM movie");
+}
+BENCHMARK(SqliteLibrary_FullListing)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,77 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/StringUtils.h"
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+const std::string PATH = "smb://server/share/Movies/The Movie (2010)/The.Movie.2010.1080p.mkv";
+const std::string LIST = "Action / Adventure / Comedy / Drama / Science Fiction / Thriller";
+} // namespace
+
+static void StringUtils_Format(benchmark::State& state)
+{
+  for (auto _ : state)
+    benchmark::DoNotOptimize(
+        StringUtils::Format("{} - S{:02}E{:02} ({:.1f}) [{}]", "Show", 3, 12, 8.25, PATH));
+}
+BENCHMARK(StringUtils_Format);
+
+static void StringUtils_Split(benchmark::State& state)
+{
+  for (auto _ : state)
+    benchmark::DoNotOptimize(StringUtils::Split(LIST, " / "));
+}
+BENCHMARK(StringUtils_Split);
+
+static void StringUtils_Join(benchmark::State& state)
+{
+  const std::vector<std::string> items = StringUtils::Split(LIST, " / ");
+  for (auto _ : state)
+    benchmark::DoNotOptimize(StringUtils::Join(items, " / "));
+}
+BENCHMARK(StringUtils_Join);
+
+static void StringUtils_Replace(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    std::string str = PATH;
+    benchmark::DoNotOptimize(StringUtils::Replace(str, ".", " "));
+  }
+}
+BENCHMARK(StringUtils_Replace);
+
+static void StringUtils_ToLower(benchmark::State& state)
+{
+  for (auto _ : state)
+    benchmark::DoNotOptimize(StringUtils::ToLower(PATH));
+}
+BENCHMARK(StringUtils_ToLower);
+
+static void StringUtils_EqualsNoCase(benchmark::State& state)
+{
+  const std::string upper = StringUtils::ToUpper(PATH);
+  for (auto _ : state)
+    benchmark::DoNotOptimize(StringUtils::EqualsNoCase(PATH, upper));
+}
+BENCHMARK(StringUtils_EqualsNoCase);
+
+static void StringUtils_AlphaNumericCompare(benchmark::State& state)
+{
+  const std::wstring left = L"Episode 9 - The Title";
+  const std::wstring right = L"Episode 10 - The Title";
+  for (auto _ : state)
+    benchmark::DoNotOptimize(StringUtils::AlphaNumericCompare(left, right));
+}
+BENCHMARK(StringUtils_AlphaNumericCompare);
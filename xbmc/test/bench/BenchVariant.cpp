@@ -0,0 +1,108 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/JSONVariantParser.h"
+#include "utils/JSONVariantWriter.h"
+#include "utils/Variant.h"
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+// roughly the shape of a VideoLibrary.GetMovies response
+CVariant CreateMovies(int count)
+{
+  CVariant result(CVariant::VariantTypeObject);
+  result["limits"]["start"] = 0;
+  result["limits"]["end"] = count;
+  result["limits"]["total"] = count;
+
+  CVariant& movies = result["movies"];
+  movies = CVariant(CVariant::VariantTypeArray);
+  for (int i = 0; i < count; i++)
+  {
+    CVariant movie(CVariant::VariantTypeObject);
+    movie["movieid"] = i;
+    movie["label"] = "Movie " + std::to_string(i);
+    movie["year"] = 1950 + i % 75;
+    movie["rating"] = (i % 100) / 10.0;
+    movie["playcount"] = i % 3;
+    movie["file"] = "smb://server/share/Movies/Movie " + std::to_string(i) + ".mkv";
+    movie["genre"].push_back("Action");
+    movie["genre"].push_back("Drama");
+    movie["art"]["poster"] = "image://movie" + std::to_string(i) + "/poster.jpg/";
+    movies.push_back(movie);
+  }
+  return result;
+}
+} // namespace
+
+static void CVariant_Build(benchmark::State& state)
+{
+  for (auto _ : state)
+    benchmark::DoNotOptimize(CreateMovies(static_cast<int>(state.range(0))));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(CVariant_Build)->Arg(100)->Arg(1000);
+
+static void CVariant_Copy(benchmark::State& state)
+{
+  const CVariant movies = CreateMovies(static_cast<int>(state.range(0)));
+  for (auto _ : state)
+  {
+    CVariant copy = movies;
+    benchmark::DoNotOptimize(copy);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(CVariant_Copy)->Arg(100)->Arg(1000);
+
+static void JSON_Write(benchmark::State& state)
+{
+  const CVariant movies = CreateMovies(static_cast<int>(state.range(0)));
+  std::string json;
+  for (auto _ : state)
+  {
+    json.clear();
+    CJSONVariantWriter::Write(movies, json, true);
+    benchmark::DoNotOptimize(json);
+  }
+  state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(JSON_Write)->Arg(100)->Arg(1000);
+
+static void JSON_Parse(benchmark::State& state)
+{
+  std::string json;
+  CJSONVariantWriter::Write(CreateMovies(static_cast<int>(state.range(0))), json, true);
+  for (auto _ : state)
+  {
+    CVariant parsed;
+    CJSONVariantParser::Parse(json, parsed);
+    benchmark::DoNotOptimize(parsed);
+  }
+  state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(JSON_Parse)->Arg(100)->Arg(1000);
+
+static void JSON_RoundTrip(benchmark::State& state)
+{
+  const CVariant movies = CreateMovies(static_cast<int>(state.range(0)));
+  for (auto _ : state)
+  {
+    std::string json;
+    CJSONVariantWriter::Write(movies, json, true);
+    CVariant parsed;
+    CJSONVariantParser::Parse(json, parsed);
+    benchmark::DoNotOptimize(parsed);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(JSON_RoundTrip)->Arg(100)->Arg(1000);
@@ -0,0 +1,35 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "BenchEnvironment.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+#include <benchmark/benchmark.h>
+
+int main(int argc, char** argv)
+{
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    return EXIT_FAILURE;
+
+  CBenchEnvironment environment;
+  if (!environment.SetUp())
+  {
+    fprintf(stderr, "Setup of benchmark environment failed.\n");
+    environment.TearDown();
+    return EXIT_FAILURE;
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+
+  environment.TearDown();
+  return EXIT_SUCCESS;
+}
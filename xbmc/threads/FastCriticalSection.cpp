@@ -0,0 +1,21 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FastCriticalSection.h"
+
+#include "threads/SpinWait.h"
+#include "utils/Trace.h"
+
+void CFastCriticalSection::LockContended()
+{
+  if (XbmcThreads::TrySpinLock(m_mutex))
+    return;
+
+  CTraceZone zone("lock wait");
+  m_mutex.lock();
+}
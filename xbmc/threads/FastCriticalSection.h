@@ -0,0 +1,41 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <mutex>
+
+/*!
+ * \brief Non-recursive lock for short critical sections on hot paths.
+ *
+ * Contended locks spin for a short while before blocking, time spent blocking shows up as
+ * "lock wait" zone in traces (see CTrace).
+ *
+ * Unlike CCriticalSection it must not be locked again by the thread holding it and it can't be
+ * used with CSingleExit or XbmcThreads::ConditionVariable. Use it with std::unique_lock.
+ */
+class CFastCriticalSection
+{
+public:
+  CFastCriticalSection() = default;
+  CFastCriticalSection(const CFastCriticalSection&) = delete;
+  CFastCriticalSection& operator=(const CFastCriticalSection&) = delete;
+
+  void lock()
+  {
+    if (!m_mutex.try_lock())
+      LockContended();
+  }
+  bool try_lock() { return m_mutex.try_lock(); }
+  void unlock() { m_mutex.unlock(); }
+
+private:
+  void LockContended();
+
+  std::mutex m_mutex;
+};
@@ -13,6 +13,7 @@
 #include <memory>
 #include <string>
 #include <thread>
+#include <vector>
 
 class IThreadImpl
 {
@@ -33,6 +34,13 @@ public:
    */
   virtual bool SetPriority(const ThreadPriority& priority) = 0;
 
+  /*!
+   * \brief Restrict the thread to a set of cores, an empty set allows all of them
+   * \return false if the platform doesn't support it
+   *
+   */
+  virtual bool SetAffinity(const std::vector<int>& cores) { return false; }
+
 protected:
   IThreadImpl(std::thread::native_handle_type handle) : m_handle(handle) {}
 
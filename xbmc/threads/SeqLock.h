@@ -0,0 +1,106 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/FastCriticalSection.h"
+#include "threads/SpinWait.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <mutex>
+#include <type_traits>
+
+namespace XbmcThreads
+{
+
+/*!
+ * \brief Holds a small, trivially copyable value that is read much more often than written.
+ *
+ * Readers never block and never block writers: they copy the value and retry if a writer changed
+ * it meanwhile. Writers are serialized with each other only. The value is copied word by word
+ * through atomics, so a reader can't see a torn value.
+ */
+template<typename T>
+class CSeqLock
+{
+  static_assert(std::is_trivially_copyable_v<T>, "CSeqLock needs a trivially copyable type");
+
+public:
+  CSeqLock() : CSeqLock(T{}) {}
+  explicit CSeqLock(const T& value) { Write(value); }
+
+  CSeqLock(const CSeqLock&) = delete;
+  CSeqLock& operator=(const CSeqLock&) = delete;
+
+  T Load() const
+  {
+    std::array<Word, WORDS> words;
+    while (true)
+    {
+      const unsigned int seq = m_seq.load(std::memory_order_acquire);
+      if ((seq & 1) == 0)
+      {
+        for (size_t i = 0; i < WORDS; ++i)
+          words[i] = m_words[i].load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (m_seq.load(std::memory_order_relaxed) == seq)
+          break;
+      }
+      CpuRelax();
+    }
+
+    T value;
+    std::memcpy(static_cast<void*>(&value), words.data(), sizeof(T));
+    return value;
+  }
+
+  void Store(const T& value)
+  {
+    std::unique_lock lock(m_writeSection);
+    Write(value);
+  }
+
+  /*!
+   * \brief Change the value, update is called with a copy of the current value to modify
+   */
+  template<typename F>
+  void Update(F&& update)
+  {
+    std::unique_lock lock(m_writeSection);
+    T value = Load();
+    update(value);
+    Write(value);
+  }
+
+private:
+  using Word = size_t;
+  static constexpr size_t WORDS = (sizeof(T) + sizeof(Word) - 1) / sizeof(Word);
+
+  void Write(const T& value)
+  {
+    std::array<Word, WORDS> words{};
+    std::memcpy(words.data(), &value, sizeof(T));
+
+    // an odd sequence makes readers retry until the write is complete
+    const unsigned int seq = m_seq.load(std::memory_order_relaxed);
+    m_seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_t i = 0; i < WORDS; ++i)
+      m_words[i].store(words[i], std::memory_order_relaxed);
+    m_seq.store(seq + 2, std::memory_order_release);
+  }
+
+  std::atomic<unsigned int> m_seq{0};
+  std::array<std::atomic<Word>, WORDS> m_words{};
+  CFastCriticalSection m_writeSection;
+};
+
+} // namespace XbmcThreads
@@ -8,47 +8,136 @@
 
 #pragma once
 
-#include "threads/Condition.h"
+#include "threads/CriticalSection.h"
 
+#include <atomic>
+#include <condition_variable>
 #include <mutex>
 #include <shared_mutex>
+#include <thread>
 
 /**
  * A CSharedSection is a mutex that satisfies the Shared Lockable concept (see Lockables.h).
+ *
+ * Shared locks only touch an atomic reader count as long as there is no exclusive lock, so
+ * readers don't serialize on each other. The exclusive lock is recursive and its owner may take
+ * shared locks as well. Shared locks may be taken recursively too, which is why readers are let in
+ * while a writer waits for the current readers to leave: a writer blocking new readers would
+ * deadlock a thread that takes a second shared lock.
  */
 class CSharedSection
 {
-  CCriticalSection sec;
-  XbmcThreads::ConditionVariable actualCv;
-
-  unsigned int sharedCount = 0;
-
 public:
   inline CSharedSection() = default;
+  CSharedSection(const CSharedSection&) = delete;
+  CSharedSection& operator=(const CSharedSection&) = delete;
 
   inline void lock()
   {
-    std::unique_lock l(sec);
-    while (sharedCount)
-      actualCv.wait(l, [this]() { return sharedCount == 0; });
-    sec.lock();
+    m_writeSection.lock();
+    if (m_writeDepth++ > 0)
+      return;
+
+    m_writerWaiting.store(true);
+    std::unique_lock l(m_waitMutex);
+    while (true)
+    {
+      m_cv.wait(l, [this]() { return m_readers.load() == 0; });
+      m_writer.store(true);
+      if (m_readers.load() == 0)
+        break;
+
+      // a reader got in meanwhile, it goes first
+      m_writer.store(false);
+      m_cv.notify_all();
+    }
+    m_writerWaiting.store(false);
+    m_owner.store(std::this_thread::get_id(), std::memory_order_relaxed);
+  }
+
+  inline bool try_lock()
+  {
+    if (!m_writeSection.try_lock())
+      return false;
+    if (m_writeDepth > 0)
+    {
+      m_writeDepth++;
+      return true;
+    }
+
+    m_writer.store(true);
+    if (m_readers.load() != 0)
+    {
+      ReleaseWriter();
+      m_writeSection.unlock();
+      return false;
+    }
+    m_writeDepth = 1;
+    m_owner.store(std::this_thread::get_id(), std::memory_order_relaxed);
+    return true;
+  }
+
+  inline void unlock()
+  {
+    if (--m_writeDepth == 0)
+    {
+      m_owner.store(std::thread::id(), std::memory_order_relaxed);
+      ReleaseWriter();
+    }
+    m_writeSection.unlock();
   }
-  inline bool try_lock() { return (sec.try_lock() ? ((sharedCount == 0) ? true : (sec.unlock(), false)) : false); }
-  inline void unlock() { sec.unlock(); }
 
   inline void lock_shared()
   {
-    std::unique_lock l(sec);
-    sharedCount++;
+    while (!try_lock_shared())
+    {
+      std::unique_lock l(m_waitMutex);
+      m_cv.wait(l, [this]() { return !m_writer.load(); });
+    }
   }
-  inline bool try_lock_shared() { return (sec.try_lock() ? sharedCount++, sec.unlock(), true : false); }
+
+  inline bool try_lock_shared()
+  {
+    m_readers.fetch_add(1);
+    if (!m_writer.load() ||
+        m_owner.load(std::memory_order_relaxed) == std::this_thread::get_id())
+      return true;
+
+    unlock_shared();
+    return false;
+  }
+
   inline void unlock_shared()
   {
-    std::unique_lock l(sec);
-    sharedCount--;
-    if (!sharedCount)
+    m_readers.fetch_sub(1);
+    if (m_writerWaiting.load())
     {
-      actualCv.notifyAll();
+      std::unique_lock l(m_waitMutex);
+      m_cv.notify_all();
     }
   }
+
+private:
+  void ReleaseWriter()
+  {
+    {
+      std::unique_lock l(m_waitMutex);
+      m_writer.store(false);
+    }
+    m_cv.notify_all();
+  }
+
+  // all accesses to the atomics below are sequentially consistent, a reader increments the count
+  // before checking for a writer and a writer sets its flag before checking the count
+  std::atomic<unsigned int> m_readers{0};
+  std::atomic<bool> m_writer{false};
+  std::atomic<bool> m_writerWaiting{false};
+  std::atomic<std::thread::id> m_owner{};
+
+  // serializes writers, held for as long as the exclusive lock is
+  CCriticalSection m_writeSection;
+  unsigned int m_writeDepth{0};
+
+  std::mutex m_waitMutex;
+  std::condition_variable m_cv;
 };
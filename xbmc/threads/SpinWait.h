@@ -0,0 +1,63 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
+namespace XbmcThreads
+{
+
+/*!
+ * \brief Tell the cpu that the calling thread is busy waiting, to save power and to let the
+ * other hardware thread of the core run.
+ */
+inline void CpuRelax()
+{
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+  _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+  __asm__ __volatile__("yield");
+#endif
+}
+
+/*!
+ * \brief Try to take a lock that is held by another thread by spinning for a short while.
+ *
+ * Most critical sections are held for much less time than it takes to put a thread to sleep and
+ * wake it up again, so a few more tries often avoid two context switches. Nothing is gained by
+ * spinning on a single core, the owner can't release the lock meanwhile.
+ *
+ * \return true if the lock was taken, false if the caller has to block on it
+ */
+template<class L>
+bool TrySpinLock(L& lockable)
+{
+  constexpr int SPIN_COUNT = 100;
+  static const bool multiCore = std::thread::hardware_concurrency() > 1;
+
+  if (lockable.try_lock())
+    return true;
+
+  if (!multiCore)
+    return false;
+
+  for (int i = 0; i < SPIN_COUNT; ++i)
+  {
+    CpuRelax();
+    if (lockable.try_lock())
+      return true;
+  }
+  return false;
+}
+
+} // namespace XbmcThreads
@@ -14,6 +14,7 @@
 #include "commons/Exception.h"
 #include "threads/IThreadImpl.h"
 #include "threads/SingleLock.h"
+#include "threads/ThreadPolicy.h"
 #include "utils/log.h"
 
 #include <atomic>
@@ -108,6 +109,9 @@ void CThread::Create(bool bAutoDelete)
   std::promise<bool> prom;
   m_future = prom.get_future();
 
+  // threads inherit the affinity of their creator, don't keep a new one on the cores of its class
+  const bool resetAffinity = currentThread && currentThread->m_affinityRestricted;
+
   {
     // The std::thread internals must be set prior to the lambda doing
     //   any work. This will cause the lambda to wait until m_thread
@@ -115,7 +119,7 @@ void CThread::Create(bool bAutoDelete)
     //   have the appropriate memory barrier behavior to accomplish the
     //   same thing so a full system mutex needs to be used.
     std::unique_lock blockLambdaTillDone(m_CriticalSection);
-    m_thread = new std::thread([](CThread* pThread, std::promise<bool> promise)
+    m_thread = new std::thread([](CThread* pThread, std::promise<bool> promise, bool resetAffinity)
     {
       try
       {
@@ -142,6 +146,8 @@ void CThread::Create(bool bAutoDelete)
 
         pThread->m_impl = IThreadImpl::CreateThreadImpl(pThread->m_thread->native_handle());
         pThread->m_impl->SetThreadInfo(pThread->m_ThreadName);
+        if (resetAffinity)
+          pThread->m_impl->SetAffinity({});
 
         CLog::Log(LOGDEBUG, "Thread {} start, auto delete: {}", pThread->m_ThreadName,
                   (pThread->m_bAutoDelete ? "true" : "false"));
@@ -171,7 +177,7 @@ void CThread::Create(bool bAutoDelete)
       }
 
       promise.set_value(true);
-    }, this, std::move(prom));
+    }, this, std::move(prom), resetAffinity);
   } // let the lambda proceed
 
   m_StartEvent.Wait(); // wait for the thread just spawned to set its internals
@@ -197,6 +203,21 @@ bool CThread::SetPriority(const ThreadPriority& priority)
   return m_impl->SetPriority(priority);
 }
 
+bool CThread::SetThreadClass(ThreadClass threadClass)
+{
+  const CThreadPolicy::Policy policy = CThreadPolicy::Get(threadClass);
+  const std::vector<int> cores = CThreadPolicy::GetCores(threadClass);
+
+  if (m_impl->SetAffinity(cores))
+  {
+    m_affinityRestricted = !cores.empty();
+    CLog::Log(LOGDEBUG, "[threads] name: '{}' class: '{}' cores: '{}'", m_ThreadName,
+              CThreadPolicy::GetName(threadClass), CThreadPolicy::FormatCores(cores));
+  }
+
+  return m_impl->SetPriority(policy.priority);
+}
+
 bool CThread::IsAutoDelete() const
 {
   return m_bAutoDelete;
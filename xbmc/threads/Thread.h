@@ -39,6 +39,24 @@ enum class ThreadPriority
   PRIORITY_COUNT,
 };
 
+/*!
+ * \brief Classes of threads sharing a scheduling policy, see CThreadPolicy.
+ *
+ */
+enum class ThreadClass
+{
+  AUDIO, //!< audio decoding and output, must never underrun
+  VIDEO, //!< video decoding and presentation
+  BACKGROUND, //!< jobs and other work nobody is waiting for
+
+  /*!
+   * \brief Do not use this as class. It is only needed to count the
+   *        amount of values in the ThreadClass enum.
+   *
+   */
+  CLASS_COUNT,
+};
+
 class IRunnable;
 class IThreadImpl;
 class CThread
@@ -79,8 +97,17 @@ public:
    */
   bool SetPriority(const ThreadPriority& priority);
 
+  /*!
+   * \brief Set the priority and the cores of the thread to the policy of
+   *        its class, see CThreadPolicy.
+   *
+   */
+  bool SetThreadClass(ThreadClass threadClass);
+
   static CThread* GetCurrentThread();
 
+  const std::string& GetName() const { return m_ThreadName; }
+
   virtual void OnException(){} // signal termination handler
 
 protected:
@@ -112,6 +139,7 @@ private:
   void Action();
 
   bool m_bAutoDelete = false;
+  std::atomic<bool> m_affinityRestricted{false}; //!< inherited by threads it creates
   CEvent m_StopEvent;
   CEvent m_StartEvent;
   CCriticalSection m_CriticalSection;
@@ -0,0 +1,153 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ThreadPolicy.h"
+
+#include "utils/log.h"
+
+#include <algorithm>
+#include <array>
+#include <mutex>
+
+namespace
+{
+constexpr size_t CLASS_COUNT = static_cast<size_t>(ThreadClass::CLASS_COUNT);
+
+constexpr std::array<const char*, CLASS_COUNT> CLASS_NAMES = {"audio", "video", "background"};
+
+constexpr std::array<const char*, static_cast<size_t>(ThreadPriority::PRIORITY_COUNT)>
+    PRIORITY_NAMES = {"lowest", "belownormal", "normal", "abovenormal", "highest"};
+
+constexpr std::array<const char*, 3> CORES_NAMES = {"all", "performance", "efficiency"};
+
+struct State
+{
+  std::mutex mutex;
+  // audio must not underrun and video decoding is paced by its slowest thread, keep both off
+  // the efficiency cores. jobs only run there, so they don't take time from playback.
+  std::array<CThreadPolicy::Policy, CLASS_COUNT> policies = {{
+      {ThreadPriority::ABOVE_NORMAL, ThreadCores::PERFORMANCE},
+      {ThreadPriority::NORMAL, ThreadCores::PERFORMANCE},
+      {ThreadPriority::LOWEST, ThreadCores::EFFICIENCY},
+  }};
+  std::vector<int> performanceCores;
+  std::vector<int> efficiencyCores;
+};
+
+State& GetState()
+{
+  static State state;
+  return state;
+}
+
+template<typename T, size_t N>
+bool FindName(const std::array<const char*, N>& names, const std::string& name, T& value)
+{
+  const auto it = std::ranges::find(names, name);
+  if (it == names.end())
+    return false;
+  value = static_cast<T>(it - names.begin());
+  return true;
+}
+} // namespace
+
+CThreadPolicy::Policy CThreadPolicy::Get(ThreadClass threadClass)
+{
+  State& state = GetState();
+  std::unique_lock lock(state.mutex);
+  return state.policies[static_cast<size_t>(threadClass)];
+}
+
+void CThreadPolicy::Set(ThreadClass threadClass, const Policy& policy)
+{
+  State& state = GetState();
+  std::unique_lock lock(state.mutex);
+  state.policies[static_cast<size_t>(threadClass)] = policy;
+}
+
+bool CThreadPolicy::Set(const std::string& threadClass,
+                        const std::string& priority,
+                        const std::string& cores)
+{
+  ThreadClass cls;
+  if (!FindName(CLASS_NAMES, threadClass, cls))
+    return false;
+
+  Policy policy = Get(cls);
+  if (!priority.empty() && !FindName(PRIORITY_NAMES, priority, policy.priority))
+    return false;
+  if (!cores.empty() && !FindName(CORES_NAMES, cores, policy.cores))
+    return false;
+
+  Set(cls, policy);
+  return true;
+}
+
+void CThreadPolicy::SetTopology(int coreCount, const std::vector<int>& performanceCores)
+{
+  State& state = GetState();
+  std::unique_lock lock(state.mutex);
+  state.performanceCores.clear();
+  state.efficiencyCores.clear();
+  if (performanceCores.empty())
+    return;
+
+  state.performanceCores = performanceCores;
+  for (int core = 0; core < coreCount; core++)
+  {
+    if (std::ranges::find(performanceCores, core) == performanceCores.end())
+      state.efficiencyCores.emplace_back(core);
+  }
+}
+
+std::vector<int> CThreadPolicy::GetCores(ThreadClass threadClass)
+{
+  State& state = GetState();
+  std::unique_lock lock(state.mutex);
+  switch (state.policies[static_cast<size_t>(threadClass)].cores)
+  {
+    case ThreadCores::PERFORMANCE:
+      return state.performanceCores;
+    case ThreadCores::EFFICIENCY:
+      return state.efficiencyCores;
+    default:
+      return {};
+  }
+}
+
+const char* CThreadPolicy::GetName(ThreadClass threadClass)
+{
+  return CLASS_NAMES[static_cast<size_t>(threadClass)];
+}
+
+std::string CThreadPolicy::FormatCores(const std::vector<int>& cores)
+{
+  if (cores.empty())
+    return "all";
+
+  std::string result;
+  for (int core : cores)
+  {
+    if (!result.empty())
+      result += ',';
+    result += std::to_string(core);
+  }
+  return result;
+}
+
+void CThreadPolicy::Log()
+{
+  for (size_t i = 0; i < CLASS_COUNT; i++)
+  {
+    const ThreadClass threadClass = static_cast<ThreadClass>(i);
+    const Policy policy = Get(threadClass);
+    CLog::Log(LOGINFO, "[threads] class: '{}' priority: '{}' cores: '{}' ({})",
+              GetName(threadClass), PRIORITY_NAMES[static_cast<size_t>(policy.priority)],
+              CORES_NAMES[static_cast<size_t>(policy.cores)], FormatCores(GetCores(threadClass)));
+  }
+}
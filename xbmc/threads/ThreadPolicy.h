@@ -0,0 +1,79 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/Thread.h"
+
+#include <string>
+#include <vector>
+
+//! Cores the threads of a class may run on
+enum class ThreadCores
+{
+  ALL,
+  PERFORMANCE, //!< the fastest cores of a heterogeneous (big.LITTLE) cpu
+  EFFICIENCY, //!< the other cores of a heterogeneous cpu
+};
+
+/*!
+ \brief Scheduling policy of the thread classes.
+
+ Maps every ThreadClass to a priority and the cores its threads may run on, which threads apply
+ with CThread::SetThreadClass(). The cores are resolved with the topology passed to
+ SetTopology(); on cpus whose cores are all equally fast the classes aren't restricted. The
+ defaults can be changed in advancedsettings.xml:
+
+ \code{.xml}
+ <threads>
+   <audio priority="abovenormal" cores="performance"/>
+   <background priority="lowest" cores="efficiency"/>
+ </threads>
+ \endcode
+ */
+class CThreadPolicy
+{
+public:
+  struct Policy
+  {
+    ThreadPriority priority;
+    ThreadCores cores;
+  };
+
+  static Policy Get(ThreadClass threadClass);
+  static void Set(ThreadClass threadClass, const Policy& policy);
+
+  /*!
+   \brief Set the policy of a class from its names in advancedsettings.xml
+   \param threadClass name of the class, e.g. "audio"
+   \param priority name of the priority, e.g. "abovenormal", empty keeps the current one
+   \param cores name of the cores, e.g. "performance", empty keeps the current ones
+   \return false if one of the names is unknown, the policy isn't changed then
+   */
+  static bool Set(const std::string& threadClass,
+                  const std::string& priority,
+                  const std::string& cores);
+
+  /*!
+   \brief Set the cpu topology the cores of the classes are resolved with
+   \param coreCount the number of cores
+   \param performanceCores ids of the fastest cores, empty if all are equally fast
+   */
+  static void SetTopology(int coreCount, const std::vector<int>& performanceCores);
+
+  //! Get the ids of the cores a class may run on, empty if it isn't restricted
+  static std::vector<int> GetCores(ThreadClass threadClass);
+
+  static const char* GetName(ThreadClass threadClass);
+
+  //! Format a set of core ids for the log
+  static std::string FormatCores(const std::vector<int>& cores);
+
+  //! Log the policy of every class
+  static void Log();
+};
@@ -0,0 +1,63 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "threads/FastCriticalSection.h"
+
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST(TestFastCriticalSection, TryLock)
+{
+  CFastCriticalSection section;
+  std::unique_lock lock(section);
+
+  bool locked = true;
+  std::thread([&section, &locked]() { locked = section.try_lock(); }).join();
+  EXPECT_FALSE(locked);
+
+  lock.unlock();
+  std::thread(
+      [&section, &locked]()
+      {
+        locked = section.try_lock();
+        if (locked)
+          section.unlock();
+      })
+      .join();
+  EXPECT_TRUE(locked);
+}
+
+TEST(TestFastCriticalSection, Contended)
+{
+  constexpr int THREADS = 4;
+  constexpr int INCREMENTS = 100000;
+
+  CFastCriticalSection section;
+  int counter = 0;
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < THREADS; ++i)
+  {
+    threads.emplace_back(
+        [&section, &counter]()
+        {
+          for (int j = 0; j < INCREMENTS; ++j)
+          {
+            std::unique_lock lock(section);
+            ++counter;
+          }
+        });
+  }
+  for (auto& thread : threads)
+    thread.join();
+
+  EXPECT_EQ(THREADS * INCREMENTS, counter);
+}
@@ -0,0 +1,60 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "threads/SeqLock.h"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+struct Values
+{
+  int64_t a{0};
+  int64_t b{0};
+  int32_t c{0};
+};
+} // namespace
+
+TEST(TestSeqLock, StoreAndUpdate)
+{
+  XbmcThreads::CSeqLock<Values> values({1, 2, 3});
+  EXPECT_EQ(2, values.Load().b);
+
+  values.Update([](Values& v) { v.c = 7; });
+  const Values loaded = values.Load();
+  EXPECT_EQ(1, loaded.a);
+  EXPECT_EQ(2, loaded.b);
+  EXPECT_EQ(7, loaded.c);
+}
+
+TEST(TestSeqLock, NoTornReads)
+{
+  XbmcThreads::CSeqLock<Values> values;
+  std::atomic<bool> stop{false};
+
+  std::thread writer(
+      [&values, &stop]()
+      {
+        for (int64_t i = 1; !stop; ++i)
+          values.Store({i, -i, static_cast<int32_t>(i)});
+      });
+
+  for (int i = 0; i < 100000; ++i)
+  {
+    const Values loaded = values.Load();
+    ASSERT_EQ(loaded.a, -loaded.b);
+    ASSERT_EQ(static_cast<int32_t>(loaded.a), loaded.c);
+  }
+
+  stop = true;
+  writer.join();
+}
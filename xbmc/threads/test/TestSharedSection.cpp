@@ -11,9 +11,12 @@
 #include "threads/SharedSection.h"
 #include "threads/test/TestHelpers.h"
 
+#include <atomic>
 #include <mutex>
 #include <shared_mutex>
 #include <stdio.h>
+#include <thread>
+#include <vector>
 
 using namespace std::chrono_literals;
 
@@ -213,3 +216,75 @@ TEST(TestMultipleSharedSection, General)
   }
 }
 
+
+TEST(TestSharedSection, RecursiveLocking)
+{
+  CSharedSection sec;
+
+  std::unique_lock<CSharedSection> l1(sec);
+  {
+    // the owner of the exclusive lock may take shared locks, and lock exclusively again meanwhile
+    std::shared_lock<CSharedSection> l2(sec);
+    std::unique_lock<CSharedSection> l3(sec);
+    EXPECT_TRUE(sec.try_lock_shared());
+    sec.unlock_shared();
+  }
+  l1.unlock();
+
+  // another thread can't get a lock while a shared lock is held
+  std::shared_lock<CSharedSection> l4(sec);
+  std::shared_lock<CSharedSection> l5(sec);
+  std::thread([&sec]() { EXPECT_FALSE(sec.try_lock()); }).join();
+  l4.unlock();
+  l5.unlock();
+  std::thread(
+      [&sec]()
+      {
+        EXPECT_TRUE(sec.try_lock());
+        sec.unlock();
+      })
+      .join();
+}
+
+TEST(TestSharedSection, ReadersAndWriters)
+{
+  constexpr int READERS = 8;
+  constexpr int ITERATIONS = 20000;
+
+  CSharedSection sec;
+  // both are only changed under the exclusive lock, readers must always see them equal
+  long first = 0;
+  long second = 0;
+  std::atomic<bool> consistent{true};
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < READERS; ++i)
+  {
+    threads.emplace_back(
+        [&]()
+        {
+          for (int j = 0; j < ITERATIONS; ++j)
+          {
+            std::shared_lock<CSharedSection> lock(sec);
+            if (first != second)
+              consistent = false;
+          }
+        });
+  }
+  threads.emplace_back(
+      [&]()
+      {
+        for (int j = 0; j < ITERATIONS / 10; ++j)
+        {
+          std::unique_lock<CSharedSection> lock(sec);
+          first++;
+          second++;
+        }
+      });
+
+  for (auto& worker : threads)
+    worker.join();
+
+  EXPECT_TRUE(consistent);
+  EXPECT_EQ(ITERATIONS / 10, first);
+}
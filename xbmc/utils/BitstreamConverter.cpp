@@ -18,6 +18,7 @@
 #include "HevcSei.h"
 
 #include <algorithm>
+#include <cstring>
 
 extern "C"
 {
@@ -189,43 +190,18 @@ static int nal_bs_read_ue(nal_bitstream *bs)
 
 static const uint8_t* avc_find_startcode_internal(const uint8_t *p, const uint8_t *end)
 {
-  const uint8_t *a = p + 4 - ((intptr_t)p & 3);
-
-  for (end -= 3; p < a && p < end; p++)
-  {
-    if (p[0] == 0 && p[1] == 0 && p[2] == 1)
-      return p;
-  }
-
-  for (end -= 3; p < end; p += 4)
-  {
-    uint32_t x = *(const uint32_t*)p;
-    if ((x - 0x01010101) & (~x) & 0x80808080) // generic
-    {
-      if (p[1] == 0)
-      {
-        if (p[0] == 0 && p[2] == 1)
-          return p;
-        if (p[2] == 0 && p[3] == 1)
-          return p+1;
-      }
-      if (p[3] == 0)
-      {
-        if (p[2] == 0 && p[4] == 1)
-          return p+2;
-        if (p[4] == 0 && p[5] == 1)
-          return p+3;
-      }
-    }
-  }
-
-  for (end += 3; p < end; p++)
+  // look for the 1 of a start code with memchr, which the C library vectorises, and check the
+  // zeros before it. The 1 of the next start code is at least 3 bytes further.
+  for (const uint8_t* one = p + 2; one < end; one += 3)
   {
-    if (p[0] == 0 && p[1] == 0 && p[2] == 1)
-      return p;
+    one = static_cast<const uint8_t*>(memchr(one, 1, end - one));
+    if (!one)
+      break;
+    if (one[-1] == 0 && one[-2] == 0)
+      return one - 2;
   }
 
-  return end + 3;
+  return end;
 }
 
 static const uint8_t* avc_find_startcode(const uint8_t *p, const uint8_t *end)
@@ -348,6 +324,7 @@ CBitstreamConverter::CBitstreamConverter()
   m_convert_bitstream = false;
   m_convertBuffer     = NULL;
   m_convertSize       = 0;
+  m_convertCapacity = 0;
   m_inputBuffer       = NULL;
   m_inputSize         = 0;
   m_to_annexb = false;
@@ -522,6 +499,7 @@ void CBitstreamConverter::Close(void)
   if (m_convertBuffer)
     av_free(m_convertBuffer), m_convertBuffer = NULL;
   m_convertSize = 0;
+  m_convertCapacity = 0;
 
   m_extraData = {};
 
@@ -535,11 +513,7 @@ void CBitstreamConverter::Close(void)
 
 bool CBitstreamConverter::Convert(uint8_t *pData, int iSize)
 {
-  if (m_convertBuffer)
-  {
-    av_free(m_convertBuffer);
-    m_convertBuffer = NULL;
-  }
+  // the output buffer is kept for the next packets, only its content is dropped
   m_inputSize = 0;
   m_convertSize = 0;
   m_inputBuffer = NULL;
@@ -557,23 +531,12 @@ bool CBitstreamConverter::Convert(uint8_t *pData, int iSize)
         if (m_convert_bitstream)
         {
           // convert demuxer packet from bitstream to bytestream (AnnexB)
-          int bytestream_size = 0;
-          uint8_t *bytestream_buff = NULL;
-
-          BitstreamConvert(demuxer_content, demuxer_bytes, &bytestream_buff, &bytestream_size);
-          if (bytestream_buff && (bytestream_size > 0))
-          {
-            m_convertSize   = bytestream_size;
-            m_convertBuffer = bytestream_buff;
+          if (BitstreamConvert(demuxer_content, demuxer_bytes) && m_convertSize > 0)
             return true;
-          }
-          else
-          {
-            m_convertSize = 0;
-            m_convertBuffer = NULL;
-            CLog::Log(LOGERROR, "CBitstreamConverter::Convert: error converting.");
-            return false;
-          }
+
+          m_convertSize = 0;
+          CLog::Log(LOGERROR, "CBitstreamConverter::Convert: error converting.");
+          return false;
         }
         else
         {
@@ -595,6 +558,7 @@ bool CBitstreamConverter::Convert(uint8_t *pData, int iSize)
             m_convertBuffer = NULL;
           }
           m_convertSize = 0;
+          m_convertCapacity = 0;
 
           // convert demuxer packet from bytestream (AnnexB) to bitstream
           AVIOContext *pb;
@@ -605,34 +569,26 @@ bool CBitstreamConverter::Convert(uint8_t *pData, int iSize)
           }
           m_convertSize = avc_parse_nal_units(pb, pData, iSize);
           m_convertSize = avio_close_dyn_buf(pb, &m_convertBuffer);
+          m_convertCapacity = m_convertSize;
         }
         else if (m_convert_3byteTo4byteNALSize)
         {
-          if(m_convertBuffer)
-          {
-            av_free(m_convertBuffer);
-            m_convertBuffer = NULL;
-          }
-          m_convertSize = 0;
-
-          // convert demuxer packet from 3 byte NAL sizes to 4 byte
-          AVIOContext *pb;
-          if (avio_open_dyn_buf(&pb) < 0)
+          // convert demuxer packet from 3 byte NAL sizes to 4 byte, one more byte per NAL
+          if (!ReserveConvertBuffer(iSize + iSize / 3))
             return false;
 
-          uint32_t nal_size;
-          uint8_t *end = pData + iSize;
-          uint8_t *nal_start = pData;
-          while (nal_start < end)
+          const uint8_t* end = pData + iSize;
+          const uint8_t* nal_start = pData;
+          while (nal_start + 3 <= end)
           {
-            nal_size = AV_RB24(nal_start);
-            avio_wb32(pb, nal_size);
+            const uint32_t nal_size =
+                std::min<uint32_t>(AV_RB24(nal_start), static_cast<uint32_t>(end - nal_start - 3));
             nal_start += 3;
-            avio_write(pb, nal_start, nal_size);
+            AV_WB32(m_convertBuffer + m_convertSize, nal_size);
+            memcpy(m_convertBuffer + m_convertSize + 4, nal_start, nal_size);
+            m_convertSize += nal_size + 4;
             nal_start += nal_size;
           }
-
-          m_convertSize = avio_close_dyn_buf(pb, &m_convertBuffer);
         }
         return true;
       }
@@ -645,7 +601,8 @@ bool CBitstreamConverter::Convert(uint8_t *pData, int iSize)
 
 uint8_t *CBitstreamConverter::GetConvertBuffer() const
 {
-  if((m_convert_bitstream || m_convert_bytestream || m_convert_3byteTo4byteNALSize) && m_convertBuffer != NULL)
+  if ((m_convert_bitstream || m_convert_bytestream || m_convert_3byteTo4byteNALSize) &&
+      m_convertSize > 0)
     return m_convertBuffer;
   else
     return m_inputBuffer;
@@ -653,7 +610,8 @@ uint8_t *CBitstreamConverter::GetConvertBuffer() const
 
 int CBitstreamConverter::GetConvertSize() const
 {
-  if((m_convert_bitstream || m_convert_bytestream || m_convert_3byteTo4byteNALSize) && m_convertBuffer != NULL)
+  if ((m_convert_bitstream || m_convert_bytestream || m_convert_3byteTo4byteNALSize) &&
+      m_convertSize > 0)
     return m_convertSize;
   else
     return m_inputSize;
@@ -897,7 +855,7 @@ bool CBitstreamConverter::IsSlice(uint8_t unit_type)
   }
 }
 
-bool CBitstreamConverter::BitstreamConvert(uint8_t* pData, int iSize, uint8_t **poutbuf, int *poutbuf_size)
+bool CBitstreamConverter::BitstreamConvert(uint8_t* pData, int iSize)
 {
   // based on h264_mp4toannexb_bsf.c (ffmpeg)
   // which is Copyright (c) 2007 Benoit Fouet <benoit.fouet@free.fr>
@@ -933,6 +891,11 @@ bool CBitstreamConverter::BitstreamConvert(uint8_t* pData, int iSize, uint8_t **
       return false;
   }
 
+  // start codes take as much room as 4 byte NAL sizes, usually the packet and the parameter sets
+  // fit in the buffer of the previous packets
+  if (!ReserveConvertBuffer(iSize + m_sps_pps_context.size))
+    return false;
+
   do
   {
     if (buf + m_sps_pps_context.length_size > buf_end)
@@ -964,8 +927,9 @@ bool CBitstreamConverter::BitstreamConvert(uint8_t* pData, int iSize, uint8_t **
     // prepend only to the first access unit of an IDR picture, if no sps/pps already present
     if (m_sps_pps_context.first_idr && IsIDR(unit_type) && !m_sps_pps_context.idr_sps_pps_seen)
     {
-      BitstreamAllocAndCopy(poutbuf, poutbuf_size, m_sps_pps_context.sps_pps_data,
-                            m_sps_pps_context.size, buf, nal_size, unit_type);
+      if (!BitstreamAppend(m_sps_pps_context.sps_pps_data, m_sps_pps_context.size, buf, nal_size,
+                           unit_type))
+        goto fail;
       m_sps_pps_context.first_idr = 0;
     }
     else
@@ -1026,9 +990,9 @@ bool CBitstreamConverter::BitstreamConvert(uint8_t* pData, int iSize, uint8_t **
         }
       }
 
+      bool appended = true;
       if (write_buf)
-        BitstreamAllocAndCopy(poutbuf, poutbuf_size, NULL, 0, buf_to_write, final_nal_size,
-                              unit_type);
+        appended = BitstreamAppend(NULL, 0, buf_to_write, final_nal_size, unit_type);
 
 #ifdef HAVE_LIBDOVI
       if (rpu_data)
@@ -1040,6 +1004,9 @@ bool CBitstreamConverter::BitstreamConvert(uint8_t* pData, int iSize, uint8_t **
 
       if (containsHdr10Plus && !finalPrefixSeiNalu.empty())
         finalPrefixSeiNalu.clear();
+
+      if (!appended)
+        goto fail;
     }
 
     buf += nal_size;
@@ -1049,58 +1016,71 @@ bool CBitstreamConverter::BitstreamConvert(uint8_t* pData, int iSize, uint8_t **
   return true;
 
 fail:
-  av_free(*poutbuf), *poutbuf = NULL;
-  *poutbuf_size = 0;
+  m_convertSize = 0;
   return false;
 }
 
-void CBitstreamConverter::BitstreamAllocAndCopy(uint8_t** poutbuf,
-                                                int* poutbuf_size,
-                                                const uint8_t* sps_pps,
-                                                uint32_t sps_pps_size,
-                                                const uint8_t* in,
-                                                uint32_t in_size,
-                                                uint8_t nal_type)
+bool CBitstreamConverter::ReserveConvertBuffer(int size)
+{
+  if (size <= m_convertCapacity)
+    return true;
+
+  // grow geometrically, a packet larger than the previous ones is likely followed by more
+  const int capacity = std::max(size, m_convertCapacity * 2);
+  void* tmp = av_realloc(m_convertBuffer, capacity + AV_INPUT_BUFFER_PADDING_SIZE);
+  if (!tmp)
+    return false;
+
+  m_convertBuffer = static_cast<uint8_t*>(tmp);
+  m_convertCapacity = capacity;
+  return true;
+}
+
+bool CBitstreamConverter::BitstreamAppend(const uint8_t* sps_pps,
+                                          uint32_t sps_pps_size,
+                                          const uint8_t* in,
+                                          uint32_t in_size,
+                                          uint8_t nal_type)
 {
   // based on h264_mp4toannexb_bsf.c (ffmpeg)
   // which is Copyright (c) 2007 Benoit Fouet <benoit.fouet@free.fr>
   // and Licensed GPL 2.1 or greater
 
-  uint32_t offset = *poutbuf_size;
+  uint32_t offset = m_convertSize;
   uint8_t nal_header_size = offset ? 3 : 4;
-  void *tmp;
 
   // According to x265, this type is always encoded with four-sized header
   // https://bitbucket.org/multicoreware/x265_git/src/4bf31dc15fb6d1f93d12ecf21fad5e695f0db5c0/source/encoder/nal.cpp#lines-100
   if (nal_type == HEVC_NAL_UNSPEC62)
     nal_header_size = 4;
 
-  *poutbuf_size += sps_pps_size + in_size + nal_header_size;
-  tmp = av_realloc(*poutbuf, *poutbuf_size);
-  if (!tmp)
-    return;
-  *poutbuf = (uint8_t*)tmp;
+  if (!ReserveConvertBuffer(m_convertSize + sps_pps_size + in_size + nal_header_size))
+    return false;
+  m_convertSize += sps_pps_size + in_size + nal_header_size;
+
+  uint8_t* out = m_convertBuffer + offset;
   if (sps_pps)
-    memcpy(*poutbuf + offset, sps_pps, sps_pps_size);
+    memcpy(out, sps_pps, sps_pps_size);
 
-  memcpy(*poutbuf + sps_pps_size + nal_header_size + offset, in, in_size);
+  memcpy(out + sps_pps_size + nal_header_size, in, in_size);
   if (!offset)
   {
-    AV_WB32(*poutbuf + sps_pps_size, 1);
+    AV_WB32(out + sps_pps_size, 1);
   }
   else if (nal_header_size == 4)
   {
-    (*poutbuf + offset + sps_pps_size)[0] = 0;
-    (*poutbuf + offset + sps_pps_size)[1] = 0;
-    (*poutbuf + offset + sps_pps_size)[2] = 0;
-    (*poutbuf + offset + sps_pps_size)[3] = 1;
+    (out + sps_pps_size)[0] = 0;
+    (out + sps_pps_size)[1] = 0;
+    (out + sps_pps_size)[2] = 0;
+    (out + sps_pps_size)[3] = 1;
   }
   else
   {
-    (*poutbuf + offset + sps_pps_size)[0] = 0;
-    (*poutbuf + offset + sps_pps_size)[1] = 0;
-    (*poutbuf + offset + sps_pps_size)[2] = 1;
+    (out + sps_pps_size)[0] = 0;
+    (out + sps_pps_size)[1] = 0;
+    (out + sps_pps_size)[2] = 1;
   }
+  return true;
 }
 
 int CBitstreamConverter::avc_parse_nal_units(AVIOContext *pb, const uint8_t *buf_in, int size)
@@ -114,14 +114,13 @@ protected:
   bool              IsSlice(uint8_t unit_type);
   bool              BitstreamConvertInitAVC(void *in_extradata, int in_extrasize);
   bool              BitstreamConvertInitHEVC(void *in_extradata, int in_extrasize);
-  bool              BitstreamConvert(uint8_t* pData, int iSize, uint8_t **poutbuf, int *poutbuf_size);
-  static void BitstreamAllocAndCopy(uint8_t** poutbuf,
-                                    int* poutbuf_size,
-                                    const uint8_t* sps_pps,
-                                    uint32_t sps_pps_size,
-                                    const uint8_t* in,
-                                    uint32_t in_size,
-                                    uint8_t nal_type);
+  bool BitstreamConvert(uint8_t* pData, int iSize);
+  bool ReserveConvertBuffer(int size);
+  bool BitstreamAppend(const uint8_t* sps_pps,
+                       uint32_t sps_pps_size,
+                       const uint8_t* in,
+                       uint32_t in_size,
+                       uint8_t nal_type);
 
   typedef struct omx_bitstream_ctx {
       uint8_t  length_size;
@@ -131,8 +130,10 @@ protected:
       uint32_t size;
   } omx_bitstream_ctx;
 
+  // kept across packets and only grown, converting doesn't allocate once it is large enough
   uint8_t          *m_convertBuffer;
   int               m_convertSize;
+  int m_convertCapacity;
   uint8_t          *m_inputBuffer;
   int               m_inputSize;
 
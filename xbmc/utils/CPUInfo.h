@@ -88,6 +88,11 @@ public:
 
   unsigned int GetCPUFeatures() const { return m_cpuFeatures; }
   int GetCPUCount() const { return m_cpuCount; }
+  /*!
+   * \brief Get the ids of the performance cores of a heterogeneous (big.LITTLE or hybrid) CPU.
+   * \return the core ids, empty if the cores aren't markedly different or it isn't known
+   */
+  const std::vector<int>& GetPerformanceCores() const { return m_performanceCores; }
   const std::string& GetCPUModel() const { return m_cpuModel; }
   const std::string& GetCPUBogoMips() const { return m_cpuBogoMips; }
   const std::string& GetCPUSoC() const { return m_cpuSoC; }
@@ -118,4 +123,5 @@ protected:
   unsigned int m_cpuFeatures{0};
 
   std::vector<CoreInfo> m_cores;
+  std::vector<int> m_performanceCores;
 };
@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <mutex>
+#include <type_traits>
 
 #include <fribidi.h>
 #include <iconv.h>
@@ -69,6 +70,12 @@
   #endif
 #endif
 
+/* wchar_t holds UTF-32 or UTF-16 code units, so UTF-8 <-> wide conversions don't need iconv */
+#if defined(WCHAR_IS_UCS_4) || defined(WCHAR_IS_UTF16) || \
+    (defined(__STDC_ISO_10646__) && !defined(WCHAR_IS_UCS_2))
+  #define WCHAR_IS_UNICODE 1
+#endif
+
 #define NO_ICONV ((iconv_t)-1)
 
 enum SpecialCharset
@@ -277,6 +284,12 @@ public:
 
   template<class INPUT,class OUTPUT>
   static bool stdConvert(StdConversionType convertType, const INPUT& strSource, OUTPUT& strDest, bool failOnInvalidChar = false);
+  template<class INPUT, class OUTPUT>
+  static bool directConvert(StdConversionType convertType,
+                            const INPUT& strSource,
+                            OUTPUT& strDest,
+                            bool failOnInvalidChar,
+                            bool& result);
   template<class INPUT,class OUTPUT>
   static bool customConvert(const std::string& sourceCharset, const std::string& targetCharset, const INPUT& strSource, OUTPUT& strDest, bool failOnInvalidChar = false);
 
@@ -326,12 +339,65 @@ bool CCharsetConverter::CInnerConverter::stdConvert(StdConversionType convertTyp
   if (convertType < 0 || convertType >= NumberOfStdConversionTypes)
     return false;
 
+  bool result;
+  if (directConvert(convertType, strSource, strDest, failOnInvalidChar, result))
+    return result;
+
   CConverterType& convType = m_stdConversion[convertType];
   std::unique_lock<CCriticalSection> converterLock(convType);
 
   return convert(convType.GetConverter(converterLock), convType.GetTargetSingleCharMaxLen(), strSource, strDest, failOnInvalidChar);
 }
 
+/* Conversions between UTF-8 and UTF-16/UTF-32 are done by CUtf8Utils, without iconv and the
+   converter lock. Returns false if the conversion must go through iconv. */
+template<class INPUT, class OUTPUT>
+bool CCharsetConverter::CInnerConverter::directConvert(StdConversionType convertType,
+                                                       const INPUT& strSource,
+                                                       OUTPUT& strDest,
+                                                       bool failOnInvalidChar,
+                                                       bool& result)
+{
+  using SrcChar = typename INPUT::value_type;
+  using DstChar = typename OUTPUT::value_type;
+
+  if constexpr (std::is_same_v<SrcChar, char> && !std::is_same_v<DstChar, char>)
+  {
+    if (convertType != Utf8ToUtf32 && convertType != Utf8toW)
+      return false;
+#if !defined(WCHAR_IS_UNICODE)
+    if constexpr (std::is_same_v<DstChar, wchar_t>)
+      return false;
+#endif
+#if defined(TARGET_DARWIN)
+    // UTF-8-MAC also composes decomposed sequences, leave anything but US-ASCII to iconv
+    if (CUtf8Utils::CountLeadingAscii(strSource.data(), strSource.size()) != strSource.size())
+      return false;
+#endif
+    result = CUtf8Utils::Utf8ToUnicode(strSource, strDest, failOnInvalidChar);
+    return true;
+  }
+
+  if constexpr (!std::is_same_v<SrcChar, char> && std::is_same_v<DstChar, char>)
+  {
+    if (convertType != Utf32ToUtf8 && convertType != WtoUtf8 && convertType != Utf16LEtoUtf8)
+      return false;
+#if !defined(WCHAR_IS_UNICODE)
+    if constexpr (std::is_same_v<SrcChar, wchar_t>)
+      return false;
+#endif
+#ifdef WORDS_BIGENDIAN
+    if (convertType == Utf16LEtoUtf8)
+      return false;
+#endif
+    result = CUtf8Utils::UnicodeToUtf8(std::basic_string_view<SrcChar>(strSource), strDest,
+                                       failOnInvalidChar);
+    return true;
+  }
+
+  return false;
+}
+
 template<class INPUT,class OUTPUT>
 bool CCharsetConverter::CInnerConverter::customConvert(const std::string& sourceCharset, const std::string& targetCharset, const INPUT& strSource, OUTPUT& strDest, bool failOnInvalidChar /*= false*/)
 {
@@ -706,6 +772,13 @@ bool CCharsetConverter::utf32ToW(const std::u32string& utf32StringSrc, std::wstr
   wStringDst.assign((const wchar_t*)utf32StringSrc.c_str(), utf32StringSrc.length());
   return true;
 #else // !WCHAR_IS_UCS_4
+#ifdef WCHAR_IS_UNICODE
+  if constexpr (sizeof(wchar_t) == sizeof(char32_t))
+  {
+    wStringDst.assign((const wchar_t*)utf32StringSrc.c_str(), utf32StringSrc.length());
+    return true;
+  }
+#endif // WCHAR_IS_UNICODE
   return CInnerConverter::stdConvert(Utf32ToW, utf32StringSrc, wStringDst, failOnBadChar);
 #endif // !WCHAR_IS_UCS_4
 }
@@ -0,0 +1,834 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ContainerTagReader.h"
+
+#include "filesystem/File.h"
+#include "utils/StringUtils.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdio>
+#include <iterator>
+#include <set>
+#include <span>
+
+using namespace XFILE;
+
+namespace
+{
+// metadata strings and atoms are small, anything larger is considered broken
+constexpr int64_t MAX_STRING_SIZE = 1024 * 1024;
+constexpr int64_t MAX_ATTACHMENT_SIZE = 64 * 1024 * 1024;
+// nesting depth of Matroska SimpleTags
+constexpr int MAX_TAG_DEPTH = 8;
+
+// An EBML element or an MP4 atom, start and end enclose the payload
+struct Element
+{
+  uint32_t id{0};
+  int64_t start{0};
+  int64_t end{0};
+
+  int64_t Size() const { return end - start; }
+};
+
+uint64_t ReadBigEndian(std::span<const uint8_t> bytes)
+{
+  uint64_t value = 0;
+  for (uint8_t byte : bytes)
+    value = (value << 8) | byte;
+  return value;
+}
+
+bool ReadBytes(CFile& file, void* buffer, int64_t size)
+{
+  if (size < 0)
+    return false;
+  return size == 0 || file.Read(buffer, static_cast<size_t>(size)) == static_cast<ssize_t>(size);
+}
+
+bool ReadString(CFile& file, int64_t size, std::string& value)
+{
+  if (size < 0 || size > MAX_STRING_SIZE)
+    return false;
+
+  value.resize(static_cast<size_t>(size));
+  if (!ReadBytes(file, value.data(), size))
+    return false;
+
+  // strings may be padded with zeros
+  const size_t end = value.find('\0');
+  if (end != std::string::npos)
+    value.erase(end);
+  return true;
+}
+
+bool ReadData(CFile& file, int64_t size, std::vector<uint8_t>& data)
+{
+  if (size <= 0 || size > MAX_ATTACHMENT_SIZE)
+    return false;
+
+  data.resize(static_cast<size_t>(size));
+  return ReadBytes(file, data.data(), size);
+}
+
+bool SeekTo(CFile& file, int64_t position)
+{
+  return file.GetPosition() == position || file.Seek(position, SEEK_SET) == position;
+}
+
+/*!
+ * \brief Call a function for every child of an element, with the file positioned at the start
+ * of the child's payload.
+ * \param readHeader reads the header of the child at the current position
+ * \param callback returns false to fail the iteration
+ */
+template<typename ReadHeader, typename Callback>
+bool ForEachChild(CFile& file, const Element& parent, ReadHeader readHeader, Callback callback)
+{
+  int64_t position = parent.start;
+  while (position < parent.end)
+  {
+    Element child;
+    if (!SeekTo(file, position) || !readHeader(file, parent.end, child) ||
+        child.end < child.start || child.end > parent.end || !callback(child))
+      return false;
+    position = child.end;
+  }
+  return true;
+}
+
+// ----------------------------------------------------------------------------------------------
+// Matroska, see https://www.matroska.org/technical/elements.html
+
+constexpr uint32_t EBML_HEADER = 0x1A45DFA3;
+constexpr uint32_t EBML_DOCTYPE = 0x4282;
+constexpr uint32_t MKV_SEGMENT = 0x18538067;
+constexpr uint32_t MKV_SEEKHEAD = 0x114D9B74;
+constexpr uint32_t MKV_SEEK = 0x4DBB;
+constexpr uint32_t MKV_SEEKID = 0x53AB;
+constexpr uint32_t MKV_SEEKPOSITION = 0x53AC;
+constexpr uint32_t MKV_INFO = 0x1549A966;
+constexpr uint32_t MKV_TITLE = 0x7BA9;
+constexpr uint32_t MKV_CLUSTER = 0x1F43B675;
+constexpr uint32_t MKV_ATTACHMENTS = 0x1941A469;
+constexpr uint32_t MKV_ATTACHEDFILE = 0x61A7;
+constexpr uint32_t MKV_FILENAME = 0x466E;
+constexpr uint32_t MKV_FILEMIMETYPE = 0x4660;
+constexpr uint32_t MKV_FILEDATA = 0x465C;
+constexpr uint32_t MKV_TAGS = 0x1254C367;
+constexpr uint32_t MKV_TAG = 0x7373;
+constexpr uint32_t MKV_TARGETS = 0x63C0;
+constexpr uint32_t MKV_TARGETTYPE = 0x63CA;
+constexpr uint32_t MKV_TAGTRACKUID = 0x63C5;
+constexpr uint32_t MKV_TAGCHAPTERUID = 0x63C4;
+constexpr uint32_t MKV_TAGATTACHMENTUID = 0x63C6;
+constexpr uint32_t MKV_SIMPLETAG = 0x67C8;
+constexpr uint32_t MKV_TAGNAME = 0x45A3;
+constexpr uint32_t MKV_TAGLANGUAGE = 0x447A;
+constexpr uint32_t MKV_TAGDEFAULT = 0x4484;
+constexpr uint32_t MKV_TAGSTRING = 0x4487;
+
+bool ReadVint(CFile& file, size_t maxLength, bool keepMarker, uint64_t& value, bool& unknown)
+{
+  uint8_t first;
+  if (!ReadBytes(file, &first, 1) || first == 0)
+    return false;
+
+  const size_t length = std::countl_zero(first) + 1;
+  if (length > maxLength)
+    return false;
+
+  std::array<uint8_t, 7> rest{};
+  if (!ReadBytes(file, rest.data(), length - 1))
+    return false;
+
+  const uint8_t mask = 0xFF >> length;
+  value = keepMarker ? first : first & mask;
+  unknown = (first & mask) == mask;
+  for (size_t i = 0; i < length - 1; ++i)
+  {
+    value = (value << 8) | rest[i];
+    unknown = unknown && rest[i] == 0xFF;
+  }
+  return true;
+}
+
+// elements of unknown size end with their parent
+bool ReadElementHeader(CFile& file, int64_t parentEnd, Element& element)
+{
+  uint64_t id;
+  uint64_t size;
+  bool unknown;
+  if (!ReadVint(file, 4, true, id, unknown) || !ReadVint(file, 8, false, size, unknown))
+    return false;
+
+  element.id = static_cast<uint32_t>(id);
+  element.start = file.GetPosition();
+  // the header of a child may not straddle the end of its parent
+  if (element.start < 0 || element.start > parentEnd)
+    return false;
+
+  // a size running past the parent is rejected by the caller, before anything is read, except
+  // for the segment of a truncated file
+  if (unknown)
+    element.end = parentEnd;
+  else if (size > static_cast<uint64_t>(INT64_MAX - element.start))
+    return false;
+  else
+    element.end = element.start + static_cast<int64_t>(size);
+  return true;
+}
+
+bool ReadUnsigned(CFile& file, const Element& element, uint64_t& value)
+{
+  std::array<uint8_t, 8> bytes;
+  if (element.Size() < 0 || element.Size() > static_cast<int64_t>(bytes.size()) ||
+      !ReadBytes(file, bytes.data(), element.Size()))
+    return false;
+
+  value = ReadBigEndian(std::span(bytes.data(), static_cast<size_t>(element.Size())));
+  return true;
+}
+
+bool IsKodiMetadata(const std::string& filename)
+{
+  return filename == "kodi-metadata" || filename == "kodi-override-metadata";
+}
+
+class CMatroskaReader
+{
+public:
+  explicit CMatroskaReader(CFile& file) : m_file(file) {}
+
+  bool Read(ContainerTags& tags)
+  {
+    const int64_t length = m_file.GetLength();
+    if (!SeekTo(m_file, 0))
+      return false;
+
+    Element header;
+    if (!ReadElementHeader(m_file, length, header) || header.id != EBML_HEADER ||
+        header.end > length)
+      return false;
+
+    std::string docType;
+    const auto readDocType = [this, &docType](const Element& child)
+    { return child.id != EBML_DOCTYPE || ReadString(m_file, child.Size(), docType); };
+    if (!ForEachChild(m_file, header, ReadElementHeader, readDocType) ||
+        (docType != "matroska" && docType != "webm"))
+      return false;
+
+    if (!SeekTo(m_file, header.end) || !ReadElementHeader(m_file, length, m_segment) ||
+        m_segment.id != MKV_SEGMENT)
+      return false;
+    // the size of a truncated file is smaller than its segment claims
+    m_segment.end = std::min(m_segment.end, length);
+
+    // read the top level elements up to the first cluster, these are usually the seek head and
+    // the info, the elements behind the clusters are found with the seek head
+    int64_t position = m_segment.start;
+    while (position < m_segment.end)
+    {
+      Element element;
+      if (!SeekTo(m_file, position) || !ReadElementHeader(m_file, m_segment.end, element))
+        return false;
+      if (element.id == MKV_CLUSTER)
+        break;
+      if (!ReadTopLevel(position, element))
+        return false;
+      position = element.end;
+    }
+
+    while (!m_pending.empty())
+    {
+      position = m_pending.back();
+      m_pending.pop_back();
+      if (m_read.contains(position))
+        continue;
+
+      Element element;
+      if (!SeekTo(m_file, position) || !ReadElementHeader(m_file, m_segment.end, element) ||
+          !ReadTopLevel(position, element))
+        return false;
+    }
+
+    // like FFmpeg, the global tags take precedence over the segment title
+    if (!m_title.empty())
+      tags.Set("title", m_title);
+    for (auto& [name, value] : m_tags.tags)
+      tags.Set(std::move(name), std::move(value));
+    std::ranges::move(m_tags.attachments, std::back_inserter(tags.attachments));
+    return true;
+  }
+
+private:
+  struct SimpleTag
+  {
+    std::string name;
+    std::string language{"und"};
+    std::string value;
+    bool isDefault{true};
+    std::vector<SimpleTag> children;
+  };
+
+  bool ReadTopLevel(int64_t position, const Element& element)
+  {
+    if (element.end > m_segment.end)
+      return false;
+
+    switch (element.id)
+    {
+      case MKV_SEEKHEAD:
+      case MKV_INFO:
+      case MKV_TAGS:
+      case MKV_ATTACHMENTS:
+        break;
+      default:
+        return true;
+    }
+
+    if (!m_read.insert(position).second)
+      return true;
+
+    const auto read = [this, &element](auto function)
+    { return ForEachChild(m_file, element, ReadElementHeader, function); };
+
+    switch (element.id)
+    {
+      case MKV_SEEKHEAD:
+        return read([this](const Element& child)
+                    { return child.id != MKV_SEEK || ReadSeek(child); });
+      case MKV_INFO:
+        return read([this](const Element& child)
+                    { return child.id != MKV_TITLE || ReadString(m_file, child.Size(), m_title); });
+      case MKV_TAGS:
+        return read([this](const Element& child)
+                    { return child.id != MKV_TAG || ReadTag(child); });
+      case MKV_ATTACHMENTS:
+        return read([this](const Element& child)
+                    { return child.id != MKV_ATTACHEDFILE || ReadAttachedFile(child); });
+    }
+    return true;
+  }
+
+  bool ReadSeek(const Element& seek)
+  {
+    uint64_t id = 0;
+    uint64_t position = 0;
+    bool hasPosition = false;
+    if (!ForEachChild(m_file, seek, ReadElementHeader,
+                      [this, &id, &position, &hasPosition](const Element& child)
+                      {
+                        if (child.id == MKV_SEEKID)
+                          return ReadUnsigned(m_file, child, id);
+                        if (child.id == MKV_SEEKPOSITION)
+                        {
+                          hasPosition = true;
+                          return ReadUnsigned(m_file, child, position);
+                        }
+                        return true;
+                      }))
+      return false;
+
+    if (hasPosition && position < static_cast<uint64_t>(m_segment.Size()) &&
+        (id == MKV_SEEKHEAD || id == MKV_INFO || id == MKV_TAGS || id == MKV_ATTACHMENTS))
+      m_pending.push_back(m_segment.start + static_cast<int64_t>(position));
+    return true;
+  }
+
+  bool ReadTag(const Element& tag)
+  {
+    std::string targetType;
+    bool global = true;
+    std::vector<SimpleTag> simpleTags;
+    if (!ForEachChild(
+            m_file, tag, ReadElementHeader,
+            [&](const Element& child)
+            {
+              if (child.id == MKV_SIMPLETAG)
+                return ReadSimpleTag(child, simpleTags.emplace_back(), 0);
+              if (child.id != MKV_TARGETS)
+                return true;
+
+              return ForEachChild(m_file, child, ReadElementHeader,
+                                  [&](const Element& target)
+                                  {
+                                    uint64_t uid = 0;
+                                    switch (target.id)
+                                    {
+                                      case MKV_TARGETTYPE:
+                                        return ReadString(m_file, target.Size(), targetType);
+                                      case MKV_TAGTRACKUID:
+                                      case MKV_TAGCHAPTERUID:
+                                      case MKV_TAGATTACHMENTUID:
+                                        if (!ReadUnsigned(m_file, target, uid))
+                                          return false;
+                                        // a uid of 0 targets everything
+                                        global = global && uid == 0;
+                                        return true;
+                                    }
+                                    return true;
+                                  });
+            }))
+      return false;
+
+    // tags of tracks, chapters and attachments aren't global
+    if (global)
+      AddSimpleTags(simpleTags, targetType);
+    return true;
+  }
+
+  bool ReadSimpleTag(const Element& element, SimpleTag& tag, int depth)
+  {
+    return ForEachChild(m_file, element, ReadElementHeader,
+                        [&](const Element& child)
+                        {
+                          uint64_t isDefault = 1;
+                          switch (child.id)
+                          {
+                            case MKV_TAGNAME:
+                              return ReadString(m_file, child.Size(), tag.name);
+                            case MKV_TAGLANGUAGE:
+                              return ReadString(m_file, child.Size(), tag.language);
+                            case MKV_TAGSTRING:
+                              return ReadString(m_file, child.Size(), tag.value);
+                            case MKV_TAGDEFAULT:
+                              if (!ReadUnsigned(m_file, child, isDefault))
+                                return false;
+                              tag.isDefault = isDefault != 0;
+                              return true;
+                            case MKV_SIMPLETAG:
+                              return depth >= MAX_TAG_DEPTH ||
+                                     ReadSimpleTag(child, tag.children.emplace_back(), depth + 1);
+                          }
+                          return true;
+                        });
+  }
+
+  // name the tags the way FFmpeg does: TARGETTYPE/PARENT/NAME, with -language appended for
+  // other languages than undefined
+  void AddSimpleTags(const std::vector<SimpleTag>& simpleTags, const std::string& prefix)
+  {
+    for (const SimpleTag& tag : simpleTags)
+    {
+      if (tag.name.empty())
+        continue;
+
+      std::string name = prefix.empty() ? tag.name : prefix + "/" + tag.name;
+      if (StringUtils::EqualsNoCase(name, "LEAD_PERFORMER"))
+        name = "performer";
+      else if (StringUtils::EqualsNoCase(name, "PART_NUMBER"))
+        name = "track";
+
+      const bool hasLanguage = !tag.language.empty() && tag.language != "und";
+      if (tag.isDefault || !hasLanguage)
+        AddSimpleTag(tag, name);
+      if (hasLanguage)
+        AddSimpleTag(tag, name + "-" + tag.language);
+    }
+  }
+
+  void AddSimpleTag(const SimpleTag& tag, const std::string& name)
+  {
+    if (!tag.value.empty())
+      m_tags.Set(name, tag.value);
+    AddSimpleTags(tag.children, name);
+  }
+
+  bool ReadAttachedFile(const Element& attachedFile)
+  {
+    ContainerAttachment attachment;
+    Element data;
+    if (!ForEachChild(m_file, attachedFile, ReadElementHeader,
+                      [this, &attachment, &data](const Element& child)
+                      {
+                        switch (child.id)
+                        {
+                          case MKV_FILENAME:
+                            return ReadString(m_file, child.Size(), attachment.filename);
+                          case MKV_FILEMIMETYPE:
+                            return ReadString(m_file, child.Size(), attachment.mimetype);
+                          case MKV_FILEDATA:
+                            data = child;
+                            return true;
+                        }
+                        return true;
+                      }))
+      return false;
+
+    // fonts and the like are of no interest, don't even read them
+    if (attachment.filename.empty() || attachment.mimetype.empty() ||
+        (!attachment.IsImage() && !IsKodiMetadata(attachment.filename)))
+      return true;
+
+    if (SeekTo(m_file, data.start) && ReadData(m_file, data.Size(), attachment.data))
+      m_tags.attachments.emplace_back(std::move(attachment));
+    return true;
+  }
+
+  CFile& m_file;
+  Element m_segment;
+  std::set<int64_t> m_read; //!< positions of the top level elements read already
+  std::vector<int64_t> m_pending; //!< positions of top level elements from the seek heads
+  std::string m_title;
+  ContainerTags m_tags;
+};
+
+// ----------------------------------------------------------------------------------------------
+// MP4, see https://developer.apple.com/documentation/quicktime-file-format
+
+constexpr uint32_t AtomId(char a, char b, char c, char d)
+{
+  return (static_cast<uint32_t>(static_cast<uint8_t>(a)) << 24) |
+         (static_cast<uint32_t>(static_cast<uint8_t>(b)) << 16) |
+         (static_cast<uint32_t>(static_cast<uint8_t>(c)) << 8) |
+         static_cast<uint32_t>(static_cast<uint8_t>(d));
+}
+
+constexpr uint32_t MP4_MOOV = AtomId('m', 'o', 'o', 'v');
+constexpr uint32_t MP4_UDTA = AtomId('u', 'd', 't', 'a');
+constexpr uint32_t MP4_META = AtomId('m', 'e', 't', 'a');
+constexpr uint32_t MP4_HDLR = AtomId('h', 'd', 'l', 'r');
+constexpr uint32_t MP4_ILST = AtomId('i', 'l', 's', 't');
+constexpr uint32_t MP4_DATA = AtomId('d', 'a', 't', 'a');
+constexpr uint32_t MP4_NAME = AtomId('n', 'a', 'm', 'e');
+constexpr uint32_t MP4_FREEFORM = AtomId('-', '-', '-', '-');
+constexpr uint32_t MP4_COVR = AtomId('c', 'o', 'v', 'r');
+
+// atoms a file can start with
+constexpr std::array<uint32_t, 8> MP4_FIRST_ATOMS = {
+    AtomId('f', 't', 'y', 'p'), MP4_MOOV, AtomId('m', 'd', 'a', 't'), AtomId('f', 'r', 'e', 'e'),
+    AtomId('s', 'k', 'i', 'p'), AtomId('w', 'i', 'd', 'e'), AtomId('p', 'd', 'i', 'n'),
+    AtomId('u', 'u', 'i', 'd')};
+
+// well known types of the data atom
+constexpr uint32_t DATA_UTF8 = 1;
+constexpr uint32_t DATA_JPEG = 13;
+constexpr uint32_t DATA_PNG = 14;
+constexpr uint32_t DATA_INTEGER = 21;
+constexpr uint32_t DATA_BMP = 27;
+
+enum class ItemType
+{
+  TEXT,
+  INTEGER,
+  INDEX, //!< number and count, like the track number
+};
+
+struct Item
+{
+  uint32_t id;
+  const char* name;
+  ItemType type{ItemType::TEXT};
+};
+
+// as named by FFmpeg's mov demuxer
+constexpr auto MP4_ITEMS = std::to_array<Item>({
+    {AtomId('\xA9', 'n', 'a', 'm'), "title"},
+    {AtomId('\xA9', 'A', 'R', 'T'), "artist"},
+    {AtomId('\xA9', 'a', 'u', 't'), "artist"},
+    {AtomId('a', 'A', 'R', 'T'), "album_artist"},
+    {AtomId('\xA9', 'a', 'l', 'b'), "album"},
+    {AtomId('\xA9', 'c', 'm', 't'), "comment"},
+    {AtomId('\xA9', 'i', 'n', 'f'), "comment"},
+    {AtomId('\xA9', 'c', 'o', 'm'), "composer"},
+    {AtomId('\xA9', 'w', 'r', 't'), "composer"},
+    {AtomId('c', 'p', 'r', 't'), "copyright"},
+    {AtomId('\xA9', 'c', 'p', 'y'), "copyright"},
+    {AtomId('\xA9', 'd', 'a', 'y'), "date"},
+    {AtomId('\xA9', 'd', 'i', 'r'), "director"},
+    {AtomId('\xA9', 'g', 'e', 'n'), "genre"},
+    {AtomId('\xA9', 'g', 'r', 'p'), "grouping"},
+    {AtomId('\xA9', 'l', 'y', 'r'), "lyrics"},
+    {AtomId('\xA9', 'p', 'r', 'd'), "producer"},
+    {AtomId('\xA9', 'P', 'R', 'D'), "producer"},
+    {AtomId('\xA9', 's', 't', '3'), "subtitle"},
+    {AtomId('\xA9', 't', 'o', 'o'), "encoder"},
+    {AtomId('\xA9', 's', 'w', 'r'), "encoder"},
+    {AtomId('\xA9', 'e', 'n', 'c'), "encoder"},
+    {AtomId('d', 'e', 's', 'c'), "description"},
+    {AtomId('l', 'd', 'e', 's'), "synopsis"},
+    {AtomId('k', 'e', 'y', 'w'), "keywords"},
+    {AtomId('t', 'v', 's', 'h'), "show"},
+    {AtomId('t', 'v', 'e', 'n'), "episode_id"},
+    {AtomId('t', 'v', 'n', 'n'), "network"},
+    {AtomId('t', 'v', 'e', 's'), "episode_sort", ItemType::INTEGER},
+    {AtomId('t', 'v', 's', 'n'), "season_number", ItemType::INTEGER},
+    {AtomId('t', 'r', 'k', 'n'), "track", ItemType::INDEX},
+    {AtomId('d', 'i', 's', 'k'), "disc", ItemType::INDEX},
+    {AtomId('s', 'o', 'n', 'm'), "sort_name"},
+    {AtomId('s', 'o', 'a', 'r'), "sort_artist"},
+    {AtomId('s', 'o', 'a', 'a'), "sort_album_artist"},
+    {AtomId('s', 'o', 'a', 'l'), "sort_album"},
+    {AtomId('s', 'o', 'c', 'o'), "sort_composer"},
+    {AtomId('s', 'o', 's', 'n'), "sort_show"},
+});
+
+bool ReadAtomHeader(CFile& file, int64_t parentEnd, Element& atom)
+{
+  const int64_t position = file.GetPosition();
+  std::array<uint8_t, 8> header;
+  if (position < 0 || !ReadBytes(file, header.data(), header.size()))
+    return false;
+
+  uint64_t size = ReadBigEndian(std::span(header).first(4));
+  atom.id = static_cast<uint32_t>(ReadBigEndian(std::span(header).last(4)));
+  atom.start = position + 8;
+  if (size == 1)
+  {
+    // 64 bit size
+    std::array<uint8_t, 8> largeSize;
+    if (!ReadBytes(file, largeSize.data(), largeSize.size()))
+      return false;
+    size = ReadBigEndian(largeSize);
+    atom.start += 8;
+  }
+  else if (size == 0)
+  {
+    // up to the end of the parent
+    size = static_cast<uint64_t>(parentEnd - position);
+  }
+
+  if (size < static_cast<uint64_t>(atom.start - position) ||
+      size > static_cast<uint64_t>(INT64_MAX - position))
+    return false;
+
+  atom.end = position + static_cast<int64_t>(size);
+  return true;
+}
+
+class CMp4Reader
+{
+public:
+  explicit CMp4Reader(CFile& file) : m_file(file) {}
+
+  bool Read(ContainerTags& tags)
+  {
+    const int64_t length = m_file.GetLength();
+    if (!SeekTo(m_file, 0))
+      return false;
+
+    // skip the top level atoms up to the movie atom, usually right after the file type atom
+    // or at the end of the file
+    int64_t position = 0;
+    while (position < length)
+    {
+      Element atom;
+      if (!SeekTo(m_file, position) || !ReadAtomHeader(m_file, length, atom) ||
+          (position == 0 && std::ranges::find(MP4_FIRST_ATOMS, atom.id) == MP4_FIRST_ATOMS.end()))
+        return false;
+
+      if (atom.id == MP4_MOOV)
+      {
+        if (atom.end > length)
+          return false;
+        return ForEachChild(m_file, atom, ReadAtomHeader,
+                            [this, &tags](const Element& child)
+                            {
+                              if (child.id == MP4_UDTA)
+                                return ReadUserData(child, tags);
+                              if (child.id == MP4_META)
+                                return ReadMeta(child, tags);
+                              return true;
+                            });
+      }
+      position = atom.end;
+    }
+    return false;
+  }
+
+private:
+  bool ReadUserData(const Element& udta, ContainerTags& tags)
+  {
+    return ForEachChild(m_file, udta, ReadAtomHeader,
+                        [this, &tags](const Element& child)
+                        {
+                          if (child.id == MP4_META)
+                            return ReadMeta(child, tags);
+                          if ((child.id >> 24) == 0xA9)
+                            return ReadQuickTimeString(child, tags);
+                          return true;
+                        });
+  }
+
+  bool ReadMeta(const Element& meta, ContainerTags& tags)
+  {
+    // the meta atom of MP4 has a version and flags, the one of QuickTime starts with the handler
+    std::array<uint8_t, 8> header;
+    if (meta.Size() < static_cast<int64_t>(header.size()) ||
+        !ReadBytes(m_file, header.data(), header.size()))
+      return true;
+
+    Element children = meta;
+    if (ReadBigEndian(std::span(header).last(4)) != MP4_HDLR)
+      children.start += 4;
+
+    return ForEachChild(m_file, children, ReadAtomHeader,
+                        [this, &tags](const Element& child)
+                        {
+                          return child.id != MP4_ILST ||
+                                 ForEachChild(m_file, child, ReadAtomHeader,
+                                              [this, &tags](const Element& item)
+                                              { return ReadItem(item, tags); });
+                        });
+  }
+
+  // a QuickTime user data text: 16 bit size, 16 bit language and the text
+  bool ReadQuickTimeString(const Element& atom, ContainerTags& tags)
+  {
+    const auto item = std::ranges::find(MP4_ITEMS, atom.id, &Item::id);
+    std::array<uint8_t, 8> header;
+    if (item == MP4_ITEMS.end() || atom.Size() < static_cast<int64_t>(header.size()) ||
+        !ReadBytes(m_file, header.data(), header.size()))
+      return true;
+
+    // iTunes style items are found here as well
+    if (ReadBigEndian(std::span(header).last(4)) == MP4_DATA)
+      return ReadItem(atom, tags);
+
+    const int64_t size = static_cast<int64_t>(ReadBigEndian(std::span(header).first(2)));
+    std::string value;
+    if (size > atom.Size() - 4 || !SeekTo(m_file, atom.start + 4) ||
+        !ReadString(m_file, size, value))
+      return true;
+
+    if (!value.empty())
+      tags.Set(item->name, std::move(value));
+    return true;
+  }
+
+  bool ReadItem(const Element& atom, ContainerTags& tags)
+  {
+    std::string name;
+    const Item* item = nullptr;
+    if (atom.id != MP4_FREEFORM && atom.id != MP4_COVR)
+    {
+      const auto it = std::ranges::find(MP4_ITEMS, atom.id, &Item::id);
+      if (it == MP4_ITEMS.end())
+        return true;
+      item = &*it;
+      name = item->name;
+    }
+
+    std::string value;
+    if (!ForEachChild(
+            m_file, atom, ReadAtomHeader,
+            [&](const Element& child)
+            {
+              // freeform items are named by their name atom
+              if (child.id == MP4_NAME && atom.id == MP4_FREEFORM)
+                return child.Size() < 4 || (SeekTo(m_file, child.start + 4) &&
+                                            ReadString(m_file, child.Size() - 4, name));
+
+              // the data atom starts with its type and locale
+              std::array<uint8_t, 8> header;
+              if (child.id != MP4_DATA || child.Size() < static_cast<int64_t>(header.size()))
+                return true;
+              if (!ReadBytes(m_file, header.data(), header.size()))
+                return false;
+              const uint32_t type =
+                  static_cast<uint32_t>(ReadBigEndian(std::span(header).subspan(1, 3)));
+              const int64_t size = child.Size() - static_cast<int64_t>(header.size());
+
+              if (atom.id == MP4_COVR)
+                return ReadCover(type, size, tags);
+              if (item && item->type == ItemType::INDEX)
+                return ReadIndex(size, value);
+              if (item && item->type == ItemType::INTEGER)
+                return ReadInteger(size, value);
+              if (type == DATA_UTF8)
+                return ReadString(m_file, size, value);
+              return true;
+            }))
+      return false;
+
+    if (!name.empty() && !value.empty())
+      tags.Set(std::move(name), std::move(value));
+    return true;
+  }
+
+  bool ReadCover(uint32_t type, int64_t size, ContainerTags& tags)
+  {
+    ContainerAttachment cover;
+    cover.filename = "cover";
+    if (type == DATA_JPEG)
+      cover.mimetype = "image/jpeg";
+    else if (type == DATA_PNG)
+      cover.mimetype = "image/png";
+    else if (type == DATA_BMP)
+      cover.mimetype = "image/bmp";
+    else
+      return true;
+
+    if (ReadData(m_file, size, cover.data))
+      tags.attachments.emplace_back(std::move(cover));
+    return true;
+  }
+
+  bool ReadIndex(int64_t size, std::string& value)
+  {
+    // reserved, number, count
+    std::array<uint8_t, 6> data;
+    if (size < static_cast<int64_t>(data.size()))
+      return true;
+    if (!ReadBytes(m_file, data.data(), data.size()))
+      return false;
+
+    const uint64_t number = ReadBigEndian(std::span(data).subspan(2, 2));
+    const uint64_t count = ReadBigEndian(std::span(data).subspan(4, 2));
+    value = count > 0 ? StringUtils::Format("{}/{}", number, count) : std::to_string(number);
+    return true;
+  }
+
+  bool ReadInteger(int64_t size, std::string& value)
+  {
+    std::array<uint8_t, 8> data;
+    if (size != 1 && size != 2 && size != 4 && size != 8)
+      return true;
+    if (!ReadBytes(m_file, data.data(), size))
+      return false;
+
+    // sign extend
+    const int shift = 64 - static_cast<int>(size) * 8;
+    const uint64_t raw = ReadBigEndian(std::span(data.data(), static_cast<size_t>(size)));
+    value = std::to_string(static_cast<int64_t>(raw << shift) >> shift);
+    return true;
+  }
+
+  CFile& m_file;
+};
+} // unnamed namespace
+
+const std::string* ContainerTags::Get(std::string_view name) const
+{
+  const auto it = std::ranges::find_if(tags, [name](const auto& tag)
+                                       { return StringUtils::EqualsNoCase(tag.first, name); });
+  return it != tags.end() ? &it->second : nullptr;
+}
+
+void ContainerTags::Set(std::string name, std::string value)
+{
+  const auto it = std::ranges::find_if(tags, [&name](const auto& tag)
+                                       { return StringUtils::EqualsNoCase(tag.first, name); });
+  if (it != tags.end())
+    tags.erase(it);
+  tags.emplace_back(std::move(name), std::move(value));
+}
+
+bool CContainerTagReader::ReadMatroska(CFile& file, ContainerTags& tags)
+{
+  return CMatroskaReader(file).Read(tags);
+}
+
+bool CContainerTagReader::ReadMp4(CFile& file, ContainerTags& tags)
+{
+  return CMp4Reader(file).Read(tags);
+}
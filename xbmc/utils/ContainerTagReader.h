@@ -0,0 +1,80 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace XFILE
+{
+class CFile;
+}
+
+struct ContainerAttachment
+{
+  std::string filename;
+  std::string mimetype;
+  std::vector<uint8_t> data;
+
+  bool IsImage() const { return mimetype.starts_with("image/"); }
+};
+
+struct ContainerTags
+{
+  //! global tags in file order, named the way FFmpeg names them, e.g. "title" for the ©nam atom
+  std::vector<std::pair<std::string, std::string>> tags;
+  std::vector<ContainerAttachment> attachments;
+
+  /*!
+   * \brief Get the value of a tag, the name is matched case insensitively like av_dict_get does.
+   * \return the value, nullptr if there is no such tag
+   */
+  const std::string* Get(std::string_view name) const;
+
+  /*!
+   * \brief Set a tag, replacing a tag with the same name (matched case insensitively).
+   */
+  void Set(std::string name, std::string value);
+};
+
+/*!
+ * \brief Reads the global tags and the embedded art of Matroska and MP4 files without probing
+ * the streams, only the elements and atoms holding metadata are read.
+ */
+class CContainerTagReader
+{
+public:
+  /*!
+   * \brief Read the Info title, the global Tags and the Attachments of a Matroska file. The
+   * SeekHead is used to find them, so usually only a few KB at the start and the end of the file
+   * are read.
+   *
+   * Attachments are only returned if they are images or Kodi metadata (kodi-metadata,
+   * kodi-override-metadata). Fonts and other attachments are skipped without being read.
+   * \param file the opened file
+   * \param tags [out] the tags and attachments
+   * \return false if this isn't a Matroska file or its structure is broken
+   */
+  static bool ReadMatroska(XFILE::CFile& file, ContainerTags& tags);
+
+  /*!
+   * \brief Read the QuickTime user data and the iTunes metadata (moov/udta and moov/meta) of an
+   * MP4 file. The top level atoms are skipped until the moov atom, and within it everything but
+   * the metadata.
+   *
+   * Cover art (covr) is returned as attachments named "cover".
+   * \param file the opened file
+   * \param tags [out] the tags and attachments
+   * \return false if this isn't an MP4 file or its structure is broken
+   */
+  static bool ReadMp4(XFILE::CFile& file, ContainerTags& tags);
+};
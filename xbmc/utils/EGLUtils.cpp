@@ -428,6 +428,14 @@ bool CEGLContextUtils::CreateContext(CEGLAttributesVec contextAttribs)
         reinterpret_cast<PFNEGLSETDAMAGEREGIONKHRPROC>(eglGetProcAddress("eglSetDamageRegionKHR"));
   }
 
+  // lets the compositor only redraw the parts of the surface which changed
+  if (CEGLUtils::HasExtension(m_eglDisplay, "EGL_KHR_swap_buffers_with_damage"))
+    m_eglSwapBuffersWithDamage = reinterpret_cast<PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC>(
+        eglGetProcAddress("eglSwapBuffersWithDamageKHR"));
+  else if (CEGLUtils::HasExtension(m_eglDisplay, "EGL_EXT_swap_buffers_with_damage"))
+    m_eglSwapBuffersWithDamage = reinterpret_cast<PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC>(
+        eglGetProcAddress("eglSwapBuffersWithDamageEXT"));
+
   return true;
 }
 
@@ -590,7 +598,17 @@ bool CEGLContextUtils::TrySwapBuffers()
     return false;
   }
 
-  return (eglSwapBuffers(m_eglDisplay, m_eglSurface) == EGL_TRUE);
+  // the damage only applies to the frame it was set for, without any the whole surface is
+  // presented
+  EGLBoolean result;
+  if (m_eglSwapBuffersWithDamage && !m_swapDamage.empty())
+    result = m_eglSwapBuffersWithDamage(m_eglDisplay, m_eglSurface, m_swapDamage.data(),
+                                        m_swapDamage.size() / 4);
+  else
+    result = eglSwapBuffers(m_eglDisplay, m_eglSurface);
+
+  m_swapDamage.clear();
+  return (result == EGL_TRUE);
 }
 
 bool CEGLContextUtils::BindTextureUploadContext()
@@ -641,13 +659,16 @@ bool CEGLContextUtils::HasContext()
 
 void CEGLContextUtils::SetDamagedRegions(const CDirtyRegionList& dirtyRegions)
 {
-  if (!m_partialUpdateSupport)
+  if (!m_partialUpdateSupport && !m_eglSwapBuffersWithDamage)
     return;
 
   using Rect = std::array<EGLint, 4>;
-  EGLBoolean damageRegionsResult = EGL_FALSE;
+  EGLBoolean damageRegionsResult = EGL_TRUE;
   if (dirtyRegions.empty())
   {
+    if (!m_partialUpdateSupport)
+      return;
+
     // add a single (empty) entry, otherwise the whole frame gets rendered
     static Rect zeroRect{};
     damageRegionsResult = m_eglSetDamageRegionKHR(m_eglDisplay, m_eglSurface, zeroRect.data(), 1);
@@ -671,8 +692,16 @@ void CEGLContextUtils::SetDamagedRegions(const CDirtyRegionList& dirtyRegions)
                        static_cast<EGLint>(std::round(region.Width())),
                        static_cast<EGLint>(std::round(region.Height()))});
     }
-    damageRegionsResult = m_eglSetDamageRegionKHR(
-        m_eglDisplay, m_eglSurface, reinterpret_cast<EGLint*>(rects.data()), rects.size());
+    if (m_partialUpdateSupport)
+      damageRegionsResult = m_eglSetDamageRegionKHR(
+          m_eglDisplay, m_eglSurface, reinterpret_cast<EGLint*>(rects.data()), rects.size());
+
+    if (m_eglSwapBuffersWithDamage)
+    {
+      m_swapDamage.clear();
+      for (const auto& rect : rects)
+        m_swapDamage.insert(m_swapDamage.end(), rect.begin(), rect.end());
+    }
   }
 
   if (damageRegionsResult != EGL_TRUE && !m_damageRegionError)
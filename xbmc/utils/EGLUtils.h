@@ -206,6 +206,11 @@ public:
   bool TrySwapBuffers();
   void SetDamagedRegions(const CDirtyRegionList& dirtyRegions);
   int GetBufferAge();
+  /*!
+   * \brief Whether the age of the back buffer is known, so that only the regions which changed
+   * since it was last presented have to be rendered again.
+   */
+  bool IsBufferAgeSupported() const { return m_bufferAgeSupport || m_partialUpdateSupport; }
   bool IsPlatformSupported() const;
   EGLint GetConfigAttrib(EGLint attribute) const;
 
@@ -244,6 +249,8 @@ private:
   mutable CCriticalSection m_textureUploadLock;
 
   PFNEGLSETDAMAGEREGIONKHRPROC m_eglSetDamageRegionKHR{nullptr};
+  PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC m_eglSwapBuffersWithDamage{nullptr};
+  std::vector<EGLint> m_swapDamage; /**< x, y, width, height of each rect for the next swap */
   bool m_partialUpdateSupport{false};
   bool m_bufferAgeSupport{false};
   bool m_damageRegionError{false};
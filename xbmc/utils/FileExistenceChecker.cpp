@@ -0,0 +1,234 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileExistenceChecker.h"
+
+#include "FileItem.h"
+#include "FileItemList.h"
+#include "filesystem/Directory.h"
+#include "filesystem/File.h"
+#include "utils/JSONVariantParser.h"
+#include "utils/JSONVariantWriter.h"
+#include "utils/URIUtils.h"
+#include "utils/Variant.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <future>
+#include <mutex>
+#include <unordered_set>
+
+using namespace XFILE;
+using namespace std::chrono_literals;
+
+namespace
+{
+// directories checked at the same time
+constexpr size_t MAX_WORKERS = 8;
+constexpr auto PROGRESS_INTERVAL = 100ms;
+constexpr auto CHECKPOINT_INTERVAL = 30s;
+// older checkpoints are ignored, the files may have changed too much since
+constexpr std::time_t MAX_CHECKPOINT_AGE = 24 * 60 * 60;
+} // namespace
+
+CFileExistenceChecker::CFileExistenceChecker(std::string checkpointFile, std::string scope)
+  : m_checkpointFile(std::move(checkpointFile)), m_scope(std::move(scope))
+{
+}
+
+void CFileExistenceChecker::AddFile(int id, const std::string& path)
+{
+  const auto [it, inserted] =
+      m_index.try_emplace(URIUtils::GetDirectory(path), m_directories.size());
+  if (inserted)
+    m_directories.emplace_back().path = it->first;
+
+  m_directories[it->second].files.emplace_back(id, path);
+  m_total++;
+}
+
+bool CFileExistenceChecker::Run(const std::function<bool(size_t checked, size_t total)>& progress)
+{
+  m_missing.clear();
+  LoadCheckpoint();
+
+  std::vector<size_t> pending;
+  for (size_t i = 0; i < m_directories.size(); ++i)
+  {
+    if (!m_directories[i].checked)
+      pending.emplace_back(i);
+  }
+
+  std::atomic<size_t> next{0};
+  std::atomic<bool> cancelled{false};
+  const auto worker = [this, &pending, &next, &cancelled]()
+  {
+    for (size_t i = next++; i < pending.size() && !cancelled; i = next++)
+    {
+      Directory& directory = m_directories[pending[i]];
+      CheckDirectory(directory);
+
+      std::unique_lock lock(m_section);
+      directory.checked = true;
+      m_checked += directory.files.size();
+    }
+  };
+
+  std::vector<std::future<void>> workers;
+  for (size_t i = 0; i < std::min(MAX_WORKERS, pending.size()); ++i)
+    workers.emplace_back(std::async(std::launch::async, worker));
+
+  auto lastCheckpoint = std::chrono::steady_clock::now();
+  for (const auto& result : workers)
+  {
+    while (result.wait_for(PROGRESS_INTERVAL) != std::future_status::ready)
+    {
+      if (progress && !cancelled)
+      {
+        size_t checked;
+        {
+          std::unique_lock lock(m_section);
+          checked = m_checked;
+        }
+        if (!progress(checked, m_total))
+          cancelled = true;
+      }
+
+      const auto now = std::chrono::steady_clock::now();
+      if (now - lastCheckpoint >= CHECKPOINT_INTERVAL)
+      {
+        SaveCheckpoint();
+        lastCheckpoint = now;
+      }
+    }
+  }
+
+  if (cancelled)
+  {
+    SaveCheckpoint();
+    return false;
+  }
+
+  for (const Directory& directory : m_directories)
+    m_missing.insert(m_missing.end(), directory.missing.begin(), directory.missing.end());
+  return true;
+}
+
+void CFileExistenceChecker::Finish()
+{
+  if (!m_checkpointFile.empty() && CFile::Exists(m_checkpointFile, false))
+    CFile::Delete(m_checkpointFile);
+}
+
+void CFileExistenceChecker::CheckDirectory(Directory& directory)
+{
+  CFileItemList items;
+  if (!CDirectory::GetDirectory(directory.path, items, "",
+                                DIR_FLAG_NO_FILE_DIRS | DIR_FLAG_NO_FILE_INFO))
+  {
+    // unreachable, don't wait on every single file of it to time out
+    for (const auto& [id, path] : directory.files)
+      directory.missing.emplace_back(id);
+    return;
+  }
+
+  std::unordered_set<std::string> listed;
+  listed.reserve(items.Size());
+  for (const auto& item : items)
+    listed.insert(item->GetPath());
+
+  // paths in the listing may be spelled differently (encoding, stacks, archives), so files not
+  // found in it are looked up directly before giving up on them
+  for (const auto& [id, path] : directory.files)
+  {
+    if (!listed.contains(path) && !CFile::Exists(path, false))
+      directory.missing.emplace_back(id);
+  }
+}
+
+void CFileExistenceChecker::LoadCheckpoint()
+{
+  if (m_checkpointFile.empty() || !CFile::Exists(m_checkpointFile, false))
+    return;
+
+  CFile file;
+  std::vector<uint8_t> buffer;
+  CVariant checkpoint;
+  if (file.LoadFile(m_checkpointFile, buffer) <= 0 ||
+      !CJSONVariantParser::Parse(std::string(buffer.begin(), buffer.end()), checkpoint))
+    return;
+
+  if (checkpoint["scope"].asString() != m_scope ||
+      std::time(nullptr) - checkpoint["time"].asInteger() > MAX_CHECKPOINT_AGE)
+    return;
+
+  size_t directories = 0;
+  const CVariant& checked = checkpoint["directories"];
+  for (auto entry = checked.begin_array(); entry != checked.end_array(); ++entry)
+  {
+    const auto it = m_index.find((*entry)["path"].asString());
+    if (it == m_index.end())
+      continue;
+
+    // only take over the files that are still to be checked
+    Directory& directory = m_directories[it->second];
+    std::unordered_set<int> ids;
+    for (const auto& [id, path] : directory.files)
+      ids.insert(id);
+    const CVariant& missing = (*entry)["missing"];
+    for (auto id = missing.begin_array(); id != missing.end_array(); ++id)
+    {
+      if (ids.contains(static_cast<int>(id->asInteger())))
+        directory.missing.emplace_back(static_cast<int>(id->asInteger()));
+    }
+
+    directory.checked = true;
+    m_checked += directory.files.size();
+    directories++;
+  }
+
+  CLog::Log(LOGINFO, "CFileExistenceChecker: resuming from {}, {} directories already checked",
+            m_checkpointFile, directories);
+}
+
+void CFileExistenceChecker::SaveCheckpoint() const
+{
+  if (m_checkpointFile.empty())
+    return;
+
+  CVariant checkpoint(CVariant::VariantTypeObject);
+  checkpoint["scope"] = m_scope;
+  checkpoint["time"] = static_cast<int64_t>(std::time(nullptr));
+  checkpoint["directories"] = CVariant(CVariant::VariantTypeArray);
+  {
+    std::unique_lock lock(m_section);
+    for (const Directory& directory : m_directories)
+    {
+      if (!directory.checked)
+        continue;
+
+      CVariant entry(CVariant::VariantTypeObject);
+      entry["path"] = directory.path;
+      entry["missing"] = CVariant(CVariant::VariantTypeArray);
+      for (int id : directory.missing)
+        entry["missing"].push_back(id);
+      checkpoint["directories"].push_back(entry);
+    }
+  }
+
+  std::string json;
+  CFile file;
+  if (!CJSONVariantWriter::Write(checkpoint, json, true) ||
+      !file.OpenForWrite(m_checkpointFile, true) ||
+      file.Write(json.data(), json.size()) != static_cast<ssize_t>(json.size()))
+    CLog::Log(LOGWARNING, "CFileExistenceChecker: unable to save checkpoint to {}",
+              m_checkpointFile);
+}
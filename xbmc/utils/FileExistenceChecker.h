@@ -0,0 +1,82 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <functional>
+#include <stddef.h>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/*!
+ \brief Finds which of a set of library files no longer exist, for cleaning the libraries.
+
+ Files are grouped by directory. Every directory is listed once and its files are looked up in the
+ listing, only files not found in it are stat'ed. Several directories are checked at the same time,
+ which is what matters on network shares where each request is a round trip.
+
+ Given a checkpoint file, the directories checked so far and the files found missing in them are
+ saved to it every now and then and when cancelled. A later run over the same scope skips those
+ directories, so an interrupted clean doesn't start from scratch. Call Finish() once the result
+ has been acted on to drop the checkpoint.
+ */
+class CFileExistenceChecker
+{
+public:
+  /*!
+   \param checkpointFile file to save the progress to, empty to not save it
+   \param scope identifies the set of files being checked, checkpoints of other scopes are ignored
+   */
+  CFileExistenceChecker(std::string checkpointFile, std::string scope);
+
+  void AddFile(int id, const std::string& path);
+
+  /*!
+   \brief Check all added files.
+   \param progress called on the calling thread with the number of files checked so far and the
+   total number of files, return false to cancel. May be empty.
+   \return false if cancelled, true otherwise
+   */
+  bool Run(const std::function<bool(size_t checked, size_t total)>& progress);
+
+  /*!
+   \brief Get the ids of the files found missing by Run().
+   */
+  const std::vector<int>& GetMissing() const { return m_missing; }
+
+  /*!
+   \brief Remove the checkpoint, to be called once the missing files have been dealt with.
+   */
+  void Finish();
+
+private:
+  struct Directory
+  {
+    std::string path;
+    std::vector<std::pair<int, std::string>> files;
+    std::vector<int> missing;
+    bool checked{false};
+  };
+
+  static void CheckDirectory(Directory& directory);
+  void LoadCheckpoint();
+  void SaveCheckpoint() const;
+
+  std::string m_checkpointFile;
+  std::string m_scope;
+  std::vector<Directory> m_directories;
+  std::unordered_map<std::string, size_t> m_index;
+  size_t m_total{0};
+  size_t m_checked{0};
+  std::vector<int> m_missing;
+  mutable CCriticalSection m_section;
+};
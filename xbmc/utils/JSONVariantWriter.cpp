@@ -8,78 +8,326 @@
 
 #include "JSONVariantWriter.h"
 
-#include "utils/Variant.h"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <stdint.h>
 
 #include <nlohmann/json.hpp>
 
-void InternalWrite(nlohmann::json& writer, const CVariant& value)
+namespace
 {
-  switch (value.type())
+// how much text is generated ahead of the reader at most, apart from a single long string
+constexpr size_t WRITE_AHEAD = 16 * 1024;
+
+// length of the UTF-8 sequence starting at str, 0 if it is not valid (same rules as nlohmann)
+size_t Utf8SequenceLength(const unsigned char* str, size_t length)
+{
+  const unsigned char lead = str[0];
+  size_t count;
+  uint32_t codepoint;
+  uint32_t minimum;
+  if (lead >= 0xC2 && lead <= 0xDF)
   {
-  case CVariant::VariantTypeInteger:
-    writer = value.asInteger();
-    break;
-  case CVariant::VariantTypeUnsignedInteger:
-    writer = value.asUnsignedInteger();
-    break;
-  case CVariant::VariantTypeDouble:
-    writer = value.asDouble();
-    break;
-  case CVariant::VariantTypeBoolean:
-    writer = value.asBoolean();
-    break;
-  case CVariant::VariantTypeString:
-    writer = std::string(value.c_str(), value.size());
-    break;
-  case CVariant::VariantTypeArray:
-    writer = nlohmann::json::array();
-
-    for (CVariant::const_iterator_array itr = value.begin_array(); itr != value.end_array(); ++itr)
-    {
-      nlohmann::json& o = writer.emplace_back();
-      InternalWrite(o, *itr);
-    }
+    count = 2;
+    codepoint = lead & 0x1F;
+    minimum = 0x80;
+  }
+  else if (lead >= 0xE0 && lead <= 0xEF)
+  {
+    count = 3;
+    codepoint = lead & 0x0F;
+    minimum = 0x800;
+  }
+  else if (lead >= 0xF0 && lead <= 0xF4)
+  {
+    count = 4;
+    codepoint = lead & 0x07;
+    minimum = 0x10000;
+  }
+  else
+    return 0;
 
-    break;
-  case CVariant::VariantTypeObject:
-    writer = nlohmann::json::object();
+  if (count > length)
+    return 0;
 
-    for (CVariant::const_iterator_map itr = value.begin_map(); itr != value.end_map(); ++itr)
-    {
-      nlohmann::json& o = writer[itr->first];
-      InternalWrite(o, itr->second);
-    }
+  for (size_t i = 1; i < count; ++i)
+  {
+    if ((str[i] & 0xC0) != 0x80)
+      return 0;
+    codepoint = (codepoint << 6) | (str[i] & 0x3F);
+  }
 
-    break;
+  // reject overlong encodings, surrogates and anything beyond the unicode range
+  if (codepoint < minimum || (codepoint >= 0xD800 && codepoint <= 0xDFFF) || codepoint > 0x10FFFF)
+    return 0;
 
-  case CVariant::VariantTypeConstNull:
-  case CVariant::VariantTypeNull:
-  default:
-    writer = nullptr;
-    break;
-  }
+  return count;
 }
+} // namespace
 
 bool CJSONVariantWriter::Write(const CVariant &value, std::string& output, bool compact)
 {
-  try
+  // serialize behind the current content so it survives a failure, and so that a caller reusing
+  // the same string doesn't have to allocate again
+  const size_t offset = output.size();
+  CJSONVariantStreamWriter writer(value, compact);
+  if (!writer.ReadAll(output))
   {
-    nlohmann::json json;
-    InternalWrite(json, value);
+    output.resize(offset);
+    return false;
+  }
 
-    if (compact)
+  output.erase(0, offset);
+  return true;
+}
+
+CJSONVariantStreamWriter::CJSONVariantStreamWriter(const CVariant& value, bool compact)
+  : m_root(value),
+    m_compact(compact),
+    m_out(&m_buffer)
+{
+}
+
+size_t CJSONVariantStreamWriter::Read(char* buffer, size_t size)
+{
+  if (m_offset >= m_buffer.size())
+  {
+    m_buffer.clear();
+    m_offset = 0;
+    Produce(std::max(size, WRITE_AHEAD));
+  }
+
+  if (m_failed)
+    return 0;
+
+  const size_t count = std::min(size, m_buffer.size() - m_offset);
+  m_buffer.copy(buffer, count, m_offset);
+  m_offset += count;
+  return count;
+}
+
+bool CJSONVariantStreamWriter::ReadAll(std::string& output)
+{
+  if (m_offset < m_buffer.size())
+    output.append(m_buffer, m_offset, std::string::npos);
+  m_buffer.clear();
+  m_offset = 0;
+
+  m_out = &output;
+  Produce(std::string::npos);
+  m_out = &m_buffer;
+
+  return !m_failed;
+}
+
+void CJSONVariantStreamWriter::Produce(size_t size)
+{
+  if (!m_started)
+  {
+    m_started = true;
+    OpenValue(m_root);
+  }
+
+  const size_t limit = size == std::string::npos ? size : m_out->size() + size;
+  while (!m_failed && !m_stack.empty() && m_out->size() < limit)
+  {
+    Frame& frame = m_stack.back();
+    if (frame.value->isArray())
     {
-      output = json.dump();
+      if (frame.array == frame.value->end_array())
+      {
+        CloseFrame();
+        continue;
+      }
+
+      WriteSeparator(frame);
+      // OpenValue() may grow the stack, so advance the iterator first
+      const CVariant& element = *frame.array++;
+      OpenValue(element);
     }
     else
     {
-      output = json.dump(1, '\t');
+      if (frame.map == frame.value->end_map())
+      {
+        CloseFrame();
+        continue;
+      }
+
+      WriteSeparator(frame);
+      const auto& [key, element] = *frame.map++;
+      if (!WriteString(key.c_str(), key.size()))
+        return;
+      m_out->append(m_compact ? ":" : ": ");
+      OpenValue(element);
     }
   }
-  catch (nlohmann::json::exception&)
+
+  if (m_stack.empty())
+    m_finished = true;
+}
+
+void CJSONVariantStreamWriter::OpenValue(const CVariant& value)
+{
+  switch (value.type())
   {
-    return false;
+    case CVariant::VariantTypeInteger:
+      WriteNumber(value.asInteger());
+      break;
+    case CVariant::VariantTypeUnsignedInteger:
+      WriteNumber(value.asUnsignedInteger());
+      break;
+    case CVariant::VariantTypeDouble:
+      WriteDouble(value.asDouble());
+      break;
+    case CVariant::VariantTypeBoolean:
+      m_out->append(value.asBoolean() ? "true" : "false");
+      break;
+    case CVariant::VariantTypeString:
+      WriteString(value.c_str(), value.size());
+      break;
+    case CVariant::VariantTypeArray:
+      if (value.empty())
+        m_out->append("[]");
+      else
+      {
+        m_out->push_back('[');
+        m_stack.push_back({&value, value.begin_array(), {}, true});
+      }
+      break;
+    case CVariant::VariantTypeObject:
+      if (value.empty())
+        m_out->append("{}");
+      else
+      {
+        m_out->push_back('{');
+        m_stack.push_back({&value, {}, value.begin_map(), true});
+      }
+      break;
+    case CVariant::VariantTypeConstNull:
+    case CVariant::VariantTypeNull:
+    default:
+      m_out->append("null");
+      break;
+  }
+}
+
+void CJSONVariantStreamWriter::CloseFrame()
+{
+  const bool isArray = m_stack.back().value->isArray();
+  m_stack.pop_back();
+
+  if (!m_compact)
+  {
+    m_out->push_back('\n');
+    WriteIndent(m_stack.size());
+  }
+  m_out->push_back(isArray ? ']' : '}');
+}
+
+void CJSONVariantStreamWriter::WriteSeparator(Frame& frame)
+{
+  if (!frame.first)
+    m_out->push_back(',');
+  frame.first = false;
+
+  if (!m_compact)
+  {
+    m_out->push_back('\n');
+    WriteIndent(m_stack.size());
+  }
+}
+
+template<typename T>
+void CJSONVariantStreamWriter::WriteNumber(T value)
+{
+  char buffer[24];
+  const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+  m_out->append(buffer, result.ptr - buffer);
+}
+
+void CJSONVariantStreamWriter::WriteDouble(double value)
+{
+  if (!std::isfinite(value))
+  {
+    m_out->append("null");
+    return;
   }
 
+  // use the same shortest round trip formatting as nlohmann::json::dump()
+  char buffer[64];
+  const char* end = nlohmann::detail::to_chars(buffer, buffer + sizeof(buffer), value);
+  m_out->append(buffer, end - buffer);
+}
+
+void CJSONVariantStreamWriter::WriteIndent(size_t depth)
+{
+  m_out->append(depth, '\t');
+}
+
+bool CJSONVariantStreamWriter::WriteString(const char* str, size_t length)
+{
+  static constexpr char HEX[] = "0123456789abcdef";
+  const auto* data = reinterpret_cast<const unsigned char*>(str);
+
+  m_out->push_back('"');
+  // characters which don't need escaping are copied in runs
+  size_t run = 0;
+  size_t i = 0;
+  while (i < length)
+  {
+    const unsigned char c = data[i];
+    if (c >= 0x80)
+    {
+      const size_t sequence = Utf8SequenceLength(data + i, length - i);
+      if (sequence == 0)
+      {
+        m_failed = true;
+        return false;
+      }
+      i += sequence;
+      continue;
+    }
+
+    if (c >= 0x20 && c != '"' && c != '\\')
+    {
+      ++i;
+      continue;
+    }
+
+    m_out->append(str + run, i - run);
+    switch (c)
+    {
+      case '"':
+        m_out->append("\\\"");
+        break;
+      case '\\':
+        m_out->append("\\\\");
+        break;
+      case '\b':
+        m_out->append("\\b");
+        break;
+      case '\f':
+        m_out->append("\\f");
+        break;
+      case '\n':
+        m_out->append("\\n");
+        break;
+      case '\r':
+        m_out->append("\\r");
+        break;
+      case '\t':
+        m_out->append("\\t");
+        break;
+      default:
+        m_out->append("\\u00");
+        m_out->push_back(HEX[c >> 4]);
+        m_out->push_back(HEX[c & 0x0F]);
+        break;
+    }
+    run = ++i;
+  }
+  m_out->append(str + run, length - run);
+  m_out->push_back('"');
   return true;
 }
@@ -8,14 +8,92 @@
 
 #pragma once
 
-#include <string>
+#include "utils/Variant.h"
 
-class CVariant;
+#include <stddef.h>
+#include <string>
+#include <vector>
 
 class CJSONVariantWriter
 {
 public:
   CJSONVariantWriter() = delete;
 
+  /*!
+   \brief Serialize a CVariant to JSON.
+   \param value the variant to serialize
+   \param output [out] the JSON document, left unchanged on failure. Its allocated capacity is
+   reused, so passing the same string for repeated calls avoids allocations.
+   \param compact whether to leave out all optional whitespace
+   \return true on success, false if a string is not valid UTF-8
+   */
   static bool Write(const CVariant &value, std::string& output, bool compact);
 };
+
+/*!
+ \brief Serializes a CVariant to JSON piece by piece.
+
+ Produces the same output as CJSONVariantWriter::Write() but only keeps a small buffer of
+ generated text around, so a large result can be sent out while it is being serialized instead
+ of building the whole document in memory first. The variant must stay alive and unchanged until
+ the writer is done.
+ */
+class CJSONVariantStreamWriter
+{
+public:
+  CJSONVariantStreamWriter(const CVariant& value, bool compact);
+
+  /*!
+   \brief Get the next part of the document.
+   \param buffer the buffer to fill
+   \param size the size of the buffer
+   \return the number of bytes written to buffer, 0 once the document is complete or failed
+   */
+  size_t Read(char* buffer, size_t size);
+
+  /*!
+   \brief Append the rest of the document to a string.
+   \param output the string to append to, only partially appended to on failure
+   \return false if serialization failed, true otherwise
+   */
+  bool ReadAll(std::string& output);
+
+  /*!
+   \brief Whether the whole document has been read or serialization failed.
+   */
+  bool IsDone() const { return m_failed || (m_finished && m_offset >= m_buffer.size()); }
+
+  /*!
+   \brief Whether serialization failed, e.g. because a string is not valid UTF-8.
+   */
+  bool HasFailed() const { return m_failed; }
+
+private:
+  struct Frame
+  {
+    const CVariant* value;
+    CVariant::const_iterator_array array;
+    CVariant::const_iterator_map map;
+    bool first;
+  };
+
+  void Produce(size_t size);
+  void OpenValue(const CVariant& value);
+  void CloseFrame();
+  void WriteSeparator(Frame& frame);
+  template<typename T>
+  void WriteNumber(T value);
+  void WriteDouble(double value);
+  void WriteIndent(size_t depth);
+  bool WriteString(const char* str, size_t length);
+
+  const CVariant& m_root;
+  const bool m_compact;
+  bool m_started = false;
+  bool m_finished = false;
+  bool m_failed = false;
+  std::vector<Frame> m_stack;
+  std::string m_buffer;
+  std::string* m_out; /**< where text is generated into, m_buffer unless in ReadAll() */
+  size_t m_offset = 0;
+};
@@ -27,6 +27,8 @@
 #include <cassert>
 #include <cstdlib>
 #include <inttypes.h>
+#include <mutex>
+#include <unordered_map>
 
 using namespace MUSIC_INFO;
 
@@ -106,11 +108,17 @@ using namespace MUSIC_INFO;
 
 #define MASK_CHARS "NSATBGYFLDIJRCKMEPHZOQUVXWabcdefhiprstuv"
 
+namespace
+{
+// number of parsed masks to keep, views only use a handful of them
+constexpr size_t MAX_COMPILED_MASKS = 64;
+} // namespace
+
 CLabelFormatter::CLabelFormatter(const std::string &mask, const std::string &mask2)
 {
   // assemble our label masks
-  AssembleMask(0, mask);
-  AssembleMask(1, mask2);
+  m_masks[0] = CompileMask(mask);
+  m_masks[1] = CompileMask(mask2);
   // save a bool for faster lookups
   m_hideFileExtensions = !CServiceBroker::GetSettingsComponent()->GetSettings()->GetBool(CSettings::SETTING_FILELISTS_SHOWEXTENSIONS);
 }
@@ -118,21 +126,28 @@ CLabelFormatter::CLabelFormatter(const std::string &mask, const std::string &mas
 std::string CLabelFormatter::GetContent(unsigned int label, const CFileItem *item) const
 {
   assert(label < 2);
-  assert(m_staticContent[label].size() == m_dynamicContent[label].size() + 1);
+  const std::vector<std::string>& staticContent = m_masks[label]->m_staticContent;
+  const std::vector<CMaskString>& dynamicContent = m_masks[label]->m_dynamicContent;
+  assert(staticContent.size() == dynamicContent.size() + 1);
 
-  if (!item) return "";
+  if (!item || dynamicContent.empty())
+    return "";
 
-  std::string strLabel, dynamicLeft, dynamicRight;
-  for (unsigned int i = 0; i < m_dynamicContent[label].size(); i++)
+  std::string strLabel;
+  bool hasLeft = false;
+  for (unsigned int i = 0; i < dynamicContent.size(); i++)
   {
-    dynamicRight = GetMaskContent(m_dynamicContent[label][i], item);
-    if ((i == 0 || !dynamicLeft.empty()) && !dynamicRight.empty())
-      strLabel += m_staticContent[label][i];
-    strLabel += dynamicRight;
-    dynamicLeft = dynamicRight;
+    const std::string value = GetMaskContent(dynamicContent[i], item);
+    if (!value.empty())
+    {
+      if (i == 0 || hasLeft)
+        strLabel += staticContent[i];
+      strLabel.append(dynamicContent[i].m_prefix).append(value).append(dynamicContent[i].m_postfix);
+    }
+    hasLeft = !value.empty();
   }
-  if (!dynamicLeft.empty())
-    strLabel += m_staticContent[label][m_dynamicContent[label].size()];
+  if (hasLeft)
+    strLabel += staticContent.back();
 
   return strLabel;
 }
@@ -393,33 +408,47 @@ std::string CLabelFormatter::GetMaskContent(const CMaskString &mask, const CFile
     value = item->GetLabel2();
     break;
   }
-  if (!value.empty())
-    return mask.m_prefix + value + mask.m_postfix;
-  return "";
+  return value;
 }
 
-void CLabelFormatter::SplitMask(unsigned int label, const std::string &mask)
+std::shared_ptr<const CLabelFormatter::CompiledMask> CLabelFormatter::CompileMask(
+    const std::string& mask)
+{
+  // lists are formatted again on every fill and sort, parse each mask only once
+  static std::mutex cacheMutex;
+  static std::unordered_map<std::string, std::shared_ptr<const CompiledMask>> cache;
+
+  std::unique_lock lock(cacheMutex);
+  const auto it = cache.find(mask);
+  if (it != cache.end())
+    return it->second;
+
+  auto compiled = std::make_shared<CompiledMask>();
+  AssembleMask(*compiled, mask);
+
+  if (cache.size() >= MAX_COMPILED_MASKS)
+    cache.clear();
+  cache.emplace(mask, compiled);
+  return compiled;
+}
+
+void CLabelFormatter::SplitMask(CompiledMask& compiled, const std::string& mask)
 {
-  assert(label < 2);
   CRegExp reg;
   reg.RegComp("%([" MASK_CHARS "])");
   std::string work(mask);
   int findStart = -1;
   while ((findStart = reg.RegFind(work.c_str())) >= 0)
   { // we've found a match
-    m_staticContent[label].push_back(work.substr(0, findStart));
-    m_dynamicContent[label].emplace_back("", reg.GetMatch(1)[0], "");
+    compiled.m_staticContent.push_back(work.substr(0, findStart));
+    compiled.m_dynamicContent.emplace_back("", reg.GetMatch(1)[0], "");
     work = work.substr(findStart + reg.GetFindLen());
   }
-  m_staticContent[label].push_back(work);
+  compiled.m_staticContent.push_back(work);
 }
 
-void CLabelFormatter::AssembleMask(unsigned int label, const std::string& mask)
+void CLabelFormatter::AssembleMask(CompiledMask& compiled, const std::string& mask)
 {
-  assert(label < 2);
-  m_staticContent[label].clear();
-  m_dynamicContent[label].clear();
-
   // we want to match [<prefix>%A<postfix]
   // but allow %%, %[, %] to be in the prefix and postfix.  Anything before the first [
   // could be a mask that's not surrounded with [], so pass to SplitMask.
@@ -430,29 +459,32 @@ void CLabelFormatter::AssembleMask(unsigned int label, const std::string& mask)
   while ((findStart = reg.RegFind(work.c_str())) >= 0)
   { // we've found a match for a pre/postfixed string
     // send anything
-    SplitMask(label, work.substr(0, findStart) + reg.GetMatch(1));
-    m_dynamicContent[label].emplace_back(reg.GetMatch(2), reg.GetMatch(4)[0], reg.GetMatch(5));
+    SplitMask(compiled, work.substr(0, findStart) + reg.GetMatch(1));
+    compiled.m_dynamicContent.emplace_back(reg.GetMatch(2), reg.GetMatch(4)[0], reg.GetMatch(5));
     work = work.substr(findStart + reg.GetFindLen());
   }
-  SplitMask(label, work);
-  assert(m_staticContent[label].size() == m_dynamicContent[label].size() + 1);
+  SplitMask(compiled, work);
+  assert(compiled.m_staticContent.size() == compiled.m_dynamicContent.size() + 1);
 }
 
 bool CLabelFormatter::FillMusicTag(const std::string &fileName, CMusicInfoTag *tag) const
 {
+  const std::vector<std::string>& staticContent = m_masks[0]->m_staticContent;
+  const std::vector<CMaskString>& dynamicContent = m_masks[0]->m_dynamicContent;
+
   // run through and find static content to split the string up
-  size_t pos1 = fileName.find(m_staticContent[0][0], 0);
+  size_t pos1 = fileName.find(staticContent[0], 0);
   if (pos1 == std::string::npos)
     return false;
-  for (unsigned int i = 1; i < m_staticContent[0].size(); i++)
+  for (unsigned int i = 1; i < staticContent.size(); i++)
   {
-    size_t pos2 = !m_staticContent[0][i].empty() ? fileName.find(m_staticContent[0][i], pos1)
-                                                 : fileName.size();
+    size_t pos2 = !staticContent[i].empty() ? fileName.find(staticContent[i], pos1)
+                                            : fileName.size();
     if (pos2 == std::string::npos)
       return false;
     // found static content - thus we have the dynamic content surrounded
-    FillMusicMaskContent(m_dynamicContent[0][i - 1].m_content, fileName.substr(pos1, pos2 - pos1), tag);
-    pos1 = pos2 + m_staticContent[0][i].size();
+    FillMusicMaskContent(dynamicContent[i - 1].m_content, fileName.substr(pos1, pos2 - pos1), tag);
+    pos1 = pos2 + staticContent[i].size();
   }
   return true;
 }
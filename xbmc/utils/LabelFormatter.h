@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -61,16 +62,23 @@ private:
     char m_content;
   };
 
+  // a parsed mask, m_staticContent surrounds each of m_dynamicContent
+  struct CompiledMask
+  {
+    std::vector<std::string> m_staticContent;
+    std::vector<CMaskString> m_dynamicContent;
+  };
+
   // functions for assembling the mask vectors
-  void AssembleMask(unsigned int label, const std::string &mask);
-  void SplitMask(unsigned int label, const std::string &mask);
+  static std::shared_ptr<const CompiledMask> CompileMask(const std::string& mask);
+  static void AssembleMask(CompiledMask& compiled, const std::string& mask);
+  static void SplitMask(CompiledMask& compiled, const std::string& mask);
 
   // functions for retrieving content based on our mask vectors
   std::string GetContent(unsigned int label, const CFileItem *item) const;
   std::string GetMaskContent(const CMaskString &mask, const CFileItem *item) const;
   void FillMusicMaskContent(const char mask, const std::string &value, MUSIC_INFO::CMusicInfoTag *tag) const;
 
-  std::vector<std::string>   m_staticContent[2];
-  std::vector<CMaskString>  m_dynamicContent[2];
+  std::shared_ptr<const CompiledMask> m_masks[2];
   bool                 m_hideFileExtensions;
 };
@@ -26,5 +26,11 @@ struct MemoryStatus
 void* AlignedMalloc(size_t s, size_t alignTo);
 void AlignedFree(void* p);
 void GetMemoryStatus(MemoryStatus* buffer);
+
+/*!
+ \brief Get the share of the last seconds tasks were stalled waiting for memory to be reclaimed
+ \return the share in percent, or -1 if the system doesn't report it
+ */
+int GetMemoryPressure();
 }
 }
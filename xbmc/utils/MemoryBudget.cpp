@@ -0,0 +1,186 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "MemoryBudget.h"
+
+#include "utils/MemUtils.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+using namespace std::chrono;
+
+namespace
+{
+// share of the physical memory the caches may use by default
+constexpr uint64_t DEFAULT_BUDGET_DIVISOR = 16;
+
+// how often the caches are checked if no pressure is signalled
+constexpr auto CHECK_INTERVAL = 2s;
+
+// share of time stalled on memory (psi avg10) considered moderate and critical pressure
+constexpr int MODERATE_PRESSURE = 10;
+constexpr int CRITICAL_PRESSURE = 40;
+
+struct Registry
+{
+  std::mutex mutex;
+  std::vector<IMemoryConsumer*> consumers;
+  size_t budget = 0;
+  steady_clock::time_point nextCheck;
+  std::atomic<MemoryPressure> signalled{MemoryPressure::NONE};
+  std::atomic<bool> checkNow{false};
+};
+
+Registry& GetRegistry()
+{
+  static Registry registry;
+  return registry;
+}
+
+const char* GetPressureName(MemoryPressure pressure)
+{
+  switch (pressure)
+  {
+    case MemoryPressure::MODERATE:
+      return "moderate";
+    case MemoryPressure::CRITICAL:
+      return "critical";
+    default:
+      return "none";
+  }
+}
+
+MemoryPressure ReadPressure()
+{
+  const int pressure = KODI::MEMORY::GetMemoryPressure();
+  if (pressure >= CRITICAL_PRESSURE)
+    return MemoryPressure::CRITICAL;
+  if (pressure >= MODERATE_PRESSURE)
+    return MemoryPressure::MODERATE;
+  return MemoryPressure::NONE;
+}
+
+size_t GetDefaultBudget()
+{
+  KODI::MEMORY::MemoryStatus status{};
+  KODI::MEMORY::GetMemoryStatus(&status);
+  return std::clamp<size_t>(status.totalPhys / DEFAULT_BUDGET_DIVISOR, CMemoryBudget::MIN_BUDGET,
+                            CMemoryBudget::MAX_BUDGET);
+}
+} // namespace
+
+void CMemoryBudget::Register(IMemoryConsumer* consumer)
+{
+  Registry& registry = GetRegistry();
+  std::unique_lock lock(registry.mutex);
+  registry.consumers.emplace_back(consumer);
+}
+
+void CMemoryBudget::Unregister(IMemoryConsumer* consumer)
+{
+  Registry& registry = GetRegistry();
+  std::unique_lock lock(registry.mutex);
+  std::erase(registry.consumers, consumer);
+}
+
+void CMemoryBudget::SetBudget(size_t bytes)
+{
+  Registry& registry = GetRegistry();
+  std::unique_lock lock(registry.mutex);
+  registry.budget = bytes;
+}
+
+size_t CMemoryBudget::GetBudget()
+{
+  Registry& registry = GetRegistry();
+  std::unique_lock lock(registry.mutex);
+  if (registry.budget == 0)
+    registry.budget = GetDefaultBudget();
+  return registry.budget;
+}
+
+size_t CMemoryBudget::GetUsage()
+{
+  Registry& registry = GetRegistry();
+  std::unique_lock lock(registry.mutex);
+  size_t usage = 0;
+  for (const IMemoryConsumer* consumer : registry.consumers)
+    usage += consumer->GetCacheSize();
+  return usage;
+}
+
+void CMemoryBudget::SignalPressure(MemoryPressure pressure)
+{
+  std::atomic<MemoryPressure>& signalled = GetRegistry().signalled;
+  MemoryPressure current = signalled.load();
+  while (current < pressure && !signalled.compare_exchange_weak(current, pressure))
+  {
+  }
+  GetRegistry().checkNow = true;
+}
+
+size_t CMemoryBudget::Process()
+{
+  const size_t budget = GetBudget();
+
+  Registry& registry = GetRegistry();
+  // consumers are only unregistered once they aren't called anymore
+  std::unique_lock lock(registry.mutex);
+
+  const auto now = steady_clock::now();
+  if (!registry.checkNow.exchange(false) && now < registry.nextCheck)
+    return 0;
+  const MemoryPressure signalled = registry.signalled.exchange(MemoryPressure::NONE);
+  registry.nextCheck = now + CHECK_INTERVAL;
+
+  const MemoryPressure pressure = std::max(signalled, ReadPressure());
+
+  size_t target = budget;
+  if (pressure == MemoryPressure::MODERATE)
+    target = budget / 2;
+  else if (pressure == MemoryPressure::CRITICAL)
+    target = 0;
+
+  std::vector<std::pair<size_t, IMemoryConsumer*>> usages;
+  usages.reserve(registry.consumers.size());
+  size_t usage = 0;
+  for (IMemoryConsumer* consumer : registry.consumers)
+  {
+    usages.emplace_back(consumer->GetCacheSize(), consumer);
+    usage += usages.back().first;
+  }
+  if (usage <= target)
+    return 0;
+
+  // the largest caches release first
+  std::ranges::sort(usages, std::ranges::greater{}, &std::pair<size_t, IMemoryConsumer*>::first);
+
+  size_t released = 0;
+  for (const auto& [consumerUsage, consumer] : usages)
+  {
+    if (usage - released <= target || consumerUsage == 0)
+      break;
+    const size_t bytes = consumer->ShrinkCache(usage - released - target, pressure);
+    CLog::Log(LOGDEBUG, "CMemoryBudget: {} released {} of {} bytes",
+              consumer->GetCacheName(), bytes, consumerUsage);
+    released += std::min(bytes, usage - released);
+  }
+
+  if (released > 0 || pressure != MemoryPressure::NONE)
+    CLog::Log(LOGINFO,
+              "CMemoryBudget: caches held {} bytes of a {} byte budget, pressure: {}, released {} "
+              "bytes",
+              usage, budget, GetPressureName(pressure), released);
+  return released;
+}
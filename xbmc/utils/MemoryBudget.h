@@ -0,0 +1,87 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+enum class MemoryPressure
+{
+  NONE,
+  MODERATE, //!< the system starts to stall reclaiming memory
+  CRITICAL, //!< the system is about to kill processes
+};
+
+/*!
+ \brief A cache whose memory can be released on demand
+ */
+class IMemoryConsumer
+{
+public:
+  virtual ~IMemoryConsumer() = default;
+
+  //! name of the cache in the log
+  virtual const char* GetCacheName() const = 0;
+
+  //! bytes held by the cache, estimated if they can't be counted exactly
+  virtual size_t GetCacheSize() const = 0;
+
+  /*!
+   \brief Release memory, least recently used first
+   \param bytes how much should be released, may be more than the cache holds
+   \param pressure the pressure the memory is released for, under CRITICAL a cache should also
+   drop what is expensive to restore
+   \return the bytes released
+   */
+  virtual size_t ShrinkCache(size_t bytes, MemoryPressure pressure) = 0;
+};
+
+/*!
+ \brief Memory budget shared by the caches.
+
+ Caches register as IMemoryConsumer. Process() is called periodically by the main thread; it
+ asks the largest caches to release memory while together they hold more than the budget, half
+ of it when the system reports moderate memory pressure and everything they can under critical
+ pressure. The pressure is read from the platform (PSI on Linux) or signalled with
+ SignalPressure(), e.g. by the low memory callback of Android.
+
+ The budget defaults to a share of the physical memory and can be set in advancedsettings.xml
+ as <cachememorybudget> in MiB.
+ */
+class CMemoryBudget
+{
+public:
+  //! Register a cache, it must be unregistered before it's destroyed
+  static void Register(IMemoryConsumer* consumer);
+  static void Unregister(IMemoryConsumer* consumer);
+
+  /*!
+   \brief Set the budget of the caches
+   \param bytes the budget, 0 for the default derived from the physical memory
+   */
+  static void SetBudget(size_t bytes);
+  static size_t GetBudget();
+
+  //! Get the bytes held by all registered caches
+  static size_t GetUsage();
+
+  /*!
+   \brief Report memory pressure, handled by the next Process(). Safe to call from any thread.
+   \param pressure the pressure, NONE just makes the next Process() check the budget
+   */
+  static void SignalPressure(MemoryPressure pressure);
+
+  /*!
+   \brief Release memory of the caches if they are over budget or the system is under pressure
+   \return the bytes released
+   */
+  static size_t Process();
+
+  static constexpr size_t MIN_BUDGET = 32 * 1024 * 1024;
+  static constexpr size_t MAX_BUDGET = 512 * 1024 * 1024;
+};
@@ -0,0 +1,49 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "RateLimiter.h"
+
+#include <algorithm>
+#include <mutex>
+#include <thread>
+
+void CRateLimiter::Acquire(const std::string& key, double rate, unsigned int burst)
+{
+  const Clock::duration wait = Reserve(key, rate, burst, Clock::now());
+  if (wait > Clock::duration::zero())
+    std::this_thread::sleep_for(wait);
+}
+
+CRateLimiter::Clock::duration CRateLimiter::Reserve(const std::string& key,
+                                                    double rate,
+                                                    unsigned int burst,
+                                                    Clock::time_point now)
+{
+  if (rate <= 0)
+    return Clock::duration::zero();
+
+  const double capacity = std::max(burst, 1u);
+
+  std::unique_lock lock(m_section);
+  Bucket& bucket = m_buckets.try_emplace(key, Bucket{capacity, now}).first->second;
+
+  // refill for the time passed, a negative balance is owed by requests already waiting
+  if (now > bucket.updated)
+  {
+    const double elapsed = std::chrono::duration<double>(now - bucket.updated).count();
+    bucket.tokens = std::min(capacity, bucket.tokens + elapsed * rate);
+    bucket.updated = now;
+  }
+
+  bucket.tokens -= 1;
+  if (bucket.tokens >= 0)
+    return Clock::duration::zero();
+
+  return std::chrono::duration_cast<Clock::duration>(
+      std::chrono::duration<double>(-bucket.tokens / rate));
+}
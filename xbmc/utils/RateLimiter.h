@@ -0,0 +1,55 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <chrono>
+#include <map>
+#include <string>
+
+/*!
+ \brief Token bucket rate limits for requests, kept separately per key (e.g. per host).
+
+ Every key has a bucket of burst tokens, refilled at rate tokens per second. A request takes a
+ token and has to wait while the bucket is empty. Requests waiting at the same time queue up
+ behind each other, so concurrent callers together stay within the rate.
+ */
+class CRateLimiter
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  /*!
+   \brief Take a token for a request, waiting for it if needed.
+   \param key the bucket to take the token from
+   \param rate tokens per second, 0 or less disables the limit
+   \param burst size of the bucket, at least one token
+   */
+  void Acquire(const std::string& key, double rate, unsigned int burst);
+
+  /*!
+   \brief Take a token for a request made at a given time.
+   \return how long the request has to wait for its token
+   */
+  Clock::duration Reserve(const std::string& key,
+                          double rate,
+                          unsigned int burst,
+                          Clock::time_point now);
+
+private:
+  struct Bucket
+  {
+    double tokens;
+    Clock::time_point updated;
+  };
+
+  std::map<std::string, Bucket> m_buckets;
+  CCriticalSection m_section;
+};
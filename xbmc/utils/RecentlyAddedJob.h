@@ -12,18 +12,26 @@
 
 enum ERecentlyAddedFlag
 {
-  Audio = 0x1,
-  Video = 0x2,
-  Totals = 0x4
+  LatestMovies = 0x1,
+  LatestEpisodes = 0x2,
+  LatestMusicVideos = 0x4,
+  LatestSongs = 0x8,
+  LatestAlbums = 0x10,
+  VideoTotals = 0x20,
+  MusicTotals = 0x40,
+
+  Audio = LatestSongs | LatestAlbums,
+  Video = LatestMovies | LatestEpisodes | LatestMusicVideos,
+  Totals = VideoTotals | MusicTotals
 };
 
 class CRecentlyAddedJob : public CJob
 {
 public:
   explicit CRecentlyAddedJob(int flag);
-  static bool UpdateVideo();
-  static bool UpdateMusic();
-  static bool UpdateTotal();
+  static bool UpdateVideo(int flag = Video);
+  static bool UpdateMusic(int flag = Audio);
+  static bool UpdateTotal(int flag = Totals);
   bool DoWork() override;
 private:
   int m_flag;
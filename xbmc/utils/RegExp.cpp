@@ -9,12 +9,113 @@
 #include "RegExp.h"
 
 #include "log.h"
+#include "threads/CriticalSection.h"
 #include "utils/StringUtils.h"
 #include "utils/Utf8Utils.h"
 
 #include <algorithm>
+#include <mutex>
 #include <stdlib.h>
 #include <string.h>
+#include <unordered_map>
+
+namespace
+{
+// patterns beyond this are compiled for the caller only, so user supplied expressions can't grow
+// the cache without bounds
+constexpr size_t MAX_CACHED_PATTERNS = 1024;
+
+struct PatternCache
+{
+  CCriticalSection lock;
+  std::unordered_map<std::string, std::shared_ptr<pcre2_code>> patterns;
+};
+
+PatternCache& GetPatternCache()
+{
+  static PatternCache cache;
+  return cache;
+}
+
+std::shared_ptr<pcre2_code> CompilePattern(const char* re, uint32_t options, bool jitCompile)
+{
+  int errCode;
+  PCRE2_SIZE errOffset;
+  pcre2_compile_context* ctxt = pcre2_compile_context_create(NULL);
+  pcre2_set_newline(ctxt, PCRE2_NEWLINE_ANY);
+  pcre2_code* code = pcre2_compile(reinterpret_cast<PCRE2_SPTR>(re), PCRE2_ZERO_TERMINATED,
+                                   options, &errCode, &errOffset, ctxt);
+  pcre2_compile_context_free(ctxt);
+
+  if (!code)
+  {
+    char errMsg[120];
+    pcre2_get_error_message(errCode, reinterpret_cast<PCRE2_UCHAR*>(errMsg), sizeof(errMsg));
+    CLog::Log(LOGERROR, "PCRE: {}. Compilation failed at offset {} in expression '{}'", errMsg,
+              errOffset, re);
+    return {};
+  }
+
+  // JIT compilation must be done before the code is shared, matching is thread safe afterwards
+  if (jitCompile)
+    pcre2_jit_compile(code, PCRE2_JIT_COMPLETE);
+
+  return std::shared_ptr<pcre2_code>(code, pcre2_code_free);
+}
+
+/*!
+ * Get the compiled code for the expression, compiling and JIT compiling it (if supported) only
+ * the first time it is requested with the given options.
+ */
+std::shared_ptr<pcre2_code> GetCompiledPattern(const char* re, uint32_t options, bool jitCompile)
+{
+  std::string key = std::to_string(options);
+  key += ':';
+  key += re;
+
+  PatternCache& cache = GetPatternCache();
+  std::unique_lock lock(cache.lock);
+  const auto it = cache.patterns.find(key);
+  if (it != cache.patterns.end())
+    return it->second;
+
+  if (cache.patterns.size() >= MAX_CACHED_PATTERNS)
+  {
+    lock.unlock();
+    return CompilePattern(re, options, jitCompile);
+  }
+
+  std::shared_ptr<pcre2_code> code = CompilePattern(re, options, CRegExp::IsJitSupported());
+  if (code)
+    cache.patterns.emplace(std::move(key), code);
+  return code;
+}
+
+// back-references, recursion and conditions refer to groups by number (or name) within one
+// pattern, they would point at the wrong group once patterns are combined into one expression
+bool ReferencesGroups(const std::string& pattern)
+{
+  for (size_t pos = pattern.find('\\'); pos != std::string::npos && pos + 1 < pattern.size();
+       pos = pattern.find('\\', pos + 2))
+  {
+    const char next = pattern[pos + 1];
+    if ((next >= '1' && next <= '9') || next == 'g' || next == 'k')
+      return true;
+  }
+
+  for (size_t pos = pattern.find("(?"); pos != std::string::npos && pos + 2 < pattern.size();
+       pos = pattern.find("(?", pos + 2))
+  {
+    const char next = pattern[pos + 2];
+    if ((next >= '0' && next <= '9') || next == 'R' || next == '+' || next == '-' ||
+        next == '&' || next == '(' || next == '|' || next == 'P')
+      return true;
+  }
+
+  // verbs like (*UTF) are only valid at the start of a pattern
+  return pattern.find("(*") != std::string::npos;
+}
+} // namespace
 
 int CRegExp::m_Utf8Supported = -1;
 int CRegExp::m_UcpSupported  = -1;
@@ -29,7 +130,7 @@ CRegExp::CRegExp(bool caseless /*= false*/, CRegExp::utf8Mode utf8 /*= asciiOnly
 void CRegExp::InitValues(bool caseless /*= false*/, CRegExp::utf8Mode utf8 /*= asciiOnly*/)
 {
   m_utf8Mode    = utf8;
-  m_re          = NULL;
+  m_re.reset();
   m_ctxt = nullptr;
   m_iOptions = PCRE2_DOTALL;
   if(caseless)
@@ -203,7 +304,6 @@ bool CRegExp::isCharClassWithUnicode(const std::string& regexp, size_t& pos)
 
 CRegExp::CRegExp(const CRegExp& re)
 {
-  m_re = NULL;
   m_ctxt = nullptr;
   m_matchData = nullptr;
   m_iOvector = nullptr;
@@ -215,28 +315,24 @@ CRegExp::CRegExp(const CRegExp& re)
 
 CRegExp& CRegExp::operator=(const CRegExp& re)
 {
-  size_t size;
+  if (this == &re)
+    return *this;
+
   Cleanup();
   m_jitCompiled = false;
   m_pattern = re.m_pattern;
+  m_utf8Mode = re.m_utf8Mode;
+  m_iOptions = re.m_iOptions;
   if (re.m_re)
   {
-    if (pcre2_pattern_info(re.m_re, PCRE2_INFO_SIZE, &size) >= 0)
-    {
-      if ((m_re = pcre2_code_copy(re.m_re)))
-      {
-        if (re.m_ctxt)
-          m_ctxt = pcre2_match_context_copy(re.m_ctxt);
-        m_iOvector = re.m_iOvector;
-        m_offset = re.m_offset;
-        m_iMatchCount = re.m_iMatchCount;
-        m_bMatched = re.m_bMatched;
-        m_subject = re.m_subject;
-        m_iOptions = re.m_iOptions;
-      }
-      else
-        CLog::Log(LOGFATAL, "{}: Failed to allocate memory", __FUNCTION__);
-    }
+    // compiled code is immutable and shared, the match context (with the JIT stack) is not
+    m_re = re.m_re;
+    m_jitCompiled = re.m_jitCompiled;
+    m_iOvector = re.m_iOvector;
+    m_offset = re.m_offset;
+    m_iMatchCount = re.m_iMatchCount;
+    m_bMatched = re.m_bMatched;
+    m_subject = re.m_subject;
   }
   return *this;
 }
@@ -255,10 +351,6 @@ bool CRegExp::RegComp(const char *re, studyMode study /*= NoStudy*/)
   m_jitCompiled      = false;
   m_bMatched         = false;
   m_iMatchCount      = 0;
-  pcre2_compile_context* ctxt;
-  int errCode;
-  char errMsg[120];
-  PCRE2_SIZE errOffset;
   uint32_t options = m_iOptions;
   if (m_utf8Mode == autoUtf8 && requireUtf8(re))
     options |=
@@ -266,33 +358,22 @@ bool CRegExp::RegComp(const char *re, studyMode study /*= NoStudy*/)
 
   Cleanup();
 
-  ctxt = pcre2_compile_context_create(NULL);
-  pcre2_set_newline(ctxt, PCRE2_NEWLINE_ANY);
-  m_re = pcre2_compile(reinterpret_cast<PCRE2_SPTR>(re), PCRE2_ZERO_TERMINATED, options, &errCode,
-                       &errOffset, ctxt);
-  pcre2_compile_context_free(ctxt);
-
+  m_re = GetCompiledPattern(re, options, study == StudyWithJitComp && IsJitSupported());
   if (!m_re)
   {
     m_pattern.clear();
-    pcre2_get_error_message(errCode, reinterpret_cast<PCRE2_UCHAR*>(errMsg), sizeof(errMsg));
-    CLog::Log(LOGERROR, "PCRE: {}. Compilation failed at offset {} in expression '{}'", errMsg,
-              errOffset, re);
     return false;
   }
 
   m_pattern = re;
 
-  if (study)
+  // shared code may be JIT compiled anyway, a dedicated (larger) JIT stack is only set up when
+  // it was asked for
+  if (study == StudyWithJitComp)
   {
-    const bool jitCompile = (study == StudyWithJitComp) && IsJitSupported();
-    if (jitCompile)
-    {
-      pcre2_jit_compile(m_re, PCRE2_JIT_COMPLETE);
-      size_t jitPresent = 0;
-      m_jitCompiled =
-          (pcre2_pattern_info(m_re, PCRE2_INFO_JITSIZE, &jitPresent) == 0 && jitPresent > 0);
-    }
+    size_t jitPresent = 0;
+    m_jitCompiled =
+        (pcre2_pattern_info(m_re.get(), PCRE2_INFO_JITSIZE, &jitPresent) == 0 && jitPresent > 0);
   }
 
   return true;
@@ -347,8 +428,13 @@ int CRegExp::PrivateRegFind(size_t bufferLen, const char *str, unsigned int star
   m_subject.assign(str + startoffset, bufferLen - startoffset);
   if (m_matchData == nullptr)
     m_matchData = pcre2_match_data_create(OVECCOUNT, nullptr);
-  int rc = pcre2_match(m_re, reinterpret_cast<PCRE2_SPTR>(m_subject.c_str()), m_subject.length(), 0,
+  int rc = pcre2_match(m_re.get(), reinterpret_cast<PCRE2_SPTR>(m_subject.c_str()), m_subject.length(), 0,
                        0, m_matchData, m_ctxt);
+  // JIT code runs on a small machine stack without a dedicated JIT stack, use the interpreter
+  // for subjects that need more
+  if (rc == PCRE2_ERROR_JIT_STACKLIMIT)
+    rc = pcre2_match(m_re.get(), reinterpret_cast<PCRE2_SPTR>(m_subject.c_str()),
+                     m_subject.length(), 0, PCRE2_NO_JIT, m_matchData, m_ctxt);
   m_iOvector = pcre2_get_ovector_pointer(m_matchData);
   offset = pcre2_get_startchar(m_matchData);
 
@@ -430,7 +516,7 @@ int CRegExp::GetCaptureTotal() const
 {
   int c = -1;
   if (m_re)
-    pcre2_pattern_info(m_re, PCRE2_INFO_CAPTURECOUNT, &c);
+    pcre2_pattern_info(m_re.get(), PCRE2_INFO_CAPTURECOUNT, &c);
   return c;
 }
 
@@ -533,11 +619,7 @@ void CRegExp::DumpOvector(int iLog /* = LOGDEBUG */)
 
 void CRegExp::Cleanup()
 {
-  if (m_re)
-  {
-    pcre2_code_free(m_re);
-    m_re = nullptr;
-  }
+  m_re.reset();
 
   if (m_ctxt)
   {
@@ -641,3 +723,60 @@ std::vector<CRegExp> CompileRegexes(const std::vector<std::string>& regExpPatter
   }
   return regExps;
 }
+
+CRegExpList::CRegExpList(const std::vector<std::string>& patterns,
+                         bool caseless,
+                         CRegExp::utf8Mode utf8)
+{
+  m_regExps.reserve(patterns.size());
+
+  std::string combined;
+  bool canCombine = true;
+  bool hasUtf8Patterns = false;
+  bool hasAsciiPatterns = false;
+  for (const auto& pattern : patterns)
+  {
+    CRegExp& regExp = m_regExps.emplace_back(caseless, utf8);
+    if (!regExp.RegComp(pattern, CRegExp::StudyWithJitComp))
+    {
+      CLog::LogF(LOGERROR, "Invalid RegExp:'{}'", pattern);
+      continue;
+    }
+
+    if (ReferencesGroups(pattern))
+      canCombine = false;
+    if (utf8 == CRegExp::autoUtf8)
+    {
+      if (CRegExp::requireUtf8(pattern))
+        hasUtf8Patterns = true;
+      else
+        hasAsciiPatterns = true;
+    }
+
+    if (!combined.empty())
+      combined += '|';
+    combined += "(?:";
+    combined += pattern;
+    combined += ')';
+  }
+
+  // the combined expression must be matched in the same (UTF-8 or byte) mode as every pattern
+  if (hasUtf8Patterns && hasAsciiPatterns)
+    canCombine = false;
+
+  // only worth it with more than one pattern, if combining fails each pattern is simply tried
+  if (canCombine && m_regExps.size() > 1 && !combined.empty())
+  {
+    m_combined = CRegExp(caseless, utf8);
+    if (!m_combined.RegComp(combined, CRegExp::StudyWithJitComp))
+      m_combined = CRegExp();
+  }
+}
+
+bool CRegExpList::MayMatch(const std::string& str)
+{
+  if (!m_combined.IsCompiled())
+    return true;
+
+  return m_combined.RegFind(str) >= 0;
+}
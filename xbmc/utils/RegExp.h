@@ -10,12 +10,18 @@
 
 //! @todo - move to std::regex (after switching to gcc 4.9 or higher) and get rid of CRegExp
 
+#include <memory>
 #include <string>
 #include <vector>
 
 #define PCRE2_CODE_UNIT_WIDTH 8
 #include <pcre2.h>
 
+/*!
+ * Compiled expressions are cached process wide by pattern and options and shared between CRegExp
+ * objects (copies included), so compiling the same expression again is a lookup. Cached
+ * expressions are JIT compiled when PCRE2 supports it.
+ */
 class CRegExp
 {
 public:
@@ -121,6 +127,8 @@ public:
   static bool IsJitSupported(void);
 
 private:
+  friend class CRegExpList;
+
   int PrivateRegFind(size_t bufferLen, const char *str, unsigned int startoffset = 0, int maxNumberOfCharsToTest = -1);
   void InitValues(bool caseless = false, CRegExp::utf8Mode utf8 = asciiOnly);
   static bool requireUtf8(const std::string& regexp);
@@ -130,7 +138,7 @@ private:
   void Cleanup();
   inline bool IsValidSubNumber(int iSub) const;
 
-  pcre2_code* m_re;
+  std::shared_ptr<pcre2_code> m_re;
   pcre2_match_context* m_ctxt;
   static const int OVECCOUNT=(m_MaxNumOfBackrefrences + 1) * 3;
   unsigned int m_offset;
@@ -150,3 +158,37 @@ private:
 };
 
 std::vector<CRegExp> CompileRegexes(const std::vector<std::string>& regExpPatterns);
+
+/*!
+ * A list of expressions which are tried on the same strings, like the clean string or TV show
+ * matching expressions from advanced settings. If the expressions can be combined into one
+ * alternation, MayMatch() rejects strings none of them match with a single scan.
+ */
+class CRegExpList
+{
+public:
+  CRegExpList() = default;
+  /**
+   * @param patterns the expressions, invalid ones are logged and never match
+   * @param caseless Matching will be case insensitive if set to true
+   * @param utf8 Control UTF-8 processing
+   */
+  CRegExpList(const std::vector<std::string>& patterns,
+              bool caseless,
+              CRegExp::utf8Mode utf8 = CRegExp::asciiOnly);
+
+  /**
+   * Check whether any of the expressions can match the string
+   * @return false if none of the expressions match, true if one may match
+   */
+  bool MayMatch(const std::string& str);
+
+  size_t size() const { return m_regExps.size(); }
+  CRegExp& operator[](size_t index) { return m_regExps[index]; }
+  std::vector<CRegExp>::iterator begin() { return m_regExps.begin(); }
+  std::vector<CRegExp>::iterator end() { return m_regExps.end(); }
+
+private:
+  std::vector<CRegExp> m_regExps;
+  CRegExp m_combined;
+};
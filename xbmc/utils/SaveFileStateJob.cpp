@@ -20,6 +20,7 @@
 #include "guilib/GUIMessage.h"
 #include "guilib/GUIWindowManager.h"
 #include "interfaces/AnnouncementManager.h"
+#include "jobs/JobQueue.h"
 #include "log.h"
 #include "music/MusicDatabase.h"
 #include "music/MusicFileItemClassify.h"
@@ -27,14 +28,99 @@
 #include "network/upnp/UPnP.h"
 #include "pvr/PVRManager.h"
 #include "pvr/guilib/PVRGUIActionsRecordings.h"
+#include "threads/CriticalSection.h"
 #include "utils/Variant.h"
 #include "video/Bookmark.h"
 #include "video/VideoDatabase.h"
 #include "video/VideoFileItemClassify.h"
 
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <mutex>
+
 using namespace KODI;
 using namespace KODI::VIDEO;
 
+namespace
+{
+class CSaveFileStateQueue
+{
+public:
+  static CSaveFileStateQueue& GetInstance()
+  {
+    static CSaveFileStateQueue queue;
+    return queue;
+  }
+
+  void Queue(const CFileItem& item, const CBookmark& bookmark, bool updatePlayCount)
+  {
+    std::unique_lock lock(m_section);
+
+    const auto it = std::ranges::find_if(m_pending, [&item](const PendingState& state)
+                                         { return state.item->IsSamePath(&item); });
+    if (it != m_pending.end() && !it->updatePlayCount)
+    {
+      // the job serving the pending state will write this one instead
+      *it->item = item;
+      it->bookmark = bookmark;
+      it->updatePlayCount = updatePlayCount;
+      return;
+    }
+
+    m_pending.emplace_back(std::make_unique<CFileItem>(item), bookmark, updatePlayCount);
+    m_jobs.Submit([this] { WriteNext(); });
+  }
+
+  void Flush()
+  {
+    // write what is still queued right here, this also waits for a write in progress
+    while (WriteNext())
+      ;
+  }
+
+private:
+  struct PendingState
+  {
+    std::unique_ptr<CFileItem> item;
+    CBookmark bookmark;
+    bool updatePlayCount;
+  };
+
+  bool WriteNext()
+  {
+    std::unique_lock writeLock(m_writeSection);
+
+    PendingState state;
+    {
+      std::unique_lock lock(m_section);
+      if (m_pending.empty())
+        return false;
+      state = std::move(m_pending.front());
+      m_pending.pop_front();
+    }
+
+    CSaveFileState::DoWork(*state.item, state.bookmark, state.updatePlayCount);
+    return true;
+  }
+
+  CCriticalSection m_section;
+  CCriticalSection m_writeSection; // held while a state is written, keeps them in order
+  std::deque<PendingState> m_pending;
+  CJobQueue m_jobs{false, 1, CJob::PRIORITY_NORMAL};
+};
+} // namespace
+
+void CSaveFileState::Queue(const CFileItem& item, const CBookmark& bookmark, bool updatePlayCount)
+{
+  CSaveFileStateQueue::GetInstance().Queue(item, bookmark, updatePlayCount);
+}
+
+void CSaveFileState::Flush()
+{
+  CSaveFileStateQueue::GetInstance().Flush();
+}
+
 void CSaveFileState::DoWork(CFileItem& item,
                             CBookmark& bookmark,
                             bool updatePlayCount)
@@ -242,8 +328,9 @@ void CSaveFileState::DoWork(CFileItem& item,
 
           // Could be part of an ISO stack. In this case the bookmark is saved onto the part.
           // In order to properly update the list, we need to refresh the stack's resume point
-          const auto& components = CServiceBroker::GetAppComponents();
+          auto& components = CServiceBroker::GetAppComponents();
           const auto stackHelper = components.GetComponent<CApplicationStackHelper>();
+          std::unique_lock stackLock(stackHelper->m_critSection);
           if (stackHelper->HasRegisteredStack(item) &&
               stackHelper->GetRegisteredStackTotalTimeMs(item) == 0)
             videodatabase.GetResumePoint(*(msgItem->GetVideoInfoTag()));
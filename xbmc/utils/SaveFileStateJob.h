@@ -17,5 +17,19 @@ public:
   static void DoWork(CFileItem& item,
                      CBookmark& bookmark,
                      bool updatePlayCount);
+
+  /*!
+   \brief Save the file state in the background.
+   States are written one at a time in the order they were queued. A state replaces a still
+   pending one for the same file unless the pending one marks the file as played.
+   */
+  static void Queue(const CFileItem& item, const CBookmark& bookmark, bool updatePlayCount);
+
+  /*!
+   \brief Write all queued file states and wait until they are stored.
+   Must be called before anything relying on the stored state, for example looking up the
+   resume point of the next file or shutting down.
+   */
+  static void Flush();
 };
 
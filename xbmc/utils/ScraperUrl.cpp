@@ -14,11 +14,13 @@
 #include "URL.h"
 #include "XMLUtils.h"
 #include "filesystem/CurlFile.h"
+#include "filesystem/HttpCache.h"
 #include "filesystem/ZipFile.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/CharsetDetection.h"
 #include "utils/Mime.h"
+#include "utils/RateLimiter.h"
 #include "utils/StringUtils.h"
 #include "utils/XBMCTinyXML.h"
 #include "utils/log.h"
@@ -27,6 +29,27 @@
 #include <cstring>
 #include <sstream>
 
+namespace
+{
+CRateLimiter requestLimiter;
+
+// keep scanners fetching concurrently from flooding a site, requests served by the http cache
+// don't count
+void WaitForRequest(const CURL& url, bool post)
+{
+  const auto settings = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+  if (settings->m_scraperRequestsPerSecond <= 0)
+    return;
+
+  XFILE::CHttpCache::Entry entry;
+  if (!post && XFILE::CHttpCache::Lookup(url.Get(), entry) && entry.IsFresh())
+    return;
+
+  requestLimiter.Acquire(url.GetHostName(), settings->m_scraperRequestsPerSecond,
+                         settings->m_scraperRequestBurst);
+}
+} // namespace
+
 CScraperUrl::CScraperUrl() : m_relevance(0.0), m_parsed(false)
 {
 }
@@ -304,6 +327,8 @@ bool CScraperUrl::Get(const SUrlEntry& scrURL,
 {
   CURL url(scrURL.m_url);
   http.SetReferer(scrURL.m_spoof);
+  // rescans and refreshes request the same urls over and over, spare the sites and rate limits
+  http.SetUseHttpCache(true);
   std::string strCachePath;
 
   if (!scrURL.m_cache.empty())
@@ -325,6 +350,7 @@ bool CScraperUrl::Get(const SUrlEntry& scrURL,
 
   auto strHTML1 = strHTML;
 
+  WaitForRequest(url, scrURL.m_post);
   if (scrURL.m_post)
   {
     std::string strOptions = url.GetOptions();
@@ -509,131 +509,94 @@ std::string ByBPM(SortAttribute attributes, const SortItem& values)
                              ByLabel(attributes, values));
 }
 
-bool preliminarySort(const SortItem &left, const SortItem &right, bool handleFolder, bool &result, std::wstring &labelLeft, std::wstring &labelRight)
+namespace
 {
-  // make sure both items have the necessary data to do the sorting
-  SortItem::const_iterator itLeftSort, itRightSort;
-  if ((itLeftSort = left.find(FieldSort)) == left.end())
-  {
-    result = false;
-    return true;
-  }
-  if ((itRightSort = right.find(FieldSort)) == right.end())
-  {
-    result = true;
-    return true;
-  }
-
-  // look at special sorting behaviour
-  SortItem::const_iterator itLeft, itRight;
-  SortSpecial leftSortSpecial = SortSpecialNone;
-  SortSpecial rightSortSpecial = SortSpecialNone;
-  if ((itLeft = left.find(FieldSortSpecial)) != left.end() && itLeft->second.asInteger() <= (int64_t)SortSpecialOnBottom)
-    leftSortSpecial = (SortSpecial)itLeft->second.asInteger();
-  if ((itRight = right.find(FieldSortSpecial)) != right.end() && itRight->second.asInteger() <= (int64_t)SortSpecialOnBottom)
-    rightSortSpecial = (SortSpecial)itRight->second.asInteger();
-
-  // one has a special sort
-  if (leftSortSpecial != rightSortSpecial)
-  {
-    // left should be sorted on top
-    // or right should be sorted on bottom
-    // => left is sorted above right
-    if (leftSortSpecial == SortSpecialOnTop ||
-        rightSortSpecial == SortSpecialOnBottom)
-    {
-      result = true;
-      return true;
-    }
-
-    // otherwise right is sorted above left
-    result = false;
-    return true;
-  }
-  // both have either sort on top or sort on bottom -> leave as-is
-  else if (leftSortSpecial != SortSpecialNone)
-  {
-    result = false;
-    return true;
-  }
-
-  if (handleFolder)
-  {
-    itLeft = left.find(FieldFolder);
-    itRight = right.find(FieldFolder);
-    if (itLeft != left.end() && itRight != right.end() &&
-        itLeft->second.asBoolean() != itRight->second.asBoolean())
-    {
-      result = itLeft->second.asBoolean();
-      return true;
-    }
-  }
-
-  labelLeft = itLeftSort->second.asWideString();
-  labelRight = itRightSort->second.asWideString();
-
-  return false;
-}
+// what the items are compared by, gathered once per item so the comparisons neither look up
+// fields in the items nor copy their labels
+struct SortKey
+{
+  size_t index;
+  bool hasLabel = false;
+  SortSpecial sortSpecial = SortSpecialNone;
+  int folder = -1; // -1 if unknown, otherwise whether the item is a folder
+  std::wstring label;
+};
 
-bool SorterAscending(const SortItem &left, const SortItem &right)
+SortKey GetSortKey(const SortItem& item, size_t index)
 {
-  bool result;
-  std::wstring labelLeft, labelRight;
-  if (preliminarySort(left, right, true, result, labelLeft, labelRight))
-    return result;
+  SortKey key{index};
 
-  return StringUtils::AlphaNumericCompare(labelLeft, labelRight) < 0;
-}
+  // make sure the item has the necessary data to do the sorting
+  const auto itSort = item.find(FieldSort);
+  if (itSort == item.end())
+    return key;
 
-bool SorterDescending(const SortItem &left, const SortItem &right)
-{
-  bool result;
-  std::wstring labelLeft, labelRight;
-  if (preliminarySort(left, right, true, result, labelLeft, labelRight))
-    return result;
+  key.hasLabel = true;
+  key.label = itSort->second.asWideString();
 
-  return StringUtils::AlphaNumericCompare(labelLeft, labelRight) > 0;
-}
+  const auto itSpecial = item.find(FieldSortSpecial);
+  if (itSpecial != item.end() && itSpecial->second.asInteger() <= (int64_t)SortSpecialOnBottom)
+    key.sortSpecial = (SortSpecial)itSpecial->second.asInteger();
 
-bool SorterIgnoreFoldersAscending(const SortItem &left, const SortItem &right)
-{
-  bool result;
-  std::wstring labelLeft, labelRight;
-  if (preliminarySort(left, right, false, result, labelLeft, labelRight))
-    return result;
+  const auto itFolder = item.find(FieldFolder);
+  if (itFolder != item.end())
+    key.folder = itFolder->second.asBoolean() ? 1 : 0;
 
-  return StringUtils::AlphaNumericCompare(labelLeft, labelRight) < 0;
+  return key;
 }
 
-bool SorterIgnoreFoldersDescending(const SortItem &left, const SortItem &right)
+bool SortKeyLess(const SortKey& left, const SortKey& right, bool handleFolder, bool descending)
 {
-  bool result;
-  std::wstring labelLeft, labelRight;
-  if (preliminarySort(left, right, false, result, labelLeft, labelRight))
-    return result;
+  if (!left.hasLabel)
+    return false;
+  if (!right.hasLabel)
+    return true;
 
-  return StringUtils::AlphaNumericCompare(labelLeft, labelRight) > 0;
-}
+  // one has a special sort
+  if (left.sortSpecial != right.sortSpecial)
+  {
+    // left should be sorted on top
+    // or right should be sorted on bottom
+    // => left is sorted above right
+    // otherwise right is sorted above left
+    return left.sortSpecial == SortSpecialOnTop || right.sortSpecial == SortSpecialOnBottom;
+  }
+  // both have either sort on top or sort on bottom -> leave as-is
+  else if (left.sortSpecial != SortSpecialNone)
+    return false;
 
-bool SorterIndirectAscending(const SortItemPtr &left, const SortItemPtr &right)
-{
-  return SorterAscending(*left, *right);
-}
+  if (handleFolder && left.folder >= 0 && right.folder >= 0 && left.folder != right.folder)
+    return left.folder > right.folder;
 
-bool SorterIndirectDescending(const SortItemPtr &left, const SortItemPtr &right)
-{
-  return SorterDescending(*left, *right);
+  const int64_t result = StringUtils::AlphaNumericCompare(left.label, right.label);
+  return descending ? result > 0 : result < 0;
 }
 
-bool SorterIndirectIgnoreFoldersAscending(const SortItemPtr &left, const SortItemPtr &right)
+/*!
+ \brief Stable sort of items by their FieldSort labels.
+ \param getItem function returning the SortItem of an element of items
+ */
+template<typename Items, typename GetItem>
+void SortByKeys(Items& items, SortOrder sortOrder, SortAttribute attributes, GetItem getItem)
 {
-  return SorterIgnoreFoldersAscending(*left, *right);
-}
+  std::vector<SortKey> keys;
+  keys.reserve(items.size());
+  for (size_t i = 0; i < items.size(); i++)
+    keys.emplace_back(GetSortKey(getItem(items[i]), i));
 
-bool SorterIndirectIgnoreFoldersDescending(const SortItemPtr &left, const SortItemPtr &right)
-{
-  return SorterIgnoreFoldersDescending(*left, *right);
+  const bool handleFolder = !(attributes & SortAttributeIgnoreFolders);
+  const bool descending = sortOrder == SortOrderDescending;
+  std::stable_sort(keys.begin(), keys.end(), [handleFolder, descending](const SortKey& left,
+                                                                       const SortKey& right)
+                   { return SortKeyLess(left, right, handleFolder, descending); });
+
+  Items sorted;
+  sorted.reserve(items.size());
+  for (const SortKey& key : keys)
+    sorted.emplace_back(std::move(items[key.index]));
+  items.swap(sorted);
 }
+} // unnamed namespace
 
 // clang-format off
 std::map<SortBy, SortUtils::SortPreparator> fillPreparators()
@@ -1011,11 +974,12 @@ void SortUtils::Sort(SortBy sortBy, SortOrder sortOrder, SortAttribute attribute
 
         std::wstring sortLabel;
         g_charsetConverter.utf8ToW(preparator(attributes, *item), sortLabel, false);
-        item->insert(std::pair<Field, CVariant>(FieldSort, CVariant(sortLabel)));
+        item->insert(std::pair<Field, CVariant>(FieldSort, CVariant(std::move(sortLabel))));
       }
 
       // Do the sorting
-      std::stable_sort(items.begin(), items.end(), getSorter(sortOrder, attributes));
+      SortByKeys(items, sortOrder, attributes, [](const SortItem& item) -> const SortItem&
+                 { return item; });
     }
   }
 
@@ -1050,11 +1014,12 @@ void SortUtils::Sort(SortBy sortBy, SortOrder sortOrder, SortAttribute attribute
 
         std::wstring sortLabel;
         g_charsetConverter.utf8ToW(preparator(attributes, **item), sortLabel, false);
-        (*item)->insert(std::pair<Field, CVariant>(FieldSort, CVariant(sortLabel)));
+        (*item)->insert(std::pair<Field, CVariant>(FieldSort, CVariant(std::move(sortLabel))));
       }
 
       // Do the sorting
-      std::stable_sort(items.begin(), items.end(), getSorterIndirect(sortOrder, attributes));
+      SortByKeys(items, sortOrder, attributes, [](const SortItemPtr& item) -> const SortItem&
+                 { return *item; });
     }
   }
 
@@ -1110,22 +1075,6 @@ const SortUtils::SortPreparator& SortUtils::getPreparator(SortBy sortBy)
   return m_preparators[SortByNone];
 }
 
-SortUtils::Sorter SortUtils::getSorter(SortOrder sortOrder, SortAttribute attributes)
-{
-  if (attributes & SortAttributeIgnoreFolders)
-    return sortOrder == SortOrderDescending ? SorterIgnoreFoldersDescending : SorterIgnoreFoldersAscending;
-
-  return sortOrder == SortOrderDescending ? SorterDescending : SorterAscending;
-}
-
-SortUtils::SorterIndirect SortUtils::getSorterIndirect(SortOrder sortOrder, SortAttribute attributes)
-{
-  if (attributes & SortAttributeIgnoreFolders)
-    return sortOrder == SortOrderDescending ? SorterIndirectIgnoreFoldersDescending : SorterIndirectIgnoreFoldersAscending;
-
-  return sortOrder == SortOrderDescending ? SorterIndirectDescending : SorterIndirectAscending;
-}
-
 const Fields& SortUtils::GetFieldsForSorting(SortBy sortBy)
 {
   std::map<SortBy, Fields>::const_iterator it = m_sortingFields.find(sortBy);
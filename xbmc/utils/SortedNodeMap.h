@@ -0,0 +1,242 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <stddef.h>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*!
+ * \brief A map from strings to values stored as a sorted vector of nodes.
+ *
+ *        Meant as a drop-in replacement for std::map<std::string, T> for the many small maps
+ *        found in CVariant objects. The keys are found through a binary search over a single
+ *        contiguous array, the nodes are smaller than the ones of a tree and iteration doesn't
+ *        have to walk one. Inserting and erasing are linear, which is cheap for the sizes
+ *        involved.
+ *
+ *        Every element lives in a node of its own, so just like with std::map references to
+ *        elements stay valid while other keys are inserted or erased. Unlike std::map, iterators
+ *        are invalidated by inserting or erasing.
+ *
+ *        T may be incomplete where the map is declared. Compare orders the keys, it is called
+ *        with std::string_view arguments and keys comparing equal under it are the same key.
+ */
+template<typename T, typename Compare = std::less<std::string_view>>
+class CSortedNodeMap
+{
+public:
+  using key_type = std::string;
+  using mapped_type = T;
+  using value_type = std::pair<const std::string, T>;
+  using size_type = size_t;
+  using difference_type = ptrdiff_t;
+
+private:
+  using Nodes = std::vector<std::unique_ptr<value_type>>;
+
+  template<bool IsConst>
+  class Iterator
+  {
+  public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = CSortedNodeMap::value_type;
+    using difference_type = ptrdiff_t;
+    using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+    using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+
+    Iterator() = default;
+    // iterator converts to const_iterator
+    template<bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+    Iterator(const Iterator<OtherConst>& other) : m_it(other.m_it)
+    {
+    }
+
+    reference operator*() const { return **m_it; }
+    pointer operator->() const { return m_it->get(); }
+
+    Iterator& operator++()
+    {
+      ++m_it;
+      return *this;
+    }
+    Iterator operator++(int) { return Iterator(m_it++); }
+    Iterator& operator--()
+    {
+      --m_it;
+      return *this;
+    }
+    Iterator operator--(int) { return Iterator(m_it--); }
+
+    template<bool OtherConst>
+    bool operator==(const Iterator<OtherConst>& rhs) const
+    {
+      return m_it == rhs.m_it;
+    }
+    template<bool OtherConst>
+    bool operator!=(const Iterator<OtherConst>& rhs) const
+    {
+      return m_it != rhs.m_it;
+    }
+
+  private:
+    friend class CSortedNodeMap;
+    template<bool>
+    friend class Iterator;
+
+    using Base = typename Nodes::const_iterator;
+    explicit Iterator(Base it) : m_it(it) {}
+
+    Base m_it;
+  };
+
+public:
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+  CSortedNodeMap() = default;
+  CSortedNodeMap(CSortedNodeMap&&) noexcept = default;
+  CSortedNodeMap& operator=(CSortedNodeMap&&) noexcept = default;
+
+  CSortedNodeMap(const CSortedNodeMap& other)
+  {
+    m_nodes.reserve(other.m_nodes.size());
+    for (const auto& node : other.m_nodes)
+      m_nodes.emplace_back(std::make_unique<value_type>(*node));
+  }
+
+  CSortedNodeMap& operator=(const CSortedNodeMap& other)
+  {
+    if (this != &other)
+    {
+      CSortedNodeMap copy(other);
+      m_nodes.swap(copy.m_nodes);
+    }
+    return *this;
+  }
+
+  explicit CSortedNodeMap(const std::map<std::string, T>& map)
+  {
+    static_assert(std::is_same_v<Compare, std::less<std::string_view>>);
+    // already sorted
+    m_nodes.reserve(map.size());
+    for (const auto& element : map)
+      m_nodes.emplace_back(std::make_unique<value_type>(element));
+  }
+
+  explicit CSortedNodeMap(std::map<std::string, T>&& map)
+  {
+    static_assert(std::is_same_v<Compare, std::less<std::string_view>>);
+    m_nodes.reserve(map.size());
+    for (auto& [key, value] : map)
+      m_nodes.emplace_back(std::make_unique<value_type>(key, std::move(value)));
+  }
+
+  iterator begin() { return iterator(m_nodes.cbegin()); }
+  const_iterator begin() const { return const_iterator(m_nodes.cbegin()); }
+  const_iterator cbegin() const { return begin(); }
+  iterator end() { return iterator(m_nodes.cend()); }
+  const_iterator end() const { return const_iterator(m_nodes.cend()); }
+  const_iterator cend() const { return end(); }
+
+  size_type size() const { return m_nodes.size(); }
+  bool empty() const { return m_nodes.empty(); }
+  void clear() { m_nodes.clear(); }
+  void reserve(size_type count) { m_nodes.reserve(count); }
+
+  iterator find(std::string_view key)
+  {
+    const auto it = LowerBound(key);
+    return iterator(Matches(it, key) ? it : m_nodes.cend());
+  }
+
+  const_iterator find(std::string_view key) const
+  {
+    return const_cast<CSortedNodeMap*>(this)->find(key);
+  }
+
+  bool contains(std::string_view key) const { return find(key) != end(); }
+
+  T& operator[](std::string_view key) { return try_emplace(key).first->second; }
+
+  /*!
+   * \brief Insert a value unless the key already exists.
+   * \return the element with the key and whether it was inserted
+   */
+  template<typename V>
+  std::pair<iterator, bool> emplace(std::string_view key, V&& value)
+  {
+    return try_emplace(key, std::forward<V>(value));
+  }
+
+  /*!
+   * \brief Construct a value from the given arguments unless the key already exists.
+   * \return the element with the key and whether it was inserted
+   */
+  template<typename... Args>
+  std::pair<iterator, bool> try_emplace(std::string_view key, Args&&... args)
+  {
+    auto it = LowerBound(key);
+    if (Matches(it, key))
+      return {iterator(it), false};
+
+    it = m_nodes.emplace(it, std::make_unique<value_type>(
+                                 std::piecewise_construct, std::forward_as_tuple(key),
+                                 std::forward_as_tuple(std::forward<Args>(args)...)));
+    return {iterator(it), true};
+  }
+
+  size_type erase(std::string_view key)
+  {
+    const auto it = LowerBound(key);
+    if (!Matches(it, key))
+      return 0;
+
+    m_nodes.erase(it);
+    return 1;
+  }
+
+  iterator erase(const_iterator pos) { return iterator(m_nodes.erase(pos.m_it)); }
+
+  bool operator==(const CSortedNodeMap& rhs) const
+  {
+    return std::equal(m_nodes.begin(), m_nodes.end(), rhs.m_nodes.begin(), rhs.m_nodes.end(),
+                      [](const auto& lhs, const auto& rhs) { return *lhs == *rhs; });
+  }
+  bool operator!=(const CSortedNodeMap& rhs) const { return !(*this == rhs); }
+
+private:
+  typename Nodes::const_iterator LowerBound(std::string_view key) const
+  {
+    // keys are mostly added in order, e.g. when copying or deserializing
+    if (m_nodes.empty() || Compare()(m_nodes.back()->first, key))
+      return m_nodes.cend();
+
+    return std::lower_bound(m_nodes.cbegin(), m_nodes.cend(), key,
+                            [](const auto& node, std::string_view key)
+                            { return Compare()(node->first, key); });
+  }
+
+  // whether the node found by LowerBound() has the key
+  bool Matches(typename Nodes::const_iterator it, std::string_view key) const
+  {
+    return it != m_nodes.cend() && !Compare()(key, (*it)->first);
+  }
+
+  Nodes m_nodes;
+};
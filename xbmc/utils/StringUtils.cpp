@@ -685,6 +685,24 @@ std::vector<std::string> StringUtils::Split(std::string_view input,
   return result;
 }
 
+std::vector<std::string_view> StringUtils::SplitView(std::string_view input,
+                                                     std::string_view delimiter,
+                                                     unsigned int iMaxStrings)
+{
+  std::vector<std::string_view> result;
+  SplitViewTo(std::back_inserter(result), input, delimiter, iMaxStrings);
+  return result;
+}
+
+std::vector<std::string_view> StringUtils::SplitView(std::string_view input,
+                                                     char delimiter,
+                                                     size_t iMaxStrings)
+{
+  std::vector<std::string_view> result;
+  SplitViewTo(std::back_inserter(result), input, delimiter, iMaxStrings);
+  return result;
+}
+
 template<typename StringLikeA, typename StringLikeB>
 [[nodiscard]] std::vector<std::string> SplitMultiT(std::span<const StringLikeA> input,
                                                    std::span<const StringLikeB> delimiters,
@@ -27,6 +27,7 @@
 #include <stdarg.h>
 #include <stdint.h>
 #include <string>
+#include <string_view>
 #include <vector>
 
 // workaround for broken [[deprecated]] in coverity
@@ -94,6 +95,41 @@ public:
     return fmt::format(fmt::runtime(format), EnumToInt(std::forward<Args>(args))...);
   }
 
+  /*! \brief Format into an output iterator instead of a new string
+
+  Use with std::back_inserter to append to an existing string or fmt::memory_buffer
+  without creating a temporary.
+
+  \param out Output iterator to write the formatted characters to
+  \param format Format of the resulting string
+  \param ... variable number of value type arguments
+  \return Output iterator one past the last written character
+  */
+  template<typename OutputIt, typename... Args>
+  static OutputIt FormatTo(OutputIt out, std::string_view format, Args&&... args)
+  {
+    // coverity[fun_call_w_exception : FALSE]
+    return fmt::format_to(out, fmt::runtime(format), EnumToInt(std::forward<Args>(args))...);
+  }
+
+  /*! \brief Format into a caller provided buffer, truncating the result if it doesn't fit
+
+  \param buffer Buffer to write the formatted characters to, it is not null-terminated
+  \param format Format of the resulting string
+  \param ... variable number of value type arguments
+  \return View of the formatted characters inside the buffer
+  */
+  template<typename... Args>
+  static std::string_view FormatToBuffer(std::span<char> buffer,
+                                         std::string_view format,
+                                         Args&&... args)
+  {
+    // coverity[fun_call_w_exception : FALSE]
+    const auto result = fmt::format_to_n(buffer.data(), buffer.size(), fmt::runtime(format),
+                                         EnumToInt(std::forward<Args>(args))...);
+    return {buffer.data(), static_cast<size_t>(result.out - buffer.data())};
+  }
+
   [[nodiscard]] static std::string FormatV(PRINTF_FORMAT_STRING const char* fmt, va_list args);
   [[nodiscard]] static std::wstring FormatV(PRINTF_FORMAT_STRING const wchar_t* fmt, va_list args);
   [[nodiscard]] static std::string ToUpper(std::string_view str);
@@ -145,6 +181,14 @@ public:
   [[nodiscard]] static std::string Join(const CONTAINER& strings, std::string_view delimiter)
   {
     std::string result;
+    if constexpr (std::is_convertible_v<typename CONTAINER::value_type, std::string_view>)
+    {
+      size_t size = 0;
+      for (std::string_view str : strings)
+        size += str.size() + delimiter.size();
+      result.reserve(size);
+    }
+
     for (const auto& str : strings)
     {
       result += str;
@@ -175,6 +219,21 @@ public:
                                                       std::span<const std::string> delimiters);
   [[nodiscard]] static std::vector<std::string> Split(std::string_view input,
                                                       std::span<const std::string_view> delimiters);
+  /*! \brief Splits the given input string using the given delimiter without copying the parts.
+
+   Same as Split(), but the returned views point into the input string, so it has to outlive
+   the result.
+
+   \param input Input string to be split
+   \param delimiter Delimiter to be used to split the input string
+   \param iMaxStrings (optional) Maximum number of split strings
+   */
+  [[nodiscard]] static std::vector<std::string_view> SplitView(std::string_view input,
+                                                               std::string_view delimiter,
+                                                               unsigned int iMaxStrings = 0);
+  [[nodiscard]] static std::vector<std::string_view> SplitView(std::string_view input,
+                                                               char delimiter,
+                                                               size_t iMaxStrings = 0);
   /*! \brief Splits the given input string using the given delimiter into separate strings.
 
    If the given input string is empty nothing will be put into the target iterator.
@@ -192,32 +251,7 @@ public:
                           std::string_view delimiter,
                           unsigned int iMaxStrings = 0)
   {
-    OutputIt dest = d_first;
-
-    if (input.empty())
-      return dest;
-    if (delimiter.empty())
-    {
-      *d_first++ = std::string(input);
-      return dest;
-    }
-
-    const size_t delimLen = delimiter.length();
-    size_t nextDelim;
-    size_t textPos = 0;
-    do
-    {
-      if (--iMaxStrings == 0)
-      {
-        *dest++ = std::string(input.substr(textPos));
-        break;
-      }
-      nextDelim = input.find(delimiter, textPos);
-      *dest++ = std::string(input.substr(textPos, nextDelim - textPos));
-      textPos = nextDelim + delimLen;
-    } while (nextDelim != std::string::npos);
-
-    return dest;
+    return SplitToT<std::string>(d_first, input, delimiter, iMaxStrings);
   }
   template<typename OutputIt>
   static OutputIt SplitTo(OutputIt d_first,
@@ -227,6 +261,34 @@ public:
   {
     return SplitTo(d_first, input, std::string_view(&delimiter, 1), iMaxStrings);
   }
+  /*! \brief Splits the given input string using the given delimiter into views of the input.
+
+   Same as SplitTo(), but string_views pointing into the input string are put into the
+   target iterator, so splitting itself doesn't allocate.
+
+   \param d_first the beginning of the destination range
+   \param input Input string to be split
+   \param delimiter Delimiter to be used to split the input string
+   \param iMaxStrings (optional) Maximum number of split strings
+   \return output iterator to the element in the destination range, one past the last element
+   *       that was put there
+   */
+  template<typename OutputIt>
+  static OutputIt SplitViewTo(OutputIt d_first,
+                              std::string_view input,
+                              std::string_view delimiter,
+                              unsigned int iMaxStrings = 0)
+  {
+    return SplitToT<std::string_view>(d_first, input, delimiter, iMaxStrings);
+  }
+  template<typename OutputIt>
+  static OutputIt SplitViewTo(OutputIt d_first,
+                              std::string_view input,
+                              char delimiter,
+                              size_t iMaxStrings = 0)
+  {
+    return SplitViewTo(d_first, input, std::string_view(&delimiter, 1), iMaxStrings);
+  }
   template<typename OutputIt, typename StringLike>
   static OutputIt SplitTo(OutputIt d_first,
                           std::string_view input,
@@ -506,6 +568,38 @@ public:
                                      bool isCaseInsensitive = true) noexcept;
 
 private:
+  template<typename T, typename OutputIt>
+  static OutputIt SplitToT(OutputIt dest,
+                           std::string_view input,
+                           std::string_view delimiter,
+                           unsigned int iMaxStrings)
+  {
+    if (input.empty())
+      return dest;
+    if (delimiter.empty())
+    {
+      *dest++ = T(input);
+      return dest;
+    }
+
+    const size_t delimLen = delimiter.length();
+    size_t nextDelim;
+    size_t textPos = 0;
+    do
+    {
+      if (--iMaxStrings == 0)
+      {
+        *dest++ = T(input.substr(textPos));
+        break;
+      }
+      nextDelim = input.find(delimiter, textPos);
+      *dest++ = T(input.substr(textPos, nextDelim - textPos));
+      textPos = nextDelim + delimLen;
+    } while (nextDelim != std::string::npos);
+
+    return dest;
+  }
+
   /*!
    * Wrapper for CLangInfo::GetOriginalLocale() which allows us to
    * avoid including LangInfo.h from this header.
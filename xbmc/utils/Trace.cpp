@@ -0,0 +1,239 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "Trace.h"
+
+#include "threads/Thread.h"
+#include "utils/Variant.h"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+std::atomic<bool> CTrace::s_enabled{false};
+
+namespace
+{
+struct TraceEvent
+{
+  const char* name;
+  char phase;
+  int64_t timestamp; // microseconds since Start()
+  int64_t value; // duration of zones, value of counters, id of flows
+};
+
+struct ThreadBuffer
+{
+  std::mutex mutex;
+  int64_t threadId{0};
+  std::string threadName;
+  std::vector<TraceEvent> events; // ring buffer
+  size_t next{0};
+  size_t count{0};
+  bool ended{false};
+};
+
+std::mutex s_buffersMutex;
+std::vector<std::shared_ptr<ThreadBuffer>> s_buffers;
+size_t s_eventsPerThread{CTrace::DEFAULT_EVENTS_PER_THREAD};
+std::atomic<std::chrono::steady_clock::rep> s_origin{0};
+int64_t s_nextThreadId{1};
+
+void ReleaseThreadBuffer(const std::shared_ptr<ThreadBuffer>& buffer)
+{
+  std::unique_lock lock(s_buffersMutex);
+  std::erase(s_buffers, buffer);
+  {
+    std::unique_lock bufferLock(buffer->mutex);
+    buffer->ended = true;
+    if (buffer->count == 0)
+      return;
+  }
+
+  // buffers of ended threads are moved to the back, so they are in the order the threads ended
+  size_t ended = std::ranges::count_if(s_buffers, [](const auto& b) { return b->ended; });
+  for (auto it = s_buffers.begin(); it != s_buffers.end() && ended >= CTrace::MAX_ENDED_THREADS;)
+  {
+    if ((*it)->ended)
+    {
+      it = s_buffers.erase(it);
+      --ended;
+    }
+    else
+      ++it;
+  }
+  s_buffers.emplace_back(buffer);
+}
+
+//! Holds the buffer of the thread and releases it when the thread ends
+struct ThreadBufferOwner
+{
+  ~ThreadBufferOwner()
+  {
+    if (buffer)
+      ReleaseThreadBuffer(buffer);
+  }
+
+  std::shared_ptr<ThreadBuffer> buffer;
+};
+
+ThreadBuffer& GetThreadBuffer()
+{
+  thread_local ThreadBufferOwner owner;
+  std::shared_ptr<ThreadBuffer>& buffer = owner.buffer;
+  if (!buffer)
+  {
+    buffer = std::make_shared<ThreadBuffer>();
+    const CThread* thread = CThread::GetCurrentThread();
+    buffer->threadName = thread ? thread->GetName() : "";
+
+    std::unique_lock lock(s_buffersMutex);
+    buffer->threadId = s_nextThreadId++;
+    buffer->events.resize(s_eventsPerThread);
+    s_buffers.emplace_back(buffer);
+  }
+  return *buffer;
+}
+
+int64_t ToTimestamp(std::chrono::steady_clock::time_point time)
+{
+  const std::chrono::steady_clock::duration origin{s_origin.load(std::memory_order_relaxed)};
+  return std::chrono::duration_cast<std::chrono::microseconds>(time.time_since_epoch() - origin)
+      .count();
+}
+
+void Record(const char* name, char phase, int64_t timestamp, int64_t value)
+{
+  ThreadBuffer& buffer = GetThreadBuffer();
+  std::unique_lock lock(buffer.mutex);
+  if (buffer.events.empty())
+    return;
+
+  buffer.events[buffer.next] = {name, phase, timestamp, value};
+  buffer.next = (buffer.next + 1) % buffer.events.size();
+  if (buffer.count < buffer.events.size())
+    ++buffer.count;
+}
+
+void Record(const char* name, char phase, int64_t value)
+{
+  Record(name, phase, ToTimestamp(std::chrono::steady_clock::now()), value);
+}
+} // unnamed namespace
+
+void CTrace::Start(size_t eventsPerThread /* = DEFAULT_EVENTS_PER_THREAD */)
+{
+  std::unique_lock lock(s_buffersMutex);
+  s_enabled = false;
+
+  std::erase_if(s_buffers, [](const auto& buffer) { return buffer->ended; });
+
+  eventsPerThread = std::clamp<size_t>(eventsPerThread, 1, MAX_EVENTS_PER_THREAD);
+  s_eventsPerThread = eventsPerThread;
+  for (const auto& buffer : s_buffers)
+  {
+    std::unique_lock bufferLock(buffer->mutex);
+    buffer->events.assign(eventsPerThread, {});
+    buffer->next = 0;
+    buffer->count = 0;
+  }
+
+  s_origin = std::chrono::steady_clock::now().time_since_epoch().count();
+  s_enabled = true;
+}
+
+void CTrace::Stop()
+{
+  s_enabled = false;
+}
+
+void CTrace::Counter(const char* name, int64_t value)
+{
+  if (IsEnabled())
+    Record(name, 'C', value);
+}
+
+void CTrace::FlowBegin(const char* name, uint64_t id)
+{
+  if (IsEnabled())
+    Record(name, 's', static_cast<int64_t>(id));
+}
+
+void CTrace::FlowEnd(const char* name, uint64_t id)
+{
+  if (IsEnabled())
+    Record(name, 'f', static_cast<int64_t>(id));
+}
+
+void CTrace::Complete(const char* name, std::chrono::steady_clock::time_point start)
+{
+  const auto end = std::chrono::steady_clock::now();
+  Record(name, 'X', ToTimestamp(start),
+         std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+}
+
+void CTrace::Export(CVariant& trace)
+{
+  trace = CVariant(CVariant::VariantTypeObject);
+  trace["displayTimeUnit"] = "ms";
+  CVariant& events = trace["traceEvents"] = CVariant(CVariant::VariantTypeArray);
+
+  std::unique_lock lock(s_buffersMutex);
+  for (const auto& buffer : s_buffers)
+  {
+    std::unique_lock bufferLock(buffer->mutex);
+    if (buffer->count == 0)
+      continue;
+
+    CVariant threadName(CVariant::VariantTypeObject);
+    threadName["name"] = "thread_name";
+    threadName["ph"] = "M";
+    threadName["pid"] = 1;
+    threadName["tid"] = buffer->threadId;
+    threadName["args"]["name"] = buffer->threadName.empty()
+                                     ? "Thread " + std::to_string(buffer->threadId)
+                                     : buffer->threadName;
+    events.push_back(std::move(threadName));
+
+    const size_t size = buffer->events.size();
+    for (size_t i = (buffer->next + size - buffer->count) % size, n = 0; n < buffer->count;
+         i = (i + 1) % size, ++n)
+    {
+      const TraceEvent& traceEvent = buffer->events[i];
+
+      CVariant event(CVariant::VariantTypeObject);
+      event["name"] = traceEvent.name;
+      event["cat"] = "kodi";
+      event["ph"] = std::string(1, traceEvent.phase);
+      event["ts"] = traceEvent.timestamp;
+      event["pid"] = 1;
+      event["tid"] = buffer->threadId;
+      switch (traceEvent.phase)
+      {
+        case 'X':
+          event["dur"] = traceEvent.value;
+          break;
+        case 'C':
+          event["args"]["value"] = traceEvent.value;
+          break;
+        case 'f':
+          // bind to the zone enclosing the end, not to the next one
+          event["bp"] = "e";
+          [[fallthrough]];
+        case 's':
+          event["id"] = traceEvent.value;
+          break;
+        default:
+          break;
+      }
+      events.push_back(std::move(event));
+    }
+  }
+}
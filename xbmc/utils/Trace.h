@@ -0,0 +1,97 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+class CVariant;
+
+/*!
+ * \brief Cross-thread timeline of scoped zones, counters and flow events, exported in the Chrome
+ * trace event format (chrome://tracing, ui.perfetto.dev).
+ *
+ * Recording is off until Start() is called. While it is off every instrumentation point costs a
+ * single relaxed atomic load. Each thread records into its own ring buffer, so a running trace
+ * always holds the most recent events. The events of threads that ended are kept for the last
+ * MAX_ENDED_THREADS of them.
+ *
+ * Event names are stored as pointers and must be string literals.
+ */
+class CTrace
+{
+public:
+  static constexpr size_t DEFAULT_EVENTS_PER_THREAD = 16384;
+  static constexpr size_t MAX_EVENTS_PER_THREAD = 262144;
+  static constexpr size_t MAX_ENDED_THREADS = 32;
+
+  /*!
+   * \brief Discard all recorded events and start recording
+   * \param eventsPerThread size of the ring buffer of each thread, at most MAX_EVENTS_PER_THREAD
+   */
+  static void Start(size_t eventsPerThread = DEFAULT_EVENTS_PER_THREAD);
+
+  /*!
+   * \brief Stop recording, the recorded events are kept for Export()
+   */
+  static void Stop();
+
+  static bool IsEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+
+  /*!
+   * \brief Record the current value of a counter, e.g. a queue length
+   */
+  static void Counter(const char* name, int64_t value);
+
+  /*!
+   * \brief Record the start of a flow, connecting the enclosing zone to the zone enclosing the
+   * FlowEnd() with the same name and id, e.g. a job submission to the job execution
+   */
+  static void FlowBegin(const char* name, uint64_t id);
+  static void FlowEnd(const char* name, uint64_t id);
+
+  /*!
+   * \brief Export the recorded events as Chrome trace object with a "traceEvents" array
+   */
+  static void Export(CVariant& trace);
+
+private:
+  friend class CTraceZone;
+
+  static void Complete(const char* name, std::chrono::steady_clock::time_point start);
+
+  static std::atomic<bool> s_enabled;
+};
+
+/*!
+ * \brief Records the lifetime of the object as zone of the calling thread
+ */
+class CTraceZone
+{
+public:
+  explicit CTraceZone(const char* name) : m_name(CTrace::IsEnabled() ? name : nullptr)
+  {
+    if (m_name)
+      m_start = std::chrono::steady_clock::now();
+  }
+
+  ~CTraceZone()
+  {
+    if (m_name)
+      CTrace::Complete(m_name, m_start);
+  }
+
+  CTraceZone(const CTraceZone&) = delete;
+  CTraceZone& operator=(const CTraceZone&) = delete;
+
+private:
+  const char* m_name;
+  std::chrono::steady_clock::time_point m_start;
+};
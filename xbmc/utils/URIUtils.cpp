@@ -199,14 +199,11 @@ bool URIUtils::HasExtension(const std::string& strFileName, const std::string& s
   if (pos == std::string::npos || strFileName[pos] != '.')
     return false;
 
-  const std::string extensionLower = StringUtils::ToLower(strFileName.substr(pos));
+  const std::string_view extension = std::string_view(strFileName).substr(pos);
 
-  const std::vector<std::string> extensionsLower =
-      StringUtils::Split(StringUtils::ToLower(strExtensions), '|');
-
-  for (const auto& ext : extensionsLower)
+  for (std::string_view ext : StringUtils::SplitView(strExtensions, '|'))
   {
-    if (StringUtils::EndsWith(ext, extensionLower))
+    if (StringUtils::EndsWithNoCase(ext, extension))
       return true;
   }
 
@@ -1742,23 +1739,22 @@ std::string URIUtils::resolvePath(const std::string &path)
   size_t posSlash = path.find('/');
   size_t posBackslash = path.find('\\');
   std::string delim = posSlash < posBackslash ? "/" : "\\";
-  std::vector<std::string> parts = StringUtils::Split(path, delim);
-  std::vector<std::string> realParts;
+  std::vector<std::string_view> realParts;
 
-  for (std::vector<std::string>::const_iterator part = parts.begin(); part != parts.end(); ++part)
+  for (std::string_view part : StringUtils::SplitView(path, delim))
   {
-    if (part->empty() || part->compare(".") == 0)
+    if (part.empty() || part == ".")
       continue;
 
     // go one level back up
-    if (part->compare("..") == 0)
+    if (part == "..")
     {
       if (!realParts.empty())
         realParts.pop_back();
       continue;
     }
 
-    realParts.push_back(*part);
+    realParts.push_back(part);
   }
 
   std::string realPath;
@@ -8,6 +8,228 @@
 
 #include "Utf8Utils.h"
 
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(HAVE_SSE2) && defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(HAS_NEON) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace
+{
+// decode the UTF-8 sequence at the start of src (which holds avail bytes), returns the length
+// of the sequence or 0 if it isn't valid (overlong forms, surrogates and values above U+10FFFF)
+inline size_t DecodeUtf8Char(const unsigned char* src, size_t avail, char32_t& codePoint)
+{
+  const unsigned char chr = src[0];
+  if (chr <= 0x7F)
+  {
+    codePoint = chr;
+    return 1;
+  }
+
+  size_t len;
+  if (chr >= 0xC2 && chr <= 0xDF)
+  {
+    len = 2;
+    codePoint = chr & 0x1F;
+  }
+  else if (chr >= 0xE0 && chr <= 0xEF)
+  {
+    len = 3;
+    codePoint = chr & 0x0F;
+  }
+  else if (chr >= 0xF0 && chr <= 0xF4)
+  {
+    len = 4;
+    codePoint = chr & 0x07;
+  }
+  else
+    return 0;
+
+  if (avail < len)
+    return 0;
+
+  for (size_t i = 1; i < len; ++i)
+  {
+    if ((src[i] & 0xC0) != 0x80)
+      return 0;
+    codePoint = (codePoint << 6) | (src[i] & 0x3F);
+  }
+
+  if ((len == 3 && codePoint < 0x800) || (len == 4 && codePoint < 0x10000) ||
+      (codePoint >= 0xD800 && codePoint <= 0xDFFF) || codePoint > 0x10FFFF)
+    return 0;
+
+  return len;
+}
+
+template<typename CharT>
+inline void AppendCodePoint(std::basic_string<CharT>& dst, char32_t codePoint)
+{
+  if constexpr (sizeof(CharT) == 2)
+  {
+    if (codePoint >= 0x10000)
+    {
+      codePoint -= 0x10000;
+      dst.push_back(static_cast<CharT>(0xD800 + (codePoint >> 10)));
+      dst.push_back(static_cast<CharT>(0xDC00 + (codePoint & 0x3FF)));
+      return;
+    }
+  }
+  dst.push_back(static_cast<CharT>(codePoint));
+}
+} // namespace
+
+size_t CUtf8Utils::CountLeadingAscii(const char* str, size_t len)
+{
+  size_t pos = 0;
+
+#if defined(HAVE_SSE2) && defined(__SSE2__)
+  for (; pos + 16 <= len; pos += 16)
+  {
+    const int mask =
+        _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(str + pos)));
+    if (mask != 0)
+      return pos + std::countr_zero(static_cast<unsigned int>(mask));
+  }
+#elif defined(HAS_NEON) && defined(__ARM_NEON) && defined(__aarch64__)
+  for (; pos + 16 <= len; pos += 16)
+  {
+    if (vmaxvq_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(str + pos))) >= 0x80)
+      break;
+  }
+#else
+  for (; pos + sizeof(uint64_t) <= len; pos += sizeof(uint64_t))
+  {
+    uint64_t word;
+    std::memcpy(&word, str + pos, sizeof(word));
+    if (word & 0x8080808080808080ULL)
+      break;
+  }
+#endif
+
+  while (pos < len && static_cast<unsigned char>(str[pos]) <= 0x7F)
+    pos++;
+
+  return pos;
+}
+
+template<typename CharT>
+bool CUtf8Utils::Utf8ToUnicode(std::string_view utf8, std::basic_string<CharT>& dst, bool failOnBadChar)
+{
+  dst.clear();
+  dst.reserve(utf8.size());
+
+  const unsigned char* const src = reinterpret_cast<const unsigned char*>(utf8.data());
+  const size_t len = utf8.size();
+  size_t pos = 0;
+
+  while (pos < len)
+  {
+    // widen runs of US-ASCII in one go
+    const size_t asciiLen = CountLeadingAscii(utf8.data() + pos, len - pos);
+    if (asciiLen > 0)
+    {
+      const size_t dstPos = dst.size();
+      dst.resize(dstPos + asciiLen);
+      CharT* out = dst.data() + dstPos;
+      for (size_t i = 0; i < asciiLen; ++i)
+        out[i] = static_cast<CharT>(src[pos + i]);
+
+      pos += asciiLen;
+      continue;
+    }
+
+    char32_t codePoint;
+    const size_t chrLen = DecodeUtf8Char(src + pos, len - pos, codePoint);
+    if (chrLen == 0)
+    {
+      if (failOnBadChar)
+      {
+        dst.clear();
+        return false;
+      }
+      pos++; // skip invalid byte, like iconv does
+      continue;
+    }
+
+    AppendCodePoint(dst, codePoint);
+    pos += chrLen;
+  }
+
+  return true;
+}
+
+template<typename CharT>
+bool CUtf8Utils::UnicodeToUtf8(std::basic_string_view<CharT> src, std::string& utf8, bool failOnBadChar)
+{
+  utf8.clear();
+  utf8.reserve(src.size());
+
+  for (size_t pos = 0; pos < src.size(); ++pos)
+  {
+    char32_t codePoint = static_cast<std::make_unsigned_t<CharT>>(src[pos]);
+    if (codePoint <= 0x7F)
+    {
+      utf8.push_back(static_cast<char>(codePoint));
+      continue;
+    }
+
+    if constexpr (sizeof(CharT) == 2)
+    {
+      if (codePoint >= 0xD800 && codePoint <= 0xDBFF && pos + 1 < src.size())
+      {
+        const char32_t low = static_cast<std::make_unsigned_t<CharT>>(src[pos + 1]);
+        if (low >= 0xDC00 && low <= 0xDFFF)
+        {
+          codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+          pos++;
+        }
+      }
+    }
+
+    if ((codePoint >= 0xD800 && codePoint <= 0xDFFF) || codePoint > 0x10FFFF)
+    {
+      if (failOnBadChar)
+      {
+        utf8.clear();
+        return false;
+      }
+      continue;
+    }
+
+    if (codePoint <= 0x7FF)
+    {
+      utf8.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+    }
+    else if (codePoint <= 0xFFFF)
+    {
+      utf8.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+      utf8.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+    }
+    else
+    {
+      utf8.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+      utf8.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+      utf8.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+    }
+    utf8.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+  }
+
+  return true;
+}
+
+template bool CUtf8Utils::Utf8ToUnicode(std::string_view, std::u16string&, bool);
+template bool CUtf8Utils::Utf8ToUnicode(std::string_view, std::u32string&, bool);
+template bool CUtf8Utils::Utf8ToUnicode(std::string_view, std::wstring&, bool);
+template bool CUtf8Utils::UnicodeToUtf8(std::u16string_view, std::string&, bool);
+template bool CUtf8Utils::UnicodeToUtf8(std::u32string_view, std::string&, bool);
+template bool CUtf8Utils::UnicodeToUtf8(std::wstring_view, std::string&, bool);
 
 CUtf8Utils::utf8CheckResult CUtf8Utils::checkStrForUtf8(const std::string& str)
 {
@@ -18,12 +240,15 @@ CUtf8Utils::utf8CheckResult CUtf8Utils::checkStrForUtf8(const std::string& str)
 
   while (pos < len)
   {
+    pos += CountLeadingAscii(strC + pos, len - pos);
+    if (pos >= len)
+      break;
+
     const size_t chrLen = SizeOfUtf8Char(strC + pos);
     if (chrLen == 0)
       return hiAscii; // non valid UTF-8 sequence
-    else if (chrLen > 1)
-      isPlainAscii = false;
 
+    isPlainAscii = false;
     pos += chrLen;
   }
 
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 
 class CUtf8Utils
 {
@@ -37,6 +38,36 @@ public:
   static size_t RFindValidUtf8Char(const std::string& str, const size_t startPos);
 
   static size_t SizeOfUtf8Char(const std::string& str, const size_t charStart = 0);
+
+  /**
+   * Get the number of leading US-ASCII characters, checking 16 bytes at a time when SIMD is available
+   * @param str string to check
+   * @param len length of the string in bytes
+   * @return length of the US-ASCII only prefix of the string
+   */
+  static size_t CountLeadingAscii(const char* str, size_t len);
+
+  /**
+   * Decode UTF-8 to UTF-32, or to UTF-16 for 16 bit character types (like wchar_t on Windows)
+   * without going through iconv
+   * @param utf8 string to decode
+   * @param dst the decoded string, cleared on failure
+   * @param failOnBadChar fail on invalid sequences instead of skipping the offending bytes
+   * @return false if failOnBadChar is set and the input contains invalid sequences
+   */
+  template<typename CharT>
+  static bool Utf8ToUnicode(std::string_view utf8, std::basic_string<CharT>& dst, bool failOnBadChar);
+
+  /**
+   * Encode UTF-32, or UTF-16 for 16 bit character types, to UTF-8 without going through iconv
+   * @param src string to encode
+   * @param utf8 the encoded string, cleared on failure
+   * @param failOnBadChar fail on invalid code points or unpaired surrogates instead of skipping them
+   * @return false if failOnBadChar is set and the input contains invalid characters
+   */
+  template<typename CharT>
+  static bool UnicodeToUtf8(std::basic_string_view<CharT> src, std::string& utf8, bool failOnBadChar);
+
 private:
   static size_t SizeOfUtf8Char(const char* const str);
 };
@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include "utils/SortedNodeMap.h"
+
 #include <map>
 #include <stdint.h>
 #include <string>
@@ -124,7 +126,7 @@ public:
 
 private:
   typedef std::vector<CVariant> VariantArray;
-  typedef std::map<std::string, CVariant> VariantMap;
+  typedef CSortedNodeMap<CVariant> VariantMap;
 
 public:
   typedef VariantArray::iterator        iterator_array;
@@ -0,0 +1,367 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "XBMCTinyXMLStream.h"
+
+#include "utils/StringUtils.h"
+#include "utils/log.h"
+
+#include <algorithm>
+
+namespace
+{
+constexpr size_t READ_CHUNK_SIZE = 64 * 1024;
+
+bool IsNameEnd(char c)
+{
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '/' || c == '>';
+}
+} // namespace
+
+bool CXBMCTinyXMLStreamReader::Open(const std::string& filename)
+{
+  Close();
+  m_filename = filename;
+  if (!m_file.Open(filename))
+  {
+    CLog::LogF(LOGERROR, "unable to open {}", filename);
+    return false;
+  }
+
+  if (Ensure(2) && ((m_buffer[0] == '\xFE' && m_buffer[1] == '\xFF') ||
+                    (m_buffer[0] == '\xFF' && m_buffer[1] == '\xFE')))
+  {
+    CLog::LogF(LOGERROR, "UTF-16 encoded files are not supported ({})", filename);
+    Close();
+    return false;
+  }
+  if (Ensure(3) && m_buffer.starts_with("\xEF\xBB\xBF"))
+  {
+    m_pos = 3;
+    m_charset = "UTF-8";
+  }
+
+  // skip the prolog up to the start tag of the root element
+  TokenType type;
+  size_t start;
+  while (ReadToken(type, start))
+  {
+    if (type == TokenType::OTHER)
+    {
+      if (m_rootName.empty() && m_buffer.compare(start, 5, "<?xml") == 0)
+        ParseDeclaration(start);
+      continue;
+    }
+    if (type == TokenType::END_TAG)
+      break;
+
+    size_t end = start + 1;
+    while (end < m_pos && !IsNameEnd(m_buffer[end]))
+      end++;
+    m_rootName = m_buffer.substr(start + 1, end - start - 1);
+    m_done = type == TokenType::EMPTY_TAG;
+    return true;
+  }
+
+  CLog::LogF(LOGERROR, "no root element found in {}", filename);
+  Close();
+  return false;
+}
+
+void CXBMCTinyXMLStreamReader::Close()
+{
+  m_file.Close();
+  m_buffer.clear();
+  m_buffer.shrink_to_fit();
+  m_pos = 0;
+  m_charset.clear();
+  m_rootName.clear();
+  m_element.Clear();
+  m_done = true;
+  m_error = false;
+}
+
+const TiXmlElement* CXBMCTinyXMLStreamReader::ReadNextElement()
+{
+  if (m_done || m_error)
+    return nullptr;
+
+  // drop what has been consumed, once it's worth the move
+  if (m_pos >= READ_CHUNK_SIZE)
+  {
+    m_buffer.erase(0, m_pos);
+    m_pos = 0;
+  }
+
+  int depth = 0;
+  size_t elementStart = 0;
+  TokenType type;
+  size_t start;
+  while (ReadToken(type, start))
+  {
+    switch (type)
+    {
+      case TokenType::START_TAG:
+        if (depth++ == 0)
+          elementStart = start;
+        break;
+      case TokenType::EMPTY_TAG:
+        if (depth == 0)
+          return ParseElement(start);
+        break;
+      case TokenType::END_TAG:
+        if (depth == 0)
+        {
+          // end of the root element
+          m_done = true;
+          return nullptr;
+        }
+        if (--depth == 0)
+          return ParseElement(elementStart);
+        break;
+      case TokenType::OTHER:
+        break;
+    }
+  }
+
+  CLog::LogF(LOGERROR, "unexpected end of file in {}", m_filename);
+  m_error = true;
+  return nullptr;
+}
+
+bool CXBMCTinyXMLStreamReader::ReadToken(TokenType& type, size_t& start)
+{
+  start = Find("<", m_pos);
+  if (start == std::string::npos || !Ensure(start + 2))
+    return false;
+
+  size_t end;
+  type = TokenType::OTHER;
+  if (m_buffer[start + 1] == '?')
+  {
+    end = Find("?>", start + 2);
+    if (end != std::string::npos)
+      end += 1;
+  }
+  else if (m_buffer[start + 1] == '!')
+  {
+    Ensure(start + 9);
+    if (m_buffer.compare(start, 4, "<!--") == 0)
+    {
+      end = Find("-->", start + 4);
+      if (end != std::string::npos)
+        end += 2;
+    }
+    else if (m_buffer.compare(start, 9, "<![CDATA[") == 0)
+    {
+      end = Find("]]>", start + 9);
+      if (end != std::string::npos)
+        end += 2;
+    }
+    else
+      end = FindTagEnd(start + 2, true); // DOCTYPE, possibly with an internal subset
+  }
+  else if (m_buffer[start + 1] == '/')
+  {
+    end = FindTagEnd(start + 2, false);
+    type = TokenType::END_TAG;
+  }
+  else
+  {
+    end = FindTagEnd(start + 1, false);
+    if (end != std::string::npos)
+      type = m_buffer[end - 1] == '/' ? TokenType::EMPTY_TAG : TokenType::START_TAG;
+  }
+
+  if (end == std::string::npos)
+    return false;
+
+  m_pos = end + 1;
+  return true;
+}
+
+size_t CXBMCTinyXMLStreamReader::Find(std::string_view str, size_t from)
+{
+  while (true)
+  {
+    const size_t pos = m_buffer.find(str, from);
+    if (pos != std::string::npos)
+      return pos;
+
+    // a match may straddle the end of the data read so far
+    if (m_buffer.size() >= str.size())
+      from = std::max(from, m_buffer.size() - str.size() + 1);
+    if (!Fill())
+      return std::string::npos;
+  }
+}
+
+size_t CXBMCTinyXMLStreamReader::FindTagEnd(size_t from, bool brackets)
+{
+  char quote = 0;
+  int bracketDepth = 0;
+  for (size_t pos = from;; ++pos)
+  {
+    if (pos >= m_buffer.size() && !Fill())
+      return std::string::npos;
+
+    const char c = m_buffer[pos];
+    if (quote)
+    {
+      if (c == quote)
+        quote = 0;
+    }
+    else if (c == '"' || c == '\'')
+      quote = c;
+    else if (brackets && c == '[')
+      bracketDepth++;
+    else if (brackets && c == ']')
+      bracketDepth--;
+    else if (c == '>' && bracketDepth <= 0)
+      return pos;
+  }
+}
+
+bool CXBMCTinyXMLStreamReader::Ensure(size_t size)
+{
+  while (m_buffer.size() < size)
+  {
+    if (!Fill())
+      return false;
+  }
+  return true;
+}
+
+bool CXBMCTinyXMLStreamReader::Fill()
+{
+  const size_t size = m_buffer.size();
+  m_buffer.resize(size + READ_CHUNK_SIZE);
+  const ssize_t read = m_file.Read(m_buffer.data() + size, READ_CHUNK_SIZE);
+  m_buffer.resize(size + std::max<ssize_t>(read, 0));
+  return read > 0;
+}
+
+void CXBMCTinyXMLStreamReader::ParseDeclaration(size_t start)
+{
+  const std::string_view decl(m_buffer.data() + start, m_pos - start);
+  size_t pos = decl.find("encoding");
+  if (pos == std::string_view::npos)
+    return;
+
+  pos = decl.find_first_of("\"'", pos);
+  if (pos == std::string_view::npos)
+    return;
+  const size_t end = decl.find(decl[pos], pos + 1);
+  if (end == std::string_view::npos)
+    return;
+
+  m_charset = decl.substr(pos + 1, end - pos - 1);
+  StringUtils::ToUpper(m_charset);
+}
+
+const TiXmlElement* CXBMCTinyXMLStreamReader::ParseElement(size_t start)
+{
+  m_element.Clear();
+  const std::string data(m_buffer, start, m_pos - start);
+  if (!m_element.Parse(data, m_charset) || !m_element.RootElement())
+  {
+    CLog::LogF(LOGERROR, "error parsing element at offset {} of {}: {}", start, m_filename,
+               m_element.ErrorDesc());
+    m_error = true;
+    return nullptr;
+  }
+  return m_element.RootElement();
+}
+
+CXBMCTinyXMLStreamWriter::~CXBMCTinyXMLStreamWriter()
+{
+  Discard();
+}
+
+bool CXBMCTinyXMLStreamWriter::Open(const std::string& filename, const std::string& rootName)
+{
+  Discard();
+  m_filename = filename;
+  m_tempFilename = filename + ".tmp";
+  if (!m_file.OpenForWrite(m_tempFilename, true))
+  {
+    CLog::LogF(LOGERROR, "unable to create {}", m_tempFilename);
+    return false;
+  }
+
+  m_open = true;
+  m_error = false;
+  m_rootName = rootName;
+
+  TiXmlPrinter printer;
+  TiXmlDeclaration decl("1.0", "UTF-8", "yes");
+  decl.Accept(&printer);
+  return Write(printer.Str()) && Write("<" + m_rootName + ">\n");
+}
+
+bool CXBMCTinyXMLStreamWriter::WriteChildren(TiXmlNode* parent)
+{
+  while (TiXmlNode* child = parent->FirstChild())
+  {
+    if (m_open)
+    {
+      TiXmlPrinter printer;
+      child->Accept(&printer);
+      Write(printer.Str());
+    }
+    parent->RemoveChild(child);
+  }
+  return m_open && !m_error;
+}
+
+bool CXBMCTinyXMLStreamWriter::Close()
+{
+  if (!m_open)
+    return false;
+
+  Write("</" + m_rootName + ">\n");
+  if (!m_error)
+    m_file.Flush();
+  m_file.Close();
+  m_open = false;
+
+  if (m_error)
+  {
+    XFILE::CFile::Delete(m_tempFilename);
+    return false;
+  }
+
+  // not every file system replaces an existing file on rename
+  if (!XFILE::CFile::Rename(m_tempFilename, m_filename) &&
+      (!XFILE::CFile::Delete(m_filename) || !XFILE::CFile::Rename(m_tempFilename, m_filename)))
+  {
+    CLog::LogF(LOGERROR, "unable to replace {}", m_filename);
+    XFILE::CFile::Delete(m_tempFilename);
+    return false;
+  }
+  return true;
+}
+
+void CXBMCTinyXMLStreamWriter::Discard()
+{
+  if (!m_open)
+    return;
+
+  m_file.Close();
+  m_open = false;
+  XFILE::CFile::Delete(m_tempFilename);
+}
+
+bool CXBMCTinyXMLStreamWriter::Write(std::string_view data)
+{
+  if (m_error)
+    return false;
+  if (m_file.Write(data.data(), data.size()) != static_cast<ssize_t>(data.size()))
+    m_error = true;
+  return !m_error;
+}
@@ -0,0 +1,128 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "filesystem/File.h"
+#include "utils/XBMCTinyXML.h"
+
+#include <string>
+#include <string_view>
+
+/*!
+ \brief Pull reader handing out the child elements of a document's root one at a time.
+
+ Only the element currently being handed out is held as a DOM, so memory use is
+ bounded by the largest child of the root instead of the size of the whole file.
+ Intended for flat documents with many records such as the single file library
+ export, where loading everything into a CXBMCTinyXML would not fit on devices
+ with little memory.
+
+ Text, comments and processing instructions directly below the root are skipped.
+ The data must use an ASCII compatible encoding; the encoding from the XML
+ declaration is applied to every child when it is parsed.
+ */
+class CXBMCTinyXMLStreamReader
+{
+public:
+  /*!
+   \brief Open a file and read up to the start tag of the root element.
+   \return false if the file can't be opened or has no root element.
+   */
+  bool Open(const std::string& filename);
+  void Close();
+
+  const std::string& GetRootName() const { return m_rootName; }
+
+  /*!
+   \brief Read the next child element of the root element.
+   \return the element, valid until the next call, or nullptr once the end of the
+   root element is reached or on error (see HasError()).
+   */
+  const TiXmlElement* ReadNextElement();
+
+  bool HasError() const { return m_error; }
+
+private:
+  enum class TokenType
+  {
+    START_TAG,
+    END_TAG,
+    EMPTY_TAG,
+    OTHER
+  };
+
+  bool ReadToken(TokenType& type, size_t& start);
+  size_t Find(std::string_view str, size_t from);
+  size_t FindTagEnd(size_t from, bool brackets);
+  bool Ensure(size_t size);
+  bool Fill();
+  void ParseDeclaration(size_t start);
+  const TiXmlElement* ParseElement(size_t start);
+
+  XFILE::CFile m_file;
+  std::string m_filename;
+  std::string m_buffer;
+  size_t m_pos{0};
+  std::string m_charset;
+  std::string m_rootName;
+  CXBMCTinyXML m_element;
+  bool m_done{true};
+  bool m_error{false};
+};
+
+/*!
+ \brief Push writer streaming the children of a root element to a file.
+
+ Counterpart of CXBMCTinyXMLStreamReader: callers build each record below a
+ detached parent node and hand it to WriteChildren(), which writes the records
+ out and removes them from the parent, so the whole document never has to be
+ kept in memory.
+
+ The document is written to a temporary file next to the target, which only
+ replaces the target in Close(). A writer destroyed without a successful
+ Close(), e.g. on cancel or an exception, leaves the previous file in place.
+ */
+class CXBMCTinyXMLStreamWriter
+{
+public:
+  ~CXBMCTinyXMLStreamWriter();
+
+  /*!
+   \brief Create the temporary file and write the XML declaration and root start tag.
+   */
+  bool Open(const std::string& filename, const std::string& rootName);
+
+  /*!
+   \brief Write all children of the given node and remove them from it.
+   */
+  bool WriteChildren(TiXmlNode* parent);
+
+  /*!
+   \brief Write the root end tag, close the file and move it over the target.
+   \return false if writing failed, the target is left unchanged then
+   */
+  bool Close();
+
+  /*!
+   \brief Close and delete the temporary file, leaving the target unchanged.
+   */
+  void Discard();
+
+  bool IsOpen() const { return m_open; }
+
+private:
+  bool Write(std::string_view data);
+
+  XFILE::CFile m_file;
+  std::string m_filename;
+  std::string m_tempFilename;
+  std::string m_rootName;
+  bool m_open{false};
+  bool m_error{false};
+};
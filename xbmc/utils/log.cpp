@@ -18,11 +18,17 @@
 #include "settings/SettingsContainer.h"
 #include "settings/lib/Setting.h"
 #include "settings/lib/SettingsManager.h"
+#include "threads/Thread.h"
 #include "utils/Map.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 
+#include <algorithm>
+#include <bit>
+#include <condition_variable>
 #include <cstring>
+#include <deque>
+#include <mutex>
 #include <set>
 
 #include <spdlog/sinks/basic_file_sink.h>
@@ -83,11 +89,180 @@ constexpr auto componentMap = make_map<int, ComponentInfo>({
 
 } // unnamed namespace
 
+/*!
+ * \brief Sink writing to another sink, either directly or from its own thread through a bounded
+ * queue so that threads logging at a high rate don't wait for the disk.
+ */
+class CAsyncLogSink : public spdlog::sinks::sink, private CThread
+{
+public:
+  explicit CAsyncLogSink(std::shared_ptr<spdlog::sinks::sink> sink)
+    : CThread("AsyncLogSink"), m_sink(std::move(sink))
+  {
+  }
+
+  ~CAsyncLogSink() override
+  {
+    {
+      std::unique_lock lock(m_mutex);
+      m_stop = true;
+    }
+    m_queueChanged.notify_all();
+    StopThread(true);
+
+    // the writer is gone, write whatever it left behind
+    std::unique_lock writeLock(m_writeMutex);
+    for (const auto& msg : m_queue)
+      m_sink->log(msg);
+    m_sink->flush();
+  }
+
+  void SetQueueSize(size_t queueSize, bool dropOldest)
+  {
+    if (queueSize == 0)
+      Drain();
+
+    {
+      std::unique_lock lock(m_mutex);
+      m_queueSize = queueSize;
+      m_dropOldest = dropOldest;
+    }
+    m_queueChanged.notify_all();
+
+    if (queueSize > 0 && !IsRunning())
+      Create();
+  }
+
+  //! Wait until everything queued so far has been written
+  void Drain()
+  {
+    std::unique_lock lock(m_mutex);
+    m_queueChanged.wait(lock, [this] { return (m_queue.empty() && !m_writing) || !IsRunning(); });
+    lock.unlock();
+
+    std::unique_lock writeLock(m_writeMutex);
+    m_sink->flush();
+  }
+
+  void log(const spdlog::details::log_msg& msg) override
+  {
+    std::unique_lock lock(m_mutex);
+    if (m_queueSize == 0)
+    {
+      lock.unlock();
+      std::unique_lock writeLock(m_writeMutex);
+      m_sink->log(msg);
+      return;
+    }
+
+    if (m_queue.size() >= m_queueSize)
+    {
+      if (m_dropOldest)
+      {
+        m_queue.pop_front();
+        ++m_dropped;
+      }
+      else
+        m_queueChanged.wait(lock, [this]
+                            { return m_queue.size() < m_queueSize || m_queueSize == 0 || m_stop; });
+    }
+
+    m_queue.emplace_back(msg);
+    lock.unlock();
+    m_queueChanged.notify_all();
+  }
+
+  void flush() override
+  {
+    std::unique_lock lock(m_mutex);
+    if (m_queueSize == 0)
+    {
+      lock.unlock();
+      std::unique_lock writeLock(m_writeMutex);
+      m_sink->flush();
+      return;
+    }
+
+    // spdlog flushes after every message, only let the writer flush once it ran out of work
+    m_flush = true;
+  }
+
+  void set_pattern(const std::string& pattern) override
+  {
+    std::unique_lock writeLock(m_writeMutex);
+    m_sink->set_pattern(pattern);
+  }
+
+  void set_formatter(std::unique_ptr<spdlog::formatter> formatter) override
+  {
+    std::unique_lock writeLock(m_writeMutex);
+    m_sink->set_formatter(std::move(formatter));
+  }
+
+protected:
+  void Process() override
+  {
+    std::deque<spdlog::details::log_msg_buffer> batch;
+    std::unique_lock lock(m_mutex);
+    while (true)
+    {
+      m_queueChanged.wait(lock, [this] { return !m_queue.empty() || m_stop; });
+      if (m_stop)
+        break;
+
+      batch.swap(m_queue);
+      const size_t dropped = std::exchange(m_dropped, 0);
+      const bool flush = std::exchange(m_flush, false);
+      m_writing = true;
+      lock.unlock();
+      m_queueChanged.notify_all();
+
+      {
+        std::unique_lock writeLock(m_writeMutex);
+        if (dropped > 0)
+        {
+          const std::string message =
+              fmt::format("{} log messages dropped, the log writer could not keep up", dropped);
+          m_sink->log(spdlog::details::log_msg(batch.front().logger_name, spdlog::level::warn,
+                                               message));
+        }
+        for (const auto& msg : batch)
+          m_sink->log(msg);
+        if (flush)
+          m_sink->flush();
+      }
+      batch.clear();
+
+      lock.lock();
+      m_writing = false;
+      m_queueChanged.notify_all();
+    }
+  }
+
+private:
+  const std::shared_ptr<spdlog::sinks::sink> m_sink;
+  // serializes all access to m_sink, which is not thread-safe
+  std::mutex m_writeMutex;
+
+  std::mutex m_mutex;
+  std::condition_variable m_queueChanged;
+  std::deque<spdlog::details::log_msg_buffer> m_queue;
+  size_t m_queueSize{0};
+  bool m_dropOldest{false};
+  size_t m_dropped{0};
+  bool m_flush{false};
+  bool m_writing{false};
+  bool m_stop{false};
+};
+
 CLog::CLog()
   : m_platform(IPlatformLog::CreatePlatformLog()),
     m_sinks(std::make_shared<spdlog::sinks::dist_sink_mt>()),
     m_defaultLogger(CreateLogger("general"))
 {
+  for (auto& level : m_componentLevels)
+    level = NO_COMPONENT_LEVEL;
+
   // add platform-specific debug sinks
   m_platform->AddSinks(m_sinks);
 
@@ -171,7 +346,8 @@ void CLog::Initialize(const std::string& path)
       m_platform->GetLogFilename(filePath), false);
   basicFileSink->set_pattern(LogPattern);
   duplicateFilterSink->add_sink(basicFileSink);
-  m_fileSink = duplicateFilterSink;
+  m_fileSink = std::make_shared<CAsyncLogSink>(duplicateFilterSink);
+  m_fileSink->SetQueueSize(m_asyncQueueSize, m_asyncDropOldest);
 
   // add it to the existing sinks
   m_sinks->add_sink(m_fileSink);
@@ -196,7 +372,7 @@ void CLog::Deinitialize()
   spdlog::apply_all([](const std::shared_ptr<spdlog::logger>& logger) { logger->flush(); });
 
   // flush the file sink
-  m_fileSink->flush();
+  m_fileSink->Drain();
 
   // remove and destroy the file sink
   m_sinks->remove_sink(m_fileSink);
@@ -220,6 +396,7 @@ void CLog::SetLogLevel(int level)
     return;
 
   spdlog::set_level(spdLevel);
+  ApplyComponentLogLevels();
   FormatAndLogInternal(spdlog::level::info, LOG_COMPONENT_GENERAL, "Log level changed to \"{}\"",
                        fmt::make_format_args(spdlog::level::to_string_view(spdLevel)));
 }
@@ -234,11 +411,59 @@ bool CLog::IsLogLevelLogged(int loglevel) const
   return (loglevel & LOGMASK) >= LOGINFO;
 }
 
+void CLog::SetAsyncLogging(size_t queueSize, bool dropOldest)
+{
+  m_asyncQueueSize = queueSize;
+  m_asyncDropOldest = dropOldest;
+
+  if (m_fileSink != nullptr)
+    m_fileSink->SetQueueSize(queueSize, dropOldest);
+}
+
+bool CLog::SetComponentLogLevel(const std::string& componentName, int level)
+{
+  const auto it = std::ranges::find_if(componentMap, [&componentName](const auto& component)
+                                       { return componentName == component.second.name; });
+  if (it == componentMap.cend())
+    return false;
+
+  const int index = std::countr_zero(static_cast<uint32_t>(it->first));
+  m_componentLevels[index] = level < 0 ? NO_COMPONENT_LEVEL : MapLogLevel(level);
+  ApplyComponentLogLevels();
+
+  return true;
+}
+
+int CLog::GetComponentLogLevel(uint32_t component) const
+{
+  if (component == LOG_COMPONENT_GENERAL)
+    return NO_COMPONENT_LEVEL;
+
+  return m_componentLevels[std::countr_zero(component)];
+}
+
+void CLog::ApplyComponentLogLevels()
+{
+  for (const auto& [id, names] : componentMap)
+  {
+    const int level = GetComponentLogLevel(id);
+    if (level != NO_COMPONENT_LEVEL)
+      GetLogger(names.name)->set_level(static_cast<spdlog::level::level_enum>(level));
+    else if (auto logger = spdlog::get(names.name))
+      logger->set_level(m_defaultLogger->level());
+  }
+}
+
 bool CLog::CanLogComponent(uint32_t component) const
 {
   if (component == LOG_COMPONENT_GENERAL)
     return true;
 
+  // an explicit level enables the component regardless of the settings
+  const int level = GetComponentLogLevel(component);
+  if (level != NO_COMPONENT_LEVEL)
+    return level != spdlog::level::off;
+
   if (!m_componentLogEnabled)
     return false;
 
@@ -311,7 +536,9 @@ void CLog::FormatAndLogInternal(spdlog::level::level_enum level,
                                 fmt::string_view format,
                                 fmt::format_args args)
 {
-  if (level < m_defaultLogger->level())
+  // check before formatting, so components that are not under investigation stay cheap
+  const int componentLevel = GetComponentLogLevel(component);
+  if (level < (componentLevel != NO_COMPONENT_LEVEL ? componentLevel : m_defaultLogger->level()))
     return;
 
   auto message = fmt::vformat(format, args);
@@ -30,6 +30,8 @@
 #include "utils/IPlatformLog.h"
 #include "utils/logtypes.h"
 
+#include <array>
+#include <atomic>
 #include <source_location>
 #include <string>
 #include <vector>
@@ -44,6 +46,8 @@ template<typename Mutex>
 class dist_sink;
 } // namespace spdlog::sinks
 
+class CAsyncLogSink;
+
 #if FMT_VERSION >= 100000
 using fmt::enums::format_as;
 
@@ -79,6 +83,24 @@ public:
   int GetLogLevel() const { return m_logLevel; }
   bool IsLogLevelLogged(int loglevel) const;
 
+  /*!
+   * \brief Write the log file from a background thread through a bounded queue, so threads
+   * logging at a high rate don't wait for the disk.
+   * \param queueSize number of buffered messages, 0 writes from the logging thread itself
+   * \param dropOldest whether a full queue drops its oldest message or blocks the logging thread
+   */
+  void SetAsyncLogging(size_t queueSize, bool dropOldest);
+
+  /*!
+   * \brief Override the log level of a single component, e.g. to debug one subsystem while
+   * everything else stays at the global level. Overridden components are logged regardless of
+   * the component logging settings.
+   * \param componentName name of the component as used for its logger, e.g. "video"
+   * \param level LOGDEBUG to LOGNONE, or -1 to remove the override
+   * \return false if there is no component with that name
+   */
+  bool SetComponentLogLevel(const std::string& componentName, int level);
+
   bool CanLogComponent(uint32_t component) const;
   static void SettingOptionsLoggingComponentsFiller(const std::shared_ptr<const CSetting>& setting,
                                                     std::vector<IntegerSettingOption>& list,
@@ -164,16 +186,25 @@ private:
 
   void SetComponentLogLevel(const std::vector<CVariant>& components);
 
+  int GetComponentLogLevel(uint32_t component) const;
+  void ApplyComponentLogLevels();
+
   void FormatLineBreaks(std::string& message) const;
 
   std::unique_ptr<IPlatformLog> m_platform;
   std::shared_ptr<spdlog::sinks::dist_sink<std::mutex>> m_sinks;
   Logger m_defaultLogger;
 
-  std::shared_ptr<spdlog::sinks::sink> m_fileSink;
+  std::shared_ptr<CAsyncLogSink> m_fileSink;
+  size_t m_asyncQueueSize{0};
+  bool m_asyncDropOldest{false};
 
   int m_logLevel{LOG_LEVEL_DEBUG};
 
   bool m_componentLogEnabled{false};
   uint32_t m_componentLogLevels{0};
+
+  // spdlog level of each component (indexed by bit), overriding the global level
+  static constexpr int NO_COMPONENT_LEVEL = -1;
+  std::array<std::atomic<int>, 32> m_componentLevels;
 };
@@ -399,3 +399,32 @@ TEST_F(TestCharsetConverter, fromW)
   g_charsetConverter.fromW(refstrw1, varstra1, "UTF-16LE");
   EXPECT_STREQ(refstra1.c_str(), varstra1.c_str());
 }
+
+TEST_F(TestCharsetConverter, utf8ToUtf32_roundTrip)
+{
+  const std::string utf8 = "plain US-ASCII prefix, then \xC3\xBC\xE2\x82\xAC\xF0\x9D\x84\x9E";
+  const std::u32string utf32 = U"plain US-ASCII prefix, then ü€\U0001D11E";
+
+  std::u32string varutf32;
+  EXPECT_TRUE(g_charsetConverter.utf8ToUtf32(utf8, varutf32));
+  EXPECT_EQ(utf32, varutf32);
+
+  std::string varutf8;
+  EXPECT_TRUE(g_charsetConverter.utf32ToUtf8(varutf32, varutf8));
+  EXPECT_EQ(utf8, varutf8);
+}
+
+TEST_F(TestCharsetConverter, utf8ToUtf32_invalid)
+{
+  // overlong form, encoded surrogate and truncated sequence
+  const std::string utf8 = "ab\xC0\x80"
+                           "cd\xED\xA0\x80"
+                           "e\xF0\x9F";
+
+  std::u32string varutf32;
+  EXPECT_FALSE(g_charsetConverter.utf8ToUtf32(utf8, varutf32, true));
+  EXPECT_TRUE(varutf32.empty());
+
+  EXPECT_TRUE(g_charsetConverter.utf8ToUtf32(utf8, varutf32, false));
+  EXPECT_EQ(U"abcde", varutf32);
+}
@@ -0,0 +1,125 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "filesystem/File.h"
+#include "test/TestUtils.h"
+#include "utils/ContainerTagReader.h"
+
+#include <span>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace XFILE;
+
+namespace
+{
+std::string GetTag(const ContainerTags& tags, std::string_view name)
+{
+  const std::string* value = tags.Get(name);
+  return value ? *value : "<none>";
+}
+
+bool ReadMatroska(std::span<const uint8_t> data)
+{
+  CFile* file = XBMC_CREATETEMPFILE("");
+  if (!file)
+    return false;
+  file->Close();
+
+  bool result = false;
+  if (file->OpenForWrite(XBMC_TEMPFILEPATH(file), true) &&
+      file->Write(data.data(), data.size()) == static_cast<ssize_t>(data.size()))
+  {
+    file->Close();
+    ContainerTags tags;
+    result = file->Open(XBMC_TEMPFILEPATH(file)) && CContainerTagReader::ReadMatroska(*file, tags);
+  }
+  file->Close();
+  XBMC_DELETETEMPFILE(file);
+  return result;
+}
+} // namespace
+
+TEST(TestContainerTagReader, Matroska)
+{
+  CFile file;
+  ASSERT_TRUE(file.Open(XBMC_REF_FILE_PATH("xbmc/utils/test/resources/tags.mkv")));
+
+  ContainerTags tags;
+  ASSERT_TRUE(CContainerTagReader::ReadMatroska(file, tags));
+
+  // the global tag replaces the segment title, the one of the track is ignored
+  EXPECT_EQ("Tag Title", GetTag(tags, "title"));
+  EXPECT_EQ("Director A / Director B", GetTag(tags, "DIRECTOR"));
+  EXPECT_EQ("2001", GetTag(tags, "date_released"));
+  EXPECT_EQ("https://example.com", GetTag(tags, "ARTIST/URL"));
+  EXPECT_EQ("Zusammenfassung", GetTag(tags, "SUMMARY-ger"));
+  EXPECT_EQ(nullptr, tags.Get("SUMMARY"));
+
+  // the font isn't returned
+  ASSERT_EQ(1u, tags.attachments.size());
+  EXPECT_EQ("cover.jpg", tags.attachments[0].filename);
+  EXPECT_EQ("image/jpeg", tags.attachments[0].mimetype);
+  EXPECT_EQ(8u, tags.attachments[0].data.size());
+
+  file.Seek(0);
+  EXPECT_FALSE(CContainerTagReader::ReadMp4(file, tags));
+}
+
+TEST(TestContainerTagReader, Mp4)
+{
+  CFile file;
+  ASSERT_TRUE(file.Open(XBMC_REF_FILE_PATH("xbmc/utils/test/resources/tags.mp4")));
+
+  ContainerTags tags;
+  ASSERT_TRUE(CContainerTagReader::ReadMp4(file, tags));
+
+  EXPECT_EQ("MP4 Title", GetTag(tags, "title"));
+  EXPECT_EQ("Drama / Comedy", GetTag(tags, "genre"));
+  EXPECT_EQ("2010-05-01", GetTag(tags, "date"));
+  EXPECT_EQ("Long description", GetTag(tags, "synopsis"));
+  EXPECT_EQ("3/12", GetTag(tags, "track"));
+  EXPECT_EQ("2", GetTag(tags, "season_number"));
+  EXPECT_EQ("custom value", GetTag(tags, "CUSTOM"));
+  EXPECT_EQ("Comment", GetTag(tags, "comment"));
+
+  ASSERT_EQ(2u, tags.attachments.size());
+  EXPECT_EQ("image/png", tags.attachments[0].mimetype);
+  EXPECT_EQ(8u, tags.attachments[0].data.size());
+  EXPECT_EQ("image/jpeg", tags.attachments[1].mimetype);
+
+  file.Seek(0);
+  EXPECT_FALSE(CContainerTagReader::ReadMatroska(file, tags));
+}
+
+TEST(TestContainerTagReader, MatroskaCorrupt)
+{
+  // a seek of unknown size ends with the seek head, its seek id starts behind that end
+  std::vector<uint8_t> data = {
+      0x1A, 0x45, 0xDF, 0xA3, 0x8B, 0x42, 0x82, 0x88, 'm', 'a', 't', 'r', 'o', 's', 'k', 'a',
+      0x18, 0x53, 0x80, 0x67, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x11, 0x4D, 0x9B, 0x74, 0x84, 0x4D, 0xBB, 0xFF, 0x53, 0xAB, 0xFF};
+  data.resize(data.size() + 64 * 1024, 0x42);
+  EXPECT_FALSE(ReadMatroska(data));
+
+  // an element running past the end of its parent
+  data.resize(36);
+  data[32] = 0x83;
+  data.insert(data.end(), {0x4D, 0xBB, 0x88});
+  data.resize(data.size() + 16, 0x42);
+  EXPECT_FALSE(ReadMatroska(data));
+
+  // every truncation of a valid file
+  CFile file;
+  ASSERT_TRUE(file.Open(XBMC_REF_FILE_PATH("xbmc/utils/test/resources/tags.mkv")));
+  std::vector<uint8_t> valid(static_cast<size_t>(file.GetLength()));
+  ASSERT_EQ(static_cast<ssize_t>(valid.size()), file.Read(valid.data(), valid.size()));
+  for (size_t size = 0; size < valid.size(); size += 7)
+    ReadMatroska(std::span(valid).first(size));
+}
@@ -0,0 +1,97 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "filesystem/File.h"
+#include "test/TestUtils.h"
+#include "utils/FileExistenceChecker.h"
+#include "utils/StringUtils.h"
+#include "utils/URIUtils.h"
+
+#include <algorithm>
+#include <ctime>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+class TestFileExistenceChecker : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_file = XBMC_CREATETEMPFILE(".mkv");
+    ASSERT_NE(nullptr, m_file);
+    m_file->Close();
+    m_path = XBMC_TEMPFILEPATH(m_file);
+    m_checkpoint = URIUtils::AddFileToFolder(URIUtils::GetDirectory(m_path), "checkpoint.json");
+  }
+
+  void TearDown() override
+  {
+    XFILE::CFile::Delete(m_checkpoint);
+    EXPECT_TRUE(XBMC_DELETETEMPFILE(m_file));
+  }
+
+  void WriteCheckpoint(const std::string& scope, const std::string& missing)
+  {
+    std::string directory = URIUtils::GetDirectory(m_path);
+    StringUtils::Replace(directory, "\\", "\\\\");
+    const std::string json =
+        StringUtils::Format(R"({{"scope":"{}","time":{},"directories":[{{"path":"{}",)"
+                            R"("missing":[{}]}}]}})",
+                            scope, static_cast<long long>(std::time(nullptr)), directory, missing);
+    XFILE::CFile file;
+    ASSERT_TRUE(file.OpenForWrite(m_checkpoint, true));
+    ASSERT_EQ(static_cast<ssize_t>(json.size()), file.Write(json.data(), json.size()));
+  }
+
+  XFILE::CFile* m_file{nullptr};
+  std::string m_path;
+  std::string m_checkpoint;
+};
+} // namespace
+
+TEST_F(TestFileExistenceChecker, FindsMissingFiles)
+{
+  const std::string directory = URIUtils::GetDirectory(m_path);
+  CFileExistenceChecker checker("", "all");
+  checker.AddFile(1, m_path);
+  checker.AddFile(2, URIUtils::AddFileToFolder(directory, "missing.mkv"));
+  checker.AddFile(3, URIUtils::AddFileToFolder(directory, "missing/missing.mkv"));
+
+  EXPECT_TRUE(checker.Run([](size_t checked, size_t total) { return checked <= total; }));
+  std::vector<int> missing = checker.GetMissing();
+  std::ranges::sort(missing);
+  EXPECT_EQ((std::vector<int>{2, 3}), missing);
+}
+
+TEST_F(TestFileExistenceChecker, ResumesFromCheckpoint)
+{
+  // the checkpoint claims the directory was checked and the existing file found missing
+  WriteCheckpoint("all", "1, 5");
+
+  CFileExistenceChecker checker(m_checkpoint, "all");
+  checker.AddFile(1, m_path);
+  EXPECT_TRUE(checker.Run({}));
+  EXPECT_EQ(std::vector<int>{1}, checker.GetMissing());
+
+  checker.Finish();
+  EXPECT_FALSE(XFILE::CFile::Exists(m_checkpoint, false));
+}
+
+TEST_F(TestFileExistenceChecker, IgnoresCheckpointOfOtherScope)
+{
+  WriteCheckpoint("1,2", "1");
+
+  CFileExistenceChecker checker(m_checkpoint, "all");
+  checker.AddFile(1, m_path);
+  EXPECT_TRUE(checker.Run({}));
+  EXPECT_TRUE(checker.GetMissing().empty());
+}
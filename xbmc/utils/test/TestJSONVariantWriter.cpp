@@ -9,7 +9,73 @@
 #include "utils/JSONVariantWriter.h"
 #include "utils/Variant.h"
 
+#include <chrono>
+#include <iostream>
+#include <string>
+
 #include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+namespace
+{
+CVariant MakeLibrary(int count)
+{
+  CVariant result;
+  for (int i = 0; i < count; i++)
+  {
+    CVariant movie;
+    movie["movieid"] = i;
+    movie["label"] = "Movie \"" + std::to_string(i) + "\"";
+    movie["plot"] = "A rather long plot describing what happens in movie number " +
+                    std::to_string(i) + ".\nIt goes on for a while.";
+    movie["rating"] = 5.0 + (i % 50) / 10.0;
+    movie["playcount"] = static_cast<unsigned int>(i % 3);
+    movie["genre"].push_back("Drama");
+    movie["genre"].push_back("Com\xC3\xA9die");
+    movie["resume"]["position"] = 0.0;
+    movie["resume"]["total"] = 0.0;
+    result["movies"].push_back(movie);
+  }
+  result["limits"]["start"] = 0;
+  result["limits"]["end"] = count;
+  result["limits"]["total"] = count;
+  return result;
+}
+
+// the DOM based serialization used before CJSONVariantStreamWriter, for comparison
+nlohmann::json ToDom(const CVariant& value)
+{
+  switch (value.type())
+  {
+    case CVariant::VariantTypeInteger:
+      return value.asInteger();
+    case CVariant::VariantTypeUnsignedInteger:
+      return value.asUnsignedInteger();
+    case CVariant::VariantTypeDouble:
+      return value.asDouble();
+    case CVariant::VariantTypeBoolean:
+      return value.asBoolean();
+    case CVariant::VariantTypeString:
+      return value.asString();
+    case CVariant::VariantTypeArray:
+    {
+      nlohmann::json array = nlohmann::json::array();
+      for (auto it = value.begin_array(); it != value.end_array(); ++it)
+        array.push_back(ToDom(*it));
+      return array;
+    }
+    case CVariant::VariantTypeObject:
+    {
+      nlohmann::json object = nlohmann::json::object();
+      for (auto it = value.begin_map(); it != value.end_map(); ++it)
+        object[it->first] = ToDom(it->second);
+      return object;
+    }
+    default:
+      return nullptr;
+  }
+}
+} // namespace
 
 TEST(TestJSONVariantWriter, CanWriteNull)
 {
@@ -149,3 +215,113 @@ TEST(TestJSONVariantWriter, CanWriteArray)
   ASSERT_TRUE(CJSONVariantWriter::Write(variant, str, false));
   ASSERT_STREQ("[\n\t{\n\t\t\"foo\": \"bar\"\n\t}\n]", str.c_str());
 }
+
+TEST(TestJSONVariantWriter, CanWriteCompact)
+{
+  CVariant variant;
+  variant["foo"].push_back(1);
+  variant["foo"].push_back(CVariant(CVariant::VariantTypeObject));
+  variant["bar"] = 0.5;
+  std::string str;
+  ASSERT_TRUE(CJSONVariantWriter::Write(variant, str, true));
+  ASSERT_STREQ("{\"bar\":0.5,\"foo\":[1,{}]}", str.c_str());
+}
+
+TEST(TestJSONVariantWriter, CanEscapeString)
+{
+  CVariant variant("\"a\\b\"\n\t\x01 \xC3\xA4\xE2\x82\xAC\xF0\x9F\x8E\xAC");
+  std::string str;
+  ASSERT_TRUE(CJSONVariantWriter::Write(variant, str, false));
+  ASSERT_STREQ("\"\\\"a\\\\b\\\"\\n\\t\\u0001 \xC3\xA4\xE2\x82\xAC\xF0\x9F\x8E\xAC\"", str.c_str());
+
+  // invalid UTF-8 fails like before and leaves the output alone
+  str = "unchanged";
+  variant = CVariant(CVariant::VariantTypeObject);
+  variant["key"] = "\xC3";
+  ASSERT_FALSE(CJSONVariantWriter::Write(variant, str, false));
+  ASSERT_STREQ("unchanged", str.c_str());
+
+  variant = "\xED\xA0\x80"; // surrogate
+  ASSERT_FALSE(CJSONVariantWriter::Write(variant, str, true));
+}
+
+TEST(TestJSONVariantWriter, CanStream)
+{
+  CVariant variant;
+  for (int i = 0; i < 5000; i++)
+  {
+    CVariant item;
+    item["id"] = i;
+    item["label"] = "item " + std::to_string(i);
+    item["tags"].push_back("a");
+    item["tags"].push_back(CVariant(CVariant::VariantTypeArray));
+    variant["items"].push_back(item);
+  }
+  variant["limits"]["total"] = 5000;
+
+  for (bool compact : {false, true})
+  {
+    std::string expected;
+    ASSERT_TRUE(CJSONVariantWriter::Write(variant, expected, compact));
+
+    CJSONVariantStreamWriter writer(variant, compact);
+    std::string streamed;
+    char buffer[7];
+    while (!writer.IsDone())
+      streamed.append(buffer, writer.Read(buffer, sizeof(buffer)));
+
+    EXPECT_FALSE(writer.HasFailed());
+    EXPECT_EQ(expected, streamed);
+    EXPECT_EQ(0u, writer.Read(buffer, sizeof(buffer)));
+  }
+}
+
+TEST(TestJSONVariantWriter, CanReuseOutput)
+{
+  const CVariant variant = MakeLibrary(10);
+  std::string expected = ToDom(variant).dump(-1);
+
+  std::string str = "previous content";
+  ASSERT_TRUE(CJSONVariantWriter::Write(variant, str, true));
+  EXPECT_EQ(expected, str);
+
+  // a second document fits into the already allocated buffer
+  const size_t capacity = str.capacity();
+  const char* data = str.data();
+  CVariant small(CVariant::VariantTypeObject);
+  small["id"] = 1;
+  ASSERT_TRUE(CJSONVariantWriter::Write(small, str, true));
+  EXPECT_EQ("{\"id\":1}", str);
+  EXPECT_EQ(capacity, str.capacity());
+  EXPECT_EQ(data, str.data());
+
+  expected = ToDom(variant).dump(1, '\t');
+  ASSERT_TRUE(CJSONVariantWriter::Write(variant, str, false));
+  EXPECT_EQ(expected, str);
+}
+
+// run with --gtest_also_run_disabled_tests to compare against the DOM based serialization
+TEST(TestJSONVariantWriter, DISABLED_BenchmarkWrite)
+{
+  const CVariant variant = MakeLibrary(20000);
+  constexpr int runs = 20;
+
+  std::string output;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < runs; i++)
+    ASSERT_TRUE(CJSONVariantWriter::Write(variant, output, true));
+  const auto writer = std::chrono::steady_clock::now() - start;
+
+  std::string dom;
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < runs; i++)
+    dom = ToDom(variant).dump(-1);
+  const auto reference = std::chrono::steady_clock::now() - start;
+
+  EXPECT_EQ(dom, output);
+  std::cout << "serialize " << output.size() << " bytes: "
+            << std::chrono::duration_cast<std::chrono::microseconds>(writer).count() / runs
+            << " us (DOM + dump: "
+            << std::chrono::duration_cast<std::chrono::microseconds>(reference).count() / runs
+            << " us)" << std::endl;
+}
@@ -9,6 +9,7 @@
 #include "ServiceBroker.h"
 #include "jobs/Job.h"
 #include "jobs/JobManager.h"
+#include "jobs/JobQueue.h"
 #include "test/MtTestUtils.h"
 #include "utils/XTimeUtils.h"
 
@@ -175,10 +176,13 @@ private:
 };
 
 BroadcastingJob *
-WaitForJobToStartProcessing(CJob::PRIORITY priority, JobControlPackage &package)
+WaitForJobToStartProcessing(CJob::PRIORITY priority, JobControlPackage &package,
+                            unsigned int* id = nullptr)
 {
   BroadcastingJob* job = new BroadcastingJob(package);
-  CServiceBroker::GetJobManager()->AddJob(job, nullptr, priority);
+  const unsigned int jobId = CServiceBroker::GetJobManager()->AddJob(job, nullptr, priority);
+  if (id)
+    *id = jobId;
 
   // We're now ready to wait, wait and then unblock once ready
   while (!package.ready)
@@ -211,3 +215,115 @@ TEST_F(TestJobManager, IsProcessing)
 
   job->FinishAndStopBlocking();
 }
+
+TEST_F(TestJobManager, Stats)
+{
+  JobControlPackage package;
+  BroadcastingJob* job(WaitForJobToStartProcessing(CJob::PRIORITY_LOW_PAUSABLE, package));
+
+  // keep queued jobs waiting behind the running one
+  CServiceBroker::GetJobManager()->PauseJobs();
+  Flags flags;
+  const unsigned int queuedId =
+      CServiceBroker::GetJobManager()->AddJob(new ReallyDumbJob(&flags), nullptr,
+                                              CJob::PRIORITY_LOW_PAUSABLE);
+  CServiceBroker::GetJobManager()->AddJob(new ReallyDumbJob(&flags), nullptr,
+                                          CJob::PRIORITY_LOW_PAUSABLE);
+
+  CJobManager::Stats stats = CServiceBroker::GetJobManager()->GetStats();
+  EXPECT_EQ(2u, stats.queued[CJob::PRIORITY_LOW_PAUSABLE]);
+  EXPECT_EQ(2u, stats.peakQueued);
+  EXPECT_EQ(1u, stats.processing);
+  EXPECT_EQ(3u, stats.added);
+  EXPECT_EQ(0u, stats.completed);
+
+  CServiceBroker::GetJobManager()->CancelJob(queuedId);
+  stats = CServiceBroker::GetJobManager()->GetStats();
+  EXPECT_EQ(1u, stats.queued[CJob::PRIORITY_LOW_PAUSABLE]);
+
+  CServiceBroker::GetJobManager()->UnPauseJobs();
+  job->FinishAndStopBlocking();
+  ASSERT_TRUE(poll([]() -> bool
+                   { return CServiceBroker::GetJobManager()->GetStats().completed == 2; }));
+  stats = CServiceBroker::GetJobManager()->GetStats();
+  EXPECT_EQ(0u, stats.queued[CJob::PRIORITY_LOW_PAUSABLE]);
+  EXPECT_EQ(2u, stats.peakQueued);
+}
+
+TEST_F(TestJobManager, Dependencies)
+{
+  JobControlPackage package;
+  unsigned int first = 0;
+  BroadcastingJob* job(WaitForJobToStartProcessing(CJob::PRIORITY_NORMAL, package, &first));
+  ASSERT_NE(0u, first);
+
+  Flags flags;
+  const unsigned int second = CServiceBroker::GetJobManager()->AddJob(
+      new ReallyDumbJob(&flags), nullptr, CJob::PRIORITY_NORMAL, {first});
+  ASSERT_NE(0u, second);
+  EXPECT_EQ(1u, CServiceBroker::GetJobManager()->GetStats().blocked);
+
+  // waits for a dependency that is itself blocked, and one that is long gone
+  Flags lastFlags;
+  CServiceBroker::GetJobManager()->AddJob(new ReallyDumbJob(&lastFlags), nullptr,
+                                          CJob::PRIORITY_NORMAL, {second, 12345});
+  EXPECT_EQ(2u, CServiceBroker::GetJobManager()->GetStats().blocked);
+  EXPECT_FALSE(flags.finished);
+
+  job->FinishAndStopBlocking();
+  ASSERT_TRUE(poll([&lastFlags]() -> bool { return lastFlags.finished; }));
+  EXPECT_TRUE(flags.finished);
+  EXPECT_EQ(0u, CServiceBroker::GetJobManager()->GetStats().blocked);
+}
+
+TEST_F(TestJobManager, CancelDependencies)
+{
+  JobControlPackage package;
+  unsigned int first = 0;
+  BroadcastingJob* job(WaitForJobToStartProcessing(CJob::PRIORITY_NORMAL, package, &first));
+
+  Flags flags;
+  CServiceBroker::GetJobManager()->AddJob(new ReallyDumbJob(&flags), nullptr,
+                                          CJob::PRIORITY_NORMAL, {first});
+  CServiceBroker::GetJobManager()->CancelJob(first);
+  EXPECT_EQ(0u, CServiceBroker::GetJobManager()->GetStats().blocked);
+
+  job->FinishAndStopBlocking();
+  ASSERT_TRUE(poll([]() -> bool
+                   { return CServiceBroker::GetJobManager()->GetStats().processing == 0; }));
+  EXPECT_FALSE(flags.finished);
+}
+
+TEST_F(TestJobManager, AddJobs)
+{
+  Flags flags[3];
+  const std::vector<unsigned int> ids = CServiceBroker::GetJobManager()->AddJobs(
+      {new ReallyDumbJob(&flags[0]), new ReallyDumbJob(&flags[1]), new ReallyDumbJob(&flags[2])},
+      nullptr);
+
+  ASSERT_EQ(3u, ids.size());
+  EXPECT_NE(0u, ids[0]);
+  EXPECT_LT(ids[0], ids[1]);
+  EXPECT_LT(ids[1], ids[2]);
+  ASSERT_TRUE(poll([&flags]() -> bool
+                   { return flags[0].finished && flags[1].finished && flags[2].finished; }));
+}
+
+TEST_F(TestJobManager, JobQueueCancelRunningJob)
+{
+  Flags running;
+  Flags queued;
+  CJobQueue queue(false, 1, CJob::PRIORITY_NORMAL);
+  DummyJob* job = new DummyJob(&running);
+  queue.AddJob(job);
+  queue.AddJob(new ReallyDumbJob(&queued));
+  ASSERT_TRUE(poll([&running]() -> bool { return running.started; }));
+
+  // cancelling the running job lets the next one start without waiting for it to finish
+  queue.CancelJob(job);
+  ASSERT_TRUE(poll([&queued]() -> bool { return queued.finished; }));
+
+  running.lingerAtWork = false;
+  ASSERT_TRUE(poll([&running]() -> bool { return running.finished; }));
+  EXPECT_TRUE(running.wasCanceled);
+}
@@ -0,0 +1,73 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/MemoryBudget.h"
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+class CTestCache : public IMemoryConsumer
+{
+public:
+  explicit CTestCache(size_t size) : m_size(size) { CMemoryBudget::Register(this); }
+  ~CTestCache() override { CMemoryBudget::Unregister(this); }
+
+  const char* GetCacheName() const override { return "test"; }
+  size_t GetCacheSize() const override { return m_size; }
+  size_t ShrinkCache(size_t bytes, MemoryPressure pressure) override
+  {
+    const size_t released = std::min(bytes, m_size);
+    m_size -= released;
+    m_pressure = pressure;
+    return released;
+  }
+
+  size_t m_size;
+  MemoryPressure m_pressure = MemoryPressure::NONE;
+};
+} // namespace
+
+TEST(TestMemoryBudget, ShrinksLargestFirst)
+{
+  // other caches of the test binary may hold memory too
+  const size_t usage = CMemoryBudget::GetUsage();
+  CMemoryBudget::SetBudget(usage + 1000);
+  CTestCache small(400);
+  CTestCache large(900);
+  EXPECT_EQ(usage + 1300, CMemoryBudget::GetUsage());
+
+  CMemoryBudget::SignalPressure(MemoryPressure::NONE);
+  EXPECT_EQ(300u, CMemoryBudget::Process());
+  EXPECT_EQ(400u, small.m_size);
+  EXPECT_EQ(600u, large.m_size);
+
+  CMemoryBudget::SetBudget(0);
+}
+
+TEST(TestMemoryBudget, CriticalPressure)
+{
+  CMemoryBudget::SetBudget(1000);
+  CTestCache small(100);
+  CTestCache large(200);
+
+  CMemoryBudget::SignalPressure(MemoryPressure::MODERATE);
+  CMemoryBudget::SignalPressure(MemoryPressure::CRITICAL);
+  // a lower pressure doesn't replace a higher one that isn't handled yet
+  CMemoryBudget::SignalPressure(MemoryPressure::MODERATE);
+  EXPECT_GE(CMemoryBudget::Process(), 300u);
+
+  EXPECT_EQ(0u, small.m_size);
+  EXPECT_EQ(0u, large.m_size);
+  EXPECT_EQ(MemoryPressure::CRITICAL, small.m_pressure);
+  EXPECT_EQ(MemoryPressure::CRITICAL, large.m_pressure);
+
+  CMemoryBudget::SetBudget(0);
+}
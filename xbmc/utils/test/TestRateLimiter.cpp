@@ -0,0 +1,52 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/RateLimiter.h"
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+TEST(TestRateLimiter, Burst)
+{
+  CRateLimiter limiter;
+  const auto now = CRateLimiter::Clock::now();
+  for (int i = 0; i < 3; ++i)
+    EXPECT_EQ(CRateLimiter::Clock::duration::zero(), limiter.Reserve("host", 2, 3, now));
+
+  // the bucket is empty, further requests queue up behind each other
+  EXPECT_EQ(500ms, limiter.Reserve("host", 2, 3, now));
+  EXPECT_EQ(1000ms, limiter.Reserve("host", 2, 3, now));
+
+  // other keys have their own bucket
+  EXPECT_EQ(CRateLimiter::Clock::duration::zero(), limiter.Reserve("other", 2, 3, now));
+}
+
+TEST(TestRateLimiter, Refill)
+{
+  CRateLimiter limiter;
+  const auto now = CRateLimiter::Clock::now();
+  EXPECT_EQ(CRateLimiter::Clock::duration::zero(), limiter.Reserve("host", 4, 1, now));
+  EXPECT_EQ(250ms, limiter.Reserve("host", 4, 1, now));
+
+  // the owed token is paid back first
+  EXPECT_EQ(CRateLimiter::Clock::duration::zero(), limiter.Reserve("host", 4, 1, now + 500ms));
+  EXPECT_EQ(250ms, limiter.Reserve("host", 4, 1, now + 500ms));
+
+  // a long idle time fills the bucket up to its size only
+  EXPECT_EQ(CRateLimiter::Clock::duration::zero(), limiter.Reserve("host", 4, 1, now + 10s));
+  EXPECT_EQ(250ms, limiter.Reserve("host", 4, 1, now + 10s));
+}
+
+TEST(TestRateLimiter, Unlimited)
+{
+  CRateLimiter limiter;
+  const auto now = CRateLimiter::Clock::now();
+  for (int i = 0; i < 100; ++i)
+    EXPECT_EQ(CRateLimiter::Clock::duration::zero(), limiter.Reserve("host", 0, 1, now));
+}
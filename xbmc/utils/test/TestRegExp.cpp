@@ -129,6 +129,42 @@ TEST(TestRegExp, operatorEqual)
   EXPECT_EQ(0, regexcopy.RegFind("Test string."));
 }
 
+TEST(TestRegExp, SharedCompiledPattern)
+{
+  CRegExp regex(true);
+  EXPECT_TRUE(regex.RegComp("jit", CRegExp::StudyWithJitComp));
+
+  // same pattern and options come from the cache, copies share the code
+  CRegExp other(true);
+  EXPECT_TRUE(other.RegComp("jit"));
+  CRegExp copy(regex);
+  EXPECT_EQ(5, other.RegFind("Test JIT"));
+  EXPECT_EQ(5, copy.RegFind("Test JIT"));
+
+  // options are part of the cache key
+  CRegExp caseSensitive;
+  EXPECT_TRUE(caseSensitive.RegComp("jit"));
+  EXPECT_EQ(-1, caseSensitive.RegFind("Test JIT"));
+}
+
+TEST(TestRegExp, RegExpList)
+{
+  CRegExpList list({"(\\[.*\\])", "[ _\\.](720p|1080p)", "+"}, true, CRegExp::autoUtf8);
+  ASSERT_EQ(3U, list.size());
+  EXPECT_TRUE(list[0].IsCompiled());
+  EXPECT_FALSE(list[2].IsCompiled()) << "Invalid patterns must be kept to preserve the indices";
+
+  EXPECT_TRUE(list.MayMatch("Movie.720P.mkv"));
+  EXPECT_TRUE(list.MayMatch("Movie [Group].mkv"));
+  EXPECT_FALSE(list.MayMatch("Movie.mkv"));
+  EXPECT_EQ(5, list[1].RegFind("Movie.720P.mkv"));
+
+  // back-references can't be combined, every string may match then
+  CRegExpList backRef({"(a)\\1", "b"}, false);
+  EXPECT_TRUE(backRef.MayMatch("c"));
+  EXPECT_EQ(0, backRef[0].RegFind("aa"));
+}
+
 class TestRegExpLog : public testing::Test
 {
 protected:
@@ -103,6 +103,43 @@ TEST(TestSortUtils, Sort_SortDescription)
   EXPECT_STREQ("R Artist", (*items.at(6))[FieldArtist].asString().c_str());
 }
 
+TEST(TestSortUtils, Sort_FoldersAndSpecial)
+{
+  DatabaseResults items;
+  const auto add = [&items](const char* label, bool folder, SortSpecial special)
+  {
+    DatabaseResult item;
+    item[FieldLabel] = label;
+    item[FieldFolder] = folder;
+    item[FieldSortSpecial] = special;
+    items.emplace_back(std::move(item));
+  };
+
+  add("File 10", false, SortSpecialNone);
+  add("Folder B", true, SortSpecialNone);
+  add("File 9", false, SortSpecialNone);
+  add("Bottom", false, SortSpecialOnBottom);
+  add("Folder A", true, SortSpecialNone);
+  add("Top", false, SortSpecialOnTop);
+
+  SortUtils::Sort(SortByLabel, SortOrderAscending, SortAttributeNone, items);
+  ASSERT_EQ(6u, items.size());
+  EXPECT_EQ("Top", items[0][FieldLabel].asString());
+  EXPECT_EQ("Folder A", items[1][FieldLabel].asString());
+  EXPECT_EQ("Folder B", items[2][FieldLabel].asString());
+  EXPECT_EQ("File 9", items[3][FieldLabel].asString());
+  EXPECT_EQ("File 10", items[4][FieldLabel].asString());
+  EXPECT_EQ("Bottom", items[5][FieldLabel].asString());
+
+  SortUtils::Sort(SortByLabel, SortOrderDescending, SortAttributeIgnoreFolders, items);
+  EXPECT_EQ("Top", items[0][FieldLabel].asString());
+  EXPECT_EQ("Folder B", items[1][FieldLabel].asString());
+  EXPECT_EQ("Folder A", items[2][FieldLabel].asString());
+  EXPECT_EQ("File 10", items[3][FieldLabel].asString());
+  EXPECT_EQ("File 9", items[4][FieldLabel].asString());
+  EXPECT_EQ("Bottom", items[5][FieldLabel].asString());
+}
+
 TEST(TestSortUtils, GetFieldsForSorting)
 {
   Fields fields;
@@ -0,0 +1,103 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/SortedNodeMap.h"
+#include "utils/StringUtils.h"
+
+#include <map>
+#include <string>
+
+#include <gtest/gtest.h>
+
+TEST(TestSortedNodeMap, InsertFindErase)
+{
+  CSortedNodeMap<int> map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.find("a"), map.end());
+
+  map["b"] = 2;
+  map["d"] = 4;
+  map["a"] = 1;
+  EXPECT_TRUE(map.emplace("c", 3).second);
+  EXPECT_FALSE(map.emplace("c", 30).second);
+
+  ASSERT_EQ(4u, map.size());
+  EXPECT_EQ(3, map.find("c")->second);
+  EXPECT_TRUE(map.contains("d"));
+  EXPECT_FALSE(map.contains("e"));
+
+  // iteration is ordered by key
+  std::string keys;
+  for (auto it = map.begin(); it != map.end(); ++it)
+    keys += it->first;
+  EXPECT_EQ("abcd", keys);
+
+  EXPECT_EQ(1u, map.erase("b"));
+  EXPECT_EQ(0u, map.erase("b"));
+  EXPECT_EQ(3u, map.size());
+  EXPECT_EQ(map.find("b"), map.cend());
+}
+
+TEST(TestSortedNodeMap, ReferencesAreStable)
+{
+  CSortedNodeMap<std::string> map;
+  std::string& value = map["m"];
+  value = "value";
+
+  // inserting before and after the element moves the nodes, not the elements
+  for (char c = 'a'; c <= 'z'; ++c)
+    map[std::string(1, c) + "x"] = "other";
+  map.erase("ax");
+
+  EXPECT_EQ(&value, &map["m"]);
+  EXPECT_EQ("value", value);
+}
+
+TEST(TestSortedNodeMap, CopyCompare)
+{
+  std::map<std::string, int> source{{"one", 1}, {"two", 2}, {"three", 3}};
+  const CSortedNodeMap<int> map(source);
+  ASSERT_EQ(3u, map.size());
+  EXPECT_EQ("one", map.begin()->first);
+
+  CSortedNodeMap<int> copy(map);
+  EXPECT_TRUE(copy == map);
+  copy["two"] = 20;
+  EXPECT_TRUE(copy != map);
+  EXPECT_EQ(2, map.find("two")->second);
+
+  copy = map;
+  EXPECT_TRUE(copy == map);
+
+  CSortedNodeMap<int> moved(std::move(copy));
+  EXPECT_TRUE(moved == map);
+}
+
+TEST(TestSortedNodeMap, CustomCompare)
+{
+  struct NoCase
+  {
+    bool operator()(std::string_view lhs, std::string_view rhs) const
+    {
+      return StringUtils::CompareNoCase(lhs, rhs) < 0;
+    }
+  };
+
+  CSortedNodeMap<int, NoCase> map;
+  map["Beta"] = 2;
+  map["alpha"] = 1;
+  EXPECT_FALSE(map.emplace("BETA", 20).second);
+  ASSERT_EQ(2u, map.size());
+  EXPECT_EQ(2, map.find("beta")->second);
+  EXPECT_EQ("alpha", map.begin()->first);
+
+  const auto it = map.erase(map.find("ALPHA"));
+  EXPECT_EQ("Beta", it->first);
+  EXPECT_EQ(1u, map.size());
+  EXPECT_FALSE(map.contains("alpha"));
+}
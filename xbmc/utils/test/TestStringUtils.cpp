@@ -9,6 +9,8 @@
 #include "utils/StringUtils.h"
 
 #include <algorithm>
+#include <array>
+#include <iterator>
 #include <limits>
 #include <string>
 #include <string_view>
@@ -80,6 +82,18 @@ TEST(TestStringUtils, FormatEnumWidth)
   EXPECT_STREQ(one, varstr.c_str());
 }
 
+TEST(TestStringUtils, FormatTo)
+{
+  std::string varstr = "prefix ";
+  StringUtils::FormatTo(std::back_inserter(varstr), "{} {:03d}", "value", 7);
+  EXPECT_EQ("prefix value 007", varstr);
+
+  std::array<char, 8> buffer;
+  EXPECT_EQ("1234", StringUtils::FormatToBuffer(buffer, "{}", 1234));
+  EXPECT_EQ("12345678", StringUtils::FormatToBuffer(buffer, "{}", 1234567890))
+      << "Result must be truncated to the buffer size";
+}
+
 TEST(TestStringUtils, ToUpper)
 {
   std::string refstr = "TEST";
@@ -379,6 +393,25 @@ TEST(TestStringUtils, Split)
   EXPECT_STREQ("a bc  d ef ghi ", StringUtils::Split("a bc  d ef ghi ", 'z').at(0).c_str());
 }
 
+TEST(TestStringUtils, SplitView)
+{
+  const std::string input = "a bc  d ef ghi ";
+
+  std::vector<std::string_view> varresults = StringUtils::SplitView(input, " ");
+  ASSERT_EQ(7U, varresults.size()) << "Result must be 7 strings including two empty strings";
+  EXPECT_EQ("bc", varresults.at(1));
+  EXPECT_EQ("", varresults.at(2));
+  EXPECT_EQ("", varresults.at(6));
+  EXPECT_EQ(input.data() + 2, varresults.at(1).data()) << "Parts must point into the input";
+
+  varresults = StringUtils::SplitView(input, ' ', 4);
+  ASSERT_EQ(4U, varresults.size());
+  EXPECT_EQ("d ef ghi ", varresults.at(3)) << "Last part must include rest of the input string";
+
+  EXPECT_TRUE(StringUtils::SplitView("", "|").empty());
+  EXPECT_EQ(input, StringUtils::SplitView(input, "").at(0));
+}
+
 TEST(TestStringUtils, SplitMulti)
 {
   const std::vector<std::string> input{"aaa::bbb", "cc:c##ddd::eee"};
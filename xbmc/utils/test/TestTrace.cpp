@@ -0,0 +1,86 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/Trace.h"
+#include "utils/Variant.h"
+
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+int CountEvents(const CVariant& trace, const std::string& name, const std::string& phase)
+{
+  int count = 0;
+  for (auto it = trace["traceEvents"].begin_array(); it != trace["traceEvents"].end_array(); ++it)
+  {
+    if ((*it)["name"].asString() == name && (*it)["ph"].asString() == phase)
+      ++count;
+  }
+  return count;
+}
+} // namespace
+
+TEST(TestTrace, Disabled)
+{
+  CTrace::Stop();
+  {
+    CTraceZone zone("TestTrace::Disabled");
+  }
+
+  CVariant trace;
+  CTrace::Export(trace);
+  EXPECT_EQ(0, CountEvents(trace, "TestTrace::Disabled", "X"));
+}
+
+TEST(TestTrace, Events)
+{
+  CTrace::Start();
+  {
+    CTraceZone zone("TestTrace::Zone");
+    CTrace::Counter("TestTrace::Counter", 42);
+    CTrace::FlowBegin("TestTrace::Flow", 1);
+    CTrace::FlowEnd("TestTrace::Flow", 1);
+  }
+  CTrace::Stop();
+
+  CVariant trace;
+  CTrace::Export(trace);
+  EXPECT_EQ(1, CountEvents(trace, "TestTrace::Zone", "X"));
+  EXPECT_EQ(1, CountEvents(trace, "TestTrace::Counter", "C"));
+  EXPECT_EQ(1, CountEvents(trace, "TestTrace::Flow", "s"));
+  EXPECT_EQ(1, CountEvents(trace, "TestTrace::Flow", "f"));
+}
+
+TEST(TestTrace, RingBuffer)
+{
+  CTrace::Start(4);
+  for (int i = 0; i < 10; ++i)
+    CTrace::Counter("TestTrace::RingBuffer", i);
+  CTrace::Stop();
+
+  CVariant trace;
+  CTrace::Export(trace);
+  EXPECT_EQ(4, CountEvents(trace, "TestTrace::RingBuffer", "C"));
+}
+
+TEST(TestTrace, EndedThreads)
+{
+  CTrace::Start(16);
+  for (size_t i = 0; i < CTrace::MAX_ENDED_THREADS + 2; ++i)
+    std::thread([] { CTrace::Counter("TestTrace::EndedThreads", 1); }).join();
+  CTrace::Stop();
+
+  // only the threads that ended last are kept
+  CVariant trace;
+  CTrace::Export(trace);
+  EXPECT_EQ(static_cast<int>(CTrace::MAX_ENDED_THREADS),
+            CountEvents(trace, "TestTrace::EndedThreads", "C"));
+}
@@ -0,0 +1,156 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "filesystem/File.h"
+#include "test/TestUtils.h"
+#include "utils/XBMCTinyXMLStream.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+std::string WriteTempFile(XFILE::CFile* file, const std::string& data)
+{
+  file->Write(data.data(), data.size());
+  file->Close();
+  return XBMC_TEMPFILEPATH(file);
+}
+} // namespace
+
+TEST(TestXBMCTinyXMLStream, ReadChildren)
+{
+  XFILE::CFile* file = XBMC_CREATETEMPFILE(".xml");
+  ASSERT_NE(nullptr, file);
+  const std::string path = WriteTempFile(
+      file, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+            "<!DOCTYPE videodb [ <!ELEMENT videodb ANY> ]>\n"
+            "<videodb>\n"
+            "  <version>2</version>\n"
+            "  <!-- a comment with <movie> inside -->\n"
+            "  <movie id=\"a>b\"><title>First</title><plot><![CDATA[<not a tag>]]></plot></movie>\n"
+            "  <set/>\n"
+            "  <tvshow><title>Show</title><episodedetails><title>Pilot</title></episodedetails>"
+            "<episodedetails/></tvshow>\n"
+            "</videodb>\n");
+
+  CXBMCTinyXMLStreamReader reader;
+  ASSERT_TRUE(reader.Open(path));
+  EXPECT_EQ("videodb", reader.GetRootName());
+
+  const TiXmlElement* element = reader.ReadNextElement();
+  ASSERT_NE(nullptr, element);
+  EXPECT_STREQ("version", element->Value());
+  EXPECT_STREQ("2", element->GetText());
+
+  element = reader.ReadNextElement();
+  ASSERT_NE(nullptr, element);
+  EXPECT_STREQ("movie", element->Value());
+  EXPECT_STREQ("a>b", element->Attribute("id"));
+  EXPECT_STREQ("<not a tag>", element->FirstChildElement("plot")->GetText());
+
+  element = reader.ReadNextElement();
+  ASSERT_NE(nullptr, element);
+  EXPECT_STREQ("set", element->Value());
+
+  element = reader.ReadNextElement();
+  ASSERT_NE(nullptr, element);
+  EXPECT_STREQ("tvshow", element->Value());
+  int episodes = 0;
+  for (const TiXmlElement* episode = element->FirstChildElement("episodedetails"); episode;
+       episode = episode->NextSiblingElement("episodedetails"))
+    episodes++;
+  EXPECT_EQ(2, episodes);
+
+  EXPECT_EQ(nullptr, reader.ReadNextElement());
+  EXPECT_FALSE(reader.HasError());
+
+  reader.Close();
+  EXPECT_TRUE(XBMC_DELETETEMPFILE(file));
+}
+
+TEST(TestXBMCTinyXMLStream, Truncated)
+{
+  XFILE::CFile* file = XBMC_CREATETEMPFILE(".xml");
+  ASSERT_NE(nullptr, file);
+  const std::string path =
+      WriteTempFile(file, "<videodb><movie><title>First</title></movie><movie><title>Sec");
+
+  CXBMCTinyXMLStreamReader reader;
+  ASSERT_TRUE(reader.Open(path));
+  EXPECT_NE(nullptr, reader.ReadNextElement());
+  EXPECT_EQ(nullptr, reader.ReadNextElement());
+  EXPECT_TRUE(reader.HasError());
+
+  reader.Close();
+  EXPECT_TRUE(XBMC_DELETETEMPFILE(file));
+}
+
+TEST(TestXBMCTinyXMLStream, WriteAndReadBack)
+{
+  XFILE::CFile* file = XBMC_CREATETEMPFILE(".xml");
+  ASSERT_NE(nullptr, file);
+  file->Close();
+  const std::string path = XBMC_TEMPFILEPATH(file);
+
+  CXBMCTinyXMLStreamWriter writer;
+  ASSERT_TRUE(writer.Open(path, "videodb"));
+  TiXmlElement staging("videodb");
+  for (int i = 0; i < 3; ++i)
+  {
+    TiXmlElement movie("movie");
+    movie.SetAttribute("index", i);
+    staging.InsertEndChild(movie);
+    EXPECT_TRUE(writer.WriteChildren(&staging));
+    EXPECT_EQ(nullptr, staging.FirstChild());
+  }
+  EXPECT_TRUE(writer.Close());
+
+  CXBMCTinyXMLStreamReader reader;
+  ASSERT_TRUE(reader.Open(path));
+  int count = 0;
+  while (const TiXmlElement* movie = reader.ReadNextElement())
+  {
+    int index = -1;
+    movie->Attribute("index", &index);
+    EXPECT_EQ(count++, index);
+  }
+  EXPECT_EQ(3, count);
+  EXPECT_FALSE(reader.HasError());
+
+  reader.Close();
+  EXPECT_TRUE(XBMC_DELETETEMPFILE(file));
+}
+
+TEST(TestXBMCTinyXMLStream, DiscardKeepsPrevious)
+{
+  XFILE::CFile* file = XBMC_CREATETEMPFILE(".xml");
+  ASSERT_NE(nullptr, file);
+  const std::string path = WriteTempFile(file, "<videodb><movie/></videodb>\n");
+
+  {
+    // destroyed without Close(), like an export that is cancelled or throws
+    CXBMCTinyXMLStreamWriter writer;
+    ASSERT_TRUE(writer.Open(path, "videodb"));
+    TiXmlElement staging("videodb");
+    staging.InsertEndChild(TiXmlElement("tvshow"));
+    EXPECT_TRUE(writer.WriteChildren(&staging));
+  }
+  EXPECT_FALSE(XFILE::CFile::Exists(path + ".tmp"));
+
+  CXBMCTinyXMLStreamReader reader;
+  ASSERT_TRUE(reader.Open(path));
+  const TiXmlElement* movie = reader.ReadNextElement();
+  ASSERT_NE(nullptr, movie);
+  EXPECT_EQ("movie", movie->ValueStr());
+  EXPECT_EQ(nullptr, reader.ReadNextElement());
+
+  reader.Close();
+  EXPECT_TRUE(XBMC_DELETETEMPFILE(file));
+}
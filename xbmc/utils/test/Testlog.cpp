@@ -92,3 +92,52 @@ TEST_F(Testlog, SetLogLevel)
   CServiceBroker::GetLogging().Deinitialize();
   EXPECT_TRUE(XFILE::CFile::Delete(logfile));
 }
+
+TEST_F(Testlog, AsyncLogging)
+{
+  std::string logfile, logstring;
+  char buf[100];
+  ssize_t bytesread;
+  XFILE::CFile file;
+  CRegExp regex;
+
+  std::string appName = CCompileInfo::GetAppName();
+  StringUtils::ToLower(appName);
+  logfile = CSpecialProtocol::TranslatePath("special://temp/") + appName + ".log";
+  CServiceBroker::GetLogging().SetAsyncLogging(4, true);
+  CServiceBroker::GetLogging().Initialize(CSpecialProtocol::TranslatePath("special://temp/"));
+
+  CLog::Log(LOGINFO, "first async log message");
+  for (int i = 0; i < 100; ++i)
+    CLog::Log(LOGINFO, "async log message {}", i);
+  CLog::Log(LOGINFO, "last async log message");
+  CServiceBroker::GetLogging().Deinitialize();
+  CServiceBroker::GetLogging().SetAsyncLogging(0, false);
+
+  EXPECT_TRUE(file.Open(logfile));
+  while ((bytesread = file.Read(buf, sizeof(buf) - 1)) > 0)
+  {
+    buf[bytesread] = '\0';
+    logstring.append(buf);
+  }
+  file.Close();
+
+  // whatever was dropped, the latest messages are written on deinitialization
+  EXPECT_TRUE(regex.RegComp(".*(info|INFO) <general>: last async log message.*"));
+  EXPECT_GE(regex.RegFind(logstring), 0);
+
+  EXPECT_TRUE(XFILE::CFile::Delete(logfile));
+}
+
+TEST_F(Testlog, ComponentLogLevel)
+{
+  EXPECT_FALSE(CServiceBroker::GetLogging().SetComponentLogLevel("nosuchcomponent", LOGDEBUG));
+
+  EXPECT_TRUE(CServiceBroker::GetLogging().SetComponentLogLevel("database", LOGDEBUG));
+  EXPECT_TRUE(CServiceBroker::GetLogging().CanLogComponent(LOGDATABASE));
+
+  EXPECT_TRUE(CServiceBroker::GetLogging().SetComponentLogLevel("database", LOGNONE));
+  EXPECT_FALSE(CServiceBroker::GetLogging().CanLogComponent(LOGDATABASE));
+
+  EXPECT_TRUE(CServiceBroker::GetLogging().SetComponentLogLevel("database", -1));
+}
@@ -889,7 +889,7 @@ void CTeletextDecoder::GetNextSubPage(int offset)
     if (loop == m_txtCache->SubPage)
       break;
 
-    if (m_txtCache->astCachetable[m_txtCache->Page][loop])
+    if (m_txtCache->astCachetable.Get(m_txtCache->Page, loop))
     {
       /* enable manual SubPage zapping */
       m_txtCache->ZapSubpageManual = true;
@@ -1288,7 +1288,7 @@ void CTeletextDecoder::RenderPage()
         if (showpage >= 0 && (showsubpage = m_txtCache->SubPageTable[showpage]) != 0xff)
         {
           TextCachedPage_t *pCachedPage;
-          pCachedPage = m_txtCache->astCachetable[showpage][showsubpage];
+          pCachedPage = m_txtCache->astCachetable.Get(showpage, showsubpage);
           if (pCachedPage && IsDec(showpage))
           {
             m_RenderInfo.PosX = 0;
@@ -1370,7 +1370,7 @@ void CTeletextDecoder::DoFlashing(int startrow)
   std::unique_lock lock(m_txtCache->m_critSection);
 
   TextCachedPage_t* textCachepage =
-      m_txtCache->astCachetable[m_txtCache->Page][m_txtCache->SubPage];
+      m_txtCache->astCachetable.Get(m_txtCache->Page, m_txtCache->SubPage);
 
   // Verify that the page is not deleted by the other thread: CDVDTeletextData::ResetTeletextCache()
   if (!textCachepage || m_RenderInfo.PageInfo != &textCachepage->pageinfo)
@@ -1627,7 +1627,7 @@ void CTeletextDecoder::Decode_BTT()
 
   std::unique_lock lock(m_txtCache->m_critSection);
 
-  if (m_txtCache->SubPageTable[0x1f0] == 0xff || 0 == m_txtCache->astCachetable[0x1f0][m_txtCache->SubPageTable[0x1f0]]) /* not yet received */
+  if (m_txtCache->SubPageTable[0x1f0] == 0xff || 0 == m_txtCache->astCachetable.Get(0x1f0, m_txtCache->SubPageTable[0x1f0])) /* not yet received */
     return;
 
   auto& components = CServiceBroker::GetAppComponents();
@@ -1701,7 +1701,7 @@ void CTeletextDecoder::Decode_ADIP() /* additional information table */
   for (i = 0; i <= m_txtCache->ADIP_PgMax; i++)
   {
     p = m_txtCache->ADIP_Pg[i];
-    if (!p || m_txtCache->SubPageTable[p] == 0xff || 0 == m_txtCache->astCachetable[p][m_txtCache->SubPageTable[p]]) /* not cached (avoid segfault) */
+    if (!p || m_txtCache->SubPageTable[p] == 0xff || 0 == m_txtCache->astCachetable.Get(p, m_txtCache->SubPageTable[p])) /* not cached (avoid segfault) */
       continue;
 
     appPlayer->LoadPage(p, m_txtCache->SubPageTable[p], padip);
@@ -2659,7 +2659,7 @@ int CTeletextDecoder::RenderChar(
   }
   else if (Attribute->charset >= C_OFFSET_DRCS)
   {
-    TextCachedPage_t *pcache = m_txtCache->astCachetable[(Attribute->charset & 0x10) ? m_txtCache->drcs : m_txtCache->gdrcs][Attribute->charset & 0x0f];
+    TextCachedPage_t *pcache = m_txtCache->astCachetable.Get((Attribute->charset & 0x10) ? m_txtCache->drcs : m_txtCache->gdrcs, Attribute->charset & 0x0f);
     if (pcache)
     {
       unsigned char drcs_data[23*40];
@@ -2868,9 +2868,9 @@ TextPageinfo_t* CTeletextDecoder::DecodePage(bool showl25,             // 1=deco
     return NULL;
 
   if (m_txtCache->ZapSubpageManual)
-    pCachedPage = m_txtCache->astCachetable[m_txtCache->Page][m_txtCache->SubPage];
+    pCachedPage = m_txtCache->astCachetable.Get(m_txtCache->Page, m_txtCache->SubPage);
   else
-    pCachedPage = m_txtCache->astCachetable[m_txtCache->Page][m_txtCache->SubPageTable[m_txtCache->Page]];
+    pCachedPage = m_txtCache->astCachetable.Get(m_txtCache->Page, m_txtCache->SubPageTable[m_txtCache->Page]);
   if (!pCachedPage)  /* not cached: do nothing */
     return nullptr;
 
@@ -3313,15 +3313,15 @@ void CTeletextDecoder::Eval_l25(unsigned char* PageChar, TextPageAttr_t *PageAtr
   m_txtCache->FullScrColor = TXT_ColorBlack;
   m_txtCache->ColorTable   = NULL;
 
-  if (!m_txtCache->astCachetable[m_txtCache->Page][m_txtCache->SubPage])
+  if (!m_txtCache->astCachetable.Get(m_txtCache->Page, m_txtCache->SubPage))
     return;
 
   /* normal page */
   if (IsDec(m_txtCache->Page))
   {
     unsigned char APx0, APy0, APx, APy;
-    TextPageinfo_t *pi      = &(m_txtCache->astCachetable[m_txtCache->Page][m_txtCache->SubPage]->pageinfo);
-    TextCachedPage_t *pmot  = m_txtCache->astCachetable[(m_txtCache->Page & 0xf00) | 0xfe][0];
+    TextPageinfo_t *pi      = &(m_txtCache->astCachetable.Get(m_txtCache->Page, m_txtCache->SubPage)->pageinfo);
+    TextCachedPage_t *pmot  = m_txtCache->astCachetable.Get((m_txtCache->Page & 0xf00) | 0xfe, 0);
     int p26Received         = 0;
     int BlackBgSubst        = 0;
     int ColorTableRemapping = 0;
@@ -3490,21 +3490,21 @@ void CTeletextDecoder::Eval_l25(unsigned char* PageChar, TextPageAttr_t *PageAtr
             m_txtCache->drcs += 0x800;
         }
       }
-      if (m_txtCache->astCachetable[m_txtCache->gpop][0])
-        m_txtCache->astCachetable[m_txtCache->gpop][0]->pageinfo.function = FUNC_GPOP;
-      if (m_txtCache->astCachetable[m_txtCache->pop][0])
-        m_txtCache->astCachetable[m_txtCache->pop][0]->pageinfo.function = FUNC_POP;
-      if (m_txtCache->astCachetable[m_txtCache->gdrcs][0])
-        m_txtCache->astCachetable[m_txtCache->gdrcs][0]->pageinfo.function = FUNC_GDRCS;
-      if (m_txtCache->astCachetable[m_txtCache->drcs][0])
-        m_txtCache->astCachetable[m_txtCache->drcs][0]->pageinfo.function = FUNC_DRCS;
+      if (m_txtCache->astCachetable.Get(m_txtCache->gpop, 0))
+        m_txtCache->astCachetable.Get(m_txtCache->gpop, 0)->pageinfo.function = FUNC_GPOP;
+      if (m_txtCache->astCachetable.Get(m_txtCache->pop, 0))
+        m_txtCache->astCachetable.Get(m_txtCache->pop, 0)->pageinfo.function = FUNC_POP;
+      if (m_txtCache->astCachetable.Get(m_txtCache->gdrcs, 0))
+        m_txtCache->astCachetable.Get(m_txtCache->gdrcs, 0)->pageinfo.function = FUNC_GDRCS;
+      if (m_txtCache->astCachetable.Get(m_txtCache->drcs, 0))
+        m_txtCache->astCachetable.Get(m_txtCache->drcs, 0)->pageinfo.function = FUNC_DRCS;
     } /* if mot */
 
     /* evaluate local extension data from p26 */
     if (p26Received)
     {
       APx0 = APy0 = APx = APy = m_txtCache->tAPx = m_txtCache->tAPy = 0;
-      Eval_Object(13 * (23-2 + 2), m_txtCache->astCachetable[m_txtCache->Page][m_txtCache->SubPage], &APx, &APy, &APx0, &APy0, OBJ_ACTIVE, &PageChar[40], PageChar, PageAtrb); /* 1st triplet p26/0 */
+      Eval_Object(13 * (23-2 + 2), m_txtCache->astCachetable.Get(m_txtCache->Page, m_txtCache->SubPage), &APx, &APy, &APx0, &APy0, OBJ_ACTIVE, &PageChar[40], PageChar, PageAtrb); /* 1st triplet p26/0 */
     }
 
     {
@@ -3592,7 +3592,7 @@ void CTeletextDecoder::Eval_NumberedObject(int p, int s, int packet, int triplet
 {
   std::unique_lock lock(m_txtCache->m_critSection);
 
-  if (!packet || 0 == m_txtCache->astCachetable[p][s])
+  if (!packet || 0 == m_txtCache->astCachetable.Get(p, s))
     return;
 
   unsigned char pagedata[23*40];
@@ -3611,7 +3611,7 @@ void CTeletextDecoder::Eval_NumberedObject(int p, int s, int packet, int triplet
     iONr = idata & 0x1ff; /* triplet number of even object data */
   if (iONr <= 506)
   {
-    Eval_Object(iONr, m_txtCache->astCachetable[p][s], pAPx, pAPy, pAPx0, pAPy0, (tObjType)(triplet % 3),pagedata, PageChar, PageAtrb);
+    Eval_Object(iONr, m_txtCache->astCachetable.Get(p, s), pAPx, pAPy, pAPx0, pAPy0, (tObjType)(triplet % 3),pagedata, PageChar, PageAtrb);
   }
 }
 
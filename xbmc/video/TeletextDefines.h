@@ -10,7 +10,9 @@
 
 #include "threads/CriticalSection.h"
 
+#include <array>
 #include <chrono>
+#include <memory>
 #include <string>
 
 #define FLOFSIZE 4
@@ -389,13 +391,59 @@ typedef struct
   TextPageAttr_t PageAtrb[TELETEXT_PAGE_SIZE];
 } TextSubtitleCache_t;
 
+/* cached pages by page (0x000-0x8ff) and subpage (0x00-0x7f). The subpage table of a page is
+ * only allocated once one of its subpages is received, broadcasters use a few hundred pages at
+ * most, so this is much smaller than a full table. The pages are owned by the teletext player. */
+class TextCacheTable_t
+{
+public:
+  TextCachedPage_t* Get(int page, int subpage) const
+  {
+    const auto& subpages = m_pages[page];
+    return subpages ? (*subpages)[subpage] : nullptr;
+  }
+
+  void Set(int page, int subpage, TextCachedPage_t* cachedPage)
+  {
+    auto& subpages = m_pages[page];
+    if (!subpages)
+      subpages = std::make_unique<Subpages>();
+    (*subpages)[subpage] = cachedPage;
+  }
+
+  template<typename F>
+  void ForEach(F&& function) const
+  {
+    for (const auto& subpages : m_pages)
+    {
+      if (!subpages)
+        continue;
+      for (TextCachedPage_t* cachedPage : *subpages)
+      {
+        if (cachedPage)
+          function(cachedPage);
+      }
+    }
+  }
+
+  void Clear()
+  {
+    for (auto& subpages : m_pages)
+      subpages.reset();
+  }
+
+private:
+  using Subpages = std::array<TextCachedPage_t*, 0x80>;
+  std::array<std::unique_ptr<Subpages>, 0x900> m_pages;
+};
+
 /* main data structure */
 typedef struct TextCacheStruct_t
 {
   int               CurrentPage[9];
   int               CurrentSubPage[9];
   TextExtData_t    *astP29[9];
-  TextCachedPage_t *astCachetable[0x900][0x80];
+  TextCacheTable_t  astCachetable;
   unsigned char     SubPageTable[0x900];
   unsigned char     BasicTop[0x900];
   short             FlofPages[0x900][FLOFSIZE];
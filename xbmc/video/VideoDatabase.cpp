@@ -47,14 +47,17 @@
 #include "settings/SettingsComponent.h"
 #include "storage/MediaManager.h"
 #include "utils/ArtUtils.h"
+#include "utils/FileExistenceChecker.h"
 #include "utils/FileUtils.h"
 #include "utils/GroupUtils.h"
 #include "utils/LabelFormatter.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/Variant.h"
+#include "utils/XBMCTinyXMLStream.h"
 #include "utils/XMLUtils.h"
 #include "utils/log.h"
+#include "video/VideoDbListingCache.h"
 #include "video/VideoDbUrl.h"
 #include "video/VideoFileItemClassify.h"
 #include "video/VideoInfoTag.h"
@@ -63,6 +66,7 @@
 #include "video/VideoThumbLoader.h"
 
 #include <algorithm>
+#include <cstdlib>
 #include <map>
 #include <memory>
 #include <ranges>
@@ -79,6 +83,23 @@ using namespace KODI::MESSAGING;
 using namespace KODI::GUILIB;
 using namespace KODI::VIDEO;
 
+namespace
+{
+// other clients can change a server database without us noticing
+constexpr auto LISTING_CACHE_SERVER_MAX_AGE = std::chrono::seconds(30);
+
+// The sorting left to do in memory once CVideoDatabase::ApplyLimitInSQL() limited the items
+SortDescription GetSortingAfterSQLLimit(const SortDescription& sorting)
+{
+  SortDescription remaining = sorting;
+  remaining.limitStart = 0;
+  remaining.limitEnd = -1;
+  if (remaining.sortBy == SortByRandom)
+    remaining.sortBy = SortByNone;
+  return remaining;
+}
+} // unnamed namespace
+
 //********************************************************************************************************************************
 CVideoDatabase::CVideoDatabase() = default;
 
@@ -88,7 +109,15 @@ CVideoDatabase::~CVideoDatabase() = default;
 //********************************************************************************************************************************
 bool CVideoDatabase::Open()
 {
-  return CDatabase::Open(CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_databaseVideo);
+  const auto advancedSettings{CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()};
+  if (!CDatabase::Open(advancedSettings->m_databaseVideo))
+    return false;
+
+  // any change to the library makes the cached listings stale
+  CVideoDbListingCache::GetInstance().SetMaxItems(
+      static_cast<size_t>(advancedSettings->m_iVideoLibraryListingCacheItems));
+  m_pDB->setChangeCallback([] { CVideoDbListingCache::GetInstance().Invalidate(); });
+  return true;
 }
 
 void CVideoDatabase::CreateTables()
@@ -219,6 +248,8 @@ void CVideoDatabase::CreateTables()
   CLog::Log(LOGINFO, "create videoversion table");
   m_pDS->exec("CREATE TABLE videoversion (idFile INTEGER PRIMARY KEY, idMedia INTEGER, media_type "
               "TEXT, itemType INTEGER, idType INTEGER)");
+
+  CreateChangelogTable();
 }
 
 void CVideoDatabase::CreateLinkIndex(const char *table)
@@ -307,6 +338,16 @@ void CVideoDatabase::CreateAnalytics()
   m_pDS->exec(PrepareSQL("CREATE INDEX ix_tvshow_title ON tvshow (c%02d(255), c%02d(10))",
                          VIDEODB_ID_TV_TITLE, VIDEODB_ID_TV_PREMIERED));
 
+  CreateFullTextIndex("movie", "idMovie",
+                      {StringUtils::Format("c{:02}", VIDEODB_ID_TITLE),
+                       StringUtils::Format("c{:02}", VIDEODB_ID_ORIGINALTITLE)});
+  CreateFullTextIndex("tvshow", "idShow", {StringUtils::Format("c{:02}", VIDEODB_ID_TV_TITLE)});
+  CreateFullTextIndex("episode", "idEpisode",
+                      {StringUtils::Format("c{:02}", VIDEODB_ID_EPISODE_TITLE)});
+  CreateFullTextIndex("musicvideo", "idMVideo",
+                      {StringUtils::Format("c{:02}", VIDEODB_ID_MUSICVIDEO_TITLE)});
+  CreateFullTextIndex("actor", "actor_id", {"name"});
+
   CreateLinkIndex("tag");
   CreateForeignLinkIndex("director", "actor");
   CreateForeignLinkIndex("writer", "actor");
@@ -385,6 +426,32 @@ void CVideoDatabase::CreateAnalytics()
               "DELETE FROM streamdetails WHERE idFile=old.idFile; "
               "END");
 
+  CLog::Log(LOGINFO, "Creating changelog triggers");
+  CreateChangelogAnalytics({{"movie", "idMovie", MediaTypeMovie},
+                            {"tvshow", "idShow", MediaTypeTvShow},
+                            {"episode", "idEpisode", MediaTypeEpisode},
+                            {"musicvideo", "idMVideo", MediaTypeMusicVideo},
+                            {"sets", "idSet", MediaTypeVideoCollection}},
+                           {{"art", "media_id", ""},
+                            {"uniqueid", "media_id", ""},
+                            {"rating", "media_id", ""},
+                            {"actor_link", "media_id", ""},
+                            {"director_link", "media_id", ""},
+                            {"writer_link", "media_id", ""},
+                            {"genre_link", "media_id", ""},
+                            {"country_link", "media_id", ""},
+                            {"studio_link", "media_id", ""},
+                            {"tag_link", "media_id", ""}});
+  // play count and last played are kept with the file
+  CreateChangelogTrigger(
+      "changelog_update_files", "AFTER UPDATE ON files",
+      GetChangelogStatement(MediaTypeMovie, "idMovie", false,
+                            "FROM movie WHERE movie.idFile = new.idFile") +
+          GetChangelogStatement(MediaTypeEpisode, "idEpisode", false,
+                                "FROM episode WHERE episode.idFile = new.idFile") +
+          GetChangelogStatement(MediaTypeMusicVideo, "idMVideo", false,
+                                "FROM musicvideo WHERE musicvideo.idFile = new.idFile"));
+
   CreateViews();
 }
 
@@ -654,8 +721,8 @@ int CVideoDatabase::GetPathId(const std::string& strPath)
 
     URIUtils::AddSlashAtEnd(strPath1);
 
-    strSQL=PrepareSQL("select idPath from path where strPath='%s'",strPath1.c_str());
-    m_pDS->query(strSQL);
+    strSQL = "select idPath from path where strPath=?";
+    m_pDS->query(strSQL, {dbiplus::field_value(strPath1.c_str())});
     if (!m_pDS->eof())
       idPath = m_pDS->fv("path.idPath").get_asInt();
 
@@ -816,6 +883,126 @@ int CVideoDatabase::RunQuery(const std::string &sql)
   return rows;
 }
 
+bool CVideoDatabase::ApplyLimitInSQL(const std::string& sql,
+                                     const Filter& filter,
+                                     const SortDescription& sorting,
+                                     const MediaType& mediaType,
+                                     std::string& sqlExtra,
+                                     int& total)
+{
+  if (!filter.limit.empty())
+    return false;
+
+  if (sorting.sortBy == SortByNone)
+  {
+    if (sorting.limitStart > 0 || sorting.limitEnd > 0 ||
+        (sorting.limitStart == 0 && sorting.limitEnd == 0))
+    {
+      total = GetSingleValueInt(PrepareSQL(sql, "COUNT(1)") + sqlExtra, *m_pDS);
+      sqlExtra += DatabaseUtils::BuildLimitClause(sorting.limitEnd, sorting.limitStart);
+      return true;
+    }
+    return false;
+  }
+
+  if (!filter.order.empty() || (sorting.limitStart <= 0 && sorting.limitEnd <= 0))
+    return false;
+
+  // ordering by the column picks the same items as the sorting in memory does, apart from
+  // which of several items with an equal value at the limit are kept
+  std::string orderBy;
+  Field field = FieldNone;
+  switch (sorting.sortBy)
+  {
+    case SortByRandom:
+      orderBy = "RANDOM()";
+      break;
+    case SortByDateAdded:
+      field = FieldDateAdded;
+      break;
+    case SortByLastPlayed:
+      field = FieldLastPlayed;
+      break;
+    case SortByPlaycount:
+      field = FieldPlaycount;
+      break;
+    case SortByRating:
+      field = FieldRating;
+      break;
+    case SortByUserRating:
+      field = FieldUserRating;
+      break;
+    default:
+      return false;
+  }
+  if (field != FieldNone)
+  {
+    orderBy = DatabaseUtils::GetField(field, mediaType, DatabaseQueryPart::ORDER_BY);
+    if (orderBy.empty())
+      return false;
+    if (sorting.sortOrder == SortOrderDescending)
+      orderBy += " DESC";
+  }
+
+  total = GetSingleValueInt(PrepareSQL(sql, "COUNT(1)") + sqlExtra, *m_pDS);
+  sqlExtra += " ORDER BY " + orderBy;
+  sqlExtra += DatabaseUtils::BuildLimitClause(sorting.limitEnd, sorting.limitStart);
+  return true;
+}
+
+std::string CVideoDatabase::GetSearchCondition(const std::string& table,
+                                               const std::string& idColumn,
+                                               const std::vector<std::string>& columns,
+                                               const std::string& search)
+{
+  std::string condition = GetFullTextCondition(table, idColumn, search);
+  if (!condition.empty())
+    return condition;
+
+  for (const std::string& column : columns)
+  {
+    if (!condition.empty())
+      condition += " OR ";
+    condition += PrepareSQL("%s.%s LIKE '%%%s%%'", table.c_str(), column.c_str(), search.c_str());
+  }
+  return "(" + condition + ")";
+}
+
+std::string CVideoDatabase::GetListingCacheKey(std::string_view type,
+                                               const std::string& baseDir,
+                                               const std::string& fields,
+                                               const std::string& sqlExtra,
+                                               const SortDescription& sorting,
+                                               int getDetails,
+                                               int flags /* = 0 */) const
+{
+  // which items are visible depends on the sources unlocked in this session
+  if (m_profileManager.GetMasterProfile().getLockMode() != LockMode::EVERYONE &&
+      !g_passwordManager.bMasterUser)
+    return {};
+
+  // a random listing has to differ every time
+  if (sorting.sortBy == SortByRandom)
+    return {};
+
+  return StringUtils::Format(
+      "{}\n{}\n{}\n{}\n{}\n{}\n{} {} {} {} {}\n{} {}", m_pDB->getHostName(), m_pDB->getDatabase(),
+      type, baseDir, fields, sqlExtra, static_cast<int>(sorting.sortBy),
+      static_cast<int>(sorting.sortOrder), static_cast<int>(sorting.sortAttributes),
+      sorting.limitStart, sorting.limitEnd, getDetails, flags);
+}
+
+void CVideoDatabase::CacheListing(const std::string& key,
+                                  uint64_t generation,
+                                  const CFileItemList& items,
+                                  int first) const
+{
+  CVideoDbListingCache::GetInstance().Put(
+      key, generation, items, first, {"total", "customtitle"},
+      m_sqlite ? std::chrono::milliseconds::zero()
+               : std::chrono::milliseconds(LISTING_CACHE_SERVER_MAX_AGE));
+}
+
 bool CVideoDatabase::GetSubPaths(const std::string &basepath, std::vector<std::pair<int, std::string>>& subpaths)
 {
   std::string sql;
@@ -1045,10 +1232,8 @@ int CVideoDatabase::AddOrUpdateFile(const std::string& fileAndPath,
                                      ? "'" + fileInfo.m_lastPlayed.GetAsDBDateTime() + "'"
                                      : "NULL"};
 
-    sql = PrepareSQL("SELECT idFile FROM files WHERE strFileName = '%s' AND idPath=%i",
-                     strFileName.c_str(), idPath);
-
-    m_pDS->query(sql);
+    sql = "SELECT idFile FROM files WHERE strFileName = ? AND idPath = ?";
+    m_pDS->query(sql, {dbiplus::field_value(strFileName.c_str()), dbiplus::field_value(idPath)});
     if (m_pDS->num_rows() > 0)
     {
       const int idFile{m_pDS->fv("idFile").get_asInt()};
@@ -7279,11 +7464,14 @@ void CVideoDatabase::UpdateTables(int iVersion)
     m_pDS->exec("ALTER TABLE movie ADD originalLanguage TEXT");
     m_pDS->exec("ALTER TABLE tvshow ADD originalLanguage TEXT");
   }
+
+  if (iVersion < 141)
+    CreateChangelogTable();
 }
 
 int CVideoDatabase::GetSchemaVersion() const
 {
-  return 139;
+  return 141;
 }
 
 bool CVideoDatabase::LookupByFolders(const std::string &path, bool shows)
@@ -7395,6 +7583,58 @@ bool CVideoDatabase::GetPlayCounts(const std::string &strPath, CFileItemList &it
   return false;
 }
 
+bool CVideoDatabase::GetPlayStates(const std::string& pathPrefix,
+                                   std::unordered_map<std::string, VideoFilePlayState>& states)
+{
+  try
+  {
+    if (nullptr == m_pDB)
+      return false;
+    if (nullptr == m_pDS)
+      return false;
+
+    const std::string sql = PrepareSQL(
+        "SELECT path.strPath, files.strFilename, files.idFile, files.playCount, files.lastPlayed,"
+        "  bookmark.idBookmark, bookmark.timeInSeconds, bookmark.totalTimeInSeconds,"
+        "  bookmark.thumbNailImage, bookmark.playerState, bookmark.player "
+        "FROM files"
+        "  JOIN path ON files.idPath = path.idPath"
+        "  LEFT JOIN bookmark ON files.idFile = bookmark.idFile AND bookmark.type = %i "
+        "WHERE path.strPath LIKE '%s%%'",
+        static_cast<int>(CBookmark::RESUME), pathPrefix.c_str());
+    if (!m_pDS->query(sql))
+      return false;
+
+    while (!m_pDS->eof())
+    {
+      std::string path;
+      ConstructPath(path, m_pDS->fv(0).get_asString(), m_pDS->fv(1).get_asString());
+
+      VideoFilePlayState& state = states[path];
+      state.fileId = m_pDS->fv(2).get_asInt();
+      state.playCount = m_pDS->fv(3).get_asInt();
+      state.lastPlayed.SetFromDBDateTime(m_pDS->fv(4).get_asString());
+      if (!m_pDS->fv(5).get_isNull())
+      {
+        state.resumePoint.timeInSeconds = m_pDS->fv(6).get_asDouble();
+        state.resumePoint.totalTimeInSeconds = m_pDS->fv(7).get_asDouble();
+        state.resumePoint.thumbNailImage = m_pDS->fv(8).get_asString();
+        state.resumePoint.playerState = m_pDS->fv(9).get_asString();
+        state.resumePoint.player = m_pDS->fv(10).get_asString();
+        state.resumePoint.type = CBookmark::RESUME;
+      }
+      m_pDS->next();
+    }
+    m_pDS->close();
+    return true;
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "({}) failed", pathPrefix);
+  }
+  return false;
+}
+
 int CVideoDatabase::GetPlayCount(int iFileId)
 {
   if (iFileId < 0)
@@ -9116,14 +9356,17 @@ bool CVideoDatabase::GetMoviesByWhere(const std::string& strBaseDir, const Filte
     if (!CDatabase::BuildSQL(strSQLExtra, extFilter, strSQLExtra))
       return false;
 
-    // Apply the limiting directly here if there's no special sorting but limiting
-    if (extFilter.limit.empty() && sorting.sortBy == SortByNone &&
-        (sorting.limitStart > 0 || sorting.limitEnd > 0 ||
-         (sorting.limitStart == 0 && sorting.limitEnd == 0)))
-    {
-      total = GetSingleValueInt(PrepareSQL(strSQL, "COUNT(1)") + strSQLExtra, *m_pDS);
-      strSQLExtra += DatabaseUtils::BuildLimitClause(sorting.limitEnd, sorting.limitStart);
-    }
+    auto& cache = CVideoDbListingCache::GetInstance();
+    const uint64_t generation = cache.GetGeneration();
+    const std::string cacheKey = GetListingCacheKey(MediaTypeMovie, strBaseDir, extFilter.fields,
+                                                    strSQLExtra, sorting, getDetails);
+    if (!cacheKey.empty() && cache.Get(cacheKey, items))
+      return true;
+    const int firstItem = items.Size();
+
+    // Apply the limiting directly here if the items to keep can be picked in SQL
+    const bool limitedInSQL =
+        ApplyLimitInSQL(strSQL, extFilter, sorting, MediaTypeMovie, strSQLExtra, total);
 
     strSQL = PrepareSQL(strSQL, !extFilter.fields.empty() ? extFilter.fields.c_str() : "*") + strSQLExtra;
 
@@ -9140,7 +9383,9 @@ bool CVideoDatabase::GetMoviesByWhere(const std::string& strBaseDir, const Filte
     DatabaseResults results;
     results.reserve(iRowsFound);
 
-    if (!SortUtils::SortFromDataset(sortDescription, MediaTypeMovie, *m_pDS, results))
+    if (!SortUtils::SortFromDataset(
+            limitedInSQL ? GetSortingAfterSQLLimit(sortDescription) : sortDescription,
+            MediaTypeMovie, *m_pDS, results))
       return false;
 
     // get data from returned rows
@@ -9207,6 +9452,9 @@ bool CVideoDatabase::GetMoviesByWhere(const std::string& strBaseDir, const Filte
 
     // cleanup
     m_pDS->close();
+
+    if (!cacheKey.empty())
+      CacheListing(cacheKey, generation, items, firstItem);
     return true;
   }
   catch (...)
@@ -9262,14 +9510,9 @@ bool CVideoDatabase::GetTvShowsByWhere(const std::string& strBaseDir, const Filt
     if (!BuildSQL(strBaseDir, strSQLExtra, extFilter, strSQLExtra, videoUrl, sorting))
       return false;
 
-    // Apply the limiting directly here if there's no special sorting but limiting
-    if (extFilter.limit.empty() && sorting.sortBy == SortByNone &&
-        (sorting.limitStart > 0 || sorting.limitEnd > 0 ||
-         (sorting.limitStart == 0 && sorting.limitEnd == 0)))
-    {
-      total = GetSingleValueInt(PrepareSQL(strSQL, "COUNT(1)") + strSQLExtra, *m_pDS);
-      strSQLExtra += DatabaseUtils::BuildLimitClause(sorting.limitEnd, sorting.limitStart);
-    }
+    // Apply the limiting directly here if the items to keep can be picked in SQL
+    const bool limitedInSQL =
+        ApplyLimitInSQL(strSQL, extFilter, sorting, MediaTypeTvShow, strSQLExtra, total);
 
     strSQL = PrepareSQL(strSQL, !extFilter.fields.empty() ? extFilter.fields.c_str() : "*") + strSQLExtra;
 
@@ -9285,7 +9528,8 @@ bool CVideoDatabase::GetTvShowsByWhere(const std::string& strBaseDir, const Filt
 
     DatabaseResults results;
     results.reserve(iRowsFound);
-    if (!SortUtils::SortFromDataset(sorting, MediaTypeTvShow, *m_pDS, results))
+    if (!SortUtils::SortFromDataset(limitedInSQL ? GetSortingAfterSQLLimit(sorting) : sorting,
+                                    MediaTypeTvShow, *m_pDS, results))
       return false;
 
     // get data from returned rows
@@ -9391,14 +9635,18 @@ bool CVideoDatabase::GetEpisodesByWhere(const std::string& strBaseDir, const Fil
     if (!BuildSQL(strBaseDir, strSQLExtra, extFilter, strSQLExtra, videoUrl, sorting))
       return false;
 
-    // Apply the limiting directly here if there's no special sorting but limiting
-    if (extFilter.limit.empty() && sorting.sortBy == SortByNone &&
-        (sorting.limitStart > 0 || sorting.limitEnd > 0 ||
-         (sorting.limitStart == 0 && sorting.limitEnd == 0)))
-    {
-      total = GetSingleValueInt(PrepareSQL(strSQL, "COUNT(1)") + strSQLExtra, *m_pDS);
-      strSQLExtra += DatabaseUtils::BuildLimitClause(sorting.limitEnd, sorting.limitStart);
-    }
+    auto& cache = CVideoDbListingCache::GetInstance();
+    const uint64_t generation = cache.GetGeneration();
+    const std::string cacheKey =
+        GetListingCacheKey(MediaTypeEpisode, strBaseDir, extFilter.fields, strSQLExtra, sorting,
+                           getDetails, appendFullShowPath ? 1 : 0);
+    if (!cacheKey.empty() && cache.Get(cacheKey, items))
+      return true;
+    const int firstItem = items.Size();
+
+    // Apply the limiting directly here if the items to keep can be picked in SQL
+    const bool limitedInSQL =
+        ApplyLimitInSQL(strSQL, extFilter, sorting, MediaTypeEpisode, strSQLExtra, total);
 
     strSQL = PrepareSQL(strSQL, !extFilter.fields.empty() ? extFilter.fields.c_str() : "*") + strSQLExtra;
 
@@ -9414,7 +9662,8 @@ bool CVideoDatabase::GetEpisodesByWhere(const std::string& strBaseDir, const Fil
 
     DatabaseResults results;
     results.reserve(iRowsFound);
-    if (!SortUtils::SortFromDataset(sorting, MediaTypeEpisode, *m_pDS, results))
+    if (!SortUtils::SortFromDataset(limitedInSQL ? GetSortingAfterSQLLimit(sorting) : sorting,
+                                    MediaTypeEpisode, *m_pDS, results))
       return false;
 
     // get data from returned rows
@@ -9459,6 +9708,9 @@ bool CVideoDatabase::GetEpisodesByWhere(const std::string& strBaseDir, const Fil
 
     // cleanup
     m_pDS->close();
+
+    if (!cacheKey.empty())
+      CacheListing(cacheKey, generation, items, firstItem);
     return true;
   }
   catch (...)
@@ -10069,9 +10321,10 @@ void CVideoDatabase::GetMovieActorsByName(const std::string& strSearch, CFileIte
 
     if (m_profileManager.GetMasterProfile().getLockMode() != LockMode::EVERYONE &&
         !g_passwordManager.bMasterUser)
-      strSQL=PrepareSQL("SELECT actor.actor_id, actor.name, path.strPath FROM actor INNER JOIN actor_link ON actor_link.actor_id=actor.actor_id INNER JOIN movie ON actor_link.media_id=movie.idMovie INNER JOIN files ON files.idFile=movie.idFile INNER JOIN path ON path.idPath=files.idPath WHERE actor_link.media_type='movie' AND actor.name LIKE '%%%s%%'", strSearch.c_str());
+      strSQL=PrepareSQL("SELECT actor.actor_id, actor.name, path.strPath FROM actor INNER JOIN actor_link ON actor_link.actor_id=actor.actor_id INNER JOIN movie ON actor_link.media_id=movie.idMovie INNER JOIN files ON files.idFile=movie.idFile INNER JOIN path ON path.idPath=files.idPath WHERE actor_link.media_type='movie' AND ");
     else
-      strSQL=PrepareSQL("SELECT DISTINCT actor.actor_id, actor.name FROM actor INNER JOIN actor_link ON actor_link.actor_id=actor.actor_id INNER JOIN movie ON actor_link.media_id=movie.idMovie WHERE actor_link.media_type='movie' AND actor.name LIKE '%%%s%%'", strSearch.c_str());
+      strSQL=PrepareSQL("SELECT DISTINCT actor.actor_id, actor.name FROM actor INNER JOIN actor_link ON actor_link.actor_id=actor.actor_id INNER JOIN movie ON actor_link.media_id=movie.idMovie WHERE actor_link.media_type='movie' AND ");
+    strSQL += GetSearchCondition("actor", "actor.actor_id", {"name"}, strSearch);
     m_pDS->query( strSQL );
 
     while (!m_pDS->eof())
@@ -10371,14 +10624,9 @@ bool CVideoDatabase::GetMusicVideosByWhere(const std::string &baseDir, const Fil
     if (!BuildSQL(baseDir, strSQLExtra, extFilter, strSQLExtra, videoUrl, sorting))
       return false;
 
-    // Apply the limiting directly here if there's no special sorting but limiting
-    if (extFilter.limit.empty() && sorting.sortBy == SortByNone &&
-        (sorting.limitStart > 0 || sorting.limitEnd > 0 ||
-         (sorting.limitStart == 0 && sorting.limitEnd == 0)))
-    {
-      total = GetSingleValueInt(PrepareSQL(strSQL, "COUNT(1)") + strSQLExtra, *m_pDS);
-      strSQLExtra += DatabaseUtils::BuildLimitClause(sorting.limitEnd, sorting.limitStart);
-    }
+    // Apply the limiting directly here if the items to keep can be picked in SQL
+    const bool limitedInSQL =
+        ApplyLimitInSQL(strSQL, extFilter, sorting, MediaTypeMusicVideo, strSQLExtra, total);
 
     strSQL = PrepareSQL(strSQL, !extFilter.fields.empty() ? extFilter.fields.c_str() : "*") + strSQLExtra;
 
@@ -10394,7 +10642,8 @@ bool CVideoDatabase::GetMusicVideosByWhere(const std::string &baseDir, const Fil
 
     DatabaseResults results;
     results.reserve(iRowsFound);
-    if (!SortUtils::SortFromDataset(sorting, MediaTypeMusicVideo, *m_pDS, results))
+    if (!SortUtils::SortFromDataset(limitedInSQL ? GetSortingAfterSQLLimit(sorting) : sorting,
+                                    MediaTypeMusicVideo, *m_pDS, results))
       return false;
 
     // get data from returned rows
@@ -10451,7 +10700,6 @@ unsigned int CVideoDatabase::GetRandomMusicVideoIDs(const std::string& strWhere,
     std::string strSQL = "select distinct idMVideo from musicvideo_view";
     if (!strWhere.empty())
       strSQL += " where " + strWhere;
-    strSQL += PrepareSQL(" ORDER BY RANDOM()");
 
     if (!m_pDS->query(strSQL)) return 0;
     songIDs.clear();
@@ -10541,15 +10789,15 @@ void CVideoDatabase::GetMoviesByName(const std::string& strSearch, CFileItemList
         !g_passwordManager.bMasterUser)
       strSQL = PrepareSQL("SELECT movie.idMovie, movie.c%02d, path.strPath, movie.idSet FROM movie "
                           "INNER JOIN files ON files.idFile=movie.idFile INNER JOIN path ON "
-                          "path.idPath=files.idPath "
-                          "WHERE movie.c%02d LIKE '%%%s%%' OR movie.c%02d LIKE '%%%s%%'",
-                          VIDEODB_ID_TITLE, VIDEODB_ID_TITLE, strSearch.c_str(),
-                          VIDEODB_ID_ORIGINALTITLE, strSearch.c_str());
+                          "path.idPath=files.idPath WHERE ",
+                          VIDEODB_ID_TITLE);
     else
-      strSQL = PrepareSQL("SELECT movie.idMovie,movie.c%02d, movie.idSet FROM movie WHERE "
-                          "movie.c%02d like '%%%s%%' OR movie.c%02d LIKE '%%%s%%'",
-                          VIDEODB_ID_TITLE, VIDEODB_ID_TITLE, strSearch.c_str(),
-                          VIDEODB_ID_ORIGINALTITLE, strSearch.c_str());
+      strSQL = PrepareSQL("SELECT movie.idMovie,movie.c%02d, movie.idSet FROM movie WHERE ",
+                          VIDEODB_ID_TITLE);
+    strSQL += GetSearchCondition("movie", "movie.idMovie",
+                                 {StringUtils::Format("c{:02}", VIDEODB_ID_TITLE),
+                                  StringUtils::Format("c{:02}", VIDEODB_ID_ORIGINALTITLE)},
+                                 strSearch);
     m_pDS->query( strSQL );
 
     while (!m_pDS->eof())
@@ -10596,9 +10844,11 @@ void CVideoDatabase::GetTvShowsByName(const std::string& strSearch, CFileItemLis
 
     if (m_profileManager.GetMasterProfile().getLockMode() != LockMode::EVERYONE &&
         !g_passwordManager.bMasterUser)
-      strSQL = PrepareSQL("SELECT tvshow.idShow, tvshow.c%02d, path.strPath FROM tvshow INNER JOIN tvshowlinkpath ON tvshowlinkpath.idShow=tvshow.idShow INNER JOIN path ON path.idPath=tvshowlinkpath.idPath WHERE tvshow.c%02d LIKE '%%%s%%'", VIDEODB_ID_TV_TITLE, VIDEODB_ID_TV_TITLE, strSearch.c_str());
+      strSQL = PrepareSQL("SELECT tvshow.idShow, tvshow.c%02d, path.strPath FROM tvshow INNER JOIN tvshowlinkpath ON tvshowlinkpath.idShow=tvshow.idShow INNER JOIN path ON path.idPath=tvshowlinkpath.idPath WHERE ", VIDEODB_ID_TV_TITLE);
     else
-      strSQL = PrepareSQL("select tvshow.idShow,tvshow.c%02d from tvshow where tvshow.c%02d like '%%%s%%'",VIDEODB_ID_TV_TITLE,VIDEODB_ID_TV_TITLE,strSearch.c_str());
+      strSQL = PrepareSQL("select tvshow.idShow,tvshow.c%02d from tvshow where ",VIDEODB_ID_TV_TITLE);
+    strSQL += GetSearchCondition("tvshow", "tvshow.idShow",
+                                 {StringUtils::Format("c{:02}", VIDEODB_ID_TV_TITLE)}, strSearch);
     m_pDS->query( strSQL );
 
     while (!m_pDS->eof())
@@ -10642,9 +10892,12 @@ void CVideoDatabase::GetEpisodesByName(const std::string& strSearch, CFileItemLi
 
     if (m_profileManager.GetMasterProfile().getLockMode() != LockMode::EVERYONE &&
         !g_passwordManager.bMasterUser)
-      strSQL = PrepareSQL("SELECT episode.idEpisode, episode.c%02d, episode.c%02d, episode.idShow, tvshow.c%02d, path.strPath FROM episode INNER JOIN tvshow ON tvshow.idShow=episode.idShow INNER JOIN files ON files.idFile=episode.idFile INNER JOIN path ON path.idPath=files.idPath WHERE episode.c%02d LIKE '%%%s%%'", VIDEODB_ID_EPISODE_TITLE, VIDEODB_ID_EPISODE_SEASON, VIDEODB_ID_TV_TITLE, VIDEODB_ID_EPISODE_TITLE, strSearch.c_str());
+      strSQL = PrepareSQL("SELECT episode.idEpisode, episode.c%02d, episode.c%02d, episode.idShow, tvshow.c%02d, path.strPath FROM episode INNER JOIN tvshow ON tvshow.idShow=episode.idShow INNER JOIN files ON files.idFile=episode.idFile INNER JOIN path ON path.idPath=files.idPath WHERE ", VIDEODB_ID_EPISODE_TITLE, VIDEODB_ID_EPISODE_SEASON, VIDEODB_ID_TV_TITLE);
     else
-      strSQL = PrepareSQL("SELECT episode.idEpisode, episode.c%02d, episode.c%02d, episode.idShow, tvshow.c%02d FROM episode INNER JOIN tvshow ON tvshow.idShow=episode.idShow WHERE episode.c%02d like '%%%s%%'", VIDEODB_ID_EPISODE_TITLE, VIDEODB_ID_EPISODE_SEASON, VIDEODB_ID_TV_TITLE, VIDEODB_ID_EPISODE_TITLE, strSearch.c_str());
+      strSQL = PrepareSQL("SELECT episode.idEpisode, episode.c%02d, episode.c%02d, episode.idShow, tvshow.c%02d FROM episode INNER JOIN tvshow ON tvshow.idShow=episode.idShow WHERE ", VIDEODB_ID_EPISODE_TITLE, VIDEODB_ID_EPISODE_SEASON, VIDEODB_ID_TV_TITLE);
+    strSQL += GetSearchCondition("episode", "episode.idEpisode",
+                                 {StringUtils::Format("c{:02}", VIDEODB_ID_EPISODE_TITLE)},
+                                 strSearch);
     m_pDS->query( strSQL );
 
     while (!m_pDS->eof())
@@ -10692,9 +10945,12 @@ void CVideoDatabase::GetMusicVideosByName(const std::string& strSearch, CFileIte
 
     if (m_profileManager.GetMasterProfile().getLockMode() != LockMode::EVERYONE &&
         !g_passwordManager.bMasterUser)
-      strSQL = PrepareSQL("SELECT musicvideo.idMVideo, musicvideo.c%02d, path.strPath FROM musicvideo INNER JOIN files ON files.idFile=musicvideo.idFile INNER JOIN path ON path.idPath=files.idPath WHERE musicvideo.c%02d LIKE '%%%s%%'", VIDEODB_ID_MUSICVIDEO_TITLE, VIDEODB_ID_MUSICVIDEO_TITLE, strSearch.c_str());
+      strSQL = PrepareSQL("SELECT musicvideo.idMVideo, musicvideo.c%02d, path.strPath FROM musicvideo INNER JOIN files ON files.idFile=musicvideo.idFile INNER JOIN path ON path.idPath=files.idPath WHERE ", VIDEODB_ID_MUSICVIDEO_TITLE);
     else
-      strSQL = PrepareSQL("select musicvideo.idMVideo,musicvideo.c%02d from musicvideo where musicvideo.c%02d like '%%%s%%'",VIDEODB_ID_MUSICVIDEO_TITLE,VIDEODB_ID_MUSICVIDEO_TITLE,strSearch.c_str());
+      strSQL = PrepareSQL("select musicvideo.idMVideo,musicvideo.c%02d from musicvideo where ",VIDEODB_ID_MUSICVIDEO_TITLE);
+    strSQL += GetSearchCondition("musicvideo", "musicvideo.idMVideo",
+                                 {StringUtils::Format("c{:02}", VIDEODB_ID_MUSICVIDEO_TITLE)},
+                                 strSearch);
     m_pDS->query( strSQL );
 
     while (!m_pDS->eof())
@@ -10999,22 +11255,17 @@ void CVideoDatabase::CleanDatabase(CGUIDialogProgressBarHandle* handle,
       }
     }
 
-    BeginTransaction();
-
     // find all the files
     std::string sql = "SELECT files.idFile, files.strFileName, path.strPath FROM files "
                       "INNER JOIN path ON path.idPath=files.idPath";
+    std::string strPaths;
     if (!paths.empty())
     {
-      std::string strPaths;
       for (const auto& i : paths)
         strPaths += StringUtils::Format(",{}", i);
       sql += PrepareSQL(" AND path.idPath IN (%s)", strPaths.substr(1).c_str());
     }
 
-    // For directory caching to work properly, we need to sort the files by path
-    sql += " ORDER BY path.strPath";
-
     m_pDS2->query(sql);
     if (m_pDS2->num_rows() > 0)
     {
@@ -11023,10 +11274,9 @@ void CVideoDatabase::CleanDatabase(CGUIDialogProgressBarHandle* handle,
           *CMediaSourceSettings::GetInstance().GetSources("video"));
       CServiceBroker::GetMediaManager().GetRemovableDrives(videoSources);
 
-      int total = m_pDS2->num_rows();
-      int current = 0;
-      std::string lastDir;
-      bool gotDir = true;
+      // the files of sources are checked in parallel, see CFileExistenceChecker
+      CFileExistenceChecker checker("special://database/VideoCleanCheckpoint.json",
+                                    strPaths.empty() ? "all" : strPaths.substr(1));
 
       while (!m_pDS2->eof())
       {
@@ -11064,50 +11314,47 @@ void CVideoDatabase::CleanDatabase(CGUIDialogProgressBarHandle* handle,
           if (!URIUtils::IsOnDVD(fullPath) &&
               CUtil::GetMatchingSource(fullPath, videoSources, bIsSource) >= 0)
           {
-            const std::string pathDir = URIUtils::GetDirectory(fullPath);
-
-            // Cache file's directory in case it's different from the previous file
-            if (lastDir != pathDir)
-            {
-              lastDir = pathDir;
-              CFileItemList items; // Dummy list
-              gotDir = CDirectory::GetDirectory(pathDir, items, "",
-                                                DIR_FLAG_NO_FILE_DIRS | DIR_FLAG_NO_FILE_INFO);
-            }
-
-            // Keep existing files
-            if (gotDir && CFile::Exists(fullPath, true))
-              del = false;
+            checker.AddFile(m_pDS2->fv("files.idFile").get_asInt(), fullPath);
+            del = false;
           }
         }
         if (del)
           filesToTestForDelete += m_pDS2->fv("files.idFile").get_asString() + ",";
 
-        if (!handle && progress)
-        {
-          int percentage = current * 100 / total;
-          if (percentage > progress->GetPercentage())
-          {
-            progress->SetPercentage(percentage);
-            progress->Progress();
-          }
-          if (progress->IsCanceled())
-          {
-            progress->Close();
-            m_pDS2->close();
-            CServiceBroker::GetAnnouncementManager()->Announce(ANNOUNCEMENT::VideoLibrary,
-                                                               "OnCleanFinished");
-            return;
-          }
-        }
-        else if (handle)
-          handle->SetPercentage(current * 100 / (float)total);
-
         m_pDS2->next();
-        current++;
       }
       m_pDS2->close();
 
+      const bool checked = checker.Run(
+          [handle, progress](size_t current, size_t total)
+          {
+            if (!handle && progress)
+            {
+              int percentage = static_cast<int>(current * 100 / total);
+              if (percentage > progress->GetPercentage())
+              {
+                progress->SetPercentage(percentage);
+                progress->Progress();
+              }
+              return !progress->IsCanceled();
+            }
+            else if (handle)
+              handle->SetPercentage(current * 100 / static_cast<float>(total));
+            return true;
+          });
+      if (!checked)
+      {
+        if (progress)
+          progress->Close();
+        CServiceBroker::GetAnnouncementManager()->Announce(ANNOUNCEMENT::VideoLibrary,
+                                                           "OnCleanFinished");
+        return;
+      }
+      for (int idFile : checker.GetMissing())
+        filesToTestForDelete += StringUtils::Format("{},", idFile);
+
+      BeginTransaction();
+
       std::string filesToDelete;
 
       // Add any files that don't have a valid idPath entry to the filesToDelete list.
@@ -11330,6 +11577,7 @@ void CVideoDatabase::CleanDatabase(CGUIDialogProgressBarHandle* handle,
       m_pDS->exec(sql);
 
       CommitTransaction();
+      checker.Finish();
 
       if (handle)
         handle->SetTitle(g_localizeStrings.Get(331));
@@ -11644,6 +11892,8 @@ void CVideoDatabase::ExportToXML(const std::string &path, bool singleFile /* = t
     TiXmlDeclaration decl("1.0", "UTF-8", "yes");
     xmlDoc.InsertEndChild(decl);
     TiXmlNode* pMain = nullptr;
+    // the single file is written as we go, pMain only holds the item being exported
+    CXBMCTinyXMLStreamWriter xmlWriter;
     if (!singleFile)
       pMain = &xmlDoc;
     else
@@ -11651,6 +11901,7 @@ void CVideoDatabase::ExportToXML(const std::string &path, bool singleFile /* = t
       TiXmlElement xmlMainElement("videodb");
       pMain = xmlDoc.InsertEndChild(xmlMainElement);
       XMLUtils::SetInt(pMain,"version", GetExportVersion());
+      xmlWriter.Open(xmlFile, "videodb");
     }
 
     // Save information for each version
@@ -11684,6 +11935,8 @@ void CVideoDatabase::ExportToXML(const std::string &path, bool singleFile /* = t
     CLog::LogF(LOGDEBUG, "Starting...");
     while (!pDS3->eof())
     {
+      if (singleFile)
+        xmlWriter.WriteChildren(pMain);
       // reset old skip state
       bool bSkip = false;
 
@@ -11835,6 +12088,8 @@ void CVideoDatabase::ExportToXML(const std::string &path, bool singleFile /* = t
       current = 0;
       while (!m_pDS->eof())
       {
+        if (singleFile)
+          xmlWriter.WriteChildren(pMain);
         std::string title = m_pDS->fv("strOriginalSet").get_asString();
 
         if (progress)
@@ -11925,6 +12180,8 @@ void CVideoDatabase::ExportToXML(const std::string &path, bool singleFile /* = t
 
     while (!m_pDS->eof())
     {
+      if (singleFile)
+        xmlWriter.WriteChildren(pMain);
       CVideoInfoTag movie = GetDetailsForMusicVideo(*m_pDS, VideoDbDetailsAll);
       KODI::ART::Artwork artwork;
       if (GetArtForItem(movie.m_iDbId, movie.m_type, artwork) && !artwork.empty() && singleFile)
@@ -12019,6 +12276,8 @@ void CVideoDatabase::ExportToXML(const std::string &path, bool singleFile /* = t
 
     while (!pDS2->eof())
     {
+      if (singleFile)
+        xmlWriter.WriteChildren(pMain);
       CVideoInfoTag tvshow = GetDetailsForTvShow(*pDS2, VideoDbDetailsAll);
       GetTvShowSeasons(tvshow.m_iDbId, tvshow.m_seasons);
 
@@ -12268,7 +12527,9 @@ void CVideoDatabase::ExportToXML(const std::string &path, bool singleFile /* = t
           XMLUtils::SetString(pPath,"scraperpath", info->ID());
         }
       }
-      xmlDoc.SaveFile(xmlFile);
+      xmlWriter.WriteChildren(pMain);
+      if (!xmlWriter.Close())
+        iFailCount++;
     }
     CVariant data;
 
@@ -12359,13 +12620,14 @@ void CVideoDatabase::ImportFromXML(const std::string &path)
     if (nullptr == m_pDS)
       return;
 
-    CXBMCTinyXML xmlDoc;
-    if (!xmlDoc.LoadFile(URIUtils::AddFileToFolder(path, "videodb.xml")))
+    // the export can be far larger than the available memory, so it is read one
+    // element at a time: a first pass counts the items and adds the paths (which
+    // are written last), a second pass imports the items
+    const std::string xmlFile = URIUtils::AddFileToFolder(path, "videodb.xml");
+    CXBMCTinyXMLStreamReader reader;
+    if (!reader.Open(xmlFile))
       return;
 
-    TiXmlElement *root = xmlDoc.RootElement();
-    if (!root) return;
-
     progress = CServiceBroker::GetGUI()->GetWindowManager().GetWindow<CGUIDialogProgress>(WINDOW_DIALOG_PROGRESS);
     if (progress)
     {
@@ -12378,59 +12640,73 @@ void CVideoDatabase::ImportFromXML(const std::string &path)
       progress->ShowProgressBar(true);
     }
 
-    int iVersion = 0;
-    XMLUtils::GetInt(root, "version", iVersion);
-
-    CLog::Log(LOGINFO, "Starting import (export version = {})", iVersion);
+    std::string actorsDir(URIUtils::AddFileToFolder(path, "actors"));
+    std::string moviesDir(URIUtils::AddFileToFolder(path, "movies"));
+    std::string movieSetsDir(URIUtils::AddFileToFolder(path, "moviesets"));
+    std::string musicvideosDir(URIUtils::AddFileToFolder(path, "musicvideos"));
+    std::string tvshowsDir(URIUtils::AddFileToFolder(path, "tvshows"));
+    CVideoInfoScanner scanner;
 
-    TiXmlElement *movie = root->FirstChildElement();
+    int iVersion = 0;
     int current = 0;
     int total = 0;
-    // first count the number of items...
+    // first count the number of items and add the paths (so we have scraper settings available)
+    const TiXmlElement* movie = reader.ReadNextElement();
     while (movie)
     {
       if (StringUtils::CompareNoCase(movie->Value(), MediaTypeMovie, 5) == 0 ||
           StringUtils::CompareNoCase(movie->Value(), MediaTypeTvShow, 6) == 0 ||
           StringUtils::CompareNoCase(movie->Value(), MediaTypeMusicVideo, 10) == 0)
         total++;
-      movie = movie->NextSiblingElement();
-    }
-
-    std::string actorsDir(URIUtils::AddFileToFolder(path, "actors"));
-    std::string moviesDir(URIUtils::AddFileToFolder(path, "movies"));
-    std::string movieSetsDir(URIUtils::AddFileToFolder(path, "moviesets"));
-    std::string musicvideosDir(URIUtils::AddFileToFolder(path, "musicvideos"));
-    std::string tvshowsDir(URIUtils::AddFileToFolder(path, "tvshows"));
-    CVideoInfoScanner scanner;
-    // add paths first (so we have scraper settings available)
-    TiXmlElement* pathElem = root->FirstChildElement("paths");
-    pathElem = pathElem->FirstChildElement();
-    while (pathElem)
-    {
-      std::string strPath;
-      if (XMLUtils::GetString(pathElem, "url", strPath) && !strPath.empty())
-        AddPath(strPath);
-
-      std::string content;
-      if (XMLUtils::GetString(pathElem, "content", content) && !content.empty())
-      { // check the scraper exists, if so store the path
-        AddonPtr addon;
-        std::string id;
-        XMLUtils::GetString(pathElem, "scraperpath", id);
-        if (CServiceBroker::GetAddonMgr().GetAddon(id, addon, ADDON::OnlyEnabled::CHOICE_YES))
+      else if (movie->ValueStr() == "version" && movie->GetText())
+        iVersion = static_cast<int>(std::strtol(movie->GetText(), nullptr, 10));
+      else if (movie->ValueStr() == "paths")
+      {
+        const TiXmlElement* pathElem = movie->FirstChildElement();
+        while (pathElem)
         {
-          SScanSettings settings;
-          ScraperPtr scraper = std::dynamic_pointer_cast<CScraper>(addon);
-          // FIXME: scraper settings are not exported?
-          scraper->SetPathSettings(TranslateContent(content), "");
-          XMLUtils::GetInt(pathElem, "scanrecursive", settings.recurse);
-          XMLUtils::GetBoolean(pathElem, "usefoldernames", settings.parent_name);
-          SetScraperForPath(strPath,scraper,settings);
+          std::string strPath;
+          if (XMLUtils::GetString(pathElem, "url", strPath) && !strPath.empty())
+            AddPath(strPath);
+
+          std::string content;
+          if (XMLUtils::GetString(pathElem, "content", content) && !content.empty())
+          { // check the scraper exists, if so store the path
+            AddonPtr addon;
+            std::string id;
+            XMLUtils::GetString(pathElem, "scraperpath", id);
+            if (CServiceBroker::GetAddonMgr().GetAddon(id, addon, ADDON::OnlyEnabled::CHOICE_YES))
+            {
+              SScanSettings settings;
+              ScraperPtr scraper = std::dynamic_pointer_cast<CScraper>(addon);
+              // FIXME: scraper settings are not exported?
+              scraper->SetPathSettings(TranslateContent(content), "");
+              XMLUtils::GetInt(pathElem, "scanrecursive", settings.recurse);
+              XMLUtils::GetBoolean(pathElem, "usefoldernames", settings.parent_name);
+              SetScraperForPath(strPath,scraper,settings);
+            }
+          }
+          pathElem = pathElem->NextSiblingElement();
         }
       }
-      pathElem = pathElem->NextSiblingElement();
+      movie = reader.ReadNextElement();
+    }
+    if (reader.HasError())
+    {
+      if (progress)
+        progress->Close();
+      return;
+    }
+
+    CLog::Log(LOGINFO, "Starting import (export version = {})", iVersion);
+
+    if (!reader.Open(xmlFile))
+    {
+      if (progress)
+        progress->Close();
+      return;
     }
-    movie = root->FirstChildElement();
+    movie = reader.ReadNextElement();
     std::string lastTitle;
     int lastMovieId{-1};
     while (movie)
@@ -12542,7 +12818,7 @@ void CVideoDatabase::ImportFromXML(const std::string &path)
         }
         current++;
         // now load the episodes
-        TiXmlElement *episode = movie->FirstChildElement("episodedetails");
+        const TiXmlElement* episode = movie->FirstChildElement("episodedetails");
         while (episode)
         {
           // no need to delete the episode info, due to the above deletion
@@ -12568,7 +12844,7 @@ void CVideoDatabase::ImportFromXML(const std::string &path)
         currentTitle = info.GetTitle();
         current++;
       }
-      movie = movie->NextSiblingElement();
+      movie = reader.ReadNextElement();
       if (progress && total)
       {
         progress->SetPercentage(current * 100 / total);
@@ -14146,7 +14422,9 @@ std::vector<std::string> CVideoDatabase::GetUsedImages(
       for (const auto& image : imagesToCheck)
       {
         auto imageFile = IMAGE_FILES::CImageFileURL(image);
-        if (imageFile.GetSpecialType() == "video" && !imageFile.GetOption("chapter").empty())
+        if (imageFile.GetSpecialType() == "video" &&
+            (!imageFile.GetOption("chapter").empty() ||
+             !imageFile.GetOption("chaptersheet").empty()))
         {
           const auto& target = imageFile.GetTargetFile();
           const auto quickFind = std::ranges::find(foundVideoFiles, target);
@@ -520,6 +520,17 @@ struct EpisodeInformation
   unsigned int duration{0};
 };
 
+/*!
+ \brief The locally stored play state of a file.
+ */
+struct VideoFilePlayState
+{
+  int fileId{-1};
+  int playCount{0};
+  CDateTime lastPlayed;
+  CBookmark resumePoint;
+};
+
 using EpisodeFileMap = std::multimap<std::string, EpisodeInformation, std::less<>>;
 using EpisodeFileMapEntry = std::pair<std::string, EpisodeInformation>;
 
@@ -629,6 +640,17 @@ public:
    */
   bool GetPlayCounts(const std::string &path, CFileItemList &items);
 
+  /*! \brief Get the play states of all files below a path with a single query
+   Meant for filling in many items at once, e.g. all PVR recordings, instead of file by file.
+   Files not in the database have no entry.
+   \param pathPrefix the path the files are below, including subdirectories
+   \param states [out] the play states, keyed by the full path of the files
+   \return true on success, false otherwise
+   \sa GetPlayCount, GetLastPlayed, GetResumeBookMark
+   */
+  bool GetPlayStates(const std::string& pathPrefix,
+                     std::unordered_map<std::string, VideoFilePlayState>& states);
+
   void UpdateMovieTitle(int idMovie,
                         const std::string& strNewMovieTitle,
                         VideoDbContentType iType = VideoDbContentType::MOVIES);
@@ -1181,9 +1203,10 @@ public:
   std::string GetItemById(const std::string &itemType, int id);
 
   // partymode
-  /*! \brief Gets music video IDs in random order that match the where clause
+  /*! \brief Gets the IDs of the music videos that match the where clause, to pick random
+  music videos from
   \param strWhere the SQL where clause to apply in the query
-  \param songIDs a vector of <2, id> pairs suited to party mode use
+  \param songIDs a vector of <2, id> pairs suited to party mode use, in no particular order
   \return count of music video IDs found.
   */
   unsigned int GetRandomMusicVideoIDs(const std::string& strWhere, std::vector<std::pair<int, int> > &songIDs);
@@ -1568,6 +1591,69 @@ private:
    */
   int RunQuery(const std::string &sql);
 
+  /*! \brief Apply the sort limit of a listing in SQL if the items it keeps can be picked there.
+   That is the case without sorting, with random sorting and when sorting by a field that is a
+   plain column of the view. The items returned then only need to be put in order in memory.
+   \param sql the query with a placeholder for the selected fields
+   \param filter the filter of the query
+   \param sorting the sorting and limit of the listing
+   \param mediaType the media type of the view queried
+   \param sqlExtra the filter clauses of the query, the ORDER BY and LIMIT clauses are added
+   \param total set to the number of items without limit if the limit is applied
+   \return true if the limit has been applied in SQL
+   */
+  bool ApplyLimitInSQL(const std::string& sql,
+                       const Filter& filter,
+                       const SortDescription& sorting,
+                       const MediaType& mediaType,
+                       std::string& sqlExtra,
+                       int& total);
+
+  /*! \brief Build the condition for a search on text columns of a table.
+   Uses the full text index of the table if there is one, which matches words starting with the
+   searched words, and a substring match on each column otherwise.
+   \param table the table searched
+   \param idColumn the primary key of the table, as it is to be referred to in the query
+   \param columns the columns searched, as named in the table
+   \param search the text searched for
+   \return the condition
+   */
+  std::string GetSearchCondition(const std::string& table,
+                                 const std::string& idColumn,
+                                 const std::vector<std::string>& columns,
+                                 const std::string& search);
+
+  /*! \brief Build the key for a listing in CVideoDbListingCache.
+   Returns an empty key if the listing must not be cached, e.g. because the result depends on
+   which locked sources have been unlocked.
+   \param type the kind of listing
+   \param baseDir the base path of the listing
+   \param fields the fields selected from the view
+   \param sqlExtra the filter clauses of the query
+   \param sorting the sorting applied to the results
+   \param getDetails the details fetched for each item
+   \param flags any other argument changing the items built
+   \return the key, empty if the listing is not cacheable
+   */
+  std::string GetListingCacheKey(std::string_view type,
+                                 const std::string& baseDir,
+                                 const std::string& fields,
+                                 const std::string& sqlExtra,
+                                 const SortDescription& sorting,
+                                 int getDetails,
+                                 int flags = 0) const;
+
+  /*! \brief Store a listing in CVideoDbListingCache.
+   \param key the key from GetListingCacheKey()
+   \param generation the cache generation from before the query was run
+   \param items the list holding the listing
+   \param first the index of the first item of the listing in items
+   */
+  void CacheListing(const std::string& key,
+                    uint64_t generation,
+                    const CFileItemList& items,
+                    int first) const;
+
   void AppendIdLinkFilter(const char* field,
                           const char* table,
                           const MediaType& mediaType,
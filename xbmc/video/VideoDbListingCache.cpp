@@ -0,0 +1,141 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "VideoDbListingCache.h"
+
+#include "FileItem.h"
+#include "FileItemList.h"
+
+#include <mutex>
+
+CVideoDbListingCache& CVideoDbListingCache::GetInstance()
+{
+  static CVideoDbListingCache cache;
+  return cache;
+}
+
+bool CVideoDbListingCache::Get(const std::string& key, CFileItemList& items)
+{
+  std::shared_ptr<const Entry> entry;
+  {
+    std::unique_lock lock(m_section);
+    const auto it = m_index.find(key);
+    if (it == m_index.end())
+    {
+      m_misses++;
+      return false;
+    }
+
+    if (it->second->second->expiring && Clock::now() >= it->second->second->expires)
+    {
+      m_items -= it->second->second->items.size();
+      m_lru.erase(it->second);
+      m_index.erase(it);
+      m_misses++;
+      return false;
+    }
+
+    m_lru.splice(m_lru.begin(), m_lru, it->second);
+    entry = it->second->second;
+    m_hits++;
+  }
+
+  // cached items are never modified, so they can be copied without holding the lock
+  items.Reserve(items.Size() + entry->items.size());
+  for (const auto& item : entry->items)
+    items.Add(std::make_shared<CFileItem>(*item));
+  for (const auto& [name, value] : entry->properties)
+    items.SetProperty(name, value);
+
+  return true;
+}
+
+void CVideoDbListingCache::Put(const std::string& key,
+                               uint64_t generation,
+                               const CFileItemList& items,
+                               int first,
+                               const std::vector<std::string>& properties,
+                               std::chrono::milliseconds maxAge /* = zero */)
+{
+  const size_t count = items.Size() > first ? static_cast<size_t>(items.Size() - first) : 0;
+  {
+    std::unique_lock lock(m_section);
+    if (generation != m_generation || count > m_maxItems)
+      return;
+  }
+
+  auto entry = std::make_shared<Entry>();
+  entry->items.reserve(count);
+  for (int i = first; i < items.Size(); ++i)
+    entry->items.emplace_back(std::make_shared<const CFileItem>(*items.Get(i)));
+  for (const auto& name : properties)
+  {
+    if (items.HasProperty(name))
+      entry->properties.emplace_back(name, items.GetProperty(name));
+  }
+  entry->expiring = maxAge > std::chrono::milliseconds::zero();
+  entry->expires = Clock::now() + maxAge;
+
+  std::unique_lock lock(m_section);
+
+  // the database changed while the items were copied
+  if (generation != m_generation || count > m_maxItems)
+    return;
+
+  const auto it = m_index.find(key);
+  if (it != m_index.end())
+  {
+    m_items -= it->second->second->items.size();
+    m_lru.erase(it->second);
+    m_index.erase(it);
+  }
+
+  // make room before adding, so the new entry is never the one evicted
+  Trim(m_maxItems - count);
+
+  m_lru.emplace_front(key, std::move(entry));
+  m_index.emplace(key, m_lru.begin());
+  m_items += count;
+}
+
+void CVideoDbListingCache::Invalidate()
+{
+  std::unique_lock lock(m_section);
+
+  m_generation++;
+  if (m_lru.empty())
+    return;
+
+  m_lru.clear();
+  m_index.clear();
+  m_items = 0;
+  m_invalidations++;
+}
+
+void CVideoDbListingCache::SetMaxItems(size_t maxItems)
+{
+  std::unique_lock lock(m_section);
+  m_maxItems = maxItems;
+  Trim(maxItems);
+}
+
+CVideoDbListingCache::Stats CVideoDbListingCache::GetStats() const
+{
+  std::unique_lock lock(m_section);
+  return {m_lru.size(), m_items, m_hits, m_misses, m_invalidations};
+}
+
+void CVideoDbListingCache::Trim(size_t maxItems)
+{
+  while (m_items > maxItems && !m_lru.empty())
+  {
+    m_items -= m_lru.back().second->items.size();
+    m_index.erase(m_lru.back().first);
+    m_lru.pop_back();
+  }
+}
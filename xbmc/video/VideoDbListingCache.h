@@ -0,0 +1,128 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+#include "utils/Variant.h"
+
+#include <atomic>
+#include <chrono>
+#include <list>
+#include <memory>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class CFileItem;
+class CFileItemList;
+
+/*!
+ \ingroup videodatabase
+ \brief Caches the items built by the CVideoDatabase listing queries.
+
+ Building a movie or episode listing means querying the heavy movie_view/episode_view views and
+ turning every row into a CFileItem, which takes seconds for large libraries. Library windows and
+ home screen widgets ask for the same listings over and over, so the finished items are kept here
+ keyed on the query, and handed out as copies.
+
+ Any write to the video database invalidates the whole cache by bumping its generation. Results
+ of a query that was running while the database changed are not stored, see GetGeneration().
+ Entries may additionally carry a maximum age, used for server databases that other clients can
+ change behind our back. The total number of cached items is bounded, least recently used
+ listings are evicted first. Safe to use from several threads.
+ */
+class CVideoDbListingCache
+{
+public:
+  struct Stats
+  {
+    size_t entries; /**< number of cached listings */
+    size_t items; /**< number of items in those listings */
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t invalidations;
+  };
+
+  static CVideoDbListingCache& GetInstance();
+
+  CVideoDbListingCache() = default;
+  CVideoDbListingCache(const CVideoDbListingCache&) = delete;
+  CVideoDbListingCache& operator=(const CVideoDbListingCache&) = delete;
+
+  /*!
+   \brief Get the current generation, to be passed to Put() for results queried afterwards.
+   */
+  uint64_t GetGeneration() const { return m_generation; }
+
+  /*!
+   \brief Append copies of a cached listing to a list.
+   \param key the key the listing was stored under
+   \param items [out] the list receiving the items and cached properties
+   \return true if the listing was cached, false otherwise
+   */
+  bool Get(const std::string& key, CFileItemList& items);
+
+  /*!
+   \brief Store a listing.
+   \param key the key to store the listing under
+   \param generation the value of GetGeneration() before the query was started
+   \param items the list holding the listing
+   \param first the index of the first item of the listing in items
+   \param properties the names of the list properties to store along with the items
+   \param maxAge the time after which the entry is no longer used, zero for no limit
+   */
+  void Put(const std::string& key,
+           uint64_t generation,
+           const CFileItemList& items,
+           int first,
+           const std::vector<std::string>& properties,
+           std::chrono::milliseconds maxAge = std::chrono::milliseconds::zero());
+
+  /*!
+   \brief Drop all cached listings, called whenever the database changes.
+   */
+  void Invalidate();
+
+  /*!
+   \brief Set the maximum number of items held in all listings, 0 disables the cache.
+   */
+  void SetMaxItems(size_t maxItems);
+
+  Stats GetStats() const;
+
+  static constexpr size_t DEFAULT_MAX_ITEMS = 50000;
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Entry
+  {
+    std::vector<std::shared_ptr<const CFileItem>> items;
+    std::vector<std::pair<std::string, CVariant>> properties;
+    Clock::time_point expires;
+    bool expiring;
+  };
+
+  using LruList = std::list<std::pair<std::string, std::shared_ptr<const Entry>>>;
+
+  void Trim(size_t maxItems);
+
+  LruList m_lru; /**< most recently used first */
+  std::unordered_map<std::string, LruList::iterator> m_index;
+  size_t m_items = 0;
+  size_t m_maxItems = DEFAULT_MAX_ITEMS;
+  std::atomic<uint64_t> m_generation{0};
+  uint64_t m_hits = 0;
+  uint64_t m_misses = 0;
+  uint64_t m_invalidations = 0;
+  mutable CCriticalSection m_section;
+};
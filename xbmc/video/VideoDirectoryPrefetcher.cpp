@@ -0,0 +1,145 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "VideoDirectoryPrefetcher.h"
+
+#include "URL.h"
+#include "jobs/JobQueue.h"
+
+#include <mutex>
+
+namespace KODI::VIDEO
+{
+
+CVideoDirectoryPrefetcher::JobState::~JobState()
+{
+  entry->done.Set();
+}
+
+std::unique_ptr<CVideoDirectoryPrefetcher::Listing> CVideoDirectoryPrefetcher::CPendingListing::
+    Wait()
+{
+  if (!m_entry)
+    return nullptr;
+
+  const std::shared_ptr<Entry> entry = std::move(m_entry);
+  entry->done.Wait();
+
+  std::unique_lock lock(entry->section);
+  return std::move(entry->listing);
+}
+
+CVideoDirectoryPrefetcher::CVideoDirectoryPrefetcher(unsigned int jobsPerHost,
+                                                     size_t maxPending /* = DEFAULT_MAX_PENDING */)
+  : m_jobsPerHost(jobsPerHost),
+    m_maxPending(maxPending)
+{
+}
+
+CVideoDirectoryPrefetcher::~CVideoDirectoryPrefetcher()
+{
+  Cancel();
+}
+
+bool CVideoDirectoryPrefetcher::Prefetch(const std::string& directory, FetchFunction fetch)
+{
+  std::unique_lock lock(m_section);
+  if (m_entries.contains(directory))
+    return true;
+
+  if (m_jobsPerHost == 0 || m_entries.size() >= m_maxPending)
+    return false;
+
+  auto entry = std::make_shared<Entry>();
+  m_entries.emplace(directory, entry);
+
+  std::unique_ptr<CJobQueue>& queue = m_queues[GetHostKey(directory)];
+  if (!queue)
+  {
+    // the number of jobs is bounded by m_maxPending, so they can have threads of their own
+    // instead of competing with thumbnail loaders and the like for the shared workers
+    queue = std::make_unique<CJobQueue>(false, m_jobsPerHost, CJob::PRIORITY_DEDICATED);
+  }
+
+  // the job only holds on to the entry, so it may outlive the prefetcher. Waiters are woken up
+  // however the job ends, also if it's dropped from the queue without having run.
+  auto state = std::make_shared<JobState>(entry);
+  queue->Submit(
+      [state, fetch = std::move(fetch)]()
+      {
+        Entry& entry = *state->entry;
+        {
+          std::unique_lock entryLock(entry.section);
+          if (entry.cancelled)
+            return;
+        }
+
+        auto listing = std::make_unique<Listing>();
+        fetch(*listing);
+
+        std::unique_lock entryLock(entry.section);
+        if (!entry.cancelled)
+          entry.listing = std::move(listing);
+      });
+
+  return true;
+}
+
+bool CVideoDirectoryPrefetcher::CanPrefetch() const
+{
+  std::unique_lock lock(m_section);
+  return m_jobsPerHost > 0 && m_entries.size() < m_maxPending;
+}
+
+CVideoDirectoryPrefetcher::CPendingListing CVideoDirectoryPrefetcher::Take(
+    const std::string& directory)
+{
+  std::unique_lock lock(m_section);
+  const auto it = m_entries.find(directory);
+  if (it == m_entries.end())
+    return {};
+
+  CPendingListing pending(std::move(it->second));
+  m_entries.erase(it);
+  return pending;
+}
+
+void CVideoDirectoryPrefetcher::Cancel()
+{
+  std::map<std::string, std::unique_ptr<CJobQueue>> queues;
+  {
+    std::unique_lock lock(m_section);
+    for (const auto& [_, entry] : m_entries)
+    {
+      std::unique_lock entryLock(entry->section);
+      entry->cancelled = true;
+      entry->listing.reset();
+      entry->done.Set();
+    }
+    m_entries.clear();
+    queues.swap(m_queues);
+  }
+
+  // destroying the queues drops the jobs which haven't started yet, which wakes up anyone waiting
+  // for them
+  queues.clear();
+}
+
+size_t CVideoDirectoryPrefetcher::GetPending() const
+{
+  std::unique_lock lock(m_section);
+  return m_entries.size();
+}
+
+std::string CVideoDirectoryPrefetcher::GetHostKey(const std::string& directory)
+{
+  const CURL url(directory);
+  return url.GetProtocol() + "://" + url.GetHostName();
+}
+
+} // namespace KODI::VIDEO
@@ -0,0 +1,141 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "FileItemList.h"
+#include "threads/CriticalSection.h"
+#include "threads/Event.h"
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <stddef.h>
+#include <string>
+
+class CJobQueue;
+
+namespace KODI::VIDEO
+{
+/*!
+ \brief Lists directories ahead of the video library scanner.
+
+ The scanner walks one directory at a time and blocks on every listing, which adds up to hours for
+ network sources with thousands of folders. Directories it is about to visit are handed to
+ Prefetch() and listed by background jobs, at most a few at a time per host so a single NAS isn't
+ flooded while several sources are scanned at once. Take() then usually finds the listing ready.
+
+ Only fetching runs in parallel, everything touching the database stays on the scanner thread.
+ */
+class CVideoDirectoryPrefetcher
+{
+public:
+  struct Listing
+  {
+    std::string fastHash; /**< fast hash of the directory, empty if not available */
+    bool listed = false; /**< whether items holds the directory listing */
+    CFileItemList items;
+  };
+
+  /*!
+   \brief Fills in the listing of a directory, called from a job thread.
+   */
+  using FetchFunction = std::function<void(Listing& listing)>;
+
+private:
+  struct Entry
+  {
+    CCriticalSection section;
+    CEvent done{true};
+    std::unique_ptr<Listing> listing;
+    bool cancelled = false;
+  };
+
+  struct JobState
+  {
+    explicit JobState(std::shared_ptr<Entry> e) : entry(std::move(e)) {}
+    ~JobState();
+
+    std::shared_ptr<Entry> entry;
+  };
+
+public:
+  /*!
+   \brief A listing taken out of the prefetcher, which may still be being fetched.
+
+   Dropping it without calling Wait() discards the listing.
+   */
+  class CPendingListing
+  {
+  public:
+    CPendingListing() = default;
+
+    explicit operator bool() const { return m_entry != nullptr; }
+
+    /*!
+     \brief Wait for the listing to be fetched.
+     \return the listing, nullptr if there is none or the prefetcher was cancelled
+     */
+    std::unique_ptr<Listing> Wait();
+
+  private:
+    friend class CVideoDirectoryPrefetcher;
+    explicit CPendingListing(std::shared_ptr<Entry> entry) : m_entry(std::move(entry)) {}
+
+    std::shared_ptr<Entry> m_entry;
+  };
+
+  /*!
+   \param jobsPerHost the number of directories listed at once per host, 0 disables prefetching
+   \param maxPending the number of listings fetched or held at most
+   */
+  explicit CVideoDirectoryPrefetcher(unsigned int jobsPerHost,
+                                     size_t maxPending = DEFAULT_MAX_PENDING);
+  ~CVideoDirectoryPrefetcher();
+
+  CVideoDirectoryPrefetcher(const CVideoDirectoryPrefetcher&) = delete;
+  CVideoDirectoryPrefetcher& operator=(const CVideoDirectoryPrefetcher&) = delete;
+
+  /*!
+   \brief Start fetching the listing of a directory in the background.
+   \param directory the directory, used as the key for Take()
+   \param fetch the function filling in the listing
+   \return true if the directory is being fetched, false if there is no room for another one
+   */
+  bool Prefetch(const std::string& directory, FetchFunction fetch);
+
+  /*!
+   \brief Whether there is room for another directory to be prefetched.
+   */
+  bool CanPrefetch() const;
+
+  /*!
+   \brief Take the listing of a directory out of the prefetcher.
+   \return the pending listing, empty if the directory wasn't prefetched
+   */
+  CPendingListing Take(const std::string& directory);
+
+  /*!
+   \brief Drop all pending listings, waiting callers get nullptr.
+   */
+  void Cancel();
+
+  size_t GetPending() const;
+
+  static constexpr size_t DEFAULT_MAX_PENDING = 32;
+
+private:
+  static std::string GetHostKey(const std::string& directory);
+
+  const unsigned int m_jobsPerHost;
+  const size_t m_maxPending;
+  std::map<std::string, std::shared_ptr<Entry>> m_entries;
+  std::map<std::string, std::unique_ptr<CJobQueue>> m_queues;
+  mutable CCriticalSection m_section;
+};
+} // namespace KODI::VIDEO
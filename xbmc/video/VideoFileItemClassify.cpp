@@ -125,7 +125,7 @@ bool IsVideoAssetFile(const CFileItem& item)
     return false;
 
   // @todo better encoding of video assets as path, they won't always be tied with movies.
-  const CURL url{item.GetPath()};
+  const CURL& url = item.GetURL();
   return (url.HasOption("videoversionid") || url.HasOption("assetType"));
 }
 
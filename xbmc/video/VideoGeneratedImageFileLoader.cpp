@@ -11,6 +11,7 @@
 #include "DVDFileInfo.h"
 #include "FileItem.h"
 #include "ServiceBroker.h"
+#include "TextureCache.h"
 #include "URL.h"
 #include "filesystem/DirectoryCache.h"
 #include "guilib/Texture.h"
@@ -22,6 +23,7 @@
 #include "video/VideoInfoTag.h"
 
 #include <charconv>
+#include <cstring>
 
 namespace KODI::VIDEO
 {
@@ -53,6 +55,64 @@ void SetupRarOptions(CFileItem& item, const std::string& path)
     item.SetPath(url.Get());
   g_directoryCache.ClearDirectory(CURL(url.GetWithoutFilename()));
 }
+
+int GetIntOption(const IMAGE_FILES::CImageFileURL& imageFile, const std::string& key)
+{
+  const std::string option = imageFile.GetOption(key);
+  int value = 0;
+  std::from_chars(option.data(), option.data() + option.size(), value);
+  return value;
+}
+
+/*!
+ * \brief Cut the thumb of a chapter out of the chapter sheet of the file.
+ *
+ * The sheet is generated and put in the texture cache by the first chapter asking for it, the
+ * other chapters of the file are then served from the cached sheet.
+ */
+std::unique_ptr<CTexture> LoadChapterFromSheet(const std::string& filePath,
+                                               int chapter,
+                                               int chapterCount)
+{
+  if (chapterCount < 2 || chapterCount > CDVDFileInfo::MAX_THUMB_SHEET_TILES ||
+      chapter > chapterCount)
+    return {};
+
+  auto sheetURL = IMAGE_FILES::CImageFileURL::FromFile(filePath, "video");
+  sheetURL.AddOption("chaptersheet", std::to_string(chapterCount));
+  const std::string sheetKey = sheetURL.ToCacheKey();
+
+  const auto textureCache = CServiceBroker::GetTextureCache();
+  std::unique_ptr<CTexture> sheet;
+  bool needsRecaching = false;
+  const std::string cachedSheet = textureCache->CheckCachedImage(sheetKey, needsRecaching);
+  if (!cachedSheet.empty())
+    sheet = CTexture::LoadFromFile(cachedSheet);
+  else
+    textureCache->CacheImage(sheetKey, &sheet);
+
+  // tiles can only be cut out of plain BGRA pixels
+  if (!sheet || !sheet->GetPixels() || sheet->GetPitch() < sheet->GetWidth() * 4)
+    return {};
+
+  int columns;
+  int rows;
+  CDVDFileInfo::GetThumbSheetLayout(chapterCount, columns, rows);
+  const unsigned int tileWidth = sheet->GetWidth() / columns;
+  const unsigned int tileHeight = sheet->GetHeight() / rows;
+  if (!tileWidth || !tileHeight)
+    return {};
+
+  const unsigned int x = ((chapter - 1) % columns) * tileWidth;
+  const unsigned int y = ((chapter - 1) / columns) * tileHeight;
+  auto tile = CTexture::CreateTexture(tileWidth, tileHeight);
+  tile->SetAlpha(false);
+  for (unsigned int row = 0; row < tileHeight; ++row)
+    std::memcpy(tile->GetPixels() + row * tile->GetPitch(),
+                sheet->GetPixels() + (y + row) * sheet->GetPitch() + x * 4, tileWidth * 4);
+
+  return tile;
+}
 } // namespace
 
 std::unique_ptr<CTexture> CVideoGeneratedImageFileLoader::Load(
@@ -70,9 +130,17 @@ std::unique_ptr<CTexture> CVideoGeneratedImageFileLoader::Load(
   if (URIUtils::IsInRAR(filePath))
     SetupRarOptions(item, filePath);
 
-  std::string chapterOption = imageFile.GetOption("chapter");
-  int chapter = 0;
-  std::from_chars(chapterOption.data(), chapterOption.data() + chapterOption.size(), chapter);
+  const int chapterSheet = GetIntOption(imageFile, "chaptersheet");
+  if (chapterSheet > 0)
+    return CDVDFileInfo::ExtractChapterSheetToTexture(item, chapterSheet);
+
+  const int chapter = GetIntOption(imageFile, "chapter");
+  if (chapter > 0)
+  {
+    auto tile = LoadChapterFromSheet(filePath, chapter, GetIntOption(imageFile, "chapters"));
+    if (tile)
+      return tile;
+  }
 
   return CDVDFileInfo::ExtractThumbToTexture(item, chapter);
 }
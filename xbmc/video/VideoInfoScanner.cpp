@@ -57,6 +57,9 @@
 #include "video/dialogs/GUIDialogVideoManagerVersions.h"
 
 #include <algorithm>
+#include <atomic>
+#include <deque>
+#include <future>
 #include <memory>
 #include <ranges>
 #include <set>
@@ -88,6 +91,11 @@ constexpr int MAX_EPISODE_RANGE = 50;
 // Character following season/episode range must be one of these for range to be valid.
 constexpr std::string_view allowed{"-_.esx "};
 
+// files opened at once to extract stream details after a scan
+constexpr size_t STREAM_DETAILS_CONCURRENCY = 4;
+// stream details stored per database transaction
+constexpr size_t STREAM_DETAILS_PER_TRANSACTION = 50;
+
 /*! \brief Perform checks, then add episodes in a given range to the episode list
  \param first first episode in the range to add.
  \param last last episode in the range.
@@ -232,7 +240,8 @@ namespace KODI::VIDEO
 {
 
 CVideoInfoScanner::CVideoInfoScanner()
-  : m_advancedSettings(CServiceBroker::GetSettingsComponent()->GetAdvancedSettings())
+  : m_advancedSettings(CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()),
+    m_prefetcher(m_advancedSettings->m_iVideoLibraryScanPrefetchPerHost)
 {
   m_bStop = false;
   m_scanAll = false;
@@ -321,11 +330,38 @@ CVideoInfoScanner::~CVideoInfoScanner()
                     CURL::GetRedacted(directory), m_bClean ? " and clean" : "");
           m_pathsToScan.erase(m_pathsToScan.begin());
         }
-        else if (!DoScan(directory))
-          bCancelled = true;
+        else
+        {
+          // list the next source while this one is scanned, folders below this one are listed
+          // ahead by DoScan() itself
+          auto next = m_pathsToScan.upper_bound(directory);
+          while (next != m_pathsToScan.end() && URIUtils::PathHasParent(*next, directory))
+            ++next;
+          if (next != m_pathsToScan.end() && !URIUtils::IsPlugin(*next))
+          {
+            SScanSettings settings;
+            bool foundDirectly = false;
+            const ScraperPtr info =
+                m_database.GetScraperForPath(*next, settings, foundDirectly, &m_scraperCache);
+            const ContentType content = info ? info->Content() : ContentType::NONE;
+            const std::vector<std::string>& regexps =
+                m_advancedSettings->m_moviesExcludeFromScanRegExps;
+            if ((content == ContentType::MOVIES || content == ContentType::MUSICVIDEOS) &&
+                (m_scanAll || !settings.noupdate) && !CUtil::ExcludeFileOrFolder(*next, regexps))
+              PrefetchListing(*next, regexps);
+          }
+
+          if (!DoScan(directory))
+            bCancelled = true;
+        }
       }
+      m_prefetcher.Cancel();
 
       if (!bCancelled)
+        ExtractStreamDetails();
+      m_pendingStreamDetails.clear();
+
+      if (!bCancelled && !m_bStop)
       {
         if (m_bClean)
           m_database.CleanDatabase(m_handle, m_pathsToClean, false);
@@ -360,6 +396,75 @@ CVideoInfoScanner::~CVideoInfoScanner()
     m_handle = NULL;
   }
 
+  void CVideoInfoScanner::ExtractStreamDetails()
+  {
+    if (m_pendingStreamDetails.empty())
+      return;
+
+    CLog::Log(LOGDEBUG, "VideoInfoScanner: Extracting stream details of {} files",
+              m_pendingStreamDetails.size());
+    if (m_handle)
+      m_handle->SetTitle(g_localizeStrings.Get(20433));
+
+    struct Result
+    {
+      std::atomic<bool> done{false};
+      bool extracted{false};
+      CStreamDetails details;
+    };
+    std::vector<Result> results(m_pendingStreamDetails.size());
+    std::atomic<size_t> nextFile{0};
+
+    // the files are mostly on the same disk or share, a few at a time keep it busy without
+    // seeking back and forth all the time
+    const auto worker = [this, &results, &nextFile]
+    {
+      for (size_t i = nextFile++; i < results.size(); i = nextFile++)
+      {
+        // files are still marked as done when the scan is stopped, nobody waits forever
+        CFileItem item;
+        item.GetVideoInfoTag()->m_strFileNameAndPath = m_pendingStreamDetails[i];
+        if (!m_bStop && CDVDFileInfo::GetFileStreamDetails(&item))
+        {
+          results[i].details = item.GetVideoInfoTag()->m_streamDetails;
+          results[i].extracted = true;
+        }
+        results[i].done = true;
+        results[i].done.notify_one();
+      }
+    };
+
+    std::vector<std::future<void>> workers;
+    const size_t concurrency = std::min<size_t>(STREAM_DETAILS_CONCURRENCY, results.size());
+    for (size_t i = 0; i < concurrency; i++)
+      workers.emplace_back(std::async(std::launch::async, worker));
+
+    // store the results in order as they come in, a few files per transaction
+    size_t stored = 0;
+    for (size_t i = 0; i < results.size() && !m_bStop; i++)
+    {
+      results[i].done.wait(false);
+      if (!results[i].extracted)
+        continue;
+
+      if (stored % STREAM_DETAILS_PER_TRANSACTION == 0)
+        m_database.BeginTransaction();
+      m_database.SetStreamDetailsForFile(results[i].details, m_pendingStreamDetails[i]);
+      if (++stored % STREAM_DETAILS_PER_TRANSACTION == 0)
+        m_database.CommitTransaction();
+
+      if (m_handle)
+        m_handle->SetPercentage(static_cast<float>(i + 1) * 100.0f / results.size());
+    }
+    if (stored % STREAM_DETAILS_PER_TRANSACTION != 0)
+      m_database.CommitTransaction();
+
+    for (auto& future : workers)
+      future.wait();
+
+    CLog::Log(LOGDEBUG, "VideoInfoScanner: Extracted stream details of {} files", stored);
+  }
+
   void CVideoInfoScanner::Start(const std::string& strDirectory, bool scanAll)
   {
     m_scanAll = scanAll;
@@ -402,6 +507,7 @@ CVideoInfoScanner::~CVideoInfoScanner()
       m_database.Interrupt();
 
     m_bStop = true;
+    m_prefetcher.Cancel();
   }
 
   bool CVideoInfoScanner::DoScan(const std::string& strDirectory)
@@ -420,6 +526,9 @@ CVideoInfoScanner::~CVideoInfoScanner()
     if (it != m_pathsToScan.end())
       m_pathsToScan.erase(it);
 
+    // the listing may have been started while scanning the parent folder, dropped if not needed
+    auto pending = m_prefetcher.Take(strDirectory);
+
     // load subfolder
     CFileItemList items;
     bool foundDirectly = false;
@@ -463,27 +572,28 @@ CVideoInfoScanner::~CVideoInfoScanner()
         m_handle->SetTitle(StringUtils::Format(g_localizeStrings.Get(str), info->Name()));
       }
 
-      std::string fastHash;
-      if (m_advancedSettings->m_bVideoLibraryUseFastHash && !URIUtils::IsPlugin(strDirectory))
-        fastHash = GetFastHash(strDirectory, regexps);
+      m_database.GetPathHash(strDirectory, dbHash);
 
-      if (m_database.GetPathHash(strDirectory, dbHash) && !fastHash.empty() && StringUtils::EqualsNoCase(fastHash, dbHash))
+      // a prefetched listing that was skipped because of a matching fast hash is only good as long
+      // as the hash in the database is still the same
+      std::unique_ptr<CVideoDirectoryPrefetcher::Listing> listing = pending.Wait();
+      if (!listing || (!listing->listed && !StringUtils::EqualsNoCase(listing->fastHash, dbHash)))
+      {
+        listing = std::make_unique<CVideoDirectoryPrefetcher::Listing>();
+        FetchListing(strDirectory, regexps,
+                     m_advancedSettings->m_bVideoLibraryUseFastHash &&
+                         !URIUtils::IsPlugin(strDirectory),
+                     dbHash, *listing);
+      }
+      const std::string& fastHash = listing->fastHash;
+
+      if (!listing->listed)
       { // fast hashes match - no need to process anything
         hash = fastHash;
       }
       else
-      { // need to fetch the folder
-        CDirectory::GetDirectory(strDirectory, items, CServiceBroker::GetFileExtensionProvider().GetVideoExtensions(),
-                                 DIR_FLAG_DEFAULTS);
-        // do not consider inner folders with .nomedia
-        items.erase(std::remove_if(items.begin(), items.end(), [](const CFileItemPtr& item)
-                                   { return item->IsFolder() && HasNoMedia(item->GetPath()); }),
-                    items.end());
-        items.Stack();
-
-        // force sorting consistency to avoid hash mismatch between platforms
-        // sort by filename as always present for any files, but keep case sensitivity
-        items.Sort(SortByFile, SortOrderAscending, SortAttributeNone);
+      {
+        items.Assign(listing->items);
 
         // check whether to re-use previously computed fast hash
         if (!CanFastHash(items, regexps) || fastHash.empty())
@@ -582,6 +692,7 @@ CVideoInfoScanner::~CVideoInfoScanner()
     if (m_handle)
       OnDirectoryScanned(strDirectory);
 
+    int prefetched = 0;
     for (int i = 0; i < items.Size(); ++i)
     {
       CFileItemPtr pItem = items[i];
@@ -608,6 +719,21 @@ CVideoInfoScanner::~CVideoInfoScanner()
       if (content != ContentType::TVSHOWS && settings.recurse > 0 && pItem->IsFolder() &&
           !pItem->IsParentFolder() && !PLAYLIST::IsPlayList(*pItem))
       {
+        // start listing the following folders while this one is scanned
+        for (prefetched = std::max(prefetched, i + 1); prefetched < items.Size(); ++prefetched)
+        {
+          const CFileItem& next = *items[prefetched];
+          if (!next.IsFolder() || next.IsParentFolder() || PLAYLIST::IsPlayList(next) ||
+              URIUtils::IsPlugin(next.GetPath()) ||
+              CUtil::ExcludeFileOrFolder(next.GetPath(), regexps) ||
+              (content == ContentType::MOVIES && settings.parent_name && !m_ignoreVideoExtras &&
+               IsVideoExtrasFolder(next)))
+            continue;
+
+          if (!PrefetchListing(next.GetPath(), regexps))
+            break;
+        }
+
         if (!DoScan(pItem->GetPath()))
         {
           m_bStop = true;
@@ -1556,10 +1682,19 @@ CVideoInfoScanner::~CVideoInfoScanner()
     // URLDecode in case an episode is on a http/https/dav/davs:// source and URL-encoded like foo%201x01%20bar.avi
     strLabel = CURL::Decode(CURL::GetRedacted(strLabel));
 
+    std::vector<std::string> patterns;
+    patterns.reserve(expression.size());
+    for (const auto& tvshowRegExp : expression)
+      patterns.emplace_back(tvshowRegExp.regexp);
+
+    CRegExpList regExps(patterns, true, CRegExp::autoUtf8);
+    if (!regExps.MayMatch(strLabel))
+      return false;
+
     for (unsigned int i=0;i<expression.size();++i)
     {
-      CRegExp reg(true, CRegExp::autoUtf8);
-      if (!reg.RegComp(expression[i].regexp))
+      CRegExp& reg = regExps[i];
+      if (!reg.IsCompiled())
         continue;
 
       int regexppos, regexp2pos;
@@ -1894,9 +2029,17 @@ CVideoInfoScanner::~CVideoInfoScanner()
           strmdetails.GetVideoWidth(1) == 0 || strmdetails.GetVideoDuration(1) == 0)
 
       {
-        CDVDFileInfo::GetFileStreamDetails(pItem);
-        CLog::Log(LOGDEBUG, "VideoInfoScanner: Extracted filestream details from video file {}",
-                  CURL::GetRedacted(path));
+        // during a scan the files are opened together once the scan is done, see
+        // ExtractStreamDetails()
+        if (m_bRunning)
+          m_pendingStreamDetails.emplace_back(movieDetails.m_strFileNameAndPath);
+        else
+        {
+          CDVDFileInfo::GetFileStreamDetails(pItem);
+          CLog::Log(LOGDEBUG,
+                    "VideoInfoScanner: Extracted filestream details from video file {}",
+                    CURL::GetRedacted(path));
+        }
       }
     }
 
@@ -2324,6 +2467,44 @@ CVideoInfoScanner::~CVideoInfoScanner()
     for (const auto& file : files)
       episodeMap[file.strPath]++;
 
+    struct PendingEpisode
+    {
+      CFileItem item;
+      InfoType result;
+      bool isFolder;
+      int season;
+      int episode;
+      CFileItem scraperItem;
+      std::future<bool> details; // last, so it's waited for before scraperItem is gone
+    };
+
+    // python scrapers run in their own interpreter per call, so the details of several episodes
+    // can be fetched at once. They are still added in order and on this thread.
+    const size_t concurrency =
+        scraper->IsPython() ? std::max(m_advancedSettings->m_iVideoLibraryScrapeConcurrency, 1) : 1;
+    std::deque<PendingEpisode> pending;
+    const auto addPending = [&]()
+    {
+      PendingEpisode& next = pending.front();
+      if (!next.details.get())
+        return InfoRet::NOT_FOUND; //! @todo should we just skip to the next episode?
+
+      CVideoInfoTag& tag = *next.scraperItem.GetVideoInfoTag();
+      if (next.result == InfoType::COMBINED || next.result == InfoType::OVERRIDE)
+        tag.Merge(*next.item.GetVideoInfoTag());
+
+      // Only set season/epnum from filename when it is not already set by a scraper
+      if (tag.m_iSeason == -1)
+        tag.m_iSeason = next.season;
+      if (tag.m_iEpisode == -1)
+        tag.m_iEpisode = next.episode;
+
+      const int id = AddVideo(&next.scraperItem, scraper, next.isFolder, useLocal, &showInfo,
+                              false, ContentType::TVSHOWS);
+      pending.pop_front();
+      return id < 0 ? InfoRet::INFO_ERROR : InfoRet::ADDED;
+    };
+
     int iMax = files.size();
     int iCurr = 1;
     for (EPISODELIST::iterator file = files.begin(); file != files.end(); ++file)
@@ -2370,6 +2551,12 @@ CVideoInfoScanner::~CVideoInfoScanner()
         std::tie(result, loader) = ReadInfoTag(item, info, false, false);
       if (result == InfoType::FULL)
       {
+        while (!pending.empty())
+        {
+          if (const InfoRet ret = addPending(); ret != InfoRet::ADDED)
+            return ret;
+        }
+
         // override with episode and season number from file if available
         if (file->iEpisode > -1)
         {
@@ -2517,25 +2704,32 @@ CVideoInfoScanner::~CVideoInfoScanner()
 
       if (bFound)
       {
-        CVideoInfoDownloader imdb(scraper);
-        CFileItem scraperItem;
-        scraperItem.SetPath(file->strPath);
-        if (!imdb.GetEpisodeDetails(guide->cScraperUrl, *scraperItem.GetVideoInfoTag(),
-                                    pDlgProgress))
-          return InfoRet::NOT_FOUND; //! @todo should we just skip to the next episode?
-
-        if (result == InfoType::COMBINED || result == InfoType::OVERRIDE)
-          scraperItem.GetVideoInfoTag()->Merge(*item.GetVideoInfoTag());
-
-        // Only set season/epnum from filename when it is not already set by a scraper
-        if (scraperItem.GetVideoInfoTag()->m_iSeason == -1)
-          scraperItem.GetVideoInfoTag()->m_iSeason = guide->iSeason;
-        if (scraperItem.GetVideoInfoTag()->m_iEpisode == -1)
-          scraperItem.GetVideoInfoTag()->m_iEpisode = guide->iEpisode;
+        PendingEpisode& next = pending.emplace_back(item, result, file->isFolder, guide->iSeason,
+                                                    guide->iEpisode);
+        next.scraperItem.SetPath(file->strPath);
+        CVideoInfoTag* tag = next.scraperItem.GetVideoInfoTag();
+        if (concurrency > 1)
+        {
+          next.details = std::async(std::launch::async,
+                                    [scraper, url = guide->cScraperUrl, tag]
+                                    {
+                                      CVideoInfoDownloader imdb(scraper);
+                                      return imdb.GetEpisodeDetails(url, *tag);
+                                    });
+        }
+        else
+        {
+          std::promise<bool> details;
+          CVideoInfoDownloader imdb(scraper);
+          details.set_value(imdb.GetEpisodeDetails(guide->cScraperUrl, *tag, pDlgProgress));
+          next.details = details.get_future();
+        }
 
-        if (AddVideo(&scraperItem, info, file->isFolder, useLocal, &showInfo, false,
-                     ContentType::TVSHOWS) < 0)
-          return InfoRet::INFO_ERROR;
+        while (pending.size() >= concurrency)
+        {
+          if (const InfoRet ret = addPending(); ret != InfoRet::ADDED)
+            return ret;
+        }
       }
       else
       {
@@ -2546,6 +2740,12 @@ CVideoInfoScanner::~CVideoInfoScanner()
             file->cDate.GetAsLocalizedDate(), file->strTitle);
       }
     }
+
+    while (!pending.empty())
+    {
+      if (const InfoRet ret = addPending(); ret != InfoRet::ADDED)
+        return ret;
+    }
     return InfoRet::ADDED;
   }
 
@@ -2655,27 +2855,50 @@ CVideoInfoScanner::~CVideoInfoScanner()
     return true;
   }
 
-  std::string CVideoInfoScanner::GetFastHash(const std::string &directory,
-      const std::vector<std::string> &excludes) const
+  void CVideoInfoScanner::FetchListing(const std::string& directory,
+                                       const std::vector<std::string>& excludes,
+                                       bool useFastHash,
+                                       const std::string& dbHash,
+                                       CVideoDirectoryPrefetcher::Listing& listing)
   {
-    CDigest digest{CDigest::Type::MD5};
+    if (useFastHash)
+      listing.fastHash = GetFastHash(directory, excludes);
 
-    if (!excludes.empty())
-      digest.Update(StringUtils::Join(excludes, "|"));
+    if (!listing.fastHash.empty() && StringUtils::EqualsNoCase(listing.fastHash, dbHash))
+      return;
 
-    struct __stat64 buffer;
-    if (XFILE::CFile::Stat(directory, &buffer) == 0)
-    {
-      int64_t time = buffer.st_mtime;
-      if (!time)
-        time = buffer.st_ctime;
-      if (time)
-      {
-        digest.Update((unsigned char *)&time, sizeof(time));
-        return digest.Finalize();
-      }
-    }
-    return "";
+    CFileItemList& items = listing.items;
+    CDirectory::GetDirectory(directory, items,
+                             CServiceBroker::GetFileExtensionProvider().GetVideoExtensions(),
+                             DIR_FLAG_DEFAULTS);
+    // do not consider inner folders with .nomedia
+    items.erase(std::remove_if(items.begin(), items.end(), [](const CFileItemPtr& item)
+                               { return item->IsFolder() && HasNoMedia(item->GetPath()); }),
+                items.end());
+    items.Stack();
+
+    // force sorting consistency to avoid hash mismatch between platforms
+    // sort by filename as always present for any files, but keep case sensitivity
+    items.Sort(SortByFile, SortOrderAscending, SortAttributeNone);
+    listing.listed = true;
+  }
+
+  bool CVideoInfoScanner::PrefetchListing(const std::string& directory,
+                                          const std::vector<std::string>& excludes)
+  {
+    if (!m_prefetcher.CanPrefetch())
+      return false;
+
+    // the database is only ever accessed from the scanner thread
+    std::string dbHash;
+    m_database.GetPathHash(directory, dbHash);
+    const bool useFastHash =
+        m_advancedSettings->m_bVideoLibraryUseFastHash && !URIUtils::IsPlugin(directory);
+
+    return m_prefetcher.Prefetch(
+        directory, [directory, excludes, useFastHash,
+                    dbHash](CVideoDirectoryPrefetcher::Listing& listing)
+        { FetchListing(directory, excludes, useFastHash, dbHash, listing); });
   }
 
   std::string CVideoInfoScanner::GetRecursiveFastHash(const std::string &directory,
@@ -10,10 +10,12 @@
 
 #include "InfoScanner.h"
 #include "VideoDatabase.h"
+#include "VideoDirectoryPrefetcher.h"
 #include "addons/Scraper.h"
 #include "guilib/GUIListItem.h"
 #include "utils/Artwork.h"
 
+#include <atomic>
 #include <set>
 #include <string>
 #include <vector>
@@ -262,18 +264,6 @@ namespace KODI::VIDEO
 
     static int GetPathHash(const CFileItemList &items, std::string &hash);
 
-    /*! \brief Retrieve a "fast" hash of the given directory (if available)
-     Performs a stat() on the directory, and uses modified time to create a "fast"
-     hash of the folder. If no modified time is available, the create time is used,
-     and if neither are available, an empty hash is returned.
-     In case exclude from scan expressions are present, the string array will be appended
-     to the md5 hash to ensure we're doing a re-scan whenever the user modifies those.
-     \param directory folder to hash
-     \param excludes string array of exclude expressions
-     \return the md5 hash of the folder"
-     */
-    std::string GetFastHash(const std::string &directory, const std::vector<std::string> &excludes) const;
-
     /*! \brief Retrieve a "fast" hash of the given directory recursively (if available)
      Performs a stat() on the directory, and uses modified time to create a "fast"
      hash of each folder. If no modified time is available, the create time is used,
@@ -313,6 +303,28 @@ namespace KODI::VIDEO
                                   const CVideoInfoTag& showInfo,
                                   CGUIDialogProgress* pDlgProgress = nullptr);
 
+    /*! \brief List a movie or music video folder the way DoScan() needs it
+     Safe to call from any thread, as it doesn't touch the database.
+     \param directory folder to list
+     \param excludes string array of exclude expressions
+     \param useFastHash whether to compute the "fast" hash of the folder
+     \param dbHash the hash of the folder in the database, the folder isn't listed if the fast hash
+     matches it
+     \param listing [out] the fast hash and the listing of the folder
+     */
+    static void FetchListing(const std::string& directory,
+                             const std::vector<std::string>& excludes,
+                             bool useFastHash,
+                             const std::string& dbHash,
+                             CVideoDirectoryPrefetcher::Listing& listing);
+
+    /*! \brief Start listing a movie or music video folder in the background
+     \param directory folder to list
+     \param excludes string array of exclude expressions
+     \return false if no more folders can be listed in the background, true otherwise
+     */
+    bool PrefetchListing(const std::string& directory, const std::vector<std::string>& excludes);
+
     bool EnumerateSeriesFolder(CFileItem* item, EPISODELIST& episodeList);
     bool ProcessItemByVideoInfoTag(const CFileItem *item, EPISODELIST &episodeList);
 
@@ -322,7 +334,13 @@ namespace KODI::VIDEO
     std::pair<InfoType, std::unique_ptr<IVideoInfoTagLoader>> ReadInfoTag(
         CFileItem& item, const ADDON::ScraperPtr& scraper, bool lookInFolder, bool resetTag);
 
-    bool m_bStop;
+    /*! \brief Extract and store the stream details of the files added by the scan, several files
+     are opened at once.
+     \sa AddVideo
+     */
+    void ExtractStreamDetails();
+
+    std::atomic<bool> m_bStop{false}; //!< also read by the stream details workers
     bool m_scanAll;
     bool m_ignoreVideoVersions{false};
     bool m_ignoreVideoExtras{false};
@@ -330,5 +348,7 @@ namespace KODI::VIDEO
     std::set<int> m_pathsToClean;
     std::shared_ptr<CAdvancedSettings> m_advancedSettings;
     CVideoDatabase::ScraperCache m_scraperCache;
+    CVideoDirectoryPrefetcher m_prefetcher;
+    std::vector<std::string> m_pendingStreamDetails; ///< files added without stream details
   };
   } // namespace KODI::VIDEO
@@ -16,6 +16,7 @@
 #include "cores/VideoPlayer/DVDFileInfo.h"
 #include "cores/VideoSettings.h"
 #include "filesystem/Directory.h"
+#include "filesystem/DirectoryCache.h"
 #include "filesystem/File.h"
 #include "filesystem/StackDirectory.h"
 #include "guilib/GUIComponent.h"
@@ -530,6 +531,20 @@ std::string CVideoThumbLoader::GetLocalArt(const CFileItem &item, const std::str
     CFileItemList items; // Dummy list
     CDirectory::GetDirectory(item.GetPath(), items, "", DIR_FLAG_NO_FILE_DIRS | DIR_FLAG_READ_CACHE | DIR_FLAG_NO_FILE_INFO);
   }
+  else if (!item.IsFolder() && NETWORK::IsRemote(item) && !item.IsStack() &&
+           !URIUtils::IsInArchive(item.GetPath()))
+  {
+    // All art of a remote file sits next to it. Listing its folder once (shared by all items
+    // in it) lets the cache answer every candidate below instead of probing each on the server.
+    bool folderInCache;
+    g_directoryCache.FileExists(CURL(item.GetPath()), folderInCache);
+    if (!folderInCache)
+    {
+      CFileItemList items; // Dummy list
+      CDirectory::GetDirectory(URIUtils::GetDirectory(item.GetPath()), items, "",
+                               DIR_FLAG_NO_FILE_DIRS | DIR_FLAG_NO_FILE_INFO);
+    }
+  }
 
   std::string art;
   if (!type.empty())
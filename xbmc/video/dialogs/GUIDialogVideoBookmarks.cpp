@@ -269,7 +269,8 @@ void CGUIDialogVideoBookmarks::OnRefreshList()
   // add chapters if around
   const auto& components = CServiceBroker::GetAppComponents();
   const auto appPlayer = components.GetComponent<CApplicationPlayer>();
-  for (int i = 1; i <= appPlayer->GetChapterCount(); ++i)
+  const int chapterCount = appPlayer->GetChapterCount();
+  for (int i = 1; i <= chapterCount; ++i)
   {
     std::string chapterName;
     appPlayer->GetChapterName(chapterName, i);
@@ -290,6 +291,8 @@ void CGUIDialogVideoBookmarks::OnRefreshList()
     {
       auto chapterPath = IMAGE_FILES::CImageFileURL::FromFile(m_filePath, "video");
       chapterPath.AddOption("chapter", std::to_string(i));
+      // lets all chapter thumbs come out of a single sprite sheet of the file
+      chapterPath.AddOption("chapters", std::to_string(chapterCount));
       item->SetArt("thumb", chapterPath.ToCacheKey());
     }
 
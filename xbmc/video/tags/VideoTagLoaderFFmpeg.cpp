@@ -59,78 +59,112 @@ CVideoTagLoaderFFmpeg::CVideoTagLoaderFFmpeg(const CFileItem& item,
   std::string filename =
       item.IsStack() ? CStackDirectory::GetFirstStackedFile(item.GetPath()) : item.GetPath();
 
-  m_file = new CFile;
+  CFile file;
+  if (!file.Open(filename))
+    return;
+
+  // only the metadata is needed, no reason to probe the streams
+  if (m_item.IsType(".mkv"))
+    m_opened = CContainerTagReader::ReadMatroska(file, m_tags);
+  else if (m_item.IsType(".mp4"))
+    m_opened = CContainerTagReader::ReadMp4(file, m_tags);
 
-  if (!m_file->Open(filename))
+  if (!m_opened)
   {
-    delete m_file;
-    m_file = nullptr;
-    return;
+    m_tags = {};
+    m_opened = file.Seek(0, SEEK_SET) == 0 && LoadFFmpeg(file);
   }
+}
+
+CVideoTagLoaderFFmpeg::~CVideoTagLoaderFFmpeg() = default;
 
-  int blockSize = m_file->GetChunkSize();
+bool CVideoTagLoaderFFmpeg::LoadFFmpeg(CFile& file)
+{
+  int blockSize = file.GetChunkSize();
   int bufferSize = blockSize > 1 ? blockSize : 4096;
   uint8_t* buffer = (uint8_t*)av_malloc(bufferSize);
-  m_ioctx = avio_alloc_context(buffer, bufferSize, 0,
-                               m_file, vfs_file_read, nullptr,
-                               vfs_file_seek);
+  AVIOContext* ioctx = avio_alloc_context(buffer, bufferSize, 0,
+                                          &file, vfs_file_read, nullptr,
+                                          vfs_file_seek);
 
-  m_fctx = avformat_alloc_context();
-  m_fctx->pb = m_ioctx;
+  AVFormatContext* fctx = avformat_alloc_context();
+  fctx->pb = ioctx;
 
-  if (m_file->IoControl(IOControl::SEEK_POSSIBLE, nullptr) != 1)
-    m_ioctx->seekable = 0;
+  if (file.IoControl(IOControl::SEEK_POSSIBLE, nullptr) != 1)
+    ioctx->seekable = 0;
 
   const AVInputFormat* iformat = nullptr;
-  av_probe_input_buffer(m_ioctx, &iformat, m_item.GetPath().c_str(), nullptr, 0, 0);
-  if (avformat_open_input(&m_fctx, m_item.GetPath().c_str(), iformat, nullptr) < 0)
+  av_probe_input_buffer(ioctx, &iformat, m_item.GetPath().c_str(), nullptr, 0, 0);
+  const bool opened = avformat_open_input(&fctx, m_item.GetPath().c_str(), iformat, nullptr) >= 0;
+  if (opened)
   {
-    delete m_file;
-    m_file = nullptr;
-  }
-}
+    const AVDictionaryEntry* avtag = nullptr;
+    while ((avtag = av_dict_get(fctx->metadata, "", avtag, AV_DICT_IGNORE_SUFFIX)))
+      m_tags.tags.emplace_back(avtag->key, avtag->value);
 
-CVideoTagLoaderFFmpeg::~CVideoTagLoaderFFmpeg()
-{
-  if (m_fctx)
-    avformat_close_input(&m_fctx);
-  if (m_ioctx)
-  {
-    av_free(m_ioctx->buffer);
-    av_free(m_ioctx);
+    // attachments are exposed as streams
+    for (size_t i = 0; i < fctx->nb_streams; ++i)
+    {
+      const AVStream* stream = fctx->streams[i];
+      const AVDictionaryEntry* filenameTag =
+          av_dict_get(stream->metadata, "filename", nullptr, AV_DICT_IGNORE_SUFFIX);
+      const AVDictionaryEntry* mimeTag =
+          av_dict_get(stream->metadata, "mimetype", nullptr, AV_DICT_IGNORE_SUFFIX);
+
+      ContainerAttachment attachment;
+      attachment.filename = filenameTag ? filenameTag->value : "";
+      if (stream->disposition & AV_DISPOSITION_ATTACHED_PIC)
+      {
+        attachment.mimetype = mimeTag ? mimeTag->value : "image/png";
+        const uint8_t* data = stream->attached_pic.data;
+        attachment.data.assign(data, data + stream->attached_pic.size);
+      }
+      else if (attachment.filename == "kodi-metadata" ||
+               attachment.filename == "kodi-override-metadata")
+      {
+        attachment.mimetype = mimeTag ? mimeTag->value : "";
+        const uint8_t* data = stream->codecpar->extradata;
+        attachment.data.assign(data, data + stream->codecpar->extradata_size);
+      }
+      else
+        continue;
+
+      m_tags.attachments.emplace_back(std::move(attachment));
+    }
   }
-  delete m_file;
+
+  // avformat_open_input frees the context on failure
+  if (fctx)
+    avformat_close_input(&fctx);
+  av_free(ioctx->buffer);
+  av_free(ioctx);
+  return opened;
 }
 
 bool CVideoTagLoaderFFmpeg::HasInfo() const
 {
-  if (!m_file)
+  if (!m_opened)
     return false;
 
-  for (size_t i = 0; i < m_fctx->nb_streams; ++i)
+  for (const ContainerAttachment& attachment : m_tags.attachments)
   {
-    const AVDictionaryEntry* avtag =
-        av_dict_get(m_fctx->streams[i]->metadata, "filename", nullptr, AV_DICT_IGNORE_SUFFIX);
-    if (avtag && strcmp(avtag->value,"kodi-metadata") == 0)
+    if (attachment.filename == "kodi-metadata")
     {
-      m_metadata_stream = i;
+      m_metadata = &attachment;
       return true;
     }
-    else if (avtag && strcmp(avtag->value,"kodi-override-metadata") == 0)
+    else if (attachment.filename == "kodi-override-metadata")
     {
-      m_metadata_stream = i;
+      m_metadata = &attachment;
       m_override_data = true;
       return true;
     }
   }
 
   if (m_item.IsType(".mkv"))
-  {
-    return av_dict_get(m_fctx->metadata, "IMDBURL", nullptr, AV_DICT_IGNORE_SUFFIX) ||
-           av_dict_get(m_fctx->metadata, "TMDBURL", nullptr, AV_DICT_IGNORE_SUFFIX) ||
-           av_dict_get(m_fctx->metadata, "TITLE", nullptr, AV_DICT_IGNORE_SUFFIX);
-  } else if (m_item.IsType(".mp4") || m_item.IsType(".avi"))
-    return av_dict_get(m_fctx->metadata, "title", nullptr, AV_DICT_IGNORE_SUFFIX);
+    return m_tags.Get("IMDBURL") || m_tags.Get("TMDBURL") || m_tags.Get("TITLE");
+  else if (m_item.IsType(".mp4") || m_item.IsType(".avi"))
+    return m_tags.Get("title");
   else
     return false;
 }
@@ -153,40 +187,30 @@ CInfoScanner::InfoType CVideoTagLoaderFFmpeg::LoadMKV(CVideoInfoTag& tag,
                                                       std::vector<EmbeddedArt>* art)
 {
   // embedded art
-  for (size_t i = 0; i < m_fctx->nb_streams; ++i)
+  for (const ContainerAttachment& attachment : m_tags.attachments)
   {
-    const auto& stream = m_fctx->streams[i];
-    if ((stream->disposition & AV_DISPOSITION_ATTACHED_PIC) == 0)
+    if (!attachment.IsImage() || attachment.filename.empty())
       continue;
 
-    const AVDictionaryEntry* filenameTag =
-        av_dict_get(stream->metadata, "filename", nullptr, AV_DICT_IGNORE_SUFFIX);
-    const AVDictionaryEntry* mimeTag =
-        av_dict_get(stream->metadata, "mimetype", nullptr, AV_DICT_IGNORE_SUFFIX);
-
-    if (filenameTag && strcmp(filenameTag->value, "") != 0 && mimeTag)
-    {
-      const std::string type = filenameToType(filenameTag->value);
+    const std::string type = filenameToType(attachment.filename);
 
-      if (type.empty())
-        continue;
+    if (type.empty())
+      continue;
 
-      const size_t size = stream->attached_pic.size;
-      if (art)
-        art->emplace_back(stream->attached_pic.data, size, mimeTag->value, type);
-      else
-        tag.m_coverArt.emplace_back(size, mimeTag->value, type);
-    }
+    const size_t size = attachment.data.size();
+    if (art)
+      art->emplace_back(attachment.data.data(), size, attachment.mimetype, type);
+    else
+      tag.m_coverArt.emplace_back(size, attachment.mimetype, type);
   }
 
-  if (m_metadata_stream != -1)
+  if (m_metadata)
   {
     CNfoFile nfo;
-    auto* data = m_fctx->streams[m_metadata_stream]->codecpar->extradata;
-    const char* content = reinterpret_cast<const char*>(data);
+    const std::string content(m_metadata->data.begin(), m_metadata->data.end());
     if (!m_override_data)
     {
-      nfo.GetDetails(tag, content);
+      nfo.GetDetails(tag, content.c_str());
       return CInfoScanner::InfoType::FULL;
     }
     else
@@ -203,27 +227,25 @@ CInfoScanner::InfoType CVideoTagLoaderFFmpeg::LoadMKV(CVideoInfoTag& tag,
     }
   }
 
-  AVDictionaryEntry* avtag = nullptr;
   bool hastag = false;
-  while ((avtag = av_dict_get(m_fctx->metadata, "", avtag, AV_DICT_IGNORE_SUFFIX)))
+  for (const auto& [key, value] : m_tags.tags)
   {
-    if (StringUtils::CompareNoCase(avtag->key, "imdburl") == 0 ||
-        StringUtils::CompareNoCase(avtag->key, "tmdburl") == 0)
+    if (StringUtils::EqualsNoCase(key, "imdburl") || StringUtils::EqualsNoCase(key, "tmdburl"))
     {
       CNfoFile nfo;
-      nfo.Create(avtag->value, m_info);
+      nfo.Create(value, m_info);
       m_url = nfo.ScraperUrl();
       return CInfoScanner::InfoType::URL;
     }
-    else if (StringUtils::CompareNoCase(avtag->key, "title") == 0)
-      tag.SetTitle(avtag->value);
-    else if (StringUtils::CompareNoCase(avtag->key, "director") == 0)
+    else if (StringUtils::EqualsNoCase(key, "title"))
+      tag.SetTitle(value);
+    else if (StringUtils::EqualsNoCase(key, "director"))
     {
-      std::vector<std::string> dirs = StringUtils::Split(avtag->value, " / ");
+      std::vector<std::string> dirs = StringUtils::Split(value, " / ");
       tag.SetDirector(dirs);
     }
-    else if (StringUtils::CompareNoCase(avtag->key, "date_released") == 0)
-      tag.SetYear(atoi(avtag->value));
+    else if (StringUtils::EqualsNoCase(key, "date_released"))
+      tag.SetYear(atoi(value.c_str()));
     hastag = true;
   }
 
@@ -235,47 +257,46 @@ CInfoScanner::InfoType CVideoTagLoaderFFmpeg::LoadMP4(CVideoInfoTag& tag,
                                                       std::vector<EmbeddedArt>* art)
 {
   bool hasfull = false;
-  AVDictionaryEntry* avtag = nullptr;
   // If either description or synopsis is found, assume user wants to use the tag info only
-  while ((avtag = av_dict_get(m_fctx->metadata, "", avtag, AV_DICT_IGNORE_SUFFIX)))
+  for (const auto& [key, value] : m_tags.tags)
   {
-    if (strcmp(avtag->key, "title") == 0)
-      tag.SetTitle(avtag->value);
-    else if (strcmp(avtag->key, "composer") == 0)
-      tag.SetWritingCredits(StringUtils::Split(avtag->value, " / "));
-    else if (strcmp(avtag->key, "genre") == 0)
-      tag.SetGenre(StringUtils::Split(avtag->value, " / "));
-    else if (strcmp(avtag->key,"date") == 0)
-      tag.SetYear(atoi(avtag->value));
-    else if (strcmp(avtag->key, "description") == 0)
+    if (key == "title")
+      tag.SetTitle(value);
+    else if (key == "composer")
+      tag.SetWritingCredits(StringUtils::Split(value, " / "));
+    else if (key == "genre")
+      tag.SetGenre(StringUtils::Split(value, " / "));
+    else if (key == "date")
+      tag.SetYear(atoi(value.c_str()));
+    else if (key == "description")
     {
-      tag.SetPlotOutline(avtag->value);
+      tag.SetPlotOutline(value);
       hasfull = true;
     }
-    else if (strcmp(avtag->key, "synopsis") == 0)
+    else if (key == "synopsis")
     {
-      tag.SetPlot(avtag->value);
+      tag.SetPlot(value);
       hasfull = true;
     }
-    else if (strcmp(avtag->key, "track") == 0)
-      tag.m_iTrack = std::stoi(avtag->value);
-    else if (strcmp(avtag->key, "album") == 0)
-      tag.SetAlbum(avtag->value);
-    else if (strcmp(avtag->key, "artist") == 0)
-      tag.SetArtist(StringUtils::Split(avtag->value, " / "));
+    else if (key == "track")
+      tag.m_iTrack = atoi(value.c_str());
+    else if (key == "album")
+      tag.SetAlbum(value);
+    else if (key == "artist")
+      tag.SetArtist(StringUtils::Split(value, " / "));
   }
 
-  for (size_t i = 0; i < m_fctx->nb_streams; ++i)
+  for (const ContainerAttachment& attachment : m_tags.attachments)
   {
-    if ((m_fctx->streams[i]->disposition & AV_DISPOSITION_ATTACHED_PIC) == 0)
+    if (!attachment.IsImage())
       continue;
 
-    const size_t size = m_fctx->streams[i]->attached_pic.size;
+    const size_t size = attachment.data.size();
     const std::string type = "poster";
     if (art)
-      art->emplace_back(m_fctx->streams[i]->attached_pic.data, size, "image/png", type);
+      art->emplace_back(attachment.data.data(), size, attachment.mimetype, type);
     else
-      tag.m_coverArt.emplace_back(size, "image/png", type);
+      tag.m_coverArt.emplace_back(size, attachment.mimetype, type);
   }
 
   return hasfull ? CInfoScanner::InfoType::FULL : CInfoScanner::InfoType::TITLE;
@@ -285,13 +306,12 @@ CInfoScanner::InfoType CVideoTagLoaderFFmpeg::LoadMP4(CVideoInfoTag& tag,
 CInfoScanner::InfoType CVideoTagLoaderFFmpeg::LoadAVI(CVideoInfoTag& tag,
                                                       std::vector<EmbeddedArt>* art)
 {
-  AVDictionaryEntry* avtag = nullptr;
-  while ((avtag = av_dict_get(m_fctx->metadata, "", avtag, AV_DICT_IGNORE_SUFFIX)))
+  for (const auto& [key, value] : m_tags.tags)
   {
-    if (strcmp(avtag->key, "title") == 0)
-      tag.SetTitle(avtag->value);
-    else if (strcmp(avtag->key,"date") == 0)
-      tag.SetYear(atoi(avtag->value));
+    if (key == "title")
+      tag.SetTitle(value);
+    else if (key == "date")
+      tag.SetYear(atoi(value.c_str()));
   }
 
   return CInfoScanner::InfoType::TITLE;
@@ -9,18 +9,19 @@
 #pragma once
 
 #include "IVideoInfoTagLoader.h"
+#include "utils/ContainerTagReader.h"
 
 #include <string>
 #include <vector>
 
-struct AVFormatContext;
-struct AVIOContext;
 namespace XFILE
 {
   class CFile;
 }
 
-//! \brief Video tag loader using FFMPEG.
+//! \brief Video tag loader for the tags embedded in MKV, MP4 and AVI files.
+//! \details MKV and MP4 files are read with CContainerTagReader, everything else is probed by
+//! FFmpeg.
 class CVideoTagLoaderFFmpeg : public KODI::VIDEO::IVideoInfoTagLoader
 {
 public:
@@ -45,12 +46,14 @@ public:
 
 protected:
   ADDON::ScraperPtr m_info; //!< Passed scraper info
-  AVIOContext* m_ioctx = nullptr; //!< IO context for file
-  AVFormatContext* m_fctx = nullptr; //!< Format context for file
-  XFILE::CFile* m_file = nullptr; //!< VFS file handle for file
-  mutable int m_metadata_stream = -1; //!< Stream holding kodi metadata (mkv)
+  bool m_opened = false; //!< Whether the file could be read
+  ContainerTags m_tags; //!< Tags and attachments of the file
+  mutable const ContainerAttachment* m_metadata = nullptr; //!< Kodi metadata (mkv)
   mutable bool m_override_data = false; //!< Data is for overriding
 
+  //! \brief Read the tags with FFmpeg, for the files CContainerTagReader can't read.
+  bool LoadFFmpeg(XFILE::CFile& file);
+
   //! \brief Load tags from MKV file.
   CInfoScanner::InfoType LoadMKV(CVideoInfoTag& tag, std::vector<EmbeddedArt>* art);
 
@@ -0,0 +1,127 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileItem.h"
+#include "FileItemList.h"
+#include "video/VideoDbListingCache.h"
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+void Put(CVideoDbListingCache& cache,
+         const std::string& key,
+         uint64_t generation,
+         int count,
+         std::chrono::milliseconds maxAge = 0ms,
+         const std::string& prefix = "")
+{
+  CFileItemList items;
+  items.Add(std::make_shared<CFileItem>("videodb://movies/titles/0", false));
+  for (int i = 1; i <= count; ++i)
+    items.Add(std::make_shared<CFileItem>(prefix + std::to_string(i)));
+  items.SetProperty("total", count);
+
+  // the first item was in the list before the query and is not part of the listing
+  cache.Put(key, generation, items, 1, {"total", "missing"}, maxAge);
+}
+} // namespace
+
+TEST(TestVideoDbListingCache, GetPut)
+{
+  CVideoDbListingCache cache;
+  CFileItemList out;
+  EXPECT_FALSE(cache.Get("movies", out));
+
+  Put(cache, "movies", cache.GetGeneration(), 3, 0ms, "movie");
+
+  out.Add(std::make_shared<CFileItem>("existing"));
+  ASSERT_TRUE(cache.Get("movies", out));
+  ASSERT_EQ(4, out.Size());
+  EXPECT_EQ("existing", out[0]->GetLabel());
+  EXPECT_EQ("movie1", out[1]->GetLabel());
+  EXPECT_EQ("movie3", out[3]->GetLabel());
+  EXPECT_EQ(3, out.GetProperty("total").asInteger());
+  EXPECT_FALSE(out.HasProperty("missing"));
+
+  // handed out items are copies
+  out[1]->SetLabel("changed");
+  CFileItemList again;
+  ASSERT_TRUE(cache.Get("movies", again));
+  EXPECT_EQ("movie1", again[0]->GetLabel());
+
+  const auto stats = cache.GetStats();
+  EXPECT_EQ(1u, stats.entries);
+  EXPECT_EQ(3u, stats.items);
+  EXPECT_EQ(2u, stats.hits);
+  EXPECT_EQ(1u, stats.misses);
+}
+
+TEST(TestVideoDbListingCache, Invalidate)
+{
+  CVideoDbListingCache cache;
+  CFileItemList out;
+
+  const uint64_t before = cache.GetGeneration();
+  Put(cache, "movies", before, 2);
+  cache.Invalidate();
+  EXPECT_FALSE(cache.Get("movies", out));
+
+  // results of a query that overlapped with a change are not stored
+  Put(cache, "movies", before, 2);
+  EXPECT_FALSE(cache.Get("movies", out));
+
+  Put(cache, "movies", cache.GetGeneration(), 2);
+  EXPECT_TRUE(cache.Get("movies", out));
+  EXPECT_EQ(1u, cache.GetStats().invalidations);
+}
+
+TEST(TestVideoDbListingCache, Limits)
+{
+  CVideoDbListingCache cache;
+  cache.SetMaxItems(5);
+  CFileItemList out;
+
+  Put(cache, "a", cache.GetGeneration(), 2);
+  Put(cache, "b", cache.GetGeneration(), 2);
+  ASSERT_TRUE(cache.Get("a", out));
+
+  // "b" is the least recently used
+  Put(cache, "c", cache.GetGeneration(), 2);
+  EXPECT_FALSE(cache.Get("b", out));
+  EXPECT_TRUE(cache.Get("a", out));
+  EXPECT_TRUE(cache.Get("c", out));
+
+  // too big to be cached at all
+  Put(cache, "d", cache.GetGeneration(), 6);
+  EXPECT_FALSE(cache.Get("d", out));
+
+  cache.SetMaxItems(0);
+  EXPECT_EQ(0u, cache.GetStats().entries);
+  Put(cache, "a", cache.GetGeneration(), 2);
+  EXPECT_FALSE(cache.Get("a", out));
+}
+
+TEST(TestVideoDbListingCache, MaxAge)
+{
+  CVideoDbListingCache cache;
+  CFileItemList out;
+
+  Put(cache, "movies", cache.GetGeneration(), 2, 20ms);
+  EXPECT_TRUE(cache.Get("movies", out));
+  std::this_thread::sleep_for(40ms);
+  EXPECT_FALSE(cache.Get("movies", out));
+  EXPECT_EQ(0u, cache.GetStats().items);
+}
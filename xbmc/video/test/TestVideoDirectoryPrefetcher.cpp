@@ -0,0 +1,140 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ServiceBroker.h"
+#include "jobs/JobManager.h"
+#include "threads/Event.h"
+#include "video/VideoDirectoryPrefetcher.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace KODI::VIDEO;
+using namespace std::chrono_literals;
+
+namespace
+{
+class TestVideoDirectoryPrefetcher : public testing::Test
+{
+protected:
+  TestVideoDirectoryPrefetcher()
+  {
+    CServiceBroker::RegisterJobManager(std::make_shared<CJobManager>());
+  }
+
+  ~TestVideoDirectoryPrefetcher() override
+  {
+    CServiceBroker::GetJobManager()->CancelJobs();
+    CServiceBroker::UnregisterJobManager();
+  }
+};
+
+CVideoDirectoryPrefetcher::FetchFunction Fetch(const std::string& hash)
+{
+  return [hash](CVideoDirectoryPrefetcher::Listing& listing)
+  {
+    listing.fastHash = hash;
+    listing.listed = true;
+  };
+}
+} // namespace
+
+TEST_F(TestVideoDirectoryPrefetcher, PrefetchTake)
+{
+  CVideoDirectoryPrefetcher prefetcher(2);
+  EXPECT_FALSE(prefetcher.Take("smb://nas/movies/"));
+
+  EXPECT_TRUE(prefetcher.Prefetch("smb://nas/movies/a/", Fetch("a")));
+  EXPECT_TRUE(prefetcher.Prefetch("smb://nas/movies/b/", Fetch("b")));
+  // already being fetched
+  EXPECT_TRUE(prefetcher.Prefetch("smb://nas/movies/a/", Fetch("other")));
+  EXPECT_EQ(2u, prefetcher.GetPending());
+
+  auto pending = prefetcher.Take("smb://nas/movies/b/");
+  ASSERT_TRUE(pending);
+  EXPECT_EQ(1u, prefetcher.GetPending());
+  const auto listing = pending.Wait();
+  ASSERT_NE(nullptr, listing);
+  EXPECT_EQ("b", listing->fastHash);
+  EXPECT_TRUE(listing->listed);
+
+  // a taken listing is gone
+  EXPECT_FALSE(prefetcher.Take("smb://nas/movies/b/"));
+
+  // dropping a pending listing discards it
+  prefetcher.Take("smb://nas/movies/a/");
+  EXPECT_EQ(0u, prefetcher.GetPending());
+}
+
+TEST_F(TestVideoDirectoryPrefetcher, Limits)
+{
+  CVideoDirectoryPrefetcher disabled(0);
+  EXPECT_FALSE(disabled.CanPrefetch());
+  EXPECT_FALSE(disabled.Prefetch("nfs://nas/movies/", Fetch("")));
+
+  CVideoDirectoryPrefetcher prefetcher(1, 2);
+  EXPECT_TRUE(prefetcher.Prefetch("nfs://nas/movies/a/", Fetch("a")));
+  EXPECT_TRUE(prefetcher.Prefetch("nfs://other/movies/b/", Fetch("b")));
+  EXPECT_FALSE(prefetcher.CanPrefetch());
+  EXPECT_FALSE(prefetcher.Prefetch("nfs://nas/movies/c/", Fetch("c")));
+
+  prefetcher.Take("nfs://nas/movies/a/").Wait();
+  EXPECT_TRUE(prefetcher.CanPrefetch());
+  EXPECT_TRUE(prefetcher.Prefetch("nfs://nas/movies/c/", Fetch("c")));
+}
+
+TEST_F(TestVideoDirectoryPrefetcher, BoundedPerHost)
+{
+  std::atomic<int> running{0};
+  std::atomic<int> maxRunning{0};
+  const auto fetch = [&](CVideoDirectoryPrefetcher::Listing& listing)
+  {
+    const int now = ++running;
+    int max = maxRunning;
+    while (now > max && !maxRunning.compare_exchange_weak(max, now))
+      ;
+    std::this_thread::sleep_for(10ms);
+    --running;
+    listing.listed = true;
+  };
+
+  CVideoDirectoryPrefetcher prefetcher(2);
+  for (int i = 0; i < 8; i++)
+    ASSERT_TRUE(prefetcher.Prefetch("nfs://nas/movies/" + std::to_string(i) + "/", fetch));
+
+  for (int i = 0; i < 8; i++)
+  {
+    const auto listing = prefetcher.Take("nfs://nas/movies/" + std::to_string(i) + "/").Wait();
+    ASSERT_NE(nullptr, listing);
+    EXPECT_TRUE(listing->listed);
+  }
+  EXPECT_LE(maxRunning, 2);
+}
+
+TEST_F(TestVideoDirectoryPrefetcher, CancelWakesWaiters)
+{
+  CEvent release(true);
+  CVideoDirectoryPrefetcher prefetcher(1);
+
+  // the first job blocks the queue of the host, so the second one never starts
+  ASSERT_TRUE(prefetcher.Prefetch("nfs://nas/movies/a/",
+                                  [&](CVideoDirectoryPrefetcher::Listing&) { release.Wait(); }));
+  ASSERT_TRUE(prefetcher.Prefetch("nfs://nas/movies/b/", Fetch("b")));
+  auto pending = prefetcher.Take("nfs://nas/movies/b/");
+
+  prefetcher.Cancel();
+  EXPECT_EQ(nullptr, pending.Wait());
+  EXPECT_EQ(0u, prefetcher.GetPending());
+
+  release.Set();
+}
@@ -69,6 +69,11 @@ public:
   virtual bool SetFullScreen(bool fullScreen, RESOLUTION_INFO& res, bool blankOtherDisplays) = 0;
   virtual void SetDirtyRegions(const CDirtyRegionList& dirtyRegionsList) {}
   virtual int GetBufferAge() { return 2; }
+  /*!
+   * \brief Whether GetBufferAge() reports the real age of the back buffer, so that frames can be
+   * rendered by only redrawing their dirty regions.
+   */
+  virtual bool IsBufferAgeSupported() { return false; }
   virtual bool MoveWindow(int topLeft, int topRight){return false;}
   virtual void FinishModeChange(RESOLUTION res){}
   virtual void FinishWindowResize(int newWidth, int newHeight) {ResizeWindow(newWidth, newHeight, -1, -1);}
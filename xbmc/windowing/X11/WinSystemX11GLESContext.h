@@ -41,6 +41,7 @@ public:
   bool DestroyWindowSystem() override;
   bool DestroyWindow() override;
   int GetBufferAge() override { return m_bufferAgeSupport ? m_pGLContext->GetBufferAge() : 2; }
+  bool IsBufferAgeSupported() override { return m_bufferAgeSupport; }
 
   bool IsExtSupported(const char* extension) const override;
 
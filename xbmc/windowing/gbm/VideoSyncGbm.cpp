@@ -25,6 +25,12 @@
 #include <xf86drm.h>
 #include <xf86drmMode.h>
 
+namespace
+{
+// how long before the expected vblank polling starts again
+constexpr int64_t VBLANK_MARGIN_US = 2000;
+} // namespace
+
 CVideoSyncGbm::CVideoSyncGbm(CVideoReferenceClock* clock)
   : CVideoSync(clock), m_winSystem(CServiceBroker::GetWinSystem())
 {
@@ -87,6 +93,10 @@ void CVideoSyncGbm::Run(CEvent& stopEvent)
   }
   CLog::Log(LOGDEBUG, "CVideoSyncGbm::{}: started {}", __FUNCTION__, m_fd);
 
+  // a change of the refresh rate aborts the loop, so the period stays valid
+  const float fps = m_winSystem->GetGfxContext().GetFPS();
+  const int64_t periodUs = fps > 0.0f ? static_cast<int64_t>(1000000.0f / fps) : 0;
+
   while (!stopEvent.Signaled() && !m_abort)
   {
     uint64_t sequence = 0, ns = 0;
@@ -103,6 +113,13 @@ void CVideoSyncGbm::Run(CEvent& stopEvent)
 
     m_refClock->UpdateClock(sequence - m_sequence, m_offset + ns);
     m_sequence = sequence;
+
+    // nothing changes until the next vblank, only start polling again shortly before it
+    const int64_t sinceVblankUs =
+        (CurrentHostCounter() - static_cast<int64_t>(m_offset + ns)) / 1000;
+    const int64_t sleepUs = periodUs - VBLANK_MARGIN_US - sinceVblankUs;
+    if (sleepUs > 0 && stopEvent.Wait(std::chrono::microseconds(sleepUs)))
+      break;
   }
 }
 
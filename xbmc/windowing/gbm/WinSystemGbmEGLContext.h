@@ -35,8 +35,10 @@ public:
   void SetDirtyRegions(const CDirtyRegionList& dirtyRegions) override
   {
     m_eglContext.SetDamagedRegions(dirtyRegions);
+    m_DRM->SetDamagedRegions(dirtyRegions);
   }
   int GetBufferAge() override { return m_eglContext.GetBufferAge(); }
+  bool IsBufferAgeSupported() override { return m_eglContext.IsBufferAgeSupported(); }
 
   bool BindTextureUploadContext() override;
   bool UnbindTextureUploadContext() override;
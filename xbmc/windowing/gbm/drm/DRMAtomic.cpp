@@ -14,18 +14,29 @@
 #include "settings/Settings.h"
 #include "utils/log.h"
 
+#include <algorithm>
+#include <cmath>
 #include <errno.h>
 #include <string.h>
+#include <vector>
 
 #include <drm_fourcc.h>
 #include <drm_mode.h>
+#include <poll.h>
 #include <unistd.h>
 
 using namespace KODI::WINDOWING::GBM;
 
+namespace
+{
+// longest wait for the previous page flip, a few frames at the lowest refresh rates
+constexpr int FLIP_TIMEOUT_MS = 100;
+} // namespace
+
 void CDRMAtomic::DrmAtomicCommit(int fb_id, int flags, bool rendered, bool videoLayer)
 {
   uint32_t blob_id;
+  uint32_t damageBlobId = 0;
 
   if (flags & DRM_MODE_ATOMIC_ALLOW_MODESET)
   {
@@ -65,6 +76,10 @@ void CDRMAtomic::DrmAtomicCommit(int fb_id, int flags, bool rendered, bool video
     AddProperty(m_gui_plane, "CRTC_W", m_mode->hdisplay);
     AddProperty(m_gui_plane, "CRTC_H", m_mode->vdisplay);
 
+    damageBlobId = CreateDamageBlob();
+    if (damageBlobId)
+      AddProperty(m_gui_plane, "FB_DAMAGE_CLIPS", damageBlobId);
+
     if (m_inFenceFd != -1)
     {
       AddProperty(m_crtc, "OUT_FENCE_PTR", reinterpret_cast<uint64_t>(&m_outFenceFd));
@@ -95,18 +110,33 @@ void CDRMAtomic::DrmAtomicCommit(int fb_id, int flags, bool rendered, bool video
 
     // update the old atomic request with the new fb id to avoid tearing
     if (rendered)
+    {
       AddProperty(m_gui_plane, "FB_ID", fb_id);
+
+      // the damage of the old request refers to a blob that's gone, treat the whole frame as new
+      if (m_gui_plane->SupportsProperty("FB_DAMAGE_CLIPS"))
+        AddProperty(m_gui_plane, "FB_DAMAGE_CLIPS", 0);
+    }
   }
 
-  ret = drmModeAtomicCommit(m_fd, m_req->Get(), flags, nullptr);
+  // the previous frame was committed without blocking, only one flip can be pending though
+  WaitForFlip();
+
+  // get notified when a non-blocking commit took effect
+  if (flags & DRM_MODE_ATOMIC_NONBLOCK)
+    flags |= DRM_MODE_PAGE_FLIP_EVENT;
+
+  ret = drmModeAtomicCommit(m_fd, m_req->Get(), flags, this);
   if (ret < 0)
   {
     CLog::Log(LOGERROR, "CDRMAtomic::{} - atomic commit failed: {}", __FUNCTION__, strerror(errno));
     m_atomicRequestQueue.pop_back();
   }
-  else if (m_atomicRequestQueue.size() > 1)
+  else
   {
-    m_atomicRequestQueue.pop_front();
+    m_flipPending = (flags & DRM_MODE_PAGE_FLIP_EVENT) != 0;
+    if (m_atomicRequestQueue.size() > 1)
+      m_atomicRequestQueue.pop_front();
   }
 
   if (m_inFenceFd != -1)
@@ -122,6 +152,12 @@ void CDRMAtomic::DrmAtomicCommit(int fb_id, int flags, bool rendered, bool video
                 strerror(errno));
   }
 
+  if (damageBlobId && drmModeDestroyPropertyBlob(m_fd, damageBlobId) != 0)
+    CLog::Log(LOGERROR, "CDRMAtomic::{} - failed to destroy damage blob: {}", __FUNCTION__,
+              strerror(errno));
+
+  m_damagedRegions.clear();
+
   m_atomicRequestQueue.emplace_back(std::make_unique<CDRMAtomicRequest>());
   m_req = m_atomicRequestQueue.back().get();
 }
@@ -159,6 +195,74 @@ void CDRMAtomic::FlipPage(struct gbm_bo* bo, bool rendered, bool videoLayer, boo
   DrmAtomicCommit(!drm_fb ? 0 : drm_fb->fb_id, flags, rendered, videoLayer);
 }
 
+void CDRMAtomic::PageFlipHandler(
+    int fd, unsigned int frame, unsigned int sec, unsigned int usec, void* data)
+{
+  (void)fd, (void)frame, (void)sec, (void)usec;
+
+  static_cast<CDRMAtomic*>(data)->m_flipPending = false;
+}
+
+void CDRMAtomic::WaitForFlip()
+{
+  if (!m_flipPending)
+    return;
+
+  pollfd drmFds = {m_fd, POLLIN, 0};
+
+  drmEventContext drmEvctx{};
+  drmEvctx.version = DRM_EVENT_CONTEXT_VERSION;
+  drmEvctx.page_flip_handler = PageFlipHandler;
+
+  while (m_flipPending)
+  {
+    // a flip takes a frame at most, don't hang if the event got lost
+    const int ret = poll(&drmFds, 1, FLIP_TIMEOUT_MS);
+    if (ret <= 0 || (drmFds.revents & (POLLHUP | POLLERR)))
+    {
+      CLog::Log(LOGWARNING, "CDRMAtomic::{} - no page flip event received", __FUNCTION__);
+      m_flipPending = false;
+      break;
+    }
+
+    if (drmFds.revents & POLLIN)
+      drmHandleEvent(m_fd, &drmEvctx);
+  }
+}
+
+uint32_t CDRMAtomic::CreateDamageBlob()
+{
+  if (m_damagedRegions.empty() || !m_gui_plane->SupportsProperty("FB_DAMAGE_CLIPS"))
+    return 0;
+
+  std::vector<drm_mode_rect> rects;
+  rects.reserve(m_damagedRegions.size());
+  for (const auto& region : m_damagedRegions)
+  {
+    drm_mode_rect rect;
+    rect.x1 = std::clamp(static_cast<int>(std::floor(region.x1)), 0, m_width);
+    rect.y1 = std::clamp(static_cast<int>(std::floor(region.y1)), 0, m_height);
+    rect.x2 = std::clamp(static_cast<int>(std::ceil(region.x2)), 0, m_width);
+    rect.y2 = std::clamp(static_cast<int>(std::ceil(region.y2)), 0, m_height);
+    if (rect.x2 > rect.x1 && rect.y2 > rect.y1)
+      rects.emplace_back(rect);
+  }
+
+  if (rects.empty())
+    return 0;
+
+  uint32_t blobId = 0;
+  if (drmModeCreatePropertyBlob(m_fd, rects.data(), rects.size() * sizeof(drm_mode_rect),
+                                &blobId) != 0)
+  {
+    CLog::Log(LOGERROR, "CDRMAtomic::{} - failed to create damage blob: {}", __FUNCTION__,
+              strerror(errno));
+    return 0;
+  }
+
+  return blobId;
+}
+
 bool CDRMAtomic::InitDrm()
 {
   if (!CDRMUtils::OpenDrm(true))
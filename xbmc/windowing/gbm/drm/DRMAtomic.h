@@ -37,9 +37,14 @@ public:
 
 private:
   void DrmAtomicCommit(int fb_id, int flags, bool rendered, bool videoLayer);
+  uint32_t CreateDamageBlob();
+  void WaitForFlip();
+  static void PageFlipHandler(
+      int fd, unsigned int frame, unsigned int sec, unsigned int usec, void* data);
 
   bool m_need_modeset;
   bool m_active = true;
+  bool m_flipPending = false;
 
   class CDRMAtomicRequest
   {
@@ -29,6 +29,8 @@ static int flip_happening = 0;
 
 bool CDRMLegacy::SetVideoMode(const RESOLUTION_INFO& res, struct gbm_bo* bo)
 {
+  WaitingForFlip();
+
   struct drm_fb* drm_fb = DrmFbGetFromBo(bo);
 
   auto ret = drmModeSetCrtc(m_fd, m_crtc->GetCrtcId(), drm_fb->fb_id, 0, 0,
@@ -111,8 +113,10 @@ void CDRMLegacy::FlipPage(struct gbm_bo* bo, bool rendered, bool videoLayer, boo
 {
   if (rendered || videoLayer)
   {
-    flip_happening = QueueFlip(bo);
+    // the next frame is rendered while this one waits for the vblank, so only wait for the
+    // previous flip before queueing a new one
     WaitingForFlip();
+    flip_happening = QueueFlip(bo);
   }
 }
 
@@ -12,6 +12,7 @@
 #include "DRMCrtc.h"
 #include "DRMEncoder.h"
 #include "DRMPlane.h"
+#include "guilib/DirtyRegion.h"
 #include "windowing/Resolution.h"
 #include "windowing/gbm/GBMUtils.h"
 
@@ -71,6 +72,13 @@ public:
     return std::exchange(m_outFenceFd, fd);
   }
 
+  /*!
+   \brief Set the regions of the gui plane that changed in the frame about to be flipped. They
+   are passed to the kernel with the next commit, so the display controller only has to fetch those
+   parts of the frame. Not setting any marks the whole frame as changed.
+   */
+  void SetDamagedRegions(const CDirtyRegionList& dirtyRegions) { m_damagedRegions = dirtyRegions; }
+
 protected:
   bool OpenDrm(bool needConnector);
   drm_fb* DrmFbGetFromBo(struct gbm_bo* bo);
@@ -90,6 +98,8 @@ protected:
   int m_inFenceFd{-1};
   int m_outFenceFd{-1};
 
+  CDirtyRegionList m_damagedRegions;
+
   std::vector<std::unique_ptr<CDRMPlane>> m_planes;
 
 private:
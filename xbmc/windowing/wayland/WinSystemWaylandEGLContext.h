@@ -47,6 +47,7 @@ public:
     m_eglContext.SetDamagedRegions(dirtyRegions);
   }
   int GetBufferAge() override { return m_eglContext.GetBufferAge(); }
+  bool IsBufferAgeSupported() override { return m_eglContext.IsBufferAgeSupported(); }
 
   bool BindTextureUploadContext() override;
   bool UnbindTextureUploadContext() override;
@@ -12,11 +12,13 @@
 #include "GUIInfoManager.h"
 #include "ServiceBroker.h"
 #include "addons/Skin.h"
+#include "application/Application.h"
 #include "filesystem/SpecialProtocol.h"
 #include "guilib/GUIComponent.h"
 #include "guilib/GUIControlFactory.h"
 #include "guilib/GUIControlProfiler.h"
 #include "guilib/GUIFontManager.h"
+#include "guilib/GUIFrameStats.h"
 #include "guilib/GUITextLayout.h"
 #include "guilib/GUIWindowManager.h"
 #include "input/WindowTranslator.h"
@@ -42,7 +44,8 @@ CGUIWindowDebugInfo::~CGUIWindowDebugInfo(void) = default;
 
 void CGUIWindowDebugInfo::UpdateVisibility()
 {
-  if (LOG_LEVEL_DEBUG_FREEMEM <= CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_logLevel || g_SkinInfo->IsDebugging())
+  if (LOG_LEVEL_DEBUG_FREEMEM <= CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_logLevel || g_SkinInfo->IsDebugging() ||
+      CGUIFrameStats::GetInstance().IsEnabled())
     Open();
   else
     Close();
@@ -129,6 +132,19 @@ void CGUIWindowDebugInfo::Process(unsigned int currentTime, CDirtyRegionList &di
                                    .GetFPS(),
                                strCores, ucAppName, dCPU, profiling);
 #endif
+
+    const auto& advancedSettings = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+    if (advancedSettings->m_guiIdleRenderFps > 0)
+    {
+      const int fps = advancedSettings->m_guiIdleRenderFps;
+      info += g_application.IsGuiRenderThrottled()
+                  ? StringUtils::Format("\nRENDER: idle, {} fps", fps)
+                  : "\nRENDER: full rate";
+
+      CTemperature temperature;
+      if (CServiceBroker::GetCPUInfo()->GetTemperature(temperature) && temperature.IsValid())
+        info += StringUtils::Format(" - TEMP: {:.0f} C", temperature.ToCelsius());
+    }
   }
 
   // render the skin debug info
@@ -167,6 +183,14 @@ void CGUIWindowDebugInfo::Process(unsigned int currentTime, CDirtyRegionList &di
     }
   }
 
+  // frame time statistics
+  if (CGUIFrameStats::GetInstance().IsEnabled())
+  {
+    if (!info.empty())
+      info += "\n";
+    info += CGUIFrameStats::GetInstance().GetText();
+  }
+
   float w, h;
   if (m_layout->Update(info))
     MarkDirtyRegion();
@@ -18,6 +18,7 @@
 #include "input/actions/ActionIDs.h"
 #include "interfaces/AnnouncementManager.h"
 #include "jobs/JobManager.h"
+#include "media/MediaType.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/RecentlyAddedJob.h"
@@ -27,6 +28,32 @@
 
 #include <mutex>
 
+namespace
+{
+/*!
+ \brief Get the recently added lists an item of the given type can show up in.
+ */
+int GetRecentlyAddedFlag(ANNOUNCEMENT::AnnouncementFlag flag, const std::string& type)
+{
+  if (flag & ANNOUNCEMENT::VideoLibrary)
+  {
+    if (type == MediaTypeMovie)
+      return LatestMovies;
+    if (type == MediaTypeEpisode || type == MediaTypeSeason || type == MediaTypeTvShow)
+      return LatestEpisodes;
+    if (type == MediaTypeMusicVideo)
+      return LatestMusicVideos;
+    return Video;
+  }
+
+  if (type == MediaTypeSong)
+    return LatestSongs;
+  if (type == MediaTypeAlbum)
+    return LatestSongs | LatestAlbums;
+  return Audio;
+}
+} // unnamed namespace
+
 CGUIWindowHome::CGUIWindowHome(void) : CGUIWindow(WINDOW_HOME, "Home.xml")
 {
   m_updateRA = (Audio | Video | Totals);
@@ -88,18 +115,18 @@ void CGUIWindowHome::Announce(ANNOUNCEMENT::AnnouncementFlag flag,
   if (message == "OnScanStarted" || message == "OnCleanStarted")
     return;
 
+  const bool video = flag & ANNOUNCEMENT::VideoLibrary;
   bool onUpdate = message == "OnUpdate";
-  // always update Totals except on an OnUpdate with no playcount update
+  // always update Totals of the changed library except on an OnUpdate with no playcount update
   if (!onUpdate || data.isMember("playcount"))
-    ra_flag |= Totals;
+    ra_flag |= video ? VideoTotals : MusicTotals;
 
-  // always update the full list except on an OnUpdate
-  if (!onUpdate)
+  // update the lists the changed item can show up in except on an OnUpdate of an existing item,
+  // every list of the library for changes not about a single item (scans, cleans, refreshes)
+  if (!onUpdate || data.isMember("added"))
   {
-    if (flag & ANNOUNCEMENT::VideoLibrary)
-      ra_flag |= Video;
-    else if (flag & ANNOUNCEMENT::AudioLibrary)
-      ra_flag |= Audio;
+    const CVariant& item = data.isMember("item") ? data["item"] : data;
+    ra_flag |= GetRecentlyAddedFlag(flag, item["type"].asString());
   }
 
   CGUIMessage reload(GUI_MSG_NOTIFY_ALL, GetID(), 0, GUI_MSG_REFRESH_THUMBS, ra_flag);